@@ -60,13 +60,13 @@ ReplaceEvaler::eval(Field * n, const std::list<std::string> & args, BraceExpande
   Node * curr = n;
   while ((curr = curr->parent()))
   {
-    auto src = curr->find(var);
+    auto src = exp.lookup(curr, var);
     if (src && src != n && src->type() == NodeType::Field)
     {
       exp.used.push_back(pathJoin({curr->fullpath(), var}));
       // change kind only (not val)
       n->setVal(n->val(), dynamic_cast<Field *>(src)->kind());
-      return curr->param<std::string>(var);
+      return src->param<std::string>();
     }
   }
 
@@ -113,6 +113,23 @@ BraceExpander::walk(const std::string & /*fullpath*/, const std::string & /*node
   }
 }
 
+Node *
+BraceExpander::lookup(Node * scope, const std::string & var)
+{
+  auto root = scope->root();
+  if (root != _lookup_root)
+  {
+    _lookups.clear();
+    _lookup_root = root;
+  }
+
+  auto key = std::make_pair(scope, var);
+  auto it = _lookups.find(key);
+  if (it != _lookups.end())
+    return it->second;
+  return _lookups[key] = scope->find(var);
+}
+
 std::string
 BraceExpander::expand(Field * f, const std::string & input)
 {
@@ -199,7 +216,7 @@ parseBraceBody(const std::string & input, size_t start, BraceNode & n)
   start = skipSpace(input, start);
   while (start < input.size() && input[start] != '}')
   {
-    if (input.find("${", start) == start)
+    if (input.compare(start, 2, "${") == 0)
       start = parseBraceNode(input, start, n.append());
     else
     {
@@ -88,6 +88,12 @@ public:
   virtual void walk(const std::string & /*fullpath*/, const std::string & /*nodepath*/, Node * n);
   std::string expand(Field * n, const std::string & input);
 
+  /// lookup returns scope->find(var), memoized: every replacement expression searches each of its
+  /// enclosing sections in turn, so without the memo expanding an input with many references to a
+  /// top-level variable is quadratic in the size of the input.  The memo is reset when used on a
+  /// different tree, but assumes the tree doesn't gain or lose nodes while it is being expanded.
+  Node * lookup(Node * scope, const std::string & var);
+
   std::vector<std::string> used;
   std::vector<std::string> errors;
   std::string fname;
@@ -96,6 +102,8 @@ private:
   std::string expand(Field * n, BraceNode & expr);
   std::map<std::string, Evaler *> _evalers;
   ReplaceEvaler _replace;
+  Node * _lookup_root = nullptr;
+  std::map<std::pair<Node *, std::string>, Node *> _lookups;
 };
 
 } // namespace hit
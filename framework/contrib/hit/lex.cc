@@ -31,17 +31,12 @@ charIn(char c, const std::string & valid)
 #define TMPEOF EOF
 #undef EOF
 
+// lineCount returns the number of newlines in input between the offsets begin and end - without
+// copying that part of the input.
 int
-lineCount(const std::string & input)
+lineCount(const std::string & input, size_t begin, size_t end)
 {
-  int n = 0;
-  size_t pos = input.find("\n", 0); // first occurrence
-  while (pos < std::string::npos)
-  {
-    n++;
-    pos = input.find("\n", pos + 1);
-  }
-  return n;
+  return std::count(input.begin() + begin, input.begin() + end, '\n');
 }
 
 std::string
@@ -110,7 +105,7 @@ Lexer::rewind()
     return;
 
   // subtract newlines that may have been ignored
-  _line_count -= lineCount(_input.substr(tmp, _start - tmp));
+  _line_count -= lineCount(_input, tmp, _start);
   _pos = tmp;
   if (_pos < _start)
     _start = _pos;
@@ -119,9 +114,8 @@ Lexer::rewind()
 void
 Lexer::emit(TokType type)
 {
-  auto substr = _input.substr(_start, _pos - _start);
-  _tokens.push_back(Token(type, substr, _start, _line_count));
-  _line_count += lineCount(substr);
+  _tokens.push_back(Token(type, _input.substr(_start, _pos - _start), _start, _line_count));
+  _line_count += lineCount(_input, _start, _pos);
   _start = _pos;
 }
 
@@ -134,8 +128,7 @@ Lexer::lastToken()
 void
 Lexer::ignore()
 {
-  auto substr = _input.substr(_start, _pos - _start);
-  _line_count += lineCount(substr);
+  _line_count += lineCount(_input, _start, _pos);
   _start = _pos;
 }
 
@@ -199,7 +192,7 @@ Lexer::backup()
   _pos = std::max(_start, _pos - _width);
 }
 
-std::string
+const std::string &
 Lexer::input()
 {
   return _input;
@@ -135,8 +135,9 @@ public:
   void backup();
 
   /// input returns the full input text the lexer is operating on i.e. the entire input string it
-  /// was initialized/constructed with.
-  std::string input();
+  /// was initialized/constructed with.  It is returned by reference: lex functions call it for
+  /// every string token and copying the whole input each time made lexing quadratic.
+  const std::string & input();
   /// start returns the current start byte offset into the input identifying the start of the next
   /// token that will be emitted (or next section of input that will be ignored).
   size_t start();
@@ -5,6 +5,7 @@
 #include <sstream>
 #include <set>
 #include <iterator>
+#include <functional>
 #include <memory>
 #include <regex>
 
@@ -171,12 +172,14 @@ Node::~Node()
   if (!_parent)
     return;
 
+  // search from the back: children are deleted last-first by the parent's destructor, which made
+  // deleting a section with many children quadratic when searching from the front.
   auto & parentkids = _parent->_children;
-  for (auto it = parentkids.begin(); it != parentkids.end(); it++)
+  for (auto it = parentkids.rbegin(); it != parentkids.rend(); it++)
   {
     if (*it == this)
     {
-      parentkids.erase(it);
+      parentkids.erase(std::next(it).base());
       break;
     }
   }
@@ -255,6 +258,14 @@ Node::insertChild(std::size_t index, Node * child)
   _children.insert(_children.begin() + index, child);
 }
 
+Node *
+Node::lastChild()
+{
+  if (_children.empty())
+    return nullptr;
+  return _children.back();
+}
+
 std::vector<Node *>
 Node::children(NodeType t)
 {
@@ -308,7 +319,7 @@ Node::fullpath()
   auto ppath = _parent->fullpath();
   if (ppath.empty())
     return path();
-  return _parent->fullpath() + "/" + path();
+  return ppath + "/" + path();
 }
 
 void
@@ -518,6 +529,9 @@ Field::clone()
 {
   auto n = new Field(_field, _kind, _val);
   n->tokens() = tokens();
+  // fields hold their inline comments as children
+  for (auto child : children())
+    n->addChild(child->clone());
   return n;
 }
 
@@ -677,7 +691,7 @@ class Parser
 {
 public:
   Parser(const std::string & name, const std::string & input, std::vector<Token> tokens)
-    : _name(name), _input(input), _tokens(tokens)
+    : _name(name), _input(input), _tokens(std::move(tokens))
   {
   }
 
@@ -738,7 +752,7 @@ public:
 private:
   std::vector<Node *> _current_scope;
   std::string _name;
-  std::string _input;
+  const std::string & _input;
   std::vector<Token> _tokens;
   size_t _start = 0;
   size_t _pos = 0;
@@ -753,7 +767,7 @@ void parseExitPath(Parser * p, Node * n);
 void
 parseExitPath(Parser * p, Node * n)
 {
-  auto secOpenToks = p->scope()->tokens();
+  auto & secOpenToks = p->scope()->tokens();
 
   auto tok = p->next();
   if (tok.type != TokType::LeftBracket)
@@ -762,7 +776,7 @@ parseExitPath(Parser * p, Node * n)
   auto path = p->require(TokType::Path, "malformed section close, expected PATH");
   p->require(TokType::RightBracket, "expected ']'");
 
-  auto s = n->children().back();
+  auto s = n->lastChild();
   for (size_t i = p->start(); i < p->pos(); i++)
     s->tokens().push_back(p->tokens()[i]);
 
@@ -904,8 +918,8 @@ parseComment(Parser * p, Node * n)
     p->error(tok, "the parser is broken");
 
   auto comment = p->emit(new Comment(tok.val, isinline));
-  if (tok.type == TokType::InlineComment && n->children().size() > 0)
-    n->children()[n->children().size() - 1]->addChild(comment);
+  if (tok.type == TokType::InlineComment && n->lastChild())
+    n->lastChild()->addChild(comment);
   else
     n->addChild(comment);
 }
@@ -917,13 +931,31 @@ Node *
 parse(const std::string & fname, const std::string & input)
 {
   Lexer lex(fname, input);
-  auto tokens = lex.run(lexHit);
-  Parser parser(fname, input, tokens);
+  Parser parser(fname, input, lex.run(lexHit));
   std::unique_ptr<Node> root(new Section(""));
   parseSectionBody(&parser, root.get());
   return root.release();
 }
 
+Node *
+ParseCache::parse(const std::string & fname, const std::string & input)
+{
+  auto key = std::hash<std::string>()(fname + '\0' + input);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto range = _entries.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+      if (it->second.fname == fname && it->second.input == input)
+        return it->second.root->clone();
+  }
+
+  std::unique_ptr<Node> root(hit::parse(fname, input));
+  auto copy = root->clone();
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.insert(std::make_pair(key, Entry{fname, input, std::move(root)}));
+  return copy;
+}
+
 // MergeFieldWalker is used as part of the process of merging two parsed hit node trees.
 class MergeFieldWalker : public Walker
 {
@@ -8,6 +8,8 @@
 #include <typeinfo>
 #include <cstdint>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
 #include "lex.h"
 
@@ -172,6 +174,9 @@ public:
   /// children.  This node assumes/takes ownership of the memory of the passed child.
   void insertChild(std::size_t index, Node * child);
 
+  /// lastChild returns this node's most recently added child or nullptr if it has no children.
+  /// Unlike children, it doesn't copy the list of children.
+  Node * lastChild();
   /// children returns a list of this node's children of the given type t.
   std::vector<Node *> children(NodeType t = NodeType::All);
   /// parent returns a pointer to this node's parent node or nullptr if this node has no parent.
@@ -434,6 +439,43 @@ private:
 /// accepts ownership of the returned root node and is responsible for destructing it.
 Node * parse(const std::string & fname, const std::string & input);
 
+/// ParseCache holds the trees of the inputs it has parsed, keyed by a hash of their file name and
+/// text, so that an input parsed many times in one run (e.g. the input shared by the many sub-apps
+/// of a MultiApp) is only lexed and parsed once.  The text of a cached input is kept to confirm
+/// hash matches.  The cache only lives for the process: storing a tree on disk would require
+/// rendering it back to hit text, which costs about as much to read as the input itself.  The
+/// cache may be shared by threads.
+class ParseCache
+{
+public:
+  /// parse returns a deep copy of the tree of the given input - parsing it (see hit::parse) only
+  /// if it isn't in the cache already.  The caller accepts ownership of the returned root node.
+  /// Inputs with syntax errors throw, as with hit::parse, and are not cached.
+  Node * parse(const std::string & fname, const std::string & input);
+  /// size returns the number of cached trees.
+  std::size_t size()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+  }
+  /// clear removes all the cached trees.
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+  }
+
+private:
+  struct Entry
+  {
+    std::string fname;
+    std::string input;
+    std::unique_ptr<Node> root;
+  };
+  std::multimap<std::size_t, Entry> _entries;
+  std::mutex _mutex;
+};
+
 /// parses the file checking for errors but does not return any node tree.
 inline void
 check(const std::string & fname, const std::string & input)
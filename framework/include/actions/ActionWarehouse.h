@@ -19,6 +19,7 @@
 // MOOSE includes
 #include "Action.h"
 #include "ConsoleStreamInterface.h"
+#include "PerfGraphInterface.h"
 
 /// alias to hide implementation details
 using ActionIterator = std::list<Action *>::iterator;
@@ -31,7 +32,7 @@ class FEProblem;
 /**
  * Storage for action instances.
  */
-class ActionWarehouse : public ConsoleStreamInterface
+class ActionWarehouse : public ConsoleStreamInterface, public PerfGraphInterface
 {
 public:
   ActionWarehouse(MooseApp & app, Syntax & syntax, ActionFactory & factory);
@@ -288,4 +289,10 @@ private:
   ActionIterator _act_iter;
 
   const std::list<Action *> _empty_action_list;
+
+  /// The timer of each task, registered the first time the task is executed so that the startup
+  /// cost of every task shows up in the PerfGraph
+  std::map<std::string, PerfID> _task_timers;
+
+  PerfID _build_timer;
 };
@@ -18,6 +18,15 @@ class SplitMeshAction;
 template <>
 InputParameters validParams<SplitMeshAction>();
 
+/**
+ * Splits the mesh for one or more processor counts (--split-mesh n1,n2,...) and writes each
+ * split so that FileMesh can later read it in parallel, every rank reading only its own piece:
+ *
+ * @begincode
+ * <split_file>.cpr/<n>/...        CheckpointIO split (the default)
+ * <split_file>.e.<n>.<rank>       Nemesis pieces (--split-format nemesis)
+ * @endcode
+ */
 class SplitMeshAction : public Action
 {
 public:
@@ -26,5 +35,17 @@ public:
   SplitMeshAction(InputParameters params);
 
   virtual void act() override;
+
+  /**
+   * The name of the piece of \p split_file read (and written) by \p rank out of \p n_procs
+   * processors: the CheckpointIO header for a ".cpr" split, the Nemesis piece otherwise
+   */
+  static std::string
+  splitPieceName(const std::string & split_file, processor_id_type n_procs, processor_id_type rank);
+
+protected:
+  /// Timers
+  const PerfID _partition_timer;
+  const PerfID _write_split_timer;
 };
 
@@ -100,6 +100,27 @@ public:
 
   const std::set<UserObjectName> & getDependObjects() const { return _depend_uo; }
 
+  /**
+   * Whether the inputs of this kernel changed since the last call, recording their current
+   * state. The tracked inputs are the solution versions of the systems of the coupled variables
+   * (SystemBase::solutionVersion()), the postprocessor values, the time and the mesh changes.
+   * Only a kernel declaring inputsTracked() can be unchanged; any other kernel, or one that
+   * still requested material properties or user objects, always changed.
+   */
+  bool inputsChanged();
+
+  /**
+   * Whether every input of this kernel is tracked by inputsChanged(). Kernels reading functions,
+   * vector postprocessors, reporters, scalar variables or controllable parameters must not
+   * override this.
+   */
+  virtual bool inputsTracked() const { return false; }
+
+  ///@{ Set by AuxiliarySystem when the kernel is skipped on an execution (see inputsChanged())
+  void setSkipped(bool skipped) { _skipped = skipped; }
+  bool skipped() const { return _skipped; }
+  ///@}
+
   void coupledCallback(const std::string & var_name, bool is_old) const override;
 
   virtual const std::set<std::string> & getRequestedItems() override;
@@ -241,6 +262,15 @@ protected:
   /// Depend UserObjects
   std::set<UserObjectName> _depend_uo;
 
+  /// Whether this kernel requested material properties or user objects, see inputsChanged()
+  bool _untracked_inputs = false;
+  /// The postprocessor values this kernel reads, recorded by getPostprocessorValue()
+  std::vector<const PostprocessorValue *> _postprocessor_inputs;
+  /// The state of the inputs at the last inputsChanged(), empty before the first
+  std::vector<Real> _input_state;
+  /// Whether the current execution skips this kernel
+  bool _skipped = false;
+
   /// number of local dofs for elemental variables
   unsigned int _n_local_dofs;
 
@@ -280,6 +310,7 @@ AuxKernelTempl<ComputeValueType>::getMaterialProperty(const std::string & name)
                _var.name(),
                "'.");
 
+  _untracked_inputs = true;
   return MaterialPropertyInterface::getMaterialProperty<T>(name);
 }
 
@@ -297,6 +328,7 @@ AuxKernelTempl<ComputeValueType>::getGenericMaterialProperty(const std::string &
                _var.name(),
                "'.");
 
+  _untracked_inputs = true;
   return MaterialPropertyInterface::getGenericMaterialProperty<T, is_ad>(name);
 }
 
@@ -314,6 +346,7 @@ AuxKernelTempl<ComputeValueType>::getMaterialPropertyOld(const std::string & nam
                _var.name(),
                "'.");
 
+  _untracked_inputs = true;
   return MaterialPropertyInterface::getMaterialPropertyOld<T>(name);
 }
 
@@ -331,6 +364,7 @@ AuxKernelTempl<ComputeValueType>::getMaterialPropertyOlder(const std::string & n
                _var.name(),
                "'.");
 
+  _untracked_inputs = true;
   return MaterialPropertyInterface::getMaterialPropertyOlder<T>(name);
 }
 
@@ -339,6 +373,7 @@ template <typename T>
 const T &
 AuxKernelTempl<ComputeValueType>::getUserObject(const UserObjectName & name)
 {
+  _untracked_inputs = true;
   _depend_uo.insert(_pars.get<UserObjectName>(name));
   auto & uo = UserObjectInterface::getUserObject<T>(name);
   auto indirect_dependents = uo.getDependObjects();
@@ -352,6 +387,7 @@ template <typename T>
 const T &
 AuxKernelTempl<ComputeValueType>::getUserObjectByName(const UserObjectName & name)
 {
+  _untracked_inputs = true;
   _depend_uo.insert(name);
   auto & uo = UserObjectInterface::getUserObjectByName<T>(name);
   auto indirect_dependents = uo.getDependObjects();
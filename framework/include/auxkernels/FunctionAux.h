@@ -37,4 +37,7 @@ protected:
 
   /// Function being used to compute the value of this kernel
   const Function & _func;
+
+  /// The function at all the quadrature points of the element, evaluated at the first one
+  std::vector<Real> _qp_values;
 };
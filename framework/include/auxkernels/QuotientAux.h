@@ -30,6 +30,9 @@ public:
 
   QuotientAux(const InputParameters & parameters);
 
+  /// Only coupled variables are read
+  virtual bool inputsTracked() const override { return true; }
+
 protected:
   virtual Real computeValue() override;
 
@@ -27,6 +27,9 @@ public:
 
   VectorMagnitudeAux(const InputParameters & parameters);
 
+  /// Only coupled variables are read
+  virtual bool inputsTracked() const override { return true; }
+
 protected:
   virtual Real computeValue() override;
 
@@ -18,6 +18,7 @@
 #include "ConsoleStreamInterface.h"
 #include "MooseTypes.h"
 #include "PerfGraphInterface.h"
+#include "RepartitionCostModel.h"
 
 #include "libmesh/parallel_object.h"
 
@@ -244,6 +245,29 @@ public:
    */
   bool isAdaptivityDue();
 
+  /**
+   * Repartitions the mesh after the adaptivity cycles that leave it out of balance, when the
+   * model predicts the balance saves more time than the migration costs (see
+   * RepartitionCostModel)
+   * @param model The cost model, with the imbalance threshold
+   */
+  void setAutoRepartition(const RepartitionCostModel & model)
+  {
+    _repartition_model = model;
+    _auto_repartition = true;
+  }
+
+  /**
+   * Gathers the active element count and stateful material data size of every processor and
+   * repartitions the mesh (then calls FEProblemBase::meshChanged()) if the cost model says so
+   * @param step_time The wall time of the last step
+   * @return Whether the mesh was repartitioned
+   */
+  bool repartitionIfImbalanced(Real step_time);
+
+  /// The cost model of the automatic repartitioning, for its last decision
+  const RepartitionCostModel & repartitionModel() const { return _repartition_model; }
+
 protected:
   FEProblemBase & _subproblem;
   MooseMesh & _mesh;
@@ -303,11 +327,20 @@ protected:
   /// Stores pointers to ErrorVectors associated with indicator field names
   std::map<std::string, std::unique_ptr<ErrorVector>> _indicator_field_to_error_vector;
 
+  /// Whether to repartition automatically after adaptivity, see setAutoRepartition()
+  bool _auto_repartition = false;
+  RepartitionCostModel _repartition_model;
+
   /// Timers
   PerfID _adapt_mesh_timer;
   PerfID _uniform_refine_timer;
   PerfID _uniform_refine_with_projection;
   PerfID _update_error_vectors;
+  /// The phases of adaptMesh(): error estimation, flagging and refinement/coarsening
+  PerfID _estimate_error_timer;
+  PerfID _flag_elements_timer;
+  PerfID _refine_and_coarsen_timer;
+  PerfID _repartition_timer;
 };
 
 template <typename T>
@@ -14,6 +14,8 @@
 #include "MooseTypes.h"
 #include "MooseVariableFE.h"
 #include "ArbitraryQuadrature.h"
+#include "CSRSlotMap.h"
+#include "BlockedElementMatrix.h"
 
 #include "libmesh/dense_vector.h"
 #include "libmesh/enum_quadrature_type.h"
@@ -51,6 +53,8 @@ class FaceInfo;
 class MooseMesh;
 class ArbitraryQuadrature;
 class SystemBase;
+class MultiTagResidualBuffer;
+class ScalarBorderBuffer;
 class MooseVariableFieldBase;
 class MooseVariableBase;
 template <typename>
@@ -670,6 +674,12 @@ public:
    */
   void init(const CouplingMatrix * cm);
 
+  /**
+   * Drops the field coupling entries whose block is not set in \p used, so that the Jacobian
+   * threads neither compute nor add them; null restores the entries of the coupling matrix
+   */
+  void setUsedJacobianBlocks(const CouplingMatrix * used);
+
   /// Create pair of variables requiring nonlocal jacobian contributions
   void initNonlocalCoupling();
 
@@ -794,6 +804,12 @@ public:
    */
   void addCachedResiduals();
 
+  /**
+   * Moves the cached residuals of the tags of a buffer into it rather than into the tagged
+   * vectors, leaving the other tags cached; see NonlinearSystemBase::setFusedTagAssembly()
+   */
+  void addCachedResiduals(MultiTagResidualBuffer & buffer);
+
   /**
    * Clears all of the residuals in _cached_residual_rows and _cached_residual_values
    *
@@ -850,6 +866,13 @@ public:
    */
   void addJacobianOffDiagScalar(unsigned int ivar);
 
+  /**
+   * Routes this thread's Jacobian blocks coupling field variables to scalar variables, and those
+   * of pairs of scalar variables, to a ScalarBorderBuffer instead of the global matrices or the
+   * cache (see NonlinearSystemBase::setScalarBorderAssembly()); nullptr restores the default.
+   */
+  void setScalarBorderBuffer(ScalarBorderBuffer * buffer) { _scalar_border_buffer = buffer; }
+
   /**
    * Adds element matrix for ivar rows and jvar columns to the global Jacobian matrix.
    */
@@ -936,6 +959,30 @@ public:
    */
   void addCachedJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Adds the cached Jacobian values for the given matrix tag directly into a lock-free CSR value
+   * array. This can be called concurrently from every thread once the slot map has been built from
+   * the sparsity pattern of the first assembly.
+   *
+   * Entries that are not part of the local pattern (e.g. rows owned by other processors) are kept
+   * in the cache so that a subsequent addCachedJacobian() inserts them through the matrix.
+   */
+  void addCachedJacobianToSlots(const CSRSlotMap & slots, LockFreeCSRValues & values, TagID tag);
+
+  /**
+   * Makes addJacobian() insert the local Jacobians of all the variable pairs of an element at once
+   * through BlockedElementMatrix, for a block matrix of the given block size (1 to disable).
+   * Elements whose dofs are not interleaved by block are still inserted variable pair by pair.
+   */
+  void useBlockedJacobianInsertion(unsigned int block_size) { _jacobian_block_size = block_size; }
+
+  /**
+   * Adds the local Jacobians of all the variable pairs to the global Jacobian matrix as one
+   * blocked insertion (MatSetValuesBlocked)
+   * @return false if the dofs of the element are not interleaved by block (nothing is added)
+   */
+  bool addJacobianBlocked(SparseMatrix<Number> & jacobian, TagID tag);
+
   /**
    * Get local residual block for a variable and a tag.
    */
@@ -1573,6 +1620,74 @@ public:
     }
   }
 
+  /**
+   * Helper function for assembling the residual contributions of all the test functions and
+   * components at once for an array variable
+   * @param re The local residual
+   * @param ntest The number of test functions
+   * @param v The contributions, one row per test function and one column per component
+   */
+  void
+  saveLocalArrayResidual(DenseVector<Number> & re, unsigned int ntest, const RealEigenMatrix & v)
+  {
+    mooseAssert(v.rows() == ntest && re.size() == ntest * v.cols(), "Wrong array residual size");
+    // The local residual is component after component, i.e. column-major (ntest x count)
+    Eigen::Map<RealEigenMatrix>(re.get_values().data(), ntest, v.cols()) += v;
+  }
+
+  /**
+   * Helper function for assembling the diagonal Jacobian of all the test and shape functions at
+   * once, for array kernels whose diagonal Jacobian at a quadrature point is a coefficient per
+   * component times a form of the test and shape functions shared by the components (e.g.
+   * diffusion with an array coefficient): component k of the block gets v(k) * form.
+   * @param ke The local Jacobian
+   * @param ntest The number of test functions
+   * @param nphi The number of shape functions
+   * @param ivar The array variable index
+   * @param v The coefficient of each component (including JxW and coord)
+   * @param form The ntest x nphi form
+   */
+  void saveDiagLocalArrayJacobian(DenseMatrix<Number> & ke,
+                                  unsigned int ntest,
+                                  unsigned int nphi,
+                                  unsigned int ivar,
+                                  const RealEigenVector & v,
+                                  const RealEigenMatrix & form)
+  {
+    const unsigned int pace = (_component_block_diagonal[ivar] ? 0 : nphi);
+    auto map = localJacobianMap(ke);
+    for (unsigned int k = 0; k < v.size(); ++k)
+      map.block(k * ntest, k * pace, ntest, nphi) += v(k) * form;
+  }
+
+  /**
+   * Helper function for assembling the full Jacobian of all the test and shape functions at once,
+   * for array kernels whose full Jacobian at a quadrature point is a coupling matrix between the
+   * components times a shared form: block (k, l) gets v(k, l) * form.
+   * @param ke The local Jacobian
+   * @param ntest The number of test functions
+   * @param nphi The number of shape functions
+   * @param ivar The array variable index
+   * @param jvar The contributing variable index
+   * @param v The coupling between the components (including JxW and coord)
+   * @param form The ntest x nphi form
+   */
+  void saveFullLocalArrayJacobian(DenseMatrix<Number> & ke,
+                                  unsigned int ntest,
+                                  unsigned int nphi,
+                                  unsigned int ivar,
+                                  unsigned int jvar,
+                                  const RealEigenMatrix & v,
+                                  const RealEigenMatrix & form)
+  {
+    const unsigned int pace = ((ivar == jvar && _component_block_diagonal[ivar]) ? 0 : nphi);
+    auto map = localJacobianMap(ke);
+    for (unsigned int l = 0; l < v.cols(); ++l)
+      for (unsigned int k = 0; k < v.rows(); ++k)
+        if (v(k, l) != 0)
+          map.block(k * ntest, l * pace, ntest, nphi) += v(k, l) * form;
+  }
+
   DenseVector<Real> getJacobianDiagonal(DenseMatrix<Number> & ke)
   {
     unsigned int rows = ke.m();
@@ -1956,12 +2071,16 @@ private:
 
   /// Entries in the coupling matrix for field variables
   std::vector<std::pair<MooseVariableFieldBase *, MooseVariableFieldBase *>> _cm_ff_entry;
+  /// All the entries of the coupling matrix for field variables, when _cm_ff_entry is filtered
+  std::vector<std::pair<MooseVariableFieldBase *, MooseVariableFieldBase *>> _cm_ff_all_entry;
   /// Entries in the coupling matrix for field variables vs scalar variables
   std::vector<std::pair<MooseVariableFieldBase *, MooseVariableScalar *>> _cm_fs_entry;
   /// Entries in the coupling matrix for scalar variables vs field variables
   std::vector<std::pair<MooseVariableScalar *, MooseVariableFieldBase *>> _cm_sf_entry;
   /// Entries in the coupling matrix for scalar variables
   std::vector<std::pair<MooseVariableScalar *, MooseVariableScalar *>> _cm_ss_entry;
+  /// Where the field-scalar and scalar-scalar blocks go when set, see setScalarBorderBuffer()
+  ScalarBorderBuffer * _scalar_border_buffer = nullptr;
   /// Entries in the coupling matrix for field variables for nonlocal calculations
   std::vector<std::pair<MooseVariableFieldBase *, MooseVariableFieldBase *>> _cm_nonlocal_entry;
   /// Flag that indicates if the jacobian block was used
@@ -2414,6 +2533,23 @@ protected:
   /// coupling for the variable.
   std::vector<bool> _component_block_diagonal;
 
+  /// The block size of the Jacobian for blocked insertion, 1 when inserting pair by pair
+  unsigned int _jacobian_block_size = 1;
+
+  /// The element Jacobian interleaved by block, for the blocked insertion
+  BlockedElementMatrix _blocked_ke;
+
+  /// The dof indices of each variable of the element, for the blocked insertion
+  std::vector<std::vector<dof_id_type>> _blocked_dof_indices;
+
+  /// The storage of a local Jacobian (row-major) as an Eigen matrix, for block updates
+  static Eigen::Map<Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
+  localJacobianMap(DenseMatrix<Number> & ke)
+  {
+    return Eigen::Map<Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(
+        ke.get_values().data(), ke.m(), ke.n());
+  }
+
   /// Temporary work vector to keep from reallocating it
   std::vector<dof_id_type> _temp_dof_indices;
 
@@ -2683,3 +2819,33 @@ Assembly::processDerivatives(const std::vector<ADReal> & residuals,
   local_functor(residuals, input_row_indices, matrix_tags);
 #endif
 }
+
+inline void
+Assembly::addCachedJacobianToSlots(const CSRSlotMap & slots,
+                                   LockFreeCSRValues & values,
+                                   TagID tag)
+{
+  auto & cached_values = _cached_jacobian_values[tag];
+  auto & cached_rows = _cached_jacobian_rows[tag];
+  auto & cached_cols = _cached_jacobian_cols[tag];
+
+  // Compact the entries we can not place in front of the cache while adding the others
+  std::size_t n_remaining = 0;
+  for (const auto i : index_range(cached_values))
+  {
+    const auto slot = slots.slot(cached_rows[i], cached_cols[i]);
+    if (slot != CSRSlotMap::invalid_slot)
+      values.add(slot, cached_values[i]);
+    else
+    {
+      cached_values[n_remaining] = cached_values[i];
+      cached_rows[n_remaining] = cached_rows[i];
+      cached_cols[n_remaining] = cached_cols[i];
+      ++n_remaining;
+    }
+  }
+
+  cached_values.resize(n_remaining);
+  cached_rows.resize(n_remaining);
+  cached_cols.resize(n_remaining);
+}
@@ -12,11 +12,14 @@
 #include <set>
 #include <vector>
 #include <ctime>
+#include <memory>
+#include <unordered_map>
 
 // MOOSE includes
 #include "MooseObject.h"
 #include "MooseTypes.h"
 #include "FileLineInfo.h"
+#include "PerfGraphInterface.h"
 
 // Forward declarations
 class InputParameters;
@@ -148,7 +151,7 @@ buildObject(const InputParameters & parameters)
 /**
  * Generic factory class for build all sorts of objects
  */
-class Factory
+class Factory : public PerfGraphInterface
 {
 public:
   Factory(MooseApp & app);
@@ -271,6 +274,16 @@ public:
   InputParameters getValidParams(const std::string & name);
   InputParameters getADValidParams(const std::string & name);
 
+  /**
+   * Keep the result of the validParams() function of each type after its first call, and return
+   * copies of it from getValidParams(). Inputs with thousands of objects of a few types then pay
+   * for building the parameters once per type instead of once per object.
+   *
+   * This requires the validParams() functions to only depend on the type, which is the case once
+   * all objects and execute on flags are registered; it is turned on by MooseApp before parsing.
+   */
+  void cacheValidParams(bool cache);
+
   /**
    * Build an object (must be registered) - THIS METHOD IS DEPRECATED (Use create<T>())
    * @param obj_name Type of the object being constructed
@@ -326,15 +339,33 @@ public:
    */
   void restrictRegisterableObjects(const std::vector<std::string> & names);
 
+  /**
+   * Defers the registration of the Registry objects with one of the given labels (see
+   * Registry::registerObjectsTo()) to their first use: getValidParams() and create() register an
+   * unknown type from its registry entry when its label is one of these. A combined app then only
+   * copies the entries of the objects an input actually uses.
+   *
+   * Iterating over the registered objects (e.g. for --json and --yaml) registers all of them.
+   */
+  void registerLazily(const std::set<std::string> & labels);
+
   /**
    * Access to registered object iterator (begin)
    */
-  registeredMooseObjectIterator registeredObjectsBegin() { return _name_to_params_pointer.begin(); }
+  registeredMooseObjectIterator registeredObjectsBegin()
+  {
+    registerAllLazyObjects();
+    return _name_to_params_pointer.begin();
+  }
 
   /**
    * Access to registered object iterator (end)
    */
-  registeredMooseObjectIterator registeredObjectsEnd() { return _name_to_params_pointer.end(); }
+  registeredMooseObjectIterator registeredObjectsEnd()
+  {
+    registerAllLazyObjects();
+    return _name_to_params_pointer.end();
+  }
 
   /**
    * Get a list of all constructed Moose Object types
@@ -368,6 +399,15 @@ protected:
    */
   void reportUnregisteredError(const std::string & obj_name) const;
 
+  /**
+   * Registers the object from its Registry entry if its label is registered lazily
+   * @return Whether the object is now registered
+   */
+  bool registerLazyObject(const std::string & obj_name);
+
+  /// Registers all the remaining objects of the lazily registered labels
+  void registerAllLazyObjects();
+
   /// Reference to the application
   MooseApp & _app;
 
@@ -391,12 +431,25 @@ protected:
   /// The list of objects that may be registered
   std::set<std::string> _registerable_objects;
 
+  /// The Registry labels whose objects are registered on first use, see registerLazily()
+  std::set<std::string> _lazy_labels;
+
   /// Object id count
   MooseObjectID _object_count;
 
   /// Constructed Moose Object types
   std::set<std::string> _constructed_types;
 
+  /// Whether getValidParams() uses and fills _valid_params_cache
+  bool _cache_valid_params;
+
+  /// The parameters returned by the validParams() function of each type, see cacheValidParams()
+  std::unordered_map<std::string, std::unique_ptr<InputParameters>> _valid_params_cache;
+
+  /// Timers
+  PerfID _create_timer;
+  PerfID _valid_params_timer;
+
   /// set<label/appname, objectname> used to track if an object previously added is being added
   /// again - which is okay/allowed, while still allowing us to detect/reject cases of duplicate
   /// object name registration where the label/appname is not identical.
@@ -38,6 +38,9 @@ class MooseApp;
 class Backup;
 class FEProblemBase;
 class MeshGenerator;
+class MeshGeneratorCache;
+class InMemoryBackup;
+class MeshGeneratorHash;
 class InputParameterWarehouse;
 class SystemInfo;
 class CommandLine;
@@ -580,6 +583,31 @@ public:
    */
   virtual void restore(std::shared_ptr<Backup> backup, bool for_restart = false);
 
+  /**
+   * Snapshot the state of the App in memory (see InMemoryBackup): the vectors of the systems and
+   * the stateful material properties are copied directly instead of being serialized. The first
+   * call registers the state; later calls reuse the snapshot storage.
+   *
+   * The snapshot references the objects of the App, so it is dropped by invalidateInMemoryBackup()
+   * (and must be replaced by a Backup) whenever the mesh changes.
+   */
+  void backupInMemory();
+
+  /**
+   * Set the state of the App back to the last backupInMemory()
+   */
+  void restoreInMemory();
+
+  /**
+   * Whether a snapshot from backupInMemory() can be restored
+   */
+  bool hasInMemoryBackup() const;
+
+  /**
+   * Drop the snapshot from backupInMemory(), e.g. after a mesh change
+   */
+  void invalidateInMemoryBackup();
+
   /**
    * Returns a string to be printed at the beginning of a simulation
    */
@@ -672,6 +700,12 @@ public:
    */
   std::unique_ptr<MeshBase> getMeshGeneratorMesh(bool check_unique = true);
 
+  /**
+   * The hash of the mesh generated by the named generator: its own inputs combined with the
+   * hashes of all the generators it depends on (see MeshGenerator::hashInputs)
+   */
+  MeshGeneratorHash hashMeshGenerator(const std::string & name) const;
+
   ///@{
   /**
    * Sets the restart/recover flags
@@ -1088,6 +1122,12 @@ private:
   /// Whether the app is executing all mesh generators
   bool _executing_mesh_generators;
 
+  /// The cache of generated meshes (--mesh-generator-cache <dir>), null when caching is off
+  std::unique_ptr<MeshGeneratorCache> _mesh_generator_cache;
+
+  /// The in-memory snapshot of the App, see backupInMemory()
+  std::unique_ptr<InMemoryBackup> _in_memory_backup;
+
   /// Whether the mesh generator MeshBase has been popped off its storage container and is no
   /// longer accessible
   bool _popped_final_mesh_generator;
@@ -21,9 +21,18 @@
 /* Whether to use a global indexing scheme for AD */
 /* #undef GLOBAL_AD_INDEXING */
 
+/* Whether or not the Catalyst in-situ adaptor is built */
+/* #undef HAVE_CATALYST */
+
+/* Whether or not the parallel HDF5 output is built */
+/* #undef HAVE_HDF5 */
+
 /* Whether or not libpng was detected on the system */
 /* #undef HAVE_LIBPNG */
 
+/* Whether or not hardware counters are read with perf_event */
+/* #undef HAVE_PERF_EVENT */
+
 /* Define to the address where bug reports for this package should be sent. */
 #ifndef MOOSE_PACKAGE_BUGREPORT
 #define MOOSE_PACKAGE_BUGREPORT "moose-users@googlegroups.com"
@@ -106,6 +106,7 @@ operator<<(std::ostream & os, const std::tuple<T...> & tup)
         throw std::runtime_error(_assert_oss_.str());                                              \
       else                                                                                         \
       {                                                                                            \
+        moose::internal::syncConsole();                                                            \
         Moose::err << _assert_oss_.str() << std::flush;                                            \
         if (libMesh::global_n_processors() == 1)                                                   \
           print_trace();                                                                           \
@@ -142,6 +143,29 @@ mooseMsgFmt(const std::string & msg, const std::string & title, const std::strin
 
 [[noreturn]] void mooseErrorRaw(std::string msg, const std::string prefix = "");
 
+/// A function writing out the console output that is still buffered, see consoleSyncHook()
+typedef void (*ConsoleSyncHook)();
+
+/**
+ * The function called before the errors, warnings and other messages below are written, which
+ * bypass the Console: set by BufferedConsoleWriter so that the output it still holds is written
+ * first, in order, and is not lost when the run aborts (null when nothing is buffered)
+ */
+inline ConsoleSyncHook &
+consoleSyncHook()
+{
+  static ConsoleSyncHook hook = nullptr;
+  return hook;
+}
+
+/// Writes out the buffered console output, if any, see consoleSyncHook()
+inline void
+syncConsole()
+{
+  if (const auto hook = consoleSyncHook())
+    hook();
+}
+
 /**
  * All of the following are not meant to be called directly - they are called by the normal macros
  * (mooseError(), etc.) down below
@@ -170,6 +194,7 @@ mooseWarningStream(S & oss, Args &&... args)
   if (Moose::_throw_on_error)
     throw std::runtime_error(msg);
 
+  syncConsole();
   oss << msg << std::flush;
 }
 
@@ -183,6 +208,7 @@ mooseUnusedStream(S & oss, Args &&... args)
   if (Moose::_throw_on_error)
     throw std::runtime_error(msg);
 
+  syncConsole();
   oss << msg << std::flush;
 }
 
@@ -194,6 +220,7 @@ mooseInfoStream(S & oss, Args &&... args)
     std::ostringstream ss;
     mooseStreamAll(ss, args...);
     std::string msg = mooseMsgFmt(ss.str(), "*** Info ***", COLOR_CYAN);
+    syncConsole();
     oss << msg << std::flush;
   });
 }
@@ -210,6 +237,7 @@ mooseDeprecatedStream(S & oss, bool expired, Args &&... args)
                   ss.str(),
                   "*** Warning, This code is deprecated and will be removed in future versions:",
                   expired ? COLOR_RED : COLOR_YELLOW);
+              syncConsole();
               oss << msg;
               ss.str("");
               if (Moose::show_trace) {
@@ -237,6 +265,7 @@ mooseError(Args &&... args)
 {
   std::ostringstream oss;
   moose::internal::mooseStreamAll(oss, std::forward<Args>(args)...);
+  moose::internal::syncConsole();
   moose::internal::mooseErrorRaw(oss.str());
 }
 
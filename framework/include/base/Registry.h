@@ -246,6 +246,9 @@ public:
   static const std::map<std::string, std::vector<RegistryEntry>> & allActions();
 
   static RegistryEntry & objData(const std::string & name);
+  /// Returns the entry of the object registered under name, nullptr if there is none. Unlike
+  /// objData(), this is meant for lookups that may fail (see Factory::registerLazily()).
+  static const RegistryEntry * findObj(const std::string & name);
   static bool isRegisteredObj(const std::string & name);
 
 private:
@@ -20,6 +20,10 @@ public:
   Moose::LineSearchType _line_search;
   Moose::MffdType _mffd_type;
 
+  /// Whether Jacobian-free Newton-Krylov solves apply the Jacobian with AD instead of
+  /// finite differencing the residual (see ADJacobianVectorProduct)
+  bool _ad_jacobian_vector_product;
+
   // solver parameters for eigenvalue problems
   Moose::EigenSolveType _eigen_solve_type;
   Moose::EigenProblemType _eigen_problem_type;
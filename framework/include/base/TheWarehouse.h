@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
@@ -194,7 +195,9 @@ public:
       // initialize parametrized attributes and tuple:
       addAttribs<0, Attribs...>();
       _key_tup = other._key_tup;
-      // do NOT copy the cache.
+      // do NOT copy the cache, and drop ours: it was built for the attributes replaced above.
+      _cache.clear();
+      _last_valid = false;
 
       // only copy over non-parametrized attributes
       for (size_t i = std::tuple_size<AttribTuple>::value; i < other._attribs.size(); i++)
@@ -208,6 +211,8 @@ public:
     {
       _attribs.clear();
       _w = &q.warehouse();
+      _cache.clear();
+      _last_valid = false;
 
       addAttribs<0, Attribs...>();
       _attribs.reserve(5);
@@ -237,6 +242,7 @@ public:
     {
       _attribs.emplace_back(new T(*_w, std::forward<Args>(args)...));
       _cache.clear(); // invalidate cache if base query changes.
+      _last_valid = false;
       return *this;
     }
 
@@ -263,18 +269,25 @@ public:
       std::lock_guard<std::mutex> lock(_cache_mutex);
       setKeysInner<0, KeyType<Attribs>...>(args...);
 
-      size_t query_id;
-      const auto entry = _cache.find(_key_tup);
-      if (entry == _cache.end())
+      // Loops query with the same keys for long stretches (e.g. one subdomain), check the last
+      // key before hashing
+      if (!_last_valid || !(_last_key == _key_tup))
       {
-        setAttribsInner<0, KeyType<Attribs>...>(args...);
-        query_id = _w->queryID(_attribs);
-        _cache[_key_tup] = query_id;
+        const auto entry = _cache.find(_key_tup);
+        if (entry == _cache.end())
+        {
+          setAttribsInner<0, KeyType<Attribs>...>(args...);
+          _last_query_id = _w->queryID(_attribs);
+          _cache.emplace(_key_tup, _last_query_id);
+          _w->countQueryCacheMiss();
+        }
+        else
+          _last_query_id = entry->second;
+        _last_key = _key_tup;
+        _last_valid = true;
       }
-      else
-        query_id = entry->second;
 
-      return _w->queryInto(query_id, results);
+      return _w->queryInto(_last_query_id, results);
     }
 
   private:
@@ -317,8 +330,14 @@ public:
 
     KeyTuple _key_tup;
     AttribTuple _attrib_tup;
-    std::map<KeyTuple, size_t> _cache;
+    std::unordered_map<KeyTuple, size_t> _cache;
     std::mutex _cache_mutex;
+
+    ///@{ The keys and query id of the last queryInto()
+    KeyTuple _last_key;
+    size_t _last_query_id = 0;
+    bool _last_valid = false;
+    ///@}
   };
 
   using Query = QueryCache<>;
@@ -397,6 +416,15 @@ public:
 
   size_t queryID(const std::vector<std::unique_ptr<Attribute>> & conds);
 
+  /// The number of queries the QueryCache objects of this warehouse could not find in their
+  /// cache, i.e. that had to be looked up (and possibly run) by queryID().  In a converged setup
+  /// this stops growing after the first residual evaluation; if it does not, a loop is rebuilding
+  /// its query objects.
+  unsigned long numQueryCacheMisses() const { return _query_cache_misses; }
+
+  /// Records a miss of a QueryCache, see numQueryCacheMisses()
+  void countQueryCacheMiss() { ++_query_cache_misses; }
+
   template <typename T>
   std::vector<T *> & queryInto(int query_id, std::vector<T *> & results, bool show_all = false)
   {
@@ -443,4 +471,7 @@ private:
   std::mutex _obj_mutex;
   std::mutex _query_cache_mutex;
   std::mutex _obj_cache_mutex;
+
+  /// The misses of the QueryCache objects, counted from any thread
+  std::atomic<unsigned long> _query_cache_misses{0};
 };
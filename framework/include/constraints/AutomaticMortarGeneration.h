@@ -23,6 +23,7 @@
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 // Forward declarations
 namespace libMesh
@@ -143,10 +144,91 @@ public:
   void buildMortarSegmentMesh();
 
   /**
-   * Clears the mortar segment mesh and accompanying data structures
+   * Clears the mortar segment mesh and accompanying data structures, including the recorded
+   * pairing (see recordPairing()), so that the next update rebuilds the whole segment mesh
    */
   void clear();
 
+  /**
+   * Updates the mortar segment mesh after the displaced mesh moved, once the secondary and primary
+   * node projections have been recomputed. With small sliding the projections mostly pair the
+   * same secondary and primary elements as when the segments were built: the segments of those
+   * secondary elements are kept and only re-projected (their xi values and nodes move), and only
+   * the segments of the secondary elements whose pairing changed (see changedSecondaryElems())
+   * are rebuilt. When there is no recorded pairing (the first build, or after clear(), which mesh
+   * changes call), or when most of the pairing changed, this calls buildMortarSegmentMesh().
+   *
+   * @return Whether the update was incremental
+   */
+  bool updateMortarSegmentMesh();
+
+  /**
+   * Enables the incremental updates of updateMortarSegmentMesh(); otherwise it always rebuilds
+   * the whole mortar segment mesh
+   */
+  void setIncrementalUpdate(bool incremental) { _incremental_update = incremental; }
+
+  /**
+   * Records the secondary/primary pairing of the current projections, the reference of
+   * changedSecondaryElems(). Called whenever the segments are (re)built.
+   */
+  void recordPairing()
+  {
+    _recorded_secondary_pairing.clear();
+    for (const auto & entry : secondary_node_and_elem_to_xi2_primary_elem)
+      _recorded_secondary_pairing.emplace(entry.first, entry.second.second);
+
+    _recorded_primary_pairing.clear();
+    for (const auto & entry : primary_node_and_elem_to_xi1_secondary_elem)
+      _recorded_primary_pairing.emplace(entry.first, entry.second.second);
+  }
+
+  /// Whether a pairing was recorded since the last clear()
+  bool hasRecordedPairing() const
+  {
+    return !_recorded_secondary_pairing.empty() || !_recorded_primary_pairing.empty();
+  }
+
+  /**
+   * The secondary elements whose segments no longer match the current projections: a node of the
+   * element projects onto another primary element (or onto none) than when the pairing was
+   * recorded, or a primary node started or stopped projecting into the element
+   */
+  std::unordered_set<const Elem *> changedSecondaryElems() const
+  {
+    std::unordered_set<const Elem *> changed;
+
+    for (const auto & entry : secondary_node_and_elem_to_xi2_primary_elem)
+    {
+      const auto recorded = _recorded_secondary_pairing.find(entry.first);
+      if (recorded == _recorded_secondary_pairing.end() || recorded->second != entry.second.second)
+        changed.insert(entry.first.second);
+    }
+    for (const auto & entry : _recorded_secondary_pairing)
+      if (!secondary_node_and_elem_to_xi2_primary_elem.count(entry.first))
+        changed.insert(entry.first.second);
+
+    for (const auto & entry : primary_node_and_elem_to_xi1_secondary_elem)
+    {
+      const Elem * const secondary_elem = entry.second.second;
+      const auto recorded = _recorded_primary_pairing.find(entry.first);
+      const Elem * const recorded_elem =
+          recorded == _recorded_primary_pairing.end() ? nullptr : recorded->second;
+      if (recorded_elem != secondary_elem)
+      {
+        if (secondary_elem)
+          changed.insert(secondary_elem);
+        if (recorded_elem)
+          changed.insert(recorded_elem);
+      }
+    }
+    for (const auto & entry : _recorded_primary_pairing)
+      if (entry.second && !primary_node_and_elem_to_xi1_secondary_elem.count(entry.first))
+        changed.insert(entry.second);
+
+    return changed;
+  }
+
   /**
    * returns whether this object is on the displaced mesh
    */
@@ -268,4 +350,26 @@ private:
 
   /// Whether the mortar segment mesh is distributed
   const bool _distributed;
+
+  /// Whether updateMortarSegmentMesh() may update the segments incrementally
+  bool _incremental_update = false;
+
+  ///@{ The pairing of the projections when the segments were last built, see recordPairing()
+  std::unordered_map<std::pair<const Node *, const Elem *>, const Elem *>
+      _recorded_secondary_pairing;
+  std::unordered_map<std::tuple<dof_id_type, const Node *, const Elem *>, const Elem *>
+      _recorded_primary_pairing;
+  ///@}
+
+  /**
+   * Removes the segments of a secondary element from the mortar segment mesh and msm_elem_to_info
+   * and builds them again from the current projections
+   */
+  void rebuildSegments(const Elem * secondary_elem);
+
+  /**
+   * Moves the segments of a secondary element to the current projections: the xi values of their
+   * MortarSegmentInfo and the positions of their nodes
+   */
+  void reprojectSegments(const Elem * secondary_elem);
 };
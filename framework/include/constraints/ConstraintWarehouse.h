@@ -31,7 +31,8 @@ public:
   /**
    * Add Constraint object to the warehouse.
    * @param object A std::shared_ptr of the object
-   * @param tid Not used.
+   * @param tid The thread, only used for the mortar constraints (created for every thread for the
+   *            threaded mortar segment loop); the other constraints only exist on thread 0.
    */
   void
   addObject(std::shared_ptr<Constraint> object, THREAD_ID tid = 0, bool recurse = true) override;
@@ -43,7 +44,8 @@ public:
   const std::vector<std::shared_ptr<NodalConstraint>> & getActiveNodalConstraints() const;
   const std::vector<std::shared_ptr<MortarConstraintBase>> &
   getActiveMortarConstraints(const std::pair<BoundaryID, BoundaryID> & mortar_interface_key,
-                             bool displaced) const;
+                             bool displaced,
+                             THREAD_ID tid = 0) const;
   const std::vector<std::shared_ptr<ElemElemConstraint>> &
   getActiveElemElemConstraints(InterfaceID interface_id, bool displaced) const;
   const std::vector<std::shared_ptr<NodeFaceConstraint>> &
@@ -0,0 +1,155 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MortarSegmentInfo.h"
+
+#include "libmesh/elem.h"
+#include "libmesh/node.h"
+#include "libmesh/stored_range.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+typedef StoredRange<std::vector<const Elem *>::const_iterator, const Elem *> MortarSegmentRange;
+
+/**
+ * Splits the mortar segments into colors such that no two segments of a color share a dof: the
+ * nodes of their secondary and primary lower-dimensional elements and of the interior parents of
+ * those are all different, which also covers the elemental dofs of these elements.
+ *
+ * The segments of one color can then be computed concurrently, each thread with its own Assembly
+ * and constraint copies, without two threads touching the same nodal data (e.g. the weighted gaps
+ * or Lagrange multipliers of the secondary nodes). Adding to the PETSc vectors and matrices is not
+ * thread-safe in any case: the threads cache their contributions and add them under the global
+ * spin mutex. A secondary element is split into a handful of segments, which end up in as many
+ * colors; the segments with any node owned by another processor, whose entries PETSc stashes for
+ * communication, and those that would need more than MAX_COLORS colors go to remainder(), to be
+ * computed one at a time.
+ */
+class MortarSegmentColoring
+{
+public:
+  /// The largest number of colors (the number of bits of a color mask)
+  static constexpr unsigned int MAX_COLORS = 64;
+
+  /**
+   * Colors the segments greedily, in order, for processor \p pid
+   * @param segments The mortar segment elements to color
+   * @param info The segment data of each mortar segment element (see AutomaticMortarGeneration)
+   */
+  void build(const std::vector<const Elem *> & segments,
+             const std::unordered_map<const Elem *, MortarSegmentInfo> & info,
+             processor_id_type pid)
+  {
+    _colors.clear();
+    _remainder.clear();
+
+    // The colors already used by the segments adding to the dofs of each node
+    std::unordered_map<const Node *, std::uint64_t> used;
+    used.reserve(8 * segments.size());
+
+    std::vector<std::uint64_t *> touched;
+    for (const Elem * const segment : segments)
+    {
+      const auto & msinfo = info.at(segment);
+
+      // The elements the segment adds to; the nodes of a lower-dimensional element are nodes of
+      // its interior parent
+      const Elem * const elems[] = {
+          msinfo.secondary_elem && msinfo.secondary_elem->interior_parent()
+              ? msinfo.secondary_elem->interior_parent()
+              : msinfo.secondary_elem,
+          msinfo.primary_elem && msinfo.primary_elem->interior_parent()
+              ? msinfo.primary_elem->interior_parent()
+              : msinfo.primary_elem};
+
+      bool remote = false;
+      for (const Elem * const elem : elems)
+        if (elem)
+        {
+          if (elem->processor_id() != pid)
+            remote = true;
+          for (const Node & node : elem->node_ref_range())
+            if (node.processor_id() != pid)
+              remote = true;
+        }
+      if (remote)
+      {
+        _remainder.push_back(segment);
+        continue;
+      }
+
+      touched.clear();
+      std::uint64_t taken = 0;
+      for (const Elem * const elem : elems)
+        if (elem)
+          for (const Node & node : elem->node_ref_range())
+          {
+            touched.push_back(&used[&node]);
+            taken |= *touched.back();
+          }
+      if (~taken == 0)
+      {
+        _remainder.push_back(segment);
+        continue;
+      }
+
+      unsigned int color = 0;
+      while (taken & (std::uint64_t(1) << color))
+        ++color;
+
+      for (std::uint64_t * const elem_used : touched)
+        *elem_used |= std::uint64_t(1) << color;
+
+      if (color >= _colors.size())
+        _colors.resize(color + 1);
+      _colors[color].push_back(segment);
+    }
+
+    buildRanges();
+  }
+
+  /// The number of colors
+  unsigned int numColors() const { return _colors.size(); }
+
+  /// The segments of each color
+  const std::vector<const Elem *> & color(unsigned int c) const { return _colors[c]; }
+
+  /// The ranges of the segments of each color, to be computed concurrently
+  const std::vector<std::unique_ptr<MortarSegmentRange>> & colorRanges() const
+  {
+    return _color_ranges;
+  }
+
+  /// The segments that were not colored, to be computed one at a time
+  const std::vector<const Elem *> & remainder() const { return _remainder; }
+
+  /// The range of the segments that were not colored
+  const MortarSegmentRange & remainderRange() const { return *_remainder_range; }
+
+private:
+  void buildRanges()
+  {
+    _color_ranges.clear();
+    for (const auto & segments : _colors)
+      _color_ranges.push_back(
+          libmesh_make_unique<MortarSegmentRange>(segments.begin(), segments.end()));
+    _remainder_range =
+        libmesh_make_unique<MortarSegmentRange>(_remainder.begin(), _remainder.end());
+  }
+
+  std::vector<std::vector<const Elem *>> _colors;
+  std::vector<const Elem *> _remainder;
+  std::vector<std::unique_ptr<MortarSegmentRange>> _color_ranges;
+  std::unique_ptr<MortarSegmentRange> _remainder_range;
+};
@@ -109,6 +109,14 @@ public:
 
   Real secondaryResidual() const;
 
+  /**
+   * Sets the primary quadrature point of the current secondary node. When the secondary nodes in
+   * contact with a primary face are evaluated together (see PrimaryFaceGroups), the primary face
+   * is reinitialized once at the contact points of all of them and node i of the face is
+   * evaluated at primary point i; otherwise it is always 0.
+   */
+  void setPrimaryQp(unsigned int qp) { _primary_qp = qp; }
+
   void residualSetup() override;
 
 protected:
@@ -264,7 +272,7 @@ protected:
   /// DOF map
   const DofMap & _dof_map;
 
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const CompressedAdjacency<dof_id_type> & _node_to_elem_map;
 
   /**
    * Whether or not the secondary's residual should be overwritten.
@@ -277,6 +285,9 @@ protected:
   /// JxW on the primary face
   const MooseArray<Real> & _primary_JxW;
 
+  /// The primary quadrature point of the current secondary node, see setPrimaryQp()
+  unsigned int _primary_qp = 0;
+
   /// Whether the secondary residual has been computed
   bool _secondary_residual_computed;
 
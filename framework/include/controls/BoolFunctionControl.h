@@ -27,9 +27,13 @@ public:
 
   BoolFunctionControl(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
   virtual void execute() override;
 
 protected:
   /// The function to determine the value of the controlled parameter
   const Function & _function;
+
+  /// The controlled parameter, resolved in initialSetup()
+  ControllableHandle<bool> _parameter;
 };
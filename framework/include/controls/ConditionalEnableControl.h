@@ -26,6 +26,7 @@ public:
 
   ConditionalEnableControl(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
   virtual void execute() override;
 
 protected:
@@ -45,4 +46,11 @@ protected:
 
   /// When true, the disable/enable lists are set to opposite values when the specified condition is false
   const bool & _reverse_on_false;
+
+  ///@{
+  /// The "enable" parameters of the objects of the enable and disable lists, resolved in
+  /// initialSetup()
+  std::vector<ControllableHandle<bool>> _enable_handles;
+  std::vector<ControllableHandle<bool>> _disable_handles;
+  ///@}
 };
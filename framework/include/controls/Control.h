@@ -12,6 +12,7 @@
 // MOOSE includes
 #include "MooseObject.h"
 #include "ControllableParameter.h"
+#include "ControllableHandle.h"
 #include "TransientInterface.h"
 #include "SetupInterface.h"
 #include "FunctionInterface.h"
@@ -93,6 +94,24 @@ protected:
   ControllableParameter getControllableParameterByName(const MooseObjectParameterName & param_name);
   ///@}
 
+  ///@{
+  /**
+   * Resolve a controllable parameter, given input file syntax or actual name, into a typed handle.
+   * Controls setting the same parameter at every execution resolve it once (in initialSetup(),
+   * when all the controllable parameters exist) and set it through the handle, which neither
+   * searches the InputParameterWarehouse nor checks the parameter type again.
+   */
+  template <typename T>
+  ControllableHandle<T> getControllableHandle(const std::string & param_name);
+
+  template <typename T>
+  ControllableHandle<T> getControllableHandleByName(const std::string & name);
+
+  template <typename T>
+  ControllableHandle<T> getControllableHandleByName(const std::string & object_name,
+                                                    const std::string & param_name);
+  ///@}
+
   ///@{
   /**
    * Obtain the value of a controllable parameter given input file syntax or actual name.
@@ -228,6 +247,29 @@ Control::getControllableValueByName(const MooseObjectParameterName & desired,
   return helper.get<T>(true, warn_when_values_differ)[0];
 }
 
+template <typename T>
+ControllableHandle<T>
+Control::getControllableHandle(const std::string & param_name)
+{
+  return ControllableHandle<T>(getControllableParameter(param_name));
+}
+
+template <typename T>
+ControllableHandle<T>
+Control::getControllableHandleByName(const std::string & name)
+{
+  return ControllableHandle<T>(getControllableParameterByName(name));
+}
+
+template <typename T>
+ControllableHandle<T>
+Control::getControllableHandleByName(const std::string & object_name,
+                                     const std::string & param_name)
+{
+  return ControllableHandle<T>(
+      getControllableParameterByName(MooseObjectName(object_name), param_name));
+}
+
 template <typename T>
 void
 Control::setControllableValueByName(const MooseObjectParameterName & desired, const T & value)
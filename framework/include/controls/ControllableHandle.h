@@ -0,0 +1,108 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// MOOSE includes
+#include "ControllableParameter.h"
+
+/**
+ * A controllable parameter resolved once into the typed values it controls, for the Control
+ * objects that set the same parameter at every execution (see Control::getControllableHandle).
+ *
+ * Setting a value through the handle neither searches the InputParameterWarehouse for the
+ * parameter nor checks the type of the values again; the ControllableItem objects it refers to are
+ * owned by the warehouse and live as long as the problem.
+ */
+template <typename T>
+class ControllableHandle
+{
+public:
+  ControllableHandle() = default;
+
+  /**
+   * Resolves the values of the items of a ControllableParameter, which must all be of type T
+   */
+  ControllableHandle(const ControllableParameter & parameter);
+
+  /**
+   * Return true if the handle controls no parameter.
+   */
+  bool empty() const { return _values.empty(); }
+
+  /**
+   * Set the value of all the controlled parameters.
+   */
+  void set(const T & value);
+
+  /**
+   * Return the value of the first controlled parameter.
+   */
+  const T & get() const;
+
+  /**
+   * Check the execute flags, as ControllableParameter::checkExecuteOnType.
+   */
+  void checkExecuteOnType(const ExecFlagType & current) const;
+
+private:
+  /// The controlled items, for the execute flags and ControlOutput
+  std::vector<ControllableItem *> _items;
+
+  /// The values of the items
+  std::vector<libMesh::Parameters::Parameter<T> *> _values;
+};
+
+template <typename T>
+ControllableHandle<T>::ControllableHandle(const ControllableParameter & parameter)
+  : _items(parameter.items())
+{
+  for (ControllableItem * item : _items)
+  {
+    const auto values = item->typedValues<T>();
+    _values.insert(_values.end(), values.begin(), values.end());
+  }
+}
+
+template <typename T>
+void
+ControllableHandle<T>::set(const T & value)
+{
+  for (auto param : _values)
+    param->set() = value;
+  for (ControllableItem * item : _items)
+    item->setChanged();
+}
+
+template <typename T>
+const T &
+ControllableHandle<T>::get() const
+{
+  mooseAssert(!_values.empty(), "The ControllableHandle controls no parameter");
+  return _values[0]->get();
+}
+
+template <typename T>
+void
+ControllableHandle<T>::checkExecuteOnType(const ExecFlagType & current) const
+{
+  for (const ControllableItem * const item : _items)
+  {
+    const std::set<ExecFlagType> & flags = item->getExecuteOnFlags();
+    if (!flags.empty() && flags.find(current) == flags.end())
+    {
+      std::ostringstream oss;
+      oss << "The controllable parameter (" << item->name()
+          << ") is not allowed to be controlled on '" << current << "', it is restricted to:";
+      for (const auto & flag : flags)
+        oss << " " << flag;
+      mooseError(oss.str());
+    }
+  }
+}
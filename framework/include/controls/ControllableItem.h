@@ -63,6 +63,13 @@ public:
   template <typename T>
   std::vector<T> get(bool type_check = true) const;
 
+  /**
+   * Return the values of all the parameters of this "item", which must be of the given type, to
+   * be set directly (see ControllableHandle).
+   */
+  template <typename T>
+  std::vector<libMesh::Parameters::Parameter<T> *> typedValues() const;
+
   /**
    * Return true if the template argument is valid for ALL items.
    */
@@ -100,6 +107,7 @@ public:
    */
   void resetChanged() { _changed = false; }
   bool isChanged() { return _changed; }
+  void setChanged() { _changed = true; }
   ///@}
 
   /**
@@ -170,6 +178,27 @@ ControllableItem::get(bool type_check /*=true*/) const
   return output;
 }
 
+template <typename T>
+std::vector<libMesh::Parameters::Parameter<T> *>
+ControllableItem::typedValues() const
+{
+  std::vector<libMesh::Parameters::Parameter<T> *> output;
+  output.reserve(_pairs.size());
+  for (const auto & pair : _pairs)
+  {
+    libMesh::Parameters::Parameter<T> * param =
+        dynamic_cast<libMesh::Parameters::Parameter<T> *>(pair.second);
+    if (param == nullptr)
+      mooseError("Failed to resolve the '",
+                 pair.first,
+                 "' parameter the supplied template argument must be of type '",
+                 pair.second->type(),
+                 "'.");
+    output.push_back(param);
+  }
+  return output;
+}
+
 template <typename T>
 bool
 ControllableItem::check() const
@@ -75,6 +75,11 @@ public:
    */
   void add(ControllableItem * item);
 
+  /**
+   * Return the items, e.g. to resolve them into a ControllableHandle.
+   */
+  const std::vector<ControllableItem *> & items() const { return _items; }
+
   /// Allows this to be used with std:: cout
   friend std::ostream & operator<<(std::ostream & stream, const ControllableParameter & obj);
 
@@ -33,9 +33,13 @@ public:
 
   RealFunctionControl(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
   virtual void execute() override;
 
 private:
   /// The function to execute
   const Function & _function;
+
+  /// The controlled parameter, resolved in initialSetup()
+  ControllableHandle<Real> _parameter;
 };
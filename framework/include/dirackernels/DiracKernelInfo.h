@@ -10,10 +10,15 @@
 #pragma once
 
 #include "Moose.h"
+#include "PointLocationCache.h"
+
+#include "libmesh/threads.h"
 
 #include <set>
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 // Forward declarations
 class MooseMesh;
@@ -76,10 +81,25 @@ public:
 
   /**
    * Used by client DiracKernel classes to determine the Elem in which
-   * the Point p resides.  Uses the PointLocator owned by this object.
+   * the Point p resides.  Uses the PointLocator owned by this object, only
+   * the first time a point is seen: the elements of the points are kept
+   * until the mesh changes (see updatePointLocator()), so sources that don't
+   * move are not located again at every time step.
    */
   const Elem * findPoint(Point p, const MooseMesh & mesh);
 
+  /**
+   * The reference coordinates of the Dirac points of an element, as computed by
+   * inverse_map(elem, points), which is only called when the element's points
+   * differ from the ones of the previous call: the points of the sources that
+   * don't move are mapped once instead of at every evaluation.  Safe to call
+   * from the threads, each of them handling different elements.
+   */
+  template <typename InverseMap>
+  const std::vector<Point> & referencePoints(const Elem * elem,
+                                             const std::vector<Point> & points,
+                                             const InverseMap & inverse_map);
+
 protected:
   /**
    * Check if two points are equal with respect to a tolerance
@@ -100,5 +120,37 @@ protected:
 
   /// threshold distance squared below which two points are considered identical
   const Real _point_equal_distance_sq;
+
+  /// The elements of the points located by findPoint(), cleared when the mesh changes
+  PointLocationCache _point_locations;
+
+  /// The physical and reference Dirac points of each element, see referencePoints(), cleared
+  /// when the mesh changes
+  std::unordered_map<const Elem *, std::pair<std::vector<Point>, std::vector<Point>>>
+      _reference_points;
+
+  /// Protects _reference_points
+  Threads::spin_mutex _reference_points_mutex;
 };
 
+template <typename InverseMap>
+const std::vector<Point> &
+DiracKernelInfo::referencePoints(const Elem * elem,
+                                 const std::vector<Point> & points,
+                                 const InverseMap & inverse_map)
+{
+  std::pair<std::vector<Point>, std::vector<Point>> * entry;
+  {
+    Threads::spin_mutex::scoped_lock lock(_reference_points_mutex);
+    entry = &_reference_points[elem];
+  }
+
+  // Each element is handled by a single thread, and the entries are not moved by insertions
+  if (entry->first != points || entry->second.size() != points.size())
+  {
+    entry->first = points;
+    entry->second = inverse_map(elem, points);
+  }
+  return entry->second;
+}
+
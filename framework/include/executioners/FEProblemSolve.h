@@ -40,6 +40,19 @@ protected:
   /// Splitting
   std::vector<std::string> _splitting;
 
+  /**
+   * Whether the Jacobian of a previous solve is reused while the iteration counts do not grow
+   * past the thresholds (see JacobianReusePolicy)
+   */
+  const bool _jacobian_reuse;
+
+  /**
+   * Whether the preconditioner of a previous solve (e.g. of a previous Picard iteration or sample)
+   * is kept while the linear iteration count does not grow past the threshold (see
+   * PreconditionerReusePolicy)
+   */
+  const bool _preconditioner_reuse;
+
   /// Moose provided line searches
   static std::set<std::string> const _moose_line_searches;
 };
@@ -0,0 +1,135 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Transient.h"
+
+#include "libmesh/numeric_vector.h"
+
+// Forward Declarations
+class Parareal;
+class TransientMultiApp;
+
+template <>
+InputParameters validParams<Parareal>();
+
+/**
+ * Parallel-in-time executioner using the Parareal algorithm.
+ *
+ * The time interval is split into slices [T_n, T_n+1]. This executioner is the coarse propagator
+ * G: it integrates the problem serially with its own (large) time steps and time integrator. The
+ * fine propagator F is a TransientMultiApp with one sub-app per slice, running the same problem
+ * with small time steps; the sub-apps are spread over the processors like any other MultiApp, so
+ * the slices are integrated concurrently. Each iteration k
+ *
+ *   1. runs every fine slice from the current state U_n^k at T_n to T_n+1 (in parallel),
+ *   2. sweeps the coarse propagator over the slices, correcting its result:
+ *        U_n+1^k+1 = G(U_n^k+1) + F(U_n^k) - G(U_n^k)
+ *
+ * and stops when the states at the slice boundaries change by less than the tolerance. After k
+ * iterations the first k slices are exact, so it converges in at most the number of slices.
+ *
+ * The states are solution vectors of this problem: the coarse problem and the fine sub-apps must
+ * use the same mesh and variables (as for MultiAppCopyTransfer). The coarse sweep restarts from
+ * a state with the Backup/restore machinery of the app; the fine states are copied to and from
+ * the sub-app at the start and end of its slice.
+ */
+class Parareal : public Transient
+{
+public:
+  static InputParameters validParams();
+
+  Parareal(const InputParameters & parameters);
+
+  virtual void init() override;
+
+  virtual void execute() override;
+
+  virtual bool lastSolveConverged() const override { return _parareal_converged; }
+
+  /// The number of Parareal iterations of the last execute()
+  unsigned int numPararealIterations() const { return _parareal_it; }
+
+protected:
+  /**
+   * Integrates this (coarse) problem over slice n, from the given state at T_n
+   * @param n The slice
+   * @param state The state at T_n
+   * @param result The state at T_n+1
+   * @return Whether every coarse step converged
+   */
+  bool coarsePropagate(unsigned int n,
+                       const NumericVector<Number> & state,
+                       NumericVector<Number> & result);
+
+  /**
+   * Sets the initial state of the fine sub-app of each slice and runs them all concurrently
+   * @return Whether every fine sub-app converged
+   */
+  bool finePropagate();
+
+  /// Copies the state into the sub-app of slice n, as its solution at T_n
+  void transferToFine(unsigned int n, const NumericVector<Number> & state);
+
+  /// Copies the solution of the sub-app of slice n at T_n+1 into result
+  void transferFromFine(unsigned int n, NumericVector<Number> & result);
+
+  /**
+   * The Parareal correction of the state at T_n+1, in place:
+   * next = G(U_n^k+1) + F(U_n^k) - G(U_n^k)
+   *
+   * @param coarse_new The coarse propagation from the new state, G(U_n^k+1)
+   * @param fine_old The fine propagation from the previous state, F(U_n^k)
+   * @param coarse_old The coarse propagation from the previous state, G(U_n^k)
+   * @param next The corrected state
+   * @return The norm of the change of the state at T_n+1
+   */
+  static Real correct(const NumericVector<Number> & coarse_new,
+                      const NumericVector<Number> & fine_old,
+                      const NumericVector<Number> & coarse_old,
+                      NumericVector<Number> & next)
+  {
+    std::unique_ptr<NumericVector<Number>> change = next.clone();
+    next = coarse_new;
+    next += fine_old;
+    next -= coarse_old;
+    *change -= next;
+    return change->l2_norm();
+  }
+
+  /// The name of the MultiApp with the fine propagators, one sub-app per slice
+  const MultiAppName & _fine_multiapp_name;
+  /// The fine propagators
+  std::shared_ptr<TransientMultiApp> _fine_multiapp;
+
+  /// The number of time slices
+  unsigned int _num_slices;
+  /// The times of the slice boundaries, T_0 = start time to T_N = end time
+  std::vector<Real> _slice_times;
+
+  const unsigned int _max_parareal_its;
+  /// The absolute tolerance on the change of the slice boundary states
+  const Real _parareal_abs_tol;
+  /// The tolerance on the change relative to the norm of the boundary states
+  const Real _parareal_rel_tol;
+
+  /// The states at the slice boundaries, N + 1 of them
+  std::vector<std::unique_ptr<NumericVector<Number>>> _states;
+  ///@{ The coarse and fine propagations of the last iteration over each slice
+  std::vector<std::unique_ptr<NumericVector<Number>>> _coarse;
+  std::vector<std::unique_ptr<NumericVector<Number>>> _fine;
+  ///@}
+
+  unsigned int _parareal_it;
+  bool _parareal_converged;
+
+  PerfID _coarse_timer;
+  PerfID _fine_timer;
+};
@@ -10,8 +10,11 @@
 #pragma once
 
 #include "SolveObject.h"
+#include "FixedPointAccelerator.h"
+#include "MooseEnum.h"
 
 // System includes
+#include <memory>
 #include <string>
 
 class PicardSolve;
@@ -106,6 +109,27 @@ protected:
                  bool relax,
                  const std::set<dof_id_type> & relaxed_dofs);
 
+  /**
+   * Gathers the local entries of the fixed-point vector: the dofs of the transferred variables
+   * (the "relaxed_variables" and the variables declared by the transfers, see
+   * MultiAppTransfer::fixedPointVariables()) followed by the declared postprocessors, the latter
+   * on the first processor only
+   */
+  void gatherFixedPointVector(std::vector<Real> & values) const;
+
+  /// Writes the (accelerated) fixed-point vector back into the variables and postprocessors
+  void scatterFixedPointVector(const std::vector<Real> & values);
+
+  /// Fixed-point acceleration of the Picard iteration: "none" (plain iteration with the
+  /// relaxation factor), "aitken" or "anderson"
+  const MooseEnum _acceleration;
+  /// Number of past iterations combined by the Anderson acceleration
+  const unsigned int _anderson_depth;
+  /// The accelerator, null without acceleration
+  std::unique_ptr<FixedPointAccelerator> _accelerator;
+  /// The fixed-point vector at the beginning of the current Picard iteration
+  std::vector<Real> _fixed_point_input;
+
   /// Maximum Picard iterations
   unsigned int _picard_max_its;
   /// Whether or not we activate Picard iteration
@@ -20,6 +20,7 @@
 
 // libMesh
 #include "libmesh/vector_value.h"
+#include "libmesh/point.h"
 
 // Forward declarations
 class Function;
@@ -69,6 +70,22 @@ public:
    */
   virtual Real value(Real t, const Point & p) const;
 
+  /**
+   * Evaluates the scalar function at many points at once, e.g. the quadrature points of an
+   * element. By default this calls value() for each point; override it when the points can share
+   * work (a parsed expression evaluated with the time set once, a table lookup starting from the
+   * interval of the previous point, ...).
+   * \param t The time
+   * \param n The number of points
+   * \param points The points in space
+   * \param values The function evaluated at each point
+   */
+  virtual void values(Real t, std::size_t n, const Point * points, Real * values) const
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      values[i] = value(t, points[i]);
+  }
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
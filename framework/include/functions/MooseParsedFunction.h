@@ -47,6 +47,12 @@ public:
    */
   virtual Real value(Real t, const Point & pt) const override;
 
+  /**
+   * Evaluate the equation at many points, setting the time and the coupled values of the parser
+   * once for all the points
+   */
+  virtual void values(Real t, std::size_t n, const Point * points, Real * values) const override;
+
   /**
    * Evaluate the gradient of the function. This is computed in libMesh
    * through automatic symbolic differentiation.
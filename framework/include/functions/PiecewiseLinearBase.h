@@ -30,6 +30,12 @@ public:
 
   virtual void initialSetup() override;
   virtual Real value(Real t, const Point & p) const override;
+  virtual void values(Real t, std::size_t n, const Point * points, Real * values) const override
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      values[i] = _scale_factor * _linear_interp->sample(_has_axis ? points[i](_axis) : t,
+                                                         _interval_hint);
+  }
   virtual Real timeDerivative(Real t, const Point &) const override;
   virtual RealGradient gradient(Real, const Point & p) const override;
   virtual Real integral() const override;
@@ -42,4 +48,7 @@ protected:
 
   /// helper object to perform the linear interpolation of the function data
   std::unique_ptr<LinearInterpolation> _linear_interp;
+
+  /// interval of the last sample, the lookup hint of the next (functions are per thread)
+  mutable unsigned int _interval_hint = 0;
 };
@@ -33,6 +33,12 @@ public:
 
   PiecewiseMultilinear(const InputParameters & parameters);
 
+  /// Samples many points, the grid intervals of each point being the lookup hints of the next
+  virtual void values(Real t, std::size_t n, const Point * points, Real * values) const override;
+
 protected:
   virtual Real sample(const std::vector<Real> & pt) const override;
+
+  /// The interval of the last sample along each grid axis (functions are per thread)
+  mutable std::vector<unsigned int> _interval_hints;
 };
@@ -41,6 +41,12 @@ public:
    */
   virtual Real value(Real t, const Point & p) const override;
 
+  /**
+   * Extract the values at many points with a single lookup of the solution
+   * (SolutionUserObject::pointValues)
+   */
+  virtual void values(Real t, std::size_t n, const Point * points, Real * values) const override;
+
   /**
    * Extract a gradient from the solution
    * @param t Time at which to extract
@@ -0,0 +1,207 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+/**
+ * The nearest-face search of many secondary points against the faces of a primary surface, on
+ * flat arrays.
+ *
+ * The PenetrationThread runs the Newton projection of FindContactPoint on every candidate face of
+ * every secondary node to pick the one it is in contact with. Here the faces are flattened into
+ * the triangles (3D) or segments (2D) of their vertices, stored as structure-of-arrays, and each
+ * point is projected onto its candidates in closed form; the winning face is then the only one
+ * the thread projects exactly, building its PenetrationInfo as before. The search loop touches
+ * only these arrays and the candidate lists (CSR, e.g. from the BoundingVolumeHierarchy of the
+ * NearestNodeLocator), so ranges of points are independent: threads split them, and the loop
+ * body is the kernel an accelerator backend would run on the same arrays.
+ */
+class ContactSearchBatch
+{
+public:
+  /// The nearest face of a point
+  struct Result
+  {
+    /// The face, as numbered by addTriangle()/addSegment(), or invalid_uint without candidates
+    unsigned int face = libMesh::invalid_uint;
+    /// The nearest point of the face
+    Point closest_point;
+    /// The distance from the point to the face
+    Real distance = std::numeric_limits<Real>::max();
+  };
+
+  /// Removes all the faces
+  void clear()
+  {
+    for (auto * component : {&_ax, &_ay, &_az, &_bx, &_by, &_bz, &_cx, &_cy, &_cz})
+      component->clear();
+    _face.clear();
+    _segment.clear();
+  }
+
+  /**
+   * Adds a triangle of a face; a face may have several (e.g. the two of a QUAD4)
+   * @return The index of the triangle
+   */
+  unsigned int addTriangle(unsigned int face, const Point & a, const Point & b, const Point & c)
+  {
+    push(a, b, c);
+    _face.push_back(face);
+    _segment.push_back(false);
+    return _face.size() - 1;
+  }
+
+  /// Adds the segment of a face of a 2D surface
+  unsigned int addSegment(unsigned int face, const Point & a, const Point & b)
+  {
+    push(a, b, b);
+    _face.push_back(face);
+    _segment.push_back(true);
+    return _face.size() - 1;
+  }
+
+  /// The number of triangles and segments
+  std::size_t size() const { return _face.size(); }
+
+  /**
+   * Finds the nearest face of points [begin, end)
+   * @param points The points
+   * @param candidate_offsets The candidates of point i are candidates[candidate_offsets[i]] to
+   *                          candidates[candidate_offsets[i + 1]], triangle or segment indices
+   * @param candidates The candidates of all the points
+   * @param results The nearest face of each point, sized like points
+   */
+  void search(const std::vector<Point> & points,
+              const std::vector<unsigned int> & candidate_offsets,
+              const std::vector<unsigned int> & candidates,
+              std::vector<Result> & results,
+              std::size_t begin,
+              std::size_t end) const
+  {
+    mooseAssert(candidate_offsets.size() == points.size() + 1, "One offset per point is required");
+    mooseAssert(results.size() == points.size(), "results must be sized like points");
+
+    for (auto i = begin; i < end; ++i)
+    {
+      Result best;
+      Real best_sq = std::numeric_limits<Real>::max();
+      for (auto c = candidate_offsets[i]; c < candidate_offsets[i + 1]; ++c)
+      {
+        const auto t = candidates[c];
+        const Point closest = _segment[t] ? closestOnSegment(t, points[i])
+                                          : closestOnTriangle(t, points[i]);
+        const Point diff = points[i] - closest;
+        const Real dist_sq = diff * diff;
+        if (dist_sq < best_sq)
+        {
+          best_sq = dist_sq;
+          best.face = _face[t];
+          best.closest_point = closest;
+        }
+      }
+      if (best.face != libMesh::invalid_uint)
+        best.distance = std::sqrt(best_sq);
+      results[i] = best;
+    }
+  }
+
+  /// Finds the nearest face of all the points
+  void search(const std::vector<Point> & points,
+              const std::vector<unsigned int> & candidate_offsets,
+              const std::vector<unsigned int> & candidates,
+              std::vector<Result> & results) const
+  {
+    results.resize(points.size());
+    search(points, candidate_offsets, candidates, results, 0, points.size());
+  }
+
+private:
+  void push(const Point & a, const Point & b, const Point & c)
+  {
+    _ax.push_back(a(0));
+    _ay.push_back(a(1));
+    _az.push_back(a(2));
+    _bx.push_back(b(0));
+    _by.push_back(b(1));
+    _bz.push_back(b(2));
+    _cx.push_back(c(0));
+    _cy.push_back(c(1));
+    _cz.push_back(c(2));
+  }
+
+  Point closestOnSegment(unsigned int t, const Point & p) const
+  {
+    const Point a(_ax[t], _ay[t], _az[t]);
+    const Point ab = Point(_bx[t], _by[t], _bz[t]) - a;
+    const Real len_sq = ab * ab;
+    const Real s = len_sq > 0 ? std::min(std::max(((p - a) * ab) / len_sq, Real(0)), Real(1)) : 0;
+    return a + s * ab;
+  }
+
+  /// The closest point of a triangle by its Voronoi regions (Ericson, Real-Time Collision
+  /// Detection, 5.1.5)
+  Point closestOnTriangle(unsigned int t, const Point & p) const
+  {
+    const Point a(_ax[t], _ay[t], _az[t]);
+    const Point b(_bx[t], _by[t], _bz[t]);
+    const Point c(_cx[t], _cy[t], _cz[t]);
+    const Point ab = b - a, ac = c - a, ap = p - a;
+
+    const Real d1 = ab * ap, d2 = ac * ap;
+    if (d1 <= 0 && d2 <= 0)
+      return a;
+
+    const Point bp = p - b;
+    const Real d3 = ab * bp, d4 = ac * bp;
+    if (d3 >= 0 && d4 <= d3)
+      return b;
+
+    const Real vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0)
+      return a + (d1 / (d1 - d3)) * ab;
+
+    const Point cp = p - c;
+    const Real d5 = ab * cp, d6 = ac * cp;
+    if (d6 >= 0 && d5 <= d6)
+      return c;
+
+    const Real vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0)
+      return a + (d2 / (d2 - d6)) * ac;
+
+    const Real va = d3 * d6 - d5 * d4;
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+      return b + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b);
+
+    const Real denom = 1 / (va + vb + vc);
+    return a + (vb * denom) * ab + (vc * denom) * ac;
+  }
+
+  ///@{ The vertices of the triangles and segments (c = b for a segment)
+  std::vector<Real> _ax, _ay, _az;
+  std::vector<Real> _bx, _by, _bz;
+  std::vector<Real> _cx, _cy, _cz;
+  ///@}
+
+  /// The face of each triangle or segment
+  std::vector<unsigned int> _face;
+  /// Whether each entry is a segment
+  std::vector<bool> _segment;
+};
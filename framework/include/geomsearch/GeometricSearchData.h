@@ -67,6 +67,12 @@ public:
   void addElementPairLocator(const unsigned int & interface_id,
                              std::shared_ptr<ElementPairLocator> epl);
 
+  /**
+   * The estimated number of bytes held by all the nearest node and penetration locators (see
+   * MemoryAccounting)
+   */
+  std::size_t memoryBytes() const;
+
   /**
    * Update all of the search objects.
    */
@@ -12,6 +12,9 @@
 // Moose
 #include "Restartable.h"
 #include "PerfGraphInterface.h"
+#include "CompressedAdjacency.h"
+#include "BoundingVolumeHierarchy.h"
+#include "MemoryUtils.h"
 
 // Forward declarations
 class SubProblem;
@@ -75,6 +78,50 @@ public:
    */
   void updateGhostedElems();
 
+  /**
+   * Searches the nearest nodes, and the candidate faces of the PenetrationThread, with a bounding
+   * volume hierarchy over the primary faces instead of patches of the patch_size nearest primary
+   * nodes. The hierarchy is refit to the moved nodes at each findNodes() (and rebuilt once a refit
+   * degrades it too much), so no patch update strategy or patch size is involved: the search is
+   * exact however far the surfaces slide.
+   */
+  void setUseBVH(bool use_bvh) { _use_bvh = use_bvh; }
+  bool usesBVH() const { return _use_bvh; }
+
+  /**
+   * Refits (or builds) the hierarchy of the primary faces to the current node positions; called
+   * by findNodes() when the hierarchy is in use
+   */
+  void updatePrimaryFaceBVH();
+
+  /**
+   * The primary elements with a face whose bounding box is within radius of p: since the nodes
+   * of a face are in its box, no face closer to p than its nearest primary node is missed with
+   * radius = distance()
+   */
+  void candidatePrimaryElems(const Point & p, Real radius, std::vector<dof_id_type> & elems) const
+  {
+    elems.clear();
+    _primary_face_bvh.forEachWithin(p,
+                                    radius,
+                                    [this, &elems](unsigned int face)
+                                    { elems.push_back(_primary_faces[face].first); });
+    std::sort(elems.begin(), elems.end());
+    elems.erase(std::unique(elems.begin(), elems.end()), elems.end());
+  }
+
+  /**
+   * The estimated number of bytes held by the nearest node data, the secondary nodes and their
+   * neighborhoods (see MemoryAccounting)
+   */
+  std::size_t memoryBytes() const
+  {
+    return MemoryUtils::containerBytes(_nearest_node_info) +
+           MemoryUtils::containerBytes(_secondary_nodes) + _neighbor_nodes.memoryBytes() +
+           MemoryUtils::containerBytes(_new_ghosted_elems) +
+           MemoryUtils::containerBytes(_primary_faces);
+  }
+
   /**
    * Data structure used to hold nearest node info.
    */
@@ -103,7 +150,8 @@ public:
   bool _first;
   std::vector<dof_id_type> _secondary_nodes;
 
-  std::map<dof_id_type, std::vector<dof_id_type>> _neighbor_nodes;
+  /// The neighborhood nodes of each secondary node
+  CompressedAdjacency<dof_id_type> _neighbor_nodes;
 
   // The following parameter controls the patch size that is searched for each nearest neighbor
   static const unsigned int _patch_size;
@@ -117,6 +165,15 @@ public:
   // The list of ghosted elements added during a time step for iteration patch update strategy
   std::vector<dof_id_type> _new_ghosted_elems;
 
+  /// Whether the searches use the hierarchy of the primary faces, see setUseBVH()
+  bool _use_bvh = false;
+
+  /// The (element, side) of each face of the primary boundary, the items of _primary_face_bvh
+  std::vector<std::pair<dof_id_type, unsigned short int>> _primary_faces;
+
+  /// The bounding volume hierarchy of the primary faces
+  BoundingVolumeHierarchy _primary_face_bvh;
+
   // Timers
   PerfID _find_nodes_timer;
   PerfID _update_patch_timer;
@@ -15,7 +15,7 @@ class NearestNodeThread
 {
 public:
   NearestNodeThread(const MooseMesh & mesh,
-                    std::map<dof_id_type, std::vector<dof_id_type>> & neighbor_nodes);
+                    const CompressedAdjacency<dof_id_type> & neighbor_nodes);
 
   // Splitting Constructor
   NearestNodeThread(NearestNodeThread & x, Threads::split split);
@@ -36,6 +36,6 @@ protected:
   const MooseMesh & _mesh;
 
   // The neighborhood nodes associated with each node
-  std::map<dof_id_type, std::vector<dof_id_type>> & _neighbor_nodes;
+  const CompressedAdjacency<dof_id_type> & _neighbor_nodes;
 };
 
@@ -13,6 +13,8 @@
 #include "Restartable.h"
 #include "PenetrationInfo.h"
 #include "PerfGraphInterface.h"
+#include "ContactSearchBatch.h"
+#include "MemoryUtils.h"
 
 #include "libmesh/vector_value.h"
 #include "libmesh/point.h"
@@ -85,8 +87,27 @@ public:
   void setTangentialTolerance(Real tangential_tolerance);
   void setNormalSmoothingDistance(Real normal_smoothing_distance);
   void setNormalSmoothingMethod(std::string nsmString);
+  /// Searches the candidate faces with the hierarchy of the primary faces of the nearest node
+  /// locator instead of the elements around the nearest node, see NearestNodeLocator::setUseBVH()
+  void setUseBVH(bool use_bvh);
+  /// Picks the contact face of each secondary node with one batched closest-point search over
+  /// the candidate faces of all the nodes (see ContactSearchBatch) before the exact projection,
+  /// which then runs on the winning face only
+  void setBatchedSearch(bool batched_search) { _batched_search = batched_search; }
   Real getTangentialTolerance() { return _tangential_tolerance; }
 
+  /**
+   * The estimated number of bytes held by the penetration data of the secondary nodes, not
+   * counting the nearest node locator (see MemoryAccounting)
+   */
+  std::size_t memoryBytes() const
+  {
+    return MemoryUtils::containerBytes(_penetration_info) +
+           _penetration_info.size() * sizeof(PenetrationInfo) +
+           MemoryUtils::containerBytes(_has_penetrated) +
+           MemoryUtils::containerBytes(_batched_results);
+  }
+
 protected:
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
@@ -100,6 +121,16 @@ protected:
 
   const Moose::PatchUpdateType _patch_update_strategy; // Contact patch update strategy
 
+  /// Whether detectPenetration() runs the batched nearest-face search first
+  bool _batched_search = false;
+  /// The flattened primary faces of the batched search
+  ContactSearchBatch _search_batch;
+  /// The nearest face of each secondary node found by the batched search, in secondary node order
+  std::vector<ContactSearchBatch::Result> _batched_results;
+
+  /// Flattens the primary faces into _search_batch and searches the secondary nodes
+  void batchedSearch();
+
   /// Timers
   PerfID _detect_penetration_timer;
   PerfID _reinit_timer;
@@ -37,7 +37,7 @@ public:
       std::vector<std::vector<FEBase *>> & fes,
       FEType & fe_type,
       NearestNodeLocator & nearest_node,
-      const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
+      const CompressedAdjacency<dof_id_type> & node_to_elem_map,
       const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> & bc_tuples);
 
   // Splitting Constructor
@@ -76,7 +76,7 @@ protected:
 
   NearestNodeLocator & _nearest_node;
 
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const CompressedAdjacency<dof_id_type> & _node_to_elem_map;
 
   // Each boundary condition tuple has three entries, (0=elem-id, 1=side-id, 2=bc-id)
   const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> & _bc_tuples;
@@ -170,6 +170,13 @@ protected:
                          const std::vector<const Node *> & nodes_that_must_be_on_side,
                          const bool check_whether_reasonable = false);
 
+  /**
+   * The primary elements whose faces are tried for a secondary node: those around its nearest
+   * primary node or, when the nearest node locator uses its face hierarchy, all those with a face
+   * closer than that node
+   */
+  void candidatePrimaryElems(const Node & secondary_node, std::vector<dof_id_type> & elems);
+
   void getSidesOnPrimaryBoundary(std::vector<unsigned int> & sides, const Elem * const elem);
 
   void computeSlip(FEBase & fe, PenetrationInfo & info);
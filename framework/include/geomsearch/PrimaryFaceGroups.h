@@ -0,0 +1,120 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseHashing.h"
+#include "PenetrationInfo.h"
+
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * The secondary nodes of a node-face constraint grouped by the primary face they are in contact
+ * with, so that the primary face FE is reinitialized once per face, at the contact points of all
+ * its secondary nodes, instead of once per secondary node.
+ *
+ * The faces are in the order of their first secondary node, and the nodes of a face in their
+ * original order, so that the constraint contributions are assembled in a deterministic order.
+ * Point i of a face is the contact point (in the reference coordinates of the primary element)
+ * of its node i: the constraint evaluates that node at primary quadrature point i.
+ */
+class PrimaryFaceGroups
+{
+public:
+  /**
+   * Groups the secondary nodes that have a contact face
+   * @param secondary_nodes The secondary nodes, e.g. those of the NearestNodeLocator
+   * @param penetration_info The penetration info of the secondary nodes
+   */
+  void build(const std::vector<dof_id_type> & secondary_nodes,
+             const std::map<dof_id_type, PenetrationInfo *> & penetration_info)
+  {
+    _elems.clear();
+    _sides.clear();
+    _offsets.assign(1, 0);
+    _nodes.clear();
+    _points.clear();
+
+    std::unordered_map<std::pair<const Elem *, unsigned int>, unsigned int> face_index;
+    std::vector<std::pair<unsigned int, const PenetrationInfo *>> node_face;
+    node_face.reserve(secondary_nodes.size());
+    std::vector<dof_id_type> node_ids;
+    node_ids.reserve(secondary_nodes.size());
+
+    for (const auto node_id : secondary_nodes)
+    {
+      const auto it = penetration_info.find(node_id);
+      if (it == penetration_info.end() || !it->second || !it->second->_elem)
+        continue;
+
+      const PenetrationInfo & info = *it->second;
+      const auto inserted = face_index.emplace(std::make_pair(info._elem, info._side_num),
+                                               static_cast<unsigned int>(_elems.size()));
+      if (inserted.second)
+      {
+        _elems.push_back(info._elem);
+        _sides.push_back(info._side_num);
+      }
+      node_face.emplace_back(inserted.first->second, &info);
+      node_ids.push_back(node_id);
+    }
+
+    // Counting sort of the nodes by face, stable so the nodes of a face keep their order
+    _offsets.assign(_elems.size() + 1, 0);
+    for (const auto & entry : node_face)
+      ++_offsets[entry.first + 1];
+    for (std::size_t f = 0; f < _elems.size(); ++f)
+      _offsets[f + 1] += _offsets[f];
+
+    _nodes.resize(node_face.size());
+    _points.resize(_elems.size());
+    std::vector<unsigned int> next(_offsets.begin(), _offsets.end() - 1);
+    for (std::size_t n = 0; n < node_face.size(); ++n)
+    {
+      const auto face = node_face[n].first;
+      _nodes[next[face]++] = node_ids[n];
+      _points[face].push_back(node_face[n].second->_closest_point_ref);
+    }
+  }
+
+  /// The number of primary faces in contact
+  std::size_t size() const { return _elems.size(); }
+
+  ///@{ The primary element and side of face f
+  const Elem * elem(std::size_t f) const { return _elems[f]; }
+  unsigned int side(std::size_t f) const { return _sides[f]; }
+  ///@}
+
+  ///@{ The secondary nodes of face f
+  std::vector<dof_id_type>::const_iterator nodesBegin(std::size_t f) const
+  {
+    return _nodes.begin() + _offsets[f];
+  }
+  std::vector<dof_id_type>::const_iterator nodesEnd(std::size_t f) const
+  {
+    return _nodes.begin() + _offsets[f + 1];
+  }
+  ///@}
+
+  /// The contact points of the secondary nodes of face f, for reinitNeighborPhys()
+  const std::vector<Point> & points(std::size_t f) const { return _points[f]; }
+
+private:
+  std::vector<const Elem *> _elems;
+  std::vector<unsigned int> _sides;
+
+  /// The nodes of face f are _nodes[_offsets[f]] to _nodes[_offsets[f + 1]]
+  std::vector<unsigned int> _offsets;
+  std::vector<dof_id_type> _nodes;
+
+  std::vector<std::vector<Point>> _points;
+};
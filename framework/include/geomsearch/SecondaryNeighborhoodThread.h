@@ -27,7 +27,7 @@ public:
   SecondaryNeighborhoodThread(
       const MooseMesh & mesh,
       const std::vector<dof_id_type> & trial_primary_nodes,
-      const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
+      const CompressedAdjacency<dof_id_type> & node_to_elem_map,
       const unsigned int patch_size,
       KDTree & _kd_tree);
 
@@ -41,8 +41,9 @@ public:
   /// List of the secondary nodes we're actually going to keep track of
   std::vector<dof_id_type> _secondary_nodes;
 
-  /// The neighborhood nodes associated with each node
-  std::map<dof_id_type, std::vector<dof_id_type>> _neighbor_nodes;
+  /// The (secondary node, neighborhood node) pairs, in patch order, gathered into the
+  /// NearestNodeLocator's compressed map once all the threads are joined
+  std::vector<std::pair<dof_id_type, dof_id_type>> _neighbor_nodes;
 
   /// Elements that we need to ghost
   std::set<dof_id_type> _ghosted_elems;
@@ -55,7 +56,7 @@ protected:
   const std::vector<dof_id_type> & _trial_primary_nodes;
 
   /// Node to elem map
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const CompressedAdjacency<dof_id_type> & _node_to_elem_map;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
@@ -16,6 +16,9 @@
 #include "libmesh/vector_value.h"
 #include "libmesh/elem.h"
 
+#include <unordered_set>
+#include <vector>
+
 // forward declarations
 class FEProblemBase;
 class Assembly;
@@ -106,6 +109,28 @@ public:
     return v;
   }
 
+  /**
+   * Whether compute() can set the dofs directly instead of projecting: for first order Lagrange
+   * variables, whose only dofs are the values at the vertices, and for constant monomials, whose
+   * projection is the element average of value(). The result is the same as the projection's,
+   * without the side and edge reinits and local solves.
+   */
+  bool canAssignDirectly() const
+  {
+    return (_fe_type.family == LAGRANGE && _fe_type.order == FIRST) ||
+           (_fe_type.family == MONOMIAL && _fe_type.order == CONSTANT);
+  }
+
+  /**
+   * Sets the dofs of the current element when canAssignDirectly(): value() at the vertices not
+   * assigned yet by this object, or the quadrature average of value() on the element.
+   *
+   * A vertex shared by several elements of the thread therefore takes the value computed from the
+   * first of them, where the projection kept the last one; the two only differ for an IC whose
+   * value() depends on the current element at a shared vertex (e.g. on its subdomain).
+   */
+  void assignDirectly();
+
   /**
    * Perform the cholesky solves for edge, side, and interior projections
    */
@@ -193,6 +218,46 @@ protected:
   unsigned int _n;
   /// the mesh dimension
   unsigned int _dim;
+
+  /**
+   * Records that assignDirectly() set a dof
+   * @return Whether the dof was not set yet
+   */
+  bool markAssigned(dof_id_type dof)
+  {
+    if (dof >= _first_local_dof && dof - _first_local_dof < _assigned_local_dofs.size())
+    {
+      auto assigned = _assigned_local_dofs[dof - _first_local_dof];
+      if (assigned)
+        return false;
+      assigned = true;
+      return true;
+    }
+    return _assigned_remote_dofs.insert(dof).second;
+  }
+
+  /**
+   * Forgets the dofs set by assignDirectly(), before each application of this IC
+   * @param first_local_dof The first dof of this processor in the system
+   * @param n_local_dofs The number of dofs of this processor in the system
+   */
+  void clearAssigned(dof_id_type first_local_dof, dof_id_type n_local_dofs)
+  {
+    _first_local_dof = first_local_dof;
+    _assigned_local_dofs.assign(n_local_dofs, false);
+    _assigned_remote_dofs.clear();
+  }
+
+  /**
+   * The dofs assignDirectly() has set, so that the vertices shared by several elements are only
+   * evaluated once by the thread: the dofs of this processor, indexed from _first_local_dof, and
+   * the others (on the vertices of the partition boundary) in a set.
+   */
+  ///@{
+  dof_id_type _first_local_dof = 0;
+  std::vector<bool> _assigned_local_dofs;
+  std::unordered_set<dof_id_type> _assigned_remote_dofs;
+  ///@}
 };
 
 template <typename T>
@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+class ElementBatch;
+
+/**
+ * Interface for kernels that can compute the residual and Jacobian contributions of a whole
+ * ElementBatch in a single call.
+ *
+ * The standard residual and Jacobian threads assemble element by element and do not call it; a
+ * loop staging elements into an ElementBatch may only use the batched path on a subdomain when
+ * every active kernel there implements this interface and returns true from supportsBatch().
+ */
+class BatchResidualInterface
+{
+public:
+  virtual ~BatchResidualInterface() = default;
+
+  /**
+   * Whether this object can currently be evaluated in batched mode. Objects may return false,
+   * e.g. when they couple to other variables or materials that are not staged in the batch.
+   */
+  virtual bool supportsBatch() const { return true; }
+
+  /**
+   * Accumulate the residual contributions of every element in the batch into
+   * ElementBatch::residual()
+   */
+  virtual void computeBatchResidual(ElementBatch & batch) = 0;
+
+  /**
+   * Accumulate the on-diagonal Jacobian contributions of every element in the batch into
+   * ElementBatch::jacobian()
+   */
+  virtual void computeBatchJacobian(ElementBatch & batch) = 0;
+};
@@ -16,6 +16,7 @@
 #include "MooseVariableFV.h"
 #include "InputParameters.h"
 #include "HasMembers.h"
+#include "SolutionStateRequests.h"
 
 // Forward declarations
 class MooseVariableScalar;
@@ -1240,6 +1241,17 @@ protected:
    */
   void validateExecutionerType(const std::string & name, const std::string & fn_name) const;
 
+  /**
+   * Records in the system of a coupled variable that this object needs one of its old, older or
+   * time derivative vectors, so that the system allocates the time derivatives and reports all of
+   * them (see SystemBase::requestSolutionState()); called by the coupledValueOld(), coupledDot()
+   * and similar methods
+   * @param var The coupled variable
+   * @param vector The vector needed
+   */
+  void requestSolutionState(const MooseVariableFieldBase & var,
+                            SolutionStateRequests::Vector vector) const;
+
   template <typename T, typename Func>
   std::vector<T> coupledVectorHelper(const std::string & var_name, const Func & func) const
   {
@@ -14,6 +14,7 @@
 #include <set>
 #include <iostream>
 #include <algorithm>
+#include <unordered_map>
 
 // MOOSE includes
 #include "DependencyResolver.h"
@@ -58,35 +59,39 @@ DependencyResolverInterface::sort(typename std::vector<T> & vector)
 {
   DependencyResolver<T> resolver;
 
-  typename std::vector<T>::iterator start = vector.begin();
-  typename std::vector<T>::iterator end = vector.end();
+  // The objects supplying each item, in the order of the vector
+  std::unordered_map<std::string, std::vector<std::size_t>> suppliers;
+  for (std::size_t i = 0; i < vector.size(); ++i)
+    for (const auto & item : vector[i]->getSuppliedItems())
+      suppliers[item].push_back(i);
 
-  for (typename std::vector<T>::iterator iter = start; iter != end; ++iter)
+  // Each object depends on the suppliers of its requested items, inserted in the order of the
+  // vector so that the ties are broken as when all the pairs are compared
+  std::vector<std::size_t> depends_on;
+  for (std::size_t i = 0; i < vector.size(); ++i)
   {
-    const std::set<std::string> & requested_items = (*iter)->getRequestedItems();
-
-    for (typename std::vector<T>::iterator iter2 = start; iter2 != end; ++iter2)
+    depends_on.clear();
+    for (const auto & item : vector[i]->getRequestedItems())
     {
-      if (iter == iter2)
-        continue;
-
-      const std::set<std::string> & supplied_items = (*iter2)->getSuppliedItems();
-
-      std::set<std::string> intersect;
-      std::set_intersection(requested_items.begin(),
-                            requested_items.end(),
-                            supplied_items.begin(),
-                            supplied_items.end(),
-                            std::inserter(intersect, intersect.end()));
-
-      // If the intersection isn't empty then there is a dependency here
-      if (!intersect.empty())
-        resolver.insertDependency(*iter, *iter2);
+      const auto it = suppliers.find(item);
+      if (it != suppliers.end())
+        depends_on.insert(depends_on.end(), it->second.begin(), it->second.end());
     }
+    std::sort(depends_on.begin(), depends_on.end());
+    depends_on.erase(std::unique(depends_on.begin(), depends_on.end()), depends_on.end());
+
+    // The cycles, if any, are reported by the sort below
+    for (const auto j : depends_on)
+      if (j != i)
+        resolver.insertDependencyUnchecked(vector[i], vector[j]);
   }
 
-  // Sort based on dependencies
-  std::stable_sort(start, end, resolver);
+  // Sort based on dependencies; the resolver is passed by reference, since the sort copies its
+  // comparator
+  resolver.getSortedValues();
+  std::stable_sort(vector.begin(),
+                   vector.end(),
+                   [&resolver](const T & a, const T & b) { return resolver(a, b); });
 }
 
 template <typename T>
@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+class DeviceElementBatch;
+
+/**
+ * Interface for kernels that can compute the residual and Jacobian contributions of a batch of
+ * elements on the accelerator, from the data mirrored in a DeviceElementBatch.
+ *
+ * As for BatchResidualInterface, the element loops only offload a subdomain when every active
+ * kernel there implements this interface and returns true from supportsDevice(). The
+ * implementations run their loops through Moose::Device::parallelFor() with MOOSE_DEVICE_LAMBDA
+ * bodies, which only capture device pointers and sizes, so the same code runs on the thread pool
+ * when MOOSE is built without an accelerator back end.
+ */
+class DeviceResidualInterface
+{
+public:
+  virtual ~DeviceResidualInterface() = default;
+
+  /// Whether this object can currently be evaluated on the accelerator
+  virtual bool supportsDevice() const { return true; }
+
+  /// Accumulate the residual contributions of the batch into DeviceElementBatch::residual()
+  virtual void computeDeviceResidual(DeviceElementBatch & batch) = 0;
+
+  /// Accumulate the on-diagonal Jacobian contributions of the batch into jacobian()
+  virtual void computeDeviceJacobian(DeviceElementBatch & batch) = 0;
+};
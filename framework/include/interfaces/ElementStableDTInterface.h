@@ -0,0 +1,32 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * Interface of the UserObjects computing the stable time step of each element of an explicit
+ * scheme (e.g. from the wave speed of a material), used by StableDT for the global time step
+ * and by ExplicitTimeIntegrator for its subcycling levels.
+ */
+class ElementStableDTInterface
+{
+public:
+  /// The ids of the local elements, in the order of elementStableDT()
+  virtual const std::vector<dof_id_type> & elementIds() const = 0;
+
+  /// The stable time step of each local element
+  virtual const std::vector<Real> & elementStableDT() const = 0;
+
+  /// The smallest stable time step over all the elements, on every processor
+  virtual Real minimumStableDT() const = 0;
+};
@@ -134,6 +134,21 @@ public:
    **/
   virtual bool updateHeal() = 0;
 
+  /**
+   * The IDs of the elements cut, added, deleted or healed by the last update() or updateHeal().
+   * When the XFEM controller supports it (see supportsIncrementalUpdate()), the problem restricts
+   * the mesh-change updates that are local in nature (stateful material projection, geometric
+   * search, cached element data) to these elements instead of the whole mesh.
+   */
+  virtual const std::set<dof_id_type> & getChangedElems() const
+  {
+    static const std::set<dof_id_type> empty;
+    return empty;
+  }
+
+  /// Whether getChangedElems() is complete, so that the mesh-change updates can be incremental
+  virtual bool supportsIncrementalUpdate() const { return false; }
+
 protected:
   FEProblemBase * _fe_problem;
   std::vector<std::shared_ptr<MaterialData>> * _material_data;
@@ -28,6 +28,11 @@ protected:
   virtual RealEigenVector computeQpJacobian() override;
   virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
 
+  /// The diffusion Jacobian is the diffusivity times grad_phi . grad_test for every component
+  virtual bool fusedJacobian() const override { return true; }
+  virtual RealEigenMatrix computeQpJacobianCoupling() override;
+  virtual Real computeQpJacobianForm() override;
+
   /// scalar diffusion coefficient
   const MaterialProperty<Real> * const _d;
   /// array diffusion coefficient
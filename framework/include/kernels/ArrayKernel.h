@@ -79,6 +79,32 @@ protected:
     return RealEigenMatrix::Zero(_var.count(), (unsigned int)jvar.order() + 1);
   }
 
+  /**
+   * Fused Jacobian evaluation, for kernels whose Jacobian at a quadrature point factors into a
+   * coefficient per component (diagonal) or a coupling matrix between the components (full) times
+   * one form of the test and shape functions shared by all the components. When this returns true,
+   * computeJacobian() and computeOffDiagJacobian() of the variable itself call
+   * computeQpJacobianCoupling() once per quadrature point and computeQpJacobianForm() once per
+   * test/shape function pair, and add the whole blocks through Assembly, instead of building a
+   * vector or matrix of the components for every pair.
+   */
+  virtual bool fusedJacobian() const { return false; }
+
+  /**
+   * The coupling between the components at the current quadrature point, for the fused Jacobian:
+   * a single column for a diagonal coupling, or a square matrix
+   */
+  virtual RealEigenMatrix computeQpJacobianCoupling()
+  {
+    mooseError("computeQpJacobianCoupling() must be overridden when fusedJacobian() is true");
+  }
+
+  /// The shared form of the current test (_i) and shape (_j) functions, for the fused Jacobian
+  virtual Real computeQpJacobianForm()
+  {
+    mooseError("computeQpJacobianForm() must be overridden when fusedJacobian() is true");
+  }
+
   /**
    * Put necessary evaluations depending on qp but independent on test functions here
    */
@@ -123,4 +149,11 @@ protected:
 
   /// Number of components of the array variable
   const unsigned int _count;
+
+private:
+  /// Assembles the Jacobian of the variable itself through the fused evaluation
+  void computeFusedJacobian();
+
+  /// The shared form of each test and shape function pair at a quadrature point
+  RealEigenMatrix _jacobian_form;
 };
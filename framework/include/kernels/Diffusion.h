@@ -10,6 +10,12 @@
 #pragma once
 
 #include "Kernel.h"
+#include "BatchResidualInterface.h"
+#include "DeviceResidualInterface.h"
+#include "ElementBatch.h"
+#include "DeviceElementBatch.h"
+
+#include <typeinfo>
 
 class Diffusion;
 
@@ -20,16 +26,132 @@ InputParameters validParams<Diffusion>();
  * This kernel implements the Laplacian operator:
  * $\nabla u \cdot \nabla \phi_i$
  */
-class Diffusion : public Kernel
+class Diffusion : public Kernel, public BatchResidualInterface, public DeviceResidualInterface
 {
 public:
   static InputParameters validParams();
 
   Diffusion(const InputParameters & parameters);
 
+  /// Derived classes change the weak form, so only plain Diffusion objects are batched
+  virtual bool supportsBatch() const override { return typeid(*this) == typeid(Diffusion); }
+
+  virtual void computeBatchResidual(ElementBatch & batch) override;
+
+  virtual void computeBatchJacobian(ElementBatch & batch) override;
+
+  virtual bool supportsDevice() const override { return supportsBatch(); }
+
+  virtual void computeDeviceResidual(DeviceElementBatch & batch) override;
+
+  virtual void computeDeviceJacobian(DeviceElementBatch & batch) override;
+
 protected:
   virtual Real computeQpResidual() override;
 
   virtual Real computeQpJacobian() override;
 };
 
+inline void
+Diffusion::computeBatchResidual(ElementBatch & batch)
+{
+  const auto n_qp = batch.nQp();
+  const auto n_dofs = batch.nDofs();
+  for (unsigned int e = 0; e < batch.nElem(); ++e)
+  {
+    const Real * JxW = batch.JxW(e);
+    Real * re = batch.residual(e);
+    for (unsigned int i = 0; i < n_dofs; ++i)
+    {
+      Real sum = 0;
+      for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+      {
+        const Real * grad_u = batch.gradU(e, d);
+        const Real * grad_test = batch.gradTest(e, i, d);
+        for (unsigned int qp = 0; qp < n_qp; ++qp)
+          sum += JxW[qp] * grad_u[qp] * grad_test[qp];
+      }
+      re[i] += sum;
+    }
+  }
+}
+
+inline void
+Diffusion::computeBatchJacobian(ElementBatch & batch)
+{
+  // Galerkin: the phi gradients are the test gradients
+  const auto n_qp = batch.nQp();
+  const auto n_dofs = batch.nDofs();
+  for (unsigned int e = 0; e < batch.nElem(); ++e)
+  {
+    const Real * JxW = batch.JxW(e);
+    Real * ke = batch.jacobian(e);
+    for (unsigned int i = 0; i < n_dofs; ++i)
+      for (unsigned int j = 0; j < n_dofs; ++j)
+      {
+        Real sum = 0;
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+          const Real * grad_test = batch.gradTest(e, i, d);
+          const Real * grad_phi = batch.gradTest(e, j, d);
+          for (unsigned int qp = 0; qp < n_qp; ++qp)
+            sum += JxW[qp] * grad_phi[qp] * grad_test[qp];
+        }
+        ke[i * n_dofs + j] += sum;
+      }
+  }
+}
+
+inline void
+Diffusion::computeDeviceResidual(DeviceElementBatch & batch)
+{
+  const std::size_t n_qp = batch.nQp();
+  const std::size_t n_dofs = batch.nDofs();
+  const std::size_t n_qp_data = batch.nElem() * n_qp;
+  const std::size_t n_shape_data = n_qp_data * n_dofs;
+  const Real * JxW = batch.JxW();
+  const Real * grad_u = batch.gradU();
+  const Real * grad_test = batch.gradTest();
+  Real * re = batch.residual();
+
+  // One entry (e, i) per iteration
+  Moose::Device::parallelFor(batch.nElem() * n_dofs,
+                             MOOSE_DEVICE_LAMBDA(std::size_t ei)
+                             {
+                               const std::size_t e = ei / n_dofs;
+                               Real sum = 0;
+                               for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+                                 for (std::size_t qp = 0; qp < n_qp; ++qp)
+                                   sum += JxW[e * n_qp + qp] *
+                                          grad_u[d * n_qp_data + e * n_qp + qp] *
+                                          grad_test[d * n_shape_data + ei * n_qp + qp];
+                               re[ei] += sum;
+                             });
+}
+
+inline void
+Diffusion::computeDeviceJacobian(DeviceElementBatch & batch)
+{
+  const std::size_t n_qp = batch.nQp();
+  const std::size_t n_dofs = batch.nDofs();
+  const std::size_t n_shape_data = batch.nElem() * n_qp * n_dofs;
+  const Real * JxW = batch.JxW();
+  const Real * grad_test = batch.gradTest();
+  Real * ke = batch.jacobian();
+
+  // One entry (e, i, j) per iteration
+  Moose::Device::parallelFor(batch.nElem() * n_dofs * n_dofs,
+                             MOOSE_DEVICE_LAMBDA(std::size_t eij)
+                             {
+                               const std::size_t ei = eij / n_dofs;
+                               const std::size_t e = ei / n_dofs;
+                               const std::size_t ej = e * n_dofs + eij % n_dofs;
+                               Real sum = 0;
+                               for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+                                 for (std::size_t qp = 0; qp < n_qp; ++qp)
+                                   sum += JxW[e * n_qp + qp] *
+                                          grad_test[d * n_shape_data + ei * n_qp + qp] *
+                                          grad_test[d * n_shape_data + ej * n_qp + qp];
+                               ke[eij] += sum;
+                             });
+}
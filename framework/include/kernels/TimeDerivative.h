@@ -10,6 +10,10 @@
 #pragma once
 
 #include "TimeKernel.h"
+#include "DeviceResidualInterface.h"
+#include "DeviceElementBatch.h"
+
+#include <typeinfo>
 
 // Forward Declaration
 class TimeDerivative;
@@ -17,7 +21,7 @@ class TimeDerivative;
 template <>
 InputParameters validParams<TimeDerivative>();
 
-class TimeDerivative : public TimeKernel
+class TimeDerivative : public TimeKernel, public DeviceResidualInterface
 {
 public:
   static InputParameters validParams();
@@ -26,6 +30,16 @@ public:
 
   virtual void computeJacobian() override;
 
+  /// Only plain, consistent-mass TimeDerivative objects are offloaded
+  virtual bool supportsDevice() const override
+  {
+    return !_lumping && typeid(*this) == typeid(TimeDerivative);
+  }
+
+  virtual void computeDeviceResidual(DeviceElementBatch & batch) override;
+
+  virtual void computeDeviceJacobian(DeviceElementBatch & batch) override;
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
@@ -33,3 +47,48 @@ protected:
   bool _lumping;
 };
 
+inline void
+TimeDerivative::computeDeviceResidual(DeviceElementBatch & batch)
+{
+  const std::size_t n_qp = batch.nQp();
+  const std::size_t n_dofs = batch.nDofs();
+  const Real * JxW = batch.JxW();
+  const Real * u_dot = batch.uDot();
+  const Real * test = batch.test();
+  Real * re = batch.residual();
+
+  Moose::Device::parallelFor(batch.nElem() * n_dofs,
+                             MOOSE_DEVICE_LAMBDA(std::size_t ei)
+                             {
+                               const std::size_t e = ei / n_dofs;
+                               Real sum = 0;
+                               for (std::size_t qp = 0; qp < n_qp; ++qp)
+                                 sum += JxW[e * n_qp + qp] * test[ei * n_qp + qp] *
+                                        u_dot[e * n_qp + qp];
+                               re[ei] += sum;
+                             });
+}
+
+inline void
+TimeDerivative::computeDeviceJacobian(DeviceElementBatch & batch)
+{
+  const std::size_t n_qp = batch.nQp();
+  const std::size_t n_dofs = batch.nDofs();
+  const Real du_dot_du = batch.duDotDu();
+  const Real * JxW = batch.JxW();
+  const Real * test = batch.test();
+  Real * ke = batch.jacobian();
+
+  Moose::Device::parallelFor(batch.nElem() * n_dofs * n_dofs,
+                             MOOSE_DEVICE_LAMBDA(std::size_t eij)
+                             {
+                               const std::size_t ei = eij / n_dofs;
+                               const std::size_t e = ei / n_dofs;
+                               const std::size_t ej = e * n_dofs + eij % n_dofs;
+                               Real sum = 0;
+                               for (std::size_t qp = 0; qp < n_qp; ++qp)
+                                 sum += JxW[e * n_qp + qp] * test[ei * n_qp + qp] *
+                                        test[ej * n_qp + qp];
+                               ke[eij] += du_dot_du * sum;
+                             });
+}
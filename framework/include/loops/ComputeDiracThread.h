@@ -52,5 +52,10 @@ protected:
   MooseObjectTagWarehouse<DiracKernel> & _dirac_kernels;
 
   MooseObjectWarehouse<DiracKernel> * _dirac_warehouse;
+
+  /// The number of elements whose contributions are cached in this thread's Assembly: they are
+  /// added to the global vectors and matrices (under the lock) every few elements and in post(),
+  /// instead of after every element, so that the threads mostly accumulate independently
+  unsigned int _num_cached = 0;
 };
 
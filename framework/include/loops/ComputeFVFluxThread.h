@@ -210,7 +210,7 @@ ThreadedFaceLoop<RangeType>::operator()(const RangeType & range, bool bypass_thr
         // onBoundary would clear the residual/Jacobian data before it was cached
         postFace(**faceinfo);
 
-        const std::set<BoundaryID> boundary_ids = (*faceinfo)->boundaryIDs();
+        const std::set<BoundaryID> & boundary_ids = (*faceinfo)->boundaryIDs();
         for (auto & it : boundary_ids)
           onBoundary(**faceinfo, it);
 
@@ -284,6 +284,15 @@ private:
   const bool _do_jacobian;
   unsigned int _num_cached = 0;
 
+  ///@{ The kernel and boundary condition queries, built once: onBoundary() runs for every
+  /// boundary face
+  TheWarehouse::QueryCache<AttribThread, AttribSubdomains> _kernel_query;
+  TheWarehouse::QueryCache<AttribThread, AttribBoundaries> _bc_query;
+  ///@}
+
+  /// The boundary conditions of the current boundary face
+  std::vector<FVFluxBC *> _bcs;
+
   using ThreadedFaceLoop<RangeType>::_fe_problem;
   using ThreadedFaceLoop<RangeType>::_mesh;
   using ThreadedFaceLoop<RangeType>::_tid;
@@ -296,13 +305,25 @@ template <typename RangeType>
 ComputeFVFluxThread<RangeType>::ComputeFVFluxThread(FEProblemBase & fe_problem,
                                                     const std::set<TagID> & tags)
   : ThreadedFaceLoop<RangeType>(fe_problem, tags),
-    _do_jacobian(fe_problem.currentlyComputingJacobian())
+    _do_jacobian(fe_problem.currentlyComputingJacobian()),
+    _kernel_query(fe_problem.theWarehouse()
+                      .query()
+                      .template condition<AttribSystem>("FVFluxKernel")
+                      .template condition<AttribVectorTags>(tags)),
+    _bc_query(fe_problem.theWarehouse()
+                  .query()
+                  .template condition<AttribSystem>("FVFluxBC")
+                  .template condition<AttribVectorTags>(tags))
 {
 }
 
 template <typename RangeType>
 ComputeFVFluxThread<RangeType>::ComputeFVFluxThread(ComputeFVFluxThread & x, Threads::split split)
-  : ThreadedFaceLoop<RangeType>(x, split), _fv_vars(x._fv_vars), _do_jacobian(x._do_jacobian)
+  : ThreadedFaceLoop<RangeType>(x, split),
+    _fv_vars(x._fv_vars),
+    _do_jacobian(x._do_jacobian),
+    _kernel_query(x._kernel_query),
+    _bc_query(x._bc_query)
 {
 }
 
@@ -367,20 +388,14 @@ template <typename RangeType>
 void
 ComputeFVFluxThread<RangeType>::onBoundary(const FaceInfo & fi, BoundaryID bnd_id)
 {
-  std::vector<FVFluxBC *> bcs;
-  _fe_problem.theWarehouse()
-      .query()
-      .template condition<AttribSystem>("FVFluxBC")
-      .template condition<AttribThread>(_tid)
-      .template condition<AttribVectorTags>(_tags)
-      .template condition<AttribBoundaries>(bnd_id)
-      .queryInto(bcs);
-  if (bcs.size() == 0)
+  AttribBoundaries::Key boundary(bnd_id, false);
+  _bc_query.queryInto(_bcs, _tid, boundary);
+  if (_bcs.size() == 0)
     return;
 
   reinitVariables(fi);
 
-  for (const auto & bc : bcs)
+  for (const auto & bc : _bcs)
     if (_do_jacobian)
       bc->computeJacobian(fi);
     else
@@ -580,13 +595,7 @@ ComputeFVFluxThread<RangeType>::subdomainChanged()
   // like FE or DG kernels because those kernels don't run in this loop. Do we
   // really want to integrate fv source kernels into this loop?
   std::vector<FVFluxKernel *> kernels;
-  _fe_problem.theWarehouse()
-      .query()
-      .template condition<AttribSystem>("FVFluxKernel")
-      .template condition<AttribSubdomains>(_subdomain)
-      .template condition<AttribThread>(_tid)
-      .template condition<AttribVectorTags>(_tags)
-      .queryInto(kernels);
+  _kernel_query.queryInto(kernels, _tid, _subdomain);
 
   _elem_sub_fv_flux_kernels = std::set<FVFluxKernel *>(kernels.begin(), kernels.end());
 
@@ -638,13 +647,7 @@ ComputeFVFluxThread<RangeType>::neighborSubdomainChanged()
   // like FE or DG kernels because those kernels don't run in this loop. Do we
   // really want to integrate fv source kernels into this loop?
   std::vector<FVFluxKernel *> kernels;
-  _fe_problem.theWarehouse()
-      .query()
-      .template condition<AttribSystem>("FVFluxKernel")
-      .template condition<AttribSubdomains>(_neighbor_subdomain)
-      .template condition<AttribThread>(_tid)
-      .template condition<AttribVectorTags>(_tags)
-      .queryInto(kernels);
+  _kernel_query.queryInto(kernels, _tid, _neighbor_subdomain);
 
   _neigh_sub_fv_flux_kernels = std::set<FVFluxKernel *>(kernels.begin(), kernels.end());
 
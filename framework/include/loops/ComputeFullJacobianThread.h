@@ -16,6 +16,10 @@ class FEProblemBase;
 class NonlinearSystemBase;
 class Kernel;
 
+/**
+ * Computes the on- and off-diagonal Jacobian of every kernel, for the coupling entries of the
+ * Assembly: with FEProblemBase::setUsedJacobianBlocks(), only the blocks the preconditioner reads
+ */
 class ComputeFullJacobianThread : public ComputeJacobianThread
 {
 public:
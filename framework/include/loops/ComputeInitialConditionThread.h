@@ -17,6 +17,13 @@
 
 class FEProblemBase;
 
+/**
+ * Applies the initial conditions of the variables on a range of elements, the elements being split
+ * among the threads by Threads::parallel_reduce(). The ICs of all the variables are applied on an
+ * element before the next one, so an element's FE data is reinitialized once for all of them.
+ * The first order Lagrange and constant monomial variables are set directly (see
+ * InitialConditionTempl::canAssignDirectly()), the others by the local projection.
+ */
 class ComputeInitialConditionThread
 {
 public:
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "MooseTypes.h"
+#include "MortarSegmentColoring.h"
 
 #include "libmesh/libmesh_common.h"
 
@@ -39,17 +40,46 @@ public:
       bool displaced);
 
   /**
-   * Loops over the mortar segment mesh and computes the residual/Jacobian
+   * Loops over the mortar segment mesh and computes the residual/Jacobian. When copies of the
+   * constraints were given for every thread (see setThreadConstraints()), the segments are colored
+   * (see MortarSegmentColoring) and the segments of each color are computed concurrently; the
+   * additions to the PETSc vectors and matrices stay serialized under the global mutex.
    */
   void operator()();
 
+  /**
+   * Sets the copies of the mortar constraints of a thread other than 0, which enables the threaded
+   * segment loop once every thread has its copies
+   */
+  void setThreadConstraints(THREAD_ID tid,
+                            const std::vector<std::shared_ptr<MortarConstraintBase>> & constraints);
+
 private:
+  /**
+   * Computes the residual/Jacobian of a range of mortar segments with the Assembly and the
+   * constraints of a thread. The contributions are cached in the Assembly and added under the
+   * global mutex every few segments and at the end of the range, so that the caches stay bounded
+   * and PETSc is never called from two threads at once.
+   */
+  void computeSegments(const MortarSegmentRange & range, THREAD_ID tid);
+
+  /// Colors the segments of the current mortar segment mesh. This runs at every operator(): the
+  /// mesh is rebuilt whenever the displaced mesh moves, and the coloring costs far less than the
+  /// assembly of the segments
+  void updateColoring();
+
+  /// Whether every thread has its constraints
+  bool threaded() const;
+
   /// The mortar constraints to loop over when on each element. These must be
   /// pointers to the base class otherwise the compiler will fail to compile
   /// when running std::vector<MortarConstraint0>::push_back(MortarConstraint1>
   /// or visa versa
   std::vector<MortarConstraintBase *> _mortar_constraints;
 
+  /// The constraints of each thread, _mortar_constraints for thread 0
+  std::vector<std::vector<MortarConstraintBase *>> _thread_mortar_constraints;
+
   /// Automatic mortar generation (amg) object providing the mortar mesh to loop over
   const AutomaticMortarGeneration & _amg;
 
@@ -80,4 +110,10 @@ private:
 
   /// boolean flag for holding whether our current mortar segment projects onto a primary element
   bool _has_primary;
+
+  /// The colors of the segments of the threaded loop
+  MortarSegmentColoring _coloring;
+
+  /// The mortar segment elements of this processor, in mesh order, that were colored
+  std::vector<const Elem *> _colored_segments;
 };
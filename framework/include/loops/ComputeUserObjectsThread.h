@@ -28,6 +28,10 @@ class NumericVector;
 
 /**
  * Class for threaded computation of UserObjects.
+ *
+ * All the element, side, internal side and interface user objects of a query are evaluated in
+ * the same sweep over the mesh: the element, its faces and the materials are reinitialized once
+ * for all of them, with the union of the coupled variables and material properties they need.
  */
 class ComputeUserObjectsThread : public ThreadedElementLoop<ConstElemRange>
 {
@@ -56,6 +60,14 @@ protected:
   const NumericVector<Number> & _soln;
 
 private:
+  /**
+   * Runs the Jacobian contributions of the shape user objects with the shape functions of each
+   * coupled variable prepared once for all of them (variable outermost), instead of once per
+   * object and variable
+   */
+  template <typename T>
+  void computeShapeJacobians(const std::vector<T *> & objs);
+
   template <typename T>
   void querySubdomain(Interfaces iface, std::vector<T> & results)
   {
@@ -74,6 +86,8 @@ private:
   std::vector<InterfaceUserObject *> _interface_user_objects;
   std::vector<ElementUserObject *> _element_objs;
   std::vector<ShapeElementUserObject *> _shape_element_objs;
+  /// The variables the shape element user objects take Jacobians with respect to, sorted
+  std::vector<MooseVariableFEBase *> _shape_jvars;
 };
 
 // determine when we need to run user objects based on whether any initial conditions or aux
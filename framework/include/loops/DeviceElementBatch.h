@@ -0,0 +1,283 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementBatch.h"
+
+#include "libmesh/threads.h"
+
+#ifdef MOOSE_KOKKOS_ENABLED
+#include <Kokkos_Core.hpp>
+#endif
+
+#include <vector>
+
+namespace Moose
+{
+namespace Device
+{
+#ifdef MOOSE_KOKKOS_ENABLED
+/// Storage in the memory of the accelerator
+template <typename T>
+using Array = Kokkos::View<T *>;
+
+template <typename T>
+void
+resize(Array<T> & array, std::size_t n)
+{
+  if (array.extent(0) < n)
+    array = Array<T>("moose_device_array", n);
+}
+
+/// Copies host values to the accelerator
+template <typename T>
+void
+upload(Array<T> & array, const std::vector<T> & values)
+{
+  resize(array, values.size());
+  Kokkos::deep_copy(
+      Kokkos::subview(array, std::make_pair(std::size_t(0), values.size())),
+      Kokkos::View<const T *, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(values.data(),
+                                                                          values.size()));
+}
+
+/// Copies values from the accelerator to the host
+template <typename T>
+void
+download(const Array<T> & array, std::vector<T> & values)
+{
+  Kokkos::deep_copy(Kokkos::View<T *, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(values.data(),
+                                                                                  values.size()),
+                    Kokkos::subview(array, std::make_pair(std::size_t(0), values.size())));
+}
+
+/// Runs f(i) for i in [0, n) on the accelerator
+template <typename F>
+void
+parallelFor(std::size_t n, const F & f)
+{
+  Kokkos::parallel_for("moose_device_loop", n, f);
+  Kokkos::fence();
+}
+
+#define MOOSE_DEVICE_LAMBDA KOKKOS_LAMBDA
+#else
+/// Without an accelerator back end the "device" is the host and its thread pool
+template <typename T>
+using Array = std::vector<T>;
+
+template <typename T>
+void
+resize(Array<T> & array, std::size_t n)
+{
+  if (array.size() < n)
+    array.resize(n);
+}
+
+template <typename T>
+void
+upload(Array<T> & array, const std::vector<T> & values)
+{
+  resize(array, values.size());
+  std::copy(values.begin(), values.end(), array.begin());
+}
+
+template <typename T>
+void
+download(const Array<T> & array, std::vector<T> & values)
+{
+  std::copy(array.begin(), array.begin() + values.size(), values.begin());
+}
+
+template <typename F>
+void
+parallelFor(std::size_t n, const F & f)
+{
+  Threads::parallel_for(Threads::BlockedRange<std::size_t>(0, n),
+                        [&f](const Threads::BlockedRange<std::size_t> & range)
+                        {
+                          for (auto i = range.begin(); i != range.end(); ++i)
+                            f(i);
+                        });
+}
+
+#define MOOSE_DEVICE_LAMBDA [=]
+#endif
+}
+}
+
+/**
+ * The data of an ElementBatch mirrored in accelerator memory (see Moose::Device), for the kernels
+ * implementing DeviceResidualInterface.
+ *
+ * The layout is that of ElementBatch, with all the elements of the batch and the gradient
+ * components in single arrays (grad arrays [d * size + index]), plus the time derivative of the
+ * variable at the quadrature points and the dof indices of the elements. The residual and
+ * Jacobian outputs stay on the device; the Jacobian is in the order of cooIndices(), so it can be
+ * handed to MatSetValuesCOO() of a device matrix directly.
+ */
+class DeviceElementBatch
+{
+public:
+  /**
+   * Mirrors the inputs of a batch
+   * @param batch The staged elements
+   * @param dof_indices The global dof indices of the elements, nDofs() per element
+   * @param u_dot The time derivative of the variable at the quadrature points (empty if unused)
+   * @param du_dot_du The derivative of u_dot with respect to u
+   */
+  void upload(const ElementBatch & batch,
+              const std::vector<dof_id_type> & dof_indices,
+              const std::vector<Real> & u_dot = {},
+              Real du_dot_du = 0)
+  {
+    _n_elem = batch.nElem();
+    _n_qp = batch.nQp();
+    _n_dofs = batch.nDofs();
+    _du_dot_du = du_dot_du;
+    mooseAssert(dof_indices.size() == std::size_t(_n_elem) * _n_dofs, "Wrong dof index count");
+
+    const std::size_t n_qp_data = std::size_t(_n_elem) * _n_qp;
+    const std::size_t n_shape_data = n_qp_data * _n_dofs;
+    _host.assign(n_qp_data, 0);
+    copyQp(batch, [&batch](unsigned int e) { return batch.JxW(e); });
+    Moose::Device::upload(_JxW, _host);
+    copyQp(batch, [&batch](unsigned int e) { return batch.u(e); });
+    Moose::Device::upload(_u, _host);
+    Moose::Device::upload(_u_dot, u_dot.empty() ? std::vector<Real>(n_qp_data, 0) : u_dot);
+
+    _host.resize(LIBMESH_DIM * n_qp_data);
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+      for (unsigned int e = 0; e < _n_elem; ++e)
+        std::copy_n(batch.gradU(e, d), _n_qp, &_host[d * n_qp_data + std::size_t(e) * _n_qp]);
+    Moose::Device::upload(_grad_u, _host);
+
+    _host.resize(n_shape_data);
+    for (unsigned int e = 0; e < _n_elem; ++e)
+      for (unsigned int i = 0; i < _n_dofs; ++i)
+        std::copy_n(batch.test(e, i), _n_qp, &_host[(std::size_t(e) * _n_dofs + i) * _n_qp]);
+    Moose::Device::upload(_test, _host);
+
+    _host.resize(LIBMESH_DIM * n_shape_data);
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+      for (unsigned int e = 0; e < _n_elem; ++e)
+        for (unsigned int i = 0; i < _n_dofs; ++i)
+          std::copy_n(batch.gradTest(e, i, d),
+                      _n_qp,
+                      &_host[d * n_shape_data + (std::size_t(e) * _n_dofs + i) * _n_qp]);
+    Moose::Device::upload(_grad_test, _host);
+
+    _dof_indices.assign(dof_indices.begin(), dof_indices.end());
+    Moose::Device::resize(_residual, std::size_t(_n_elem) * _n_dofs);
+    Moose::Device::resize(_jacobian, std::size_t(_n_elem) * _n_dofs * _n_dofs);
+    zeroOutputs();
+  }
+
+  /// Zeroes the residual and Jacobian on the device
+  void zeroOutputs()
+  {
+    Real * re = data(_residual);
+    Real * ke = data(_jacobian);
+    const std::size_t n_re = std::size_t(_n_elem) * _n_dofs;
+    Moose::Device::parallelFor(n_re * _n_dofs,
+                               MOOSE_DEVICE_LAMBDA(std::size_t i)
+                               {
+                                 ke[i] = 0;
+                                 if (i < n_re)
+                                   re[i] = 0;
+                               });
+  }
+
+  /**
+   * The global row and column of every Jacobian entry, element after element, for
+   * MatSetPreallocationCOO(); the residual entries use the rows of the diagonal entries
+   */
+  template <typename Index>
+  void cooIndices(std::vector<Index> & rows, std::vector<Index> & cols) const
+  {
+    rows.clear();
+    cols.clear();
+    for (unsigned int e = 0; e < _n_elem; ++e)
+      for (unsigned int i = 0; i < _n_dofs; ++i)
+        for (unsigned int j = 0; j < _n_dofs; ++j)
+        {
+          rows.push_back(_dof_indices[std::size_t(e) * _n_dofs + i]);
+          cols.push_back(_dof_indices[std::size_t(e) * _n_dofs + j]);
+        }
+  }
+
+  /// Copies the residual back to the host, nDofs() values per element
+  void downloadResidual(std::vector<Real> & residual) const
+  {
+    residual.resize(std::size_t(_n_elem) * _n_dofs);
+    Moose::Device::download(_residual, residual);
+  }
+
+  /// Copies the Jacobian back to the host, in the order of cooIndices()
+  void downloadJacobian(std::vector<Real> & jacobian) const
+  {
+    jacobian.resize(std::size_t(_n_elem) * _n_dofs * _n_dofs);
+    Moose::Device::download(_jacobian, jacobian);
+  }
+
+  ///@{ Sizes
+  unsigned int nElem() const { return _n_elem; }
+  unsigned int nQp() const { return _n_qp; }
+  unsigned int nDofs() const { return _n_dofs; }
+  Real duDotDu() const { return _du_dot_du; }
+  ///@}
+
+  ///@{ Device pointers to the arrays, to be captured by the device loops
+  const Real * JxW() const { return data(_JxW); }
+  const Real * u() const { return data(_u); }
+  const Real * uDot() const { return data(_u_dot); }
+  const Real * gradU() const { return data(_grad_u); }
+  const Real * test() const { return data(_test); }
+  const Real * gradTest() const { return data(_grad_test); }
+  Real * residual() { return data(_residual); }
+  Real * jacobian() { return data(_jacobian); }
+  ///@}
+
+private:
+  template <typename Get>
+  void copyQp(const ElementBatch & batch, const Get & get)
+  {
+    for (unsigned int e = 0; e < batch.nElem(); ++e)
+      std::copy_n(get(e), _n_qp, &_host[std::size_t(e) * _n_qp]);
+  }
+
+  template <typename A>
+  static auto data(A & array) -> decltype(array.data())
+  {
+    return array.data();
+  }
+
+  unsigned int _n_elem = 0;
+  unsigned int _n_qp = 0;
+  unsigned int _n_dofs = 0;
+  Real _du_dot_du = 0;
+
+  ///@{ Device arrays
+  Moose::Device::Array<Real> _JxW;
+  Moose::Device::Array<Real> _u;
+  Moose::Device::Array<Real> _u_dot;
+  Moose::Device::Array<Real> _grad_u;
+  Moose::Device::Array<Real> _test;
+  Moose::Device::Array<Real> _grad_test;
+  Moose::Device::Array<Real> _residual;
+  Moose::Device::Array<Real> _jacobian;
+  ///@}
+
+  /// The dof indices of the elements, on the host for the COO pattern
+  std::vector<dof_id_type> _dof_indices;
+
+  /// Host staging buffer
+  std::vector<Real> _host;
+};
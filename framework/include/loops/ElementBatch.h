@@ -0,0 +1,186 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+#include "MooseArray.h"
+
+#include "libmesh/elem.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+/**
+ * Structure-of-arrays staging buffer for a chunk of elements sharing the same element type,
+ * subdomain and quadrature rule.
+ *
+ * An element loop can gather the per-element data it would otherwise hand to each kernel one
+ * element at a time into the flat arrays below, so that kernels implementing
+ * BatchResidualInterface can compute the whole chunk in a single call with unit-stride inner
+ * loops over the quadrature points.
+ *
+ * Layout, with e the index of the element in the batch, i/j local dof indices and qp the
+ * quadrature point:
+ *   - per-qp data (JxW, u, grad_u): [e * n_qp + qp]
+ *   - shape data (test, grad_test):  [(e * n_dofs + i) * n_qp + qp]
+ *   - residual:                      [e * n_dofs + i]
+ *   - jacobian:                      [(e * n_dofs + i) * n_dofs + j]
+ *
+ * Gradients are stored component-wise, one array per spatial direction.
+ */
+class ElementBatch
+{
+public:
+  ElementBatch(unsigned int capacity = 16) : _capacity(capacity), _n_qp(0), _n_dofs(0) {}
+
+  /**
+   * Prepare the batch for a new chunk of elements with the given number of quadrature points and
+   * local dofs. Buffers are only reallocated when they need to grow.
+   */
+  void reset(unsigned int n_qp, unsigned int n_dofs)
+  {
+    _n_qp = n_qp;
+    _n_dofs = n_dofs;
+    _elems.clear();
+
+    const std::size_t n_qp_data = std::size_t(_capacity) * _n_qp;
+    const std::size_t n_shape_data = n_qp_data * _n_dofs;
+
+    _JxW.resize(n_qp_data);
+    _u.resize(n_qp_data);
+    _test.resize(n_shape_data);
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+      _grad_u[d].resize(n_qp_data);
+      _grad_test[d].resize(n_shape_data);
+    }
+    _residual.assign(std::size_t(_capacity) * _n_dofs, 0);
+    _jacobian.assign(std::size_t(_capacity) * _n_dofs * _n_dofs, 0);
+  }
+
+  /**
+   * Copy the data for the current element into the next free batch entry
+   * @return The index of the element in the batch
+   */
+  unsigned int addElement(const Elem * elem,
+                          const MooseArray<Real> & JxW,
+                          const MooseArray<Real> & coord,
+                          const VariableValue & u,
+                          const VariableGradient & grad_u,
+                          const VariableTestValue & test,
+                          const VariableTestGradient & grad_test)
+  {
+    mooseAssert(!full(), "ElementBatch capacity exceeded");
+    mooseAssert(JxW.size() == _n_qp, "Quadrature size mismatch in ElementBatch");
+    mooseAssert(test.size() == _n_dofs, "Dof count mismatch in ElementBatch");
+
+    const unsigned int e = _elems.size();
+    _elems.push_back(elem);
+
+    const std::size_t qp_offset = std::size_t(e) * _n_qp;
+    for (unsigned int qp = 0; qp < _n_qp; ++qp)
+    {
+      _JxW[qp_offset + qp] = JxW[qp] * coord[qp];
+      _u[qp_offset + qp] = u[qp];
+      for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        _grad_u[d][qp_offset + qp] = grad_u[qp](d);
+    }
+
+    for (unsigned int i = 0; i < _n_dofs; ++i)
+    {
+      const std::size_t shape_offset = (std::size_t(e) * _n_dofs + i) * _n_qp;
+      for (unsigned int qp = 0; qp < _n_qp; ++qp)
+      {
+        _test[shape_offset + qp] = test[i][qp];
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+          _grad_test[d][shape_offset + qp] = grad_test[i][qp](d);
+      }
+    }
+
+    return e;
+  }
+
+  /// Zero the residual and Jacobian outputs so that the batch can be reused for other kernels
+  void zeroOutputs()
+  {
+    std::fill(_residual.begin(), _residual.end(), 0);
+    std::fill(_jacobian.begin(), _jacobian.end(), 0);
+  }
+
+  ///@{ Batch sizes
+  unsigned int capacity() const { return _capacity; }
+  unsigned int nElem() const { return _elems.size(); }
+  unsigned int nQp() const { return _n_qp; }
+  unsigned int nDofs() const { return _n_dofs; }
+  bool full() const { return _elems.size() == _capacity; }
+  bool empty() const { return _elems.empty(); }
+  ///@}
+
+  /// The elements in the batch, in the order they were added
+  const std::vector<const Elem *> & elems() const { return _elems; }
+
+  ///@{ Per-qp inputs for element e (length nQp())
+  const Real * JxW(unsigned int e) const { return &_JxW[std::size_t(e) * _n_qp]; }
+  const Real * u(unsigned int e) const { return &_u[std::size_t(e) * _n_qp]; }
+  const Real * gradU(unsigned int e, unsigned int d) const
+  {
+    return &_grad_u[d][std::size_t(e) * _n_qp];
+  }
+  ///@}
+
+  ///@{ Per-qp shape function inputs for local dof i of element e (length nQp())
+  const Real * test(unsigned int e, unsigned int i) const
+  {
+    return &_test[(std::size_t(e) * _n_dofs + i) * _n_qp];
+  }
+  const Real * gradTest(unsigned int e, unsigned int i, unsigned int d) const
+  {
+    return &_grad_test[d][(std::size_t(e) * _n_dofs + i) * _n_qp];
+  }
+  ///@}
+
+  ///@{ Outputs for element e
+  Real * residual(unsigned int e) { return &_residual[std::size_t(e) * _n_dofs]; }
+  const Real * residual(unsigned int e) const { return &_residual[std::size_t(e) * _n_dofs]; }
+  Real * jacobian(unsigned int e) { return &_jacobian[std::size_t(e) * _n_dofs * _n_dofs]; }
+  const Real * jacobian(unsigned int e) const
+  {
+    return &_jacobian[std::size_t(e) * _n_dofs * _n_dofs];
+  }
+  ///@}
+
+private:
+  /// Maximum number of elements in the batch
+  const unsigned int _capacity;
+
+  /// Number of quadrature points per element
+  unsigned int _n_qp;
+
+  /// Number of local dofs per element
+  unsigned int _n_dofs;
+
+  /// The elements currently in the batch
+  std::vector<const Elem *> _elems;
+
+  ///@{ Flat input arrays, see the class documentation for the layout
+  std::vector<Real> _JxW;
+  std::vector<Real> _u;
+  std::array<std::vector<Real>, LIBMESH_DIM> _grad_u;
+  std::vector<Real> _test;
+  std::array<std::vector<Real>, LIBMESH_DIM> _grad_test;
+  ///@}
+
+  ///@{ Flat output arrays
+  std::vector<Real> _residual;
+  std::vector<Real> _jacobian;
+  ///@}
+};
@@ -0,0 +1,147 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/elem.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * Per-element cost estimates for the threaded element loops.
+ *
+ * ThreadedElementLoopBase records the wall time spent on every element into a per-thread sample
+ * buffer (see ThreadedElementLoopBase::setCostModel()). update() folds the samples of the last
+ * evaluation into an exponentially smoothed cost per element, and partition() uses those
+ * costs to cut an element sequence into chunks of roughly equal cost.
+ */
+class ElementLoopCostModel
+{
+public:
+  /**
+   * @param n_threads The number of threads that will record samples
+   * @param smoothing Weight of the newest sample in the smoothed cost, in (0, 1]
+   */
+  ElementLoopCostModel(unsigned int n_threads, Real smoothing = 0.5)
+    : _samples(n_threads), _smoothing(smoothing), _mean_cost(1)
+  {
+    if (smoothing <= 0 || smoothing > 1)
+      mooseError("ElementLoopCostModel smoothing must be in (0, 1]");
+  }
+
+  /// Record the cost of an element. Thread safe as long as each thread passes its own id.
+  void record(THREAD_ID tid, dof_id_type elem_id, Real cost)
+  {
+    mooseAssert(tid < _samples.size(), "Thread id exceeds the thread count of the cost model");
+    _samples[tid].emplace_back(elem_id, cost);
+  }
+
+  /// Fold the recorded samples into the element costs. Not thread safe.
+  void update()
+  {
+    Real total = 0;
+    std::size_t n_known = 0;
+
+    for (auto & thread_samples : _samples)
+    {
+      for (const auto & sample : thread_samples)
+      {
+        if (sample.first >= _cost.size())
+          _cost.resize(sample.first + 1, 0);
+
+        auto & cost = _cost[sample.first];
+        cost = cost > 0 ? _smoothing * sample.second + (1 - _smoothing) * cost : sample.second;
+      }
+      thread_samples.clear();
+    }
+
+    for (const auto cost : _cost)
+      if (cost > 0)
+      {
+        total += cost;
+        ++n_known;
+      }
+
+    if (n_known)
+      _mean_cost = total / n_known;
+  }
+
+  /// Forget all costs, e.g. after the mesh changed
+  void clear()
+  {
+    _cost.clear();
+    for (auto & thread_samples : _samples)
+      thread_samples.clear();
+    _mean_cost = 1;
+  }
+
+  /// The estimated cost of an element; elements without samples get the mean cost
+  Real cost(dof_id_type elem_id) const
+  {
+    return (elem_id < _cost.size() && _cost[elem_id] > 0) ? _cost[elem_id] : _mean_cost;
+  }
+
+  /// Whether or not any costs have been measured
+  bool hasCosts() const { return !_cost.empty(); }
+
+  /**
+   * Split the element sequence [begin, end) into at most n_chunks contiguous chunks of roughly
+   * equal estimated cost.
+   *
+   * @return The chunk boundaries as offsets from begin; chunk c is [bounds[c], bounds[c + 1])
+   */
+  template <typename ElemIterator>
+  std::vector<std::size_t>
+  partition(ElemIterator begin, ElemIterator end, std::size_t n_chunks) const
+  {
+    const std::size_t n_elem = std::distance(begin, end);
+    n_chunks = std::max(std::size_t(1), std::min(n_chunks, n_elem));
+
+    Real total = 0;
+    for (auto it = begin; it != end; ++it)
+      total += cost((*it)->id());
+
+    std::vector<std::size_t> bounds(1, 0);
+    bounds.reserve(n_chunks + 1);
+
+    const Real target = total / n_chunks;
+    Real accumulated = 0;
+    std::size_t offset = 0;
+    for (auto it = begin; it != end; ++it, ++offset)
+    {
+      accumulated += cost((*it)->id());
+      // Close the chunk once it reaches its share, leaving at least one element per later chunk
+      if (accumulated >= target * bounds.size() && bounds.size() < n_chunks &&
+          n_elem - offset - 1 >= n_chunks - bounds.size())
+        bounds.push_back(offset + 1);
+    }
+    bounds.push_back(n_elem);
+
+    return bounds;
+  }
+
+private:
+  /// Samples recorded during the current evaluation, per thread
+  std::vector<std::vector<std::pair<dof_id_type, Real>>> _samples;
+
+  /// Smoothed cost of each element, indexed by element id (0 if never measured)
+  std::vector<Real> _cost;
+
+  /// Weight of the newest sample
+  const Real _smoothing;
+
+  /// Mean of the measured costs, used for elements that were never measured
+  Real _mean_cost;
+};
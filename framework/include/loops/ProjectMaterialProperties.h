@@ -20,6 +20,13 @@ class MaterialPropertyStorage;
 class MaterialData;
 class Assembly;
 
+/**
+ * Prolongs (refine) or restricts (coarsen) the stateful material properties of the elements
+ * changed by adaptivity, in a threaded loop over the refined or coarsened parents. The storage of
+ * the elements written to is created beforehand (MaterialPropertyStorage::prepareProjection()),
+ * so that the threads only look elements up, and the coarsened children are erased after the loop
+ * (MaterialPropertyStorage::eraseAfterProjection()).
+ */
 class ProjectMaterialProperties : public ThreadedElementLoop<ConstElemPointerRange>
 {
 public:
@@ -48,6 +55,13 @@ public:
 
   void join(const ProjectMaterialProperties & /*y*/);
 
+  /**
+   * The elements the projection of a range writes stateful properties to, for
+   * MaterialPropertyStorage::prepareProjection(): the children of the refined elements, or the
+   * coarsened parents themselves
+   */
+  static std::vector<const Elem *> projectedElems(const ConstElemPointerRange & range, bool refine);
+
 protected:
   /// Whether or not you are projecting refinements.  Set to false for coarsening.
   bool _refine;
@@ -64,4 +78,10 @@ protected:
   const MaterialWarehouse & _materials;
   /// Discrete materials warehouse
   const MaterialWarehouse & _discrete_materials;
+
+  /**
+   * Whether the values are only copied between the nearest qps, without reinitializing the
+   * elements or their materials (FEProblemBase::setFastStatefulProjection())
+   */
+  const bool _fast;
 };
@@ -61,6 +61,7 @@ template <typename RangeType>
 ThreadedElementLoop<RangeType>::ThreadedElementLoop(FEProblemBase & fe_problem)
   : ThreadedElementLoopBase<RangeType>(fe_problem.mesh()), _fe_problem(fe_problem)
 {
+  this->setThreadTiming(fe_problem.getMooseApp().perfGraph().threadTiming());
 }
 
 template <typename RangeType>
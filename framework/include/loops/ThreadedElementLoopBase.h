@@ -13,9 +13,14 @@
 #include "MooseMesh.h"
 #include "MooseTypes.h"
 #include "MooseException.h"
+#include "ElementLoopCostModel.h"
+#include "ThreadTimingTable.h"
 #include "libmesh/libmesh_exceptions.h"
 #include "libmesh/elem.h"
 
+#include <chrono>
+#include <typeinfo>
+
 /**
  * Base class for assembly-like calculations.
  */
@@ -31,6 +36,25 @@ public:
 
   virtual void operator()(const RangeType & range, bool bypass_threading = false);
 
+  /**
+   * Execute the loop over an arbitrary sequence of elements, e.g. a chunk handed out by
+   * Moose::parallelReduceWorkStealing(). This is what operator() does on its range.
+   */
+  template <typename ElemIterator>
+  void executeElements(ElemIterator begin, ElemIterator end, bool bypass_threading = false);
+
+  /**
+   * Record the wall time spent on each element (including its sides) into the given cost model,
+   * which can then be used to balance the next evaluation. Pass nullptr to stop recording.
+   */
+  void setCostModel(ElementLoopCostModel * cost_model) { _cost_model = cost_model; }
+
+  /**
+   * Record the wall time each thread spends in this loop into the given table, under the name of
+   * the loop class. Pass nullptr to stop recording.
+   */
+  void setThreadTiming(ThreadTimingTable * thread_timing) { _thread_timing = thread_timing; }
+
   /**
    * Called before the element range loop
    */
@@ -165,17 +189,24 @@ protected:
 
   /// The subdomain for the last neighbor
   SubdomainID _old_neighbor_subdomain;
+
+  /// Where to record per-element costs, if anywhere
+  ElementLoopCostModel * _cost_model;
+
+  /// Where to record the per-thread loop time, if anywhere
+  ThreadTimingTable * _thread_timing;
 };
 
 template <typename RangeType>
-ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh) : _mesh(mesh)
+ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh)
+  : _mesh(mesh), _cost_model(nullptr), _thread_timing(nullptr)
 {
 }
 
 template <typename RangeType>
 ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(ThreadedElementLoopBase & x,
                                                             Threads::split /*split*/)
-  : _mesh(x._mesh)
+  : _mesh(x._mesh), _cost_model(x._cost_model), _thread_timing(x._thread_timing)
 {
 }
 
@@ -187,6 +218,16 @@ ThreadedElementLoopBase<RangeType>::~ThreadedElementLoopBase()
 template <typename RangeType>
 void
 ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool bypass_threading)
+{
+  executeElements(range.begin(), range.end(), bypass_threading);
+}
+
+template <typename RangeType>
+template <typename ElemIterator>
+void
+ThreadedElementLoopBase<RangeType>::executeElements(ElemIterator begin,
+                                                    ElemIterator end,
+                                                    bool bypass_threading)
 {
   try
   {
@@ -195,18 +236,23 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
       ParallelUniqueId puid;
       _tid = bypass_threading ? 0 : puid.id;
 
+      const auto loop_start = _thread_timing ? std::chrono::steady_clock::now()
+                                             : std::chrono::steady_clock::time_point();
+
       pre();
 
       _subdomain = Moose::INVALID_BLOCK_ID;
       _neighbor_subdomain = Moose::INVALID_BLOCK_ID;
-      typename RangeType::const_iterator el = range.begin();
-      for (el = range.begin(); el != range.end(); ++el)
+      for (auto el = begin; el != end; ++el)
       {
         if (!keepGoing())
           break;
 
         const Elem * elem = *el;
 
+        const auto start = _cost_model ? std::chrono::steady_clock::now()
+                                       : std::chrono::steady_clock::time_point();
+
         preElement(elem);
 
         _old_subdomain = _subdomain;
@@ -253,9 +299,21 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
         } // sides
         postElement(elem);
 
+        if (_cost_model)
+          _cost_model->record(
+              _tid,
+              elem->id(),
+              std::chrono::duration<Real>(std::chrono::steady_clock::now() - start).count());
+
       } // range
 
       post();
+
+      if (_thread_timing)
+        _thread_timing->add(
+            demangle(typeid(*this).name()),
+            _tid,
+            std::chrono::duration<Real>(std::chrono::steady_clock::now() - loop_start).count());
     }
     catch (libMesh::LogicError & e)
     {
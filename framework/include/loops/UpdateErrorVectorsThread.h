@@ -38,5 +38,12 @@ protected:
   NumericVector<Number> & _solution;
 
   std::map<unsigned int, ErrorVector *> _indicator_field_number_to_error_vector;
+
+  /**
+   * The indicator fields and their error vectors, flattened from the map above so that each
+   * element visits a contiguous list without the per-element tree lookups; the threads write to
+   * the entries of their own elements only, so the error vectors are shared without locking
+   */
+  std::vector<std::pair<unsigned int, ErrorVector *>> _error_vectors;
 };
 
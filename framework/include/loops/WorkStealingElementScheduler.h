@@ -0,0 +1,160 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementLoopCostModel.h"
+
+#include "libmesh/threads.h"
+#include "libmesh/elem_range.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace Moose
+{
+
+/**
+ * A double-ended queue of chunk indices per worker. A worker pops from the front of its own
+ * queue and, once that is empty, steals from the back of the queues of the other workers.
+ */
+class WorkStealingQueues
+{
+public:
+  /**
+   * Deal n_chunks chunks to n_workers workers in contiguous blocks, so that each worker starts
+   * out on neighboring elements.
+   */
+  WorkStealingQueues(unsigned int n_workers, std::size_t n_chunks) : _queues(n_workers)
+  {
+    for (std::size_t c = 0; c < n_chunks; ++c)
+      _queues[c * n_workers / n_chunks].chunks.push_back(c);
+  }
+
+  /**
+   * Get the next chunk for the given worker
+   * @return false if there is no work left anywhere
+   */
+  bool next(unsigned int worker, std::size_t & chunk)
+  {
+    {
+      auto & own = _queues[worker];
+      libMesh::Threads::spin_mutex::scoped_lock lock(own.mutex);
+      if (!own.chunks.empty())
+      {
+        chunk = own.chunks.front();
+        own.chunks.pop_front();
+        return true;
+      }
+    }
+
+    for (std::size_t i = 1; i < _queues.size(); ++i)
+    {
+      auto & victim = _queues[(worker + i) % _queues.size()];
+      libMesh::Threads::spin_mutex::scoped_lock lock(victim.mutex);
+      if (!victim.chunks.empty())
+      {
+        chunk = victim.chunks.back();
+        victim.chunks.pop_back();
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+private:
+  struct Queue
+  {
+    std::deque<std::size_t> chunks;
+    libMesh::Threads::spin_mutex mutex;
+  };
+
+  std::vector<Queue> _queues;
+};
+
+/**
+ * Threaded body for parallelReduceWorkStealing(): each index in the range is a worker that keeps
+ * executing chunks until no work is left, then joins its result into the master body.
+ */
+template <typename Body>
+class WorkStealingWorker
+{
+public:
+  WorkStealingWorker(Body & body,
+                     const std::vector<const Elem *> & elems,
+                     const std::vector<std::size_t> & bounds,
+                     WorkStealingQueues & queues,
+                     libMesh::Threads::spin_mutex & join_mutex)
+    : _body(body), _elems(elems), _bounds(bounds), _queues(queues), _join_mutex(join_mutex)
+  {
+  }
+
+  void operator()(const libMesh::Threads::BlockedRange<unsigned int> & workers) const
+  {
+    for (unsigned int worker = workers.begin(); worker != workers.end(); ++worker)
+    {
+      Body local(_body, libMesh::Threads::split());
+
+      std::size_t chunk;
+      while (_queues.next(worker, chunk))
+        local.executeElements(_elems.begin() + _bounds[chunk], _elems.begin() + _bounds[chunk + 1]);
+
+      libMesh::Threads::spin_mutex::scoped_lock lock(_join_mutex);
+      _body.join(local);
+    }
+  }
+
+private:
+  Body & _body;
+  const std::vector<const Elem *> & _elems;
+  const std::vector<std::size_t> & _bounds;
+  WorkStealingQueues & _queues;
+  /// Shared by every copy of the worker that the threading library may make
+  libMesh::Threads::spin_mutex & _join_mutex;
+};
+
+/**
+ * Drop-in replacement for Threads::parallel_reduce(range, body) for ThreadedElementLoop bodies
+ * (ComputeResidualThread, ComputeJacobianThread, ComputeMaterialsObjectThread,
+ * ComputeUserObjectsThread, ...) that balances the threads dynamically.
+ *
+ * The range is cut into chunks_per_thread chunks per thread of roughly equal cost according to
+ * the cost model (equal element counts if no costs have been measured yet), and the chunks are
+ * scheduled with work stealing so that threads that finish early help out the slow ones.
+ */
+template <typename Body>
+void
+parallelReduceWorkStealing(const ConstElemRange & range,
+                           Body & body,
+                           const ElementLoopCostModel & cost_model,
+                           unsigned int chunks_per_thread = 4)
+{
+  const unsigned int n_workers = libMesh::n_threads();
+
+  std::vector<const Elem *> elems(range.begin(), range.end());
+  if (n_workers == 1)
+  {
+    body.executeElements(elems.begin(), elems.end());
+    return;
+  }
+
+  const auto bounds = cost_model.partition(
+      elems.begin(), elems.end(), std::size_t(n_workers) * std::max(chunks_per_thread, 1u));
+
+  WorkStealingQueues queues(n_workers, bounds.size() - 1);
+  libMesh::Threads::spin_mutex join_mutex;
+  WorkStealingWorker<Body> worker(body, elems, bounds, queues, join_mutex);
+
+  libMesh::Threads::parallel_for(libMesh::Threads::BlockedRange<unsigned int>(0, n_workers, 1),
+                                 worker);
+}
+}
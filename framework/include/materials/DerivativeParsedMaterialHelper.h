@@ -10,6 +10,8 @@
 #pragma once
 
 #include "ParsedMaterialHelper.h"
+#include "FusedJITFunction.h"
+
 #include "libmesh/fparser_ad.hh"
 
 #define usingDerivativeParsedMaterialHelperMembers(T)                                              \
@@ -42,6 +44,13 @@ protected:
   void initQpStatefulProperties() override;
   void computeQpProperties() override;
 
+  /**
+   * With the fused JIT, stages the variables of all the quadrature points of the element into
+   * _batch_params and evaluates the function and the derivatives in one batched call, otherwise
+   * loops over computeQpProperties()
+   */
+  virtual void computeProperties() override;
+
   void functionsPostParse() override;
   void assembleDerivatives();
 
@@ -63,6 +72,20 @@ protected:
   /// next available variable number for automatically created material property derivative variables
   unsigned int _dmatvar_index;
 
+  /**
+   * With _enable_fused_jit, the function and all the derivatives compiled together, so that
+   * computeQpProperties() makes a single native call per quadrature point
+   */
+  std::unique_ptr<FusedJITFunction<SymFunction, GenericReal<is_ad>>> _fused_jit;
+  /// The outputs of _fused_jit: the function, then the derivatives in the order of _derivatives
+  std::vector<GenericReal<is_ad>> _fused_results;
+
+  ///@{ The structure-of-arrays inputs and outputs of the batched evaluation, by variable (output)
+  /// then quadrature point
+  std::vector<GenericReal<is_ad>> _batch_params;
+  std::vector<GenericReal<is_ad>> _batch_results;
+  ///@}
+
 private:
   // for bulk registration of material property derivatives
   std::vector<MaterialPropertyDerivativeRule> _bulk_rules;
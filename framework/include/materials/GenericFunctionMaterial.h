@@ -52,10 +52,15 @@ protected:
 
 private:
   /**
-   * A helper method for evaluating the functions
+   * A helper method for evaluating the functions: the first quadrature point evaluates each
+   * function at all the points of the element at once (Function::values), and each point then
+   * reads its values
    */
   void computeQpFunctions();
 
+  /// The values of each function at the quadrature points of the current element
+  std::vector<std::vector<Real>> _function_values;
+
   /// Flag for calling declareProperyOld/Older
   bool _enable_stateful;
 };
@@ -13,6 +13,8 @@
 #include "MaterialBase.h"
 #include "Coupleable.h"
 #include "MaterialPropertyInterface.h"
+#include "MaterialMemo.h"
+#include "NeighborMaterialCache.h"
 
 // forward declarations
 class Material;
@@ -173,6 +175,24 @@ protected:
   /// Options of the constantness level of the material
   const ConstantTypeEnum _constant_option;
 
+  /**
+   * Whether the properties are memoized (the "memoize" parameter): computeProperties() copies
+   * back the values computed on the same element for the same solution (see
+   * FEProblemBase::solutionVersion()) instead of computing them, so the Jacobian evaluation of a
+   * Newton iterate reuses those of its residual evaluation. Only for pure materials: no stateful
+   * or AD properties, properties depending on nothing but the solution and the element.
+   */
+  const bool _memoize;
+
+  /// The values recorded for memoization
+  MaterialMemo _memo;
+
+  /**
+   * The values of a neighbor material constant on elements, per neighbor element: the faces of a
+   * neighbor element after the first copy them in computeProperties() instead of computing them
+   */
+  NeighborMaterialCache _neighbor_cache;
+
 private:
   ConstantTypeEnum computeConstantOption();
 
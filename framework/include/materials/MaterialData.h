@@ -40,6 +40,19 @@ public:
    */
   void resize(unsigned int n_qpoints);
 
+  /**
+   * Makes the properties able to hold n_qpoints values without allocating, so that switching
+   * between quadrature rules (element types, volume and side rules) never reallocates them;
+   * FEProblemBase reserves the largest quadrature size of the problem once the properties are
+   * declared.
+   */
+  void reserve(unsigned int n_qpoints)
+  {
+    _props.reserveItems(n_qpoints);
+    _props_old.reserveItems(n_qpoints);
+    _props_older.reserveItems(n_qpoints);
+  }
+
   /**
    * Returns the number of quadrature points the material properties
    * support/hold.
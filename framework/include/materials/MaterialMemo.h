@@ -0,0 +1,103 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MaterialProperty.h"
+#include "MooseHashing.h"
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * The property values a material computed on each element (side) for one solution state, so that
+ * a later evaluation on the same state copies them back instead of computing them again: the
+ * Jacobian evaluation of a Newton iterate then reuses the values of its residual evaluation.
+ *
+ * This is only correct for materials whose properties depend on nothing but the solution and the
+ * element (no stateful properties, no side effects, no dependence on the residual/Jacobian
+ * type). The values are kept for one solution version: a new version drops them all.
+ */
+class MaterialMemo
+{
+public:
+  /**
+   * Sets the solution version the evaluations are for, dropping the values recorded for
+   * another version
+   */
+  void setVersion(unsigned long version)
+  {
+    if (version == _version)
+      return;
+    _version = version;
+    _values.clear();
+  }
+
+  /**
+   * Copies the recorded values of an element (side) into the properties
+   * @param props The properties of the material data, sized for the current quadrature rule
+   * @param prop_ids The ids of the properties of the material
+   * @return Whether values were recorded for the element (side) and quadrature size
+   */
+  bool restore(const Elem * elem,
+               unsigned int side,
+               MaterialProperties & props,
+               const std::set<unsigned int> & prop_ids)
+  {
+    const auto it = _values.find(std::make_pair(elem, side));
+    if (it == _values.end() || it->second.first != numPoints(props, prop_ids))
+    {
+      ++_misses;
+      return false;
+    }
+
+    std::istringstream stream(it->second.second);
+    for (const auto id : prop_ids)
+      props[id]->load(stream);
+    ++_hits;
+    return true;
+  }
+
+  /// Records the values of the properties computed on an element (side)
+  void record(const Elem * elem,
+              unsigned int side,
+              MaterialProperties & props,
+              const std::set<unsigned int> & prop_ids)
+  {
+    std::ostringstream stream;
+    for (const auto id : prop_ids)
+      props[id]->store(stream);
+    _values[std::make_pair(elem, side)] = std::make_pair(numPoints(props, prop_ids), stream.str());
+  }
+
+  ///@{ The number of evaluations copied back and of those that had to be computed
+  unsigned long hits() const { return _hits; }
+  unsigned long misses() const { return _misses; }
+  ///@}
+
+private:
+  /// The quadrature size of the properties, which store() and load() depend on
+  static unsigned int numPoints(const MaterialProperties & props,
+                                const std::set<unsigned int> & prop_ids)
+  {
+    return prop_ids.empty() ? 0 : props[*prop_ids.begin()]->size();
+  }
+
+  unsigned long _version = 0;
+
+  /// The quadrature size and stored values of each element (side)
+  std::unordered_map<std::pair<const Elem *, unsigned int>, std::pair<unsigned int, std::string>>
+      _values;
+
+  unsigned long _hits = 0;
+  unsigned long _misses = 0;
+};
@@ -52,11 +52,21 @@ public:
 
   virtual unsigned int size() const = 0;
 
+  /**
+   * The estimated number of bytes held by the property values (see MemoryAccounting)
+   */
+  virtual std::size_t memoryBytes() const { return 0; }
+
   /**
    * Resizes the property to the size n
    */
   virtual void resize(int n) = 0;
 
+  /**
+   * Makes the property able to hold n values without allocating, see MooseArray::reserve()
+   */
+  virtual void reserve(int /*n*/) {}
+
   virtual void swap(PropertyValue * rhs) = 0;
 
   virtual bool isAD() = 0;
@@ -145,8 +155,15 @@ public:
    */
   virtual void resize(int n) override;
 
+  virtual void reserve(int n) override { _value.reserve(n); }
+
   virtual unsigned int size() const override { return _value.size(); }
 
+  virtual std::size_t memoryBytes() const override
+  {
+    return sizeof(*this) + _value.size() * sizeof(MooseADWrapper<T, is_ad>);
+  }
+
   /**
    * Get element i out of the array as a writeable reference.
    */
@@ -430,6 +447,28 @@ public:
       if (*k != NULL)
         (*k)->resize(n_qpoints);
   }
+
+  /**
+   * The estimated number of bytes held by the properties (see MemoryAccounting)
+   */
+  std::size_t memoryBytes() const
+  {
+    std::size_t bytes = capacity() * sizeof(PropertyValue *);
+    for (const_iterator k = begin(); k != end(); ++k)
+      if (*k != NULL)
+        bytes += (*k)->memoryBytes();
+    return bytes;
+  }
+
+  /**
+   * Makes the items able to hold n_qpoints values without allocating
+   */
+  void reserveItems(unsigned int n_qpoints)
+  {
+    for (iterator k = begin(); k != end(); ++k)
+      if (*k != NULL)
+        (*k)->reserve(n_qpoints);
+  }
 };
 
 template <>
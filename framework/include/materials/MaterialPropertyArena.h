@@ -0,0 +1,304 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MaterialProperty.h"
+
+#include "libmesh/elem.h"
+#include "libmesh/threads.h"
+
+#include <array>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Flat, element-indexed storage for stateful material properties.
+ *
+ * This is an alternative to the nested (element, side) hash maps held by MaterialPropertyStorage.
+ * Every element storing properties on this processor is given a contiguous block of side slots
+ * the first time it is requested, so a lookup is a single hash lookup of the element instead of
+ * two nested ones, and the memory only grows with the local (and ghosted) elements. The
+ * current/old/older states live in three buffers that share the slot numbering; shift() only
+ * rotates which buffer plays which role, so no property data is touched or copied.
+ *
+ * The buffers are deques so that references handed out by props() stay valid while other threads
+ * create new slots; the lookups and the growth of the buffers are done under the same lock.
+ *
+ * Thread-safe
+ */
+class MaterialPropertyArena
+{
+public:
+  /// The time states stored in the arena
+  enum State
+  {
+    CURRENT = 0,
+    OLD = 1,
+    OLDER = 2
+  };
+
+  MaterialPropertyArena() : _n_sides(1), _n_slots(0), _buffer({{CURRENT, OLD, OLDER}}) {}
+
+  /**
+   * Set the number of side slots reserved per element.  Must be called before any slot is
+   * created.
+   */
+  void setNumSides(unsigned int n_sides)
+  {
+    if (_n_slots)
+      mooseError("MaterialPropertyArena::setNumSides() must be called before slots are created");
+    _n_sides = n_sides ? n_sides : 1;
+  }
+
+  /// Reserves the lookup table for \p n_elems elements, e.g. the local and ghosted elements
+  void reserve(std::size_t n_elems)
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    _elem_to_offset.reserve(n_elems);
+  }
+
+  /**
+   * The properties for the given element, side and state. The slot is created if it does not
+   * exist yet.
+   */
+  MaterialProperties & props(const Elem * elem, unsigned int side, State state)
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _states[_buffer[state]][slot(elem, side)];
+  }
+
+  /**
+   * Whether or not slots have been created for the given element
+   */
+  bool hasElem(const Elem * elem) const
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _elem_to_offset.count(elem);
+  }
+
+  /**
+   * Rotate the states: old becomes older, current becomes old and the older buffer is reused for
+   * computing current properties. This is O(1) regardless of the number of stored properties.
+   *
+   * @param has_older Whether or not older properties are stored. If not, only current and old
+   *                  are exchanged.
+   */
+  void shift(bool has_older)
+  {
+    if (has_older)
+    {
+      const auto older = _buffer[OLDER];
+      _buffer[OLDER] = _buffer[OLD];
+      _buffer[OLD] = _buffer[CURRENT];
+      _buffer[CURRENT] = older;
+    }
+    else
+      std::swap(_buffer[CURRENT], _buffer[OLD]);
+  }
+
+  /**
+   * Release the properties associated with an element. The freed slots are reused by the next
+   * element that is added.
+   */
+  void erase(const Elem * elem)
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+
+    const auto it = _elem_to_offset.find(elem);
+    if (it == _elem_to_offset.end())
+      return;
+
+    const auto offset = it->second;
+    for (auto & state : _states)
+      for (unsigned int side = 0; side < _n_sides; ++side)
+      {
+        auto & mp = state[offset + side];
+        mp.destroy();
+        mp.clear();
+      }
+
+    _elem_to_offset.erase(it);
+    _free_offsets.push_back(offset);
+  }
+
+  /**
+   * Release all of the stored properties
+   */
+  void clear()
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+
+    for (auto & state : _states)
+    {
+      for (auto & mp : state)
+        mp.destroy();
+      state.clear();
+    }
+
+    _elem_to_offset.clear();
+    _free_offsets.clear();
+    _n_slots = 0;
+  }
+
+  /// The elements that have slots
+  std::vector<const Elem *> elems() const
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    std::vector<const Elem *> elems;
+    elems.reserve(_elem_to_offset.size());
+    for (const auto & pair : _elem_to_offset)
+      elems.push_back(pair.first);
+    return elems;
+  }
+
+  /**
+   * Calls \p fn(elem_id, side, properties) on every slot in use for the given state, in
+   * unspecified order
+   */
+  template <typename Function>
+  void forEachSlot(State state, Function && fn)
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    auto & buffer = _states[_buffer[state]];
+    for (const auto & pair : _elem_to_offset)
+      for (unsigned int side = 0; side < _n_sides; ++side)
+        fn(pair.first->id(), side, buffer[pair.second + side]);
+  }
+
+  /**
+   * Writes the properties of a state in the format of the (element, side) hash maps of
+   * MaterialPropertyStorage, leaving out the sides without properties, so that restart files
+   * written with and without the arena can be read either way
+   */
+  void store(std::ostream & stream, State state, void * context)
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+    auto & buffer = _states[_buffer[state]];
+
+    unsigned int n_elems = _elem_to_offset.size();
+    stream.write((char *)&n_elems, sizeof(n_elems));
+    for (const auto & pair : _elem_to_offset)
+    {
+      const Elem * elem = pair.first;
+      dataStore(stream, elem, context);
+
+      unsigned int n_sides = 0;
+      for (unsigned int side = 0; side < _n_sides; ++side)
+        if (!buffer[pair.second + side].empty())
+          ++n_sides;
+      stream.write((char *)&n_sides, sizeof(n_sides));
+
+      for (unsigned int side = 0; side < _n_sides; ++side)
+        if (!buffer[pair.second + side].empty())
+        {
+          unsigned int stored_side = side;
+          dataStore(stream, stored_side, context);
+          dataStore(stream, buffer[pair.second + side], context);
+        }
+    }
+  }
+
+  /**
+   * Reads the properties of a state written by store(), or by the hash maps, into the slots of
+   * their elements, which must already hold their initialized properties
+   */
+  void load(std::istream & stream, State state, void * context)
+  {
+    unsigned int n_elems = 0;
+    stream.read((char *)&n_elems, sizeof(n_elems));
+    for (unsigned int e = 0; e < n_elems; ++e)
+    {
+      const Elem * elem = nullptr;
+      dataLoad(stream, elem, context);
+
+      unsigned int n_sides = 0;
+      stream.read((char *)&n_sides, sizeof(n_sides));
+      for (unsigned int i = 0; i < n_sides; ++i)
+      {
+        unsigned int side = 0;
+        dataLoad(stream, side, context);
+        if (!elem || side >= _n_sides)
+          mooseError("The stateful material properties being loaded do not fit the arena");
+        dataLoad(stream, props(elem, side, state), context);
+      }
+    }
+  }
+
+  /// The number of slots currently allocated for each state (including released ones)
+  std::size_t numSlots() const { return _n_slots; }
+
+  /// The number of side slots reserved per element
+  unsigned int numSides() const { return _n_sides; }
+
+  /// The estimated number of bytes held by the arena and its properties (see MemoryAccounting)
+  std::size_t memoryBytes() const
+  {
+    std::size_t bytes = _elem_to_offset.bucket_count() * sizeof(void *) +
+                        _elem_to_offset.size() * (sizeof(const Elem *) + 2 * sizeof(std::size_t)) +
+                        _free_offsets.capacity() * sizeof(std::size_t);
+    for (const auto & state : _states)
+      for (const auto & props : state)
+        bytes += sizeof(MaterialProperties) + props.memoryBytes();
+    return bytes;
+  }
+
+private:
+  /**
+   * Index of the (element, side) pair in the state buffers, creating the slots when necessary.
+   * Must be called with _mutex held.
+   */
+  std::size_t slot(const Elem * elem, unsigned int side)
+  {
+    mooseAssert(side < _n_sides, "Side " << side << " exceeds the arena side count");
+
+    const auto inserted = _elem_to_offset.emplace(elem, 0);
+    auto & offset = inserted.first->second;
+    if (inserted.second)
+    {
+      if (_free_offsets.empty())
+      {
+        offset = _n_slots;
+        _n_slots += _n_sides;
+        for (auto & state : _states)
+          state.resize(_n_slots);
+      }
+      else
+      {
+        offset = _free_offsets.back();
+        _free_offsets.pop_back();
+      }
+    }
+
+    return offset + side;
+  }
+
+  /// Number of side slots per element
+  unsigned int _n_sides;
+
+  /// Total number of slots in each of the state buffers
+  std::size_t _n_slots;
+
+  /// Offset of the first slot of each element
+  std::unordered_map<const Elem *, std::size_t> _elem_to_offset;
+
+  /// Offsets released by erase() that can be handed to new elements
+  std::vector<std::size_t> _free_offsets;
+
+  /// The property buffers; which one holds which state is given by _buffer
+  std::array<std::deque<MaterialProperties>, 3> _states;
+
+  /// Map from the logical state to the physical buffer
+  std::array<unsigned int, 3> _buffer;
+
+  /// Protects the lookups, the creation and the release of the slots
+  mutable libMesh::Threads::spin_mutex _mutex;
+};
@@ -12,7 +12,15 @@
 #include "Moose.h"
 #include "HashMap.h"
 #include "DataIO.h"
+#include "RestartableData.h"
 #include "MaterialProperty.h"
+#include "MaterialPropertyArena.h"
+#include "MemoryUtils.h"
+
+#include "libmesh/threads.h"
+
+#include <array>
+#include <functional>
 
 // Forward declarations
 class MaterialBase;
@@ -103,6 +111,70 @@ public:
                              const Elem & elem,
                              int input_side = -1);
 
+  /**
+   * The fast prolongation of ProjectMaterialProperties: copies to each qp of a child the stateful
+   * values of the parent qp it maps to, in every state, without reinitializing the child or
+   * calling its materials (unlike prolongStatefulProps(), which sizes the child storage through
+   * the material data of the child)
+   * @param child_map The qp maps of the child (QpMap::_to being the parent qp), from the tables
+   *                  MooseMesh builds once per element type (MooseMesh::getRefinementMap())
+   * @param parent_material_props The storage of the parent values
+   * @param parent The refined element
+   * @param parent_side The side of the parent (0 for volumetric material properties)
+   * @param child The child
+   * @param child_side The side of the child (0 for volumetric material properties)
+   */
+  template <typename QpMaps>
+  void copyStatefulPropsToChild(const QpMaps & child_map,
+                                MaterialPropertyStorage & parent_material_props,
+                                const Elem & parent,
+                                unsigned int parent_side,
+                                const Elem & child,
+                                unsigned int child_side)
+  {
+    const unsigned int n_qp = child_map.size();
+    const unsigned int n_states = _has_older_prop ? 3 : 2;
+    for (unsigned int state = 0; state < n_states; ++state)
+    {
+      auto & from = parent_material_props.stateProps(state, &parent, parent_side);
+      auto & to = stateProps(state, &child, child_side);
+      sizeLike(from, to, n_qp);
+      for (unsigned int qp = 0; qp < n_qp; ++qp)
+        copyQp(from, child_map[qp]._to, to, qp);
+    }
+  }
+
+  /**
+   * The fast restriction of ProjectMaterialProperties: copies to each qp of a coarsened parent the
+   * stateful values of the child qp it maps to, without calling the materials of the parent
+   * @param coarsening_map The child and child qp of each parent qp, from
+   *                       MooseMesh::getCoarseningMap()
+   * @param children The children of the parent, in Elem::child() order
+   * @param parent The coarsened parent
+   * @param side The side of the parent (0 for volumetric material properties)
+   */
+  template <typename CoarseningMap>
+  void copyStatefulPropsFromChildren(const CoarseningMap & coarsening_map,
+                                     const std::vector<const Elem *> & children,
+                                     const Elem & parent,
+                                     unsigned int side)
+  {
+    const unsigned int n_qp = coarsening_map.size();
+    const unsigned int n_states = _has_older_prop ? 3 : 2;
+    for (unsigned int state = 0; state < n_states; ++state)
+    {
+      auto & to = stateProps(state, &parent, side);
+      for (unsigned int qp = 0; qp < n_qp; ++qp)
+      {
+        const auto & child_qp = coarsening_map[qp];
+        auto & from = stateProps(state, children[child_qp.first], side);
+        if (qp == 0)
+          sizeLike(from, to, n_qp);
+        copyQp(from, child_qp.second._to, to, qp);
+      }
+    }
+  }
+
   /**
    * Initialize stateful material properties
    * @param material_data MaterilData object used for computing the data
@@ -173,6 +245,45 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
+  /**
+   * Store the stateful properties in a flat, element-indexed MaterialPropertyArena instead of the
+   * (element, side) hash maps. Must be selected before any stateful property is initialized.
+   *
+   * Opt-in: the accessors, walks, pruning and restart files of this class use the arena, but the
+   * out-of-line shift(), swap(), swapBack(), copy() and eraseProperty() must dispatch to it too
+   * (arena().shift(), props(elem, side), arena().erase()) before a problem enables it.
+   */
+  void useArena(bool use_arena) { _use_arena = use_arena; }
+
+  /// The arena holding the stateful properties when usesArena()
+  MaterialPropertyArena & arena() { return _arena; }
+
+  /**
+   * @return a Boolean indicating whether the stateful properties live in the arena
+   */
+  bool usesArena() const { return _use_arena; }
+
+  /**
+   * The estimated number of bytes held by the stored properties of all the states, in the hash
+   * maps or in the arena (see MemoryAccounting)
+   */
+  std::size_t memoryBytes() const
+  {
+    std::size_t bytes = _arena.memoryBytes();
+    for (const auto * map : {_props_elem.get(), _props_elem_old.get(), _props_elem_older.get()})
+      if (map)
+      {
+        bytes += MemoryUtils::containerBytes(*map);
+        for (const auto & elem_pair : *map)
+        {
+          bytes += MemoryUtils::containerBytes(elem_pair.second);
+          for (const auto & side_pair : elem_pair.second)
+            bytes += side_pair.second.memoryBytes();
+        }
+      }
+    return bytes;
+  }
+
   ///@{
   /**
    * Access methods to the stored material property data
@@ -204,18 +315,52 @@ public:
   }
   MaterialProperties & props(const Elem * elem, unsigned int side)
   {
-    return (*_props_elem)[elem][side];
+    if (_use_arena)
+      return _arena.props(elem, side, MaterialPropertyArena::CURRENT);
+    return elemProps(*_props_elem, elem)[side];
   }
   MaterialProperties & propsOld(const Elem * elem, unsigned int side)
   {
-    return (*_props_elem_old)[elem][side];
+    if (_use_arena)
+      return _arena.props(elem, side, MaterialPropertyArena::OLD);
+    return elemProps(*_props_elem_old, elem)[side];
   }
   MaterialProperties & propsOlder(const Elem * elem, unsigned int side)
   {
-    return (*_props_elem_older)[elem][side];
+    if (_use_arena)
+      return _arena.props(elem, side, MaterialPropertyArena::OLDER);
+    return elemProps(*_props_elem_older, elem)[side];
   }
   ///@}
 
+  /**
+   * Calls \p fn(state, elem_id, side, properties) on every stored set of stateful properties,
+   * with state 0 for the current properties, 1 for the old and, if declared, 2 for the older.
+   * The order of the calls is unspecified: it changes when the states are shifted.
+   */
+  template <typename Function>
+  void forEachStatefulProperties(Function && fn)
+  {
+    const unsigned int n_states = _has_older_prop ? 3 : 2;
+    if (_use_arena)
+    {
+      for (unsigned int state = 0; state < n_states; ++state)
+        _arena.forEachSlot(static_cast<MaterialPropertyArena::State>(state),
+                           [&fn, state](dof_id_type elem_id,
+                                        unsigned int side,
+                                        MaterialProperties & props)
+                           { fn(state, elem_id, side, props); });
+      return;
+    }
+
+    const std::array<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> *, 3> maps{
+        {_props_elem.get(), _props_elem_old.get(), _props_elem_older.get()}};
+    for (unsigned int state = 0; state < n_states; ++state)
+      for (auto & elem_pair : *maps[state])
+        for (auto & side_pair : elem_pair.second)
+          fn(state, elem_pair.first->id(), side_pair.first, side_pair.second);
+  }
+
   bool hasProperty(const std::string & prop_name) const;
 
   /// The addProperty functions are idempotent - calling multiple times with
@@ -233,6 +378,106 @@ public:
 
   unsigned int retrievePropertyId(const std::string & prop_name) const;
 
+  /**
+   * Creates the element storage of the elements a threaded ProjectMaterialProperties loop writes
+   * to (the children of the refined elements, the parents of the coarsened ones). Until
+   * finishProjection(), the element maps are only looked up, without taking their lock on which
+   * the projecting threads would otherwise all contend: each thread then only inserts in the side
+   * maps of its own elements.
+   */
+  void prepareProjection(const std::vector<const Elem *> & elems)
+  {
+    if (_use_arena)
+      return;
+
+    for (auto * map : {_props_elem.get(), _props_elem_old.get(), _props_elem_older.get()})
+    {
+      map->reserve(map->size() + elems.size());
+      for (const auto * elem : elems)
+        (*map)[elem];
+    }
+    _projecting = true;
+  }
+
+  /**
+   * Erases the storage of an element (e.g. a coarsened child) once the projection is finished,
+   * since erasing it while projecting would invalidate the lookups of the other threads
+   */
+  void eraseAfterProjection(const Elem * elem)
+  {
+    Threads::spin_mutex::scoped_lock lock(_projection_mutex);
+    _erase_after_projection.push_back(elem);
+  }
+
+  /// Ends the projection prepared by prepareProjection(), see eraseAfterProjection()
+  void finishProjection()
+  {
+    _projecting = false;
+    for (const auto * elem : _erase_after_projection)
+      eraseProperty(elem);
+    _erase_after_projection.clear();
+  }
+
+  /**
+   * Loads the storage written by another processor (by dataStore()), keeping only the elements
+   * \p keep accepts. The properties of the other elements, and of the elements that do not exist
+   * on this processor (loaded as null), are read into scratch properties and dropped, so that
+   * nothing is stored for them. The properties of a kept element that has none yet are allocated
+   * like the ones already stored before they are read.
+   *
+   * Must be called once the stateful properties of this processor are initialized.
+   */
+  void loadElements(std::istream & stream,
+                    const std::function<bool(const Elem *)> & keep,
+                    void * context)
+  {
+    // Any stored set of properties has the layout of the stored data
+    const MaterialProperties * prototype = nullptr;
+    forEachStatefulProperties(
+        [&prototype](unsigned int, dof_id_type, unsigned int, MaterialProperties & props) {
+          if (!prototype && !props.empty())
+            prototype = &props;
+        });
+
+    const unsigned int n_states = _has_older_prop ? 3 : 2;
+    for (unsigned int state = 0; state < n_states; ++state)
+    {
+      unsigned int n_elems = 0;
+      stream.read((char *)&n_elems, sizeof(n_elems));
+      for (unsigned int e = 0; e < n_elems; ++e)
+      {
+        const Elem * elem = nullptr;
+        dataLoad(stream, elem, context);
+        const bool kept = elem && keep(elem);
+
+        unsigned int n_sides = 0;
+        stream.read((char *)&n_sides, sizeof(n_sides));
+        for (unsigned int i = 0; i < n_sides; ++i)
+        {
+          unsigned int side = 0;
+          dataLoad(stream, side, context);
+
+          MaterialProperties scratch;
+          MaterialProperties & props =
+              !kept ? scratch
+                    : state == 0 ? this->props(elem, side)
+                                 : state == 1 ? propsOld(elem, side) : propsOlder(elem, side);
+          if (props.empty())
+          {
+            if (!prototype)
+              mooseError("The stateful material properties of another processor cannot be loaded "
+                         "on a processor that stores none");
+            for (const auto * value : *prototype)
+              props.push_back(value->init(value->size()));
+          }
+
+          dataLoad(stream, props, context);
+          scratch.destroy();
+        }
+      }
+    }
+  }
+
   bool isStatefulProp(const std::string & prop_name) const
   {
     return _prop_names.count(retrievePropertyId(prop_name)) > 0;
@@ -254,6 +499,19 @@ protected:
   std::unique_ptr<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>>>
       _props_elem_older;
 
+  /// Whether or not the stateful properties are stored in _arena
+  bool _use_arena = false;
+
+  /// Flat storage used instead of the hash maps when _use_arena is true
+  MaterialPropertyArena _arena;
+
+  /// Whether a projection is prepared, see prepareProjection()
+  bool _projecting = false;
+  /// The elements to erase at the end of the projection
+  std::vector<const Elem *> _erase_after_projection;
+  /// Guards _erase_after_projection
+  Threads::spin_mutex _projection_mutex;
+
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblemBase - should be useful when we will use material properties from
   /// one FEPRoblem in another one - if we will ever do it)
@@ -278,7 +536,52 @@ protected:
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
 
+  /// The properties of a state (0 = current, 1 = old, 2 = older)
+  MaterialProperties & stateProps(unsigned int state, const Elem * elem, unsigned int side)
+  {
+    return state == 0 ? props(elem, side) : state == 1 ? propsOld(elem, side)
+                                                       : propsOlder(elem, side);
+  }
+
+  /**
+   * Sizes properties to \p n_qp points, creating those missing from the properties they are
+   * copied from
+   */
+  static void sizeLike(const MaterialProperties & from, MaterialProperties & to, unsigned int n_qp)
+  {
+    if (to.size() < from.size())
+      to.resize(from.size(), nullptr);
+    for (std::size_t i = 0; i < from.size(); ++i)
+      if (from[i] && !to[i])
+        to[i] = from[i]->init(n_qp);
+      else if (from[i] && to[i]->size() != n_qp)
+        to[i]->resize(n_qp);
+  }
+
+  /// Copies the values of a source qp to a qp of sized properties (see sizeLike())
+  static void
+  copyQp(MaterialProperties & from, unsigned int from_qp, MaterialProperties & to, unsigned int qp)
+  {
+    for (std::size_t i = 0; i < from.size(); ++i)
+      if (from[i])
+        to[i]->qpCopy(qp, from[i], from_qp);
+  }
+
 private:
+  /// The side maps of an element, looked up without locking while projecting
+  HashMap<unsigned int, MaterialProperties> &
+  elemProps(HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & map,
+            const Elem * elem)
+  {
+    if (_projecting)
+    {
+      const auto it = map.find(elem);
+      mooseAssert(it != map.end(), "The element was not prepared for the projection");
+      return it->second;
+    }
+    return map[elem];
+  }
+
   /// Initializes hashmap entries for element and side to proper qpoint and
   /// property count sizes.
   void initProps(MaterialData & material_data,
@@ -294,6 +597,15 @@ template <>
 inline void
 dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usesArena())
+  {
+    storage.arena().store(stream, MaterialPropertyArena::CURRENT, context);
+    storage.arena().store(stream, MaterialPropertyArena::OLD, context);
+    if (storage.hasOlderProperties())
+      storage.arena().store(stream, MaterialPropertyArena::OLDER, context);
+    return;
+  }
+
   dataStore(stream, storage.props(), context);
   dataStore(stream, storage.propsOld(), context);
 
@@ -305,9 +617,31 @@ template <>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
+  if (storage.usesArena())
+  {
+    storage.arena().load(stream, MaterialPropertyArena::CURRENT, context);
+    storage.arena().load(stream, MaterialPropertyArena::OLD, context);
+    if (storage.hasOlderProperties())
+      storage.arena().load(stream, MaterialPropertyArena::OLDER, context);
+    return;
+  }
+
   dataLoad(stream, storage.props(), context);
   dataLoad(stream, storage.propsOld(), context);
 
   if (storage.hasOlderProperties())
     dataLoad(stream, storage.propsOlder(), context);
 }
+
+template <>
+struct RestartableElementData<MaterialPropertyStorage>
+{
+  static constexpr bool keyed = true;
+  static void load(std::istream & stream,
+                   MaterialPropertyStorage & storage,
+                   const std::function<bool(const Elem *)> & keep,
+                   void * context)
+  {
+    storage.loadElements(stream, keep, context);
+  }
+};
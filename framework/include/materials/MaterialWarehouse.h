@@ -58,6 +58,46 @@ public:
    */
   void addInterfaceObject(std::shared_ptr<MaterialBase> interface, THREAD_ID tid = 0);
 
+  /**
+   * Selects the materials needed to compute a set of properties: those that supply one of them
+   * and, recursively, those that supply a property a selected material depends on. Materials with
+   * stateful properties are always selected, their properties must advance with the solution.
+   *
+   * @param sorted The materials, sorted by dependency (see sort())
+   * @param needed_prop_ids The properties requested by the objects being evaluated
+   * @param selected The needed materials, in their order in sorted
+   */
+  template <typename MaterialType>
+  static void selectNeeded(const std::vector<std::shared_ptr<MaterialType>> & sorted,
+                           const std::set<unsigned int> & needed_prop_ids,
+                           std::vector<std::shared_ptr<MaterialType>> & selected)
+  {
+    // A material only depends on those sorted before it, so one backward sweep closes the set
+    std::set<unsigned int> needed = needed_prop_ids;
+    std::vector<bool> keep(sorted.size(), false);
+    for (auto i = sorted.size(); i-- > 0;)
+    {
+      auto & material = *sorted[i];
+      bool supplies = material.hasStatefulProperties();
+      for (const auto id : material.getSuppliedPropIDs())
+        if (supplies || needed.count(id))
+        {
+          supplies = true;
+          break;
+        }
+      if (!supplies)
+        continue;
+      keep[i] = true;
+      const auto & dependencies = material.getMatPropDependencies();
+      needed.insert(dependencies.begin(), dependencies.end());
+    }
+
+    selected.clear();
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+      if (keep[i])
+        selected.push_back(sorted[i]);
+  }
+
 protected:
   /// Storage for neighbor material objects (Block are stored in the base class)
   MooseObjectWarehouse<MaterialBase> _neighbor_materials;
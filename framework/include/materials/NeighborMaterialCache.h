@@ -0,0 +1,99 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MaterialProperty.h"
+
+#include <set>
+#include <unordered_map>
+
+/**
+ * The values a neighbor material that is constant on elements ("constant_on = ELEMENT") computed
+ * for each neighbor element, so that the other faces of the same neighbor element visited by the
+ * thread copy them instead of computing them again. An element has up to one such evaluation per
+ * side, all giving the same values, since they are computed at the first quadrature point only.
+ *
+ * Each thread has its own copy of the material, hence of the cache, which is not locked. The
+ * values are only valid during one evaluation: clear() must be called whenever the solution or
+ * the kind of evaluation may have changed (Material::subdomainSetup(), at the start of every
+ * threaded loop and subdomain).
+ */
+class NeighborMaterialCache
+{
+public:
+  ~NeighborMaterialCache() { clear(); }
+
+  /**
+   * Copies the recorded values of a neighbor element to all the quadrature points of the
+   * properties
+   * @param neighbor The neighbor element
+   * @param props The properties of the material data, sized for the current face
+   * @param prop_ids The ids of the properties of the material
+   * @param n_qp The number of quadrature points of the current face
+   * @return Whether values were recorded for the element
+   */
+  bool restore(const Elem * neighbor,
+               MaterialProperties & props,
+               const std::set<unsigned int> & prop_ids,
+               unsigned int n_qp)
+  {
+    const auto it = _values.find(neighbor);
+    if (it == _values.end())
+    {
+      ++_misses;
+      return false;
+    }
+
+    auto value = it->second.begin();
+    for (const auto id : prop_ids)
+    {
+      for (unsigned int qp = 0; qp < n_qp; ++qp)
+        props[id]->qpCopy(qp, *value, 0);
+      ++value;
+    }
+    ++_hits;
+    return true;
+  }
+
+  /// Records the values of the properties at the first quadrature point of a neighbor element
+  void record(const Elem * neighbor,
+              MaterialProperties & props,
+              const std::set<unsigned int> & prop_ids)
+  {
+    auto & values = _values[neighbor];
+    if (values.empty())
+      for (const auto id : prop_ids)
+        values.push_back(props[id]->init(1));
+
+    auto value = values.begin();
+    for (const auto id : prop_ids)
+      (*value++)->qpCopy(0, props[id], 0);
+  }
+
+  /// Drops all the recorded values
+  void clear()
+  {
+    for (auto & pair : _values)
+      pair.second.destroy();
+    _values.clear();
+  }
+
+  ///@{ The number of evaluations copied back and of those that had to be computed
+  unsigned long hits() const { return _hits; }
+  unsigned long misses() const { return _misses; }
+  ///@}
+
+private:
+  /// The values of each neighbor element, one single point property per id of the material
+  std::unordered_map<const Elem *, MaterialProperties> _values;
+
+  unsigned long _hits = 0;
+  unsigned long _misses = 0;
+};
@@ -52,4 +52,7 @@ protected:
 
   /// LinearInterpolation object
   std::unique_ptr<LinearInterpolation> _linear_interp;
+
+  /// interval of the last sample, the lookup hint of the next quadrature point
+  unsigned int _interval_hint = 0;
 };
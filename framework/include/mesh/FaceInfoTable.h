@@ -0,0 +1,126 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "FaceInfo.h"
+#include "MooseError.h"
+
+#include "libmesh/elem.h"
+#include "libmesh/threads.h"
+
+#include <vector>
+
+/**
+ * The geometric data of all the FaceInfo objects of a mesh, stored structure-of-arrays: one
+ * contiguous array per quantity, indexed like the FaceInfo vector the table is built from.
+ *
+ * Loops over faces that only need a few quantities of every face (e.g. the subdomains, to detect
+ * subdomain changes, or the normals and areas of a flux computation) stream through those arrays
+ * instead of touching every FaceInfo object, which are large and scattered in memory.
+ */
+class FaceInfoTable
+{
+public:
+  /**
+   * (Re)builds the table from \p faces with the thread pool. The table refers to the vector, not
+   * to its storage, so index() stays valid if the vector reallocates; the table must be rebuilt
+   * whenever the faces themselves change (see MooseMesh::faceInfoTable()).
+   */
+  void build(const std::vector<FaceInfo> & faces)
+  {
+    const std::size_t n = faces.size();
+    _faces = &faces;
+
+    _normal.resize(n);
+    _face_centroid.resize(n);
+    _elem_centroid.resize(n);
+    _neighbor_centroid.resize(n);
+    _face_area.resize(n);
+    _face_coord.resize(n);
+    _elem_id.resize(n);
+    _neighbor_id.resize(n);
+    _elem_subdomain_id.resize(n);
+    _neighbor_subdomain_id.resize(n);
+
+    Threads::parallel_for(Threads::BlockedRange<std::size_t>(0, n),
+                          [this](const Threads::BlockedRange<std::size_t> & range)
+                          {
+                            for (auto i = range.begin(); i != range.end(); ++i)
+                              fill(i);
+                          });
+  }
+
+  /// Updates the face coordinates, after MooseMesh::computeFaceInfoFaceCoords()
+  void updateFaceCoords()
+  {
+    for (std::size_t i = 0; i < size(); ++i)
+      _face_coord[i] = (*_faces)[i].faceCoord();
+  }
+
+  std::size_t size() const { return _normal.size(); }
+
+  /// The row of a face of the vector the table was built from
+  std::size_t index(const FaceInfo & fi) const
+  {
+    mooseAssert(_faces && _faces->size() == size(), "The table is out of date");
+    const FaceInfo * const first = _faces->data();
+    mooseAssert(&fi >= first && std::size_t(&fi - first) < size(), "The face is not in the table");
+    return &fi - first;
+  }
+
+  /// The face of a row
+  const FaceInfo & face(std::size_t i) const { return (*_faces)[i]; }
+
+  ///@{ The arrays of every quantity, see the FaceInfo accessors of the same names
+  const std::vector<Point> & normal() const { return _normal; }
+  const std::vector<Point> & faceCentroid() const { return _face_centroid; }
+  const std::vector<Point> & elemCentroid() const { return _elem_centroid; }
+  const std::vector<Point> & neighborCentroid() const { return _neighbor_centroid; }
+  const std::vector<Real> & faceArea() const { return _face_area; }
+  const std::vector<Real> & faceCoord() const { return _face_coord; }
+  const std::vector<SubdomainID> & elemSubdomainID() const { return _elem_subdomain_id; }
+  const std::vector<SubdomainID> & neighborSubdomainID() const { return _neighbor_subdomain_id; }
+  ///@}
+
+  ///@{ The ids of the elem and neighbor elements, DofObject::invalid_id without neighbor
+  const std::vector<dof_id_type> & elemID() const { return _elem_id; }
+  const std::vector<dof_id_type> & neighborID() const { return _neighbor_id; }
+  ///@}
+
+private:
+  void fill(std::size_t i)
+  {
+    const FaceInfo & fi = (*_faces)[i];
+    _normal[i] = fi.normal();
+    _face_centroid[i] = fi.faceCentroid();
+    _elem_centroid[i] = fi.elemCentroid();
+    _neighbor_centroid[i] = fi.neighborCentroid();
+    _face_area[i] = fi.faceArea();
+    _face_coord[i] = fi.faceCoord();
+    _elem_id[i] = fi.elem().id();
+    _neighbor_id[i] = fi.neighborPtr() ? fi.neighborPtr()->id() : DofObject::invalid_id;
+    _elem_subdomain_id[i] = fi.elemSubdomainID();
+    _neighbor_subdomain_id[i] = fi.neighborSubdomainID();
+  }
+
+  /// The faces the table was built from
+  const std::vector<FaceInfo> * _faces = nullptr;
+
+  std::vector<Point> _normal;
+  std::vector<Point> _face_centroid;
+  std::vector<Point> _elem_centroid;
+  std::vector<Point> _neighbor_centroid;
+  std::vector<Real> _face_area;
+  std::vector<Real> _face_coord;
+  std::vector<dof_id_type> _elem_id;
+  std::vector<dof_id_type> _neighbor_id;
+  std::vector<SubdomainID> _elem_subdomain_id;
+  std::vector<SubdomainID> _neighbor_subdomain_id;
+};
@@ -32,6 +32,21 @@ public:
 
   void read(const std::string & file_name);
 
+  /**
+   * Reads a mesh that has been split for the current number of processors (see SplitMeshAction)
+   * into a DistributedMesh: every rank only reads its own piece of the split, so that the whole
+   * mesh is never held, partitioned or broadcast by any one rank.
+   * @param split_file The split, either a "<mesh>.cpr" directory or the "<mesh>.e" base of
+   *                   Nemesis pieces "<mesh>.e.<n_procs>.<rank>"
+   */
+  void readSplit(const std::string & split_file);
+
+  /**
+   * Whether \p split_file has a piece for every one of the current processors, in which case
+   * buildMesh() reads it with readSplit() instead of reading the whole file on rank zero
+   */
+  bool hasSplitFor(const std::string & split_file) const;
+
   // Get/Set Filename (for meshes read from a file)
   void setFileName(const std::string & file_name) { _file_name = file_name; }
   virtual std::string getFileName() const override { return _file_name; }
@@ -47,6 +62,12 @@ protected:
   /// from the element type(s).
   const unsigned int _dim;
 
+  /// Whether the mesh is read in parallel from a split when one exists for the processor count
+  const bool _parallel_read;
+
   /// Timers
   const PerfID _read_mesh_timer;
+  const PerfID _read_split_timer;
+  const PerfID _broadcast_mesh_timer;
+  const PerfID _partition_mesh_timer;
 };
@@ -0,0 +1,308 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * A linear octree (quadtree in 2D) over a box: its leaves are kept sorted along the Morton
+ * space-filling curve, so that refinement and coarsening are single sweeps, a point or a
+ * neighbor is found by binary search instead of through element neighbor pointers, and the
+ * contiguous curve ranges are a partitioning. This is the structured AMR backend of the
+ * phase-field problems on boxes: the leaves become the hex (quad) elements of the mesh and the
+ * hanging nodes follow from the 2:1 balance.
+ */
+template <unsigned int dim>
+class LinearOctree
+{
+public:
+  static_assert(dim == 2 || dim == 3, "LinearOctree is for 2D and 3D boxes");
+
+  /// The finest level: the integer coordinates of the leaves have this many bits
+  static constexpr unsigned int MAX_LEVEL = 19;
+  /// The number of children of an octant
+  static constexpr unsigned int N_CHILDREN = 1u << dim;
+
+  /// A leaf: the integer coordinates of its lowest corner and its level
+  struct Octant
+  {
+    std::uint32_t x[dim];
+    unsigned char level;
+
+    /// The edge length of the octant, in integer coordinates
+    std::uint32_t size() const { return 1u << (MAX_LEVEL - level); }
+  };
+
+  /**
+   * @param lower The lowest corner of the box
+   * @param upper The highest corner of the box
+   * @param level The level of the initial uniform leaves
+   */
+  LinearOctree(const std::vector<Real> & lower, const std::vector<Real> & upper, unsigned int level)
+    : _lower(lower), _upper(upper)
+  {
+    if (lower.size() != dim || upper.size() != dim)
+      mooseError("The LinearOctree box must have ", dim, " coordinates");
+    if (level > MAX_LEVEL)
+      mooseError("The LinearOctree level cannot exceed ", MAX_LEVEL);
+
+    _leaves.resize(1);
+    for (unsigned int d = 0; d < dim; ++d)
+      _leaves[0].x[d] = 0;
+    _leaves[0].level = 0;
+    for (unsigned int l = 0; l < level; ++l)
+      refine(std::vector<bool>(_leaves.size(), true));
+  }
+
+  /// The leaves, in Morton order
+  const std::vector<Octant> & leaves() const { return _leaves; }
+  std::size_t numLeaves() const { return _leaves.size(); }
+
+  /**
+   * Replaces the flagged leaves by their children, in place along the curve
+   * @return Whether any leaf was refined
+   */
+  bool refine(const std::vector<bool> & flags)
+  {
+    mooseAssert(flags.size() == _leaves.size(), "One flag per leaf");
+    std::vector<Octant> refined;
+    refined.reserve(_leaves.size());
+    bool changed = false;
+    for (std::size_t i = 0; i < _leaves.size(); ++i)
+    {
+      const auto & leaf = _leaves[i];
+      if (!flags[i] || leaf.level == MAX_LEVEL)
+      {
+        refined.push_back(leaf);
+        continue;
+      }
+      changed = true;
+      const auto half = leaf.size() / 2;
+      for (unsigned int c = 0; c < N_CHILDREN; ++c)
+      {
+        Octant child = leaf;
+        child.level = leaf.level + 1;
+        for (unsigned int d = 0; d < dim; ++d)
+          child.x[d] += ((c >> d) & 1) * half;
+        refined.push_back(child);
+      }
+    }
+    _leaves.swap(refined);
+    return changed;
+  }
+
+  /**
+   * Replaces the complete families of flagged siblings by their parent; families with an unflagged
+   * or refined sibling are kept
+   * @return Whether any family was coarsened
+   */
+  bool coarsen(const std::vector<bool> & flags)
+  {
+    mooseAssert(flags.size() == _leaves.size(), "One flag per leaf");
+    std::vector<Octant> coarsened;
+    coarsened.reserve(_leaves.size());
+    bool changed = false;
+    for (std::size_t i = 0; i < _leaves.size();)
+    {
+      if (isFamily(i, flags))
+      {
+        Octant parent = _leaves[i];
+        parent.level -= 1;
+        coarsened.push_back(parent);
+        i += N_CHILDREN;
+        changed = true;
+      }
+      else
+        coarsened.push_back(_leaves[i++]);
+    }
+    _leaves.swap(coarsened);
+    return changed;
+  }
+
+  /**
+   * Refines the leaves until face neighbors differ by at most one level (2:1 balance), so that
+   * each face holds at most one hanging node per edge
+   * @return The number of leaves refined
+   */
+  std::size_t balance()
+  {
+    std::size_t n_refined = 0;
+    std::vector<std::size_t> neighbors;
+    while (true)
+    {
+      std::vector<bool> flags(_leaves.size(), false);
+      bool any = false;
+      for (std::size_t i = 0; i < _leaves.size(); ++i)
+        for (unsigned int face = 0; face < 2 * dim && !flags[i]; ++face)
+        {
+          faceNeighbors(i, face, neighbors);
+          for (const auto n : neighbors)
+            if (_leaves[n].level > _leaves[i].level + 1)
+            {
+              flags[i] = any = true;
+              ++n_refined;
+              break;
+            }
+        }
+      if (!any)
+        return n_refined;
+      refine(flags);
+    }
+  }
+
+  /**
+   * The leaves sharing a face with a leaf
+   * @param i The index of the leaf
+   * @param face The face: 2 * direction for the lower side, 2 * direction + 1 for the upper one
+   * @param neighbors The indices of the neighbors: a single coarser or equal leaf, or the finer
+   *                  leaves touching the face; empty on the boundary of the box
+   */
+  void faceNeighbors(std::size_t i, unsigned int face, std::vector<std::size_t> & neighbors) const
+  {
+    neighbors.clear();
+    const auto & leaf = _leaves[i];
+    const unsigned int d = face / 2;
+    const bool upper = face % 2;
+    const std::uint32_t size = leaf.size();
+    if ((!upper && leaf.x[d] == 0) || (upper && leaf.x[d] + size == (1u << MAX_LEVEL)))
+      return;
+
+    // The octant of the same size across the face
+    Octant across = leaf;
+    across.x[d] = upper ? leaf.x[d] + size : leaf.x[d] - size;
+
+    const std::size_t containing = findLeaf(across.x);
+    if (_leaves[containing].level <= leaf.level)
+    {
+      neighbors.push_back(containing);
+      return;
+    }
+
+    // The finer leaves within the octant across, which all lie on a contiguous curve range
+    const std::uint64_t first = morton(across.x);
+    const std::uint64_t last = first + (std::uint64_t(1) << (dim * (MAX_LEVEL - leaf.level)));
+    for (std::size_t n = containing; n < _leaves.size() && morton(_leaves[n].x) < last; ++n)
+    {
+      const auto & other = _leaves[n];
+      if (upper ? other.x[d] == across.x[d] : other.x[d] + other.size() == leaf.x[d])
+        neighbors.push_back(n);
+    }
+  }
+
+  /// The index of the leaf containing a point, in integer coordinates
+  std::size_t findLeaf(const std::uint32_t (&x)[dim]) const
+  {
+    const std::uint64_t key = morton(x);
+    auto it = std::upper_bound(_leaves.begin(),
+                               _leaves.end(),
+                               key,
+                               [](std::uint64_t k, const Octant & o) { return k < morton(o.x); });
+    mooseAssert(it != _leaves.begin(), "Point outside of the octree");
+    return std::distance(_leaves.begin(), it) - 1;
+  }
+
+  /// The index of the leaf containing a point of the box
+  std::size_t findLeaf(const std::vector<Real> & point) const
+  {
+    std::uint32_t x[dim];
+    const std::uint32_t max = (1u << MAX_LEVEL) - 1;
+    for (unsigned int d = 0; d < dim; ++d)
+    {
+      const Real s = (point[d] - _lower[d]) / (_upper[d] - _lower[d]);
+      x[d] = s <= 0 ? 0 : std::min(max, static_cast<std::uint32_t>(s * (max + 1)));
+    }
+    return findLeaf(x);
+  }
+
+  /// The lowest corner of a leaf in the coordinates of the box
+  std::vector<Real> lowerCorner(std::size_t i) const
+  {
+    std::vector<Real> corner(dim);
+    for (unsigned int d = 0; d < dim; ++d)
+      corner[d] = _lower[d] + (_upper[d] - _lower[d]) * _leaves[i].x[d] / Real(1u << MAX_LEVEL);
+    return corner;
+  }
+
+  /// The edge lengths of a leaf in the coordinates of the box
+  std::vector<Real> extent(std::size_t i) const
+  {
+    std::vector<Real> h(dim);
+    for (unsigned int d = 0; d < dim; ++d)
+      h[d] = (_upper[d] - _lower[d]) * _leaves[i].size() / Real(1u << MAX_LEVEL);
+    return h;
+  }
+
+  /**
+   * Splits the curve into contiguous ranges of roughly equal weight, the space-filling curve
+   * partitioning of the leaves
+   * @param weights The weight of each leaf, or empty for unit weights
+   * @param n_parts The number of parts
+   * @return The part boundaries: part p holds the leaves [bounds[p], bounds[p + 1])
+   */
+  std::vector<std::size_t> partition(const std::vector<Real> & weights, std::size_t n_parts) const
+  {
+    mooseAssert(weights.empty() || weights.size() == _leaves.size(), "One weight per leaf");
+    const auto weight = [&weights](std::size_t i) { return weights.empty() ? 1 : weights[i]; };
+
+    Real total = 0;
+    for (std::size_t i = 0; i < _leaves.size(); ++i)
+      total += weight(i);
+
+    std::vector<std::size_t> bounds(1, 0);
+    Real accumulated = 0;
+    for (std::size_t i = 0; i < _leaves.size(); ++i)
+    {
+      accumulated += weight(i);
+      if (bounds.size() < n_parts && accumulated >= total * bounds.size() / n_parts)
+        bounds.push_back(i + 1);
+    }
+    bounds.resize(n_parts + 1, _leaves.size());
+    return bounds;
+  }
+
+  /// The Morton key of integer coordinates, the bits of the coordinates interleaved
+  static std::uint64_t morton(const std::uint32_t (&x)[dim])
+  {
+    std::uint64_t key = 0;
+    for (unsigned int b = 0; b < MAX_LEVEL; ++b)
+      for (unsigned int d = 0; d < dim; ++d)
+        key |= std::uint64_t((x[d] >> b) & 1) << (dim * b + d);
+    return key;
+  }
+
+private:
+  /// Whether the leaves from i on are a complete family of flagged siblings
+  bool isFamily(std::size_t i, const std::vector<bool> & flags) const
+  {
+    const auto & first = _leaves[i];
+    if (first.level == 0 || i + N_CHILDREN > _leaves.size())
+      return false;
+    // The first child has the corner of its parent
+    const std::uint32_t parent_size = first.size() * 2;
+    for (unsigned int d = 0; d < dim; ++d)
+      if (first.x[d] % parent_size)
+        return false;
+    for (unsigned int c = 0; c < N_CHILDREN; ++c)
+      if (!flags[i + c] || _leaves[i + c].level != first.level)
+        return false;
+    return true;
+  }
+
+  const std::vector<Real> _lower;
+  const std::vector<Real> _upper;
+
+  /// The leaves, in Morton order
+  std::vector<Octant> _leaves;
+};
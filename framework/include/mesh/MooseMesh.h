@@ -18,7 +18,11 @@
 #include "MooseHashing.h"
 #include "MooseApp.h"
 #include "FaceInfo.h"
+#include "FaceInfoTable.h"
+#include "CompressedAdjacency.h"
+#include "MemoryUtils.h"
 
+#include <limits>
 #include <memory> //std::unique_ptr
 #include <unordered_map>
 #include <unordered_set>
@@ -207,9 +211,10 @@ public:
 
   /**
    * If not already created, creates a map from every node to all
-   * elements to which they are connected.
+   * elements to which they are connected. The map is built with the thread pool and stored
+   * in compressed form, see CompressedAdjacency.
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToElemMap();
+  const CompressedAdjacency<dof_id_type> & nodeToElemMap();
 
   /**
    * If not already created, creates a map from every node to all
@@ -218,7 +223,7 @@ public:
    * one node with a local element.
    * \note Extra ghosted elements are not included in this map!
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToActiveSemilocalElemMap();
+  const CompressedAdjacency<dof_id_type> & nodeToActiveSemilocalElemMap();
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -346,6 +351,12 @@ public:
    */
   void meshChanged();
 
+  /**
+   * The number of times meshChanged() has been called, so that clients caching data computed on
+   * the mesh can tell whether it is still valid
+   */
+  unsigned int numMeshChanges() const { return _num_mesh_changes; }
+
   /**
    * Declares a callback function that is executed at the conclusion
    * of meshChanged(). Ther user can implement actions required after
@@ -562,9 +573,9 @@ public:
   void printInfo(std::ostream & os = libMesh::out) const;
 
   /**
-   * Return list of blocks to which the given node belongs.
+   * Return list of blocks to which the given node belongs, sorted.
    */
-  const std::set<SubdomainID> & getNodeBlockIds(const Node & node) const;
+  CompressedAdjacency<SubdomainID>::Row getNodeBlockIds(const Node & node) const;
 
   /**
    * Return a writable reference to a vector of node IDs that belong
@@ -1026,6 +1037,32 @@ public:
   std::set<dof_id_type> getElemIDsOnBlocks(unsigned int elem_id_index,
                                            const std::set<SubdomainID> & blks) const;
 
+  /**
+   * The estimated number of bytes held by the maps MOOSE builds on top of the libMesh mesh: the
+   * node to element maps, the boundary node and element lists and the face information (see
+   * MemoryAccounting)
+   */
+  std::size_t memoryBytes() const
+  {
+    std::size_t bytes = _node_to_elem_map.memoryBytes() +
+                        _node_to_active_semilocal_elem_map.memoryBytes() +
+                        MemoryUtils::containerBytes(_bnd_nodes) +
+                        _bnd_nodes.size() * sizeof(BndNode) +
+                        MemoryUtils::containerBytes(_bnd_node_ids) +
+                        MemoryUtils::containerBytes(_bnd_elems) +
+                        _bnd_elems.size() * sizeof(BndElement) +
+                        MemoryUtils::containerBytes(_bnd_elem_ids) +
+                        MemoryUtils::containerBytes(_extra_bnd_nodes) +
+                        MemoryUtils::containerBytes(_all_face_info) +
+                        MemoryUtils::containerBytes(_face_info) +
+                        MemoryUtils::containerBytes(_elem_side_to_face_info);
+    for (const auto & pair : _bnd_node_ids)
+      bytes += MemoryUtils::containerBytes(pair.second);
+    for (const auto & pair : _bnd_elem_ids)
+      bytes += MemoryUtils::containerBytes(pair.second);
+    return bytes;
+  }
+
   ///@{ accessors for the FaceInfo objects
   unsigned int nFace() const { return _face_info.size(); }
   /// Accessor for local \p FaceInfo objects
@@ -1036,6 +1073,23 @@ public:
   }
   const FaceInfo * faceInfo(const Elem * elem, unsigned int side) const;
   // const
+
+  /**
+   * Accessor for the structure-of-arrays table of all the \p FaceInfo objects, indexed through
+   * FaceInfoTable::index(). Builds the face info and rebuilds the table when the face info has
+   * been rebuilt since, so it must be called outside of threaded loops; the table returned can
+   * then be read from threads.
+   */
+  const FaceInfoTable & faceInfoTable()
+  {
+    buildFaceInfo();
+    if (_face_info_table_revision != _face_info_revision)
+    {
+      _face_info_table.build(_all_face_info);
+      _face_info_table_revision = _face_info_revision;
+    }
+    return _face_info_table;
+  }
   ///@}
 
   /**
@@ -1117,6 +1171,9 @@ protected:
   /// true if mesh is changed (i.e. after adaptivity step)
   bool _is_changed;
 
+  /// The number of calls to meshChanged()
+  unsigned int _num_mesh_changes = 0;
+
   /// True if a Nemesis Mesh was read in
   bool _is_nemesis;
 
@@ -1156,11 +1213,11 @@ protected:
       _bnd_elem_range;
 
   /// A map of all of the current nodes to the elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_elem_map;
+  CompressedAdjacency<dof_id_type> _node_to_elem_map;
   bool _node_to_elem_map_built;
 
   /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_active_semilocal_elem_map;
+  CompressedAdjacency<dof_id_type> _node_to_active_semilocal_elem_map;
   bool _node_to_active_semilocal_elem_map_built;
 
   /**
@@ -1203,8 +1260,8 @@ protected:
       _elem_to_side_to_qp_to_quadrature_nodes;
   std::vector<BndNode> _extra_bnd_nodes;
 
-  /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID>> _block_node_list;
+  /// The blocks each node belongs to, indexed by node id
+  CompressedAdjacency<SubdomainID> _block_node_list;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type>> _node_set_nodes;
@@ -1244,6 +1301,11 @@ protected:
   /// Map from elem-side pair to FaceInfo
   std::unordered_map<std::pair<const Elem *, unsigned int>, FaceInfo *> _elem_side_to_face_info;
 
+  /// Contiguous arrays of the geometric data of \p _all_face_info
+  FaceInfoTable _face_info_table;
+  /// The \p _face_info_revision the table was built from
+  unsigned int _face_info_table_revision = std::numeric_limits<unsigned int>::max();
+
   void cacheInfo();
   void freeBndNodes();
   void freeBndElems();
@@ -1253,8 +1315,14 @@ private:
   // true if the _face_info member needs to be rebuilt/updated.
   bool _face_info_dirty = true;
 
+  /// Incremented by buildFaceInfo() each time it (re)builds the face info, so that the data
+  /// built from the \p FaceInfo objects can tell when it is stale
+  unsigned int _face_info_revision = 0;
+
   /// Builds the face info vector that stores meta-data needed for looping
-  /// over and doing calculations based on mesh faces.
+  /// over and doing calculations based on mesh faces. The faces are enumerated
+  /// first, so that the FaceInfo objects can then be built with the thread pool.
+  /// Increments \p _face_info_revision when it rebuilds them.
   void buildFaceInfo();
 
   /**
@@ -0,0 +1,71 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseMesh.h"
+#include "LinearOctree.h"
+
+class OctreeMesh;
+
+template <>
+InputParameters validParams<OctreeMesh>();
+
+/**
+ * Box mesh of quads (2D) or hexes (3D) backed by a LinearOctree: Adaptivity refines and coarsens
+ * the octree with the element flags of the markers (adapt()) and the mesh is rebuilt from its
+ * 2:1 balanced leaves, numbered and partitioned along the Morton curve, instead of going through
+ * the refinement tree of libMesh. Neighbors are those of the octree, found by binary search.
+ */
+class OctreeMesh : public MooseMesh
+{
+public:
+  static InputParameters validParams();
+
+  OctreeMesh(const InputParameters & parameters);
+  OctreeMesh(const OctreeMesh & other_mesh);
+
+  // No copy
+  OctreeMesh & operator=(const OctreeMesh & other_mesh) = delete;
+
+  virtual std::unique_ptr<MooseMesh> safeClone() const override;
+
+  virtual void buildMesh() override;
+  virtual Real getMinInDimension(unsigned int component) const override;
+  virtual Real getMaxInDimension(unsigned int component) const override;
+
+  /**
+   * Refines and coarsens the leaves flagged by the refinement state of their elements
+   * (Elem::REFINE / Elem::COARSEN), balances the octree and rebuilds the mesh
+   * @return Whether the mesh changed
+   */
+  bool adapt();
+
+  /// The octree leaf of an element, the element ids follow the leaves
+  std::size_t leaf(const Elem & elem) const { return elem.id(); }
+
+protected:
+  /// Builds the elements and the (hanging) nodes of the leaves
+  template <unsigned int dim>
+  void buildFromLeaves(const LinearOctree<dim> & octree);
+
+  /// The dimension of the mesh
+  const MooseEnum _dim;
+
+  /// The corners of the box
+  std::vector<Real> _lower, _upper;
+
+  /// The level of the initial uniform leaves
+  const unsigned int _initial_level;
+
+  ///@{ The octree of the mesh, the one of its dimension
+  std::unique_ptr<LinearOctree<2>> _quadtree;
+  std::unique_ptr<LinearOctree<3>> _octree;
+  ///@}
+};
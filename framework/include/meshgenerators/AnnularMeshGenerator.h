@@ -30,6 +30,19 @@ public:
   std::unique_ptr<MeshBase> generate() override;
 
 protected:
+  /**
+   * Builds only the elements of this processor and its ghost layers of a distributed mesh, from
+   * the partition of the nt x nr grid of elements (periodic in the angle for a full annulus), see
+   * GeneratedMeshGenerator::generateDistributed()
+   */
+  std::unique_ptr<MeshBase> generateDistributed();
+
+  /// Whether to build each processor's part of the mesh only ("distributed_generation")
+  const bool _distributed_generation;
+
+  /// The number of layers of ghost elements built around the part of each processor
+  const unsigned int _ghost_layers;
+
   /// Number of elements in radial direction
   const unsigned _nr;
 
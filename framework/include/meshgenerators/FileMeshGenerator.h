@@ -29,6 +29,9 @@ public:
 
   std::unique_ptr<MeshBase> generate() override;
 
+  /// Also hashes the contents of the mesh file
+  void hashInputs(MeshGeneratorHash & hash) const override;
+
 protected:
   const MeshFileName & _file_name;
 };
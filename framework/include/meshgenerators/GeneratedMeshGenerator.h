@@ -31,6 +31,19 @@ public:
   std::unique_ptr<MeshBase> generate() override;
 
 protected:
+  /**
+   * Builds only the elements of this processor and its ghost layers of a distributed mesh, with
+   * the partition of the structured grid each processor computes on its own (see
+   * StructuredBlockPartition), instead of the whole mesh on every processor
+   */
+  std::unique_ptr<MeshBase> generateDistributed();
+
+  /// Whether to build each processor's part of the mesh only ("distributed_generation")
+  const bool _distributed_generation;
+
+  /// The number of layers of ghost elements built around the part of each processor
+  const unsigned int _ghost_layers;
+
   /// The dimension of the mesh
   MooseEnum _dim;
 
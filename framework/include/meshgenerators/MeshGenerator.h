@@ -21,6 +21,7 @@
 
 // Forward declarations
 class MeshGenerator;
+class MeshGeneratorHash;
 class MooseMesh;
 namespace libMesh
 {
@@ -57,6 +58,19 @@ public:
    */
   std::vector<std::string> & getDependencies() { return _depends_on; }
 
+  /**
+   * Adds everything the generated mesh depends on, other than the meshes of the generators this
+   * one depends on, to \p hash: by default the type and the parameters of the generator.
+   * Generators that read files must also hash the contents of those files.
+   */
+  virtual void hashInputs(MeshGeneratorHash & hash) const;
+
+  /**
+   * Whether the mesh generated by this generator is stored in (and loaded from) the mesh
+   * generator cache, see MeshGeneratorCache
+   */
+  bool cacheResult() const { return _cache_result; }
+
 protected:
   /**
    * Methods for writing out attributes to the mesh meta-data store, which can be retrieved from
@@ -123,6 +137,9 @@ private:
 
   /// A nullptr to use for when inputs aren't specified
   std::unique_ptr<MeshBase> _null_mesh = nullptr;
+
+  /// Whether the generated mesh is cached
+  const bool _cache_result;
 };
 
 template <typename T>
@@ -0,0 +1,186 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseUtils.h"
+
+#include "libmesh/checkpoint_io.h"
+#include "libmesh/mesh_base.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <ftw.h>
+#include <unistd.h>
+
+/**
+ * A 64-bit FNV-1a hash of the inputs of a mesh generator.
+ *
+ * Unlike std::hash, the value only depends on the bytes that are hashed, so it is the same from
+ * one run (and one machine) to the next and can key the files of a MeshGeneratorCache.
+ */
+class MeshGeneratorHash
+{
+public:
+  /// Hashes the bytes of a string, followed by its size so that "ab","c" differs from "a","bc"
+  void update(const std::string & value)
+  {
+    update(value.data(), value.size());
+    const std::uint64_t size = value.size();
+    update(reinterpret_cast<const char *>(&size), sizeof(size));
+  }
+
+  /// Hashes the contents of a file
+  void updateFile(const std::string & file_name)
+  {
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in)
+      mooseError("Failed to open '", file_name, "' to hash it for the mesh generator cache");
+
+    char buffer[1 << 16];
+    while (in.read(buffer, sizeof(buffer)) || in.gcount())
+      update(buffer, in.gcount());
+  }
+
+  /// Hashes the value of another hash, e.g. the one of a generator this one depends on
+  void update(const MeshGeneratorHash & other) { update(other.hex()); }
+
+  std::uint64_t value() const { return _value; }
+
+  /// The hash as 16 hexadecimal digits
+  std::string hex() const
+  {
+    std::ostringstream oss;
+    oss << std::hex << std::setw(16) << std::setfill('0') << _value;
+    return oss.str();
+  }
+
+private:
+  void update(const char * data, std::size_t size)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      _value ^= static_cast<unsigned char>(data[i]);
+      _value *= 0x100000001b3ULL;
+    }
+  }
+
+  std::uint64_t _value = 0xcbf29ce484222325ULL;
+};
+
+/**
+ * Content-addressed store of generated meshes: each mesh is saved in binary in the cache
+ * directory under the hash of everything it was generated from (see MeshGenerator::hashInputs),
+ * so that rerunning the same generators, in another run or another point of a parameter sweep,
+ * loads the mesh instead of generating it again.
+ *
+ * The key also holds the number of processors and whether the mesh is distributed, since a
+ * CheckpointIO split can only be read back by a mesh of the same kind on as many processors.
+ * A mesh is written under a name unique to the writing run and then renamed to its final name,
+ * so that concurrent runs sharing the directory never see (or write over) a partial mesh. The
+ * methods are collective: rank 0 looks at the file system and broadcasts what it found, so that
+ * the ranks always agree.
+ */
+class MeshGeneratorCache
+{
+public:
+  MeshGeneratorCache(const std::string & directory) : _directory(directory) {}
+
+  const std::string & directory() const { return _directory; }
+
+  /// The file the mesh with the given hash is stored in, for meshes of the kind of \p mesh
+  std::string fileName(const MeshGeneratorHash & hash, const MeshBase & mesh) const
+  {
+    return _directory + "/" + key(hash, mesh).hex() + ".cpr";
+  }
+
+  /// Whether a mesh with the given hash has been stored for meshes of the kind of \p mesh
+  bool has(const MeshGeneratorHash & hash, const MeshBase & mesh) const
+  {
+    bool found = false;
+    if (mesh.processor_id() == 0)
+      found = MooseUtils::pathExists(fileName(hash, mesh));
+    mesh.comm().broadcast(found);
+    return found;
+  }
+
+  /// Reads the mesh with the given hash into \p mesh, which must be empty
+  void load(const MeshGeneratorHash & hash, MeshBase & mesh) const
+  {
+    if (!has(hash, mesh))
+      mooseError("The mesh ", hash.hex(), " is not in the mesh generator cache");
+
+    CheckpointIO io(mesh, true);
+    io.read(fileName(hash, mesh));
+  }
+
+  /// Stores a mesh under the given hash
+  void store(const MeshGeneratorHash & hash, const MeshBase & mesh) const
+  {
+    const std::string file_name = fileName(hash, mesh);
+
+    // Written under a name of this run, then moved into place at once
+    std::string temp_name;
+    if (mesh.processor_id() == 0)
+    {
+      MooseUtils::makedirs(_directory);
+      temp_name = file_name + ".tmp-" + uniqueSuffix();
+    }
+    mesh.comm().broadcast(temp_name);
+
+    CheckpointIO io(const_cast<MeshBase &>(mesh), true);
+    io.write(temp_name);
+    mesh.comm().barrier();
+
+    if (mesh.processor_id() == 0 && std::rename(temp_name.c_str(), file_name.c_str()) != 0)
+    {
+      // A concurrent run stored the same mesh first: keep its copy
+      if (!MooseUtils::pathExists(file_name))
+        mooseError("Failed to move the mesh '", temp_name, "' into the mesh generator cache");
+      removeTree(temp_name);
+    }
+    mesh.comm().barrier();
+  }
+
+private:
+  /// The hash of the inputs combined with the number of processors and the parallel mesh type
+  static MeshGeneratorHash key(const MeshGeneratorHash & hash, const MeshBase & mesh)
+  {
+    MeshGeneratorHash key = hash;
+    key.update(std::to_string(mesh.n_processors()));
+    key.update(mesh.is_replicated() ? "replicated" : "distributed");
+    return key;
+  }
+
+  /// A suffix no other run writing to the directory uses: host, process and time
+  static std::string uniqueSuffix()
+  {
+    char host[256] = {};
+    gethostname(host, sizeof(host) - 1);
+    return std::string(host) + "-" + std::to_string(getpid()) + "-" +
+           std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+
+  /// Removes a file, or a directory and everything in it
+  static void removeTree(const std::string & path)
+  {
+    auto remove = [](const char * name, const struct stat *, int, struct FTW *)
+    { return std::remove(name); };
+    nftw(path.c_str(), remove, 16, FTW_DEPTH | FTW_PHYS);
+  }
+
+  const std::string _directory;
+};
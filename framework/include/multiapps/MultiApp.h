@@ -147,6 +147,14 @@ public:
    */
   virtual bool needsRestoration() { return true; }
 
+  /**
+   * Moves apps between processors so that the solve times measured since the last rebalance are
+   * evenly spread, if their imbalance (see MultiAppScheduling::imbalance()) exceeds
+   * "rebalance_threshold". Collective on the original communicator; only done every
+   * "rebalance_interval" calls and with one processor per app.
+   */
+  virtual void rebalance();
+
   /**
    * @param app The global app number to get the Executioner for
    * @return The Executioner associated with that App.
@@ -303,7 +311,10 @@ protected:
   /**
    * Create an MPI communicator suitable for each app.
    *
-   * Also find out which communicator we are using and what our first local app is.
+   * Also find out which communicator we are using and what our first local app is. With
+   * "app_costs", the contiguous range of apps of each processor (or the number of processors of
+   * each app when there are fewer apps than processors) is chosen from the costs, see
+   * MultiAppScheduling, instead of splitting the app count evenly.
    */
   void buildComm();
 
@@ -339,6 +350,21 @@ protected:
    */
   void keepSolutionDuringRestore(bool keep_solution_during_restore);
 
+  /**
+   * Moves the apps to the new contiguous ranges of each processor: the current owner of each
+   * migrating app backs it up and sends the serialized Backup, and the new owner creates the app
+   * and restores it, so the app continues from exactly the same state
+   *
+   * @param offsets The first app of each processor, followed by the number of apps
+   */
+  void migrateApps(const std::vector<unsigned int> & offsets);
+
+  /// Adds the time spent solving a local app, to drive rebalance()
+  void recordAppSolveTime(unsigned int local_app, Real seconds)
+  {
+    _local_app_solve_times[local_app] += seconds;
+  }
+
   /// The FEProblemBase this MultiApp is part of
   FEProblemBase & _fe_problem;
 
@@ -405,6 +431,26 @@ protected:
   /// Maximum number of processors to give to each app
   unsigned int _max_procs_per_app;
 
+  /// The expected relative cost of each app, empty for the same cost for all of them
+  std::vector<Real> _app_costs;
+
+  /// Whether apps are moved between processors based on their measured solve time
+  const bool _rebalance;
+  /// The imbalance above which the apps are moved
+  const Real _rebalance_threshold;
+  /// The number of calls to rebalance() between two checks of the imbalance
+  const unsigned int _rebalance_interval;
+  /// The number of calls to rebalance() since the last check
+  unsigned int _rebalance_calls = 0;
+  /// The time spent solving each local app since the last check
+  std::vector<Real> _local_app_solve_times;
+
+  /**
+   * Whether backup() and restore() snapshot the sub-apps in memory (MooseApp::backupInMemory())
+   * instead of serializing them, as long as their meshes do not change
+   */
+  const bool _in_memory_backup;
+
   /// Whether or not to move the output of the MultiApp into position
   bool _output_in_position;
 
@@ -452,6 +498,7 @@ private:
   PerfID _perf_restore;
   PerfID _perf_init;
   PerfID _perf_reset_app;
+  PerfID _perf_rebalance;
 };
 
 template <>
@@ -0,0 +1,180 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+/**
+ * Cost-aware assignment of the apps of a MultiApp to processors.
+ *
+ * The apps stay assigned in contiguous ranges of global app numbers (so that the local apps of a
+ * processor are still firstLocalApp() + i), but the ranges are chosen from the expected (or
+ * measured) cost of each app instead of from the app count alone.
+ */
+namespace MultiAppScheduling
+{
+/**
+ * Splits the apps into n_groups contiguous ranges that minimize the cost of the most expensive
+ * range, by bisection on that cost with a greedy feasibility check.
+ *
+ * @param costs The cost of each app
+ * @param n_groups The number of ranges (processors that each run apps serially)
+ * @return The first app of each range followed by the number of apps (n_groups + 1 entries);
+ *         ranges may be empty when some apps cost much more than others
+ */
+inline std::vector<unsigned int>
+contiguousPartition(const std::vector<Real> & costs, unsigned int n_groups)
+{
+  mooseAssert(n_groups > 0, "At least one group is needed");
+  const unsigned int n_apps = costs.size();
+
+  // The number of ranges needed when none may cost more than bound; fills the offsets
+  auto fill = [&costs, n_apps](Real bound, std::vector<unsigned int> & offsets)
+  {
+    offsets.assign(1, 0);
+    Real sum = 0;
+    for (unsigned int i = 0; i < n_apps; ++i)
+    {
+      if (sum + costs[i] > bound && sum > 0)
+      {
+        offsets.push_back(i);
+        sum = 0;
+      }
+      sum += costs[i];
+    }
+    offsets.push_back(n_apps);
+    return offsets.size() - 1;
+  };
+
+  Real low = costs.empty() ? 0 : *std::max_element(costs.begin(), costs.end());
+  Real high = std::accumulate(costs.begin(), costs.end(), Real(0));
+  std::vector<unsigned int> offsets;
+  for (unsigned int it = 0; it < 64 && high - low > 1e-12 * high; ++it)
+  {
+    const Real mid = 0.5 * (low + high);
+    if (fill(mid, offsets) <= n_groups)
+      high = mid;
+    else
+      low = mid;
+  }
+  fill(high, offsets);
+
+  // Spread the apps of trailing empty ranges: give every range one app while there are enough
+  offsets.resize(n_groups + 1, n_apps);
+  for (unsigned int g = n_groups; g-- > 1;)
+    if (offsets[g] >= offsets[g + 1] && offsets[g + 1] > g)
+      offsets[g] = offsets[g + 1] - 1;
+  return offsets;
+}
+
+/**
+ * The number of processors given to each app when there are fewer apps than processors: at
+ * least one each, the others handed out in proportion to the costs (largest remainder first)
+ * without exceeding max_procs_per_app.
+ *
+ * @return The number of processors of each app; they may add up to less than n_procs when
+ *         max_procs_per_app caps them
+ */
+inline std::vector<unsigned int>
+processorsPerApp(const std::vector<Real> & costs,
+                 unsigned int n_procs,
+                 unsigned int max_procs_per_app)
+{
+  const unsigned int n_apps = costs.size();
+  mooseAssert(n_apps <= n_procs, "There must be at least one processor per app");
+
+  std::vector<unsigned int> procs(n_apps, 1);
+  const Real total = std::accumulate(costs.begin(), costs.end(), Real(0));
+  unsigned int spare = n_procs - n_apps;
+  if (!spare || total <= 0)
+    return procs;
+
+  std::vector<Real> share(n_apps);
+  for (unsigned int i = 0; i < n_apps; ++i)
+  {
+    const Real ideal = costs[i] / total * n_procs;
+    const unsigned int extra = std::min<unsigned int>(
+        std::max(ideal - 1, Real(0)), std::min(spare, max_procs_per_app - procs[i]));
+    procs[i] += extra;
+    spare -= extra;
+    share[i] = ideal - procs[i];
+  }
+
+  std::vector<unsigned int> order(n_apps);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(),
+                   order.end(),
+                   [&share](unsigned int a, unsigned int b) { return share[a] > share[b]; });
+  for (unsigned int k = 0; spare && k < n_apps; ++k)
+    if (procs[order[k]] < max_procs_per_app)
+    {
+      ++procs[order[k]];
+      --spare;
+    }
+
+  return procs;
+}
+
+/// An app that changes processor group when going from one partition to another
+struct Migration
+{
+  unsigned int app;
+  unsigned int from;
+  unsigned int to;
+};
+
+/**
+ * The apps that change group between two partitions of the same apps (see contiguousPartition()),
+ * in increasing app order
+ */
+inline std::vector<Migration>
+migrations(const std::vector<unsigned int> & old_offsets,
+           const std::vector<unsigned int> & new_offsets)
+{
+  mooseAssert(old_offsets.back() == new_offsets.back(), "The partitions have different app counts");
+
+  std::vector<Migration> result;
+  unsigned int from = 0, to = 0;
+  for (unsigned int app = 0; app < old_offsets.back(); ++app)
+  {
+    while (old_offsets[from + 1] <= app)
+      ++from;
+    while (new_offsets[to + 1] <= app)
+      ++to;
+    if (from != to)
+      result.push_back({app, from, to});
+  }
+  return result;
+}
+
+/**
+ * The load imbalance of a partition: the cost of the most expensive range over the mean cost of
+ * a range, 1 for a perfect balance
+ */
+inline Real
+imbalance(const std::vector<Real> & costs, const std::vector<unsigned int> & offsets)
+{
+  const unsigned int n_groups = offsets.size() - 1;
+  Real max_cost = 0, total = 0;
+  for (unsigned int g = 0; g < n_groups; ++g)
+  {
+    const Real cost =
+        std::accumulate(costs.begin() + offsets[g], costs.begin() + offsets[g + 1], Real(0));
+    max_cost = std::max(max_cost, cost);
+    total += cost;
+  }
+  return total > 0 ? max_cost * n_groups / total : 1;
+}
+}
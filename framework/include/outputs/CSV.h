@@ -103,6 +103,14 @@ private:
   /// Flag for sorting column names
   const bool _sort_columns;
 
+  /**
+   * Flag for streaming: only the new rows are appended to the files, flushed every
+   * "flush_interval" outputs, the tables only keep the last "max_rows_in_memory" rows, and each
+   * vector postprocessor is appended to a single file with a leading time column instead of
+   * rewriting one file per output
+   */
+  const bool _streaming;
+
   /// Flag indicating MOOSE is recovering via --recover command-line option
   bool _recovering;
 
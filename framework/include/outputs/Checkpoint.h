@@ -12,8 +12,11 @@
 // MOOSE includes
 #include "FileOutput.h"
 #include "RestartableDataIO.h"
+#include "CheckpointSnapshot.h"
+#include "AsyncTaskQueue.h"
 
 #include <deque>
+#include <mutex>
 
 // Forward declarations
 class Checkpoint;
@@ -73,6 +76,26 @@ public:
     return is_binary ? BINARY_MESH_SUFFIX : ASCII_MESH_SUFFIX;
   }
 
+  /**
+   * Waits for the checkpoints being written in the background to be complete, e.g. before the
+   * end of the run or a recovery
+   */
+  void waitForAsyncOutput()
+  {
+    if (_async_queue)
+    {
+      try
+      {
+        _async_queue->wait();
+      }
+      catch (const std::exception & e)
+      {
+        mooseError("Writing a checkpoint in the background failed: ", e.what());
+      }
+    }
+    collectCompletedCheckpoints();
+  }
+
 protected:
   /**
    * Outputs a checkpoint file.
@@ -83,9 +106,34 @@ protected:
 private:
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Stages the checkpoint (the restartable data in memory, the mesh and systems in the staging
+   * directory, the only collective part) and queues its write to the checkpoint directory
+   */
+  void outputAsync();
+
+  /// Lists the checkpoints whose background write completed, see updateCheckpointFiles()
+  void collectCompletedCheckpoints()
+  {
+    std::vector<CheckpointFileNames> completed;
+    {
+      std::lock_guard<std::mutex> lock(_completed_mutex);
+      completed.swap(_completed);
+    }
+    for (auto & file_names : completed)
+      updateCheckpointFiles(std::move(file_names));
+  }
+
   /// Max no. of output files to store
   unsigned int _num_files;
 
+  /**
+   * Every how many checkpoints the restartable data is written in full ("full_interval"), the
+   * others holding the changed entries only; 0 for full checkpoints only. The files of a chain are
+   * only removed when a newer full checkpoint is kept, so that the kept ones can be recovered.
+   */
+  const unsigned int _full_interval;
+
   /// Directory suffix
   const std::string _suffix;
 
@@ -95,6 +143,9 @@ private:
   /// True if running with parallel mesh
   bool _parallel_mesh;
 
+  /// True if writing the restartable data in the indexed, memory-mappable format
+  const bool _indexed;
+
   /// Reference to the restartable data
   const RestartableDataMaps & _restartable_data;
 
@@ -104,6 +155,20 @@ private:
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
 
+  /// Whether the checkpoints are written in the background ("asynchronous")
+  const bool _async;
+
+  /// The directory the mesh and systems are staged in, e.g. on a node-local burst buffer
+  const std::string _staging_directory;
+
+  /// The background writer when _async is set
+  std::unique_ptr<AsyncTaskQueue> _async_queue;
+
+  ///@{ The checkpoints written in the background since the last collectCompletedCheckpoints()
+  std::vector<CheckpointFileNames> _completed;
+  std::mutex _completed_mutex;
+  ///@}
+
   static constexpr auto ASCII_MESH_SUFFIX = "_mesh.cpa";
   static constexpr auto BINARY_MESH_SUFFIX = "_mesh.cpr";
 };
@@ -11,6 +11,8 @@
 
 // MOOSE includes
 #include "TableOutput.h"
+#include "BufferedConsoleWriter.h"
+#include "ProgressLine.h"
 
 // Forward declarations
 class Console;
@@ -160,6 +162,22 @@ protected:
    */
   void writeVariableNorms();
 
+  /**
+   * Writes the ProgressLine of the step that just finished, from the iteration counts of the
+   * nonlinear system and the elapsed time of the PerfGraph
+   */
+  void writeProgressLine();
+
+  /**
+   * Writes the messages collected by the buffered writer and waits for them, before anything
+   * writes to the screen directly (the PETSc monitors); see OutputWarehouse::flushConsoleBuffer()
+   */
+  void syncBufferedOutput()
+  {
+    if (_buffered_writer)
+      _buffered_writer->sync();
+  }
+
   /// The max number of table rows
   unsigned int _max_rows;
 
@@ -172,6 +190,18 @@ protected:
   /// Flag for controlling outputting console information to a file
   bool _write_file;
 
+  /**
+   * The writer of the screen output in "buffered" mode: the messages are collected in memory and
+   * written by a background thread of the root processor only, in large chunks (null otherwise)
+   */
+  std::unique_ptr<BufferedConsoleWriter> _buffered_writer;
+
+  /// Whether a compact progress line is printed at the end of every time step ("progress_line")
+  const bool _progress_line;
+
+  /// The builder of the progress lines
+  ProgressLine _progress;
+
   /// Flag for controlling outputting console information to screen
   bool _write_screen;
 
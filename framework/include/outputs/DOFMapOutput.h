@@ -37,7 +37,8 @@ public:
   virtual std::string filename() override;
 
   /**
-   * Write the DOF mapt
+   * Write the DOF map, with the dof ordering and the Jacobian bandwidth of the system (see
+   * SystemBase::dofBandwidth())
    */
   void output(const ExecFlagType & type) override;
 
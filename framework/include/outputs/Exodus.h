@@ -11,6 +11,7 @@
 
 // MOOSE includes
 #include "OversampleOutput.h"
+#include "AsyncTaskQueue.h"
 
 // Forward declarations
 class Exodus;
@@ -165,6 +166,22 @@ protected:
    */
   bool _exodus_initialized;
 
+  /**
+   * Waits for the pending asynchronous writes to finish. Must be called before the output object
+   * is modified or the file is closed (e.g. when the mesh changes).
+   */
+  void waitForAsyncOutput();
+
+  /// Whether the files are written on a background thread, while the solve continues
+  const bool _async;
+
+  /**
+   * Background writer when _async is set. The solution is staged on the calling thread (which
+   * does the parallel communication), and the staged copy is written by a queued task, so that
+   * up to two outputs are in flight. While tasks are pending only they may use the IO object.
+   */
+  std::unique_ptr<AsyncTaskQueue> _async_queue;
+
 private:
   /**
    * A helper function for 'initializing' the ExodusII output file, see the comments for the
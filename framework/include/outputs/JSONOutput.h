@@ -12,6 +12,8 @@
 #include "nlohmann/json.h"
 #include "AdvancedOutput.h"
 
+#include <fstream>
+
 class JSONOutput : public AdvancedOutput
 {
 public:
@@ -25,7 +27,39 @@ protected:
   virtual std::string filename() override;
   const ReporterData & _reporter_data;
 
+  /// Add the time and hardware counter totals of the counted PerfGraph sections to the output
+  void outputHardwareCounters();
+
 private:
+  /// Whether or not to output the PerfGraph hardware counters
+  const bool _hardware_counters;
+
+  /**
+   * Whether or not to stream the output as JSON lines: each output appends its record to the
+   * file (flushed every "flush_interval" outputs) and is then dropped from _json, instead of
+   * rewriting the whole history every time
+   */
+  const bool _streaming;
+
+  /// The file the records are appended to when streaming
+  std::ofstream _stream_file;
+
+  /// Number of records appended since the last flush
+  unsigned int _num_unflushed;
+
+  /**
+   * Whether the Reporter values produced in DISTRIBUTED mode are written by every processor, each
+   * its slice, to its own file (see distributedFilename()), the other values being written by the
+   * root processor only, instead of every processor writing all the values
+   */
+  const bool _distributed_slices;
+
+  /// The file of the slices of this processor: the file name with ".<n_procs>.<proc_id>" appended
+  std::string distributedFilename();
+
+  /// The JSON node of the distributed slices of this processor
+  nlohmann::json _distributed_json;
+
   /// The root JSON node for output
   nlohmann::json _json;
 };
@@ -11,6 +11,7 @@
 
 // MOOSE includes
 #include "AdvancedOutput.h"
+#include "AsyncTaskQueue.h"
 
 // Forward declarations
 class Nemesis;
@@ -88,6 +89,15 @@ protected:
   /// Current output filename; utilized by filename() to create the proper suffix
   unsigned int _file_num;
 
+  /// Waits for the pending background writes, see Exodus::waitForAsyncOutput()
+  void waitForAsyncOutput();
+
+  /// Whether each rank writes its file on a background thread
+  const bool _async;
+
+  /// Writes the staged per-rank data when _async is set; the only user of _nemesis_io_ptr then
+  std::unique_ptr<AsyncTaskQueue> _async_queue;
+
 private:
   /// Count of outputs per exodus file
   unsigned int _nemesis_num;
@@ -11,6 +11,7 @@
 
 // MOOSE includes
 #include "AdvancedOutput.h"
+#include "OversampleInterpolation.h"
 
 // Forward declerations
 class OversampleOutput;
@@ -83,6 +84,12 @@ private:
    */
   void cloneMesh();
 
+  /**
+   * Builds _interpolations: locates the nodes of the oversampled mesh in the source mesh once and
+   * stores, for every variable, the source shape functions at their reference coordinates
+   */
+  void buildInterpolations();
+
   /**
    * A vector of pointers to the mesh functions
    * This is only populated when the oversample() function is called, it must
@@ -90,6 +97,13 @@ private:
    */
   std::vector<std::vector<std::unique_ptr<MeshFunction>>> _mesh_functions;
 
+  /**
+   * The interpolation of every variable (by system, then variable) onto the oversampled mesh,
+   * rebuilt after mesh changes; updateOversample() applies them in parallel over the variables
+   * instead of evaluating the mesh functions node by node
+   */
+  std::vector<std::vector<OversampleInterpolation>> _interpolations;
+
   /// When oversampling, the output is shift by this amount
   Point _position;
 
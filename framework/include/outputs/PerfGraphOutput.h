@@ -38,5 +38,11 @@ protected:
   bool _heaviest_branch;
 
   unsigned int _heaviest_sections;
+
+  /// Whether to print the per-thread and per-rank time of the threaded loops and their imbalance
+  bool _thread_imbalance;
+
+  /// Whether to print the hardware counter totals of the counted sections
+  bool _hardware_counters;
 };
 
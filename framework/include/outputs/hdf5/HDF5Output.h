@@ -0,0 +1,117 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseConfig.h"
+#ifdef MOOSE_HAVE_HDF5
+
+// HDF5 includes
+#include <hdf5.h>
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+
+/**
+ * Writes the mesh, the nodal and elemental variables, the postprocessors and the reporters of
+ * all ranks into a single file with collective parallel HDF5 I/O.
+ *
+ * The file layout is
+ *
+ * @begincode
+ * /mesh/<n>/coordinates          (num_nodes x 3, global node order)
+ * /mesh/<n>/connectivity         (num_elem x nodes_per_elem, one dataset per element type)
+ * /steps/<k>                     (attributes: time, time step, mesh <n>)
+ * /steps/<k>/nodal/<variable>    (num_nodes)
+ * /steps/<k>/elemental/<variable>(num_elem)
+ * /steps/<k>/postprocessors      (compound of name, value)
+ * /steps/<k>/reporters/<name>    (JSON string)
+ * @endcode
+ *
+ * The mesh is written once and only rewritten (as a new /mesh/<n>) when it changes; every step
+ * only appends its fields. Each rank writes the contiguous range of the global node and element
+ * ids that it owns, so a single collective write per dataset is made. Datasets are optionally
+ * chunked and deflate-compressed (which requires HDF5 1.10.2 or newer in parallel), and the
+ * number of MPI-IO aggregators ("cb_nodes") can be set to match the file system striping.
+ */
+class HDF5Output : public AdvancedOutput
+{
+public:
+  static InputParameters validParams();
+
+  HDF5Output(const InputParameters & parameters);
+  virtual ~HDF5Output();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+  virtual void outputNodalVariables() override;
+  virtual void outputElementalVariables() override;
+  virtual void outputPostprocessors() override;
+  virtual void outputReporters() override;
+  virtual void outputScalarVariables() override;
+
+  /// Returns the file name with the .h5 extension
+  virtual std::string filename() override;
+
+  /// Opens (or creates) the file collectively with the MPI-IO file access property list
+  void openFile();
+
+  /// Writes the mesh as a new /mesh/<n> group
+  void outputMesh();
+
+  /**
+   * Writes a distributed array collectively: this rank holds the rows [offset, offset + size) of
+   * the global_size x num_columns dataset
+   */
+  void writeDistributed(hid_t group,
+                        const std::string & name,
+                        const std::vector<Real> & local,
+                        hsize_t global_size,
+                        hsize_t offset,
+                        hsize_t num_columns = 1);
+
+  /// The dataset creation property list: chunking and compression
+  hid_t datasetProperties(hsize_t global_size, hsize_t num_columns) const;
+
+  /// The file
+  hid_t _file_id;
+
+  /// The group of the current step
+  hid_t _step_group;
+
+  /// Index of the next step
+  unsigned int & _num_steps;
+
+  /// Index of the current mesh group
+  unsigned int & _num_meshes;
+
+  /// Whether the mesh must be written before the next step
+  bool _mesh_changed;
+
+  /// Deflate level, 0 for no compression
+  const unsigned int _compression;
+
+  /// Number of rows in a chunk of each dataset, 0 for contiguous datasets
+  const hsize_t _chunk_size;
+
+  /// Number of MPI-IO aggregators, 0 for the MPI-IO default
+  const unsigned int _aggregators;
+
+  ///@{ The global id range of the nodes and elements written by this rank
+  dof_id_type _node_offset;
+  dof_id_type _num_local_nodes;
+  dof_id_type _elem_offset;
+  dof_id_type _num_local_elems;
+  ///@}
+};
+
+#endif
@@ -0,0 +1,122 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseConfig.h"
+#ifdef MOOSE_HAVE_CATALYST
+
+// Catalyst includes
+#include <catalyst.h>
+
+// MOOSE includes
+#include "InSituAdaptor.h"
+#include "MooseError.h"
+
+#include <type_traits>
+
+/**
+ * Runs ParaView Catalyst (2.x) pipelines on the output. Each element block is described as one
+ * Catalyst channel following the Conduit mesh blueprint, with every array passed as an external
+ * (not copied) Conduit array.
+ */
+class CatalystAdaptor : public InSituAdaptor
+{
+public:
+  /// @param scripts The Catalyst Python scripts to run
+  CatalystAdaptor(const std::vector<std::string> & scripts)
+  {
+    conduit_node * params = conduit_node_create();
+    for (std::size_t i = 0; i < scripts.size(); ++i)
+      conduit_node_set_path_char8_str(
+          params, ("catalyst/scripts/script" + std::to_string(i)).c_str(), scripts[i].c_str());
+
+    const auto status = catalyst_initialize(params);
+    conduit_node_destroy(params);
+    if (status != catalyst_status_ok)
+      mooseError("Catalyst failed to initialize (status ", int(status), ")");
+  }
+
+  virtual ~CatalystAdaptor()
+  {
+    conduit_node * params = conduit_node_create();
+    catalyst_finalize(params);
+    conduit_node_destroy(params);
+  }
+
+  virtual void execute(unsigned int step,
+                       Real time,
+                       const MeshView & mesh,
+                       bool /*mesh_changed*/,
+                       const std::vector<FieldView> & fields) override
+  {
+    static_assert(std::is_same<Real, conduit_float64>::value,
+                  "Catalyst output requires Real to be a double");
+
+    conduit_node * node = conduit_node_create();
+    conduit_node_set_path_int64(node, "catalyst/state/timestep", step);
+    conduit_node_set_path_float64(node, "catalyst/state/time", time);
+
+    std::size_t elem_offset = 0;
+    for (const auto & block : mesh.blocks)
+    {
+      const std::string channel = "catalyst/channels/" + block.shape + "/";
+      const std::string data = channel + "data/";
+      const auto num_elem = block.connectivity.size() / block.nodes_per_elem;
+
+      conduit_node_set_path_char8_str(node, (channel + "type").c_str(), "mesh");
+
+      conduit_node_set_path_char8_str(node, (data + "coordsets/coords/type").c_str(), "explicit");
+      setExternal(node, data + "coordsets/coords/values/x", mesh.x.data(), mesh.x.size());
+      setExternal(node, data + "coordsets/coords/values/y", mesh.y.data(), mesh.y.size());
+      setExternal(node, data + "coordsets/coords/values/z", mesh.z.data(), mesh.z.size());
+
+      const std::string topology = data + "topologies/mesh/";
+      conduit_node_set_path_char8_str(node, (topology + "type").c_str(), "unstructured");
+      conduit_node_set_path_char8_str(node, (topology + "coordset").c_str(), "coords");
+      conduit_node_set_path_char8_str(
+          node, (topology + "elements/shape").c_str(), block.shape.c_str());
+      conduit_node_set_path_external_int64_ptr(
+          node,
+          (topology + "elements/connectivity").c_str(),
+          const_cast<conduit_int64 *>(block.connectivity.data()),
+          block.connectivity.size());
+
+      for (const auto & field : fields)
+      {
+        const std::string path = data + "fields/" + field.name + "/";
+        conduit_node_set_path_char8_str(
+            node, (path + "association").c_str(), field.nodal ? "vertex" : "element");
+        conduit_node_set_path_char8_str(node, (path + "topology").c_str(), "mesh");
+        conduit_node_set_path_char8_str(node, (path + "volume_dependent").c_str(), "false");
+        if (field.nodal)
+          setExternal(node, path + "values", field.values, field.size);
+        else
+          setExternal(node, path + "values", field.values + elem_offset, num_elem);
+      }
+
+      elem_offset += num_elem;
+    }
+
+    const auto status = catalyst_execute(node);
+    conduit_node_destroy(node);
+    if (status != catalyst_status_ok)
+      mooseError("Catalyst failed to execute (status ", int(status), ")");
+  }
+
+private:
+  static void
+  setExternal(conduit_node * node, const std::string & path, const Real * values, std::size_t size)
+  {
+    conduit_node_set_path_external_float64_ptr(
+        node, path.c_str(), const_cast<conduit_float64 *>(values), size);
+  }
+};
+
+#endif
@@ -0,0 +1,74 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Interface between InSituOutput and an in-situ analysis or visualization pipeline.
+ *
+ * The adaptor receives views of the local part of the mesh and of the output variables. The
+ * arrays are owned by InSituOutput and stay valid until the next call to execute(), so that an
+ * adaptor can pass them to the pipeline without copying them.
+ */
+class InSituAdaptor
+{
+public:
+  /// The local elements of one shape
+  struct ElementBlock
+  {
+    /// Shape name, as in the Conduit mesh blueprint ("hex", "tet", "quad", "tri", "line")
+    std::string shape;
+    unsigned int nodes_per_elem;
+    /// Local node indices, nodes_per_elem per element
+    std::vector<std::int64_t> connectivity;
+  };
+
+  /// The local part of the mesh
+  struct MeshView
+  {
+    ///@{ Node coordinates, indexed by local node index
+    std::vector<Real> x;
+    std::vector<Real> y;
+    std::vector<Real> z;
+    ///@}
+    /// The elements, grouped by shape
+    std::vector<ElementBlock> blocks;
+  };
+
+  /// The local values of a variable
+  struct FieldView
+  {
+    std::string name;
+    /// Whether the values are given at the nodes (or else at the elements)
+    bool nodal;
+    /// Indexed by local node index, or by element in the order of the blocks
+    const Real * values;
+    std::size_t size;
+  };
+
+  virtual ~InSituAdaptor() = default;
+
+  /**
+   * Runs the pipeline.
+   * @param step Index of the output
+   * @param time Simulation time
+   * @param mesh_changed Whether the mesh differs from the one of the previous call
+   */
+  virtual void execute(unsigned int step,
+                       Real time,
+                       const MeshView & mesh,
+                       bool mesh_changed,
+                       const std::vector<FieldView> & fields) = 0;
+};
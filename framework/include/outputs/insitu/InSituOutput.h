@@ -0,0 +1,74 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+#include "InSituAdaptor.h"
+
+// C++ includes
+#include <unordered_map>
+
+/**
+ * Hands the local mesh and the selected nodal and elemental variables to an in-situ pipeline
+ * (see InSituAdaptor) on the execute_on flags, instead of writing them to a file.
+ *
+ * The mesh view is only rebuilt when the mesh changes; the variable values are gathered into
+ * arrays that are reused from one output to the next, and the adaptor passes these arrays to
+ * the pipeline without copying them. The "catalyst" adaptor (ParaView Catalyst 2, available
+ * when MOOSE is configured with --with-catalyst) runs the Python scripts given in "scripts".
+ * Applications provide other pipelines by overriding createAdaptor().
+ */
+class InSituOutput : public AdvancedOutput
+{
+public:
+  static InputParameters validParams();
+
+  InSituOutput(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  /// Builds the adaptor selected by the "adaptor" parameter
+  virtual std::unique_ptr<InSituAdaptor> createAdaptor();
+
+  /// Rebuilds _mesh_view from the local elements and their nodes
+  void stageMesh();
+
+  /// Gathers the values of the output variables into _field_values
+  void stageFields();
+
+  /// The pipeline
+  std::unique_ptr<InSituAdaptor> _adaptor;
+
+  /// The local mesh
+  InSituAdaptor::MeshView _mesh_view;
+
+  /// The local node index of each node in _mesh_view
+  std::unordered_map<dof_id_type, std::int64_t> _local_node_index;
+
+  /// The local elements in the order of the blocks of _mesh_view
+  std::vector<const Elem *> _elems;
+
+  /// The values of each output variable
+  std::vector<std::vector<Real>> _field_values;
+
+  /// The views of _field_values given to the adaptor
+  std::vector<InSituAdaptor::FieldView> _fields;
+
+  /// Whether the mesh must be restaged before the next output
+  bool _mesh_changed;
+
+  /// Index of the next output
+  unsigned int _step;
+};
@@ -11,6 +11,7 @@
 
 // MOOSE includes
 #include "ConsoleStreamInterface.h"
+#include "PerfGraphInterface.h"
 #include "MooseTypes.h"
 #include "InputParameters.h"
 #include "Syntax.h"
@@ -49,7 +50,7 @@ public:
  * parsing files. It is not currently designed for extensibility. If you wish to build your own
  * parser, please contact the MOOSE team for guidance.
  */
-class Parser : public ConsoleStreamInterface, public hit::Walker
+class Parser : public ConsoleStreamInterface, public PerfGraphInterface, public hit::Walker
 {
 public:
   enum SyntaxFormatterType
@@ -73,6 +74,17 @@ public:
    */
   void parse(const std::string & input_filename);
 
+  /**
+   * The trees of the input files parsed in this process, shared by the Parsers of all the apps:
+   * parse() reads the input files through it, so that the sub-apps of a MultiApp reading the same
+   * input only parse it once
+   */
+  static hit::ParseCache & parseCache()
+  {
+    static hit::ParseCache cache;
+    return cache;
+  }
+
   /**
    * This function attempts to extract values from the input file based on the contents of
    * the passed parameters objects.  It handles a number of various types with dynamic casting
@@ -223,6 +235,11 @@ protected:
   /// The current stream object used for capturing errors during extraction
   std::ostringstream * _current_error_stream;
 
+  /// Timers
+  PerfID _parse_timer;
+  PerfID _walk_timer;
+  PerfID _extract_params_timer;
+
 private:
   std::string _errmsg;
   std::string _warnmsg;
@@ -0,0 +1,70 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// MOOSE includes
+#include "MooseEnum.h"
+#include "PetscExternalPartitioner.h"
+
+class FEProblemBase;
+class MooseMesh;
+
+/**
+ * Partition a mesh with element weights given by the measured cost of each element.
+ *
+ * The costs come either from the per-element timings recorded by the threaded element loops (see
+ * ElementLoopCostModel and FEProblemBase::elementLoopCostModel()) or from a user-supplied
+ * elemental auxiliary variable. They are scaled to integer graph weights relative to the
+ * cheapest element and handed to the weighted ParMETIS/PT-Scotch graph partitioning of
+ * PetscExternalPartitioner.
+ */
+class CostWeightedPartitioner : public PetscExternalPartitioner
+{
+public:
+  static InputParameters validParams();
+
+  CostWeightedPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  virtual dof_id_type computeElementWeight(Elem & elm) override;
+
+  /**
+   * The load imbalance of the current partitioning: the maximum over all processors of the summed
+   * local element costs, divided by the mean. A value of 1 is a perfect balance.
+   */
+  Real imbalance() const;
+
+protected:
+  /// Set up the cost range before the weights are computed
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /// The cost of an element, from the selected source
+  Real elementCost(const Elem & elem) const;
+
+  /// Where the element costs come from
+  const MooseEnum _cost_source;
+
+  /// The elemental variable holding the costs (cost_source = variable)
+  const VariableName * const _cost_variable;
+
+  /// Integer weight assigned to the most expensive element
+  const dof_id_type _max_weight;
+
+  /**
+   * The problem, for the measured costs and the cost variable. The initial partitioning happens
+   * before the problem exists, in which case every element gets the same weight.
+   */
+  FEProblemBase * feProblem() const;
+
+  /// The cost range of the elements being partitioned
+  Real _min_cost;
+  Real _max_cost;
+};
@@ -0,0 +1,112 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Decides whether repartitioning a mesh pays off, from the load of each processor: the number of
+ * active elements after refinement and the size of their stateful material data, which both the
+ * work of a step and the migration grow with.
+ *
+ * The step time is set by the most loaded processor, so a balanced partitioning saves
+ * step_time * (1 - mean / max) per step; over the steps until the next decision (the horizon)
+ * that saving must exceed the cost of the migration: the data above the mean load leaving the
+ * overloaded processors, at the given bandwidth, plus the partitioning itself.
+ */
+class RepartitionCostModel
+{
+public:
+  /**
+   * @param threshold The imbalance (max / mean load) below which the mesh is never repartitioned
+   * @param horizon The number of steps the balance is expected to be kept for
+   * @param bytes_per_element The size of the migrated data of an element besides its stateful
+   *                          properties (mesh, dofs, solution vectors)
+   * @param bandwidth The migration bandwidth of a processor, in bytes per second
+   */
+  RepartitionCostModel(Real threshold = 1.2,
+                       Real horizon = 10,
+                       Real bytes_per_element = 1024,
+                       Real bandwidth = 1e9)
+    : _threshold(threshold),
+      _horizon(horizon),
+      _bytes_per_element(bytes_per_element),
+      _bandwidth(bandwidth)
+  {
+    if (threshold < 1)
+      mooseError("The repartitioning imbalance threshold must be at least 1");
+    if (horizon <= 0 || bandwidth <= 0 || bytes_per_element < 0)
+      mooseError("The repartitioning horizon, bandwidth and element size must be positive");
+  }
+
+  /**
+   * Whether repartitioning pays off
+   * @param elements The number of active elements of each processor
+   * @param stateful_bytes The size of the stateful material data of each processor
+   * @param step_time The wall time of a step
+   */
+  bool shouldRepartition(const std::vector<Real> & elements,
+                         const std::vector<Real> & stateful_bytes,
+                         Real step_time)
+  {
+    mooseAssert(elements.size() == stateful_bytes.size(), "One load per processor");
+    _imbalance = 1;
+    _saving = _migration_cost = 0;
+    if (elements.size() < 2)
+      return false;
+
+    // The load of a processor, in bytes: the work of a step scales like the data of its elements
+    std::vector<Real> load(elements.size());
+    for (std::size_t p = 0; p < elements.size(); ++p)
+      load[p] = elements[p] * _bytes_per_element + stateful_bytes[p];
+
+    Real total = 0;
+    for (const auto l : load)
+      total += l;
+    const Real max = *std::max_element(load.begin(), load.end());
+    if (!(max > 0))
+      return false;
+    const Real mean = total / load.size();
+    _imbalance = max / mean;
+
+    _saving = _horizon * step_time * (1 - mean / max);
+
+    // The overloaded processors send their excess concurrently, the most loaded one the most
+    _migration_cost = (max - mean) / _bandwidth + _partition_time;
+
+    return _imbalance > _threshold && _saving > _migration_cost;
+  }
+
+  /// Records the wall time of a repartitioning, the fixed part of the migration cost
+  void recordPartitionTime(Real time) { _partition_time = time; }
+
+  ///@{ The figures of the last decision
+  Real imbalance() const { return _imbalance; }
+  Real projectedSaving() const { return _saving; }
+  Real migrationCost() const { return _migration_cost; }
+  ///@}
+
+private:
+  Real _threshold;
+  Real _horizon;
+  Real _bytes_per_element;
+  Real _bandwidth;
+
+  /// The wall time of the last repartitioning
+  Real _partition_time = 0;
+
+  Real _imbalance = 1;
+  Real _saving = 0;
+  Real _migration_cost = 0;
+};
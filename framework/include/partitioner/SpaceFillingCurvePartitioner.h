@@ -0,0 +1,60 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// MOOSE includes
+#include "MoosePartitioner.h"
+#include "MooseEnum.h"
+
+class SpaceFillingCurvePartitioner;
+
+template <>
+InputParameters validParams<SpaceFillingCurvePartitioner>();
+
+/**
+ * Partitions a mesh into contiguous ranges of the Hilbert or Morton curve through the element
+ * centroids (see SpaceFillingCurve), optionally weighted by the element costs measured by the
+ * threaded loops (ElementLoopCostModel). Sorting the keys is all the work, so unlike the graph
+ * partitioners it can run after every adaptivity cycle; the ranges of neighboring processors are
+ * neighbors along the curve, so a repartition after a small change only moves a few elements.
+ *
+ * With "renumber" the elements and nodes are also renumbered along the curve, so that the element
+ * loops visit elements (and the dof map numbers dofs) in curve order: neighbors are then close in
+ * memory and the Jacobian has a narrow bandwidth.
+ */
+class SpaceFillingCurvePartitioner : public MoosePartitioner
+{
+public:
+  SpaceFillingCurvePartitioner(const InputParameters & params);
+
+  static InputParameters validParams();
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /**
+   * Renumbers the local elements, then the nodes in the order of their first element, along the
+   * curve (the ids of each processor stay in the range of the partition)
+   * @param mesh The partitioned mesh
+   * @param sorted_elems The elements in curve order
+   */
+  void renumber(MeshBase & mesh, const std::vector<Elem *> & sorted_elems) const;
+
+  /// The curve, Hilbert or Morton
+  const MooseEnum _curve;
+
+  /// Whether to weight the elements by their measured costs
+  const bool _use_costs;
+
+  /// Whether to renumber the elements and nodes along the curve
+  const bool _renumber;
+};
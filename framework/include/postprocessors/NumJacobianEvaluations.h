@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NumJacobianEvaluations;
+
+template <>
+InputParameters validParams<NumJacobianEvaluations>();
+
+/**
+ * Returns the number of Jacobian assemblies performed by the Jacobian reuse policy
+ * (see FEProblemSolve's jacobian_reuse), 0 when the reuse is off.
+ */
+class NumJacobianEvaluations : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NumJacobianEvaluations(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+};
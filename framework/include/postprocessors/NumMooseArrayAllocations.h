@@ -0,0 +1,40 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NumMooseArrayAllocations;
+
+template <>
+InputParameters validParams<NumMooseArrayAllocations>();
+
+/**
+ * Returns the number of MooseArray buffer allocations (see Moose::mooseArrayAllocations()) since
+ * its previous evaluation, e.g. the allocations of each residual evaluation when executed on
+ * LINEAR. In a steady assembly loop this should be zero.
+ */
+class NumMooseArrayAllocations : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NumMooseArrayAllocations(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+
+protected:
+  /// The number of allocations at the previous evaluation
+  unsigned long _previous_allocations;
+};
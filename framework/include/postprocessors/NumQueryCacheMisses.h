@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NumQueryCacheMisses;
+
+template <>
+InputParameters validParams<NumQueryCacheMisses>();
+
+/**
+ * Returns the number of warehouse queries that missed the cache of their QueryCache since the
+ * start of the simulation (see TheWarehouse::numQueryCacheMisses()).
+ */
+class NumQueryCacheMisses : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NumQueryCacheMisses(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+};
@@ -32,6 +32,13 @@ public:
 
   FieldSplitPreconditioner(const InputParameters & parameters);
 
+  /**
+   * The blocks the splits use: the diagonal blocks of the leaf splits, plus the blocks between
+   * sub-splits that their splitting type reads (below the diagonal for multiplicative, both
+   * sides for symmetric multiplicative and Schur, none for additive)
+   */
+  virtual std::unique_ptr<CouplingMatrix> usedJacobianBlocks() const override;
+
   /**
    * top split
    */
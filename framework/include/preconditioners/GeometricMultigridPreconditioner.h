@@ -0,0 +1,101 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// MOOSE includes
+#include "MoosePreconditioner.h"
+#include "MultigridInterpolation.h"
+
+#include "libmesh/petsc_macro.h"
+
+#ifdef LIBMESH_HAVE_PETSC
+#include <petscksp.h>
+#endif
+
+// Forward declarations
+class NonlinearSystemBase;
+class GeometricMultigridPreconditioner;
+
+template <>
+InputParameters validParams<GeometricMultigridPreconditioner>();
+
+/**
+ * Geometric multigrid over the uniform refinement hierarchy of the mesh, mapped onto PETSc's PCMG.
+ *
+ * The mesh must come from "uniform_refine" (or Adaptivity::uniformRefine()) levels of a coarse
+ * mesh, whose elements libMesh keeps as the inactive ancestors of the active ones. The levels of
+ * the multigrid are the refinement levels: level l contains the elements of refinement level l
+ * and the active ones of lower level, and its dofs are numbered from the nodes of these elements.
+ * The interpolation from each level to the next is built from the parent-child relations (see
+ * MultigridInterpolation), and the coarse operators are the Galerkin products P^T A P of the
+ * Jacobian, so that the coarse levels need no separate discretization. The smoothers and the
+ * coarse solver are configured through the usual PETSc options (-mg_levels_ksp_type,
+ * -mg_coarse_pc_type, ...).
+ */
+class GeometricMultigridPreconditioner : public MoosePreconditioner
+{
+public:
+  static InputParameters validParams();
+
+  GeometricMultigridPreconditioner(const InputParameters & params);
+  virtual ~GeometricMultigridPreconditioner();
+
+  /// The number of multigrid levels (the refinement levels used, plus the coarsest)
+  unsigned int numLevels() const { return _n_levels; }
+
+#ifdef LIBMESH_HAVE_PETSC
+  /**
+   * Sets up the PCMG of the linear solver: its levels, their interpolations and the Galerkin
+   * coarse operators. Called by the nonlinear system when the solver is initialized and again
+   * after the mesh changes.
+   */
+  void setupPC(PC pc);
+#endif
+
+  /// The interpolations need to be rebuilt when the mesh changes
+  void meshChanged();
+
+protected:
+  /**
+   * Numbers the dofs of every level: the dofs of the nonlinear variables on the nodes of the
+   * elements of the level, in the order of the fine dofs (so that the finest level is the system
+   * itself) and owned by the processor owning the fine dof
+   */
+  void buildLevelNumberings();
+
+  /**
+   * Builds the interpolation from level - 1 to level by visiting the elements of level - 1 and
+   * evaluating their shape functions at the dofs of their children
+   */
+  void buildInterpolation(unsigned int level);
+
+  /// The nonlinear system preconditioned
+  NonlinearSystemBase & _nl;
+
+  /// The number of refinement levels of the hierarchy used, plus one
+  unsigned int _n_levels;
+
+  /// For each level, the level dof of each fine (system) dof, or invalid on the coarser ones
+  std::vector<std::vector<dof_id_type>> _level_dofs;
+
+  /// For each level, the number of its local dofs
+  std::vector<std::size_t> _n_local_level_dofs;
+
+  /// The interpolation from each level to the next (index l for the one from l - 1 to l)
+  std::vector<MultigridInterpolation> _interpolations;
+
+  /// Whether the hierarchy must be rebuilt before the next solve
+  bool _hierarchy_dirty;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// The PETSc matrices of the interpolations
+  std::vector<Mat> _interpolation_mats;
+#endif
+};
@@ -17,6 +17,7 @@
 // Libmesh include
 #include "libmesh/preconditioner.h"
 #include "libmesh/linear_solver.h"
+#include "libmesh/coupling_matrix.h"
 
 // Forward declarations
 class FEProblemBase;
@@ -55,6 +56,13 @@ public:
                             const unsigned int to_var,
                             NumericVector<Number> & to_vector);
 
+  /**
+   * The Jacobian blocks (ivar, jvar) this preconditioner reads, so that the assembly can skip
+   * computing the others (see FEProblemBase::setUsedJacobianBlocks()); null when it may read any
+   * block the coupling matrix allows
+   */
+  virtual std::unique_ptr<CouplingMatrix> usedJacobianBlocks() const { return nullptr; }
+
 protected:
   /// Subproblem this preconditioner is part of
   FEProblemBase & _fe_problem;
@@ -73,6 +73,19 @@ public:
    */
   virtual void setup();
 
+  /// The diagonal blocks of the systems and the off-diagonal blocks requested in addSystem()
+  virtual std::unique_ptr<CouplingMatrix> usedJacobianBlocks() const override
+  {
+    auto used = libmesh_make_unique<CouplingMatrix>(_off_diag.size());
+    for (unsigned int ivar = 0; ivar < _off_diag.size(); ++ivar)
+    {
+      (*used)(ivar, ivar) = 1;
+      for (const auto jvar : _off_diag[ivar])
+        (*used)(ivar, jvar) = 1;
+    }
+    return used;
+  }
+
 protected:
   /// The nonlinear system this PBP is associated with (convenience reference)
   NonlinearSystemBase & _nl;
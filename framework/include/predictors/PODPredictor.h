@@ -0,0 +1,60 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// MOOSE includes
+#include "Predictor.h"
+#include "ReducedSolutionBasis.h"
+
+// Forward declarations
+class PODPredictor;
+
+namespace libMesh
+{
+template <typename T>
+class NumericVector;
+}
+
+template <>
+InputParameters validParams<PODPredictor>();
+
+/**
+ * Predicts the solution of the next step in the span of the last few solution increments (see
+ * ReducedSolutionBasis). The increment of the last step, scaled by dt / dt_old, gives the first
+ * guess; a few Gauss-Newton steps on the nonlinear residual restricted to the basis then correct
+ * it, at the cost of (rank + 1) residual evaluations per step and no linear solve. For smooth
+ * but nonlinear transients this captures the curvature the linear extrapolation of
+ * SimplePredictor and AdamsPredictor misses.
+ */
+class PODPredictor : public Predictor
+{
+public:
+  static InputParameters validParams();
+
+  PODPredictor(const InputParameters & parameters);
+
+  virtual int order() override { return 1; }
+  virtual void timestepSetup() override;
+  virtual bool shouldApply() override;
+  virtual void apply(NumericVector<Number> & sln) override;
+
+protected:
+  /// The number of Gauss-Newton steps on the reduced residual
+  const unsigned int _reduced_iterations;
+
+  /// The basis of the last solution increments (the rank is the "rank" parameter)
+  ReducedSolutionBasis<NumericVector<Number>> _basis;
+
+  /// The solution the last increment was taken from, to form the next one in timestepSetup()
+  NumericVector<Number> & _previous_solution;
+
+  /// The step of the last increment added, so that a repeated (failed) step adds none
+  int & _t_step_last_added;
+};
@@ -0,0 +1,220 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * An orthonormal basis of the span of the last few solution increments, for reduced order
+ * predictions of the next increment (see PODPredictor).
+ *
+ * Every accepted step adds its increment; past max_rank increments the oldest one is dropped.
+ * The basis is rebuilt from the kept increments by modified Gram-Schmidt, dropping those that
+ * are (numerically) in the span of the others, for O(rank^2) inner products per step.
+ *
+ * The vectors only need clone(), zero(), add(Real, const Vector &), scale(Real) and dot(), so
+ * this works for NumericVector<Number>.
+ */
+template <typename Vector>
+class ReducedSolutionBasis
+{
+public:
+  /**
+   * @param max_rank The number of increments kept
+   * @param drop_tolerance The relative norm below which an orthogonalized increment is dropped
+   */
+  ReducedSolutionBasis(unsigned int max_rank, Real drop_tolerance = 1e-8)
+    : _max_rank(max_rank), _drop_tolerance(drop_tolerance)
+  {
+    if (max_rank == 0)
+      mooseError("The rank of a ReducedSolutionBasis must be positive");
+  }
+
+  /// Adds the increment of an accepted step, dropping the oldest one past the maximum rank
+  void addIncrement(const Vector & increment)
+  {
+    _increments.push_back(increment.clone());
+    if (_increments.size() > _max_rank)
+      _increments.pop_front();
+    rebuild();
+  }
+
+  /// Forgets the increments, e.g. when the mesh changes
+  void clear()
+  {
+    _increments.clear();
+    _basis.clear();
+  }
+
+  /// The number of increments kept
+  unsigned int numIncrements() const { return _increments.size(); }
+
+  /// The i-th most recent increment, 0 being the last
+  const Vector & increment(unsigned int i) const
+  {
+    mooseAssert(i < _increments.size(), "Increment " << i << " out of range");
+    return *_increments[_increments.size() - 1 - i];
+  }
+
+  /// The rank of the basis
+  unsigned int rank() const { return _basis.size(); }
+
+  const Vector & basisVector(unsigned int i) const { return *_basis[i]; }
+
+  /// The coefficients of the orthogonal projection of v onto the basis
+  std::vector<Real> project(const Vector & v) const
+  {
+    std::vector<Real> a(_basis.size());
+    for (unsigned int i = 0; i < _basis.size(); ++i)
+      a[i] = _basis[i]->dot(v);
+    return a;
+  }
+
+  /// Adds the combination of the basis vectors with the coefficients a to v
+  void expand(const std::vector<Real> & a, Vector & v) const
+  {
+    mooseAssert(a.size() == _basis.size(), "Wrong number of coefficients");
+    for (unsigned int i = 0; i < _basis.size(); ++i)
+      v.add(a[i], *_basis[i]);
+  }
+
+  /**
+   * Improves a guess u by Gauss-Newton steps on the residual restricted to the basis:
+   * min_a ||R(u + V a)||, with the reduced Jacobian (R(u + h v_i) - R(u)) / h from rank() + 1
+   * residual evaluations per step (no linear solve on the full system)
+   * @param u The guess, updated
+   * @param residual Computes residual(x, r), the residual r at x
+   * @param iterations The number of Gauss-Newton steps
+   * @param eps The relative finite difference step
+   * @return The residual norm at the final u
+   */
+  template <typename Residual>
+  Real minimizeResidual(Vector & u, Residual && residual, unsigned int iterations, Real eps = 1e-7)
+  {
+    const unsigned int k = _basis.size();
+    auto r = u.clone();
+    residual(u, *r);
+    Real norm = std::sqrt(r->dot(*r));
+    if (k == 0)
+      return norm;
+
+    auto x = u.clone();
+    std::vector<std::unique_ptr<Vector>> columns;
+    for (unsigned int i = 0; i < k; ++i)
+      columns.push_back(u.clone());
+
+    for (unsigned int it = 0; it < iterations && norm > 0; ++it)
+    {
+      const Real h = eps * std::max(Real(1), std::sqrt(u.dot(u)));
+      for (unsigned int i = 0; i < k; ++i)
+      {
+        *x = u;
+        x->add(h, *_basis[i]);
+        residual(*x, *columns[i]);
+        columns[i]->add(-1, *r);
+        columns[i]->scale(1 / h);
+      }
+
+      // The normal equations J^T J a = -J^T r
+      std::vector<std::vector<Real>> jtj(k, std::vector<Real>(k + 1));
+      for (unsigned int i = 0; i < k; ++i)
+      {
+        for (unsigned int j = 0; j <= i; ++j)
+          jtj[i][j] = jtj[j][i] = columns[i]->dot(*columns[j]);
+        jtj[i][k] = -columns[i]->dot(*r);
+      }
+      std::vector<Real> a;
+      if (!solve(jtj, a))
+        break;
+
+      *x = u;
+      expand(a, *x);
+      residual(*x, *columns[0]);
+      const Real new_norm = std::sqrt(columns[0]->dot(*columns[0]));
+      // Only keep steps that reduce the residual, the guess must never get worse
+      if (!(new_norm < norm))
+        break;
+      u = *x;
+      *r = *columns[0];
+      norm = new_norm;
+    }
+    return norm;
+  }
+
+private:
+  void rebuild()
+  {
+    _basis.clear();
+    for (const auto & inc : _increments)
+    {
+      auto v = inc->clone();
+      const Real inc_norm = std::sqrt(v->dot(*v));
+      if (inc_norm == 0)
+        continue;
+      // Twice, for orthogonality in floating point
+      for (unsigned int pass = 0; pass < 2; ++pass)
+        for (const auto & b : _basis)
+          v->add(-b->dot(*v), *b);
+      const Real norm = std::sqrt(v->dot(*v));
+      if (norm <= _drop_tolerance * inc_norm)
+        continue;
+      v->scale(1 / norm);
+      _basis.push_back(std::move(v));
+    }
+  }
+
+  /// Solves the augmented system in place by Gaussian elimination, false when singular
+  static bool solve(std::vector<std::vector<Real>> & m, std::vector<Real> & x)
+  {
+    const unsigned int k = m.size();
+    for (unsigned int c = 0; c < k; ++c)
+    {
+      unsigned int pivot = c;
+      for (unsigned int r = c + 1; r < k; ++r)
+        if (std::abs(m[r][c]) > std::abs(m[pivot][c]))
+          pivot = r;
+      if (m[pivot][c] == 0)
+        return false;
+      std::swap(m[c], m[pivot]);
+      for (unsigned int r = c + 1; r < k; ++r)
+      {
+        const Real f = m[r][c] / m[c][c];
+        for (unsigned int j = c; j <= k; ++j)
+          m[r][j] -= f * m[c][j];
+      }
+    }
+    x.assign(k, 0);
+    for (unsigned int c = k; c-- > 0;)
+    {
+      Real sum = m[c][k];
+      for (unsigned int j = c + 1; j < k; ++j)
+        sum -= m[c][j] * x[j];
+      x[c] = sum / m[c][c];
+    }
+    return true;
+  }
+
+  const unsigned int _max_rank;
+  const Real _drop_tolerance;
+
+  /// The kept increments, oldest first
+  std::deque<std::unique_ptr<Vector>> _increments;
+
+  /// The orthonormal basis of their span
+  std::vector<std::unique_ptr<Vector>> _basis;
+};
@@ -12,6 +12,7 @@
 #include "SubProblem.h"
 #include "DisplacedSystem.h"
 #include "GeometricSearchData.h"
+#include "DisplacedCoordinateBuffer.h"
 
 // libMesh
 #include "libmesh/equation_systems.h"
@@ -342,6 +343,43 @@ protected:
   const NumericVector<Number> * _nl_solution;
   const NumericVector<Number> * _aux_solution;
 
+  /**
+   * Builds the coordinate buffer of the displaced nodes (the local and geometrically ghosted ones)
+   * and the dof indices of their displacements, on the first update and after mesh changes.
+   */
+  void buildCoordinateBuffer();
+
+  /**
+   * Moves the displaced nodes through the coordinate buffer instead of UpdateDisplacedMeshThread:
+   * gathers the displacement dofs of the nodes from \p soln and \p aux_soln with one get() each
+   * (only those entries, where the thread localizes the whole vectors into ghosted copies), then
+   * writes the coordinates into the nodes with the thread pool.
+   * @return false if the displacements did not change since the last update, in which case
+   *         neither the nodes nor the geometric search need an update
+   */
+  bool updateCoordinatesBuffered(const NumericVector<Number> & soln,
+                                 const NumericVector<Number> & aux_soln);
+
+  /// Whether the nodes are moved through the coordinate buffer
+  const bool _buffered_mesh_update;
+
+  /// Whether the coordinate buffer needs to be rebuilt
+  bool _coordinate_buffer_dirty = true;
+
+  /// The displaced coordinates of the nodes of _coordinate_buffer_nodes
+  DisplacedCoordinateBuffer _coordinate_buffer;
+
+  /// The displaced nodes, in the order of the buffer
+  std::vector<Node *> _coordinate_buffer_nodes;
+
+  ///@{ The displacement dof indices gathered from each system, and the values gathered
+  std::vector<dof_id_type> _nl_displacement_dofs;
+  std::vector<dof_id_type> _aux_displacement_dofs;
+  std::vector<Number> _nl_displacement_values;
+  std::vector<Number> _aux_displacement_values;
+  std::vector<Real> _displacement_values;
+  ///@}
+
   std::vector<std::unique_ptr<Assembly>> _assembly;
 
   GeometricSearchData _geometric_search_data;
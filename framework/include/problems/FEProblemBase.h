@@ -30,6 +30,7 @@
 #include "VectorPostprocessor.h"
 #include "PerfGraphInterface.h"
 #include "Attributes.h"
+#include "DeclaredCoupling.h"
 
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/equation_systems.h"
@@ -49,6 +50,7 @@ class RandomData;
 class MeshChangedInterface;
 class MultiMooseEnum;
 class MaterialPropertyStorage;
+class ElementLoopCostModel;
 class MaterialData;
 class MooseEnum;
 class RestartableDataIO;
@@ -163,6 +165,19 @@ public:
 
   Moose::CouplingType coupling() { return _coupling; }
 
+  /**
+   * Builds the coupling matrix from the couplings the nonlinear kernels, BCs, DG and interface
+   * kernels, nodal kernels and constraints declare (their variable and coupled variables, on their
+   * subdomains), for the COUPLING_DECLARED type. The objects using automatic differentiation
+   * couple their variable to every variable (DeclaredCoupling::addFull()), as the derivatives
+   * carried by their material properties come from the variables the materials couple. Called
+   * once the objects are added, before the DofMap computes the sparsity pattern.
+   */
+  void setDeclaredCouplingMatrix();
+
+  /// The couplings found by setDeclaredCouplingMatrix(), per subdomain
+  const DeclaredCoupling & declaredCoupling() const { return _declared_coupling; }
+
   /**
    * Set custom coupling matrix
    * @param cm coupling matrix to be set
@@ -177,6 +192,17 @@ public:
   /// Set custom coupling matrix for variables requiring nonlocal contribution
   void setNonlocalCouplingMatrix();
 
+  /**
+   * Restricts the off-diagonal Jacobian blocks the assembly threads compute to those set in
+   * \p used, the blocks the preconditioner reads (MoosePreconditioner::usedJacobianBlocks()),
+   * by filtering the coupling entries of every Assembly. Only honored when the assembled matrix
+   * is only used for preconditioning (PJFNK/JFNK); null computes every coupled block.
+   */
+  void setUsedJacobianBlocks(std::unique_ptr<CouplingMatrix> used);
+
+  /// The blocks set by setUsedJacobianBlocks(), null when every coupled block is computed
+  const CouplingMatrix * usedJacobianBlocks() const { return _used_jacobian_blocks.get(); }
+
   bool areCoupled(unsigned int ivar, unsigned int jvar);
 
   std::vector<std::pair<MooseVariableFEBase *, MooseVariableFEBase *>> &
@@ -445,6 +471,15 @@ public:
   virtual void checkExceptionAndStopSolve(bool print_message = true);
 
   virtual bool converged() override;
+
+  /**
+   * A number identifying the current solution: it changes whenever a residual or Jacobian
+   * evaluation sees a solution different from the previous evaluation's, so that evaluations with
+   * the same version (e.g. the residual and Jacobian of a Newton iterate) may share values
+   * computed from the solution, see Material::_memoize
+   */
+  unsigned long solutionVersion() const { return _solution_version; }
+
   virtual unsigned int nNonlinearIterations() const override;
   virtual unsigned int nLinearIterations() const override;
   virtual Real finalNonlinearResidual() const override;
@@ -715,6 +750,22 @@ public:
 
   virtual void reinitMaterials(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
 
+  /**
+   * Makes the reinitMaterials*() functions compute only the materials needed for the active
+   * material properties of the thread (see setActiveMaterialProperties()) instead of all the
+   * materials of the block, see MaterialWarehouse::selectNeeded(). The selection is cached per
+   * block until the active properties change, e.g. once per subdomain of a threaded loop.
+   */
+  void setLazyMaterials(bool lazy) { _lazy_materials = lazy; }
+
+  /**
+   * Makes the projection of the stateful properties after adaptivity copy the values of the
+   * nearest parent (child) qps instead of reinitializing the new elements and calling their
+   * materials, see MaterialPropertyStorage::copyStatefulPropsToChild()
+   */
+  void setFastStatefulProjection(bool fast) { _fast_stateful_projection = fast; }
+  bool fastStatefulProjection() const { return _fast_stateful_projection; }
+
   /**
    * reinit materials on element faces
    * @param blk_id The subdomain on which the element owning the face lives
@@ -1161,6 +1212,17 @@ public:
   virtual void computeResidualInternal(const NumericVector<Number> & soln,
                                        NumericVector<Number> & residual,
                                        const std::set<TagID> & tags);
+
+  /**
+   * Form the residual with default tags from the contributions of some elements only: the
+   * kernels, boundary conditions and interface terms on these elements and the nodal BCs,
+   * nodal kernels and constraints on their nodes. The entries of the dofs whose support lies in
+   * the elements are exact, the others are partial; used to estimate line search trials
+   * (e.g. near the contact interfaces) without a full residual evaluation.
+   */
+  virtual void computeResidualOnElements(const NumericVector<Number> & soln,
+                                         NumericVector<Number> & residual,
+                                         const std::vector<const Elem *> & elems);
   /**
    * Form multiple residual vectors and each is associated with one tag
    */
@@ -1439,6 +1501,15 @@ public:
   /// Update the mesh due to changing XFEM cuts
   virtual bool updateMeshXFEM();
 
+  /**
+   * Update data after an XFEM mesh change that only touched the given elements: the equation
+   * systems are reinitialized (libMesh redistributes the dofs globally), but the stateful
+   * material properties, the geometric search and the mesh element caches are only updated for
+   * the changed elements and their neighbors, instead of the whole meshChanged() sequence.
+   * @param changed_elems The elements cut, added, deleted or healed
+   */
+  void meshChangedIncrementally(const std::set<dof_id_type> & changed_elems);
+
   /**
    * Update data after a mesh change.
    */
@@ -1480,6 +1551,24 @@ public:
    */
   void setMaterialCoverageCheck(bool flag) { _material_coverage_check = flag; }
 
+  /**
+   * Store the stateful material properties of the volume, boundary and neighbor storages in flat,
+   * element-indexed arenas instead of per-element hash maps (see MaterialPropertyArena). This
+   * must be set before the stateful properties are initialized.
+   */
+  void useStatefulPropertyArena(bool flag);
+
+  /**
+   * Run the residual, Jacobian, material and user object element loops through
+   * Moose::parallelReduceWorkStealing(), balancing the threads with the element costs measured
+   * during the previous evaluation.
+   */
+  void useWorkStealingElementLoops(bool flag) { _use_work_stealing_element_loops = flag; }
+  bool useWorkStealingElementLoops() const { return _use_work_stealing_element_loops; }
+
+  /// The measured per-element costs of the threaded element loops
+  ElementLoopCostModel & elementLoopCostModel();
+
   /**
    * Toggle parallel barrier messaging (defaults to on).
    */
@@ -1596,6 +1685,14 @@ public:
    */
   virtual void computeUserObjects(const ExecFlagType & type, const Moose::AuxGroup & group);
 
+  /**
+   * Whether the PRE_AUX and POST_AUX user objects of \p type can run in a single sweep over the
+   * mesh: nothing executes between the two groups, i.e. no AuxKernel, AuxScalarKernel or
+   * elemental auxiliary variable is computed on \p type. execute() then calls
+   * computeUserObjects() once with Moose::ALL instead of once per group.
+   */
+  bool canFuseUserObjectGroups(const ExecFlagType & type) const;
+
   /**
    * Compute an user object with the given name
    */
@@ -1917,6 +2014,10 @@ protected:
 
   Moose::CouplingType _coupling;       ///< Type of variable coupling
   std::unique_ptr<CouplingMatrix> _cm; ///< Coupling matrix for variables.
+  /// The couplings declared by the residual objects, for COUPLING_DECLARED
+  DeclaredCoupling _declared_coupling;
+  /// The Jacobian blocks the preconditioner reads, see setUsedJacobianBlocks()
+  std::unique_ptr<CouplingMatrix> _used_jacobian_blocks;
 
   // Dimension of the subspace spanned by the vectors with a given prefix
   std::map<std::string, unsigned int> _subspace_dim;
@@ -2109,6 +2210,12 @@ protected:
   /// Determines whether a check to verify an active material on every subdomain
   bool _material_coverage_check;
 
+  /// Whether the threaded element loops use cost-weighted work stealing
+  bool _use_work_stealing_element_loops = false;
+
+  /// Per-element costs for the work-stealing element loops, created on first use
+  std::unique_ptr<ElementLoopCostModel> _element_loop_cost_model;
+
   /// Whether to check overlapping Dirichlet and Flux BCs and/or multiple DirichletBCs per sideset
   const bool _fv_bcs_integrity_check;
 
@@ -2139,6 +2246,24 @@ protected:
   /// Current execute_on flag
   ExecFlagType _current_execute_on_flag;
 
+  /// Whether only the materials needed for the active properties are computed
+  bool _lazy_materials = false;
+
+  /// Whether the stateful properties are projected by qp copies only
+  bool _fast_stateful_projection = false;
+
+  /// The needed materials of a block, and the active properties they were selected for
+  typedef std::pair<std::set<unsigned int>, std::vector<std::shared_ptr<MaterialBase>>>
+      NeededMaterials;
+  /// The needed materials of each thread and block
+  std::vector<std::map<SubdomainID, NeededMaterials>> _needed_materials;
+
+  /// See solutionVersion()
+  unsigned long _solution_version = 0;
+
+  /// The solution of the last residual or Jacobian evaluation, to detect a new solution
+  std::unique_ptr<NumericVector<Number>> _last_evaluated_solution;
+
   /// The control logic warehouse
   ExecuteMooseObjectWarehouse<Control> _control_warehouse;
 
@@ -2183,7 +2308,11 @@ private:
   const PerfID _project_solution_timer;
   const PerfID _compute_indicators_timer;
   const PerfID _compute_markers_timer;
+  /// The threaded prolongation and restriction of the stateful properties after adaptivity
+  const PerfID _project_stateful_properties_timer;
   const PerfID _compute_user_objects_timer;
+  /// Counts, in the PerfGraph, the user object sweeps saved by canFuseUserObjectGroups()
+  const PerfID _fused_user_object_sweeps_timer;
   const PerfID _execute_controls_timer;
   const PerfID _execute_samplers_timer;
   const PerfID _update_active_objects_timer;
@@ -34,6 +34,11 @@ public:
 
   FunctorRelationshipManager(const FunctorRelationshipManager & other);
 
+  /**
+   * Forwards to the functor the elements of the range the ghosting applies around
+   * (restrictedRange()), so that block and boundary restricted RMs only ghost near their blocks
+   * and boundaries
+   */
   virtual void operator()(const MeshBase::const_element_iterator & range_begin,
                           const MeshBase::const_element_iterator & range_end,
                           processor_id_type p,
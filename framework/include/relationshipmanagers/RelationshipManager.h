@@ -14,6 +14,10 @@
 #include "MooseMesh.h"
 
 #include "libmesh/ghosting_functor.h"
+#include "libmesh/multi_predicates.h"
+
+#include <set>
+#include <unordered_set>
 
 // Forward declarations
 class RelationshipManager;
@@ -44,6 +48,7 @@ public:
   {
     if (!_inited)
     {
+      initGhostingRestriction(mesh);
       internalInitWithMesh(mesh);
       set_mesh(&mesh);
     }
@@ -110,7 +115,107 @@ public:
    */
   void setDofMap(const DofMap & dof_map) { _dof_map = &dof_map; }
 
+  /**
+   * Whether the ghosting is restricted to the neighborhood of some blocks or boundaries (the
+   * "ghosting_blocks" and "ghosting_boundaries" parameters), rather than of every element
+   */
+  bool restrictedGhosting() const
+  {
+    return !_ghosting_blocks.empty() || !_ghosting_boundaries.empty();
+  }
+
+  /**
+   * Whether two RMs ghost around the same elements; the operator== of the derived classes must
+   * check it, so that RMs of objects living on different blocks are not merged
+   */
+  bool sameGhostingRestriction(const RelationshipManager & other) const
+  {
+    return _ghosting_blocks == other._ghosting_blocks &&
+           _ghosting_boundaries == other._ghosting_boundaries;
+  }
+
+  /**
+   * Whether the ghosting applies around an element: any element if the ghosting is not
+   * restricted, else the elements of the restricted blocks or with a side on the restricted
+   * boundaries
+   */
+  bool ghostsAround(const Elem * elem) const
+  {
+    return !restrictedGhosting() || _ghosting_blocks.count(elem->subdomain_id()) ||
+           _ghosting_boundary_elems.count(elem->id());
+  }
+
+  /**
+   * A RelationshipManagerInputParameterCallback restricting the ghosting to the blocks and
+   * boundaries of the requesting object, for the objects whose non-local needs do not extend
+   * beyond them (e.g. a block restricted DG kernel):
+   *
+   * params.addRelationshipManager("ElementSideNeighborLayers",
+   *                               Moose::RelationshipManagerType::ALGEBRAIC,
+   *                               RelationshipManager::restrictToObject);
+   */
+  static void restrictToObject(const InputParameters & obj_params, InputParameters & rm_params)
+  {
+    if (obj_params.isParamValid("block"))
+      rm_params.set<std::vector<SubdomainName>>("ghosting_blocks") =
+          obj_params.get<std::vector<SubdomainName>>("block");
+    if (obj_params.isParamValid("boundary"))
+      rm_params.set<std::vector<BoundaryName>>("ghosting_boundaries") =
+          obj_params.get<std::vector<BoundaryName>>("boundary");
+  }
+
 protected:
+  /**
+   * Resolves the restricted blocks and boundaries of the ghosting, and finds the elements on the
+   * boundaries; called at initialization and again by mesh_reinit()
+   */
+  void initGhostingRestriction(const MeshBase & mesh)
+  {
+    if (isParamValid("ghosting_blocks"))
+    {
+      const auto ids =
+          _moose_mesh->getSubdomainIDs(getParam<std::vector<SubdomainName>>("ghosting_blocks"));
+      _ghosting_blocks.insert(ids.begin(), ids.end());
+    }
+    if (isParamValid("ghosting_boundaries"))
+    {
+      const auto ids =
+          _moose_mesh->getBoundaryIDs(getParam<std::vector<BoundaryName>>("ghosting_boundaries"));
+      _ghosting_boundaries.insert(ids.begin(), ids.end());
+    }
+
+    _ghosting_boundary_elems.clear();
+    if (!_ghosting_boundaries.empty())
+      for (const auto & side : mesh.get_boundary_info().build_side_list())
+        if (_ghosting_boundaries.count(std::get<2>(side)))
+          _ghosting_boundary_elems.insert(std::get<0>(side));
+  }
+
+  /**
+   * The elements of a range the ghosting applies around (see ghostsAround()), as a range again,
+   * for the operator() of the RMs to hand to their ghosting functors. The RMs whose ghosting is
+   * not restricted get the range itself.
+   */
+  std::pair<MeshBase::const_element_iterator, MeshBase::const_element_iterator>
+  restrictedRange(const MeshBase::const_element_iterator & range_begin,
+                  const MeshBase::const_element_iterator & range_end)
+  {
+    if (!restrictedGhosting())
+      return std::make_pair(range_begin, range_end);
+
+    typedef std::vector<const Elem *>::const_iterator Iterator;
+    _restricted_range.clear();
+    for (auto it = range_begin; it != range_end; ++it)
+      if (ghostsAround(*it))
+        _restricted_range.push_back(*it);
+    return std::make_pair(MeshBase::const_element_iterator(_restricted_range.begin(),
+                                                           _restricted_range.end(),
+                                                           Predicates::NotNull<Iterator>()),
+                          MeshBase::const_element_iterator(_restricted_range.end(),
+                                                           _restricted_range.end(),
+                                                           Predicates::NotNull<Iterator>()));
+  }
+
   /**
    * Called before this RM is attached.  Only called once
    */
@@ -145,6 +250,18 @@ protected:
   /// What type of systems this RM can be applied to
   const Moose::RMSystemType _system_type;
 
+  /// The blocks the ghosting is restricted to, if any
+  std::set<SubdomainID> _ghosting_blocks;
+
+  /// The boundaries the ghosting is restricted to, if any
+  std::set<BoundaryID> _ghosting_boundaries;
+
+  /// The ids of the elements with a side on the restricted boundaries
+  std::unordered_set<dof_id_type> _ghosting_boundary_elems;
+
+  /// Storage for restrictedRange()
+  std::vector<const Elem *> _restricted_range;
+
 public:
   /**
    * Whether \p input_rm is geometric
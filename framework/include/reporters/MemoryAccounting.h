@@ -0,0 +1,75 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralReporter.h"
+#include "MemoryUtils.h"
+
+/**
+ * Report the memory held by the main data structures of the simulation, per subsystem: the
+ * process memory given by MemoryUsage does not tell which of them grows when a run runs out of
+ * memory.
+ *
+ * For each of the selected "items" the reporter gives the bytes held by every processor along with
+ * the minimum, the maximum and the total over the processors. The sizes are estimates from the
+ * containers of each subsystem (see MemoryUtils::containerBytes), exact for the PETSc matrices and
+ * for the serialized restartable data and backups.
+ */
+class MemoryAccounting : public GeneralReporter
+{
+public:
+  static InputParameters validParams();
+  MemoryAccounting(const InputParameters & parameters);
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  /// The reporter values of an item
+  struct ItemValues
+  {
+    std::vector<std::size_t> * per_process;
+    std::size_t * min_process;
+    std::size_t * max_process;
+    std::size_t * total;
+  };
+
+  ///@{
+  /**
+   * The number of bytes held on this processor by a subsystem:
+   * - mesh: the maps MooseMesh builds on top of the libMesh mesh (see MooseMesh::memoryBytes())
+   * - material_properties: the stateful material properties of all the storages
+   * - nonlinear_matrices, nonlinear_vectors, aux_vectors: the local and ghost entries of the
+   *   matrices and vectors of each system
+   * - geometric_search: the nearest node and penetration locators
+   * - restartable_data: the serialized restartable data of the application
+   * - multiapp_backups: the backups of the sub-applications of all the MultiApps
+   */
+  std::size_t meshBytes() const;
+  std::size_t materialPropertyBytes() const;
+  std::size_t matrixBytes(const std::string & system) const;
+  std::size_t vectorBytes(const std::string & system) const;
+  std::size_t geometricSearchBytes() const;
+  std::size_t restartableDataBytes() const;
+  std::size_t multiAppBackupBytes() const;
+  ///@}
+
+  /// The subsystems reported
+  const MultiMooseEnum & _items;
+
+  /// The unit prefix of the reported sizes
+  const MemoryUtils::MemUnits _mem_units;
+
+  /// The reporter values of each item
+  std::map<std::string, ItemValues> _values;
+
+  /// The bytes held by each item on this processor, from execute() until finalize() gathers them
+  std::map<std::string, std::size_t> _local_bytes;
+};
@@ -0,0 +1,49 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralReporter.h"
+
+/**
+ * Report the PerfGraph timing of every section together with the size of the run (ranks,
+ * threads, dofs), so that the JSON output of the same input run at several rank and thread
+ * counts can be aggregated into strong and weak scaling tables.
+ */
+class PerfGraphReporter : public GeneralReporter
+{
+public:
+  static InputParameters validParams();
+  PerfGraphReporter(const InputParameters & parameters);
+  virtual void initialize() override {}
+  virtual void finalize() override {}
+  virtual void execute() override;
+
+protected:
+  /// Sections with a level above this are not reported
+  const unsigned int _level;
+
+  ///@{ Size of the run
+  unsigned int & _n_procs;
+  unsigned int & _n_threads;
+  dof_id_type & _num_dofs;
+  dof_id_type & _num_elem;
+  ///@}
+
+  ///@{ Per-section timing, in the same section order
+  std::vector<std::string> & _section_names;
+  std::vector<Real> & _self_time;
+  std::vector<Real> & _children_time;
+  std::vector<Real> & _total_time;
+  std::vector<unsigned long int> & _num_calls;
+  ///@}
+
+  /// Maximum over the ranks of the total time of the root, i.e. the wall time of the run
+  Real & _wall_time;
+};
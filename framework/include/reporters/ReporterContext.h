@@ -9,6 +9,7 @@
 #pragma once
 
 #include <iostream>
+#include <numeric>
 #include <typeinfo>
 
 #include "libmesh/parallel.h"
@@ -57,6 +58,10 @@ public:
   /// @see JSONOutput.h
   virtual void store(nlohmann::json & json) const = 0;
 
+  /// Called by ReporterData::store to add information on the value next to it, e.g. the part of
+  /// a distributed value held by this processor
+  virtual void storeInfo(nlohmann::json & /*json*/) const {}
+
   /// Called by FEProblemBase::joinAndFinalize via ReporterData
   virtual void finalize() = 0; // new ReporterContext objects should override
 
@@ -97,6 +102,19 @@ public:
    */
   virtual void addConsumerMode(ReporterMode mode, const std::string & object_name) = 0;
 
+  /**
+   * Helper for sharing Reporter values between apps on the same ranks: makes the value r_name of
+   * r_data an alias of this one (see ReporterState::setAlias()), unless a consumer holds a plain
+   * reference to it
+   * @return Whether the value is shared; if not, it must be transferred (copied)
+   *
+   * @see MultiAppReporterTransferBase
+   */
+  virtual bool share(ReporterData & r_data, const ReporterName & r_name) const = 0;
+
+  /// Records that the producer finalized a new value, called by ReporterData after finalize()
+  virtual void newVersion() = 0;
+
 protected:
   /// Defines how the Reporter value can be produced and how it is being produced
   ReporterProducerEnum _producer_enum;
@@ -164,6 +182,13 @@ public:
    */
   virtual void addConsumerMode(ReporterMode mode, const std::string & object_name) override;
 
+  /**
+   * Type specific sharing, defined in ReporterData.h as transfer()
+   */
+  virtual bool share(ReporterData & r_data, const ReporterName & r_name) const override;
+
+  virtual void newVersion() override { _state.bumpVersion(); }
+
 protected:
   /// The state on which this context object operates
   ReporterState<T> & _state;
@@ -273,7 +298,7 @@ template <typename T>
 void
 ReporterContext<T>::store(nlohmann::json & json) const
 {
-  storeHelper(json, this->_state.value());
+  storeHelper(json, this->_state.sharedValue());
 }
 
 template <typename T>
@@ -471,3 +496,75 @@ ReporterGatherContext<T>::finalize()
   }
   this->comm().gather(0, this->_state.value());
 }
+
+/**
+ * A context for vector Reporter values held in slices, the slice of each processor being its part
+ * of the global vector in processor order (e.g. the values of its local elements or samples).
+ * Nothing is communicated but the sizes of the slices, from which the offset of the local slice in
+ * the global vector is known; the consumers must consume the value in DISTRIBUTED mode and read
+ * their local slice, and the JSONOutput writes every slice from its processor (see
+ * "distributed_slices").
+ */
+template <typename T>
+class ReporterDistributedContext : public ReporterContext<T>
+{
+public:
+  ReporterDistributedContext(const libMesh::ParallelObject & other, ReporterState<T> & state);
+
+  virtual void finalize() override;
+  virtual void storeInfo(nlohmann::json & json) const override;
+
+  /// The index of the first entry of the local slice in the global vector
+  std::size_t globalOffset() const { return _global_offset; }
+
+  /// The size of the global vector
+  std::size_t globalSize() const { return _global_size; }
+
+private:
+  std::size_t _global_offset = 0;
+  std::size_t _global_size = 0;
+};
+
+template <typename T>
+ReporterDistributedContext<T>::ReporterDistributedContext(const libMesh::ParallelObject & other,
+                                                          ReporterState<T> & state)
+  : ReporterContext<T>(other, state)
+{
+  this->_producer_enum.clear();
+  this->_producer_enum.insert(REPORTER_MODE_DISTRIBUTED);
+}
+
+template <typename T>
+void
+ReporterDistributedContext<T>::finalize()
+{
+  for (const auto & pair : this->_state.getConsumerModes())
+  {
+    const ReporterMode consumer = pair.first;
+    if (!(consumer == REPORTER_MODE_UNSET || consumer == REPORTER_MODE_DISTRIBUTED))
+      mooseError("The Reporter value '",
+                 this->name(),
+                 "' is being produced in ",
+                 REPORTER_MODE_DISTRIBUTED,
+                 " mode, but the '",
+                 pair.second, // object name
+                 "' object is requesting to consume it in ",
+                 consumer,
+                 " mode, which is not supported. The mode must be UNSET or DISTRIBUTED.");
+  }
+
+  std::vector<std::size_t> sizes;
+  this->comm().allgather(std::size_t(this->_state.value().size()), sizes);
+  _global_offset =
+      std::accumulate(sizes.begin(), sizes.begin() + this->processor_id(), std::size_t(0));
+  _global_size = std::accumulate(sizes.begin(), sizes.end(), std::size_t(0));
+}
+
+template <typename T>
+void
+ReporterDistributedContext<T>::storeInfo(nlohmann::json & json) const
+{
+  json["processor_id"] = this->processor_id();
+  json["global_offset"] = _global_offset;
+  json["global_size"] = _global_size;
+}
@@ -99,6 +99,19 @@ public:
                              const ReporterMode & mode,
                              const std::size_t time_index = 0);
 
+  /**
+   * Method for returning a handle to Reporter values that may be shared with their producer on
+   * another app (see MultiAppReporterTransferBase and ReporterState::setAlias()). Unlike the
+   * references of getReporterValue(), the handles let the transfers alias the value instead of
+   * copying it.
+   * @see getReporterValue
+   */
+  template <typename T>
+  SharedReporterValue<T> getSharedReporterValue(const ReporterName & reporter_name,
+                                                const std::string & object_name,
+                                                const ReporterMode & mode,
+                                                const std::size_t time_index = 0);
+
   /**
    * Method for returning a read-only reference to Reporter values that already exist.
    * @tparam T The Reporter value C++ type.
@@ -194,6 +207,23 @@ public:
    */
   void store(nlohmann::json & json) const;
 
+  /**
+   * Writes the Reporter values produced in DISTRIBUTED mode (distributed = true) or the others
+   * (distributed = false) to the supplied JSON node, for the JSONOutput writing the distributed
+   * values from every processor and the others from the root only
+   *
+   * @see JSONOutput
+   */
+  void store(nlohmann::json & json, bool distributed) const;
+
+  /**
+   * Return the context of a Reporter value declared with ReporterDistributedContext, through
+   * which the consumers of its local slice find the slice in the global vector
+   */
+  template <typename T>
+  const ReporterDistributedContext<T> &
+  getDistributedContext(const ReporterName & reporter_name) const;
+
   /**
    * Perform integrity check for get/declare calls
    */
@@ -238,6 +268,15 @@ public:
    */
   void addConsumerMode(ReporterMode mode, const std::string & object_name);
 
+  /**
+   * Helper for sharing Reporter values between apps on the same ranks, see
+   * ReporterContextBase::share()
+   * @return Whether the value is shared; if not, it must be transferred with transfer()
+   */
+  bool share(const ReporterName & from_name,
+             const ReporterName & to_name,
+             ReporterData & to_data) const;
+
 private:
   /// For accessing the restart/recover system, which is where Reporter values are stored
   MooseApp & _app;
@@ -253,6 +292,8 @@ private:
   template <typename T>
   ReporterState<T> & getReporterStateHelper(const ReporterName & reporter_name, bool declare);
   friend class VectorPostprocessorInterface;
+  template <typename>
+  friend class ReporterContext;
 
   /**
    * Helper method for returning the ReporterContextBase object, if it exists.
@@ -306,9 +347,25 @@ ReporterData::getReporterValue(const ReporterName & reporter_name,
   ReporterState<T> & state_ref = getReporterStateHelper<T>(reporter_name, false);
   if (mode != REPORTER_MODE_UNSET)
     state_ref.addConsumerMode(mode, object_name);
+  state_ref.addReferenceConsumer();
   return state_ref.value(time_index);
 }
 
+template <typename T>
+SharedReporterValue<T>
+ReporterData::getSharedReporterValue(const ReporterName & reporter_name,
+                                     const std::string & object_name,
+                                     const ReporterMode & mode,
+                                     const std::size_t time_index)
+{
+  _get_names.insert(reporter_name);
+  ReporterState<T> & state_ref = getReporterStateHelper<T>(reporter_name, false);
+  if (mode != REPORTER_MODE_UNSET)
+    state_ref.addConsumerMode(mode, object_name);
+  state_ref.value(time_index); // allocate the old values
+  return SharedReporterValue<T>(state_ref, time_index);
+}
+
 template <typename T, template <typename> class S, typename... Args>
 T &
 ReporterData::declareReporterValue(const ReporterName & reporter_name,
@@ -356,7 +413,20 @@ ReporterData::getReporterValue(const ReporterName & reporter_name,
   if (ptr == nullptr)
     mooseError("The desired Reporter value '", reporter_name, "' does not exist.");
   auto context_ptr = static_cast<const ReporterContext<T> *>(ptr);
-  return context_ptr->state().value(time_index);
+  return context_ptr->state().sharedValue(time_index);
+}
+
+template <typename T>
+const ReporterDistributedContext<T> &
+ReporterData::getDistributedContext(const ReporterName & reporter_name) const
+{
+  const auto context = dynamic_cast<const ReporterDistributedContext<T> *>(
+      getReporterContextBaseHelper(reporter_name));
+  if (!context)
+    mooseError("The Reporter value '",
+               reporter_name,
+               "' does not exist or was not declared with a ReporterDistributedContext.");
+  return *context;
 }
 
 template <typename T>
@@ -377,5 +447,20 @@ ReporterContext<T>::transfer(ReporterData & r_data,
                              const ReporterName & r_name,
                              unsigned int time_index) const
 {
-  r_data.setReporterValue<T>(r_name, _state.value(), time_index);
+  r_data.setReporterValue<T>(r_name, _state.sharedValue(), time_index);
+  ReporterState<T> & to_state = r_data.getReporterStateHelper<T>(r_name, false);
+  to_state.setAlias(nullptr);
+  to_state.bumpVersion();
+}
+
+// This is defined here to avoid cyclic includes, see ReporterContext.h
+template <typename T>
+bool
+ReporterContext<T>::share(ReporterData & r_data, const ReporterName & r_name) const
+{
+  ReporterState<T> & to_state = r_data.getReporterStateHelper<T>(r_name, false);
+  if (to_state.hasReferenceConsumers())
+    return false;
+  to_state.setAlias(&_state);
+  return true;
 }
@@ -38,6 +38,9 @@ class ReporterState : public RestartableData<std::list<T>>
 public:
   ReporterState(const ReporterName & name);
 
+  /// Detaches the values aliasing this one (see setAlias()) and this value from its source
+  virtual ~ReporterState();
+
   /**
    * Return the ReporterName that this state is associated
    */
@@ -85,12 +88,99 @@ public:
    */
   virtual void load(std::istream & stream) override;
 
+  /// Store the data to stream, with the current value of the source when aliased (see setAlias())
+  virtual void store(std::ostream & stream) override;
+
+  /**
+   * The version of the value: the number of times it was finalized by its producer or transferred
+   * into, which lets the consumers sharing it (see SharedReporterValue) detect new values
+   */
+  std::size_t version() const { return _alias ? _alias->version() : _version; }
+  void bumpVersion() { ++_version; }
+
+  /**
+   * Makes the value an alias of the value of another state living on the same ranks (e.g. of the
+   * producer on a sub-app), so that the shared consumers read the storage of the source directly
+   * instead of a copy made at every transfer; nullptr removes the alias. Only the current value
+   * is aliased, the old ones are still transferred. When the source is destroyed (e.g. its app is
+   * reset), its current value is copied into this one and the alias is removed.
+   */
+  void setAlias(const ReporterState<T> * source);
+  const ReporterState<T> * getAlias() const { return _alias; }
+
+  /**
+   * The value seen by the consumers: the current value of the source when aliased, this value
+   * otherwise. Every read of the value by something else than its producer goes through here.
+   */
+  const T & sharedValue(const std::size_t time_index = 0) const
+  {
+    return _alias && time_index == 0 ? _alias->sharedValue() : value(time_index);
+  }
+
+  /**
+   * Records that a consumer holds a plain reference to the value, which an alias cannot redirect:
+   * the transfers into such a value must keep copying
+   */
+  void addReferenceConsumer() { _has_reference_consumers = true; }
+  bool hasReferenceConsumers() const { return _has_reference_consumers; }
+
 private:
   /// Name of data that state is associated
   const ReporterName _reporter_name;
 
   /// The mode(s) that the value is being consumed
   std::set<std::pair<ReporterMode, std::string>> _consumer_modes;
+
+  /// The version of the value, see version()
+  std::size_t _version = 0;
+
+  /// The state this value is an alias of, if any
+  const ReporterState<T> * _alias = nullptr;
+
+  /// The states that are an alias of this one, detached when this one is destroyed
+  mutable std::set<ReporterState<T> *> _aliased_by;
+
+  /// Whether a consumer holds a plain reference to the value
+  bool _has_reference_consumers = false;
+};
+
+/**
+ * The handle through which a consumer reads a Reporter value that may be shared with its producer
+ * on another app (see ReporterState::setAlias()): every access resolves the alias, so the handle
+ * always reads the latest storage without any copy, and version() tells whether the producer has
+ * finalized a new value since the last look.
+ *
+ * The value read is the one of the last finalize of the producer: the apps on the same ranks run
+ * one after the other, so a consumer never sees a value being produced.
+ */
+template <typename T>
+class SharedReporterValue
+{
+public:
+  SharedReporterValue(const ReporterState<T> & state, const std::size_t time_index = 0)
+    : _state(&state), _time_index(time_index), _seen_version(state.version())
+  {
+  }
+
+  const T & operator*() const { return _state->sharedValue(_time_index); }
+  const T * operator->() const { return &_state->sharedValue(_time_index); }
+
+  /// The version of the value, see ReporterState::version()
+  std::size_t version() const { return _state->version(); }
+
+  /// Whether the value has a new version since the previous call (or the construction)
+  bool changed()
+  {
+    const auto v = version();
+    const bool c = v != _seen_version;
+    _seen_version = v;
+    return c;
+  }
+
+private:
+  const ReporterState<T> * _state;
+  const std::size_t _time_index;
+  std::size_t _seen_version;
 };
 
 template <typename T>
@@ -101,6 +191,18 @@ ReporterState<T>::ReporterState(const ReporterName & name)
 {
 }
 
+template <typename T>
+ReporterState<T>::~ReporterState()
+{
+  for (auto * state : _aliased_by)
+  {
+    state->value() = sharedValue();
+    state->_alias = nullptr;
+  }
+  if (_alias)
+    _alias->_aliased_by.erase(this);
+}
+
 template <typename T>
 const ReporterName &
 ReporterState<T>::getReporterName() const
@@ -165,6 +267,29 @@ ReporterState<T>::copyValuesBack()
     (*iter) = (*std::next(iter));
 }
 
+template <typename T>
+void
+ReporterState<T>::setAlias(const ReporterState<T> * source)
+{
+  for (auto state = source; state; state = state->_alias)
+    if (state == this)
+      mooseError("The Reporter value '", _reporter_name, "' cannot be an alias of itself.");
+  if (_alias)
+    _alias->_aliased_by.erase(this);
+  _alias = source;
+  if (_alias)
+    _alias->_aliased_by.insert(this);
+}
+
+template <typename T>
+void
+ReporterState<T>::store(std::ostream & stream)
+{
+  if (_alias)
+    value() = _alias->sharedValue();
+  RestartableData<std::list<T>>::store(stream);
+}
+
 template <typename T>
 void
 ReporterState<T>::load(std::istream & stream)
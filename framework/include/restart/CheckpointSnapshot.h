@@ -0,0 +1,132 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * The files of a checkpoint, staged quickly (in memory, or written to a fast staging directory
+ * such as a node-local NVMe burst buffer) and then written out to their final paths by write(),
+ * which touches neither MPI nor the problem and can run on a background thread (see
+ * AsyncTaskQueue) while the simulation continues.
+ *
+ * Each file is written to a temporary name and renamed once complete, the primary file (the one
+ * recovery looks for) last: a checkpoint whose write was interrupted is therefore never found,
+ * and the ones listed by Checkpoint are only those whose write() returned.
+ *
+ * write() reports its failures by throwing std::runtime_error rather than through mooseError(),
+ * which must not be called from a background thread: AsyncTaskQueue rethrows the exception on
+ * the main thread, where Checkpoint reports it.
+ */
+class CheckpointSnapshot
+{
+public:
+  /**
+   * Stages a file in memory
+   * @param path The final path of the file
+   * @return The stream to write the contents of the file to, valid until write() (later files
+   *         do not move it)
+   */
+  std::ostringstream & addInMemory(const std::string & path)
+  {
+    _files.emplace_back();
+    _files.back().path = path;
+    return _files.back().contents;
+  }
+
+  /**
+   * Stages a file already written to a staging path, which write() copies then removes
+   * @param path The final path of the file
+   * @param staged_path The path the file was written to
+   */
+  void addStaged(const std::string & path, const std::string & staged_path)
+  {
+    _files.emplace_back();
+    _files.back().path = path;
+    _files.back().staged_path = staged_path;
+  }
+
+  /// Makes the file of a final path the primary file, the last one to appear
+  void setPrimary(const std::string & path) { _primary = path; }
+
+  /// Writes the files to their final paths, the primary one last; throws std::runtime_error on a
+  /// failure
+  void write()
+  {
+    std::vector<std::pair<std::string, std::string>> renames;
+    std::pair<std::string, std::string> primary_rename;
+    for (auto & file : _files)
+    {
+      const std::string temporary = file.path + ".tmp";
+      {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (file.staged_path.empty())
+        {
+          const std::string contents = file.contents.str();
+          out.write(contents.data(), contents.size());
+          _bytes += contents.size();
+        }
+        else
+        {
+          std::ifstream in(file.staged_path, std::ios::binary);
+          if (!in)
+            throw std::runtime_error("Failed to open the staged checkpoint file " +
+                                     file.staged_path);
+          out << in.rdbuf();
+          _bytes += out.tellp() < 0 ? 0 : static_cast<std::size_t>(out.tellp());
+        }
+        out.flush();
+        if (!out)
+          throw std::runtime_error("Failed to write the checkpoint file " + temporary);
+      }
+      // Release the memory of the file as soon as it is out
+      std::ostringstream().swap(file.contents);
+
+      if (file.path == _primary)
+        primary_rename = {temporary, file.path};
+      else
+        renames.emplace_back(temporary, file.path);
+    }
+
+    if (!primary_rename.first.empty())
+      renames.push_back(primary_rename);
+    for (const auto & rename : renames)
+      if (std::rename(rename.first.c_str(), rename.second.c_str()))
+        throw std::runtime_error("Failed to rename the checkpoint file " + rename.first + " to " +
+                                 rename.second);
+
+    for (const auto & file : _files)
+      if (!file.staged_path.empty())
+        std::remove(file.staged_path.c_str());
+  }
+
+  /// The number of bytes written by write()
+  std::size_t bytes() const { return _bytes; }
+
+private:
+  struct File
+  {
+    std::string path;
+    std::string staged_path;
+    std::ostringstream contents;
+  };
+
+  /// The files, in a deque so that the streams returned by addInMemory() stay in place
+  std::deque<File> _files;
+  std::string _primary;
+  std::size_t _bytes = 0;
+};
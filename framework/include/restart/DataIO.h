@@ -18,6 +18,8 @@
 #include "RankTwoTensor.h"
 #include "RankThreeTensor.h"
 #include "RankFourTensor.h"
+#include "SymmetricRankTwoTensor.h"
+#include "SymmetricRankFourTensor.h"
 #include "ColumnMajorMatrix.h"
 
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
@@ -433,6 +435,20 @@ dataStore(std::ostream & stream, RankFourTensorTempl<T> & rft, void * context)
   dataStore(stream, rft._vals, context);
 }
 
+template <typename T>
+void
+dataStore(std::ostream & stream, SymmetricRankTwoTensorTempl<T> & srtt, void * context)
+{
+  dataStore(stream, srtt._vals, context);
+}
+
+template <typename T>
+void
+dataStore(std::ostream & stream, SymmetricRankFourTensorTempl<T> & srft, void * context)
+{
+  dataStore(stream, srft._vals, context);
+}
+
 template <typename T>
 void
 dataStore(std::ostream & stream, ColumnMajorMatrixTempl<T> & cmm, void * context)
@@ -698,6 +714,21 @@ void
 dataLoad(std::istream & stream, RankFourTensorTempl<T> & rft, void * context)
 {
   dataLoad(stream, rft._vals, context);
+  rft._symmetry = RankFourTensorTempl<T>::Symmetry::general;
+}
+
+template <typename T>
+void
+dataLoad(std::istream & stream, SymmetricRankTwoTensorTempl<T> & srtt, void * context)
+{
+  dataLoad(stream, srtt._vals, context);
+}
+
+template <typename T>
+void
+dataLoad(std::istream & stream, SymmetricRankFourTensorTempl<T> & srft, void * context)
+{
+  dataLoad(stream, srft._vals, context);
 }
 
 template <typename T>
@@ -0,0 +1,201 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MaterialPropertyStorage.h"
+#include "RestartableData.h"
+
+#include "libmesh/numeric_vector.h"
+
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * Snapshot of the state of an app kept in memory, for the backup()/restore() of sub-apps at
+ * every Picard iteration when the mesh does not change in between.
+ *
+ * Unlike Backup, the bulk of the state is not serialized through streams:
+ *  - the registered vectors (the solution, old solutions and other vectors of every system) are
+ *    copied vector to vector, reusing the snapshot vectors after the first backup;
+ *  - the stateful material properties of the registered storages are copied quadrature point by
+ *    quadrature point into snapshot property values of the same type;
+ *  - only the remaining restartable data is serialized, entry by entry, into buffers that are
+ *    kept from one snapshot to the next.
+ *
+ * The registered objects must outlive the snapshot and must not be replaced (e.g. by mesh
+ * adaptivity or a mesh change), since they are referenced directly; apps that do so use Backup.
+ */
+class InMemoryBackup
+{
+public:
+  ///@{ Registration of the state, once
+  void addVector(NumericVector<Number> & vector) { _vectors.push_back({&vector, nullptr}); }
+  void addMaterialPropertyStorage(MaterialPropertyStorage & storage)
+  {
+    _storages.push_back({&storage, {}});
+  }
+  void addData(RestartableDataValue & data) { _data.push_back({&data, {}}); }
+  ///@}
+
+  /// Copies the current state into the snapshot
+  void snapshot()
+  {
+    for (auto & v : _vectors)
+    {
+      if (!v.copy || v.copy->size() != v.live->size())
+        v.copy = v.live->clone();
+      else
+        *v.copy = *v.live;
+    }
+
+    // The storage is walked every time: the arena rotates its buffers when the states shift, and
+    // the walk order changes with them, so the copies are keyed by (elem, side, state)
+    for (auto & s : _storages)
+    {
+      for (auto & pair : s.copies)
+        pair.second.seen = false;
+
+      s.storage->forEachStatefulProperties(
+          [&s](unsigned int state,
+               dof_id_type elem_id,
+               unsigned int side,
+               MaterialProperties & live)
+          {
+            auto & entry = s.copies[PropertyKey(elem_id, side, state)];
+            entry.seen = true;
+            entry.values.resize(live.size());
+            for (std::size_t i = 0; i < live.size(); ++i)
+            {
+              auto & copy = entry.values[i];
+              if (!copy)
+                copy.reset(live[i]->init(live[i]->size()));
+              else if (copy->size() != live[i]->size())
+                copy->resize(live[i]->size());
+              for (unsigned int qp = 0; qp < live[i]->size(); ++qp)
+                copy->qpCopy(qp, live[i], qp);
+            }
+          });
+
+      for (auto it = s.copies.begin(); it != s.copies.end();)
+        if (it->second.seen)
+          ++it;
+        else
+          it = s.copies.erase(it);
+    }
+
+    for (auto & d : _data)
+    {
+      _scratch.str(std::string());
+      _scratch.clear();
+      d.live->store(_scratch);
+      d.bytes = _scratch.str();
+    }
+
+    _has_snapshot = true;
+  }
+
+  /// Sets the state back to the snapshot
+  void restore()
+  {
+    if (!_has_snapshot)
+      mooseError("InMemoryBackup: restore() requires a previous snapshot()");
+
+    for (auto & v : _vectors)
+      *v.live = *v.copy;
+
+    for (auto & s : _storages)
+    {
+      std::size_t n = 0;
+      s.storage->forEachStatefulProperties(
+          [&s, &n](unsigned int state,
+                   dof_id_type elem_id,
+                   unsigned int side,
+                   MaterialProperties & live)
+          {
+            const auto it = s.copies.find(PropertyKey(elem_id, side, state));
+            if (it == s.copies.end() || it->second.values.size() != live.size())
+              mooseError("InMemoryBackup: the material properties changed since the snapshot");
+            ++n;
+            for (std::size_t i = 0; i < live.size(); ++i)
+            {
+              const auto & copy = it->second.values[i];
+              if (copy->size() != live[i]->size())
+                mooseError("InMemoryBackup: the material properties changed since the snapshot");
+              for (unsigned int qp = 0; qp < live[i]->size(); ++qp)
+                live[i]->qpCopy(qp, copy.get(), qp);
+            }
+          });
+      if (n != s.copies.size())
+        mooseError("InMemoryBackup: the material properties changed since the snapshot");
+    }
+
+    for (auto & d : _data)
+    {
+      std::istringstream stream(d.bytes);
+      d.live->load(stream);
+    }
+  }
+
+  /// Whether a snapshot has been taken
+  bool hasSnapshot() const { return _has_snapshot; }
+
+  /// Drops the snapshot and the registrations, e.g. when the mesh changes
+  void clear()
+  {
+    _vectors.clear();
+    _storages.clear();
+    _data.clear();
+    _has_snapshot = false;
+  }
+
+private:
+  struct VectorSnapshot
+  {
+    NumericVector<Number> * live;
+    std::unique_ptr<NumericVector<Number>> copy;
+  };
+
+  /// The element id, side and state of a set of stateful properties
+  typedef std::tuple<dof_id_type, unsigned int, unsigned int> PropertyKey;
+
+  struct PropertyCopies
+  {
+    /// The copies of the property values, in the order of the MaterialProperties
+    std::vector<std::unique_ptr<PropertyValue>> values;
+    /// Whether the last snapshot() found this set in the storage
+    bool seen = false;
+  };
+
+  struct StorageSnapshot
+  {
+    MaterialPropertyStorage * storage;
+    /// The copies of every stored set of properties
+    std::map<PropertyKey, PropertyCopies> copies;
+  };
+
+  struct DataSnapshot
+  {
+    RestartableDataValue * live;
+    std::string bytes;
+  };
+
+  std::vector<VectorSnapshot> _vectors;
+  std::vector<StorageSnapshot> _storages;
+  std::vector<DataSnapshot> _data;
+
+  /// Reused stream for serializing the restartable data
+  std::ostringstream _scratch;
+
+  bool _has_snapshot = false;
+};
@@ -14,6 +14,7 @@
 #include "JsonIO.h"
 
 // C++ includes
+#include <functional>
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
@@ -24,6 +25,27 @@
 // Forward declarations
 class RestartableDataValue;
 
+/**
+ * Whether a type of restartable data holds entries keyed by element, for the elements of the
+ * processor that stores it (e.g. the stateful material properties). Such data can be restored
+ * onto a different number of processors: every processor reads the data stored by all the old
+ * processors and load() only keeps the entries of the elements it now evaluates, skipping the
+ * others while reading (see RestartableDataIO::readRestartableDataRedistributed()). Specialize
+ * for the element keyed types.
+ */
+template <typename T>
+struct RestartableElementData
+{
+  static constexpr bool keyed = false;
+  static void load(std::istream & stream,
+                   T & value,
+                   const std::function<bool(const Elem *)> & /*keep*/,
+                   void * context)
+  {
+    loadHelper(stream, value, context);
+  }
+};
+
 /**
  * Abstract definition of a RestartableData value.
  */
@@ -64,6 +86,16 @@ public:
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
 
+  /// Whether the data is keyed by element, see RestartableElementData
+  virtual bool elementKeyed() const { return false; }
+
+  /**
+   * Load the data from a binary stream, keeping only the entries of the elements \p keep accepts
+   * for element keyed data
+   */
+  virtual void loadElements(std::istream & stream,
+                            const std::function<bool(const Elem *)> & keep) = 0;
+
   // save/load to JSON object
   virtual void toJSON(nlohmann::json & json) const = 0;
   virtual void fromJSON(const nlohmann::json & json) = 0;
@@ -124,6 +156,14 @@ public:
    */
   virtual void load(std::istream & stream) override;
 
+  virtual bool elementKeyed() const override { return RestartableElementData<T>::keyed; }
+
+  virtual void loadElements(std::istream & stream,
+                            const std::function<bool(const Elem *)> & keep) override
+  {
+    RestartableElementData<T>::load(stream, *_value_ptr, keep, _context);
+  }
+
   /**
    * Store the restartable data into a JSON object
    */
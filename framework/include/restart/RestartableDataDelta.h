@@ -0,0 +1,206 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Delta checkpoints of restartable data: every full_interval-th checkpoint holds every entry, the
+ * others only the entries whose serialized value changed since the previous checkpoint (by hash),
+ * so that the mesh meta data, the histories of inactive sub-apps and the large user object tables
+ * that rarely change are not written again and again.
+ *
+ * A checkpoint is recovered by applying the deltas of its chain in order over the last full
+ * checkpoint (see reconstruct()); each delta file records its sequence number and the one of
+ * its full checkpoint, so that a broken chain is detected instead of silently restored.
+ */
+class RestartableDataDelta
+{
+public:
+  /// The entries of a checkpoint: name and serialized value
+  typedef std::vector<std::pair<std::string, std::string>> Entries;
+
+  /// @param full_interval Every how many checkpoints a full one is written (1: always full)
+  RestartableDataDelta(unsigned int full_interval = 10) : _full_interval(full_interval)
+  {
+    if (!full_interval)
+      mooseError("The interval of the full checkpoints must be positive");
+  }
+
+  /**
+   * Selects the entries of the next checkpoint and writes it
+   * @param entries Every entry, serialized
+   * @param stream The stream of the checkpoint file
+   * @return Whether the checkpoint is a full one
+   */
+  bool write(const Entries & entries, std::ostream & stream)
+  {
+    const bool full = _sequence % _full_interval == 0;
+    if (full)
+      _full_sequence = _sequence;
+
+    std::vector<const std::pair<std::string, std::string> *> selected;
+    for (const auto & entry : entries)
+    {
+      const auto hash = fnv1a(entry.second);
+      auto it = _hashes.find(entry.first);
+      if (full || it == _hashes.end() || it->second != hash)
+        selected.push_back(&entry);
+      _hashes[entry.first] = hash;
+    }
+
+    writeValue(stream, MAGIC);
+    writeValue(stream, _sequence);
+    writeValue(stream, _full_sequence);
+    writeValue(stream, std::uint64_t(selected.size()));
+    for (const auto * entry : selected)
+    {
+      writeString(stream, entry->first);
+      writeString(stream, entry->second);
+    }
+    if (!stream)
+      mooseError("Failed to write the restartable data checkpoint");
+
+    _last_written = selected.size();
+    ++_sequence;
+    return full;
+  }
+
+  /// The number of entries of the last checkpoint written
+  std::size_t lastWritten() const { return _last_written; }
+
+  /// The sequence number the next checkpoint gets
+  std::uint64_t sequence() const { return _sequence; }
+
+  /**
+   * Reads one checkpoint file of a chain
+   * @param stream The stream of the file
+   * @param sequence The sequence number of the checkpoint
+   * @param full_sequence The sequence number of its full checkpoint
+   * @param entries The entries of the file
+   */
+  static void read(std::istream & stream,
+                   std::uint64_t & sequence,
+                   std::uint64_t & full_sequence,
+                   Entries & entries)
+  {
+    std::uint64_t magic = 0, n = 0;
+    readValue(stream, magic);
+    if (magic != MAGIC)
+      mooseError("Not a delta restartable data checkpoint");
+    readValue(stream, sequence);
+    readValue(stream, full_sequence);
+    readValue(stream, n);
+    entries.resize(n);
+    for (auto & entry : entries)
+    {
+      readString(stream, entry.first);
+      readString(stream, entry.second);
+    }
+    if (!stream)
+      mooseError("Truncated delta restartable data checkpoint");
+  }
+
+  /**
+   * Reconstructs the entries of the last checkpoint of a chain
+   * @param streams The files of the chain, from the full checkpoint to the recovered one
+   * @return The latest value of every entry
+   */
+  static std::map<std::string, std::string> reconstruct(const std::vector<std::istream *> & streams)
+  {
+    std::map<std::string, std::string> values;
+    std::uint64_t expected = 0, full = 0;
+    Entries entries;
+    for (std::size_t i = 0; i < streams.size(); ++i)
+    {
+      std::uint64_t sequence, full_sequence;
+      read(*streams[i], sequence, full_sequence, entries);
+      if (i == 0)
+      {
+        if (sequence != full_sequence)
+          mooseError("A delta checkpoint chain must start with a full checkpoint");
+        full = full_sequence;
+      }
+      else if (sequence != expected || full_sequence != full)
+        mooseError("Broken delta checkpoint chain: expected checkpoint ",
+                   expected,
+                   " of the chain of ",
+                   full,
+                   ", got ",
+                   sequence,
+                   " of the chain of ",
+                   full_sequence);
+      expected = sequence + 1;
+
+      for (auto & entry : entries)
+        values[entry.first] = std::move(entry.second);
+    }
+    return values;
+  }
+
+  /// Forgets the hashes, so that the next checkpoint holds every entry (though not full)
+  void reset() { _hashes.clear(); }
+
+private:
+  /// 64-bit FNV-1a hash
+  static std::uint64_t fnv1a(const std::string & bytes)
+  {
+    std::uint64_t hash = 1469598103934665603ull;
+    for (const unsigned char c : bytes)
+    {
+      hash ^= c;
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  static void writeValue(std::ostream & stream, std::uint64_t value)
+  {
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  static void readValue(std::istream & stream, std::uint64_t & value)
+  {
+    stream.read(reinterpret_cast<char *>(&value), sizeof(value));
+  }
+  static void writeString(std::ostream & stream, const std::string & s)
+  {
+    writeValue(stream, s.size());
+    stream.write(s.data(), s.size());
+  }
+  static void readString(std::istream & stream, std::string & s)
+  {
+    std::uint64_t size = 0;
+    readValue(stream, size);
+    if (!stream)
+      return;
+    s.resize(size);
+    stream.read(&s[0], size);
+  }
+
+  static constexpr std::uint64_t MAGIC = 0x415444524d4f4f4dull;
+
+  const unsigned int _full_interval;
+
+  /// The hash of each entry at the last checkpoint
+  std::unordered_map<std::string, std::uint64_t> _hashes;
+
+  std::uint64_t _sequence = 0;
+  std::uint64_t _full_sequence = 0;
+  std::size_t _last_written = 0;
+};
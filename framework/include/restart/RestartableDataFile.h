@@ -0,0 +1,357 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Indexed restartable data file: every piece of data is stored in its own block, aligned so that
+ * it can be mapped directly, and an index at the end of the file maps each data name to its
+ * block. Layout:
+ *
+ * @begincode
+ * header:  magic (8 bytes) | version (uint64) | index offset (uint64) | number of blocks (uint64)
+ * blocks:  block data, each starting at a multiple of ALIGNMENT
+ * index:   for each block: name size (uint64) | name | offset (uint64) | size (uint64)
+ * @endcode
+ *
+ * Writing streams every block straight into a large buffered file stream. Reading maps the file
+ * and deserializes a block only when it is requested, so that the data that is not needed is
+ * never read from disk.
+ */
+namespace RestartableDataFile
+{
+/// Alignment of the blocks (the page size of most systems)
+static constexpr std::uint64_t ALIGNMENT = 4096;
+/// File identifier
+static constexpr char MAGIC[8] = {'M', 'O', 'O', 'S', 'E', 'R', 'D', 'I'};
+/// Format version
+static constexpr std::uint64_t VERSION = 1;
+}
+
+/**
+ * Writes an indexed restartable data file.
+ *
+ * @begincode
+ * RestartableDataFileWriter writer(file_name);
+ * for (auto & data : restartable_data)
+ *   data->store(writer.beginBlock(data->name()));
+ * writer.finalize();
+ * @endcode
+ */
+class RestartableDataFileWriter
+{
+public:
+  RestartableDataFileWriter(const std::string & file_name, std::size_t buffer_size = 1 << 23)
+    : _file_name(file_name), _buffer(buffer_size)
+  {
+    _stream.rdbuf()->pubsetbuf(_buffer.data(), _buffer.size());
+    _stream.open(file_name, std::ios::binary | std::ios::trunc);
+    if (!_stream)
+      mooseError("Failed to open the restartable data file '", file_name, "' for writing");
+
+    // The header is rewritten with the index offset by finalize()
+    writeHeader(0);
+  }
+
+  ~RestartableDataFileWriter()
+  {
+    if (!_finalized && _stream.is_open())
+      _stream.close();
+  }
+
+  /**
+   * Starts the block of the given data, ending the previous one.
+   * @return the stream to serialize the data into
+   */
+  std::ostream & beginBlock(const std::string & name)
+  {
+    mooseAssert(!_finalized, "The file has been finalized");
+    endBlock();
+
+    const std::uint64_t position = _stream.tellp();
+    const std::uint64_t padding = (ALIGNMENT - position % ALIGNMENT) % ALIGNMENT;
+    static const std::vector<char> zeros(ALIGNMENT, 0);
+    _stream.write(zeros.data(), padding);
+
+    _index.push_back({name, position + padding, 0});
+    _in_block = true;
+    return _stream;
+  }
+
+  /// Writes the index and the header; no more blocks can be added
+  void finalize()
+  {
+    endBlock();
+
+    const std::uint64_t index_offset = _stream.tellp();
+    for (const auto & entry : _index)
+    {
+      write(std::uint64_t(entry.name.size()));
+      _stream.write(entry.name.data(), entry.name.size());
+      write(entry.offset);
+      write(entry.size);
+    }
+
+    _stream.seekp(0);
+    writeHeader(index_offset);
+    _stream.close();
+    if (_stream.fail())
+      mooseError("Failed to write the restartable data file '", _file_name, "'");
+
+    _finalized = true;
+  }
+
+private:
+  static constexpr std::uint64_t ALIGNMENT = RestartableDataFile::ALIGNMENT;
+
+  struct Entry
+  {
+    std::string name;
+    std::uint64_t offset;
+    std::uint64_t size;
+  };
+
+  void endBlock()
+  {
+    if (_in_block)
+      _index.back().size = std::uint64_t(_stream.tellp()) - _index.back().offset;
+    _in_block = false;
+  }
+
+  template <typename T>
+  void write(const T & value)
+  {
+    _stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  void writeHeader(std::uint64_t index_offset)
+  {
+    _stream.write(RestartableDataFile::MAGIC, sizeof(RestartableDataFile::MAGIC));
+    write(RestartableDataFile::VERSION);
+    write(index_offset);
+    write(std::uint64_t(_index.size()));
+  }
+
+  const std::string _file_name;
+  std::vector<char> _buffer;
+  std::ofstream _stream;
+  std::vector<Entry> _index;
+  bool _in_block = false;
+  bool _finalized = false;
+};
+
+/**
+ * Reads an indexed restartable data file through a read-only memory map.
+ */
+class RestartableDataFileReader
+{
+public:
+  RestartableDataFileReader(const std::string & file_name) : _file_name(file_name)
+  {
+    _fd = ::open(file_name.c_str(), O_RDONLY);
+    if (_fd < 0)
+      mooseError("Failed to open the restartable data file '", file_name, "'");
+
+    struct stat st;
+    if (fstat(_fd, &st) != 0)
+      mooseError("Failed to stat the restartable data file '", file_name, "'");
+    _size = st.st_size;
+
+    if (_size < HEADER_SIZE)
+      mooseError("The restartable data file '", file_name, "' is truncated");
+
+    void * data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (data == MAP_FAILED)
+      mooseError("Failed to map the restartable data file '", file_name, "'");
+    _data = static_cast<const char *>(data);
+
+    readIndex();
+  }
+
+  ~RestartableDataFileReader()
+  {
+    if (_data)
+      munmap(const_cast<char *>(_data), _size);
+    if (_fd >= 0)
+      ::close(_fd);
+  }
+
+  RestartableDataFileReader(const RestartableDataFileReader &) = delete;
+  RestartableDataFileReader & operator=(const RestartableDataFileReader &) = delete;
+
+  /// Whether the file is an indexed restartable data file
+  static bool isIndexedFile(const std::string & file_name)
+  {
+    std::ifstream in(file_name, std::ios::binary);
+    char magic[sizeof(RestartableDataFile::MAGIC)];
+    return in.read(magic, sizeof(magic)) &&
+           std::memcmp(magic, RestartableDataFile::MAGIC, sizeof(magic)) == 0;
+  }
+
+  /// Whether the file contains the given data
+  bool has(const std::string & name) const { return _index.count(name); }
+
+  /// The names of all the data in the file, in the order they were written
+  const std::vector<std::string> & names() const { return _names; }
+
+  /// The size of a block in bytes
+  std::size_t size(const std::string & name) const { return block(name).second; }
+
+  /**
+   * Deserializes a block: calls load(stream) with a stream that reads directly from the map.
+   */
+  template <typename Load>
+  void load(const std::string & name, Load && load) const
+  {
+    const auto & b = block(name);
+    madvise(const_cast<char *>(_data) + b.first - b.first % ALIGNMENT,
+            b.second + b.first % ALIGNMENT,
+            MADV_SEQUENTIAL);
+
+    MemoryBuffer buffer(_data + b.first, b.second);
+    std::istream stream(&buffer);
+    load(stream);
+  }
+
+  /// Hints the kernel to start reading the given blocks, e.g. before loading them in turn
+  void prefetch(const std::vector<std::string> & names) const
+  {
+    for (const auto & name : names)
+    {
+      const auto & b = block(name);
+      madvise(const_cast<char *>(_data) + b.first - b.first % ALIGNMENT,
+              b.second + b.first % ALIGNMENT,
+              MADV_WILLNEED);
+    }
+  }
+
+private:
+  static constexpr std::uint64_t ALIGNMENT = RestartableDataFile::ALIGNMENT;
+  static constexpr std::size_t HEADER_SIZE = sizeof(RestartableDataFile::MAGIC) + 24;
+
+  /// Read-only stream buffer over a memory range
+  class MemoryBuffer : public std::streambuf
+  {
+  public:
+    MemoryBuffer(const char * begin, std::size_t size)
+    {
+      char * b = const_cast<char *>(begin);
+      setg(b, b, b + size);
+    }
+
+  protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which = std::ios_base::in) override
+    {
+      if (!(which & std::ios_base::in))
+        return pos_type(off_type(-1));
+
+      off_type base = 0;
+      if (dir == std::ios_base::cur)
+        base = gptr() - eback();
+      else if (dir == std::ios_base::end)
+        base = egptr() - eback();
+
+      const off_type pos = base + off;
+      if (pos < 0 || pos > egptr() - eback())
+        return pos_type(off_type(-1));
+
+      setg(eback(), eback() + pos, egptr());
+      return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override
+    {
+      return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+  };
+
+  template <typename T>
+  T read(std::size_t & offset) const
+  {
+    if (offset + sizeof(T) > _size)
+      mooseError("The restartable data file '", _file_name, "' is corrupt");
+    T value;
+    std::memcpy(&value, _data + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+  }
+
+  void readIndex()
+  {
+    if (std::memcmp(_data, RestartableDataFile::MAGIC, sizeof(RestartableDataFile::MAGIC)))
+      mooseError("'", _file_name, "' is not an indexed restartable data file");
+
+    std::size_t offset = sizeof(RestartableDataFile::MAGIC);
+    const auto version = read<std::uint64_t>(offset);
+    if (version != RestartableDataFile::VERSION)
+      mooseError("The restartable data file '",
+                 _file_name,
+                 "' has version ",
+                 version,
+                 " but version ",
+                 RestartableDataFile::VERSION,
+                 " is expected");
+    std::size_t index_offset = read<std::uint64_t>(offset);
+    const auto num_blocks = read<std::uint64_t>(offset);
+
+    _names.reserve(num_blocks);
+    for (std::uint64_t i = 0; i < num_blocks; ++i)
+    {
+      const auto name_size = read<std::uint64_t>(index_offset);
+      if (index_offset + name_size > _size)
+        mooseError("The restartable data file '", _file_name, "' is corrupt");
+      std::string name(_data + index_offset, name_size);
+      index_offset += name_size;
+
+      const auto block_offset = read<std::uint64_t>(index_offset);
+      const auto block_size = read<std::uint64_t>(index_offset);
+      if (block_offset + block_size > _size)
+        mooseError("The restartable data file '", _file_name, "' is corrupt");
+
+      _index.emplace(name, std::make_pair(block_offset, block_size));
+      _names.push_back(std::move(name));
+    }
+  }
+
+  const std::pair<std::uint64_t, std::uint64_t> & block(const std::string & name) const
+  {
+    const auto it = _index.find(name);
+    if (it == _index.end())
+      mooseError("The restartable data file '", _file_name, "' does not contain '", name, "'");
+    return it->second;
+  }
+
+  const std::string _file_name;
+  int _fd = -1;
+  std::size_t _size = 0;
+  const char * _data = nullptr;
+
+  /// Offset and size of each block
+  std::unordered_map<std::string, std::pair<std::uint64_t, std::uint64_t>> _index;
+  std::vector<std::string> _names;
+};
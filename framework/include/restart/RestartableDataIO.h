@@ -12,15 +12,19 @@
 // MOOSE includes
 #include "DataIO.h"
 #include "RestartableData.h"
+#include "RestartableDataFile.h"
+#include "RestartableDataDelta.h"
 #include "PerfGraphInterface.h"
 
 // C++ includes
 #include <sstream>
 #include <string>
 #include <list>
+#include <utility>
 
 // Forward declarations
 class Backup;
+class CheckpointSnapshot;
 class FEProblemBase;
 
 /**
@@ -42,6 +46,31 @@ public:
    */
   void useAsciiExtension();
 
+  /**
+   * Write the restartable data in the indexed format (see RestartableDataFile), in which every
+   * piece of data is an aligned block that is only read from a memory map when it is restored.
+   * Files in either format are recognized when reading.
+   */
+  void useIndexedFormat(bool indexed = true) { _use_indexed_format = indexed; }
+
+  /**
+   * Write the restartable data as delta checkpoints (see RestartableDataDelta): only the entries
+   * that changed since the previous checkpoint, with a full checkpoint every \p full_interval
+   * @param full_interval Every how many checkpoints a full one is written, 0 to write them all full
+   */
+  void useDeltaFormat(unsigned int full_interval)
+  {
+    _delta_full_interval = full_interval;
+    _deltas.clear();
+  }
+
+  /// Whether the next checkpoint of a thread is a full one, for the files the chain must keep
+  bool nextCheckpointIsFull(THREAD_ID tid = 0) const
+  {
+    return !_delta_full_interval || tid >= _deltas.size() || !_deltas[tid] ||
+           _deltas[tid]->sequence() % _delta_full_interval == 0;
+  }
+
   /**
    * Perform a restart of the libMesh Equation Systems from a file.
    */
@@ -56,6 +85,14 @@ public:
   void writeRestartableDataPerProc(const std::string & base_file_name,
                                    const RestartableDataMaps & restartable_data);
 
+  /**
+   * Serializes the restartable data of every thread into a checkpoint snapshot, in memory, under
+   * the file names writeRestartableDataPerProc() writes; the snapshot writes them out later
+   */
+  void stageRestartableDataPerProc(const std::string & base_file_name,
+                                   const RestartableDataMaps & restartable_data,
+                                   CheckpointSnapshot & snapshot);
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of
    * processors and threads.
@@ -71,6 +108,44 @@ public:
   void readRestartableData(const RestartableDataMap & restartable_data,
                            const DataNames & _recoverable_data_names,
                            unsigned int tid = 0);
+  /**
+   * Read the per-processor restartable data written by a run on a different number of processors
+   * or threads (N-to-M restart), once the mesh is repartitioned. The element keyed data (see
+   * RestartableElementData, e.g. the stateful material properties) is read from the files of all
+   * the old processors and threads through RestartableDataValue::loadElements(), which only keeps
+   * the elements this processor and thread evaluate; the other data is loaded from the file
+   * redistributionSource() gives.
+   * @param restartable_datas The data of every thread
+   * @param recoverable_data_names The names of the data restored on recover only
+   * @param n_old_procs The number of processors the data was written with
+   * @param n_old_threads The number of threads the data was written with
+   */
+  void readRestartableDataRedistributed(const RestartableDataMaps & restartable_datas,
+                                        const DataNames & recoverable_data_names,
+                                        processor_id_type n_old_procs,
+                                        unsigned int n_old_threads);
+
+  /**
+   * The old processor and thread whose file a new processor and thread restores its data that is
+   * not element keyed from
+   */
+  static std::pair<processor_id_type, THREAD_ID> redistributionSource(processor_id_type pid,
+                                                                      THREAD_ID tid,
+                                                                      processor_id_type n_old_procs,
+                                                                      unsigned int n_old_threads)
+  {
+    return std::make_pair(pid % n_old_procs, THREAD_ID(tid % n_old_threads));
+  }
+
+  /**
+   * Allow readRestartableDataHeader() to accept data written with a different number of
+   * processors or threads, which is then read by readRestartableDataRedistributed()
+   */
+  void setRedistributeOnLoad(bool value) { _redistribute_on_load = value; }
+
+  /// Whether the header read was written with a different number of processors or threads
+  bool needsRedistribution() const { return _needs_redistribution; }
+
   /**
    * Create a Backup for the current system.
    */
@@ -111,6 +186,35 @@ private:
                                   std::istream & stream,
                                   const DataNames & filter_names);
 
+  /**
+   * Serializes the data into an indexed file, one block per piece of data.
+   */
+  void serializeRestartableData(const RestartableDataMap & restartable_data,
+                                RestartableDataFileWriter & writer);
+
+  /**
+   * Deserializes the data that is both in the indexed file and in restartable_data. The
+   * blocks of the data that is filtered out or no longer exists are never read.
+   */
+  void deserializeRestartableData(const RestartableDataMap & restartable_data,
+                                  const RestartableDataFileReader & reader,
+                                  const DataNames & filter_names);
+
+  /**
+   * Serializes the changed data into a delta checkpoint of the chain of a thread
+   */
+  void serializeRestartableDataDelta(const RestartableDataMap & restartable_data,
+                                     THREAD_ID tid,
+                                     std::ostream & stream);
+
+  /**
+   * Deserializes the data reconstructed from a chain of delta checkpoints, from the last full
+   * checkpoint to the recovered one
+   */
+  void deserializeRestartableDataChain(const RestartableDataMap & restartable_data,
+                                       const std::vector<std::istream *> & chain,
+                                       const DataNames & filter_names);
+
   /**
    * Serializes the data for the Systems in FEProblemBase
    */
@@ -136,6 +240,18 @@ private:
   /// A vector of file handles, one per thread
   std::vector<std::shared_ptr<std::ifstream>> _in_file_handles;
 
+  /// Whether to write the indexed format
+  bool _use_indexed_format = false;
+
+  /// The mapped indexed files, one per thread (null for files in the stream format)
+  std::vector<std::shared_ptr<RestartableDataFileReader>> _in_file_readers;
+
+  /// The interval of the full checkpoints of the delta format, 0 when it is not used
+  unsigned int _delta_full_interval = 0;
+
+  /// The delta checkpoint chain of each thread
+  std::vector<std::unique_ptr<RestartableDataDelta>> _deltas;
+
   /// Timers
   const PerfID _restart_es_timer;
   const PerfID _restart_data_timer;
@@ -147,4 +263,10 @@ private:
   /// Error check controls
   bool _error_on_different_number_of_processors = true;
   bool _error_on_different_number_of_threads = true;
+
+  /// Whether data written with a different number of processors or threads is redistributed
+  bool _redistribute_on_load = false;
+
+  /// Whether the header read requires readRestartableDataRedistributed()
+  bool _needs_redistribution = false;
 };
@@ -16,6 +16,7 @@
 #include "DistributionInterface.h"
 #include "PerfGraphInterface.h"
 #include "SamplerInterface.h"
+#include "SampleRowWindow.h"
 
 template <>
 InputParameters validParams<Sampler>();
@@ -94,6 +95,27 @@ public:
    */
   std::vector<Real> getNextLocalRow();
 
+  /**
+   * Return a row of any processor, for the rows handed out at run time rather than by the
+   * partition of getLocalRowBegin/End (see StochasticTools::DynamicSampleQueue).
+   *
+   * The rows requested between two executions of the Sampler must increase: the generators are
+   * advanced over the rows skipped since the previous call, as getNextLocalRow does from the
+   * beginning of the local rows.
+   */
+  std::vector<Real> getRow(dof_id_type row);
+
+  /**
+   * Return a sample of any row, without the matrix of all the rows: the rows are generated a
+   * window at a time ("sample_window_rows" rows, see SampleRowWindow), so that a Sampler with
+   * more rows than fit in memory can still be accessed at random. Successive calls should mostly
+   * access increasing rows, as a row before the window regenerates the window from it.
+   *
+   * This is the preferred method when a loop only needs some columns or does not follow
+   * getNextLocalRow; getLocalSamples/getGlobalSamples should be kept for small designs.
+   */
+  Real getSample(dof_id_type row, dof_id_type col);
+
   /**
    * Return the number of samples.
    * @return The total number of rows that exist in all DenseMatrix values from the
@@ -257,6 +279,12 @@ private:
   /// Flag for restoring state during getNextLocalRow iteration
   bool _next_local_row_requires_state_restore;
 
+  /// Index of the row following the one last returned by getRow
+  dof_id_type _next_row = 0;
+
+  /// The rows generated for getSample, emptied when the Sampler executes
+  SampleRowWindow _sample_window;
+
   /// Flag to indicate if the init method for this class was called
   bool _initialized;
 
@@ -272,6 +300,9 @@ private:
   /// Max number of entries for matrix returned by getNextLocalRow
   const dof_id_type _limit_get_next_local_row;
 
+  /// The number of rows generated at once by getSample
+  const dof_id_type _sample_window_rows;
+
   ///@{
   /// PrefGraph timers
   const PerfID _perf_get_global_samples;
@@ -17,6 +17,10 @@
 
 // Forward declarations
 class FEProblemBase;
+namespace libMesh
+{
+class CouplingMatrix;
+}
 
 class Split;
 
@@ -36,6 +40,12 @@ public:
 
   virtual void setup(const std::string & prefix = "-");
 
+  /**
+   * Marks in \p used the Jacobian blocks this split (and its sub-splits) reads, see
+   * FieldSplitPreconditioner::usedJacobianBlocks()
+   */
+  virtual void addUsedJacobianBlocks(CouplingMatrix & used) const;
+
 protected:
   /// Which splitting to use
   enum SplittingType
@@ -70,6 +70,7 @@ public:
   /**
    * Adds u_dot, u_dotdot, u_dot_old and u_dotdot_old
    * vectors if requested by the time integrator
+   * and used by an object of this system (see SystemBase::requestSolutionState())
    */
   void addDotVectors();
 
@@ -126,6 +127,12 @@ public:
    */
   virtual void compute(ExecFlagType type);
 
+  /**
+   * Whether compute() skips the kernels whose inputs did not change since they were last
+   * computed (see AuxKernelTempl::inputsChanged())
+   */
+  void setSkipUnchangedKernels(bool skip) { _skip_unchanged_kernels = skip; }
+
   /**
    * Get a list of dependent UserObjects for this exec type
    * @param type Execution flag type
@@ -163,6 +170,27 @@ public:
   void clearScalarVariableCoupleableTags();
 
 protected:
+  /**
+   * Marks the active kernels of \p warehouse whose inputs did not change as skipped, on every
+   * thread; the inputs are global, so every processor makes the same decision
+   * @return Whether every kernel is skipped, in which case the loop over the mesh is not run
+   */
+  template <typename AuxKernelType>
+  bool markSkippedKernels(const MooseObjectWarehouse<AuxKernelType> & warehouse)
+  {
+    bool all_skipped = true;
+    const auto & objects = warehouse.getActiveObjects();
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+      const bool skip = _skip_unchanged_kernels && objects[i]->inputsTracked() &&
+                        !objects[i]->inputsChanged();
+      for (THREAD_ID tid = 0; tid < libMesh::n_threads(); ++tid)
+        warehouse.getActiveObjects(tid)[i]->setSkipped(skip);
+      all_skipped = all_skipped && skip;
+    }
+    return all_skipped;
+  }
+
   void computeScalarVars(ExecFlagType type);
   void computeNodalVars(ExecFlagType type);
   void computeNodalVecVars(ExecFlagType type);
@@ -238,6 +266,9 @@ protected:
   ExecuteMooseObjectWarehouse<ArrayAuxKernel> _nodal_array_aux_storage;
   ExecuteMooseObjectWarehouse<ArrayAuxKernel> _elemental_array_aux_storage;
 
+  /// See setSkipUnchangedKernels()
+  bool _skip_unchanged_kernels = false;
+
   /// Timers
   const PerfID _compute_scalar_vars_timer;
   const PerfID _compute_nodal_vars_timer;
@@ -16,6 +16,14 @@
 #include "PerfGraphInterface.h"
 #include "ComputeMortarFunctor.h"
 #include "MooseHashing.h"
+#include "CSRSlotMap.h"
+#include "GhostDependencySplit.h"
+#include "MultiTagResidualBuffer.h"
+#include "NodalBCDofLists.h"
+#include "ScalarBorderBuffer.h"
+#include "JacobianReusePolicy.h"
+#include "PreconditionerReusePolicy.h"
+#include "PrimaryFaceGroups.h"
 
 #include "libmesh/transient_system.h"
 #include "libmesh/nonlinear_implicit_system.h"
@@ -45,6 +53,7 @@ class Split;
 class KernelBase;
 class BoundaryCondition;
 class ResidualObject;
+class ADJacobianVectorProduct;
 
 // libMesh forward declarations
 namespace libMesh
@@ -129,6 +138,7 @@ public:
   /**
    * Add u_dot, u_dotdot, u_dot_old and u_dotdot_old
    * vectors if requested by the time integrator
+   * and used by an object of this system (see SystemBase::requestSolutionState())
    */
   void addDotVectors();
 
@@ -316,6 +326,91 @@ public:
    */
   void computeJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Lets computeJacobianTags() skip the assembly of the system matrix while the policy allows
+   * reusing the previous one; null turns the reuse off. The solves report their iteration counts
+   * to the policy.
+   */
+  void setJacobianReusePolicy(std::unique_ptr<JacobianReusePolicy> policy)
+  {
+    _jacobian_reuse = std::move(policy);
+  }
+
+  /// The Jacobian reuse policy, null when the Jacobian is always assembled
+  JacobianReusePolicy * jacobianReusePolicy() { return _jacobian_reuse.get(); }
+  const JacobianReusePolicy * jacobianReusePolicy() const { return _jacobian_reuse.get(); }
+
+  /**
+   * Lets the solves keep the preconditioner of a previous solve (KSPSetReusePreconditioner) while
+   * the policy allows it; null turns the reuse off. timestepSetup() and the solves report to the
+   * policy.
+   */
+  void setPreconditionerReusePolicy(std::unique_ptr<PreconditionerReusePolicy> policy)
+  {
+    _preconditioner_reuse = std::move(policy);
+  }
+
+  /// The preconditioner reuse policy, null when the preconditioner is rebuilt at every solve
+  PreconditionerReusePolicy * preconditionerReusePolicy() { return _preconditioner_reuse.get(); }
+  const PreconditionerReusePolicy * preconditionerReusePolicy() const
+  {
+    return _preconditioner_reuse.get();
+  }
+
+  /**
+   * Overlaps the update of the ghost values of the solution with the residual evaluation: the
+   * exchange is started non-blocking, the interior elements (reading local dofs only, see
+   * GhostDependencySplit) are computed while it completes, and the interface elements after it.
+   * The side, boundary and nodal loops, which are cheap next to the element loop, run after the
+   * exchange as before.
+   */
+  void setOverlapGhostExchange(bool overlap) { _overlap_ghost_exchange = overlap; }
+  bool overlapGhostExchange() const { return _overlap_ghost_exchange; }
+
+  /**
+   * Assembles all the tagged residual vectors of an evaluation (time, non-time, reference and the
+   * custom tags) together: the threads accumulate them in MultiTagResidualBuffers, whose
+   * off-processor contributions are exchanged in a single round before the vectors are set and
+   * closed without communication, instead of one zero and one close per tagged vector.
+   */
+  void setFusedTagAssembly(bool fused) { _fused_tag_assembly = fused; }
+  bool fusedTagAssembly() const { return _fused_tag_assembly; }
+
+  /**
+   * Applies the nodal BCs from per-BC lists of their local boundary nodes and dofs (see
+   * NodalBCDofLists) instead of searching the boundary node list and the warehouses at every
+   * evaluation: the residuals of a BC are set with one insertion and the Jacobian rows of the
+   * Dirichlet BCs are zeroed with a single MatZeroRows() call. The lists are rebuilt when the mesh
+   * or the set of active nodal BCs changes (see updateNodalBCDofLists()), and shouldApply() is
+   * still asked at every node of the lists.
+   */
+  void setBatchedNodalBCs(bool batched) { _batched_nodal_bcs = batched; }
+  bool batchedNodalBCs() const { return _batched_nodal_bcs; }
+
+  /**
+   * Assembles the Jacobian border coupling the field variables to the scalar variables (see
+   * ScalarBorderBuffer) from per-thread buffers reduced once per evaluation and inserted a row at
+   * a time, instead of the small per-element scalar blocks inserted into dense rows.
+   */
+  void setScalarBorderAssembly(bool border) { _scalar_border_assembly = border; }
+  bool scalarBorderAssembly() const { return _scalar_border_assembly; }
+
+  /**
+   * Computes the Jacobian-vector product J(u) v exactly with AD, with a single residual
+   * evaluation in which the derivatives are seeded with v (see SystemBase::setADDirection()).
+   * Only AD residual objects contribute to the product: all the objects of the problem must be AD
+   * objects when it is used as the Jacobian of the solve.
+   */
+  void computeADJacobianVectorProduct(const NumericVector<Number> & u,
+                                      const NumericVector<Number> & v,
+                                      NumericVector<Number> & Jv);
+
+  /**
+   * Replaces the finite-difference matrix-free Jacobian of JFNK/PJFNK with the AD one, see
+   * ADJacobianVectorProduct
+   */
+  void setupADJacobianVectorProduct();
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -445,6 +540,27 @@ public:
    */
   void useFieldSplitPreconditioner(bool use = true) { _use_field_split_preconditioner = use; }
 
+  /**
+   * If called with true, the threads add their cached Jacobian entries directly into a lock-free
+   * CSR value array (see Assembly::addCachedJacobianToSlots()) built from the sparsity pattern of
+   * the first assembled Jacobian, instead of inserting them into the matrix under a mutex.
+   */
+  void useLockFreeJacobianAssembly(bool use = true) { _lock_free_jacobian_assembly = use; }
+
+  /**
+   * Sets the type of the Jacobian matrix: "aij" (the default), "baij" or "sbaij" (the latter for
+   * symmetric problems) with blocks of all the variables at a node, or "auto" for "baij" whenever
+   * jacobianBlockSize() is larger than one.
+   */
+  void setJacobianMatrixType(const std::string & type);
+
+  /**
+   * The block size of the Jacobian: the number of variables when they all share their FE type
+   * and subdomains and there is no scalar variable (libMesh then puts them in a single variable
+   * group, whose dofs are numbered node by node), 1 otherwise
+   */
+  unsigned int jacobianBlockSize() const { return _jacobian_block_size; }
+
   /**
    * If called with true this will add entries into the jacobian to link together degrees of freedom
    * that are found to
@@ -468,6 +584,14 @@ public:
     _assemble_constraints_separately = separately;
   }
 
+  /**
+   * Indicates whether the node-face constraints group the secondary nodes by primary face: the
+   * primary face FE is then reinitialized once per face, at the contact points of all its
+   * secondary nodes, instead of once per secondary node. Has no effect when the constraints are
+   * assembled separately, which requires the one-node-at-a-time order.
+   */
+  void groupNodeFaceConstraints(bool group = true) { _group_node_face_constraints = group; }
+
   /**
    * Attach a customized preconditioner that requires physics knowledge.
    * Generic preconditioners should be implemented in PETSc, instead.
@@ -864,6 +988,143 @@ protected:
   /// Whether or not to use a FieldSplitPreconditioner matrix based on the decomposition
   bool _use_field_split_preconditioner;
 
+  /// Whether the ghost exchange is overlapped with the interior elements, see
+  /// setOverlapGhostExchange()
+  bool _overlap_ghost_exchange = false;
+
+  /// Whether the nodal BCs are applied from _nodal_bc_dofs, see setBatchedNodalBCs()
+  bool _batched_nodal_bcs = false;
+
+  /// The local boundary nodes and dofs of the active nodal BCs, by _batched_nodal_bc_objects index
+  NodalBCDofLists _nodal_bc_dofs;
+
+  /// The nodal BCs of _nodal_bc_dofs, by index
+  std::vector<NodalBCBase *> _batched_nodal_bc_objects;
+
+  /// Whether _nodal_bc_dofs must be rebuilt before the BCs are next applied
+  bool _nodal_bc_dofs_dirty = true;
+
+  /**
+   * Fills _nodal_bc_dofs and _batched_nodal_bc_objects from the boundary node range and the
+   * active objects of the nodal BC warehouse, marking the DirichletBCBase and ADDirichletBCBase
+   * objects as Dirichlet
+   */
+  void buildNodalBCDofLists();
+
+  /**
+   * Rebuilds _nodal_bc_dofs before the BCs are applied if the mesh changed, or if the active nodal
+   * BCs are not those the lists were built for (e.g. after a Control enabled or disabled some)
+   */
+  void updateNodalBCDofLists()
+  {
+    const auto & active = _nodal_bcs.getActiveObjects();
+    bool current = !_nodal_bc_dofs_dirty && active.size() == _batched_nodal_bc_objects.size();
+    for (std::size_t i = 0; current && i < active.size(); ++i)
+      current = active[i].get() == _batched_nodal_bc_objects[i];
+    if (current)
+      return;
+
+    buildNodalBCDofLists();
+    _nodal_bc_dofs_dirty = false;
+  }
+
+  /// Whether the tagged residual vectors are assembled together, see setFusedTagAssembly()
+  bool _fused_tag_assembly = false;
+
+  /// The per-thread accumulation of the tagged residuals when _fused_tag_assembly
+  std::vector<MultiTagResidualBuffer> _tag_residual_buffers;
+
+  /// Whether the scalar border of the Jacobian is buffered, see setScalarBorderAssembly()
+  bool _scalar_border_assembly = false;
+
+  /// The per-thread scalar borders when _scalar_border_assembly
+  std::vector<ScalarBorderBuffer> _scalar_border_buffers;
+
+  /**
+   * Resets _scalar_border_buffers for the dofs of the scalar variables and hands them to the
+   * Assembly of each thread
+   */
+  void prepareScalarBorder();
+
+  /// Joins, reduces and inserts _scalar_border_buffers into the Jacobian
+  void addScalarBorder(SparseMatrix<Number> & jacobian);
+
+  /// The local elements split by their dependency on ghost values, rebuilt after mesh changes
+  GhostDependencySplit _ghost_split;
+
+  /// Whether _ghost_split must be rebuilt before the next residual evaluation
+  bool _ghost_split_dirty = true;
+
+  /**
+   * Classifies the active local elements into _ghost_split from the dofs of the nonlinear
+   * variables on them (and on their side neighbors when DG is active)
+   */
+  void buildGhostDependencySplit();
+
+  /**
+   * Copies the local values of the solution into the ghosted solution and starts the scatter of
+   * the ghost values (VecScatterBegin on the send list)
+   */
+  void beginGhostExchange();
+
+  /// Completes the scatter of the ghost values started by beginGhostExchange()
+  void endGhostExchange();
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// The scatter of the ghost values of the solution, built with _ghost_split
+  VecScatter _ghost_scatter = nullptr;
+#endif
+
+  /// Whether the node-face constraints are evaluated per primary face
+  bool _group_node_face_constraints = false;
+
+  /// The secondary nodes grouped by primary face, per (primary, secondary) boundary pair; rebuilt
+  /// at each constraint evaluation, as the contact faces change with the penetration info
+  std::map<std::pair<BoundaryID, BoundaryID>, PrimaryFaceGroups> _primary_face_groups;
+
+  /**
+   * Detects the block size of the Jacobian and, if a block matrix is requested and possible, sets
+   * the matrix type and block size options of the system before its matrices are created, and
+   * switches the Assembly objects to blocked insertion
+   */
+  void setupBlockJacobian();
+
+  /// The requested type of the Jacobian matrix
+  std::string _jacobian_matrix_type = "aij";
+
+  /// The block size of the Jacobian, 1 for an AIJ matrix
+  unsigned int _jacobian_block_size = 1;
+
+  /// Whether or not the threads assemble the Jacobian into _jacobian_slot_values
+  bool _lock_free_jacobian_assembly = false;
+
+  /// Map from Jacobian entries to their CSR position, built on the first lock-free assembly
+  CSRSlotMap _jacobian_slot_map;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// The AD matrix-free Jacobian, when requested
+  std::unique_ptr<ADJacobianVectorProduct> _ad_jacobian_vector_product;
+#endif
+
+  /// Decides when the assembly of the Jacobian may be skipped, see setJacobianReusePolicy()
+  std::unique_ptr<JacobianReusePolicy> _jacobian_reuse;
+
+  /// Decides when a solve may keep the previous preconditioner, see setPreconditionerReusePolicy()
+  std::unique_ptr<PreconditionerReusePolicy> _preconditioner_reuse;
+
+  /// Lock-free accumulation buffer for the locally owned Jacobian rows
+  LockFreeCSRValues _jacobian_slot_values;
+
+  /**
+   * Build _jacobian_slot_map from the sparsity pattern of the given (assembled) matrix
+   */
+  void buildJacobianSlotMap(const SparseMatrix<Number> & jacobian);
+
+  /**
+   * Insert the accumulated _jacobian_slot_values into the matrix, one row at a time
+   */
+  void insertJacobianSlotValues(SparseMatrix<Number> & jacobian);
+
   /// Whether or not to add implicit geometric couplings to the Jacobian for FDP
   bool _add_implicit_geometric_coupling_entries_to_jacobian;
 
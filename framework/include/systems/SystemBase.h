@@ -13,11 +13,13 @@
 
 #include "DataIO.h"
 #include "MooseTypes.h"
+#include "ADDerivativeSize.h"
 #include "VariableWarehouse.h"
 #include "InputParameters.h"
 #include "MooseObjectWarehouseBase.h"
 #include "MooseVariableBase.h"
 #include "ConsoleStreamInterface.h"
+#include "SolutionStateRequests.h"
 
 // libMesh
 #include "libmesh/exodusII_io.h"
@@ -36,6 +38,7 @@ typedef MooseVariableFE<VectorValue<Real>> VectorMooseVariable;
 class MooseMesh;
 class SubProblem;
 class SystemBase;
+class MultiTagResidualBuffer;
 class TimeIntegrator;
 class InputParameters;
 
@@ -105,6 +108,14 @@ public:
    * @return The number of this system
    */
   virtual unsigned int number() const;
+
+  /**
+   * A counter incremented whenever the solution of the system may have changed (solves,
+   * residual evaluations, aux computations, restores), so that data computed from the solution
+   * can tell whether it is stale, see AuxKernelTempl::inputsChanged()
+   */
+  unsigned int solutionVersion() const { return _solution_version; }
+  void solutionChanged() { ++_solution_version; }
   virtual MooseMesh & mesh() { return _mesh; }
   virtual const MooseMesh & mesh() const { return _mesh; }
   virtual SubProblem & subproblem() { return _subproblem; }
@@ -257,6 +268,35 @@ public:
   virtual void saveOldSolutions();
   virtual void restoreOldSolutions();
 
+  /**
+   * Records that an object needs the old, older, previous Newton or a time derivative vector of
+   * this system. The previous Newton and time derivative vectors are only allocated (in
+   * addExtraVectors() and addDotVectors()) when requested, before initialSetup(); the old and
+   * older solutions are always allocated by libMesh and only reported. The coupling interfaces
+   * request the vectors for the objects calling valueOld(), valueOlder(), dot(), dotDot() and so
+   * on, the variables for their own accessors, and addTimeIntegrator() for the vectors of
+   * TimeIntegrator::solutionStatesNeeded().
+   */
+  void requestSolutionState(SolutionStateRequests::Vector vector, const std::string & requester)
+  {
+    _solution_state_requests.request(vector, requester);
+  }
+
+  /// Whether a solution state vector is needed by any object
+  bool solutionStateRequested(SolutionStateRequests::Vector vector) const
+  {
+    return _solution_state_requests.requested(vector);
+  }
+
+  /// Whether a solution state vector is allocated, see SolutionStateRequests::allocated()
+  bool solutionStateAllocated(SolutionStateRequests::Vector vector) const
+  {
+    return _solution_state_requests.allocated(vector);
+  }
+
+  /// The requests of the solution state vectors, to tell which objects they are kept for
+  const SolutionStateRequests & solutionStateRequests() const { return _solution_state_requests; }
+
   /**
    * Check if the named vector exists in the system.
    */
@@ -569,6 +609,51 @@ public:
    */
   std::size_t getMaxVarNDofsPerNode() const { return _max_var_n_dofs_per_node; }
 
+  /**
+   * The smallest instantiated AD derivative size (see Moose::selectADDerivativeSize()) that can
+   * hold the element dofs of all variables of this system, for dispatching derivative-size
+   * templated code with Moose::dispatchADDerivativeSize()
+   *
+   * @return The size, or 0 if it exceeds MOOSE_AD_MAX_DOFS_PER_ELEM
+   */
+  std::size_t getADDerivativeSize() const
+  {
+    return Moose::selectADDerivativeSize(_max_var_n_dofs_per_elem * nVariables());
+  }
+
+  /**
+   * Sets the direction the AD derivatives are seeded with, for computing Jacobian-vector products
+   * (see ADJacobianVectorProduct): while set, the variables seed the derivative of every dof i
+   * with direction(i) at the single derivative index ad_direction_index instead of with one at
+   * the index of the dof, so that the derivative of each AD residual entry is the corresponding
+   * entry of J v. Pass nullptr to go back to the usual seeding.
+   *
+   * The direction (typically a parallel vector from the solver) is copied into a ghosted vector
+   * of the system, so that the seeding reads the entries of the ghosted dofs of the local
+   * elements as well.
+   */
+  void setADDirection(const NumericVector<Number> * direction)
+  {
+    if (!direction)
+    {
+      _ad_direction = nullptr;
+      return;
+    }
+
+    if (!_ad_direction_ghosted)
+      _ad_direction_ghosted = &addVector("ad_direction", false, GHOSTED);
+    *_ad_direction_ghosted = *direction;
+    // Updates the ghosted entries
+    _ad_direction_ghosted->close();
+    _ad_direction = _ad_direction_ghosted;
+  }
+
+  /// The (ghosted) direction the AD derivatives are seeded with, or nullptr for the usual seeding
+  const NumericVector<Number> * adDirection() const { return _ad_direction; }
+
+  /// The derivative index a directional seeding uses
+  static constexpr unsigned int ad_direction_index = 0;
+
   /**
    * assign the maximum element dofs
    */
@@ -789,6 +874,13 @@ public:
    */
   void closeTaggedVectors(const std::set<TagID> & tags);
 
+  /**
+   * Sets the local parts of the vectors of the tags of an exchanged buffer (see
+   * MultiTagResidualBuffer::exchange()) and closes them all, without further communication
+   * since none of them has off-processor entries
+   */
+  void setTaggedVectors(const MultiTagResidualBuffer & buffer);
+
   /**
    * Zero vector with the given tag
    */
@@ -852,6 +944,27 @@ public:
 
   std::shared_ptr<TimeIntegrator> getSharedTimeIntegrator() { return _time_integrator; }
 
+  /**
+   * Sets the numbering of the dofs, applied when they are distributed:
+   *  "default": libMesh's, variable after variable, along the local element order
+   *  "rcm": the same, along the reverse Cuthill-McKee order of the local elements (see
+   *         ReverseCuthillMcKee), which keeps coupled dofs close
+   *  "node_blocked": all the variables of a node (element) contiguous, for multi-variable problems
+   */
+  void setDofOrdering(const std::string & ordering)
+  {
+    if (ordering != "default" && ordering != "rcm" && ordering != "node_blocked")
+      mooseError("Unknown dof ordering '", ordering, "' for the system ", _name);
+    _dof_ordering = ordering;
+  }
+  const std::string & dofOrdering() const { return _dof_ordering; }
+
+  /**
+   * The half bandwidth of the local dof couplings (the largest index distance between two dofs
+   * of an element), the bandwidth of the local Jacobian block, see DOFMapOutput
+   */
+  std::size_t dofBandwidth() const;
+
   /// caches the dof indices of provided variables in MooseMesh's FaceInfo data structure
   void cacheVarIndicesByFace(const std::vector<VariableName> & vars);
 
@@ -866,6 +979,9 @@ public:
 #endif
 
 protected:
+  /// See solutionVersion()
+  unsigned int _solution_version = 0;
+
   /**
    * Internal getters for the states of the solution as owned by libMesh.
    *
@@ -909,6 +1025,9 @@ protected:
   /// Active flags for tagged matrices
   std::vector<bool> _matrix_tag_active_flags;
 
+  /// The objects needing the old, older, previous Newton and time derivative vectors
+  SolutionStateRequests _solution_state_requests;
+
   // Used for saving old solutions so that they wont be accidentally changed
   NumericVector<Real> * _saved_old;
   NumericVector<Real> * _saved_older;
@@ -925,6 +1044,12 @@ protected:
   /// Maximum number of dofs for any one variable on any one element
   size_t _max_var_n_dofs_per_elem;
 
+  /// The direction the AD derivatives are seeded with, see setADDirection()
+  const NumericVector<Number> * _ad_direction = nullptr;
+
+  /// The ghosted copy of the direction, a vector of the system, see setADDirection()
+  NumericVector<Number> * _ad_direction_ghosted = nullptr;
+
   /// Maximum number of dofs for any one variable on any one node
   size_t _max_var_n_dofs_per_node;
 
@@ -952,6 +1077,13 @@ protected:
   /// The number of default solution states to store
   unsigned int _default_solution_states;
 
+  /// The numbering of the dofs, see setDofOrdering()
+  std::string _dof_ordering = "default";
+
+  /// Renumbers the local elements (rcm) or the dofs of each node (node_blocked) before the dofs
+  /// are distributed, see setDofOrdering()
+  void applyDofOrdering();
+
 private:
   /// The solution states (0 = current, 1 = old, 2 = older, etc)
   std::vector<NumericVector<Number> *> _solution_states;
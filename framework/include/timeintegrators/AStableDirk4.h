@@ -10,6 +10,7 @@
 #pragma once
 
 #include "TimeIntegrator.h"
+#include "DirkEmbeddedError.h"
 
 // Forward declarations
 class AStableDirk4;
@@ -65,6 +66,11 @@ public:
   void computeADTimeDerivatives(DualReal & ad_u_dot, const dof_id_type & dof) const override;
   virtual void solve() override;
   virtual void postResidual(NumericVector<Number> & residual) override;
+  virtual const NumericVector<Number> * errorEstimate() const override { return _error; }
+  virtual unsigned int errorEstimateOrder() const override
+  {
+    return _embedded.embeddedOrder() + 1;
+  }
 
 protected:
   /**
@@ -104,6 +110,19 @@ protected:
 
   // A pointer to the "bootstrapping" method to use if _safe_start==true.
   std::shared_ptr<LStableDirk4> _bootstrap_method;
+
+  /**
+   * The local truncation error estimate, from the stage solutions (see DirkEmbeddedError).
+   * The embedded second order solution uses the first two stages:
+   * bhat = 0, 1, 0
+   */
+  const DirkEmbeddedError _embedded;
+
+  // Store pointers to the various stage solutions, for the error estimate
+  NumericVector<Number> * _stage_solutions[3];
+
+  // The error estimate of the last step
+  NumericVector<Number> * _error;
 };
 
 template <typename T, typename T2>
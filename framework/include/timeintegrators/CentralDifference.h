@@ -29,6 +29,10 @@ public:
   virtual void initialSetup() override;
 
   virtual int order() override { return 2; }
+  virtual std::vector<SolutionStateRequests::Vector> solutionStatesNeeded() const override
+  {
+    return {SolutionStateRequests::U_DOT, SolutionStateRequests::U_DOTDOT};
+  }
   virtual void computeTimeDerivatives() override;
   void computeADTimeDerivatives(DualReal & ad_u_dot, const dof_id_type & dof) const override;
 
@@ -0,0 +1,164 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/**
+ * The local truncation error estimate of a DIRK method from an embedded solution of lower order.
+ *
+ * The embedded weights bhat are found from the order conditions of the requested order (1: sum of
+ * bhat = 1; 2: also bhat.c = 1/2; 3: also bhat.c^2 = 1/3 and bhat.Ac = 1/6), using the first
+ * stages only so that the embedded solution differs from the solution of the method. The error
+ * estimate is
+ *
+ *   e = dt sum_i (b_i - bhat_i) k_i
+ *
+ * with k_i the stage derivatives. Since the stage increments are U_i - u_old = dt sum_j a_ij k_j
+ * and the diagonal of A is nonzero, e is a combination of the stage solutions: e = sum_i w_i (U_i
+ * - u_old) with w = A^-T (b - bhat), so the estimate only needs the stage solutions to be kept.
+ */
+class DirkEmbeddedError
+{
+public:
+  /**
+   * @param a The Butcher tableau "A" of the method, lower triangular
+   * @param b The Butcher tableau "b" of the method
+   * @param embedded_order The order of the embedded solution, from 1 to 3
+   */
+  DirkEmbeddedError(const std::vector<std::vector<Real>> & a,
+                    const std::vector<Real> & b,
+                    unsigned int embedded_order)
+    : _n_stages(b.size()), _embedded_order(embedded_order)
+  {
+    if (a.size() != _n_stages)
+      mooseError("The Butcher tableau A and b of a DIRK method have different sizes");
+    if (embedded_order < 1 || embedded_order > 3)
+      mooseError("DirkEmbeddedError supports embedded orders 1 to 3, not ", embedded_order);
+
+    std::vector<Real> c(_n_stages, 0), ac(_n_stages, 0);
+    for (unsigned int i = 0; i < _n_stages; ++i)
+      for (unsigned int j = 0; j <= i; ++j)
+        c[i] += a[i][j];
+    for (unsigned int i = 0; i < _n_stages; ++i)
+      for (unsigned int j = 0; j <= i; ++j)
+        ac[i] += a[i][j] * c[j];
+
+    // The order conditions, as rows over the stages and right hand sides
+    std::vector<std::pair<std::vector<Real>, Real>> conditions;
+    conditions.emplace_back(std::vector<Real>(_n_stages, 1), 1.);
+    if (embedded_order >= 2)
+      conditions.emplace_back(c, 1. / 2);
+    if (embedded_order >= 3)
+    {
+      std::vector<Real> c2(_n_stages);
+      for (unsigned int i = 0; i < _n_stages; ++i)
+        c2[i] = c[i] * c[i];
+      conditions.emplace_back(c2, 1. / 3);
+      conditions.emplace_back(ac, 1. / 6);
+    }
+
+    const unsigned int m = conditions.size();
+    if (m >= _n_stages)
+      mooseError("A DIRK method with ",
+                 _n_stages,
+                 " stages has no embedded solution of order ",
+                 embedded_order);
+
+    // Solve the conditions for the weights of the first m stages by Gaussian elimination
+    std::vector<std::vector<Real>> lhs(m, std::vector<Real>(m + 1));
+    for (unsigned int r = 0; r < m; ++r)
+    {
+      for (unsigned int j = 0; j < m; ++j)
+        lhs[r][j] = conditions[r].first[j];
+      lhs[r][m] = conditions[r].second;
+    }
+    for (unsigned int k = 0; k < m; ++k)
+    {
+      unsigned int pivot = k;
+      for (unsigned int r = k + 1; r < m; ++r)
+        if (std::abs(lhs[r][k]) > std::abs(lhs[pivot][k]))
+          pivot = r;
+      if (std::abs(lhs[pivot][k]) < 1e-12)
+        mooseError("The order conditions of the embedded DIRK solution are singular");
+      std::swap(lhs[k], lhs[pivot]);
+      for (unsigned int r = 0; r < m; ++r)
+        if (r != k)
+        {
+          const Real factor = lhs[r][k] / lhs[k][k];
+          for (unsigned int j = k; j <= m; ++j)
+            lhs[r][j] -= factor * lhs[k][j];
+        }
+    }
+    _bhat.assign(_n_stages, 0);
+    for (unsigned int k = 0; k < m; ++k)
+      _bhat[k] = lhs[k][m] / lhs[k][k];
+
+    // w = A^-T (b - bhat), by back substitution
+    _weights.assign(_n_stages, 0);
+    for (unsigned int i = _n_stages; i-- > 0;)
+    {
+      if (a[i][i] == 0)
+        mooseError("DirkEmbeddedError requires a nonzero diagonal in the Butcher tableau");
+      Real rhs = b[i] - _bhat[i];
+      for (unsigned int j = i + 1; j < _n_stages; ++j)
+        rhs -= a[j][i] * _weights[j];
+      _weights[i] = rhs / a[i][i];
+    }
+
+    _old_weight = 0;
+    for (const auto w : _weights)
+      _old_weight -= w;
+  }
+
+  unsigned int numStages() const { return _n_stages; }
+
+  /// The order of the embedded solution; the estimate is of order embeddedOrder() + 1
+  unsigned int embeddedOrder() const { return _embedded_order; }
+
+  /// The weights of the embedded solution
+  const std::vector<Real> & embeddedWeights() const { return _bhat; }
+
+  /// The weights w of the stage solutions in the error estimate
+  const std::vector<Real> & stageWeights() const { return _weights; }
+
+  /**
+   * Computes the error estimate
+   * @param stage_solutions The solutions of the stages
+   * @param u_old The solution at the beginning of the step
+   * @param error The estimate, e.g. a NumericVector (anything with zero() and add(Real, vector))
+   */
+  template <typename Vector>
+  void compute(const std::vector<const Vector *> & stage_solutions,
+               const Vector & u_old,
+               Vector & error) const
+  {
+    mooseAssert(stage_solutions.size() == _n_stages, "Wrong number of stage solutions");
+    error.zero();
+    for (unsigned int i = 0; i < _n_stages; ++i)
+      error.add(_weights[i], *stage_solutions[i]);
+    error.add(_old_weight, u_old);
+  }
+
+private:
+  const unsigned int _n_stages;
+  const unsigned int _embedded_order;
+
+  std::vector<Real> _bhat;
+  std::vector<Real> _weights;
+
+  /// The weight of u_old in the error estimate, minus the sum of the stage weights
+  Real _old_weight;
+};
@@ -17,6 +17,9 @@
 #include "libmesh/numeric_vector.h"
 
 #include "LumpedPreconditioner.h"
+#include "SubcyclingLevels.h"
+
+class ElementStableDTInterface;
 
 class ExplicitTimeIntegrator;
 
@@ -66,6 +69,55 @@ protected:
    */
   bool checkLinearConvergence();
 
+  /**
+   * Whether the step is subcycled ("subcycling_stable_dt"): the dofs of the elements of level k
+   * (see SubcyclingLevels) take 2^k substeps per step, the others keep the values interpolated
+   * in time between their own steps. The level of a dof is the finest level of its elements.
+   */
+  bool subcycled() const { return _stable_dt; }
+
+  /// Builds the subcycling levels of the elements and of the local dofs for the current dt
+  void buildSubcyclingLevels();
+
+  /**
+   * Advances the dofs of the levels completing one of their steps at the end of a substep with the
+   * lumped mass, from the residual of their elements only
+   * @param substep The substep, from 1 to _subcycling_levels.numSubsteps()
+   */
+  bool performSubcycledSolve(unsigned int substep);
+
+  /**
+   * Whether _mass_matrix_diag holds the inverse lumped mass of the current mesh. With
+   * "constant_mass" the lumped mass is assembled and inverted once (and again after a mesh
+   * change) instead of at every step, which skips the assembly of the time (mass) tag entirely.
+   */
+  bool lumpedMassCurrent() const { return _constant_mass && _lumped_mass_current; }
+
+  /**
+   * The fused explicit update of the local entries, in one pass instead of a pointwise product and
+   * vector additions:
+   *   u[i] = a * x[i] + b * y[i] + c * mass_inverse[i] * residual[i]
+   * e.g. u = u_old + dt M^-1 r for forward Euler and u = 2 u_old - u_older + dt^2 M^-1 r for
+   * central differences (y may be nullptr when b = 0).
+   */
+  static void fusedLumpedUpdate(numeric_index_type n,
+                                Real a,
+                                const Number * x,
+                                Real b,
+                                const Number * y,
+                                Real c,
+                                const Number * mass_inverse,
+                                const Number * residual,
+                                Number * u)
+  {
+    if (y)
+      for (numeric_index_type i = 0; i < n; ++i)
+        u[i] = a * x[i] + b * y[i] + c * mass_inverse[i] * residual[i];
+    else
+      for (numeric_index_type i = 0; i < n; ++i)
+        u[i] = a * x[i] + c * mass_inverse[i] * residual[i];
+  }
+
   /// Solve type for how mass matrix is handled
   MooseEnum _solve_type;
 
@@ -92,4 +144,18 @@ protected:
 
   /// Save off current time to reset it back and forth
   Real _current_time;
+
+  /// Whether the lumped mass is constant ("constant_mass"), see lumpedMassCurrent()
+  const bool _constant_mass;
+  /// Whether the inverse lumped mass was computed since the last mesh change
+  bool _lumped_mass_current = false;
+
+  /// The stable time step of each element for subcycling, nullptr for a single rate step
+  const ElementStableDTInterface * _stable_dt;
+  /// The finest subcycling level
+  const unsigned int _max_subcycling_level;
+  /// The subcycling levels of the local elements
+  SubcyclingLevels _subcycling_levels;
+  /// The subcycling level of each local dof
+  std::vector<unsigned char> _dof_levels;
 };
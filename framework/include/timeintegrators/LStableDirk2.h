@@ -10,6 +10,7 @@
 #pragma once
 
 #include "TimeIntegrator.h"
+#include "DirkEmbeddedError.h"
 
 class LStableDirk2;
 
@@ -52,6 +53,11 @@ public:
   void computeADTimeDerivatives(DualReal & ad_u_dot, const dof_id_type & dof) const override;
   virtual void solve() override;
   virtual void postResidual(NumericVector<Number> & residual) override;
+  virtual const NumericVector<Number> * errorEstimate() const override { return _error; }
+  virtual unsigned int errorEstimateOrder() const override
+  {
+    return _embedded.embeddedOrder() + 1;
+  }
 
 protected:
   /**
@@ -71,6 +77,18 @@ protected:
 
   // The parameter of the method, set at construction time and cannot be changed.
   const Real _alpha;
+
+  /**
+   * The local truncation error estimate, from the stage solutions (see DirkEmbeddedError).
+   * The embedded first order solution is u_old + dt k_1 (bhat = 1, 0).
+   */
+  const DirkEmbeddedError _embedded;
+
+  // Store pointers to the various stage solutions, for the error estimate
+  NumericVector<Number> * _stage_solutions[2];
+
+  // The error estimate of the last step
+  NumericVector<Number> * _error;
 };
 
 template <typename T, typename T2>
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "TimeIntegrator.h"
+#include "DirkEmbeddedError.h"
 
 class LStableDirk3;
 
@@ -55,6 +56,11 @@ public:
                                         const dof_id_type & dof) const override;
   virtual void solve() override;
   virtual void postResidual(NumericVector<Number> & residual) override;
+  virtual const NumericVector<Number> * errorEstimate() const override { return _error; }
+  virtual unsigned int errorEstimateOrder() const override
+  {
+    return _embedded.embeddedOrder() + 1;
+  }
 
 protected:
   /**
@@ -82,6 +88,19 @@ protected:
   // 0.2820667392457705,  0.4358665215084589
   // 1.2084966491760099, -0.6443631706844688, 0.4358665215084589
   Real _a[3][3];
+
+  /**
+   * The local truncation error estimate, from the stage solutions (see DirkEmbeddedError).
+   * The embedded second order solution uses the first two stages:
+   * bhat = 0.7726301276675508, 0.2273698723324492, 0
+   */
+  const DirkEmbeddedError _embedded;
+
+  // Store pointers to the various stage solutions, for the error estimate
+  NumericVector<Number> * _stage_solutions[3];
+
+  // The error estimate of the last step
+  NumericVector<Number> * _error;
 };
 
 template <typename T, typename T2>
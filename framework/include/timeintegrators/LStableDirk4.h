@@ -10,6 +10,7 @@
 #pragma once
 
 #include "TimeIntegrator.h"
+#include "DirkEmbeddedError.h"
 
 class LStableDirk4;
 
@@ -66,6 +67,11 @@ public:
                                         const dof_id_type & dof) const override;
   virtual void solve() override;
   virtual void postResidual(NumericVector<Number> & residual) override;
+  virtual const NumericVector<Number> * errorEstimate() const override { return _error; }
+  virtual unsigned int errorEstimateOrder() const override
+  {
+    return _embedded.embeddedOrder() + 1;
+  }
 
 protected:
   /**
@@ -92,6 +98,19 @@ protected:
   // Butcher tableau "A" values derived from _gamma.  We only use the
   // lower triangle of this.
   static const Real _a[_n_stages][_n_stages];
+
+  /**
+   * The local truncation error estimate, from the stage solutions (see DirkEmbeddedError).
+   * The embedded third order solution uses the first four stages:
+   * bhat = -2/3, 5/12, 7/6, 1/12, 0
+   */
+  const DirkEmbeddedError _embedded;
+
+  // Store pointers to the various stage solutions, for the error estimate
+  NumericVector<Number> * _stage_solutions[_n_stages];
+
+  // The error estimate of the last step
+  NumericVector<Number> * _error;
 };
 
 template <typename T, typename T2>
@@ -29,6 +29,13 @@ public:
   virtual ~NewmarkBeta();
 
   virtual int order() override { return 1; }
+  virtual std::vector<SolutionStateRequests::Vector> solutionStatesNeeded() const override
+  {
+    return {SolutionStateRequests::U_DOT,
+            SolutionStateRequests::U_DOTDOT,
+            SolutionStateRequests::U_DOT_OLD,
+            SolutionStateRequests::U_DOTDOT_OLD};
+  }
   virtual void computeTimeDerivatives() override;
   virtual void computeADTimeDerivatives(DualReal & ad_u_dot,
                                         const dof_id_type & dof) const override;
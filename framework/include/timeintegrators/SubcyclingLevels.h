@@ -0,0 +1,140 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * The subcycling levels of a multi-rate explicit step: an element of level k takes 2^k substeps
+ * of dt / 2^k per global step dt, so that the few small elements of a locally refined mesh no
+ * longer restrict the step of all the others.
+ *
+ * The global step is split into 2^L substeps of the finest level L. At the end of substep s
+ * (counted from 1) the levels k >= lowestActiveLevel(s) have completed one of their own steps;
+ * every level has completed its steps at the end of the last substep.
+ */
+class SubcyclingLevels
+{
+public:
+  /**
+   * Chooses the global dt and the level of each element
+   * @param stable_dt The stable dt of each element
+   * @param max_level The finest level allowed, i.e. at most 2^max_level substeps per step
+   * @return The global dt, the one minimizing the number of element updates per unit time
+   */
+  Real build(const std::vector<Real> & stable_dt, unsigned int max_level)
+  {
+    if (stable_dt.empty())
+      mooseError("No element to compute the subcycling levels of");
+
+    std::vector<Real> sorted(stable_dt);
+    std::sort(sorted.begin(), sorted.end());
+    if (!(sorted.front() > 0))
+      mooseError("The stable time step of every element must be positive");
+
+    // The global dt must leave the smallest element stable at the finest level
+    const Real cap = std::ldexp(sorted.front(), max_level);
+    _dt = sorted.front();
+    Real best = cost(sorted, _dt, max_level);
+    for (const auto dt_e : sorted)
+      for (unsigned int k = 0; k <= max_level; ++k)
+      {
+        const Real dt = std::ldexp(dt_e, k);
+        if (dt > cap)
+          break;
+        const Real c = cost(sorted, dt, max_level);
+        if (c < best)
+        {
+          best = c;
+          _dt = dt;
+        }
+      }
+
+    _levels.resize(stable_dt.size());
+    _max_level = 0;
+    for (std::size_t e = 0; e < stable_dt.size(); ++e)
+    {
+      _levels[e] = level(stable_dt[e], _dt, max_level);
+      _max_level = std::max(_max_level, _levels[e]);
+    }
+    _speedup = sorted.size() / sorted.front() / best;
+    return _dt;
+  }
+
+  /// The global dt chosen by build()
+  Real dt() const { return _dt; }
+
+  /// The level of an element, by its index in the stable dts given to build()
+  unsigned int level(std::size_t e) const { return _levels[e]; }
+  const std::vector<unsigned int> & levels() const { return _levels; }
+
+  /// The finest level of the elements
+  unsigned int maxLevel() const { return _max_level; }
+
+  /// The number of substeps of the finest level per global step
+  unsigned int numSubsteps() const { return 1u << _max_level; }
+
+  /// The dt of the steps of a level
+  Real levelDT(unsigned int k) const { return std::ldexp(_dt, -static_cast<int>(k)); }
+
+  /// The coarsest level that completes one of its steps at the end of a substep (from 1)
+  unsigned int lowestActiveLevel(unsigned int substep) const
+  {
+    mooseAssert(substep >= 1 && substep <= numSubsteps(), "Substep out of range");
+    unsigned int trailing_zeros = 0;
+    while (!(substep & 1u))
+    {
+      substep >>= 1;
+      ++trailing_zeros;
+    }
+    return trailing_zeros >= _max_level ? 0 : _max_level - trailing_zeros;
+  }
+
+  /// The number of element updates saved relative to a single rate step at the smallest stable dt
+  Real speedup() const { return _speedup; }
+
+private:
+  /// The level an element of stable dt \p stable_dt needs for a global dt \p dt
+  static unsigned int level(Real stable_dt, Real dt, unsigned int max_level)
+  {
+    unsigned int k = 0;
+    // A relative tolerance so that dt = stable_dt * 2^k gives level k
+    while (k < max_level && std::ldexp(stable_dt, k) * (1 + 1e-12) < dt)
+      ++k;
+    return k;
+  }
+
+  /// The number of element updates per unit time for a global dt
+  static Real cost(const std::vector<Real> & sorted, Real dt, unsigned int max_level)
+  {
+    Real updates = 0;
+    auto end = sorted.end();
+    for (unsigned int k = 0; k <= max_level; ++k)
+    {
+      // The elements of level k are those stable at dt / 2^k but not at dt / 2^(k - 1)
+      const Real level_dt = std::ldexp(dt, -static_cast<int>(k)) / (1 + 1e-12);
+      const auto begin =
+          k == max_level ? sorted.begin() : std::lower_bound(sorted.begin(), end, level_dt);
+      updates += std::ldexp(static_cast<Real>(end - begin), k);
+      end = begin;
+    }
+    return updates / dt;
+  }
+
+  Real _dt = 0;
+  std::vector<unsigned int> _levels;
+  unsigned int _max_level = 0;
+  Real _speedup = 1;
+};
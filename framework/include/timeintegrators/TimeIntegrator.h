@@ -12,6 +12,7 @@
 // MOOSE includes
 #include "MooseObject.h"
 #include "Restartable.h"
+#include "SolutionStateRequests.h"
 
 // Forward declarations
 class TimeIntegrator;
@@ -100,6 +101,24 @@ public:
 
   virtual int order() = 0;
 
+  /**
+   * The time derivative vectors this integrator computes or reads, requested from its system
+   * when it is added (see SystemBase::requestSolutionState())
+   */
+  virtual std::vector<SolutionStateRequests::Vector> solutionStatesNeeded() const
+  {
+    return {SolutionStateRequests::U_DOT};
+  }
+
+  /**
+   * The estimate of the local truncation error of the last step, for error controlled time
+   * stepping (see EmbeddedErrorDT); null when the method computes none
+   */
+  virtual const NumericVector<Number> * errorEstimate() const { return nullptr; }
+
+  /// The order of errorEstimate() in the time step
+  virtual unsigned int errorEstimateOrder() const { return 0; }
+
   /**
    * Computes the time derivative and the Jacobian of the time derivative
    *
@@ -0,0 +1,95 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * Follows the residual norms of a nonlinear solve to tell early when it will not converge within
+ * its iteration limit, so that the step can be cut back right away instead of after
+ * nl_max_its iterations (see CostAwareDT).
+ *
+ * The contraction rate is measured over the last few iterations, rho = (r_k / r_(k-m))^(1/m),
+ * and the iterations still needed are predicted as log(target / r_k) / log(rho). The solve is
+ * doomed when, after min_iterations, rho stays above max_rate (stagnation or divergence) or the
+ * prediction exceeds the iterations left.
+ */
+class ConvergenceTrend
+{
+public:
+  /**
+   * @param min_iterations The iterations before any verdict
+   * @param window The number of iterations the rate is measured over
+   * @param max_rate The contraction rate at or above which the solve is stagnating
+   */
+  ConvergenceTrend(unsigned int min_iterations = 3, unsigned int window = 2, Real max_rate = 0.95)
+    : _min_iterations(min_iterations), _window(window), _max_rate(max_rate)
+  {
+  }
+
+  /// Starts following a new solve
+  void reset() { _norms.clear(); }
+
+  /// Records the residual norm of the next iteration (the initial residual first)
+  void add(Real norm) { _norms.push_back(norm); }
+
+  /// The number of iterations recorded (not counting the initial residual)
+  unsigned int iterations() const { return _norms.empty() ? 0 : _norms.size() - 1; }
+
+  /// The contraction rate over the last window iterations, 0 when not measurable yet
+  Real rate() const
+  {
+    if (_norms.size() < _window + 1)
+      return 0;
+    const Real last = _norms.back(), first = _norms[_norms.size() - 1 - _window];
+    if (first <= 0 || last <= 0)
+      return 0;
+    return std::pow(last / first, 1. / _window);
+  }
+
+  /// The predicted iterations to reach the target norm, infinite when not contracting
+  Real predictedIterations(Real target) const
+  {
+    if (_norms.empty() || _norms.back() <= target)
+      return 0;
+    const Real rho = rate();
+    if (rho <= 0)
+      return 0;
+    if (rho >= 1)
+      return std::numeric_limits<Real>::infinity();
+    return std::log(target / _norms.back()) / std::log(rho);
+  }
+
+  /**
+   * Whether the solve will not reach the target norm within max_iterations
+   * @param target The residual norm of convergence (e.g. max(abs_tol, rel_tol * r_0))
+   * @param max_iterations The iteration limit of the solve
+   */
+  bool doomed(Real target, unsigned int max_iterations) const
+  {
+    if (iterations() < _min_iterations || _norms.size() < _window + 1)
+      return false;
+    if (rate() >= _max_rate)
+      return true;
+    return iterations() + predictedIterations(target) > max_iterations;
+  }
+
+private:
+  const unsigned int _min_iterations;
+  const unsigned int _window;
+  const Real _max_rate;
+
+  /// The residual norms, from the initial one
+  std::vector<Real> _norms;
+};
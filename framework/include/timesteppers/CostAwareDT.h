@@ -0,0 +1,76 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "IterationAdaptiveDT.h"
+#include "StepCostModel.h"
+#include "ConvergenceTrend.h"
+
+#include <chrono>
+
+class CostAwareDT;
+
+template <>
+InputParameters validParams<CostAwareDT>();
+
+/**
+ * An IterationAdaptiveDT that picks the dt maximizing the simulated time advanced per wall
+ * second instead of targeting an iteration count. The wall time of every step (converged or not)
+ * is recorded in a StepCostModel, which fits the cost of a step against dt and the probability
+ * that it fails from where the recent steps failed, and the next dt is the best one of the model
+ * within [cutback_factor, growth_factor] * dt. The limits of IterationAdaptiveDT (functions,
+ * postprocessor, sync times) still apply on top.
+ *
+ * A ConvergenceTrend follows the nonlinear residuals during the solve (see
+ * residualNormCallback()) and aborts a solve that will not converge within nl_max_its as soon as
+ * that is clear, so that a failed step costs only a fraction of a converged one.
+ */
+class CostAwareDT : public IterationAdaptiveDT
+{
+public:
+  static InputParameters validParams();
+
+  CostAwareDT(const InputParameters & parameters);
+
+  virtual void preSolve() override;
+  virtual void rejectStep() override;
+  virtual void acceptStep() override;
+
+  /**
+   * Called with the residual norm of every nonlinear iteration, from the convergence check
+   * @return Whether the solve is doomed and should be aborted
+   */
+  bool residualNormCallback(Real norm, Real target);
+
+protected:
+  virtual Real computeDT() override;
+  virtual Real computeFailedDT() override;
+
+  /// Records the step just solved in the cost model
+  void recordStep(bool converged);
+
+  /// Whether doomed solves are aborted early
+  const bool _early_abort;
+
+  /// The number of candidate dts evaluated when picking the next one
+  const unsigned int _n_candidates;
+
+  /// The model of the cost of a step
+  StepCostModel _cost_model;
+
+  /// The residual history of the current solve
+  ConvergenceTrend _trend;
+
+  /// The start of the current solve
+  std::chrono::steady_clock::time_point _solve_start;
+
+  /// Whether the current solve was aborted by residualNormCallback()
+  bool _aborted;
+};
@@ -0,0 +1,65 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "TimeStepper.h"
+#include "PIStepController.h"
+
+/**
+ * Adjust the timestep from the local truncation error estimate of the time integrator
+ * (TimeIntegrator::errorEstimate(), e.g. the embedded solutions of the DIRK methods). The error
+ * is scaled by absolute_tolerance + relative_tolerance * max(|u|, |u_old|) dof by dof and its RMS
+ * norm is used by a PI controller: the steps with a norm above 1 are rejected and retried with a
+ * smaller dt, the others give the next dt. Smooth phases are then taken with the largest steps
+ * that meet the tolerances, instead of the steps an iteration count allows.
+ */
+class EmbeddedErrorDT : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+
+  EmbeddedErrorDT(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void step() override;
+  virtual void rejectStep() override;
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+  virtual Real computeFailedDT() override;
+  virtual bool converged() const override;
+
+  /// The RMS norm of the scaled error estimate of the last step, 1 at the tolerance
+  Real scaledErrorNorm() const;
+
+  /// The dt of the first step
+  const Real _initial_dt;
+
+  ///@{ The tolerances of the error scaling
+  const Real _abs_tol;
+  const Real _rel_tol;
+  ///@}
+
+  ///@{ The controller settings
+  const Real _safety;
+  const Real _min_factor;
+  const Real _max_factor;
+  ///@}
+
+  /// The controller, set up in init() for the order of the integrator's estimate
+  std::unique_ptr<PIStepController> _controller;
+
+  /// The scaled error norm of the last step
+  Real _error_norm;
+
+  /// Whether the last step met the tolerances
+  bool _error_accepted;
+};
@@ -0,0 +1,98 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Proportional-integral step size controller (Gustafsson, Soederlind) on a scaled error
+ * estimate, where an error of 1 is the tolerance. After an accepted step the next one is
+ *
+ *   dt_new = dt * safety * err^(-alpha / k) * err_old^(beta / k)
+ *
+ * with k the order of the error estimate, which grows the step smoothly through smooth phases
+ * without the oscillations of the plain (integral only) controller. A step whose error exceeds 1
+ * is rejected, and retried with dt * safety * err^(-1 / k). The change of step is kept within
+ * [min_factor, max_factor].
+ */
+class PIStepController
+{
+public:
+  /**
+   * @param order The order k of the error estimate (the embedded order + 1)
+   * @param safety The safety factor, below 1
+   * @param min_factor The smallest step change
+   * @param max_factor The largest step change
+   * @param alpha The integral gain
+   * @param beta The proportional gain, 0 gives the integral controller
+   */
+  PIStepController(unsigned int order,
+                   Real safety = 0.9,
+                   Real min_factor = 0.2,
+                   Real max_factor = 5,
+                   Real alpha = 0.7,
+                   Real beta = 0.4)
+    : _order(order),
+      _safety(safety),
+      _min_factor(min_factor),
+      _max_factor(max_factor),
+      _alpha(alpha),
+      _beta(beta),
+      _err_old(1)
+  {
+    if (order == 0)
+      mooseError("The order of the error estimate must be positive");
+    if (min_factor <= 0 || min_factor > 1 || max_factor < 1)
+      mooseError("The step change bounds must satisfy 0 < min_factor <= 1 <= max_factor");
+  }
+
+  /// Whether a step with this scaled error is accepted
+  static bool accepted(Real err) { return err <= 1; }
+
+  /**
+   * The next step after a step of size dt with the scaled error err; updates the history when
+   * the step is accepted
+   */
+  Real next(Real dt, Real err)
+  {
+    // An error of zero (e.g. a linear solution) would give an infinite step
+    err = std::max(err, 1e-10);
+    const Real k = _order;
+
+    Real factor;
+    if (accepted(err))
+    {
+      factor = _safety * std::pow(err, -_alpha / k) * std::pow(_err_old, _beta / k);
+      _err_old = err;
+    }
+    else
+      factor = std::min(Real(1), _safety * std::pow(err, -1 / k));
+
+    return dt * std::min(_max_factor, std::max(_min_factor, factor));
+  }
+
+  /// Forgets the error history, e.g. after a failed solve
+  void reset() { _err_old = 1; }
+
+private:
+  const unsigned int _order;
+  const Real _safety;
+  const Real _min_factor;
+  const Real _max_factor;
+  const Real _alpha;
+  const Real _beta;
+
+  /// The scaled error of the last accepted step
+  Real _err_old;
+};
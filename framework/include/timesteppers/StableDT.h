@@ -0,0 +1,54 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "TimeStepper.h"
+#include "SubcyclingLevels.h"
+
+class StableDT;
+class ElementStableDTInterface;
+
+template <>
+InputParameters validParams<StableDT>();
+
+/**
+ * Computes dt from the stable time step of each element (see ElementStableDTInterface).
+ * Without subcycling dt is the smallest stable time step; with "max_subcycling_level" > 0 it
+ * is the global step of the subcycling levels of the elements, which the small elements cover
+ * in up to 2^max_subcycling_level substeps (see ExplicitTimeIntegrator).
+ */
+class StableDT : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+
+  StableDT(const InputParameters & parameters);
+
+  virtual void init() override;
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  /// Gathers the stable time steps of all the elements and builds their subcycling levels
+  Real subcycledDT();
+
+  /// The UserObject computing the stable time step of each element
+  const ElementStableDTInterface * _stable_dt;
+
+  /// Safety factor multiplied to the stable time step
+  const Real & _factor;
+
+  /// The finest subcycling level, 0 for a single rate step
+  const unsigned int _max_subcycling_level;
+
+  /// The subcycling levels of the gathered elements
+  SubcyclingLevels _levels;
+};
@@ -0,0 +1,191 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+
+/**
+ * A model of the cost of a time step as a function of dt, fit to the last steps, for choosing the
+ * dt that advances the simulated time fastest per wall second (see CostAwareDT):
+ *
+ * - The wall time of a converged step is fit as t(dt) = exp(alpha) dt^beta (least squares in
+ *   log-log) to the converged steps, beta being 0 until the recorded dts differ.
+ * - The failure probability is p(dt) = 1 / (1 + (dt_crit / dt)^steepness), where dt_crit lies
+ *   from the largest recent converged dt and the smallest recent failed dt (their geometric mean
+ *   when the failed one is larger, the failed one otherwise), and p = 0 without a failure on
+ *   record.
+ * - A failed attempt costs the fraction abort_fraction of t(dt) (the solve being aborted early)
+ *   and is followed by a step of cutback * dt.
+ *
+ * The rate to maximize is then the expected simulated time over the expected wall time:
+ *
+ *   rate(dt) = ((1 - p) dt + p c dt) / ((1 - p) t(dt) + p (f t(dt) + t(c dt)))
+ */
+class StepCostModel
+{
+public:
+  /**
+   * @param window The number of steps kept
+   * @param cutback The factor dt is cut by after a failure
+   * @param abort_fraction The fraction of the cost of a converged step a failed one costs
+   * @param steepness How sharply the failure probability rises around dt_crit
+   */
+  StepCostModel(unsigned int window = 20,
+                Real cutback = 0.5,
+                Real abort_fraction = 0.5,
+                Real steepness = 4)
+    : _window(window), _cutback(cutback), _abort_fraction(abort_fraction), _steepness(steepness)
+  {
+    if (window < 2)
+      mooseError("A StepCostModel needs a window of at least two steps");
+    if (cutback <= 0 || cutback >= 1)
+      mooseError("The cutback factor of a StepCostModel must be in (0, 1)");
+  }
+
+  /// Records a step: its dt, its wall time and whether it converged
+  void record(Real dt, Real wall_time, bool converged)
+  {
+    if (dt <= 0 || wall_time <= 0)
+      return;
+    _steps.push_back({dt, wall_time, converged});
+    if (_steps.size() > _window)
+      _steps.pop_front();
+    fit();
+  }
+
+  void clear()
+  {
+    _steps.clear();
+    fit();
+  }
+
+  std::size_t numSteps() const { return _steps.size(); }
+
+  /// The modeled wall time of a converged step
+  Real wallTime(Real dt) const { return std::exp(_alpha) * std::pow(dt, _beta); }
+
+  /// The modeled probability that a step fails
+  Real failureProbability(Real dt) const
+  {
+    if (_dt_crit == std::numeric_limits<Real>::max())
+      return 0;
+    return 1 / (1 + std::pow(_dt_crit / dt, _steepness));
+  }
+
+  /// The expected simulated time per wall second of an attempt with this dt
+  Real rate(Real dt) const
+  {
+    const Real p = failureProbability(dt);
+    const Real t = wallTime(dt);
+    return ((1 - p) * dt + p * _cutback * dt) /
+           ((1 - p) * t + p * (_abort_fraction * t + wallTime(_cutback * dt)));
+  }
+
+  /**
+   * The dt in [min_factor, max_factor] * dt_last with the highest rate(), among n_candidates
+   * spaced geometrically; dt_last when nothing is on record yet
+   */
+  Real bestDT(Real dt_last, Real min_factor, Real max_factor, unsigned int n_candidates = 33) const
+  {
+    if (_steps.empty() || n_candidates < 2)
+      return dt_last;
+    const Real ratio = std::pow(max_factor / min_factor, 1. / (n_candidates - 1));
+    Real best_dt = dt_last, best_rate = rate(dt_last);
+    Real dt = dt_last * min_factor;
+    for (unsigned int i = 0; i < n_candidates; ++i, dt *= ratio)
+    {
+      const Real r = rate(dt);
+      if (r > best_rate)
+      {
+        best_rate = r;
+        best_dt = dt;
+      }
+    }
+    return best_dt;
+  }
+
+  ///@{ The fitted parameters
+  Real alpha() const { return _alpha; }
+  Real beta() const { return _beta; }
+  Real criticalDT() const { return _dt_crit; }
+  ///@}
+
+private:
+  struct Step
+  {
+    Real dt;
+    Real wall_time;
+    bool converged;
+  };
+
+  void fit()
+  {
+    // Wall time of the converged steps, in log-log
+    std::size_t n = 0;
+    Real sx = 0, sy = 0, sxx = 0, sxy = 0;
+    Real max_converged = 0, min_failed = std::numeric_limits<Real>::max();
+    for (const auto & step : _steps)
+      if (step.converged)
+      {
+        const Real x = std::log(step.dt), y = std::log(step.wall_time);
+        ++n;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+        max_converged = std::max(max_converged, step.dt);
+      }
+      else
+        min_failed = std::min(min_failed, step.dt);
+
+    _alpha = 0;
+    _beta = 0;
+    if (n)
+    {
+      const Real var = sxx - sx * sx / n;
+      // The cost grows with dt (more iterations), it never falls: clip beta to [0, 2]
+      if (var > 1e-6 * std::max(Real(1), sxx))
+        _beta = std::min(Real(2), std::max(Real(0), (sxy - sx * sy / n) / var));
+      _alpha = (sy - _beta * sx) / n;
+    }
+    else
+    {
+      for (const auto & step : _steps)
+        _alpha += std::log(step.wall_time / _abort_fraction);
+      if (!_steps.empty())
+        _alpha /= _steps.size();
+    }
+
+    if (min_failed == std::numeric_limits<Real>::max())
+      _dt_crit = std::numeric_limits<Real>::max();
+    else if (max_converged == 0 || max_converged >= min_failed)
+      _dt_crit = min_failed;
+    else
+      _dt_crit = std::sqrt(max_converged * min_failed);
+  }
+
+  const unsigned int _window;
+  const Real _cutback;
+  const Real _abort_fraction;
+  const Real _steepness;
+
+  /// The last steps, oldest first
+  std::deque<Step> _steps;
+
+  Real _alpha = 0;
+  Real _beta = 0;
+  Real _dt_crit = std::numeric_limits<Real>::max();
+};
@@ -11,6 +11,7 @@
 
 // MOOSE includes
 #include "MultiAppConservativeTransfer.h"
+#include "TransferInterpolationCache.h"
 #include "MooseVariableFieldBase.h"
 
 #include "libmesh/mesh_base.h"
@@ -84,4 +85,13 @@ protected:
   std::vector<SubdomainName> _exclude_gap_blocks;
   // How small we can consider two points are identical
   Real _distance_tol;
+
+  /**
+   * With _cache_mapping, the inverse distance weights of the target dofs of each local target
+   * app, so that later executions gather the source values instead of rebuilding the
+   * InverseDistanceInterpolation and searching for the nearest source points
+   */
+  std::vector<TransferInterpolationCache> _weight_caches;
+  /// The target dofs of the points of _weight_caches
+  std::vector<std::vector<dof_id_type>> _cached_target_dofs;
 };
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "MultiAppConservativeTransfer.h"
+#include "TransferInterpolationCache.h"
 
 // Forward declarations
 class MultiAppMeshFunctionTransfer;
@@ -49,4 +50,12 @@ private:
   std::vector<std::vector<Parallel::Request>> _send_evals;
   /// To send app ids to other processors
   std::vector<std::vector<Parallel::Request>> _send_ids;
+
+  /**
+   * With _cache_mapping, the shape function weights of the points each processor requested,
+   * indexed by variable and requesting processor; the sources are the local source apps
+   */
+  std::vector<std::vector<TransferInterpolationCache>> _eval_caches;
+  /// With _cache_mapping, the target dofs of the values returned by each processor, per variable
+  std::vector<std::vector<std::vector<dof_id_type>>> _cached_target_dofs;
 };
@@ -11,6 +11,7 @@
 
 // MOOSE includes
 #include "MultiAppConservativeTransfer.h"
+#include "KDTree.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -81,6 +82,44 @@ protected:
                         std::vector<std::pair<Point, DofObject *>> & local_entities,
                         bool nodal);
 
+  /**
+   * Builds a KDTree over the local source entities of each local source app, in the frame of the
+   * master app (shifted by the app position)
+   */
+  void buildLocalTrees(bool nodal, bool constant);
+
+  /**
+   * Finds the local source entity nearest to p with the trees, in every local source app
+   * @param p The point, in the frame of the master app
+   * @param distance The distance to the returned entity, unchanged if nothing closer is found
+   * @param i_from The local source app of the returned entity
+   * @return The index of the entity in _local_entities[i_from], or invalid_uint if none of the
+   *         local apps has an entity closer than distance
+   */
+  unsigned int nearestLocalEntity(const Point & p, Real & distance, unsigned int & i_from);
+
+  /**
+   * Posts the non-blocking sends of the target points to the processors whose source bounding
+   * boxes may hold their nearest entity, so that the local searches of execute() overlap with
+   * the communication; completed by finishPointExchange()
+   */
+  void startPointExchange(const std::vector<std::vector<Point>> & outgoing_points);
+
+  /// Waits for the point sends and the replies posted by startPointExchange()
+  void finishPointExchange();
+
+  /// The local source entities of each local source app, kept alive for the trees
+  std::vector<std::vector<std::pair<Point, DofObject *>>> _local_entities;
+  /// The points of _local_entities, which the trees reference
+  std::vector<std::vector<Point>> _local_points;
+  /// The search trees over _local_points, one per local source app
+  std::vector<std::unique_ptr<KDTree>> _local_trees;
+
+  ///@{ Pending non-blocking sends
+  std::vector<Parallel::Request> _send_points;
+  std::vector<Parallel::Request> _send_distances;
+  ///@}
+
   /// If true then node connections will be cached
   bool _fixed_meshes;
 
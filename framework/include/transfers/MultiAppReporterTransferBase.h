@@ -79,4 +79,13 @@ protected:
                             const ReporterName & to_reporter,
                             unsigned int subapp_index,
                             unsigned int time_index = 0);
+
+  /*
+   * Whether the latest values are shared rather than copied ("share_values"): the two apps of a
+   * transfer running on the same ranks, the receiving value becomes an alias of the sending one
+   * (see ReporterData::share()), which removes the copy of large values (e.g. sampler arrays) at
+   * every execution. The values with consumers holding plain references (getReporterValue()
+   * rather than getSharedReporterValue()) and the old values keep being copied.
+   */
+  const bool _share_values;
 };
@@ -15,10 +15,13 @@
 
 #include "libmesh/bounding_box.h"
 
+#include <memory>
+
 // Forward declarations
 class MultiAppTransfer;
 class MooseMesh;
 class MultiApp;
+class TransferOperator;
 
 template <>
 InputParameters validParams<MultiAppTransfer>();
@@ -39,6 +42,9 @@ public:
 
   MultiAppTransfer(const InputParameters & parameters);
 
+  /// Out of line, where TransferOperator is complete
+  virtual ~MultiAppTransfer();
+
   /**
    * Utility to verify that the variable in the destination system exists.
    */
@@ -50,6 +56,19 @@ public:
   /// Return the execution flags, handling "same_as_multiapp"
   virtual const std::vector<ExecFlagType> & execFlags() const;
 
+  ///@{
+  /**
+   * The variables and postprocessors of the receiving problem that this transfer writes and that
+   * belong to the fixed-point vector accelerated by PicardSolve ("aitken" or "anderson"
+   * acceleration)
+   */
+  const std::vector<VariableName> & fixedPointVariables() const { return _fixed_point_variables; }
+  const std::vector<PostprocessorName> & fixedPointPostprocessors() const
+  {
+    return _fixed_point_postprocessors;
+  }
+  ///@}
+
 protected:
   /// The MultiApp this Transfer is transferring data to or from
   std::shared_ptr<MultiApp> _multi_app;
@@ -74,6 +93,45 @@ protected:
   /// True if displaced mesh is used for the target mesh, otherwise false
   bool _displaced_target_mesh;
 
+  /**
+   * Whether the point locations and interpolation weights are kept from one execution to the
+   * next while the meshes do not change (never with displaced meshes, which move without
+   * changing)
+   */
+  const bool _cache_mapping;
+
+  /**
+   * Whether, with _cache_mapping, the first execution records the transfer of each variable as a
+   * TransferOperator so that later executions are a single parallel matrix-vector product
+   */
+  const bool _cache_operator;
+
+  /// The recorded operators, indexed by transferred variable; null until recorded
+  std::vector<std::unique_ptr<TransferOperator>> _transfer_operators;
+
+  /// The meshStamp() the operators were recorded for
+  std::vector<unsigned int> _transfer_operators_stamp;
+
+  /**
+   * Drops the recorded operators when the meshes changed since they were recorded
+   * @return Whether the operators are still valid
+   */
+  bool checkTransferOperators();
+
+  /**
+   * Applies the recorded operator of variable \p i: packs the local dofs of the variable in the
+   * source apps, multiplies and unpacks into the solutions of the target apps
+   */
+  void applyTransferOperator(unsigned int i,
+                             const VariableName & from_var,
+                             const VariableName & to_var);
+
+  /**
+   * Identifies the state of the local source and target meshes: the number of changes of each
+   * and the positions of the apps. A cache recorded for a different stamp is stale.
+   */
+  std::vector<unsigned int> meshStamp() const;
+
   ///@{
   /**
    * Return the bounding boxes of all the "from" domains, including all the domains not local to
@@ -118,4 +176,21 @@ protected:
   void checkVariable(const FEProblemBase & fe_problem,
                      const VariableName & var_name,
                      const std::string & param_name = "") const;
+
+  ///@{
+  /// Declares a quantity written by this transfer as part of the fixed-point vector, which
+  /// transfers typically do for the variables or postprocessors they transfer into
+  void declareFixedPointVariable(const VariableName & var_name)
+  {
+    _fixed_point_variables.push_back(var_name);
+  }
+  void declareFixedPointPostprocessor(const PostprocessorName & pp_name)
+  {
+    _fixed_point_postprocessors.push_back(pp_name);
+  }
+  ///@}
+
+private:
+  std::vector<VariableName> _fixed_point_variables;
+  std::vector<PostprocessorName> _fixed_point_postprocessors;
 };
@@ -0,0 +1,141 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/numeric_vector.h"
+
+#include <vector>
+
+/**
+ * Interpolation weights recorded by a transfer, reused while the meshes do not change.
+ *
+ * The value a transfer computes at a target point is a linear combination of source dofs: the
+ * shape functions of the source element containing the point for a mesh function evaluation, the
+ * inverse distance weights of the nearest source nodes for an interpolation. The first execution
+ * records these combinations (after the point location and the searches); later executions
+ * only gather the source values, without searching again.
+ *
+ * The combinations are stored in compressed rows: point p uses the dofs and weights in
+ * [offsets[p], offsets[p + 1]) of the source vector sources[p].
+ */
+class TransferInterpolationCache
+{
+public:
+  /**
+   * Whether the cache was recorded for the given state of the meshes
+   * @param stamp Identifies the state of the meshes, see MultiAppTransfer::meshStamp()
+   */
+  bool valid(const std::vector<unsigned int> & stamp) const { return _recorded && stamp == _stamp; }
+
+  /// Drops the recorded weights and starts recording for the given state of the meshes
+  void beginRecording(const std::vector<unsigned int> & stamp)
+  {
+    _stamp = stamp;
+    _offsets.assign(1, 0);
+    _sources.clear();
+    _dofs.clear();
+    _weights.clear();
+    _recorded = false;
+  }
+
+  /**
+   * Starts the combination of the next point
+   * @param source The index of the source vector (e.g. the local source app) the point uses,
+   *               invalid_uint for a point no source contains
+   */
+  void addPoint(unsigned int source)
+  {
+    _offsets.push_back(_dofs.size());
+    _sources.push_back(source);
+  }
+
+  /// Adds a source dof to the combination of the last point
+  void addWeight(dof_id_type dof, Real weight)
+  {
+    mooseAssert(!_sources.empty(), "addPoint() must be called first");
+    _dofs.push_back(dof);
+    _weights.push_back(weight);
+    ++_offsets.back();
+  }
+
+  /// Marks the recording as complete
+  void endRecording() { _recorded = true; }
+
+  /// The number of points recorded
+  std::size_t numPoints() const { return _sources.size(); }
+
+  /// The source vector of each point, invalid_uint where the point was not found
+  const std::vector<unsigned int> & sources() const { return _sources; }
+
+  /**
+   * Evaluates the recorded combinations
+   * @param sources The source vectors, holding (locally or as ghosts) every recorded dof
+   * @param values The values at the points
+   * @param missed_value The value of the points no source contains
+   */
+  void evaluate(const std::vector<const NumericVector<Number> *> & sources,
+                std::vector<Real> & values,
+                Real missed_value) const
+  {
+    combine([&sources](unsigned int s, dof_id_type dof) { return (*sources[s])(dof); },
+            values,
+            missed_value);
+  }
+
+  /**
+   * Evaluates the recorded combinations of entries of gathered arrays (e.g. the values at all the
+   * source points of an interpolation), where the recorded dofs are indices into the arrays
+   */
+  void evaluate(const std::vector<std::vector<Real>> & sources,
+                std::vector<Real> & values,
+                Real missed_value) const
+  {
+    combine([&sources](unsigned int s, dof_id_type i) { return sources[s][i]; },
+            values,
+            missed_value);
+  }
+
+  ///@{ The compressed rows, for building an operator from the weights
+  const std::vector<std::size_t> & offsets() const { return _offsets; }
+  const std::vector<dof_id_type> & dofs() const { return _dofs; }
+  const std::vector<Real> & weights() const { return _weights; }
+  ///@}
+
+private:
+  template <typename SourceValue>
+  void combine(SourceValue && source_value, std::vector<Real> & values, Real missed_value) const
+  {
+    mooseAssert(_recorded, "The cache was not recorded");
+    values.resize(_sources.size());
+    for (std::size_t p = 0; p < _sources.size(); ++p)
+    {
+      if (_sources[p] == libMesh::invalid_uint)
+      {
+        values[p] = missed_value;
+        continue;
+      }
+      Real value = 0;
+      for (auto k = _offsets[p]; k < _offsets[p + 1]; ++k)
+        value += _weights[k] * source_value(_sources[p], _dofs[k]);
+      values[p] = value;
+    }
+  }
+
+  bool _recorded = false;
+  std::vector<unsigned int> _stamp;
+
+  std::vector<std::size_t> _offsets = {0};
+  std::vector<unsigned int> _sources;
+  std::vector<dof_id_type> _dofs;
+  std::vector<Real> _weights;
+};
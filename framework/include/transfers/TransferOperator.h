@@ -0,0 +1,126 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_HAVE_PETSC
+
+#include "libmesh/parallel.h"
+#include "libmesh/petsc_matrix.h"
+#include "libmesh/petsc_vector.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * A field transfer recorded as a distributed sparse matrix from the source dofs to the target
+ * dofs, so that executing it again is a single parallel matrix-vector product.
+ *
+ * The matrix lives on the communicator of the transfer. Its columns number the local source dofs
+ * of all the source apps of each processor one after the other (colBegin() + local index), its
+ * rows the local target dofs the same way (rowBegin() + local index); the source and target
+ * vectors of the product are then filled and read with local copies only. Entries may be added
+ * by any processor, e.g. the one that located a target point in its source mesh: PETSc sends
+ * them to the owner of the row during assembly.
+ */
+class TransferOperator
+{
+public:
+  /**
+   * @param comm The communicator of the transfer
+   * @param n_local_rows The number of target dofs of this processor
+   * @param n_local_cols The number of source dofs of this processor
+   * @param n_nonzero_per_row An estimate of the number of source dofs per target dof
+   */
+  TransferOperator(const libMesh::Parallel::Communicator & comm,
+                   numeric_index_type n_local_rows,
+                   numeric_index_type n_local_cols,
+                   numeric_index_type n_nonzero_per_row)
+    : _matrix(comm), _source(comm), _target(comm)
+  {
+    std::vector<numeric_index_type> local_rows, local_cols;
+    comm.allgather(n_local_rows, local_rows);
+    comm.allgather(n_local_cols, local_cols);
+
+    numeric_index_type n_rows = 0, n_cols = 0;
+    for (processor_id_type pid = 0; pid < comm.size(); ++pid)
+    {
+      if (pid == comm.rank())
+      {
+        _row_begin = n_rows;
+        _col_begin = n_cols;
+      }
+      n_rows += local_rows[pid];
+      n_cols += local_cols[pid];
+    }
+
+    _matrix.init(n_rows, n_cols, n_local_rows, n_local_cols, n_nonzero_per_row, n_nonzero_per_row);
+    _source.init(n_cols, n_local_cols, false, PARALLEL);
+    _target.init(n_rows, n_local_rows, false, PARALLEL);
+  }
+
+  ///@{ The first row (target dof) and column (source dof) of this processor
+  numeric_index_type rowBegin() const { return _row_begin; }
+  numeric_index_type colBegin() const { return _col_begin; }
+  ///@}
+
+  /// Adds a weight to the operator, before assemble()
+  void add(numeric_index_type row, numeric_index_type col, Real weight)
+  {
+    mooseAssert(!_assembled, "The operator is already assembled");
+    _matrix.add(row, col, weight);
+  }
+
+  /// Completes the operator, on all the processors
+  void assemble()
+  {
+    _matrix.close();
+    _assembled = true;
+  }
+
+  bool assembled() const { return _assembled; }
+
+  /**
+   * Applies the operator
+   * @param source The local source dofs, in column order
+   * @param target The local target dofs, in row order
+   */
+  void apply(const std::vector<Number> & source, std::vector<Number> & target)
+  {
+    mooseAssert(_assembled, "The operator must be assembled before it is applied");
+    mooseAssert(source.size() == _source.local_size(), "Wrong number of source dofs");
+
+    for (numeric_index_type i = 0; i < source.size(); ++i)
+      _source.set(_col_begin + i, source[i]);
+    _source.close();
+
+    _matrix.vector_mult(_target, _source);
+
+    target.resize(_target.local_size());
+    for (numeric_index_type i = 0; i < target.size(); ++i)
+      target[i] = _target(_row_begin + i);
+  }
+
+private:
+  PetscMatrix<Number> _matrix;
+  PetscVector<Number> _source;
+  PetscVector<Number> _target;
+
+  numeric_index_type _row_begin;
+  numeric_index_type _col_begin;
+
+  bool _assembled = false;
+};
+
+#endif
@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Repartitions the mesh during a transient when the measured element costs have drifted out of
+ * balance.
+ *
+ * On every execution the latest element timings are folded into the problem's
+ * ElementLoopCostModel and the imbalance of the current partitioning is evaluated with the
+ * mesh's CostWeightedPartitioner. If it exceeds the threshold (and enough steps have passed since
+ * the last rebalance), the mesh is repartitioned and FEProblemBase::meshChanged() is called to
+ * redistribute the solution and stateful data.
+ */
+class CostImbalanceRebalancer : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  CostImbalanceRebalancer(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Imbalance (max / mean processor cost) above which the mesh is repartitioned
+  const Real _threshold;
+
+  /// Minimum number of time steps between two rebalances
+  const unsigned int _min_interval;
+
+  /// Time step at which the mesh was last rebalanced
+  int _last_rebalance_step;
+};
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "GeneralUserObject.h"
+#include "GhostingReport.h"
 
 #include "libmesh/ghosting_functor.h"
 
@@ -47,6 +48,15 @@ public:
                          Moose::RelationshipManagerType rm_type,
                          processor_id_type pid) const;
 
+  /**
+   * The elements ghosted on this processor for each object requesting RelationshipManagers,
+   * rebuilt with the maps (and printed if "report" is set)
+   */
+  const GhostingReport & ghostingReport() const { return _report; }
+
+  /// The estimated memory of a ghosted element, for the report
+  std::size_t bytesPerGhostedElem() const;
+
 private:
   /// The PID to show the ghosting for
   std::vector<processor_id_type> _pids;
@@ -57,6 +67,18 @@ private:
   /// Dimension three: Elem Ptr -> Coupling Matrix
   std::vector<std::unordered_map<processor_id_type, libMesh::GhostingFunctor::map_type>> _maps;
 
+  /**
+   * Queries every RelationshipManager of the application on the local elements and records the
+   * non-local elements it ghosts for its objects in _report
+   */
+  void buildGhostingReport();
+
+  /// Whether to print the report after every mesh change
+  const bool _print_report;
+
+  /// The ghosting of this processor, per object
+  GhostingReport _report;
+
   MooseMesh & _mesh;
   NonlinearSystemBase & _nl;
 };
@@ -14,6 +14,7 @@
 #include "MooseEnum.h"
 #include "MooseTypes.h"
 #include "Restartable.h"
+#include "ElementIndexCache.h"
 
 // Forward Declarations
 class InputParameters;
@@ -23,6 +24,7 @@ class UserObject;
 
 namespace libMesh
 {
+class Elem;
 class Point;
 }
 
@@ -65,6 +67,15 @@ public:
    */
   virtual unsigned int getLayer(Point p) const;
 
+  /**
+   * The layer of the centroid of an element. On a mesh that does not move, the layers of the
+   * elements are kept across executions in a map shared by all the layered objects on the same
+   * mesh with the same direction and bounds.
+   * @param elem The element
+   * @return The layer the element's centroid is found in
+   */
+  unsigned int getElemLayer(const Elem * elem) const;
+
   virtual void initialize();
   virtual void finalize();
   virtual void threadJoin(const UserObject & y);
@@ -87,6 +98,12 @@ protected:
    */
   void getBounds();
 
+  /**
+   * Forgets the element layers, for the meshChanged() of the derived classes (the bounds may
+   * change with the mesh, so the shared map is looked up again on the next getElemLayer())
+   */
+  void clearElemLayers();
+
   /// Name of this object
   std::string _layered_base_name;
 
@@ -135,4 +152,7 @@ private:
 
   /// List of SubdomainIDs, if given
   std::vector<SubdomainID> _layer_bounding_blocks;
+
+  /// The element layers shared with the objects of the same mesh and layers (null when displaced)
+  mutable std::shared_ptr<ElementIndexCache> _elem_layers;
 };
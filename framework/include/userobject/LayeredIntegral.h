@@ -41,4 +41,5 @@ public:
   virtual void execute() override;
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
+  virtual void meshChanged() override { clearElemLayers(); }
 };
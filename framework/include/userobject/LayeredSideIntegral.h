@@ -42,5 +42,6 @@ public:
   virtual void execute() override;
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
+  virtual void meshChanged() override { clearElemLayers(); }
 };
 
@@ -12,6 +12,7 @@
 // MOOSE includes
 #include "ElementIntegralVariableUserObject.h"
 #include "Enumerate.h"
+#include "ElementIndexCache.h"
 
 // Forward Declarations
 class UserObject;
@@ -64,6 +65,7 @@ public:
   virtual void execute() override;
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
+  virtual void meshChanged() override;
 
   /**
    * Given a Point return the integral value associated with the layer
@@ -89,9 +91,19 @@ protected:
    */
   std::shared_ptr<UserObjectType> nearestUserObject(const Point & p) const;
 
+  /// The index of the point closest to p
+  unsigned int nearestPointIndex(const Point & p) const;
+
   std::vector<Point> _points;
   std::vector<std::shared_ptr<UserObjectType>> _user_objects;
 
+  /**
+   * The nearest point of the elements, shared by the objects with the same mesh and points, so the
+   * search over the points is done once per element while the mesh does not change (null on a
+   * displaced mesh, where the nearest point may change every execution)
+   */
+  std::shared_ptr<ElementIndexCache> _nearest_point_cache;
+
   // The list of InputParameter objects. This is a list because these cannot be copied (or moved).
   std::list<InputParameters> _sub_params;
 
@@ -120,6 +132,16 @@ NearestPointBase<UserObjectType, BaseType>::NearestPointBase(const InputParamete
     _sub_params.push_back(sub_params);
     _user_objects.emplace_back(std::make_shared<UserObjectType>(_sub_params.back()));
   }
+
+  if (!this->template getParam<bool>("use_displaced_mesh"))
+  {
+    // The points, preceded by their number so that different point sets cannot share a key
+    std::vector<Real> key = {Real(_points.size())};
+    for (const auto & point : _points)
+      for (unsigned int j = 0; j < LIBMESH_DIM; ++j)
+        key.push_back(point(j));
+    _nearest_point_cache = ElementIndexCache::get(this->_mesh, key);
+  }
 }
 
 template <typename UserObjectType, typename BaseType>
@@ -190,7 +212,14 @@ template <typename UserObjectType, typename BaseType>
 void
 NearestPointBase<UserObjectType, BaseType>::execute()
 {
-  nearestUserObject(_current_elem->centroid())->execute();
+  if (_nearest_point_cache)
+  {
+    const auto closest = _nearest_point_cache->index(
+        _current_elem->id(), [this]() { return nearestPointIndex(_current_elem->centroid()); });
+    _user_objects[closest]->execute();
+  }
+  else
+    nearestUserObject(_current_elem->centroid())->execute();
 }
 
 template <typename UserObjectType, typename BaseType>
@@ -211,6 +240,18 @@ NearestPointBase<UserObjectType, BaseType>::threadJoin(const UserObject & y)
     _user_objects[i]->threadJoin(*npla._user_objects[i]);
 }
 
+template <typename UserObjectType, typename BaseType>
+void
+NearestPointBase<UserObjectType, BaseType>::meshChanged()
+{
+  if (_nearest_point_cache)
+    _nearest_point_cache->clear();
+
+  // The sub-objects are not known to the problem, so they are told here
+  for (auto & user_object : _user_objects)
+    user_object->meshChanged();
+}
+
 template <typename UserObjectType, typename BaseType>
 Real
 NearestPointBase<UserObjectType, BaseType>::spatialValue(const Point & p) const
@@ -221,6 +262,13 @@ NearestPointBase<UserObjectType, BaseType>::spatialValue(const Point & p) const
 template <typename UserObjectType, typename BaseType>
 std::shared_ptr<UserObjectType>
 NearestPointBase<UserObjectType, BaseType>::nearestUserObject(const Point & p) const
+{
+  return _user_objects[nearestPointIndex(p)];
+}
+
+template <typename UserObjectType, typename BaseType>
+unsigned int
+NearestPointBase<UserObjectType, BaseType>::nearestPointIndex(const Point & p) const
 {
   unsigned int closest = 0;
   Real closest_distance = std::numeric_limits<Real>::max();
@@ -238,5 +286,5 @@ NearestPointBase<UserObjectType, BaseType>::nearestUserObject(const Point & p) c
     }
   }
 
-  return _user_objects[closest];
+  return closest;
 }
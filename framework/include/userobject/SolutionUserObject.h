@@ -11,6 +11,9 @@
 
 // MOOSE includes
 #include "GeneralUserObject.h"
+#include "PointLocationCache.h"
+
+#include <future>
 
 // Forward declarations
 namespace libMesh
@@ -98,6 +101,25 @@ public:
                   const std::string & var_name,
                   const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
 
+  /**
+   * Returns the values at many locations of a variable (see SolutionFunction::values): the
+   * points are transformed and located once each, through the point location cache, and the
+   * variable is evaluated on their elements
+   * @param t The time at which to extract (not used, it is handled automatically when reading the
+   * data)
+   * @param n The number of locations
+   * @param p The locations at which to return a value
+   * @param local_var_index The local index of the variable to be evaluated
+   * @param values The values at the locations
+   * @param subdomain_ids Subdomains IDs where to look for the value, if nullptr look everywhere
+   */
+  void pointValues(Real t,
+                   std::size_t n,
+                   const Point * p,
+                   const unsigned int local_var_index,
+                   Real * values,
+                   const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
+
   /**
    * Returns a value at a specific location and variable for cases where the solution is
    * multivalued at element faces
@@ -312,6 +334,20 @@ protected:
    */
   bool updateExodusBracketingTimeIndices(Real time);
 
+  /**
+   * Starts reading the solution of the ExodusII time index that follows the bracketing indices in
+   * a background thread, into _es_next, so the next updateExodusTimeInterpolation that moves the
+   * bracket swaps it in instead of reading the file
+   */
+  void prefetchNextExodusStep();
+
+  /**
+   * The element of the solution mesh containing a (transformed) point, from the location cache
+   * when the target mesh is static
+   */
+  const Elem * locatePoint(const Point & p,
+                           const std::set<subdomain_id_type> * subdomain_ids) const;
+
   /**
    * A wrapper method for calling the various MeshFunctions used for reading the data
    * @param p The location at which data is desired
@@ -477,6 +513,22 @@ protected:
   /// True if initial_setup has executed
   bool _initialized;
 
+  /// Whether the query points stay the same (the target mesh does not move or adapt)
+  const bool _cache_point_locations;
+
+  /// The solution elements of the query points, if _cache_point_locations
+  mutable PointLocationCache _point_locations;
+
+  /// Whether the next ExodusII time step is read ahead in a background thread
+  const bool _prefetch_exodus_steps;
+
+  /// The prefetched solution and its time index (-1 if none)
+  std::unique_ptr<EquationSystems> _es_next;
+  int _exodus_index_next;
+
+  /// The background read of _es_next
+  std::future<void> _prefetch;
+
 private:
   static Threads::spin_mutex _solution_user_object_mutex;
 };
@@ -0,0 +1,87 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "DualReal.h"
+#include "MooseError.h"
+
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * DualNumber with a derivative container sized for N entries. Code that is templated on the
+ * derivative size can use this together with Moose::dispatchADDerivativeSize() to carry only as
+ * many derivative entries as the problem actually needs, instead of the configure-time
+ * MOOSE_AD_MAX_DOFS_PER_ELEM used by ADReal.
+ */
+template <std::size_t N>
+using DualRealSize = DualNumber<Real, DNDerivativeSize<N>, /*allow_skiping_derivatives=*/true>;
+
+namespace Moose
+{
+/// The derivative sizes for which sized AD code is instantiated, in increasing order
+constexpr std::size_t ad_derivative_sizes[] = {16, 32, 64, 256};
+
+/**
+ * The smallest instantiated derivative size that can hold n entries. Sizes are capped by
+ * MOOSE_AD_MAX_DOFS_PER_ELEM, which is always available as the last resort.
+ *
+ * @return The selected size, or 0 if n exceeds MOOSE_AD_MAX_DOFS_PER_ELEM
+ */
+constexpr std::size_t
+selectADDerivativeSize(std::size_t n)
+{
+  if (n > MOOSE_AD_MAX_DOFS_PER_ELEM)
+    return 0;
+
+  for (const auto size : ad_derivative_sizes)
+    if (n <= size && size < MOOSE_AD_MAX_DOFS_PER_ELEM)
+      return size;
+
+  return MOOSE_AD_MAX_DOFS_PER_ELEM;
+}
+
+/**
+ * Call f with a std::integral_constant holding the derivative size selected for n derivative
+ * entries (see selectADDerivativeSize()), e.g.
+ *
+ *   Moose::dispatchADDerivativeSize(n_dofs, [&](auto size) {
+ *     constexpr std::size_t N = decltype(size)::value;
+ *     computeSized<N>();
+ *   });
+ *
+ * This is meant to be called once per problem (e.g. from the maximum number of dofs of any
+ * variable on any element, see SystemBase::getMaxVarNDofsPerElem()) rather than in hot loops.
+ */
+template <typename F>
+auto
+dispatchADDerivativeSize(std::size_t n, F && f)
+    -> decltype(f(std::integral_constant<std::size_t, MOOSE_AD_MAX_DOFS_PER_ELEM>()))
+{
+  // An if chain rather than a switch since MOOSE_AD_MAX_DOFS_PER_ELEM may equal one of the tiers
+  const auto size = selectADDerivativeSize(n);
+  if (size == 16)
+    return f(std::integral_constant<std::size_t, 16>());
+  if (size == 32)
+    return f(std::integral_constant<std::size_t, 32>());
+  if (size == 64)
+    return f(std::integral_constant<std::size_t, 64>());
+  if (size == 256)
+    return f(std::integral_constant<std::size_t, 256>());
+  if (size == MOOSE_AD_MAX_DOFS_PER_ELEM)
+    return f(std::integral_constant<std::size_t, MOOSE_AD_MAX_DOFS_PER_ELEM>());
+
+  mooseError("The required number of AD derivative entries (",
+             n,
+             ") exceeds the maximum (",
+             MOOSE_AD_MAX_DOFS_PER_ELEM,
+             "). Reconfigure MOOSE with a larger --with-derivative-size.");
+}
+}
@@ -0,0 +1,118 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+
+#include "libmesh/libmesh_common.h"
+
+#ifdef LIBMESH_HAVE_PETSC
+
+#include "libmesh/petsc_vector.h"
+
+#include <petscmat.h>
+
+#include <functional>
+
+/**
+ * Matrix-free Jacobian for Newton-Krylov solves: a PETSc shell matrix whose product with a vector
+ * v is computed exactly by automatic differentiation instead of by finite differencing the
+ * residual.
+ *
+ * The product J(u) v is the directional derivative of the residual R at u in the direction v. It
+ * is obtained from a single residual evaluation in which the derivative of every dof i is seeded
+ * with v_i at the same, single derivative index (see SystemBase::setADDirection()): every ADReal
+ * then carries one derivative entry, whatever the number of dofs on an element, and the derivative
+ * of residual entry i is (J v)_i. Neither the full derivative arrays nor the matrix are ever
+ * formed.
+ *
+ * The shell only provides the operator; the preconditioning matrix is assembled separately, e.g.
+ * lagged across Newton iterations (-snes_lag_preconditioner) or from a physics-based
+ * preconditioner, exactly as with PJFNK.
+ */
+class ADJacobianVectorProduct
+{
+public:
+  /**
+   * Computes Jv = J(u) v
+   * @param u The state the Jacobian is evaluated at
+   * @param v The direction
+   * @param Jv The product
+   */
+  typedef std::function<void(const NumericVector<Number> & u,
+                             const NumericVector<Number> & v,
+                             NumericVector<Number> & Jv)>
+      ApplyFunction;
+
+  /**
+   * @param comm The communicator of the system
+   * @param n_local The number of local dofs
+   * @param n_global The number of dofs
+   * @param apply The product, see ApplyFunction
+   */
+  ADJacobianVectorProduct(const libMesh::Parallel::Communicator & comm,
+                          numeric_index_type n_local,
+                          numeric_index_type n_global,
+                          ApplyFunction apply)
+    : _comm(comm), _apply(std::move(apply))
+  {
+    PetscErrorCode ierr =
+        MatCreateShell(comm.get(), n_local, n_local, n_global, n_global, this, &_mat);
+    LIBMESH_CHKERR(ierr);
+    ierr = MatShellSetOperation(_mat, MATOP_MULT, (void (*)(void))mult);
+    LIBMESH_CHKERR(ierr);
+  }
+
+  ~ADJacobianVectorProduct() { MatDestroy(&_mat); }
+
+  ADJacobianVectorProduct(const ADJacobianVectorProduct &) = delete;
+  ADJacobianVectorProduct & operator=(const ADJacobianVectorProduct &) = delete;
+
+  /// The shell matrix, to be passed as the Jacobian (Amat) to SNESSetJacobian()
+  Mat mat() const { return _mat; }
+
+  /**
+   * Sets the state the Jacobian is evaluated at, from the SNES Jacobian callback: the state is
+   * only referenced and must stay alive until the next call
+   */
+  void setState(Vec u)
+  {
+    _state = u;
+    // Lets the Krylov solver know that the operator changed
+    PetscErrorCode ierr = MatAssemblyBegin(_mat, MAT_FINAL_ASSEMBLY);
+    LIBMESH_CHKERR(ierr);
+    ierr = MatAssemblyEnd(_mat, MAT_FINAL_ASSEMBLY);
+    LIBMESH_CHKERR(ierr);
+  }
+
+private:
+  static PetscErrorCode mult(Mat mat, Vec x, Vec y)
+  {
+    void * ctx;
+    PetscErrorCode ierr = MatShellGetContext(mat, &ctx);
+    CHKERRQ(ierr);
+    auto & product = *static_cast<ADJacobianVectorProduct *>(ctx);
+    if (!product._state)
+      mooseError("ADJacobianVectorProduct: the state must be set before computing products");
+
+    PetscVector<Number> u(product._state, product._comm);
+    PetscVector<Number> v(x, product._comm);
+    PetscVector<Number> Jv(y, product._comm);
+    product._apply(u, v, Jv);
+    return 0;
+  }
+
+  const libMesh::Parallel::Communicator & _comm;
+  const ApplyFunction _apply;
+  Mat _mat = nullptr;
+  Vec _state = nullptr;
+};
+
+#endif
@@ -0,0 +1,137 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * Runs tasks in order on a single background thread, e.g. to write a snapshot of the solution
+ * to disk while the next time step is solved.
+ *
+ * At most max_pending tasks are queued or running; push() blocks until there is room, so with
+ * the default of two the queue acts as a double buffer: one snapshot being written while the
+ * next one is staged. An exception thrown by a task is rethrown by the next call to push()
+ * or wait() on the calling thread.
+ *
+ * Tasks run concurrently with the calling thread and must therefore only touch the data they
+ * own: in particular, they must not communicate with MPI or access the EquationSystems.
+ */
+class AsyncTaskQueue
+{
+public:
+  AsyncTaskQueue(unsigned int max_pending = 2)
+    : _max_pending(max_pending ? max_pending : 1), _thread([this] { run(); })
+  {
+  }
+
+  /// Finishes all the pending tasks
+  ~AsyncTaskQueue()
+  {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _task_available.notify_one();
+    _thread.join();
+  }
+
+  AsyncTaskQueue(const AsyncTaskQueue &) = delete;
+  AsyncTaskQueue & operator=(const AsyncTaskQueue &) = delete;
+
+  /// Queues a task, waiting for room if max_pending tasks are already pending
+  void push(std::function<void()> task)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _room_available.wait(lock, [this] { return _pending < _max_pending; });
+    rethrow(lock);
+
+    _tasks.push_back(std::move(task));
+    ++_pending;
+    lock.unlock();
+    _task_available.notify_one();
+  }
+
+  /// Waits for all the pending tasks to finish
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _room_available.wait(lock, [this] { return _pending == 0; });
+    rethrow(lock);
+  }
+
+  /// The number of tasks that are queued or running
+  unsigned int pending() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pending;
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+      _task_available.wait(lock, [this] { return _stop || !_tasks.empty(); });
+      if (_tasks.empty())
+        return;
+
+      auto task = std::move(_tasks.front());
+      _tasks.pop_front();
+
+      lock.unlock();
+      std::exception_ptr error;
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      lock.lock();
+
+      if (error && !_error)
+        _error = error;
+      --_pending;
+      _room_available.notify_all();
+    }
+  }
+
+  /// Rethrows the first exception of a task, if any
+  void rethrow(std::unique_lock<std::mutex> & lock)
+  {
+    if (_error)
+    {
+      auto error = _error;
+      _error = nullptr;
+      lock.unlock();
+      std::rethrow_exception(error);
+    }
+  }
+
+  const unsigned int _max_pending;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _task_available;
+  std::condition_variable _room_available;
+  std::deque<std::function<void()>> _tasks;
+  unsigned int _pending = 0;
+  bool _stop = false;
+  std::exception_ptr _error;
+
+  /// Declared last so that it starts once everything else is constructed
+  std::thread _thread;
+};
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "MooseTypes.h"
+#include "IntervalLocator.h"
 
 /**
  * This class interpolates tabulated data with a bicubic function. In order to
@@ -52,6 +53,30 @@ public:
    */
   void sampleValueAndDerivatives(Real x1, Real x2, Real & y, Real & dy1, Real & dy2);
 
+  /**
+   * sampleValueAndDerivatives() with the intervals located from hints, the intervals of the
+   * previous lookup of the caller in each direction (see IntervalLocator), for the per-qp
+   * lookups of the tabulated fluid properties
+   */
+  void sampleValueAndDerivatives(Real x1,
+                                 Real x2,
+                                 Real & y,
+                                 Real & dy1,
+                                 Real & dy2,
+                                 unsigned int & hint1,
+                                 unsigned int & hint2);
+
+  /**
+   * Samples the values at n points at once, the intervals of each point being the hints of the
+   * next
+   */
+  void sample(std::size_t n,
+              const Real * x1,
+              const Real * x2,
+              Real * y,
+              unsigned int & hint1,
+              unsigned int & hint2);
+
   /**
    * Samples first derivative at point (x1, x2)
    */
@@ -85,6 +110,10 @@ protected:
                         std::vector<std::vector<Real>> & dy_dx2,
                         std::vector<std::vector<Real>> & d2y_dx1x2);
 
+  /// Locates the intervals of the hinted samples in each direction
+  IntervalLocator _x1_locator;
+  IntervalLocator _x2_locator;
+
   /// Independent values in the x1 direction
   std::vector<Real> _x1;
   /// Independent values in the x2 direction
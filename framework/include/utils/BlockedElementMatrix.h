@@ -0,0 +1,90 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * An element Jacobian of several variables rearranged for a block (BAIJ/SBAIJ) matrix, i.e. for
+ * MatSetValuesBlocked(): the local Jacobians of the variable pairs (ivar, jvar), which Assembly
+ * stores variable by variable, are interleaved so that the rows and columns of each node are
+ * contiguous, and the element is inserted as one block row of blocks per node.
+ *
+ * This requires the variables to share their FE type and subdomains, so that every variable has
+ * the same number of dofs on the element and the dofs of the variables at each node are
+ * consecutive, the variable index being the position within the block: libMesh numbers the
+ * variables of a variable group this way. setDofs() checks it.
+ */
+class BlockedElementMatrix
+{
+public:
+  /**
+   * Sets the dof indices of the element, per variable, and zeroes the matrix.
+   * @param var_dofs The dof indices of each variable (block_size variables, same count each)
+   * @return false if the dofs are not interleaved by block, in which case the element has to be
+   *         inserted entry by entry
+   */
+  bool setDofs(const std::vector<std::vector<dof_id_type>> & var_dofs)
+  {
+    _block_size = var_dofs.size();
+    _n = _block_size ? var_dofs[0].size() : 0;
+    _blocks.resize(_n);
+    for (unsigned int a = 0; a < _n; ++a)
+    {
+      for (unsigned int v = 0; v < _block_size; ++v)
+      {
+        if (var_dofs[v].size() != _n)
+          return false;
+        const auto dof = var_dofs[v][a];
+        if (dof % _block_size != v || (v > 0 && dof != var_dofs[0][a] + v))
+          return false;
+      }
+      _blocks[a] = var_dofs[0][a] / _block_size;
+    }
+    _values.assign(std::size_t(_n) * _block_size * _n * _block_size, 0);
+    return true;
+  }
+
+  /**
+   * Adds the local Jacobian of a variable pair
+   * @param ivar, jvar The positions of the variables within the block
+   * @param ke The n x n local Jacobian, in the element dof order of the variables
+   */
+  template <typename Matrix>
+  void add(unsigned int ivar, unsigned int jvar, const Matrix & ke)
+  {
+    mooseAssert(ivar < _block_size && jvar < _block_size, "Variable out of the block");
+    const std::size_t row_size = std::size_t(_n) * _block_size;
+    for (unsigned int a = 0; a < _n; ++a)
+    {
+      Real * row = &_values[(std::size_t(a) * _block_size + ivar) * row_size + jvar];
+      for (unsigned int b = 0; b < _n; ++b)
+        row[std::size_t(b) * _block_size] += ke(a, b);
+    }
+  }
+
+  /// The block (node) indices of the element, for the rows and the columns
+  const std::vector<dof_id_type> & blockIndices() const { return _blocks; }
+
+  /// The values, row-major, the rows and columns of each block being contiguous
+  const std::vector<Real> & values() const { return _values; }
+
+  unsigned int blockSize() const { return _block_size; }
+
+private:
+  unsigned int _block_size = 0;
+  unsigned int _n = 0;
+  std::vector<dof_id_type> _blocks;
+  std::vector<Real> _values;
+};
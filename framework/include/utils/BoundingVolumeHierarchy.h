@@ -0,0 +1,318 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/bounding_box.h"
+#include "libmesh/point.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/**
+ * An axis-aligned bounding box tree over a set of items (e.g. the faces of a contact surface),
+ * for the searches that a fixed-size patch of nearest neighbors cannot bound: the items within a
+ * distance of a point, and the item nearest to a point.
+ *
+ * The tree is built once (top-down, median split of the box centroids along the widest axis)
+ * and refit when the items move: the boxes are recomputed bottom-up on the same topology, which
+ * costs O(n) instead of the O(n log n) of a build. Large motions degrade a refit tree (its boxes
+ * overlap more and the searches visit more of them), so update() rebuilds it instead once the
+ * total size of its boxes grew past a ratio of its value at the last build.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+  /**
+   * @param leaf_size The largest number of items of a leaf
+   * @param rebuild_ratio The growth of the total box size at which update() rebuilds
+   */
+  BoundingVolumeHierarchy(unsigned int leaf_size = 4, Real rebuild_ratio = 2)
+    : _leaf_size(std::max(leaf_size, 1u)), _rebuild_ratio(rebuild_ratio)
+  {
+  }
+
+  /// Builds the tree over items 0 to boxes.size() - 1
+  void build(const std::vector<BoundingBox> & boxes)
+  {
+    _nodes.clear();
+    _items.resize(boxes.size());
+    std::iota(_items.begin(), _items.end(), 0u);
+
+    _centroids.resize(boxes.size());
+    for (std::size_t i = 0; i < boxes.size(); ++i)
+      for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        _centroids[i](d) = 0.5 * (boxes[i].min()(d) + boxes[i].max()(d));
+
+    if (!boxes.empty())
+    {
+      _nodes.reserve(2 * boxes.size() / _leaf_size + 1);
+      buildNode(boxes, 0, boxes.size());
+    }
+    copyBoxes(boxes);
+    _build_surface = surface();
+    ++_num_builds;
+  }
+
+  /**
+   * Recomputes the boxes of the tree for the moved items, keeping its topology
+   * @param boxes The new boxes of the items, as many as at build()
+   */
+  void refit(const std::vector<BoundingBox> & boxes)
+  {
+    mooseAssert(boxes.size() == _items.size(), "The number of items changed since the build");
+    copyBoxes(boxes);
+
+    // Children come after their parent, so a reverse sweep sees them first
+    for (auto n = _nodes.size(); n-- > 0;)
+    {
+      auto & node = _nodes[n];
+      if (node.count)
+      {
+        node.box = _boxes[node.first];
+        for (unsigned int i = 1; i < node.count; ++i)
+          node.box.union_with(_boxes[node.first + i]);
+      }
+      else
+      {
+        node.box = _nodes[n + 1].box;
+        node.box.union_with(_nodes[node.first].box);
+      }
+    }
+    ++_num_refits;
+  }
+
+  /**
+   * Refits the tree for the moved items, or rebuilds it if refitting degraded it too much
+   * @return Whether the tree was rebuilt
+   */
+  bool update(const std::vector<BoundingBox> & boxes)
+  {
+    if (boxes.size() != _items.size())
+    {
+      build(boxes);
+      return true;
+    }
+    refit(boxes);
+    if (surface() > _rebuild_ratio * _build_surface)
+    {
+      build(boxes);
+      return true;
+    }
+    return false;
+  }
+
+  /// The number of items
+  std::size_t size() const { return _items.size(); }
+
+  /**
+   * Calls f(item) for each item whose box is within radius of p
+   */
+  template <typename F>
+  void forEachWithin(const Point & p, Real radius, F && f) const
+  {
+    if (_nodes.empty())
+      return;
+
+    const Real radius_sq = radius * radius;
+    std::vector<unsigned int> stack(1, 0);
+    while (!stack.empty())
+    {
+      const auto & node = _nodes[stack.back()];
+      const auto n = stack.back();
+      stack.pop_back();
+      if (distanceSquared(node.box, p) > radius_sq)
+        continue;
+      if (node.count)
+      {
+        for (auto i = node.first; i < node.first + node.count; ++i)
+          if (distanceSquared(_boxes[i], p) <= radius_sq)
+            f(_items[i]);
+      }
+      else
+      {
+        stack.push_back(node.first);
+        stack.push_back(n + 1);
+      }
+    }
+  }
+
+  /**
+   * Finds the item nearest to p by branch and bound
+   * @param distance The distance from p to an item; it may not be less than the distance from p
+   *                 to the box of the item, e.g. the distance to the nearest node of a face
+   * @param nearest The nearest item, or invalid_uint without items
+   * @return The distance to the nearest item
+   */
+  template <typename Distance>
+  Real nearest(const Point & p, Distance && distance, unsigned int & nearest) const
+  {
+    Real best = std::numeric_limits<Real>::max();
+    nearest = libMesh::invalid_uint;
+    if (_nodes.empty())
+      return best;
+
+    // (squared box distance, node), the closer child visited first
+    std::vector<std::pair<Real, unsigned int>> stack(1, {distanceSquared(_nodes[0].box, p), 0});
+    while (!stack.empty())
+    {
+      const auto entry = stack.back();
+      stack.pop_back();
+      if (entry.first >= best * best)
+        continue;
+
+      const auto & node = _nodes[entry.second];
+      if (node.count)
+      {
+        for (unsigned int i = 0; i < node.count; ++i)
+        {
+          const auto item = _items[node.first + i];
+          const Real d = distance(item);
+          if (d < best)
+          {
+            best = d;
+            nearest = item;
+          }
+        }
+      }
+      else
+      {
+        std::pair<Real, unsigned int> left(distanceSquared(_nodes[entry.second + 1].box, p),
+                                           entry.second + 1);
+        std::pair<Real, unsigned int> right(distanceSquared(_nodes[node.first].box, p),
+                                            node.first);
+        if (left.first < right.first)
+          std::swap(left, right);
+        stack.push_back(left);
+        stack.push_back(right);
+      }
+    }
+    return best;
+  }
+
+  ///@{ The number of builds and refits, for the statistics of the search
+  unsigned int numBuilds() const { return _num_builds; }
+  unsigned int numRefits() const { return _num_refits; }
+  ///@}
+
+private:
+  struct Node
+  {
+    BoundingBox box;
+    /// The first item of a leaf, or the right child of an internal node (the left is next)
+    unsigned int first;
+    /// The number of items of a leaf, 0 for an internal node
+    unsigned int count;
+  };
+
+  /// Builds the node of items [begin, end) and its subtree
+  unsigned int buildNode(const std::vector<BoundingBox> & boxes, std::size_t begin, std::size_t end)
+  {
+    const unsigned int n = _nodes.size();
+    _nodes.emplace_back();
+
+    BoundingBox box = boxes[_items[begin]];
+    Point lo = _centroids[_items[begin]], hi = lo;
+    for (auto i = begin + 1; i < end; ++i)
+    {
+      box.union_with(boxes[_items[i]]);
+      for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+      {
+        lo(d) = std::min(lo(d), _centroids[_items[i]](d));
+        hi(d) = std::max(hi(d), _centroids[_items[i]](d));
+      }
+    }
+    _nodes[n].box = box;
+
+    if (end - begin <= _leaf_size)
+    {
+      _nodes[n].first = begin;
+      _nodes[n].count = end - begin;
+      return n;
+    }
+
+    unsigned int axis = 0;
+    for (unsigned int d = 1; d < LIBMESH_DIM; ++d)
+      if (hi(d) - lo(d) > hi(axis) - lo(axis))
+        axis = d;
+
+    const auto mid = begin + (end - begin) / 2;
+    std::nth_element(_items.begin() + begin,
+                     _items.begin() + mid,
+                     _items.begin() + end,
+                     [this, axis](unsigned int a, unsigned int b)
+                     { return _centroids[a](axis) < _centroids[b](axis); });
+
+    buildNode(boxes, begin, mid);
+    const auto right = buildNode(boxes, mid, end);
+    _nodes[n].first = right;
+    _nodes[n].count = 0;
+    return n;
+  }
+
+  /// Copies the boxes of the items in the order of the leaves
+  void copyBoxes(const std::vector<BoundingBox> & boxes)
+  {
+    _boxes.resize(_items.size());
+    for (std::size_t i = 0; i < _items.size(); ++i)
+      _boxes[i] = boxes[_items[i]];
+  }
+
+  /// The squared distance from p to a box, 0 inside it
+  static Real distanceSquared(const BoundingBox & box, const Point & p)
+  {
+    Real d2 = 0;
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+      const Real below = box.min()(d) - p(d);
+      const Real above = p(d) - box.max()(d);
+      const Real out = std::max(std::max(below, above), Real(0));
+      d2 += out * out;
+    }
+    return d2;
+  }
+
+  /**
+   * The summed edge lengths of the boxes of the internal nodes, the quality measure of the tree;
+   * unlike their surface it does not vanish for the flat boxes of 1D and 2D surfaces
+   */
+  Real surface() const
+  {
+    Real total = 0;
+    for (const auto & node : _nodes)
+      if (!node.count)
+      {
+        const Point extent = node.box.max() - node.box.min();
+        total += extent(0) + extent(1) + extent(2);
+      }
+    return total;
+  }
+
+  const unsigned int _leaf_size;
+  const Real _rebuild_ratio;
+
+  /// The nodes, each parent before its children
+  std::vector<Node> _nodes;
+  /// The items, ordered so that those of a leaf are contiguous
+  std::vector<unsigned int> _items;
+  /// The boxes of the items, in the order of _items
+  std::vector<BoundingBox> _boxes;
+  /// The box centroids of the items of the last build
+  std::vector<Point> _centroids;
+
+  Real _build_surface = 0;
+  unsigned int _num_builds = 0;
+  unsigned int _num_refits = 0;
+};
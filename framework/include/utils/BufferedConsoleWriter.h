@@ -0,0 +1,166 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AsyncTaskQueue.h"
+#include "MooseError.h"
+
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+
+/**
+ * Collects console messages in memory and writes them to a stream in large chunks from a
+ * background thread (see AsyncTaskQueue), so that the simulation does not wait on the terminal or
+ * the file system for every line.
+ *
+ * A chunk is handed to the writer once flush_bytes are collected or when flush() is called (at
+ * the end of a time step, say); with max_chunks chunks in flight, write() blocks until the writer
+ * catches up, which bounds the memory used. Everything else writing to the stream (e.g. PETSc
+ * monitors) must call sync() first to keep the output in order.
+ *
+ * The errors, warnings and assertions bypass the Console: while a writer exists it is their
+ * console sync hook (see moose::internal::consoleSyncHook()), so all the writers are synced
+ * before such a message is written, and the buffered output precedes it instead of being lost
+ * when the run aborts.
+ */
+class BufferedConsoleWriter
+{
+public:
+  BufferedConsoleWriter(std::ostream & out,
+                        std::size_t flush_bytes = 1 << 16,
+                        unsigned int max_chunks = 2)
+    : _out(out), _flush_bytes(flush_bytes), _queue(max_chunks)
+  {
+    _buffer.reserve(_flush_bytes);
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    registry().insert(this);
+    moose::internal::consoleSyncHook() = &syncAll;
+  }
+
+  /// Writes all the collected messages; a failure to write them is not reported
+  ~BufferedConsoleWriter() noexcept
+  {
+    {
+      std::lock_guard<std::mutex> lock(registryMutex());
+      registry().erase(this);
+      if (registry().empty())
+        moose::internal::consoleSyncHook() = nullptr;
+    }
+
+    try
+    {
+      sync();
+    }
+    catch (...)
+    {
+    }
+  }
+
+  /// Collects a message
+  void write(const std::string & message)
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    _buffer += message;
+    if (_buffer.size() >= _flush_bytes)
+      flushLocked();
+  }
+
+  /// Hands the collected messages to the writer, without waiting for them to be written
+  void flush()
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    flushLocked();
+  }
+
+  /// Writes all the collected messages and waits until they are written
+  void sync()
+  {
+    flush();
+    _queue.wait();
+  }
+
+  /**
+   * Syncs every writer, ignoring their failures: the console sync hook, called on the way to an
+   * error or an abort
+   */
+  static void syncAll() noexcept
+  {
+    // An error raised while syncing must not sync again
+    static std::atomic<bool> syncing(false);
+    if (syncing.exchange(true))
+      return;
+
+    try
+    {
+      std::lock_guard<std::mutex> lock(registryMutex());
+      for (auto * writer : registry())
+        try
+        {
+          writer->sync();
+        }
+        catch (...)
+        {
+        }
+    }
+    catch (...)
+    {
+    }
+
+    syncing = false;
+  }
+
+  /// The number of bytes collected but not handed to the writer yet
+  std::size_t buffered() const
+  {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    return _buffer.size();
+  }
+
+private:
+  /// Hands the collected messages to the writer, with _mutex held
+  void flushLocked()
+  {
+    if (_buffer.empty())
+      return;
+    std::string chunk;
+    chunk.reserve(_flush_bytes);
+    chunk.swap(_buffer);
+    std::ostream & out = _out;
+    _queue.push([&out, chunk = std::move(chunk)]() {
+      out << chunk;
+      out.flush();
+    });
+  }
+
+  /// The writers that exist, synced by syncAll()
+  static std::set<BufferedConsoleWriter *> & registry()
+  {
+    static std::set<BufferedConsoleWriter *> writers;
+    return writers;
+  }
+
+  static std::mutex & registryMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  std::ostream & _out;
+  const std::size_t _flush_bytes;
+  std::string _buffer;
+  AsyncTaskQueue _queue;
+
+  /// Protects _buffer, which syncAll() may flush from another thread or from an error in write()
+  mutable std::recursive_mutex _mutex;
+};
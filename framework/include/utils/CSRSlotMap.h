@@ -0,0 +1,150 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * Map from (row, column) entries of the locally owned rows of a sparse matrix to the position of
+ * the entry in the compressed sparse row (CSR) value array.
+ *
+ * The map is built once from the sparsity pattern of the first assembled Jacobian and reused for
+ * every subsequent assembly, as long as the pattern does not change.
+ */
+class CSRSlotMap
+{
+public:
+  /// Returned by slot() for entries outside the local sparsity pattern
+  static constexpr std::size_t invalid_slot = static_cast<std::size_t>(-1);
+
+  CSRSlotMap() : _first_row(0) {}
+
+  /**
+   * Build the map from the column indices of each local row.
+   * @param first_row The global index of the first locally owned row
+   * @param row_cols The (not necessarily sorted) global column indices of each local row
+   */
+  void build(dof_id_type first_row, const std::vector<std::vector<dof_id_type>> & row_cols)
+  {
+    _first_row = first_row;
+    _row_offsets.assign(1, 0);
+    _row_offsets.reserve(row_cols.size() + 1);
+    _cols.clear();
+
+    for (const auto & cols : row_cols)
+    {
+      const auto begin = _cols.size();
+      _cols.insert(_cols.end(), cols.begin(), cols.end());
+      std::sort(_cols.begin() + begin, _cols.end());
+      _cols.erase(std::unique(_cols.begin() + begin, _cols.end()), _cols.end());
+      _row_offsets.push_back(_cols.size());
+    }
+  }
+
+  /// Whether or not the map has been built
+  bool built() const { return _row_offsets.size() > 1; }
+
+  /// Release the map, e.g. when the sparsity pattern changes
+  void clear()
+  {
+    _row_offsets.clear();
+    _cols.clear();
+  }
+
+  /**
+   * The position of entry (row, col) in the CSR value array, or invalid_slot if the row is not
+   * owned locally or the entry is not part of the sparsity pattern.
+   */
+  std::size_t slot(dof_id_type row, dof_id_type col) const
+  {
+    if (row < _first_row || row - _first_row + 1 >= _row_offsets.size())
+      return invalid_slot;
+
+    const auto local_row = row - _first_row;
+    const auto begin = _cols.begin() + _row_offsets[local_row];
+    const auto end = _cols.begin() + _row_offsets[local_row + 1];
+    const auto it = std::lower_bound(begin, end, col);
+
+    return (it != end && *it == col) ? std::size_t(it - _cols.begin()) : invalid_slot;
+  }
+
+  ///@{ CSR structure
+  dof_id_type firstRow() const { return _first_row; }
+  std::size_t numRows() const { return _row_offsets.empty() ? 0 : _row_offsets.size() - 1; }
+  std::size_t numNonzeros() const { return _cols.size(); }
+  const std::vector<std::size_t> & rowOffsets() const { return _row_offsets; }
+  const std::vector<dof_id_type> & cols() const { return _cols; }
+  ///@}
+
+private:
+  /// Global index of the first local row
+  dof_id_type _first_row;
+
+  /// Start of each local row in _cols, with one extra entry marking the end of the last row
+  std::vector<std::size_t> _row_offsets;
+
+  /// Sorted global column indices of each local row
+  std::vector<dof_id_type> _cols;
+};
+
+/**
+ * CSR value array, laid out according to a CSRSlotMap, that any number of threads can add into
+ * concurrently without locks.
+ *
+ * Additions use a compare-and-swap loop on each entry, so threads only contend when they hit the
+ * very same matrix entry.  Once the element loops are done the values are inserted row by row into
+ * the global matrix in a single pass.
+ */
+class LockFreeCSRValues
+{
+public:
+  LockFreeCSRValues() : _size(0) {}
+
+  /// Size the array for the given map and zero it
+  void init(const CSRSlotMap & map)
+  {
+    if (_size != map.numNonzeros())
+    {
+      _size = map.numNonzeros();
+      _values.reset(new std::atomic<Real>[_size]);
+    }
+    zero();
+  }
+
+  /// Zero all entries. Not thread safe.
+  void zero()
+  {
+    for (std::size_t i = 0; i < _size; ++i)
+      _values[i].store(0, std::memory_order_relaxed);
+  }
+
+  /// Atomically add value to the entry at slot. Thread safe.
+  void add(std::size_t slot, Real value)
+  {
+    auto & entry = _values[slot];
+    Real current = entry.load(std::memory_order_relaxed);
+    while (!entry.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+      ;
+  }
+
+  /// The value at slot. Only meaningful once all threads are done adding.
+  Real operator[](std::size_t slot) const { return _values[slot].load(std::memory_order_relaxed); }
+
+  std::size_t size() const { return _size; }
+
+private:
+  std::size_t _size;
+  std::unique_ptr<std::atomic<Real>[]> _values;
+};
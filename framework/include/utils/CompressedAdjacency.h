@@ -0,0 +1,231 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/threads.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * A map from dense ids (e.g. node ids) to lists of values (e.g. the ids of the elements connected
+ * to each node), stored in compressed sparse row form: one array of all the values, row after
+ * row, and one array of the offset of each row in it.
+ *
+ * Compared to a std::map<dof_id_type, std::vector<T>>, there is no node, no vector header and
+ * no separate allocation per id, and looking up a row is an index instead of a tree search. A
+ * row of an id without values is empty, and such ids are skipped when iterating, so the
+ * container reads like the map it replaces:
+ *
+ * @begincode
+ * for (const auto & pair : adjacency)
+ *   for (const auto value : pair.second)
+ *     ...
+ * @endcode
+ *
+ * The container is built at once from (id, value) pairs, typically gathered by the threads of a
+ * loop over elements, and is not modified afterwards.
+ */
+template <typename T>
+class CompressedAdjacency
+{
+public:
+  /// The values of an id, in the order they were given unless sorted when building
+  class Row
+  {
+  public:
+    Row() = default;
+    Row(const T * begin, const T * end) : _begin(begin), _end(end) {}
+
+    const T * begin() const { return _begin; }
+    const T * end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+
+    const T & operator[](std::size_t i) const
+    {
+      mooseAssert(i < size(), "Index out of range");
+      return _begin[i];
+    }
+
+    /// The number of times the value appears (binary search: only for sorted rows)
+    std::size_t count(const T & value) const
+    {
+      const auto range = std::equal_range(_begin, _end, value);
+      return range.second - range.first;
+    }
+
+  private:
+    const T * _begin = nullptr;
+    const T * _end = nullptr;
+  };
+
+  /// Iterates over the ids with a non-empty row, as (id, row) pairs
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<dof_id_type, Row>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator(const CompressedAdjacency & adjacency, dof_id_type id)
+      : _adjacency(&adjacency), _id(id)
+    {
+      skipEmpty();
+    }
+
+    reference operator*() const { return _value; }
+    pointer operator->() const { return &_value; }
+
+    const_iterator & operator++()
+    {
+      ++_id;
+      skipEmpty();
+      return *this;
+    }
+
+    bool operator==(const const_iterator & other) const { return _id == other._id; }
+    bool operator!=(const const_iterator & other) const { return _id != other._id; }
+
+  private:
+    void skipEmpty()
+    {
+      const dof_id_type num_ids = _adjacency->numIds();
+      while (_id < num_ids && _adjacency->row(_id).empty())
+        ++_id;
+      if (_id < num_ids)
+        _value = std::make_pair(_id, _adjacency->row(_id));
+    }
+
+    const CompressedAdjacency * _adjacency;
+    dof_id_type _id;
+    value_type _value;
+  };
+
+  /**
+   * Builds the container for the ids [0, num_ids) from (id, value) pairs, given in any order.
+   * The values of each id keep the order of the pairs unless \p sort_rows is set, in which case
+   * they are also sorted and made unique. The pairs are consumed.
+   */
+  void build(dof_id_type num_ids, std::vector<std::pair<dof_id_type, T>> & pairs, bool sort_rows)
+  {
+    _offsets.assign(num_ids + 1, 0);
+    for (const auto & pair : pairs)
+    {
+      mooseAssert(pair.first < num_ids, "Id " << pair.first << " is out of range");
+      ++_offsets[pair.first + 1];
+    }
+    for (dof_id_type i = 0; i < num_ids; ++i)
+      _offsets[i + 1] += _offsets[i];
+
+    // Counting sort of the values into their rows: stable, so rows keep the order of the pairs
+    _values.resize(pairs.size());
+    {
+      std::vector<std::size_t> next(_offsets.begin(), _offsets.end() - 1);
+      for (const auto & pair : pairs)
+        _values[next[pair.first]++] = pair.second;
+    }
+    std::vector<std::pair<dof_id_type, T>>().swap(pairs);
+
+    if (sort_rows)
+      sortAndUniqueRows();
+  }
+
+  /// Releases all the memory
+  void clear()
+  {
+    std::vector<std::size_t>().swap(_offsets);
+    std::vector<T>().swap(_values);
+  }
+
+  /// The number of ids, including the ones with an empty row
+  dof_id_type numIds() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+
+  /// The total number of values
+  std::size_t numValues() const { return _values.size(); }
+
+  /// The number of bytes allocated
+  std::size_t memoryBytes() const
+  {
+    return _offsets.capacity() * sizeof(std::size_t) + _values.capacity() * sizeof(T);
+  }
+
+  /// The values of an id; empty for an id out of range
+  Row row(dof_id_type id) const
+  {
+    if (id >= numIds())
+      return Row();
+    return Row(_values.data() + _offsets[id], _values.data() + _offsets[id + 1]);
+  }
+
+  ///@{ std::map-like interface
+  Row operator[](dof_id_type id) const { return row(id); }
+  Row at(dof_id_type id) const
+  {
+    if (row(id).empty())
+      mooseError("Id ", id, " has no entry");
+    return row(id);
+  }
+  std::size_t count(dof_id_type id) const { return !row(id).empty(); }
+  const_iterator find(dof_id_type id) const
+  {
+    return count(id) ? const_iterator(*this, id) : end();
+  }
+  const_iterator begin() const { return const_iterator(*this, 0); }
+  const_iterator end() const { return const_iterator(*this, numIds()); }
+  bool empty() const { return _values.empty(); }
+  ///@}
+
+private:
+  /// Sorts and removes the duplicates of every row with the thread pool, then compacts the values
+  void sortAndUniqueRows()
+  {
+    const dof_id_type num_ids = numIds();
+    std::vector<std::size_t> unique_sizes(num_ids);
+
+    Threads::parallel_for(Threads::BlockedRange<dof_id_type>(0, num_ids),
+                          [this, &unique_sizes](const Threads::BlockedRange<dof_id_type> & range)
+                          {
+                            for (auto id = range.begin(); id != range.end(); ++id)
+                            {
+                              auto begin = _values.begin() + _offsets[id];
+                              auto end = _values.begin() + _offsets[id + 1];
+                              std::sort(begin, end);
+                              unique_sizes[id] = std::unique(begin, end) - begin;
+                            }
+                          });
+
+    std::size_t next = 0;
+    for (dof_id_type id = 0; id < num_ids; ++id)
+    {
+      const auto begin = _offsets[id];
+      _offsets[id] = next;
+      std::move(_values.begin() + begin, _values.begin() + begin + unique_sizes[id],
+                _values.begin() + next);
+      next += unique_sizes[id];
+    }
+    _offsets[num_ids] = next;
+    _values.resize(next);
+    _values.shrink_to_fit();
+  }
+
+  /// The offset of the row of each id in _values, plus the total number of values
+  std::vector<std::size_t> _offsets;
+
+  /// The values of all the rows
+  std::vector<T> _values;
+};
@@ -0,0 +1,195 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/auto_ptr.h"
+#include "libmesh/coupling_matrix.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+/**
+ * The variable couplings the residual objects actually declare, per subdomain: the pairs (ivar,
+ * jvar) such that an object acting on ivar couples jvar (Coupleable::getCoupledMooseVars(), or
+ * the variable dependencies of MooseVariableDependencyInterface). Used by the "declared" coupling
+ * type in place of a full coupling matrix, so that the Jacobian sparsity only holds the blocks
+ * that are assembled: a 12-variable problem whose kernels couple a few pairs then allocates a few
+ * off-diagonal blocks instead of 132.
+ *
+ * The diagonal blocks are always coupled. Objects without subdomain restriction (boundary
+ * conditions, constraints) are added with addGlobal() and couple on every subdomain.
+ *
+ * The objects using automatic differentiation are added with addFull() (or addFullGlobal()):
+ * their material properties carry the derivatives with respect to the variables the materials
+ * couple, which the objects do not declare, so their variable is coupled to every variable.
+ */
+class DeclaredCoupling
+{
+public:
+  /**
+   * Sets up the couplings of a system, with only the diagonal blocks
+   * @param n_vars The number of variables of the system
+   */
+  void reset(unsigned int n_vars)
+  {
+    _n_vars = n_vars;
+    _blocks.clear();
+    _global.clear();
+    _full_blocks.clear();
+    _full_global.clear();
+  }
+
+  unsigned int numVars() const { return _n_vars; }
+
+  /**
+   * Records the couplings of an object restricted to subdomains
+   * @param blocks The subdomains of the object
+   * @param ivar The number of the variable of the object
+   * @param jvars The numbers of the variables it couples
+   */
+  void add(const std::set<SubdomainID> & blocks,
+           unsigned int ivar,
+           const std::vector<unsigned int> & jvars)
+  {
+    for (const auto block : blocks)
+      insert(_blocks[block], ivar, jvars);
+  }
+
+  /// Records the couplings of an object acting everywhere (e.g. a boundary condition)
+  void addGlobal(unsigned int ivar, const std::vector<unsigned int> & jvars)
+  {
+    insert(_global, ivar, jvars);
+  }
+
+  /**
+   * Couples the variable of an object restricted to subdomains to every variable, for the objects
+   * whose couplings are not all declared (automatic differentiation through material properties)
+   */
+  void addFull(const std::set<SubdomainID> & blocks, unsigned int ivar)
+  {
+    mooseAssert(ivar < _n_vars, "Variable " << ivar << " out of range");
+    for (const auto block : blocks)
+      _full_blocks[block].insert(ivar);
+  }
+
+  /// Couples the variable of an object acting everywhere to every variable, see addFull()
+  void addFullGlobal(unsigned int ivar)
+  {
+    mooseAssert(ivar < _n_vars, "Variable " << ivar << " out of range");
+    _full_global.insert(ivar);
+  }
+
+  /// Whether ivar is coupled to jvar on a subdomain
+  bool coupled(SubdomainID block, unsigned int ivar, unsigned int jvar) const
+  {
+    if (ivar == jvar || _global.count(std::make_pair(ivar, jvar)) || _full_global.count(ivar))
+      return true;
+    const auto full_it = _full_blocks.find(block);
+    if (full_it != _full_blocks.end() && full_it->second.count(ivar))
+      return true;
+    const auto it = _blocks.find(block);
+    return it != _blocks.end() && it->second.count(std::make_pair(ivar, jvar));
+  }
+
+  /// The number of off-diagonal blocks coupled on some subdomain
+  std::size_t numOffDiagonal() const
+  {
+    std::size_t n = 0;
+    const auto cm = matrix();
+    for (unsigned int i = 0; i < _n_vars; ++i)
+      for (unsigned int j = 0; j < _n_vars; ++j)
+        if (i != j && (*cm)(i, j))
+          ++n;
+    return n;
+  }
+
+  /// The coupling matrix on a subdomain, e.g. for a per-subdomain coupling functor
+  std::unique_ptr<CouplingMatrix> matrix(SubdomainID block) const
+  {
+    auto cm = diagonal();
+    fill(*cm, _global);
+    fillRows(*cm, _full_global);
+    const auto it = _blocks.find(block);
+    if (it != _blocks.end())
+      fill(*cm, it->second);
+    const auto full_it = _full_blocks.find(block);
+    if (full_it != _full_blocks.end())
+      fillRows(*cm, full_it->second);
+    return cm;
+  }
+
+  /// The union of the couplings of all the subdomains, for the DofMap coupling matrix
+  std::unique_ptr<CouplingMatrix> matrix() const
+  {
+    auto cm = diagonal();
+    fill(*cm, _global);
+    fillRows(*cm, _full_global);
+    for (const auto & block_pairs : _blocks)
+      fill(*cm, block_pairs.second);
+    for (const auto & block_rows : _full_blocks)
+      fillRows(*cm, block_rows.second);
+    return cm;
+  }
+
+private:
+  typedef std::set<std::pair<unsigned int, unsigned int>> Pairs;
+
+  void insert(Pairs & pairs, unsigned int ivar, const std::vector<unsigned int> & jvars)
+  {
+    mooseAssert(ivar < _n_vars, "Variable " << ivar << " out of range");
+    for (const auto jvar : jvars)
+    {
+      mooseAssert(jvar < _n_vars, "Variable " << jvar << " out of range");
+      if (jvar != ivar)
+        pairs.emplace(ivar, jvar);
+    }
+  }
+
+  std::unique_ptr<CouplingMatrix> diagonal() const
+  {
+    auto cm = libmesh_make_unique<CouplingMatrix>(_n_vars);
+    for (unsigned int i = 0; i < _n_vars; ++i)
+      (*cm)(i, i) = 1;
+    return cm;
+  }
+
+  static void fill(CouplingMatrix & cm, const Pairs & pairs)
+  {
+    for (const auto & pair : pairs)
+      cm(pair.first, pair.second) = 1;
+  }
+
+  void fillRows(CouplingMatrix & cm, const std::set<unsigned int> & ivars) const
+  {
+    for (const auto ivar : ivars)
+      for (unsigned int jvar = 0; jvar < _n_vars; ++jvar)
+        cm(ivar, jvar) = 1;
+  }
+
+  unsigned int _n_vars = 0;
+
+  /// The off-diagonal couplings of the subdomain restricted objects, per subdomain
+  std::map<SubdomainID, Pairs> _blocks;
+
+  /// The off-diagonal couplings of the objects acting everywhere
+  Pairs _global;
+
+  /// The variables coupled to every variable by addFull(), per subdomain
+  std::map<SubdomainID, std::set<unsigned int>> _full_blocks;
+
+  /// The variables coupled to every variable on every subdomain, by addFullGlobal()
+  std::set<unsigned int> _full_global;
+};
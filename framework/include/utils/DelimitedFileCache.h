@@ -0,0 +1,279 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace MooseUtils
+{
+
+/**
+ * A text file mapped read-only into memory, for the DelimitedFileReader parser: the lines are
+ * scanned in place instead of copied through a stream one at a time.
+ */
+class MappedTextFile
+{
+public:
+  MappedTextFile(const std::string & filename) : _filename(filename)
+  {
+    _fd = ::open(filename.c_str(), O_RDONLY);
+    if (_fd < 0)
+      mooseError("Failed to open the file '", filename, "'");
+
+    struct stat st;
+    if (fstat(_fd, &st) != 0)
+      mooseError("Failed to stat the file '", filename, "'");
+    _size = st.st_size;
+
+    // An empty file cannot be mapped
+    if (_size == 0)
+      return;
+    void * data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (data == MAP_FAILED)
+      mooseError("Failed to map the file '", filename, "'");
+    _data = static_cast<const char *>(data);
+    madvise(data, _size, MADV_SEQUENTIAL);
+  }
+
+  ~MappedTextFile()
+  {
+    if (_data)
+      munmap(const_cast<char *>(_data), _size);
+    if (_fd >= 0)
+      ::close(_fd);
+  }
+
+  MappedTextFile(const MappedTextFile &) = delete;
+  MappedTextFile & operator=(const MappedTextFile &) = delete;
+
+  /**
+   * Extracts the line starting at pos (without the end of line, "\n" or "\r\n") and moves pos to
+   * the next line.
+   * @return false at the end of the file
+   */
+  bool nextLine(std::size_t & pos, const char *& begin, const char *& end) const
+  {
+    if (pos >= _size)
+      return false;
+    begin = _data + pos;
+    const void * eol = std::memchr(begin, '\n', _size - pos);
+    end = eol ? static_cast<const char *>(eol) : _data + _size;
+    pos = end - _data + 1;
+    if (end > begin && *(end - 1) == '\r')
+      --end;
+    return true;
+  }
+
+  const char * data() const { return _data; }
+  std::size_t size() const { return _size; }
+
+private:
+  const std::string _filename;
+  int _fd = -1;
+  const char * _data = nullptr;
+  std::size_t _size = 0;
+};
+
+/**
+ * Converts the numbers of a delimited line to doubles.
+ *
+ * Each field is trimmed of spaces and parsed with strtod from a small local buffer (the mapped
+ * lines are not null terminated). Fields that are not entirely a number make the line fail,
+ * which is how DelimitedFileReader recognizes a header.
+ *
+ * @param begin, end The line
+ * @param delimiter The field delimiter; a space delimiter also accepts runs of spaces and tabs
+ * @param row The numbers, appended
+ * @return false if a field is not a number
+ */
+inline bool
+parseDelimitedLine(const char * begin,
+                   const char * end,
+                   const std::string & delimiter,
+                   std::vector<double> & row)
+{
+  const bool whitespace = delimiter == " ";
+  const auto is_space = [](char c) { return c == ' ' || c == '\t'; };
+  char buffer[64];
+
+  const char * p = begin;
+  while (p <= end)
+  {
+    const char * field_end = end;
+    if (whitespace)
+    {
+      while (p < end && is_space(*p))
+        ++p;
+      if (p == end)
+        break;
+      field_end = p;
+      while (field_end < end && !is_space(*field_end))
+        ++field_end;
+    }
+    else
+    {
+      const void * d = delimiter.empty() ? nullptr : std::memchr(p, delimiter[0], end - p);
+      if (d)
+        field_end = static_cast<const char *>(d);
+    }
+
+    const char * a = p;
+    const char * b = field_end;
+    while (a < b && is_space(*a))
+      ++a;
+    while (b > a && is_space(*(b - 1)))
+      --b;
+    if (a == b || std::size_t(b - a) >= sizeof(buffer))
+      return false;
+    std::memcpy(buffer, a, b - a);
+    buffer[b - a] = '\0';
+    char * parsed;
+    const double value = std::strtod(buffer, &parsed);
+    if (parsed != buffer + (b - a))
+      return false;
+    row.push_back(value);
+
+    p = field_end + (whitespace ? 0 : delimiter.size());
+    if (!whitespace && field_end == end)
+      break;
+  }
+  return true;
+}
+
+/**
+ * A binary columnar copy of the data read by DelimitedFileReader, written next to (or anywhere
+ * else than) the delimited file, so later runs load the columns directly instead of parsing the
+ * text again. The cache records the size and modification time of the file it was made from and
+ * is ignored once the file changes. Layout (all integers uint64):
+ *
+ * @begincode
+ * magic (8 bytes) | version | source size | source mtime | number of columns
+ * for each column: name size | name | number of values | values (double)
+ * @endcode
+ */
+class DelimitedFileCache
+{
+public:
+  /// Format version
+  static constexpr std::uint64_t VERSION = 1;
+
+  /// Writes the cache of the given data of source_filename
+  static void write(const std::string & cache_filename,
+                    const std::string & source_filename,
+                    const std::vector<std::string> & names,
+                    const std::vector<std::vector<double>> & data)
+  {
+    mooseAssert(names.size() == data.size(), "One name per column is required");
+    std::uint64_t size, mtime;
+    if (!sourceStamp(source_filename, size, mtime))
+      mooseError("Failed to stat the file '", source_filename, "'");
+
+    std::ofstream out(cache_filename, std::ios::binary | std::ios::trunc);
+    if (!out)
+      mooseError("Failed to open the delimited file cache '", cache_filename, "' for writing");
+    out.write(magic(), MAGIC_SIZE);
+    writeValue(out, std::uint64_t(VERSION));
+    writeValue(out, size);
+    writeValue(out, mtime);
+    writeValue(out, std::uint64_t(data.size()));
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+      writeValue(out, std::uint64_t(names[i].size()));
+      out.write(names[i].data(), names[i].size());
+      writeValue(out, std::uint64_t(data[i].size()));
+      out.write(reinterpret_cast<const char *>(data[i].data()), data[i].size() * sizeof(double));
+    }
+    if (!out)
+      mooseError("Failed to write the delimited file cache '", cache_filename, "'");
+  }
+
+  /**
+   * Reads the cache of source_filename.
+   * @return false (leaving names and data untouched) if the cache does not exist, is not a cache
+   *         or was made from a different version of the file
+   */
+  static bool read(const std::string & cache_filename,
+                   const std::string & source_filename,
+                   std::vector<std::string> & names,
+                   std::vector<std::vector<double>> & data)
+  {
+    std::ifstream in(cache_filename, std::ios::binary);
+    char file_magic[MAGIC_SIZE];
+    if (!in.read(file_magic, MAGIC_SIZE) || std::memcmp(file_magic, magic(), MAGIC_SIZE) != 0)
+      return false;
+
+    std::uint64_t version, size, mtime, source_size, source_mtime, n_columns;
+    if (!readValue(in, version) || version != VERSION || !readValue(in, size) ||
+        !readValue(in, mtime) || !readValue(in, n_columns))
+      return false;
+    if (!sourceStamp(source_filename, source_size, source_mtime) || size != source_size ||
+        mtime != source_mtime)
+      return false;
+
+    std::vector<std::string> cached_names(n_columns);
+    std::vector<std::vector<double>> cached_data(n_columns);
+    for (std::uint64_t i = 0; i < n_columns; ++i)
+    {
+      std::uint64_t n;
+      if (!readValue(in, n))
+        return false;
+      cached_names[i].resize(n);
+      if (!in.read(&cached_names[i][0], n) || !readValue(in, n))
+        return false;
+      cached_data[i].resize(n);
+      if (!in.read(reinterpret_cast<char *>(cached_data[i].data()), n * sizeof(double)))
+        return false;
+    }
+
+    names = std::move(cached_names);
+    data = std::move(cached_data);
+    return true;
+  }
+
+private:
+  /// File identifier
+  static const char * magic() { return "MOOSEDFC"; }
+  static constexpr std::size_t MAGIC_SIZE = 8;
+
+  static bool sourceStamp(const std::string & filename, std::uint64_t & size, std::uint64_t & mtime)
+  {
+    struct stat st;
+    if (stat(filename.c_str(), &st) != 0)
+      return false;
+    size = st.st_size;
+    mtime = st.st_mtime;
+    return true;
+  }
+
+  template <typename T>
+  static void writeValue(std::ostream & out, const T & value)
+  {
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  static bool readValue(std::istream & in, T & value)
+  {
+    return bool(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+  }
+};
+}
@@ -18,6 +18,7 @@
 
 // MOOSE includes
 #include "MooseEnum.h"
+#include "DelimitedFileCache.h"
 
 namespace MooseUtils
 {
@@ -30,6 +31,10 @@ namespace MooseUtils
  * This class assumes that all data is numeric and can be converted to a C++ double. If a
  * Communicator is provide then it will only read on processor 0 and broadcast the data to all
  * processors. If not provided it will read on all processors.
+ *
+ * Large files may be parsed in place through a read-only memory map (setMemoryMap), and the parsed
+ * data saved to a binary columnar cache (setCacheFile, see DelimitedFileCache) that later reads
+ * load instead of parsing the text, as long as the file is unchanged.
  */
 class DelimitedFileReader
 {
@@ -85,6 +90,20 @@ public:
   const std::string & getComment() const { return _row_comment; }
   ///@}
 
+  ///@{
+  /**
+   * Set/Get methods for the reading strategy.
+   *     MemoryMap: Parse the file through a memory map rather than a stream.
+   *     CacheFile: Load the data from this binary cache if it matches the file, otherwise parse the
+   *                file and write the cache (empty, the default, disables the cache).
+   */
+  void setMemoryMap(bool value) { _memory_map = value; }
+  bool getMemoryMap() const { return _memory_map; }
+
+  void setCacheFile(const std::string & value) { _cache_file = value; }
+  const std::string & getCacheFile() const { return _cache_file; }
+  ///@}
+
   /**
    * Return the column/row names.
    */
@@ -150,6 +169,12 @@ protected:
   /// Hide row comments
   std::string _row_comment;
 
+  /// Parse through a memory map
+  bool _memory_map = false;
+
+  /// Binary columnar cache of the data
+  std::string _cache_file;
+
 private:
   ///@{
   /**
@@ -159,6 +184,18 @@ private:
   void readRowData(std::ifstream & stream_data, std::vector<double> & output);
   ///@}
 
+  /**
+   * Read the numeric data from the memory mapped file (as rows or columns according to
+   * _format_flag) into a single vector, with parseDelimitedLine instead of processLine.
+   */
+  void readMappedData(const MappedTextFile & file, std::vector<double> & output);
+
+  /**
+   * Load _names and _data from the cache file, on the processor that reads.
+   * @returns True if the cache exists and matches the file.
+   */
+  bool readCache();
+
   /**
    * Populate supplied vector with content from line.
    * @param line The line to extract data from.
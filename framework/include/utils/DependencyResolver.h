@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
 #include <sstream>
@@ -65,6 +66,13 @@ public:
    */
   void insertDependency(const T & key, const T & value);
 
+  /**
+   * Insert a dependency pair without checking whether it closes a cycle, which costs a search of
+   * the graph per insertion. A cycle is then reported by getSortedValuesSets(), with all the items
+   * it could not sort. Use this to build large graphs that are only sorted.
+   */
+  void insertDependencyUnchecked(const T & key, const T & value);
+
   /**
    * Delete a dependency (only the edge) between items in the resolver. If either item is orphaned
    * due to the deletion of the edge, the items are inserted into the independent items set so they
@@ -89,7 +97,8 @@ public:
 
   /**
    * Returns a vector of sets that represent dependency resolved values.  Items in the same
-   * subvector have no dependence upon one and other.
+   * subvector have no dependence upon one and other.  This is a topological sort in O(V + E)
+   * (plus the sorting of each set into the original order).
    */
   const std::vector<std::vector<T>> & getSortedValuesSets();
 
@@ -133,14 +142,8 @@ public:
   bool operator()(const T & a, const T & b);
 
 private:
-  /**
-   * Helper classes for returning only keys or values in an iterator format
-   */
-  template <typename map_type>
-  class key_iterator;
-
-  template <typename map_type>
-  class value_iterator;
+  /// Appends item to _ordering_vector, unless it is already there
+  void addToOrdering(const T & item);
 
   /// This is our main data structure a multimap that contains any number of dependencies in a key = value format
   std::multimap<T, T> _depends;
@@ -156,11 +159,20 @@ private:
   // mutual interdependencies
   std::vector<T> _ordering_vector;
 
+  /// The position of each item in _ordering_vector
+  std::unordered_map<T, std::size_t> _ordering_index;
+
+  /// The items of _independent_items, for constant time lookups
+  std::unordered_set<T> _independent_set;
+
   /// The sorted vector of sets
   std::vector<std::vector<T>> _ordered_items;
 
   /// The sorted vector (if requested)
   std::vector<T> _ordered_items_vector;
+
+  /// The position of each item in _ordered_items_vector, for operator()
+  std::unordered_map<T, std::size_t> _sorted_index;
 };
 
 template <typename T>
@@ -186,35 +198,6 @@ private:
   std::multimap<T, T> _cyclic_items;
 };
 
-/**
- * Helper class definitions
- */
-template <typename T>
-template <typename map_type>
-class DependencyResolver<T>::key_iterator : public map_type::iterator
-{
-public:
-  typedef typename map_type::iterator map_iterator;
-  typedef typename map_iterator::value_type::first_type key_type;
-
-  key_iterator(const map_iterator & other) : map_type::iterator(other){};
-
-  key_type & operator*() { return map_type::iterator::operator*().first; }
-};
-
-template <typename T>
-template <typename map_type>
-class DependencyResolver<T>::value_iterator : public map_type::iterator
-{
-public:
-  typedef typename map_type::iterator map_iterator;
-  typedef typename map_iterator::value_type::second_type value_type;
-
-  value_iterator(const map_iterator & other) : map_type::iterator(other){};
-
-  value_type & operator*() { return map_type::iterator::operator*().second; }
-};
-
 /**
  * DependencyResolver class definitions
  */
@@ -239,10 +222,29 @@ DependencyResolver<T>::insertDependency(const T & key, const T & value)
         depends_copy);
   }
   _depends.insert(k);
-  if (std::find(_ordering_vector.begin(), _ordering_vector.end(), key) == _ordering_vector.end())
-    _ordering_vector.push_back(key);
-  if (std::find(_ordering_vector.begin(), _ordering_vector.end(), value) == _ordering_vector.end())
-    _ordering_vector.push_back(value);
+  addToOrdering(key);
+  addToOrdering(value);
+}
+
+template <typename T>
+void
+DependencyResolver<T>::insertDependencyUnchecked(const T & key, const T & value)
+{
+  auto k = std::make_pair(key, value);
+  if (!_unique_deps.insert(k).second)
+    return;
+
+  _depends.insert(k);
+  addToOrdering(key);
+  addToOrdering(value);
+}
+
+template <typename T>
+void
+DependencyResolver<T>::addToOrdering(const T & item)
+{
+  if (_ordering_index.emplace(item, _ordering_vector.size()).second)
+    _ordering_vector.push_back(item);
 }
 
 template <typename T>
@@ -291,11 +293,9 @@ template <typename T>
 void
 DependencyResolver<T>::addItem(const T & value)
 {
-  if (std::find(_independent_items.begin(), _independent_items.end(), value) ==
-      _independent_items.end())
+  if (_independent_set.insert(value).second)
     _independent_items.push_back(value);
-  if (std::find(_ordering_vector.begin(), _ordering_vector.end(), value) == _ordering_vector.end())
-    _ordering_vector.push_back(value);
+  addToOrdering(value);
 }
 
 template <typename T>
@@ -305,145 +305,129 @@ DependencyResolver<T>::clear()
   _depends.clear();
   _independent_items.clear();
   _ordering_vector.clear();
+  _ordering_index.clear();
+  _independent_set.clear();
   _ordered_items.clear();
   _ordered_items_vector.clear();
+  _sorted_index.clear();
 }
 
 template <typename T>
 const std::vector<std::vector<T>> &
 DependencyResolver<T>::getSortedValuesSets()
 {
-  // Use the original ordering for ordering subvectors
-  DependencyResolverComparator<T> comp(_ordering_vector);
-
   /**
-   * Make a copy of the map to work on since:
-   * 1) we will remove values from the map
-   * 2) We need the copy to be sorted in an unambiguous order.
+   * Kahn's algorithm, one set at a time, on the positions of the items in _ordering_vector. Each
+   * set holds the items whose last dependency was resolved by the previous set: first those that
+   * nothing depends on ("orphans"), then the others, each part in the original order.
    */
-  typedef std::multimap<T, T, DependencyResolverComparator<T>> dep_multimap;
-  dep_multimap depends(_depends.begin(), _depends.end(), comp);
-
-  // Build up a set of all keys in depends that have nothing depending on them,
-  // and put it in the orphans set.
-  std::set<T> nodepends;
-
-  std::set<T> all;
-  std::set<T> dependees;
-  for (auto & entry : depends)
+  const auto n = _ordering_vector.size();
+  const auto index = [this](const T & item) { return _ordering_index.at(item); };
+
+  std::vector<unsigned int> num_deps(n, 0);
+  std::vector<bool> depended_on(n, false);
+  std::vector<bool> in_graph(n, false);
+
+  // The items depending on each item, in compressed rows
+  std::vector<std::size_t> offsets(n + 1, 0);
+  std::vector<std::size_t> dependents(_depends.size());
+  std::vector<std::pair<std::size_t, std::size_t>> edges;
+  edges.reserve(_depends.size());
+  for (const auto & entry : _depends)
   {
-    dependees.insert(entry.second);
-    all.insert(entry.first);
-    all.insert(entry.second);
+    const auto key = index(entry.first);
+    const auto value = index(entry.second);
+    edges.emplace_back(key, value);
+    ++num_deps[key];
+    depended_on[value] = true;
+    in_graph[key] = in_graph[value] = true;
+    ++offsets[value + 1];
   }
-
-  std::set<T> orphans;
-  std::set_difference(all.begin(),
-                      all.end(),
-                      dependees.begin(),
-                      dependees.end(),
-                      std::inserter(orphans, orphans.end()));
-
-  // Remove items from _independent_items if they actually appear in depends
-  for (auto siter = _independent_items.begin(); siter != _independent_items.end();)
+  for (std::size_t i = 0; i < n; ++i)
+    offsets[i + 1] += offsets[i];
   {
-    T key = *siter;
-    bool founditem = false;
-    for (auto i2 : depends)
-    {
-      if (i2.first == key || i2.second == key)
-      {
-        founditem = true;
-        break;
-      }
-    }
-    if (founditem)
-      siter = _independent_items.erase(siter); // post increment to maintain a valid iterator
-    else
-      ++siter;
+    auto fill = offsets;
+    for (const auto & edge : edges)
+      dependents[fill[edge.second]++] = edge.first;
   }
 
+  // Remove items from _independent_items if they actually appear in depends
+  for (const auto & item : _independent_items)
+    if (in_graph[index(item)])
+      _independent_set.erase(item);
+  _independent_items.erase(std::remove_if(_independent_items.begin(),
+                                          _independent_items.end(),
+                                          [&](const T & item) { return in_graph[index(item)]; }),
+                           _independent_items.end());
+
   /* Clear the ordered items vector */
   _ordered_items.clear();
 
   // Put the independent items into the first set in _ordered_items
   std::vector<T> next_set(_independent_items.begin(), _independent_items.end());
 
+  // The items that are depended on and have no unresolved dependencies
+  std::vector<std::size_t> difference;
+  for (std::size_t i = 0; i < n; ++i)
+    if (depended_on[i] && num_deps[i] == 0)
+      difference.push_back(i);
+
+  std::vector<bool> resolved(n, false);
+  std::size_t remaining = edges.size();
+  std::vector<std::size_t> next_orphans, next_difference;
+
   /* Topological Sort */
-  while (!depends.empty())
+  while (remaining)
   {
-    /* Work with sets since set_difference doesn't always work properly with multi_map due
-     * to duplicate keys
+    /* If nothing can be resolved but there are still items that haven't come out then there is a
+     * cyclic dependency somewhere in the map.
      */
-    std::set<T, DependencyResolverComparator<T>> keys(
-        typename DependencyResolver<T>::template key_iterator<dep_multimap>(depends.begin()),
-        typename DependencyResolver<T>::template key_iterator<dep_multimap>(depends.end()),
-        comp);
-
-    std::set<T, DependencyResolverComparator<T>> values(
-        typename DependencyResolver<T>::template value_iterator<dep_multimap>(depends.begin()),
-        typename DependencyResolver<T>::template value_iterator<dep_multimap>(depends.end()),
-        comp);
-
-    std::vector<T> current_set(next_set);
-    next_set.clear();
-
-    /* This set difference creates a set of items that have no dependencies in the depend map*/
-    std::set<T, DependencyResolverComparator<T>> difference(comp);
-
-    std::set_difference(values.begin(),
-                        values.end(),
-                        keys.begin(),
-                        keys.end(),
-                        std::inserter(difference, difference.end()),
-                        comp);
-
-    /* Now remove items from the temporary map that have been "resolved" */
-    if (!difference.empty())
+    if (difference.empty())
     {
-      for (auto iter = depends.begin(); iter != depends.end();)
-      {
-        if (difference.find(iter->second) != difference.end())
+      std::ostringstream oss;
+      oss << "Cyclic dependency detected in the Dependency Resolver.  Remaining items are:\n";
+      std::multimap<T, T> cyclic_deps;
+      for (const auto & entry : _depends)
+        if (!resolved[index(entry.second)])
         {
-          T key = iter->first;
-          depends.erase(iter++); // post increment to maintain a valid iterator
-
-          // If the item is at the end of a dependency chain (by being an orphan) AND
-          // is not still in the depends map because it still has another unresolved link
-          // insert it into the next_set
-          if (orphans.find(key) != orphans.end() && depends.find(key) == depends.end())
-            next_set.push_back(key);
+          oss << entry.first << " -> " << entry.second << "\n";
+          cyclic_deps.insert(entry);
         }
-        else
-          ++iter;
-      }
-      /* Add the current set of resolved items to the ordered vector */
-      current_set.insert(current_set.end(), difference.begin(), difference.end());
-      _ordered_items.push_back(current_set);
+      throw CyclicDependencyException<T>(oss.str(), cyclic_deps);
     }
-    else
-    {
 
-      /* If the last set difference was empty but there are still items that haven't come out then
-       * there is a cyclic dependency somewhere in the map.
-       */
-      if (!depends.empty())
+    std::vector<T> current_set;
+    current_set.swap(next_set);
+
+    next_orphans.clear();
+    next_difference.clear();
+    for (const auto value : difference)
+    {
+      resolved[value] = true;
+      for (auto d = offsets[value]; d < offsets[value + 1]; ++d)
       {
-        std::ostringstream oss;
-        oss << "Cyclic dependency detected in the Dependency Resolver.  Remaining items are:\n";
-        for (auto j : depends)
-          oss << j.first << " -> " << j.second << "\n";
-        // Return a multimap without a weird comparator, to avoid
-        // dangling reference problems and for backwards compatibility
-        std::multimap<T, T> cyclic_deps(depends.begin(), depends.end());
-        throw CyclicDependencyException<T>(oss.str(), cyclic_deps);
+        const auto key = dependents[d];
+        --remaining;
+        if (--num_deps[key] == 0)
+          (depended_on[key] ? next_difference : next_orphans).push_back(key);
       }
+      current_set.push_back(_ordering_vector[value]);
     }
+
+    /* Add the current set of resolved items to the ordered vector */
+    _ordered_items.push_back(std::move(current_set));
+
+    std::sort(next_orphans.begin(), next_orphans.end());
+    for (const auto orphan : next_orphans)
+      next_set.push_back(_ordering_vector[orphan]);
+
+    std::sort(next_difference.begin(), next_difference.end());
+    difference.swap(next_difference);
   }
 
   if (next_set.empty())
   {
-    if (!_independent_items.empty() || !depends.empty())
+    if (!_independent_items.empty() || remaining)
       mooseError("DependencyResolver error: next_set shouldn't be empty!");
   }
   else
@@ -465,6 +449,10 @@ DependencyResolver<T>::getSortedValues()
   for (auto subset : _ordered_items)
     std::copy(subset.begin(), subset.end(), std::back_inserter(_ordered_items_vector));
 
+  _sorted_index.clear();
+  for (std::size_t i = 0; i < _ordered_items_vector.size(); ++i)
+    _sorted_index.emplace(_ordered_items_vector[i], i);
+
   return _ordered_items_vector;
 }
 
@@ -475,11 +463,24 @@ DependencyResolver<T>::dependsOn(const T & key, const T & value)
   if (key == value)
     return true;
 
-  // recursively call dependsOn on all the things that key depends on
-  auto ret = _depends.equal_range(key);
-  for (auto it = ret.first; it != ret.second; ++it)
-    if (dependsOn(it->second, value))
-      return true;
+  // search everything that key depends on, visiting each item once: a recursion over the
+  // dependencies would revisit the shared ones
+  std::vector<T> stack = {key};
+  std::unordered_set<T> visited = {key};
+  while (!stack.empty())
+  {
+    const T item = stack.back();
+    stack.pop_back();
+
+    auto ret = _depends.equal_range(item);
+    for (auto it = ret.first; it != ret.second; ++it)
+    {
+      if (it->second == value)
+        return true;
+      if (visited.insert(it->second).second)
+        stack.push_back(it->second);
+    }
+  }
 
   // No dependencies were found,
   // or the key is not in the tree (so it has no dependencies).
@@ -540,8 +541,8 @@ DependencyResolver<T>::operator()(const T & a, const T & b)
   if (_ordered_items_vector.empty())
     getSortedValues();
 
-  auto a_it = std::find(_ordered_items_vector.begin(), _ordered_items_vector.end(), a);
-  auto b_it = std::find(_ordered_items_vector.begin(), _ordered_items_vector.end(), b);
+  const auto a_it = _sorted_index.find(a);
+  const auto b_it = _sorted_index.find(b);
 
   /**
    * It's possible that a and/or b are not in the resolver in which case
@@ -550,9 +551,9 @@ DependencyResolver<T>::operator()(const T & a, const T & b)
    *  which will return false for a_it < b_it and b_it < a_it when both values
    *  are not in the ordered_items vector.
    */
-  if (b_it == _ordered_items_vector.end())
+  if (b_it == _sorted_index.end())
     return false;
-  if (a_it == _ordered_items_vector.end())
+  if (a_it == _sorted_index.end())
     return true;
   else
     /**
@@ -560,5 +561,5 @@ DependencyResolver<T>::operator()(const T & a, const T & b)
      * items' dependencies, but do introduce dependant items only after
      * the items they depended on; this preserves that sorting.
      */
-    return a_it < b_it;
+    return a_it->second < b_it->second;
 }
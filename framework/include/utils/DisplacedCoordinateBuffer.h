@@ -0,0 +1,123 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+#include "libmesh/threads.h"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+/**
+ * The displaced coordinates of the nodes of a displaced mesh, in one contiguous array computed
+ * from the reference coordinates and a flat array of displacement values.
+ *
+ * The owner gathers the displacement dofs of all the nodes into the value array at once (one
+ * NumericVector::get() per system instead of one lookup per node and direction) and passes it to
+ * update(). When the values are the same as in the previous update (e.g. the residual evaluations
+ * of a line search that go back to a previous iterate, or the Jacobian following a residual),
+ * nothing is recomputed and update() says so, so the nodes and the geometric search are left as
+ * they are.
+ */
+class DisplacedCoordinateBuffer
+{
+public:
+  /// Index of the value of a direction that is not displaced
+  static constexpr std::size_t NO_VALUE = std::numeric_limits<std::size_t>::max();
+
+  void clear()
+  {
+    _reference.clear();
+    _value_index.clear();
+    _coordinates.clear();
+    _values.clear();
+    _valid = false;
+  }
+
+  /**
+   * Adds a node.
+   * @param reference The coordinates of the node in the reference mesh
+   * @param value_index The index in the value array of the displacement in each direction, or
+   *                    NO_VALUE
+   * @return The index of the node in the buffer
+   */
+  std::size_t addNode(const Point & reference, const std::array<std::size_t, 3> & value_index)
+  {
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      _reference.push_back(reference(d));
+      _value_index.push_back(value_index[d]);
+    }
+    _coordinates.insert(_coordinates.end(), _reference.end() - 3, _reference.end());
+    _valid = false;
+    return size() - 1;
+  }
+
+  std::size_t size() const { return _reference.size() / 3; }
+
+  /**
+   * Recomputes the coordinates from the displacement values, with the thread pool.
+   * @return false if the values are those of the previous update, which was kept
+   */
+  bool update(const std::vector<Real> & values)
+  {
+    if (_valid && values == _values)
+      return false;
+    _values = values;
+
+    Threads::parallel_for(Threads::BlockedRange<std::size_t>(0, _reference.size()),
+                          [this](const Threads::BlockedRange<std::size_t> & range)
+                          {
+                            for (auto i = range.begin(); i != range.end(); ++i)
+                            {
+                              const auto v = _value_index[i];
+                              _coordinates[i] = _reference[i] + (v == NO_VALUE ? 0 : _values[v]);
+                            }
+                          });
+    _valid = true;
+    return true;
+  }
+
+  /// Forces the next update to recompute the coordinates
+  void invalidate() { _valid = false; }
+
+  /// The displaced coordinates of a node (three values)
+  const Real * coordinates(std::size_t node) const { return &_coordinates[3 * node]; }
+
+  /**
+   * Calls action(node, coordinates) for each node with the thread pool, for the owner to copy the
+   * coordinates into its nodes
+   */
+  template <typename Action>
+  void forEachNode(const Action & action) const
+  {
+    Threads::parallel_for(Threads::BlockedRange<std::size_t>(0, size()),
+                          [this, &action](const Threads::BlockedRange<std::size_t> & range)
+                          {
+                            for (auto i = range.begin(); i != range.end(); ++i)
+                              action(i, coordinates(i));
+                          });
+  }
+
+private:
+  /// The reference coordinates, three per node
+  std::vector<Real> _reference;
+  /// The index of the displacement value of each coordinate
+  std::vector<std::size_t> _value_index;
+  /// The displaced coordinates, three per node
+  std::vector<Real> _coordinates;
+  /// The values of the last update
+  std::vector<Real> _values;
+  /// Whether _coordinates corresponds to _values
+  bool _valid = false;
+};
@@ -0,0 +1,104 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/threads.h"
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class MooseMesh;
+
+/**
+ * A map from elements to an index computed from their geometry, such as the layer of LayeredBase
+ * or the nearest point of NearestPointBase, kept across executions on a mesh that does not move.
+ *
+ * The caches are shared: get() returns the same cache to all the objects built on the same mesh
+ * with the same description of the mapping (the direction and layer bounds, or the points), so
+ * the ~hundreds of layered user objects of a model that use the same layers compute each
+ * element's layer once. The mesh is part of the key, so the apps of a multiapp run, their
+ * displaced meshes and the successive meshes of an app never share a cache. Lookups and inserts
+ * are guarded by a mutex, as the objects of all the threads use one cache.
+ */
+class ElementIndexCache
+{
+public:
+  /**
+   * The cache shared by the objects on the same mesh with the same key, created if needed
+   * @param mesh The mesh the elements belong to (the displaced mesh for the displaced objects)
+   * @param key The numbers describing the mapping (for instance the direction, then the bounds)
+   */
+  static std::shared_ptr<ElementIndexCache> get(const MooseMesh & mesh,
+                                                const std::vector<Real> & key)
+  {
+    static Threads::spin_mutex registry_mutex;
+    static std::map<std::pair<const MooseMesh *, std::vector<Real>>,
+                    std::weak_ptr<ElementIndexCache>>
+        registry;
+
+    Threads::spin_mutex::scoped_lock lock(registry_mutex);
+
+    // Drop the entries of the caches no longer used, whose mesh may be gone
+    for (auto it = registry.begin(); it != registry.end();)
+      if (it->second.expired())
+        it = registry.erase(it);
+      else
+        ++it;
+
+    auto & weak = registry[std::make_pair(&mesh, key)];
+    auto cache = weak.lock();
+    if (!cache)
+    {
+      cache = std::make_shared<ElementIndexCache>();
+      weak = cache;
+    }
+    return cache;
+  }
+
+  /**
+   * The index of an element, computed by compute() the first time it is asked for
+   */
+  template <typename Compute>
+  unsigned int index(dof_id_type elem_id, const Compute & compute)
+  {
+    {
+      Threads::spin_mutex::scoped_lock lock(_mutex);
+      const auto it = _indices.find(elem_id);
+      if (it != _indices.end())
+        return it->second;
+    }
+    const unsigned int value = compute();
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _indices.emplace(elem_id, value);
+    return value;
+  }
+
+  /// Forgets all the elements, when the mesh changes
+  void clear()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _indices.clear();
+  }
+
+  std::size_t size() const
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _indices.size();
+  }
+
+private:
+  std::unordered_map<dof_id_type, unsigned int> _indices;
+  mutable Threads::spin_mutex _mutex;
+};
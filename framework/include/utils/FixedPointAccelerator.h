@@ -0,0 +1,244 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <cmath>
+#include <deque>
+#include <vector>
+
+/**
+ * Accelerates the fixed-point iteration x_{k+1} = G(x_k) of a coupled (Picard) solve.
+ *
+ * Each iteration passes the input x_k and the output G(x_k) of the fixed-point map to update(),
+ * which replaces the output with the next input. The vectors hold the local entries of the
+ * quantities forming the fixed-point vector (transferred variables and postprocessors), so the
+ * dot products are summed over the communicator.
+ */
+class FixedPointAccelerator
+{
+public:
+  FixedPointAccelerator(const libMesh::Parallel::Communicator & comm) : _comm(comm) {}
+  virtual ~FixedPointAccelerator() = default;
+
+  /**
+   * Computes the next input of the fixed-point map
+   * @param x The input of this iteration
+   * @param g The output of this iteration, replaced with the next input
+   */
+  virtual void update(const std::vector<Real> & x, std::vector<Real> & g) = 0;
+
+  /// Forgets the history, e.g. at the start of a time step
+  virtual void reset() = 0;
+
+protected:
+  /// Dot product over all the processors
+  Real dot(const std::vector<Real> & a, const std::vector<Real> & b) const
+  {
+    mooseAssert(a.size() == b.size(), "Size mismatch");
+    Real sum = 0;
+    for (std::size_t i = 0; i < a.size(); ++i)
+      sum += a[i] * b[i];
+    _comm.sum(sum);
+    return sum;
+  }
+
+  const libMesh::Parallel::Communicator & _comm;
+};
+
+/**
+ * Aitken's dynamic relaxation, the secant method applied to the residual r_k = G(x_k) - x_k:
+ * x_{k+1} = x_k + w_k r_k with w_k = -w_{k-1} r_{k-1}.(r_k - r_{k-1}) / |r_k - r_{k-1}|^2.
+ */
+class AitkenAccelerator : public FixedPointAccelerator
+{
+public:
+  /**
+   * @param initial_relaxation The relaxation factor of the first iteration
+   * @param max_relaxation Bound on the magnitude of the relaxation factor
+   */
+  AitkenAccelerator(const libMesh::Parallel::Communicator & comm,
+                    Real initial_relaxation,
+                    Real max_relaxation = 2)
+    : FixedPointAccelerator(comm),
+      _initial_relaxation(initial_relaxation),
+      _max_relaxation(max_relaxation),
+      _relaxation(initial_relaxation)
+  {
+  }
+
+  virtual void update(const std::vector<Real> & x, std::vector<Real> & g) override
+  {
+    std::vector<Real> r(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+      r[i] = g[i] - x[i];
+
+    if (!_r_old.empty())
+    {
+      std::vector<Real> dr(r.size());
+      for (std::size_t i = 0; i < r.size(); ++i)
+        dr[i] = r[i] - _r_old[i];
+      const Real dr2 = dot(dr, dr);
+      if (dr2 > 0)
+        _relaxation = -_relaxation * dot(_r_old, dr) / dr2;
+      _relaxation = std::max(-_max_relaxation, std::min(_relaxation, _max_relaxation));
+    }
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+      g[i] = x[i] + _relaxation * r[i];
+    _r_old = std::move(r);
+  }
+
+  virtual void reset() override
+  {
+    _r_old.clear();
+    _relaxation = _initial_relaxation;
+  }
+
+protected:
+  const Real _initial_relaxation;
+  const Real _max_relaxation;
+  Real _relaxation;
+  std::vector<Real> _r_old;
+};
+
+/**
+ * Anderson acceleration (type II) of depth m: the next input combines the last m + 1 iterations
+ * with the weights that minimize the norm of the combined residual,
+ *
+ *   x_{k+1} = G(x_k) - sum_j gamma_j (G(x_{j+1}) - G(x_j)) - (1 - beta) (r_k - sum_j gamma_j dR_j),
+ *   gamma = argmin |r_k - dR gamma|,
+ *
+ * where dR holds the differences of consecutive residuals r = G(x) - x and beta is the mixing
+ * (relaxation) factor. The least-squares problem is solved by modified Gram-Schmidt QR of dR;
+ * differences that are numerically dependent on the previous ones are dropped.
+ */
+class AndersonAccelerator : public FixedPointAccelerator
+{
+public:
+  /**
+   * @param depth The number of past iterations to combine
+   * @param mixing The mixing factor beta, 1 for no damping
+   */
+  AndersonAccelerator(const libMesh::Parallel::Communicator & comm,
+                      unsigned int depth,
+                      Real mixing = 1)
+    : FixedPointAccelerator(comm), _depth(depth), _mixing(mixing)
+  {
+    if (_depth == 0)
+      mooseError("The depth of the Anderson acceleration must be positive");
+  }
+
+  virtual void update(const std::vector<Real> & x, std::vector<Real> & g) override
+  {
+    const std::size_t n = x.size();
+    std::vector<Real> r(n);
+    for (std::size_t i = 0; i < n; ++i)
+      r[i] = g[i] - x[i];
+
+    if (!_r_old.empty())
+    {
+      std::vector<Real> dr(n), dg(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        dr[i] = r[i] - _r_old[i];
+        dg[i] = g[i] - _g_old[i];
+      }
+      _dr.push_back(std::move(dr));
+      _dg.push_back(std::move(dg));
+      if (_dr.size() > _depth)
+      {
+        _dr.pop_front();
+        _dg.pop_front();
+      }
+    }
+    _r_old = r;
+    _g_old = g;
+
+    // Thin QR of the residual differences: Q (n x m) and R (m x m, upper triangular)
+    std::vector<std::vector<Real>> q;
+    std::vector<std::vector<Real>> rr;
+    std::vector<std::size_t> columns;
+    for (std::size_t j = 0; j < _dr.size(); ++j)
+    {
+      std::vector<Real> v = _dr[j];
+      const Real norm0 = std::sqrt(dot(v, v));
+      std::vector<Real> rcol(q.size() + 1, 0);
+      for (std::size_t k = 0; k < q.size(); ++k)
+      {
+        rcol[k] = dot(q[k], v);
+        for (std::size_t i = 0; i < n; ++i)
+          v[i] -= rcol[k] * q[k][i];
+      }
+      const Real norm = std::sqrt(dot(v, v));
+      if (norm <= _drop_tolerance * norm0 || norm == 0)
+        continue;
+      rcol.back() = norm;
+      for (auto & vi : v)
+        vi /= norm;
+      q.push_back(std::move(v));
+      rr.push_back(std::move(rcol));
+      columns.push_back(j);
+    }
+
+    // gamma = R^-1 Q^T r by back substitution
+    const std::size_t m = q.size();
+    std::vector<Real> gamma(m);
+    for (std::size_t k = 0; k < m; ++k)
+      gamma[k] = dot(q[k], r);
+    for (std::size_t k = m; k-- > 0;)
+    {
+      for (std::size_t l = k + 1; l < m; ++l)
+        gamma[k] -= rr[l][k] * gamma[l];
+      gamma[k] /= rr[k][k];
+    }
+
+    // The combined output and residual, then the damped next input
+    for (std::size_t k = 0; k < m; ++k)
+    {
+      const auto & dg = _dg[columns[k]];
+      const auto & dr = _dr[columns[k]];
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        g[i] -= gamma[k] * dg[i];
+        r[i] -= gamma[k] * dr[i];
+      }
+    }
+    for (std::size_t i = 0; i < n; ++i)
+      g[i] -= (1 - _mixing) * r[i];
+  }
+
+  virtual void reset() override
+  {
+    _dr.clear();
+    _dg.clear();
+    _r_old.clear();
+    _g_old.clear();
+  }
+
+protected:
+  const unsigned int _depth;
+  const Real _mixing;
+
+  /// Relative norm under which a residual difference is considered dependent on the previous ones
+  const Real _drop_tolerance = 1e-10;
+
+  ///@{ The differences of the last residuals and outputs, oldest first
+  std::deque<std::vector<Real>> _dr;
+  std::deque<std::vector<Real>> _dg;
+  ///@}
+
+  std::vector<Real> _r_old;
+  std::vector<Real> _g_old;
+};
@@ -16,6 +16,7 @@
 #include "JsonSyntaxTree.h"
 
 // C++ includes
+#include <algorithm>
 #include <fstream>
 
 // Forward declarations
@@ -228,6 +229,21 @@ public:
    */
   void sortColumns();
 
+  /**
+   * Limit the number of rows kept in memory: rows that have been written by printCSV() are
+   * dropped, oldest first, once the table holds more than max_rows rows. Zero (the default)
+   * keeps every row. The screen output and the restart data then only contain the last rows.
+   */
+  void setMaxRowsInMemory(std::size_t max_rows) { _max_rows_in_memory = max_rows; }
+
+  /**
+   * Flush the CSV file only every flush_interval calls to printCSV() instead of every call
+   */
+  void setFlushInterval(unsigned int flush_interval)
+  {
+    _flush_interval = std::max(flush_interval, 1u);
+  }
+
 protected:
   void printTablePiece(std::ostream & out,
                        unsigned int last_n_entries,
@@ -289,6 +305,17 @@ private:
   /// Fill any values that are not defined (usually when there are mismatched column lengths)
   void fillEmptyValues();
 
+  /// Drop the oldest rows that have been written, see setMaxRowsInMemory()
+  void pruneWrittenRows()
+  {
+    if (!_max_rows_in_memory || _data.size() <= _max_rows_in_memory)
+      return;
+
+    const auto num_pruned = std::min(_data.size() - _max_rows_in_memory, _output_row_index);
+    _data.erase(_data.begin(), _data.begin() + num_pruned);
+    _output_row_index -= num_pruned;
+  }
+
   /// The optional output file stream
   std::string _output_file_name;
 
@@ -324,6 +351,15 @@ private:
   /// Flag indicating that sorting is necessary (used by sortColumns method).
   bool _column_names_unsorted = true;
 
+  /// Maximum number of rows kept after they are written, 0 for all
+  std::size_t _max_rows_in_memory = 0;
+
+  /// Number of printCSV() calls between flushes of the CSV file
+  unsigned int _flush_interval = 1;
+
+  /// Number of printCSV() calls since the last flush
+  unsigned int _num_unflushed = 0;
+
   friend void
   dataStore<FormattedTable>(std::ostream & stream, FormattedTable & table, void * context);
   friend void dataLoad<FormattedTable>(std::istream & stream, FormattedTable & v, void * context);
@@ -29,6 +29,8 @@
   using FunctionParserUtils<T>::_disable_fpoptimizer;                                              \
   using FunctionParserUtils<T>::_enable_auto_optimize;                                             \
   using FunctionParserUtils<T>::_fail_on_evalerror;                                                \
+  using FunctionParserUtils<T>::_enable_fused_jit;                                                 \
+  using FunctionParserUtils<T>::_jit_cache_dir;                                                    \
   using typename FunctionParserUtils<T>::FailureMethod;                                            \
   using FunctionParserUtils<T>::_eval_error_msg;                                                   \
   using FunctionParserUtils<T>::_func_params
@@ -82,8 +84,13 @@ protected:
   bool _disable_fpoptimizer;
   bool _enable_auto_optimize;
   bool _fail_on_evalerror;
+  /// compile a function and all its derivatives into one native function (see FusedJITFunction)
+  bool _enable_fused_jit;
   //@}
 
+  /// The directory of the libraries compiled for the fused JIT
+  std::string _jit_cache_dir;
+
   /// Enum for failure method
   const enum class FailureMethod { nan, nan_warning, error, exception } _evalerror_behavior;
 
@@ -0,0 +1,234 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseUtils.h"
+
+#include "libmesh/fparser_ad.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Compiles a parsed function and its derivatives into a single native function.
+ *
+ * The fparser JIT compiles every derivative of a DerivativeParsedMaterial into its own shared
+ * library, and each is called separately at every quadrature point. Here the code of all the
+ * functions (generated by the parsers themselves, see FunctionParserADBase::JITCodeGen()) goes
+ * into one translation unit, behind one entry point that evaluates them all: the compiler
+ * inlines them and shares their common subexpressions, and a single call per quadrature point
+ * fills every output.
+ *
+ * The libraries are cached on disk under the hash of their source (and compiler command), so
+ * later runs, and the other processors of this run, load them without compiling. The source is
+ * kept next to the library and compared on load, so a hash collision only costs a compilation.
+ *
+ * A second entry point evaluates a batch of points (e.g. all the quadrature points of an element)
+ * in one call on structure-of-arrays inputs and outputs; its loop over the points is marked for
+ * SIMD vectorization, which the inlined, branch-free code of most expressions allows.
+ *
+ * The compiler is $MOOSE_JIT_CXX (default c++). Parser is FunctionParserADBase<Real> or
+ * ADFParser, Value the matching Real or ADReal; ADReal requires the include flags of the AD
+ * headers (ADFPARSER_INCLUDES, as for ADFParser::JITCompile()).
+ */
+template <typename Parser, typename Value>
+class FusedJITFunction
+{
+public:
+  /**
+   * Adds a function (the value or one of its derivatives)
+   * @return The index of its result in eval()
+   */
+  unsigned int add(const Parser & parser)
+  {
+    mooseAssert(!_fused, "Functions cannot be added after compile()");
+    _parsers.emplace_back(parser);
+    return _parsers.size() - 1;
+  }
+
+  /// The number of functions
+  std::size_t size() const { return _parsers.size(); }
+
+  /**
+   * Generates the fused function, then loads it from the cache or compiles it
+   * @param value_type The C++ name of Value in the generated code ("Real" or "ADReal")
+   * @param cache_dir The directory of the compiled libraries
+   * @param n_params The number of variables of the functions, for the batched entry point
+   * @return Whether the fused function is available; if not, the functions are evaluated by
+   *         their parsers
+   */
+  bool compile(const std::string & value_type, const std::string & cache_dir, unsigned int n_params)
+  {
+    std::ostringstream source;
+    for (std::size_t i = 0; i < _parsers.size(); ++i)
+      if (!_parsers[i].codeGen(source, "f" + std::to_string(i), value_type))
+        return false;
+
+    // One entry point, all the outputs
+    source << "extern \"C\" void fused(const " << value_type << " * params, const " << value_type
+           << " * const * immeds, const " << value_type << " eps, " << value_type
+           << " * results)\n{\n";
+    for (std::size_t i = 0; i < _parsers.size(); ++i)
+      source << "  results[" << i << "] = f" << i << "(params, immeds[" << i << "], eps);\n";
+    source << "}\n";
+
+    // The batch: params[p * n + q], results[f * n + q]
+    source << "extern \"C\" void fused_batch(const unsigned int n, const " << value_type
+           << " * params, const " << value_type << " * const * immeds, const " << value_type
+           << " eps, " << value_type << " * results)\n{\n"
+           << "#pragma omp simd\n"
+           << "  for (unsigned int q = 0; q < n; ++q)\n  {\n"
+           << "    " << value_type << " local[" << std::max(n_params, 1u) << "];\n";
+    for (unsigned int p = 0; p < n_params; ++p)
+      source << "    local[" << p << "] = params[" << p << " * n + q];\n";
+    for (std::size_t i = 0; i < _parsers.size(); ++i)
+      source << "    results[" << i << " * n + q] = f" << i << "(local, immeds[" << i
+             << "], eps);\n";
+    source << "  }\n}\n";
+
+    const std::string cxx = std::getenv("MOOSE_JIT_CXX") ? std::getenv("MOOSE_JIT_CXX") : "c++";
+    std::string flags = "-O3 -fopenmp-simd -shared -fPIC";
+    if (value_type != "Real")
+    {
+#ifdef ADFPARSER_INCLUDES
+      flags += " " ADFPARSER_INCLUDES;
+#else
+      return false;
+#endif
+    }
+
+    const auto code = source.str();
+    const auto key = std::hash<std::string>()(cxx + " " + flags + "\n" + code);
+    const auto base = cache_dir + "/fused_" + std::to_string(key);
+
+    if (!cached(base, code) && !build(base, code, cxx, flags))
+      return false;
+
+    _library = dlopen((base + ".so").c_str(), RTLD_NOW);
+    if (!_library)
+      return false;
+    _fused = reinterpret_cast<FusedFunction>(dlsym(_library, "fused"));
+    _fused_batch = reinterpret_cast<FusedBatchFunction>(dlsym(_library, "fused_batch"));
+    if (!_fused || !_fused_batch)
+      return false;
+
+    _immeds.clear();
+    for (const auto & parser : _parsers)
+      _immeds.push_back(parser.immed());
+    return true;
+  }
+
+  /// Whether compile() succeeded
+  bool compiled() const { return _fused; }
+
+  /**
+   * Evaluates all the functions
+   * @param params The values of the variables of the functions
+   * @param results The value of each function, in the order they were added
+   */
+  void eval(const Value * params, Value * results) const
+  {
+    mooseAssert(_fused, "compile() must succeed before eval()");
+    _fused(params, _immeds.data(), _epsilon, results);
+  }
+
+  /**
+   * Evaluates all the functions at n points
+   * @param n The number of points
+   * @param params The variables, params[p * n + q] for variable p at point q
+   * @param results The values, results[f * n + q] for function f at point q
+   */
+  void evalBatch(unsigned int n, const Value * params, Value * results) const
+  {
+    mooseAssert(_fused_batch, "compile() must succeed before evalBatch()");
+    _fused_batch(n, params, _immeds.data(), _epsilon, results);
+  }
+
+  ~FusedJITFunction()
+  {
+    if (_library)
+      dlclose(_library);
+  }
+
+private:
+  typedef void (*FusedFunction)(const Value *, const Value * const *, const Value, Value *);
+  typedef void (*FusedBatchFunction)(
+      const unsigned int, const Value *, const Value * const *, const Value, Value *);
+
+  /// Exposes the code generation and constants of a parser
+  struct Access : public Parser
+  {
+    Access(const Parser & parser) : Parser(parser) {}
+
+    bool codeGen(std::ostream & out, const std::string & name, const std::string & value_type)
+    {
+      return this->JITCodeGen(out, name, value_type);
+    }
+
+    const Value * immed() const
+    {
+      return this->mData->mImmed.empty() ? nullptr : &this->mData->mImmed[0];
+    }
+  };
+
+  /// Whether the library for \p code is in the cache
+  static bool cached(const std::string & base, const std::string & code)
+  {
+    if (!MooseUtils::pathExists(base + ".so"))
+      return false;
+    std::ifstream in(base + ".cc");
+    std::stringstream existing;
+    existing << in.rdbuf();
+    return existing.str() == code;
+  }
+
+  /// Compiles \p code into the cache; the library is renamed into place so concurrent builds
+  /// never expose a partial file
+  static bool build(const std::string & base,
+                    const std::string & code,
+                    const std::string & cxx,
+                    const std::string & flags)
+  {
+    const auto tmp = base + "." + std::to_string(getpid());
+    {
+      std::ofstream out(tmp + ".cc");
+      out << code;
+      if (!out)
+        return false;
+    }
+    const auto command = cxx + " " + flags + " -o " + tmp + ".so " + tmp + ".cc";
+    if (std::system(command.c_str()) != 0)
+    {
+      std::remove((tmp + ".cc").c_str());
+      return false;
+    }
+    return std::rename((tmp + ".cc").c_str(), (base + ".cc").c_str()) == 0 &&
+           std::rename((tmp + ".so").c_str(), (base + ".so").c_str()) == 0;
+  }
+
+  std::vector<Access> _parsers;
+  std::vector<const Value *> _immeds;
+
+  void * _library = nullptr;
+  FusedFunction _fused = nullptr;
+  FusedBatchFunction _fused_batch = nullptr;
+
+  /// The epsilon of the parsers' comparisons (FunctionParserADBase uses the same default)
+  const Value _epsilon = 1e-12;
+};
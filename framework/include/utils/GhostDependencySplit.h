@@ -0,0 +1,95 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/auto_ptr.h"
+#include "libmesh/elem_range.h"
+#include "libmesh/multi_predicates.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * Splits the local elements into the interior ones, which only read locally owned dofs, and the
+ * interface ones, which read dofs owned by other processors. The interior elements can be
+ * computed while the ghost values of the solution are still being exchanged, the interface ones
+ * once the exchange is done.
+ *
+ * The dofs an element reads are the dofs of its variables and, when neighbor coupled objects (DG
+ * kernels, interface kernels) are active, those of its side neighbors as well: the caller passes
+ * them all to add().
+ */
+class GhostDependencySplit
+{
+public:
+  /**
+   * Forgets the elements
+   * @param first_local_dof The first dof owned by this processor
+   * @param end_local_dof One past the last dof owned by this processor
+   */
+  void reset(dof_id_type first_local_dof, dof_id_type end_local_dof)
+  {
+    _first_local_dof = first_local_dof;
+    _end_local_dof = end_local_dof;
+    _interior.clear();
+    _interface.clear();
+    _interior_range.reset();
+    _interface_range.reset();
+  }
+
+  /// Classifies an element from the dofs it reads
+  void add(const Elem * elem, const std::vector<dof_id_type> & dof_indices)
+  {
+    for (const auto dof : dof_indices)
+      if (dof < _first_local_dof || dof >= _end_local_dof)
+      {
+        _interface.push_back(elem);
+        return;
+      }
+    _interior.push_back(elem);
+  }
+
+  ///@{ The elements of each kind, in the order they were added
+  const std::vector<const Elem *> & interior() const { return _interior; }
+  const std::vector<const Elem *> & interface() const { return _interface; }
+  ///@}
+
+  ///@{ The elements of each kind as ranges for the threaded element loops
+  ConstElemRange & interiorRange() { return range(_interior, _interior_range); }
+  ConstElemRange & interfaceRange() { return range(_interface, _interface_range); }
+  ///@}
+
+private:
+  static ConstElemRange & range(const std::vector<const Elem *> & elems,
+                                std::unique_ptr<ConstElemRange> & range)
+  {
+    if (!range)
+    {
+      typedef std::vector<const Elem *>::const_iterator Iterator;
+      range = libmesh_make_unique<ConstElemRange>(
+          MeshBase::const_element_iterator(
+              elems.begin(), elems.end(), Predicates::NotNull<Iterator>()),
+          MeshBase::const_element_iterator(
+              elems.end(), elems.end(), Predicates::NotNull<Iterator>()));
+    }
+    return *range;
+  }
+
+  dof_id_type _first_local_dof = 0;
+  dof_id_type _end_local_dof = 0;
+
+  std::vector<const Elem *> _interior;
+  std::vector<const Elem *> _interface;
+
+  std::unique_ptr<ConstElemRange> _interior_range;
+  std::unique_ptr<ConstElemRange> _interface_range;
+};
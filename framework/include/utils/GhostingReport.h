@@ -0,0 +1,153 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Collects the elements each object makes a processor ghost (through its RelationshipManagers),
+ * to tell which objects the ghosting comes from and what it costs.
+ *
+ * For every object the report gives the number of elements it ghosts, the number of them that no
+ * other object ghosts (what removing or restricting its RelationshipManagers would save) and an
+ * estimate of their memory, from a number of bytes per ghosted element supplied by the caller
+ * (element, nodes and, for algebraic ghosting, the dofs and their vector entries).
+ */
+class GhostingReport
+{
+public:
+  /// Forgets all the objects
+  void clear()
+  {
+    _ghosted.clear();
+    _finalized = false;
+  }
+
+  /**
+   * Records ghosted elements of an object; may be called several times for the same object (one
+   * call per RelationshipManager)
+   * @param object The name of the object (RelationshipManager::forWhom())
+   * @param elem_ids The ids of the elements ghosted, in any order and with duplicates
+   */
+  void add(const std::string & object, const std::vector<dof_id_type> & elem_ids)
+  {
+    auto & ids = _ghosted[object];
+    ids.insert(ids.end(), elem_ids.begin(), elem_ids.end());
+    _finalized = false;
+  }
+
+  /// Removes the duplicates and counts the elements ghosted by a single object
+  void finalize()
+  {
+    std::map<dof_id_type, unsigned int> num_objects;
+    for (auto & pair : _ghosted)
+    {
+      auto & ids = pair.second;
+      std::sort(ids.begin(), ids.end());
+      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+      for (const auto id : ids)
+        ++num_objects[id];
+    }
+
+    _num_total = num_objects.size();
+    _num_exclusive.clear();
+    for (const auto & pair : _ghosted)
+    {
+      std::size_t & n = _num_exclusive[pair.first];
+      n = 0;
+      for (const auto id : pair.second)
+        if (num_objects[id] == 1)
+          ++n;
+    }
+    _finalized = true;
+  }
+
+  /// The objects recorded, in alphabetical order
+  std::vector<std::string> objects() const
+  {
+    std::vector<std::string> names;
+    for (const auto & pair : _ghosted)
+      names.push_back(pair.first);
+    return names;
+  }
+
+  /// The number of elements ghosted for an object
+  std::size_t numGhosted(const std::string & object) const
+  {
+    checkFinalized();
+    const auto it = _ghosted.find(object);
+    return it == _ghosted.end() ? 0 : it->second.size();
+  }
+
+  /// The number of elements ghosted for an object only
+  std::size_t numExclusive(const std::string & object) const
+  {
+    checkFinalized();
+    const auto it = _num_exclusive.find(object);
+    return it == _num_exclusive.end() ? 0 : it->second;
+  }
+
+  /// The number of elements ghosted for any object
+  std::size_t numGhosted() const
+  {
+    checkFinalized();
+    return _num_total;
+  }
+
+  /**
+   * Prints one line per object: its ghosted and exclusively ghosted elements, and their estimated
+   * memory
+   */
+  void print(std::ostream & out, std::size_t bytes_per_elem) const
+  {
+    checkFinalized();
+    std::size_t width = 6;
+    for (const auto & pair : _ghosted)
+      width = std::max(width, pair.first.size());
+
+    out << std::left << std::setw(width) << "Object" << std::right << std::setw(12) << "Ghosted"
+        << std::setw(12) << "Exclusive" << std::setw(14) << "Memory (kB)" << '\n';
+    for (const auto & pair : _ghosted)
+    {
+      const auto n = pair.second.size();
+      out << std::left << std::setw(width) << pair.first << std::right << std::setw(12) << n
+          << std::setw(12) << numExclusive(pair.first) << std::setw(14)
+          << n * bytes_per_elem / 1024 << '\n';
+    }
+    out << std::left << std::setw(width) << "Total" << std::right << std::setw(12) << _num_total
+        << std::setw(12) << "" << std::setw(14) << _num_total * bytes_per_elem / 1024 << '\n';
+  }
+
+private:
+  void checkFinalized() const
+  {
+    if (!_finalized)
+      mooseError("GhostingReport::finalize() must be called before querying the report");
+  }
+
+  /// The elements ghosted for each object
+  std::map<std::string, std::vector<dof_id_type>> _ghosted;
+
+  /// The number of elements ghosted for each object only
+  std::map<std::string, std::size_t> _num_exclusive;
+
+  /// The number of elements ghosted for any object
+  std::size_t _num_total = 0;
+
+  bool _finalized = false;
+};
@@ -0,0 +1,229 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseConfig.h"
+#include "MooseTypes.h"
+
+#ifdef MOOSE_HAVE_PERF_EVENT
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * Hardware performance counters of the calling thread (and of the threads it creates after the
+ * counters are opened), read through the Linux perf_event interface.
+ *
+ * Only available when MOOSE was configured with --enable-perf-event. Otherwise, or when the
+ * kernel refuses to open an event (e.g. because of perf_event_paranoid), the event is reported
+ * as unavailable and reads as zero.
+ */
+class HardwareCounters
+{
+public:
+  /// The counted events
+  enum Event : unsigned int
+  {
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_REFERENCES,
+    CACHE_MISSES,
+    FLOPS,
+    NUM_EVENTS
+  };
+
+  typedef std::array<unsigned long long, NUM_EVENTS> Counts;
+
+  /**
+   * Open the counters.
+   *
+   * @param flop_event There is no generic floating point operation event: the raw, CPU specific
+   * event code to count as FLOPS (e.g. FP_ARITH_INST_RETIRED on Intel). FLOPS is unavailable if 0.
+   */
+  HardwareCounters(unsigned long long flop_event = 0)
+  {
+    _fds.fill(-1);
+
+#ifdef MOOSE_HAVE_PERF_EVENT
+    open(CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    open(INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    open(CACHE_REFERENCES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES);
+    open(CACHE_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    if (flop_event)
+      open(FLOPS, PERF_TYPE_RAW, flop_event);
+#else
+    libmesh_ignore(flop_event);
+#endif
+  }
+
+  ~HardwareCounters()
+  {
+#ifdef MOOSE_HAVE_PERF_EVENT
+    for (const auto fd : _fds)
+      if (fd >= 0)
+        close(fd);
+#endif
+  }
+
+  HardwareCounters(const HardwareCounters &) = delete;
+  HardwareCounters & operator=(const HardwareCounters &) = delete;
+
+  /// Whether or not the event could be opened
+  bool available(const Event event) const { return _fds[event] >= 0; }
+
+  /// The current value of every counter
+  Counts read() const
+  {
+    Counts counts;
+    counts.fill(0);
+
+#ifdef MOOSE_HAVE_PERF_EVENT
+    for (unsigned int e = 0; e < NUM_EVENTS; ++e)
+      if (_fds[e] >= 0 && ::read(_fds[e], &counts[e], sizeof(counts[e])) != sizeof(counts[e]))
+        counts[e] = 0;
+#endif
+
+    return counts;
+  }
+
+  /// The display name of an event
+  static const std::string & name(const Event event)
+  {
+    static const std::array<std::string, NUM_EVENTS> names = {
+        {"Cycles", "Instructions", "Cache References", "Cache Misses", "FLOPs"}};
+    return names[event];
+  }
+
+  /// Instructions per cycle
+  static Real ipc(const Counts & counts)
+  {
+    return counts[CYCLES] ? Real(counts[INSTRUCTIONS]) / counts[CYCLES] : 0;
+  }
+
+  /// Fraction of the cache references that missed the last level cache
+  static Real cacheMissRate(const Counts & counts)
+  {
+    return counts[CACHE_REFERENCES] ? Real(counts[CACHE_MISSES]) / counts[CACHE_REFERENCES] : 0;
+  }
+
+private:
+#ifdef MOOSE_HAVE_PERF_EVENT
+  void open(const Event event, const unsigned int type, const unsigned long long config)
+  {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // This thread, any cpu, no group
+    _fds[event] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+#endif
+
+  /// The file descriptor of each event, -1 if unavailable
+  std::array<int, NUM_EVENTS> _fds;
+};
+
+/**
+ * Hardware counter totals per PerfGraph section, filled by PerfGuard for the sections that
+ * have counting enabled (see PerfGraph::enableHardwareCounters()).
+ */
+class HardwareCounterTable
+{
+public:
+  /**
+   * @param sections The names of the sections to count, all sections if empty
+   * @param flop_event See HardwareCounters
+   */
+  HardwareCounterTable(const std::vector<std::string> & sections,
+                       unsigned long long flop_event = 0)
+    : _counters(flop_event), _section_names(sections)
+  {
+  }
+
+  /// The counters
+  const HardwareCounters & counters() const { return _counters; }
+
+  /// Whether or not the section has been checked against the requested section names
+  bool resolved(const PerfID id) const { return id < _counted.size() && _counted[id] >= 0; }
+
+  /// Check a section against the requested section names
+  void resolve(const PerfID id, const std::string & name)
+  {
+    if (id >= _counted.size())
+    {
+      _counted.resize(id + 1, -1);
+      _counts.resize(id + 1);
+      _num_calls.resize(id + 1, 0);
+    }
+
+    _counted[id] = _section_names.empty();
+    for (const auto & section_name : _section_names)
+      if (section_name == name)
+        _counted[id] = 1;
+  }
+
+  /// Whether or not the (resolved) section is counted
+  bool counted(const PerfID id) const { return _counted[id] > 0; }
+
+  /// Add the counts of a call of a section, given the counter values at its start
+  void add(const PerfID id, const HardwareCounters::Counts & start)
+  {
+    const auto end = _counters.read();
+    for (unsigned int e = 0; e < HardwareCounters::NUM_EVENTS; ++e)
+      _counts[id][e] += end[e] - start[e];
+    ++_num_calls[id];
+  }
+
+  /// The accumulated counts of a section
+  const HardwareCounters::Counts & counts(const PerfID id) const { return _counts[id]; }
+
+  /// The number of counted calls of a section
+  unsigned long int numCalls(const PerfID id) const
+  {
+    return id < _num_calls.size() ? _num_calls[id] : 0;
+  }
+
+  /// The sections that have been counted at least once
+  std::vector<PerfID> countedSections() const
+  {
+    std::vector<PerfID> ids;
+    for (PerfID id = 0; id < _num_calls.size(); ++id)
+      if (_num_calls[id])
+        ids.push_back(id);
+    return ids;
+  }
+
+private:
+  HardwareCounters _counters;
+
+  /// The names of the sections to count, all sections if empty
+  const std::vector<std::string> _section_names;
+
+  /// Whether or not each section is counted, indexed by PerfID (-1: not resolved yet)
+  std::vector<signed char> _counted;
+
+  /// Accumulated counts, indexed by PerfID
+  std::vector<HardwareCounters::Counts> _counts;
+
+  /// Number of counted calls, indexed by PerfID
+  std::vector<unsigned long int> _num_calls;
+};
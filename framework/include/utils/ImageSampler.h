@@ -12,6 +12,7 @@
 // MOOSE includes
 #include "FileRangeBuilder.h"
 #include "ConsoleStream.h"
+#include "ImageVoxelPyramid.h"
 
 #include "libmesh/bounding_box.h"
 
@@ -69,11 +70,22 @@ public:
    */
   virtual Real sample(const Point & p) const;
 
+  /**
+   * Return the pixel value for the given point, from the coarsest pyramid level whose voxels are
+   * no larger than the given length (the size of the element sampling the image)
+   * @param p The point at which to extract pixel data
+   * @param h The length resolved by the caller
+   */
+  virtual Real sample(const Point & p, Real h) const;
+
   /**
    * Perform initialization of image data
    */
   virtual void setupImageSampler(MooseMesh & mesh);
 
+  /// Whether the image is held as the voxels overlapping the local elements only
+  bool outOfCore() const { return _out_of_core; }
+
 protected:
   /**
    * Apply image re-scaling using the vtkImageShiftAndRescale object
@@ -99,6 +111,22 @@ protected:
    */
   void vtkFlip();
 
+  /**
+   * Setup of the out-of-core mode ("out_of_core = true"): reads, one file of the stack at a time,
+   * only the voxels in the bounding box of the local elements of this processor (plus a layer of
+   * "out_of_core_padding" voxels), extended by ImageVoxelPyramid::alignedBox() so that the coarse
+   * voxels match across processors, processes them with the same filters as the in-core mode and
+   * builds the pyramid of "pyramid_levels" levels from them. The files that do not overlap the box
+   * are never opened. Points outside the box sample its closest voxel.
+   *
+   * With "shared_image = true" the processors of a node instead read the box of all their local
+   * elements once, into an MPI shared memory window that all of them sample from.
+   */
+  void setupOutOfCore(MooseMesh & mesh);
+
+  /// The global voxel index (of the whole stack) of a point
+  std::array<int, 3> voxelIndex(const Point & p) const;
+
 private:
 #ifdef LIBMESH_HAVE_VTK
 
@@ -156,6 +184,18 @@ private:
   /// Bounding box for testing points
   BoundingBox _bounding_box;
 
+  /// Whether only the voxels overlapping the local elements are read
+  const bool _out_of_core;
+
+  /// Whether the processors of a node share one copy of the voxels
+  const bool _shared_image;
+
+  /// The voxels of this processor (or node) and their coarsened levels, in the out-of-core mode
+  ImageVoxelPyramid _pyramid;
+
+  /// The size of the smallest voxel side, to express element sizes in voxels for the pyramid
+  Real _min_voxel;
+
   /// Parameters for interface
   const InputParameters & _is_pars;
 
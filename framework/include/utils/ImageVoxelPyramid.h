@@ -0,0 +1,176 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+/**
+ * The voxels of a box of an image stack (the part overlapping the local elements of a processor,
+ * rather than the whole stack), with coarsened copies: level l averages blocks of 2^l voxels in
+ * each direction, so an element much larger than a voxel samples a coarse level that represents
+ * its neighborhood, and coarse meshes do not touch the fine data at all.
+ *
+ * Voxel indices are global (those of the whole stack); the box is [begin, end) in each direction.
+ * The coarse voxels are aligned to the whole stack rather than to the box: voxel I of level l
+ * averages the level 0 voxels [I 2^l, (I + 1) 2^l), so the processors sharing a coarse voxel
+ * compute the same value for it, provided their boxes hold all of its fine voxels (see
+ * alignedBox()); otherwise the coarse voxels cut by the box average the part inside it.
+ */
+class ImageVoxelPyramid
+{
+public:
+  /**
+   * @param begin, end The global voxel index range of the box
+   * @param values The voxels of the box, x fastest, then y, then z
+   * @param n_levels The number of levels, including the full resolution level 0
+   */
+  void build(const std::array<int, 3> & begin,
+             const std::array<int, 3> & end,
+             std::vector<float> && values,
+             unsigned int n_levels)
+  {
+    for (unsigned int d = 0; d < 3; ++d)
+      if (end[d] <= begin[d])
+        mooseError("Empty image voxel box in direction ", d);
+    _levels.clear();
+    _levels.resize(std::max(n_levels, 1u));
+
+    auto & fine = _levels[0];
+    fine.begin = begin;
+    for (unsigned int d = 0; d < 3; ++d)
+      fine.size[d] = end[d] - begin[d];
+    if (values.size() != std::size_t(fine.size[0]) * fine.size[1] * fine.size[2])
+      mooseError("The image voxel box has ", values.size(), " values for its size");
+    fine.values = std::move(values);
+
+    for (unsigned int l = 1; l < _levels.size(); ++l)
+      coarsen(_levels[l - 1], _levels[l]);
+  }
+
+  unsigned int numLevels() const { return _levels.size(); }
+
+  /**
+   * Extends the box [begin, end) outward to multiples of 2^(n_levels - 1) voxels, within the
+   * stack of \p stack_size voxels, so that every coarse voxel of the box is complete
+   */
+  static void alignedBox(std::array<int, 3> & begin,
+                         std::array<int, 3> & end,
+                         const std::array<int, 3> & stack_size,
+                         unsigned int n_levels)
+  {
+    const int block = 1 << (std::max(n_levels, 1u) - 1);
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      begin[d] = std::max(begin[d] / block * block, 0);
+      end[d] = std::min((end[d] + block - 1) / block * block, stack_size[d]);
+    }
+  }
+
+  /// The coarsest level whose voxels are no larger than size (in voxels of level 0)
+  unsigned int levelForSize(Real size) const
+  {
+    if (!(size > 1))
+      return 0;
+    const auto level = static_cast<unsigned int>(std::floor(std::log2(size)));
+    return std::min<unsigned int>(level, _levels.size() - 1);
+  }
+
+  /// Whether the box contains the level 0 voxel of global index ijk
+  bool contains(const std::array<int, 3> & ijk) const
+  {
+    const auto & fine = _levels[0];
+    for (unsigned int d = 0; d < 3; ++d)
+      if (ijk[d] < fine.begin[d] || ijk[d] >= fine.begin[d] + fine.size[d])
+        return false;
+    return true;
+  }
+
+  /**
+   * The value at the level 0 voxel of global index ijk, from the given level (the coarse voxel
+   * covering it); indices outside the box are clamped to it
+   */
+  float value(const std::array<int, 3> & ijk, unsigned int level = 0) const
+  {
+    mooseAssert(level < _levels.size(), "Image pyramid level out of range");
+    const auto & fine = _levels[0];
+    const auto & l = _levels[level];
+    std::array<int, 3> local;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      const int i = std::min(std::max(ijk[d], fine.begin[d]), fine.begin[d] + fine.size[d] - 1);
+      local[d] = (i >> level) - l.begin[d];
+    }
+    return l.values[(std::size_t(local[2]) * l.size[1] + local[1]) * l.size[0] + local[0]];
+  }
+
+  /// The memory held by all the levels, in bytes
+  std::size_t memory() const
+  {
+    std::size_t bytes = 0;
+    for (const auto & l : _levels)
+      bytes += l.values.size() * sizeof(float);
+    return bytes;
+  }
+
+private:
+  struct Level
+  {
+    /// The global index of the first voxel of the level (in voxels of the level)
+    std::array<int, 3> begin;
+    std::array<int, 3> size;
+    std::vector<float> values;
+  };
+
+  /**
+   * Averages the globally aligned blocks of 2 x 2 x 2 voxels of fine: coarse voxel I covers the
+   * fine voxels 2 I and 2 I + 1, of which those outside the fine box are left out
+   */
+  static void coarsen(const Level & fine, Level & coarse)
+  {
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      coarse.begin[d] = fine.begin[d] >> 1;
+      coarse.size[d] = ((fine.begin[d] + fine.size[d] - 1) >> 1) + 1 - coarse.begin[d];
+    }
+    coarse.values.assign(std::size_t(coarse.size[0]) * coarse.size[1] * coarse.size[2], 0.0f);
+
+    // The local fine range [first, last) of the coarse voxel of local index i in direction d
+    const auto first = [&](unsigned int d, int i) {
+      return std::max(2 * (coarse.begin[d] + i) - fine.begin[d], 0);
+    };
+    const auto last = [&](unsigned int d, int i) {
+      return std::min(2 * (coarse.begin[d] + i) + 2 - fine.begin[d], fine.size[d]);
+    };
+
+    for (int k = 0; k < coarse.size[2]; ++k)
+      for (int j = 0; j < coarse.size[1]; ++j)
+        for (int i = 0; i < coarse.size[0]; ++i)
+        {
+          float sum = 0;
+          unsigned int count = 0;
+          for (int c = first(2, k); c < last(2, k); ++c)
+            for (int b = first(1, j); b < last(1, j); ++b)
+              for (int a = first(0, i); a < last(0, i); ++a)
+              {
+                sum += fine.values[(std::size_t(c) * fine.size[1] + b) * fine.size[0] + a];
+                ++count;
+              }
+          coarse.values[(std::size_t(k) * coarse.size[1] + j) * coarse.size[0] + i] = sum / count;
+        }
+  }
+
+  std::vector<Level> _levels;
+};
@@ -0,0 +1,100 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * Finds the interval of a sorted grid that brackets a value, for the table interpolations.
+ *
+ * A uniform grid (equal spacing up to round-off) is located in O(1) by division. Otherwise the
+ * caller passes a hint, the interval of its previous lookup: the quadrature points of an element
+ * or the successive times of a function usually fall in the same or an adjacent interval, which
+ * are checked before the binary search. The hint belongs to the caller (for instance a member of
+ * a per-thread object), so the locator itself is never modified by lookups and may be shared.
+ * The grid is passed to find() rather than referenced, so the owners of a locator stay copyable.
+ */
+class IntervalLocator
+{
+public:
+  IntervalLocator() = default;
+  IntervalLocator(const std::vector<Real> & x) { setGrid(x); }
+
+  /// Detects whether the (sorted) grid is uniform
+  void setGrid(const std::vector<Real> & x)
+  {
+    _uniform = false;
+    if (x.size() < 2)
+      return;
+    const Real dx = (x.back() - x.front()) / (x.size() - 1);
+    if (!(dx > 0))
+      return;
+    for (std::size_t i = 0; i + 1 < x.size(); ++i)
+      if (std::abs(x[i + 1] - x[i] - dx) > 1e-12 * std::abs(dx) * x.size())
+        return;
+    _uniform = true;
+    _x0 = x.front();
+    _inv_dx = 1.0 / dx;
+  }
+
+  bool uniform() const { return _uniform; }
+
+  /**
+   * The interval i of the grid with x[i] <= xi < x[i + 1], clamped to the first and last intervals
+   * outside the grid (and with xi == x.back() in the last interval)
+   * @param x The grid given to setGrid()
+   * @param hint The interval of the previous lookup, updated to this one
+   */
+  unsigned int find(const std::vector<Real> & x, Real xi, unsigned int & hint) const
+  {
+    const unsigned int last = x.size() < 2 ? 0 : x.size() - 2;
+    unsigned int i;
+    if (_uniform)
+    {
+      const Real s = (xi - _x0) * _inv_dx;
+      i = s <= 0 ? 0 : s >= last ? last : static_cast<unsigned int>(s);
+      // The division can land one interval off near a grid point
+      if (i < last && xi >= x[i + 1])
+        ++i;
+      else if (i > 0 && xi < x[i])
+        --i;
+    }
+    else if (hint <= last && inInterval(x, xi, hint, last))
+      i = hint;
+    else if (hint < last && inInterval(x, xi, hint + 1, last))
+      i = hint + 1;
+    else if (hint > 0 && hint <= last + 1 && inInterval(x, xi, hint - 1, last))
+      i = hint - 1;
+    else
+    {
+      const auto it = std::upper_bound(x.begin(), x.end(), xi);
+      const auto k = std::distance(x.begin(), it);
+      i = k <= 1 ? 0 : std::min<unsigned int>(k - 1, last);
+    }
+    hint = i;
+    return i;
+  }
+
+private:
+  /// Whether xi is in interval i, the first and last intervals extending to infinity
+  static bool
+  inInterval(const std::vector<Real> & x, Real xi, unsigned int i, unsigned int last)
+  {
+    return (i == 0 || xi >= x[i]) && (i == last || xi < x[i + 1]);
+  }
+
+  bool _uniform = false;
+  Real _x0 = 0;
+  Real _inv_dx = 0;
+};
@@ -0,0 +1,103 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+/**
+ * Decides when the Jacobian (and the preconditioner built from it) of the previous nonlinear
+ * solve can be reused instead of being assembled again, from the convergence history.
+ *
+ * The iteration counts of the solve that followed a fresh Jacobian are the reference. The
+ * Jacobian is then reused as long as the solves converge within nl_growth (linear_growth) times
+ * the reference nonlinear (linear) iteration count and at most max_reuses times; past that, or
+ * after a failed solve, it is assembled again and the counts of the next solve become the new
+ * reference.
+ */
+class JacobianReusePolicy
+{
+public:
+  /**
+   * @param nl_growth The allowed growth of the nonlinear iteration count
+   * @param linear_growth The allowed growth of the linear iteration count
+   * @param max_reuses The largest number of assemblies skipped in a row
+   */
+  JacobianReusePolicy(Real nl_growth, Real linear_growth, unsigned int max_reuses)
+    : _nl_growth(nl_growth), _linear_growth(linear_growth), _max_reuses(max_reuses)
+  {
+  }
+
+  /// Whether the next Jacobian computation may reuse the existing Jacobian
+  bool reuse() const { return !_stale && _reuses < _max_reuses; }
+
+  /// Records that a Jacobian computation was skipped
+  void reused()
+  {
+    ++_reuses;
+    ++_num_reuses;
+  }
+
+  /// Records that a Jacobian was assembled
+  void computed()
+  {
+    _stale = false;
+    _reuses = 0;
+    _fresh = true;
+    ++_num_computations;
+  }
+
+  /**
+   * Records the outcome of a nonlinear solve
+   * @param nl_its The number of nonlinear iterations
+   * @param linear_its The number of linear iterations
+   * @param converged Whether the solve converged
+   */
+  void solved(unsigned int nl_its, unsigned int linear_its, bool converged)
+  {
+    if (!converged)
+      _stale = true;
+    else if (_fresh)
+    {
+      _ref_nl_its = nl_its ? nl_its : 1;
+      _ref_linear_its = linear_its ? linear_its : 1;
+    }
+    else if (nl_its > _nl_growth * _ref_nl_its || linear_its > _linear_growth * _ref_linear_its)
+      _stale = true;
+    _fresh = false;
+  }
+
+  /// Forces the next computation to assemble the Jacobian, e.g. after a mesh change
+  void invalidate() { _stale = true; }
+
+  ///@{ Counters over the whole simulation
+  unsigned int numComputations() const { return _num_computations; }
+  unsigned int numReuses() const { return _num_reuses; }
+  ///@}
+
+private:
+  const Real _nl_growth;
+  const Real _linear_growth;
+  const unsigned int _max_reuses;
+
+  /// Whether the Jacobian must be assembled at the next computation
+  bool _stale = true;
+  /// Whether the current solve started from a fresh Jacobian
+  bool _fresh = false;
+  /// The number of assemblies skipped since the last one
+  unsigned int _reuses = 0;
+
+  ///@{ The iteration counts of the solve after the last assembly
+  unsigned int _ref_nl_its = 1;
+  unsigned int _ref_linear_its = 1;
+  ///@}
+
+  unsigned int _num_computations = 0;
+  unsigned int _num_reuses = 0;
+};
@@ -12,6 +12,9 @@
 #include "Moose.h"
 #include "MooseTypes.h"
 #include "DualReal.h"
+#include "IntervalLocator.h"
+
+#include "metaphysicl/raw_type.h"
 
 #include <vector>
 #include <string>
@@ -42,6 +45,7 @@ public:
     _x = X;
     _y = Y;
     errorCheck();
+    _locator.setGrid(_x);
   }
 
   void errorCheck();
@@ -59,6 +63,38 @@ public:
    */
   T sampleDerivative(const T & x) const;
 
+  /**
+   * sample() with the interval located from a hint, the interval of the previous lookup of the
+   * caller (see IntervalLocator); uniform grids are located in O(1)
+   */
+  T sample(const T & x, unsigned int & hint) const
+  {
+    const Real xr = MetaPhysicL::raw_value(x);
+    if (!_extrap && xr <= _x.front())
+      return _y.front();
+    if (!_extrap && xr >= _x.back())
+      return _y.back();
+    const unsigned int i = _locator.find(_x, xr, hint);
+    return _y[i] + (x - _x[i]) * (_y[i + 1] - _y[i]) / (_x[i + 1] - _x[i]);
+  }
+
+  /// sampleDerivative() with the interval located from a hint
+  T sampleDerivative(const T & x, unsigned int & hint) const
+  {
+    const Real xr = MetaPhysicL::raw_value(x);
+    if (!_extrap && (xr < _x.front() || xr >= _x.back()))
+      return 0;
+    const unsigned int i = _locator.find(_x, xr, hint);
+    return (_y[i + 1] - _y[i]) / (_x[i + 1] - _x[i]);
+  }
+
+  /// Samples n abscissas at once, the interval of each being the hint of the next
+  void sample(std::size_t n, const T * x, T * y, unsigned int & hint) const
+  {
+    for (std::size_t k = 0; k < n; ++k)
+      y[k] = sample(x[k], hint);
+  }
+
   /**
    * This function returns the size of the array holding the points, i.e. the number of sample
    * points
@@ -79,6 +115,9 @@ private:
 
   bool _extrap;
 
+  /// Locates the intervals of the hinted samples, set with the data
+  IntervalLocator _locator;
+
   static int _file_number;
 };
 
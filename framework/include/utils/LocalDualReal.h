@@ -0,0 +1,108 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "DualRealOps.h"
+#include "MooseError.h"
+
+#include "metaphysicl/dualnumberarray.h"
+#include "libmesh/dense_matrix.h"
+
+#include <vector>
+
+/**
+ * Dual number with a dense derivative array indexed by *local* element dof number rather than by
+ * global dof index.
+ *
+ * With the sparse AD configuration every ADReal operation has to search and merge the sorted
+ * index sets of its operands. For kernels whose element dof set is small and known up front
+ * (e.g. a single Lagrange variable on a first order element) all derivatives are structurally
+ * nonzero anyway, so a dense array is cheaper: every operation becomes a fixed-length loop
+ * over N entries that the compiler can vectorize. The local results are mapped back to global
+ * dofs once per residual entry with localDualToGlobal(), or added straight into the local
+ * Jacobian block with addLocalDualJacobianRow().
+ */
+template <std::size_t N>
+using LocalDualReal = DualNumber<Real, NumberArray<N, Real>>;
+
+namespace Moose
+{
+/**
+ * Interpolate a local dual number at a quadrature point from element dof values, seeding the
+ * derivative with respect to local dof j (shifted by offset, e.g. to stack several variables) with
+ * the value of shape function j
+ *
+ * @param dof_values The values of the variable at the element dofs
+ * @param phi The shape functions, indexed [j][qp]
+ * @param qp The quadrature point
+ * @param offset Offset of the first dof of this variable in the local derivative array
+ */
+template <std::size_t N, typename Phi>
+LocalDualReal<N>
+localDualInterpolate(const std::vector<Real> & dof_values,
+                     const Phi & phi,
+                     unsigned int qp,
+                     std::size_t offset = 0)
+{
+  mooseAssert(offset + dof_values.size() <= N,
+              "The local dual derivative array is too small for " << offset + dof_values.size()
+                                                                  << " dofs");
+
+  LocalDualReal<N> result = 0;
+  for (std::size_t j = 0; j < dof_values.size(); ++j)
+  {
+    result.value() += dof_values[j] * phi[j][qp];
+    result.derivatives()[offset + j] = phi[j][qp];
+  }
+  return result;
+}
+
+/**
+ * Convert a local dual number to a (global dof indexed) DualReal
+ *
+ * @param local The local dual number
+ * @param dof_indices The global dof index of each local derivative entry
+ * @param global The converted value
+ */
+template <std::size_t N>
+void
+localDualToGlobal(const LocalDualReal<N> & local,
+                  const std::vector<dof_id_type> & dof_indices,
+                  DualReal & global)
+{
+  mooseAssert(dof_indices.size() <= N, "More dof indices than local derivative entries");
+
+  global = local.value();
+  for (std::size_t j = 0; j < dof_indices.size(); ++j)
+    if (local.derivatives()[j] != 0)
+      derivInsert(global.derivatives(), dof_indices[j], local.derivatives()[j]);
+}
+
+/**
+ * Add the derivatives of a local residual entry as row i of a local Jacobian block
+ *
+ * @param residual The residual for local test function i
+ * @param ke The local Jacobian block, whose columns are the local dofs
+ * @param i The row of the block
+ * @param offset Offset of the first column dof of the block in the local derivative array
+ */
+template <std::size_t N>
+void
+addLocalDualJacobianRow(const LocalDualReal<N> & residual,
+                        DenseMatrix<Number> & ke,
+                        unsigned int i,
+                        std::size_t offset = 0)
+{
+  mooseAssert(offset + ke.n() <= N, "Jacobian block exceeds the local derivative array");
+
+  for (unsigned int j = 0; j < ke.n(); ++j)
+    ke(i, j) += residual.derivatives()[offset + j];
+}
+}
@@ -12,6 +12,14 @@
 #include "Moose.h"
 #include "MooseEnum.h"
 
+#include <map>
+#include <ostream>
+#include <set>
+#include <streambuf>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace MemoryUtils
 {
 
@@ -48,5 +56,87 @@ void getMemoryStats(Stats & stats);
 /// convert bytes to selected unit prefix
 std::size_t convertBytes(std::size_t bytes, MemUnits unit);
 
+///@{
+/**
+ * Estimates of the heap memory held by a container itself, not counting the memory its elements
+ * own: the capacity of contiguous containers, and the elements plus the usual node (three
+ * pointers and the color) and bucket overheads of the others.
+ */
+template <typename T, typename A>
+std::size_t
+containerBytes(const std::vector<T, A> & container)
+{
+  return container.capacity() * sizeof(T);
+}
+
+template <typename K, typename V, typename C, typename A>
+std::size_t
+containerBytes(const std::map<K, V, C, A> & container)
+{
+  return container.size() * (sizeof(std::pair<const K, V>) + 4 * sizeof(void *));
+}
+
+template <typename K, typename C, typename A>
+std::size_t
+containerBytes(const std::set<K, C, A> & container)
+{
+  return container.size() * (sizeof(K) + 4 * sizeof(void *));
+}
+
+template <typename K, typename V, typename H, typename E, typename A>
+std::size_t
+containerBytes(const std::unordered_map<K, V, H, E, A> & container)
+{
+  return container.size() * (sizeof(std::pair<const K, V>) + 2 * sizeof(void *)) +
+         container.bucket_count() * sizeof(void *);
+}
+
+template <typename K, typename H, typename E, typename A>
+std::size_t
+containerBytes(const std::unordered_set<K, H, E, A> & container)
+{
+  return container.size() * (sizeof(K) + 2 * sizeof(void *)) +
+         container.bucket_count() * sizeof(void *);
+}
+///@}
+
+/**
+ * An output stream that only counts the bytes written to it, to measure the size of data that is
+ * not held in a container, through its serialization (e.g. RestartableDataValue::store()).
+ */
+class ByteCountingStream : public std::ostream
+{
+public:
+  ByteCountingStream() : std::ostream(&_counter) {}
+
+  /// The number of bytes written so far
+  std::size_t bytes() const { return _counter.bytes(); }
+
+private:
+  class Counter : public std::streambuf
+  {
+  public:
+    std::size_t bytes() const { return _bytes; }
+
+  protected:
+    virtual std::streamsize xsputn(const char *, std::streamsize n) override
+    {
+      _bytes += n;
+      return n;
+    }
+    virtual int_type overflow(int_type c) override
+    {
+      if (!traits_type::eq_int_type(c, traits_type::eof()))
+        ++_bytes;
+      return traits_type::not_eof(c);
+    }
+
+  private:
+    std::size_t _bytes = 0;
+  };
+
+  Counter _counter;
+};
+
 } // namespace MemoryUtils
 
@@ -9,9 +9,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "MooseError.h"
 
+namespace Moose
+{
+/// The number of buffer allocations of all the MooseArrays, for the statistics of the assembly
+/// loops (see NumMooseArrayAllocations)
+inline std::atomic<unsigned long> &
+mooseArrayAllocations()
+{
+  static std::atomic<unsigned long> allocations{0};
+  return allocations;
+}
+}
+
 template <typename T>
 class MooseArray
 {
@@ -113,6 +126,18 @@ public:
    */
   void resize(unsigned int size, const T & default_value);
 
+  /**
+   * Makes the array able to hold \p capacity elements without allocating, keeping its size and
+   * contents. Reserving the largest size an array will see (e.g. the largest quadrature rule)
+   * avoids the allocation of each growth past the previous largest size.
+   */
+  void reserve(unsigned int capacity);
+
+  /**
+   * The number of elements the array can hold without allocating
+   */
+  unsigned int capacity() const { return _allocated_size; }
+
   /**
    * The number of elements that can currently
    * be stored in the array.
@@ -234,6 +259,7 @@ MooseArray<T>::resize(unsigned int size)
     else
       _data_ptr.reset(new T[size]);
     mooseAssert(_data_ptr, "Failed to allocate MooseArray memory!");
+    ++Moose::mooseArrayAllocations();
 
     _data = _data_ptr.get();
     _allocated_size = size;
@@ -249,6 +275,7 @@ MooseArray<T>::resize(unsigned int size, const T & default_value)
   {
     T * new_pointer = new T[size];
     mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
+    ++Moose::mooseArrayAllocations();
 
     if (_data)
       for (unsigned int i = 0; i < _size; i++)
@@ -265,6 +292,25 @@ MooseArray<T>::resize(unsigned int size, const T & default_value)
   _size = size;
 }
 
+template <typename T>
+inline void
+MooseArray<T>::reserve(unsigned int capacity)
+{
+  if (capacity <= _allocated_size)
+    return;
+
+  T * new_pointer = new T[capacity]();
+  mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
+  ++Moose::mooseArrayAllocations();
+
+  for (unsigned int i = 0; i < _size; i++)
+    new_pointer[i] = _data[i];
+
+  _data_ptr.reset(new_pointer);
+  _data = _data_ptr.get();
+  _allocated_size = capacity;
+}
+
 template <typename T>
 inline unsigned int
 MooseArray<T>::size() const
@@ -10,6 +10,8 @@
 #pragma once
 
 #include <functional>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 #include <utility>
 
@@ -42,6 +44,21 @@ hash_combine(std::size_t & seed, const std::vector<T> & v, Rest &&... rest)
     hash_combine(seed, val);
   hash_combine(seed, std::forward<Rest>(rest)...);
 }
+
+/// Combines the hashes of the elements I and following of a tuple into seed.
+template <std::size_t I, typename... T>
+inline typename std::enable_if<I == sizeof...(T)>::type
+hash_combine_tuple(std::size_t & /*seed*/, const std::tuple<T...> & /*tup*/)
+{
+}
+
+template <std::size_t I, typename... T>
+inline typename std::enable_if<(I < sizeof...(T))>::type
+hash_combine_tuple(std::size_t & seed, const std::tuple<T...> & tup)
+{
+  hash_combine(seed, std::get<I>(tup));
+  hash_combine_tuple<I + 1>(seed, tup);
+}
 }
 
 namespace std
@@ -57,4 +74,17 @@ struct hash<std::pair<S, T>>
     return seed;
   }
 };
+
+/// This template specialization allows tuples (e.g. the keys of TheWarehouse::QueryCache) to be
+/// used as unordered map keys.
+template <typename... T>
+struct hash<std::tuple<T...>>
+{
+  inline size_t operator()(const std::tuple<T...> & val) const
+  {
+    size_t seed = 0;
+    Moose::hash_combine_tuple<0>(seed, val);
+    return seed;
+  }
+};
 }
@@ -14,6 +14,8 @@
 #include "ADRankTwoTensorForward.h"
 #include "ADRankThreeTensorForward.h"
 #include "ADRankFourTensorForward.h"
+#include "SymmetricRankTwoTensorForward.h"
+#include "SymmetricRankFourTensorForward.h"
 
 #include "libmesh/libmesh.h"
 #include "libmesh/id_types.h"
@@ -435,6 +437,10 @@ using GenericRankThreeTensor = typename Moose::GenericType<RankThreeTensor, is_a
 template <bool is_ad>
 using GenericRankFourTensor = typename Moose::GenericType<RankFourTensor, is_ad>;
 template <bool is_ad>
+using GenericSymmetricRankTwoTensor = typename Moose::GenericType<SymmetricRankTwoTensor, is_ad>;
+template <bool is_ad>
+using GenericSymmetricRankFourTensor = typename Moose::GenericType<SymmetricRankFourTensor, is_ad>;
+template <bool is_ad>
 using GenericVariableValue = typename Moose::GenericType<VariableValue, is_ad>;
 template <bool is_ad>
 using GenericVariableGradient = typename Moose::GenericType<VariableGradient, is_ad>;
@@ -551,7 +557,9 @@ enum CouplingType
 {
   COUPLING_DIAG,
   COUPLING_FULL,
-  COUPLING_CUSTOM
+  COUPLING_CUSTOM,
+  /// Only the blocks the residual objects couple, see FEProblemBase::setDeclaredCouplingMatrix()
+  COUPLING_DECLARED
 };
 
 enum ConstraintSideType
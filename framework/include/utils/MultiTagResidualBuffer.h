@@ -0,0 +1,166 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/parallel_sync.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+/**
+ * Accumulates the residual contributions to several tagged vectors at once, so that all of them
+ * are assembled with a single exchange of the off-processor contributions instead of one
+ * zero/close (VecAssemblyBegin/End) per tagged vector.
+ *
+ * The contributions to locally owned dofs go straight to dense arrays of the local part of every
+ * tag; the others are packed, whatever their tag, per owning processor. exchange() sends them all
+ * in one round, after which the local arrays hold the complete local parts of the vectors: they
+ * can be set into the vectors without off-processor insertions, i.e. with a close() that does no
+ * communication (VEC_IGNORE_OFF_PROC_ENTRIES).
+ *
+ * One buffer is used per thread; join() merges them before the exchange.
+ */
+class MultiTagResidualBuffer
+{
+public:
+  /**
+   * Sets up the buffer for a residual evaluation, with zero contributions
+   * @param tags The tags accumulated
+   * @param proc_first_dofs The first dof of every processor, plus the total number of dofs
+   *                        (DofMap::first_dof() of each processor, then DofMap::n_dofs())
+   * @param pid This processor
+   */
+  void reset(const std::vector<TagID> & tags,
+             const std::vector<dof_id_type> & proc_first_dofs,
+             processor_id_type pid)
+  {
+    mooseAssert(std::size_t(pid) + 1 < proc_first_dofs.size(), "Missing processor dof offsets");
+    _tags = tags;
+    _slots.clear();
+    for (unsigned int s = 0; s < _tags.size(); ++s)
+      _slots[_tags[s]] = s;
+    _proc_first_dofs = proc_first_dofs;
+    _first_local_dof = proc_first_dofs[pid];
+    _n_local_dofs = proc_first_dofs[pid + 1] - _first_local_dof;
+    _local.resize(_tags.size());
+    for (auto & values : _local)
+      values.assign(_n_local_dofs, 0);
+    _remote.clear();
+  }
+
+  /// The tags accumulated, in slot order
+  const std::vector<TagID> & tags() const { return _tags; }
+
+  /// Whether a tag is accumulated
+  bool hasTag(TagID tag) const { return _slots.count(tag); }
+
+  /// Adds a contribution to the vector of a tag
+  void add(TagID tag, dof_id_type dof, Real value)
+  {
+    const auto it = _slots.find(tag);
+    mooseAssert(it != _slots.end(), "Tag " << tag << " is not accumulated");
+    addToSlot(it->second, dof, value);
+  }
+
+  /// Adds contributions to the vector of a tag
+  void add(TagID tag, const std::vector<dof_id_type> & dofs, const std::vector<Real> & values)
+  {
+    mooseAssert(dofs.size() == values.size(), "Mismatched dofs and values");
+    const auto it = _slots.find(tag);
+    mooseAssert(it != _slots.end(), "Tag " << tag << " is not accumulated");
+    for (std::size_t i = 0; i < dofs.size(); ++i)
+      addToSlot(it->second, dofs[i], values[i]);
+  }
+
+  /// Merges the contributions of another buffer set up the same way
+  void join(const MultiTagResidualBuffer & other)
+  {
+    mooseAssert(other._tags == _tags && other._first_local_dof == _first_local_dof,
+                "Joining buffers of different layouts");
+    for (unsigned int s = 0; s < _local.size(); ++s)
+      for (dof_id_type i = 0; i < _n_local_dofs; ++i)
+        _local[s][i] += other._local[s][i];
+    for (const auto & pair : other._remote)
+    {
+      auto & entries = _remote[pair.first];
+      entries.insert(entries.end(), pair.second.begin(), pair.second.end());
+    }
+  }
+
+  /// Sends the off-processor contributions of all the tags to their owners in a single round
+  void exchange(const Parallel::Communicator & comm)
+  {
+    auto receive = [this](processor_id_type, const std::vector<Entry> & entries)
+    {
+      for (const auto & entry : entries)
+        addToSlot(entry.first.first, entry.first.second, entry.second);
+    };
+    Parallel::push_parallel_vector_data(comm, _remote, receive);
+    _remote.clear();
+  }
+
+  /// The accumulated local part of the vector of a tag, indexed by dof - firstLocalDof()
+  const std::vector<Real> & local(TagID tag) const
+  {
+    const auto it = _slots.find(tag);
+    if (it == _slots.end())
+      mooseError("Tag ", tag, " is not accumulated");
+    return _local[it->second];
+  }
+
+  dof_id_type firstLocalDof() const { return _first_local_dof; }
+  dof_id_type numLocalDofs() const { return _n_local_dofs; }
+
+  /// The number of contributions waiting for exchange()
+  std::size_t numRemote() const
+  {
+    std::size_t n = 0;
+    for (const auto & pair : _remote)
+      n += pair.second.size();
+    return n;
+  }
+
+private:
+  /// An off-processor contribution: ((slot, dof), value)
+  typedef std::pair<std::pair<unsigned int, dof_id_type>, Real> Entry;
+
+  void addToSlot(unsigned int slot, dof_id_type dof, Real value)
+  {
+    if (dof >= _first_local_dof && dof - _first_local_dof < _n_local_dofs)
+      _local[slot][dof - _first_local_dof] += value;
+    else
+      _remote[owner(dof)].emplace_back(std::make_pair(slot, dof), value);
+  }
+
+  processor_id_type owner(dof_id_type dof) const
+  {
+    mooseAssert(dof < _proc_first_dofs.back(), "Dof " << dof << " out of range");
+    const auto it = std::upper_bound(_proc_first_dofs.begin(), _proc_first_dofs.end(), dof);
+    return it - _proc_first_dofs.begin() - 1;
+  }
+
+  std::vector<TagID> _tags;
+  std::map<TagID, unsigned int> _slots;
+
+  std::vector<dof_id_type> _proc_first_dofs;
+  dof_id_type _first_local_dof = 0;
+  dof_id_type _n_local_dofs = 0;
+
+  /// The local parts of the vectors, per slot
+  std::vector<std::vector<Real>> _local;
+
+  /// The off-processor contributions, per owning processor
+  std::map<processor_id_type, std::vector<Entry>> _remote;
+};
@@ -0,0 +1,109 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/**
+ * The interpolation (prolongation) matrix from a coarse level to the next finer level of a
+ * refinement hierarchy, in compressed sparse row form, built one fine dof at a time.
+ *
+ * The rows are found element by element: the value of a fine dof of a child element is the coarse
+ * solution of its parent evaluated at the dof, i.e. the parent shape functions at the dof location
+ * weight the parent dofs. A fine dof shared by several children gets the same row from each of
+ * them, so only the first one is kept. The rows of the fine dofs that also exist on the coarse
+ * level (the vertices of the parents, for Lagrange variables) are identity rows, which the parent
+ * shape functions give as well.
+ */
+class MultigridInterpolation
+{
+public:
+  /**
+   * @param n_fine The number of (local) fine dofs, i.e. of rows
+   * @param n_coarse The number of coarse dofs, i.e. of columns
+   */
+  void reset(std::size_t n_fine, std::size_t n_coarse)
+  {
+    _n_coarse = n_coarse;
+    _rows.assign(n_fine, {});
+    _set.assign(n_fine, false);
+  }
+
+  /// Whether the row of a fine dof is known already (the dofs shared by children)
+  bool hasRow(std::size_t fine) const { return _set[fine]; }
+
+  /**
+   * Sets the row of a fine dof, unless it is set already; the weights below tolerance (the
+   * parent shape functions that vanish at the dof) are dropped
+   */
+  void setRow(std::size_t fine,
+              const std::vector<std::pair<std::size_t, Real>> & weights,
+              Real tolerance = 1e-12)
+  {
+    mooseAssert(fine < _rows.size(), "Fine dof out of range");
+    if (_set[fine])
+      return;
+    auto & row = _rows[fine];
+    for (const auto & w : weights)
+    {
+      mooseAssert(w.first < _n_coarse, "Coarse dof out of range");
+      if (std::abs(w.second) > tolerance)
+        row.push_back(w);
+    }
+    _set[fine] = true;
+  }
+
+  /// Whether every fine dof has a row
+  bool complete() const
+  {
+    for (const bool set : _set)
+      if (!set)
+        return false;
+    return true;
+  }
+
+  /**
+   * The matrix in compressed sparse row form, e.g. for MatCreateSeqAIJWithArrays() or
+   * MatMPIAIJSetPreallocationCSR()
+   */
+  template <typename Index>
+  void csr(std::vector<Index> & row_offsets,
+           std::vector<Index> & columns,
+           std::vector<Real> & values) const
+  {
+    if (!complete())
+      mooseError("The multigrid interpolation has fine dofs without a row");
+    row_offsets.assign(1, 0);
+    columns.clear();
+    values.clear();
+    for (const auto & row : _rows)
+    {
+      for (const auto & w : row)
+      {
+        columns.push_back(w.first);
+        values.push_back(w.second);
+      }
+      row_offsets.push_back(columns.size());
+    }
+  }
+
+  std::size_t numFine() const { return _rows.size(); }
+  std::size_t numCoarse() const { return _n_coarse; }
+
+private:
+  std::size_t _n_coarse = 0;
+  std::vector<std::vector<std::pair<std::size_t, Real>>> _rows;
+  std::vector<bool> _set;
+};
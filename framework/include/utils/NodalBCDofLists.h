@@ -0,0 +1,157 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace libMesh
+{
+class Node;
+}
+
+/**
+ * The local boundary nodes and dofs of every nodal BC, stored contiguously and built once per
+ * mesh change, so that applying the BCs is a walk over flat arrays instead of a search of the
+ * boundary node list and of the warehouses at every node.
+ *
+ * The entries of a BC are added with add() (the BCs numbered 0, 1, ... by the caller), then
+ * finalize() groups them by BC. The dofs of the Dirichlet BCs that apply at an evaluation (see
+ * zeroRows()) can then be zeroed with a single MatZeroRows() call, and the residuals of a BC set
+ * with a single insertion.
+ *
+ * The lists hold every boundary node of a BC: whether the BC applies at a node
+ * (BoundaryCondition::shouldApply()) may change between evaluations and is therefore left to the
+ * loops walking the lists.
+ */
+class NodalBCDofLists
+{
+public:
+  /// Forgets all the entries
+  void clear()
+  {
+    _entries.clear();
+    _offsets.clear();
+    _nodes.clear();
+    _dofs.clear();
+    _dirichlet.clear();
+    _finalized = false;
+  }
+
+  /**
+   * Records a dof a BC applies to
+   * @param bc The index of the BC
+   * @param node The boundary node
+   * @param dof The dof of the variable of the BC on the node
+   * @param dirichlet Whether the BC replaces the equation of the dof (its row is zeroed)
+   */
+  void add(unsigned int bc, const Node * node, dof_id_type dof, bool dirichlet)
+  {
+    mooseAssert(!_finalized, "Entries added to finalized NodalBCDofLists");
+    _entries.push_back({bc, node, dof});
+    if (bc >= _dirichlet.size())
+      _dirichlet.resize(bc + 1, false);
+    if (dirichlet)
+      _dirichlet[bc] = true;
+  }
+
+  /// Groups the entries by BC (keeping their order within a BC)
+  void finalize()
+  {
+    const unsigned int n_bcs = _dirichlet.size();
+    _offsets.assign(n_bcs + 1, 0);
+    for (const auto & entry : _entries)
+      ++_offsets[entry.bc + 1];
+    for (unsigned int bc = 0; bc < n_bcs; ++bc)
+      _offsets[bc + 1] += _offsets[bc];
+
+    _nodes.resize(_entries.size());
+    _dofs.resize(_entries.size());
+    auto next = _offsets;
+    for (const auto & entry : _entries)
+    {
+      const auto i = next[entry.bc]++;
+      _nodes[i] = entry.node;
+      _dofs[i] = entry.dof;
+    }
+    _entries.clear();
+    _entries.shrink_to_fit();
+    _finalized = true;
+  }
+
+  bool finalized() const { return _finalized; }
+
+  /// The number of BCs
+  unsigned int numBCs() const { return _dirichlet.size(); }
+
+  /// The number of dofs of a BC
+  std::size_t size(unsigned int bc) const { return _offsets[bc + 1] - _offsets[bc]; }
+
+  ///@{ The nodes and dofs of a BC, in matching order
+  const Node * const * nodesBegin(unsigned int bc) const { return _nodes.data() + _offsets[bc]; }
+  const Node * const * nodesEnd(unsigned int bc) const { return _nodes.data() + _offsets[bc + 1]; }
+  const dof_id_type * dofsBegin(unsigned int bc) const { return _dofs.data() + _offsets[bc]; }
+  const dof_id_type * dofsEnd(unsigned int bc) const { return _dofs.data() + _offsets[bc + 1]; }
+  ///@}
+
+  /// The dofs of a BC as a vector, e.g. for NumericVector::insert()
+  std::vector<dof_id_type> dofs(unsigned int bc) const
+  {
+    return std::vector<dof_id_type>(dofsBegin(bc), dofsEnd(bc));
+  }
+
+  /// Whether a BC replaces the equations of its dofs
+  bool dirichlet(unsigned int bc) const { return _dirichlet[bc]; }
+
+  /**
+   * The sorted, unique dofs of the Dirichlet BCs at the nodes where they apply: the Jacobian rows
+   * to zero
+   * @param applies applies(bc, node) is whether the BC applies at the node, e.g. its
+   *        shouldApply() once the node is reinited
+   * @param[out] rows The rows to zero
+   */
+  template <typename Applies>
+  void zeroRows(const Applies & applies, std::vector<dof_id_type> & rows) const
+  {
+    rows.clear();
+    for (unsigned int bc = 0; bc < numBCs(); ++bc)
+      if (_dirichlet[bc])
+        for (std::size_t i = _offsets[bc]; i < _offsets[bc + 1]; ++i)
+          if (applies(bc, _nodes[i]))
+            rows.push_back(_dofs[i]);
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+  }
+
+private:
+  struct Entry
+  {
+    unsigned int bc;
+    const Node * node;
+    dof_id_type dof;
+  };
+
+  /// The entries in the order they were added, until finalize()
+  std::vector<Entry> _entries;
+
+  /// The offsets of the entries of each BC in _nodes and _dofs
+  std::vector<std::size_t> _offsets;
+
+  std::vector<const Node *> _nodes;
+  std::vector<dof_id_type> _dofs;
+
+  /// Whether each BC is a Dirichlet BC
+  std::vector<bool> _dirichlet;
+
+  bool _finalized = false;
+};
@@ -0,0 +1,82 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * The interpolation of one variable from the source mesh onto the oversampled mesh, as a sparse
+ * matrix: the value of each oversampled dof is a weighted sum of source dofs. The weights are the
+ * shape functions of the source element containing the oversampled node evaluated at its
+ * reference coordinates, found once per mesh change by the point locator; every output is then a
+ * plain sparse product, instead of a point location per node and variable.
+ */
+class OversampleInterpolation
+{
+public:
+  /// Forgets all the rows
+  void clear()
+  {
+    _targets.clear();
+    _offsets.assign(1, 0);
+    _sources.clear();
+    _weights.clear();
+  }
+
+  /**
+   * Adds the row of an oversampled dof
+   * @param target The dof on the oversampled mesh
+   * @param sources The dofs of the source element
+   * @param weights The source shape functions at the oversampled node, one per source dof
+   */
+  void addRow(dof_id_type target,
+              const std::vector<dof_id_type> & sources,
+              const std::vector<Real> & weights)
+  {
+    mooseAssert(sources.size() == weights.size(), "Mismatched sources and weights");
+    _targets.push_back(target);
+    _sources.insert(_sources.end(), sources.begin(), sources.end());
+    _weights.insert(_weights.end(), weights.begin(), weights.end());
+    _offsets.push_back(_sources.size());
+  }
+
+  /// The number of rows
+  std::size_t size() const { return _targets.size(); }
+
+  /// The oversampled dofs, in the order of the values of apply()
+  const std::vector<dof_id_type> & targets() const { return _targets; }
+
+  /**
+   * Computes the oversampled values
+   * @param source The (serialized) source solution, indexed by dof
+   * @param values The values of the targets(), e.g. for NumericVector::insert()
+   */
+  template <typename Vector>
+  void apply(const Vector & source, std::vector<Number> & values) const
+  {
+    values.resize(_targets.size());
+    for (std::size_t r = 0; r < _targets.size(); ++r)
+    {
+      Number value = 0;
+      for (std::size_t k = _offsets[r]; k < _offsets[r + 1]; ++k)
+        value += _weights[k] * source[_sources[k]];
+      values[r] = value;
+    }
+  }
+
+private:
+  std::vector<dof_id_type> _targets;
+  std::vector<std::size_t> _offsets = {0};
+  std::vector<dof_id_type> _sources;
+  std::vector<Real> _weights;
+};
@@ -0,0 +1,182 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+#include "PerfNode.h"
+
+#include <chrono>
+#include <vector>
+
+/**
+ * Fixed-size ring buffer of section enter/exit events for the sampling mode of the PerfGraph.
+ *
+ * Each thread owns exactly one ring, so recording an event is a plain store and an index
+ * increment: no locks, no atomics and no map lookups. Only every sampling_interval-th call of
+ * each section is recorded; the recorded events are replayed into the PerfGraph tree by
+ * PerfGraph::mergeSampledEvents() when the timing is needed (i.e. at output time), with the
+ * times and call counts scaled by the interval.
+ *
+ * The ring keeps the stack of the sections open on its thread, recorded or not. When a sampled
+ * call is entered below sections that were not recorded, those sections are recorded first as
+ * path events, which carry no time or calls: the replay places the sampled call under its actual
+ * parents instead of under the innermost recorded one.
+ *
+ * When more events are recorded between two merges than fit in the ring the oldest ones are
+ * overwritten; exits whose enter was lost are skipped during the replay.
+ */
+class PerfEventRing
+{
+public:
+  /**
+   * @param capacity The number of events the ring holds
+   * @param sampling_interval Record one out of this many calls of each section
+   */
+  PerfEventRing(std::size_t capacity, unsigned int sampling_interval)
+    : _events(capacity ? capacity : 1),
+      _head(0),
+      _sampling_interval(sampling_interval ? sampling_interval : 1)
+  {
+  }
+
+  /**
+   * Enter a section, recording the call if it is sampled. Must be followed by a matching leave().
+   */
+  void enter(const PerfID id)
+  {
+    if (id >= _call_counts.size())
+      _call_counts.resize(id + 1, 0);
+
+    _stack.push_back(id);
+    if (_call_counts[id]++ % _sampling_interval)
+      return;
+
+    // Record the open sections that are not recorded yet so that the call keeps its parents
+    for (; _n_recorded + 1 < _stack.size(); ++_n_recorded)
+      record(_stack[_n_recorded], PATH_ENTER);
+
+    record(id, ENTER);
+    _sampled.resize(_stack.size());
+    _sampled.back() = true;
+    ++_n_recorded;
+  }
+
+  /// Leave the innermost open section
+  void leave()
+  {
+    mooseAssert(!_stack.empty(), "Leaving a section that was not entered");
+
+    if (_n_recorded == _stack.size())
+    {
+      record(_stack.back(), _sampled[_n_recorded - 1] ? EXIT : PATH_EXIT);
+      _sampled[_n_recorded - 1] = false;
+      --_n_recorded;
+    }
+    _stack.pop_back();
+  }
+
+  /**
+   * Replay the recorded events under the given node and drop them. Sections still open at the
+   * end of the recorded events are kept so that they can be completed by the next replay.
+   */
+  void replay(PerfNode & root)
+  {
+    const std::size_t n_events = _head < _events.size() ? _head : _events.size();
+    const std::size_t first = _head - n_events;
+
+    // Sections that were entered but not left during the previous replay
+    std::vector<PerfNode *> stack(1, &root);
+    for (const auto & open : _open)
+      stack.push_back(stack.back()->getChild(open));
+
+    for (std::size_t i = first; i < _head; ++i)
+    {
+      const auto & event = _events[i % _events.size()];
+      if (event.kind == ENTER || event.kind == PATH_ENTER)
+      {
+        auto node = stack.back()->getChild(event.id);
+        if (event.kind == ENTER)
+        {
+          node->setStartTime(event.time);
+          for (unsigned int c = 0; c < _sampling_interval; ++c)
+            node->incrementNumCalls();
+        }
+        stack.push_back(node);
+      }
+      else if (stack.size() > 1 && stack.back()->id() == event.id)
+      {
+        auto node = stack.back();
+        if (event.kind == EXIT)
+          node->addTime((event.time - node->startTime()) * _sampling_interval);
+        stack.pop_back();
+      }
+    }
+
+    _open.clear();
+    for (std::size_t i = 1; i < stack.size(); ++i)
+      _open.push_back(stack[i]->id());
+
+    _head = 0;
+  }
+
+  /// The sampling interval
+  unsigned int samplingInterval() const { return _sampling_interval; }
+
+private:
+  /// The kinds of recorded events; path events only place the sampled calls in the tree
+  enum Kind : unsigned char
+  {
+    ENTER,
+    EXIT,
+    PATH_ENTER,
+    PATH_EXIT
+  };
+
+  struct Event
+  {
+    std::chrono::steady_clock::time_point time;
+    PerfID id;
+    Kind kind;
+  };
+
+  void record(const PerfID id, const Kind kind)
+  {
+    auto & event = _events[_head % _events.size()];
+    event.time = std::chrono::steady_clock::now();
+    event.id = id;
+    event.kind = kind;
+    ++_head;
+  }
+
+  /// The event storage
+  std::vector<Event> _events;
+
+  /// Total number of events recorded since the last replay
+  std::size_t _head;
+
+  /// Record one out of this many calls of each section
+  const unsigned int _sampling_interval;
+
+  /// The number of calls of each section on this thread, indexed by PerfID
+  std::vector<unsigned long int> _call_counts;
+
+  /// The sections left open by the last replay, outermost first
+  std::vector<PerfID> _open;
+
+  /// The sections open on this thread, recorded or not, outermost first
+  std::vector<PerfID> _stack;
+
+  /// The number of outermost sections of _stack that are recorded (sampled or as path events)
+  std::size_t _n_recorded = 0;
+
+  /// Whether each of the recorded sections of _stack is a sampled call (or a path event)
+  std::vector<bool> _sampled;
+};
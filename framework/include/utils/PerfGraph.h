@@ -15,9 +15,19 @@
 #include "IndirectSort.h"
 #include "ConsoleStream.h"
 #include "MooseError.h"
+#include "PerfEventRing.h"
+#include "ThreadTimingTable.h"
+#include "HardwareCounters.h"
+
+#include "libmesh/threads.h"
 
 // System Includes
 #include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 // Forward Declarations
 class PerfGuard;
@@ -106,6 +116,77 @@ public:
    */
   void setActive(bool active) { _active = active; }
 
+  /**
+   * Switch to (or from, with sampling_interval = 0) the low-overhead sampling mode.
+   *
+   * In sampling mode PerfGuard does not push/pop the graph. Instead every thread records one out
+   * of sampling_interval calls of each section into its own PerfEventRing of ring_capacity
+   * events, and the events are merged into the graph by mergeSampledEvents(), which
+   * updateTiming() calls before the times are used. Sampled times and call counts are estimates
+   * scaled by the interval.
+   */
+  void setSampling(unsigned int sampling_interval, std::size_t ring_capacity = 1 << 16)
+  {
+    _sampling_interval = sampling_interval;
+    _sampling_ring_capacity = ring_capacity;
+  }
+
+  /**
+   * Whether or not the sampling mode is active
+   */
+  bool sampling() const { return _sampling_interval > 0; }
+
+  /**
+   * Replay the events recorded by every thread in sampling mode into the graph. Must not be
+   * called while sampled sections are being recorded on other threads.
+   */
+  void mergeSampledEvents()
+  {
+    libMesh::Threads::spin_mutex::scoped_lock lock(_sampling_mutex);
+    for (auto & pair : _sampling_rings)
+      pair.second->replay(*_root_node);
+  }
+
+  /**
+   * Turn on or off the per-thread timing of the threaded loops
+   */
+  void enableThreadTiming(bool enable)
+  {
+    if (enable && !_thread_timing)
+      _thread_timing = libmesh_make_unique<ThreadTimingTable>(libMesh::n_threads());
+    _thread_timing_enabled = enable;
+  }
+
+  /**
+   * The per-thread timing of the threaded loops, nullptr if it is not enabled
+   */
+  ThreadTimingTable * threadTiming()
+  {
+    return _thread_timing_enabled ? _thread_timing.get() : nullptr;
+  }
+
+  /**
+   * Count hardware events (cycles, instructions, cache misses, ...) in the given sections, or in
+   * every section if none are given, alongside their time. Not available in sampling mode.
+   *
+   * @param flop_event The raw event code to count as FLOPs, see HardwareCounters
+   */
+  void enableHardwareCounters(const std::vector<std::string> & sections,
+                              unsigned long long flop_event = 0)
+  {
+    _hardware_counters = libmesh_make_unique<HardwareCounterTable>(sections, flop_event);
+  }
+
+  /**
+   * The hardware counter totals, nullptr if hardware counting is not enabled
+   */
+  const HardwareCounterTable * hardwareCounters() const { return _hardware_counters.get(); }
+
+  /**
+   * Print the hardware counter totals of the counted sections
+   */
+  void printHardwareCounters(const ConsoleStream & console);
+
   /**
    * Get the number of calls for a section
    */
@@ -197,6 +278,34 @@ protected:
    */
   void pop();
 
+  /**
+   * The sampling ring of the calling thread, created on first use
+   *
+   * The rings are owned by the graph, one per thread id, so a thread that alternates between
+   * graphs (e.g. with MultiApps) finds its ring again. The last ring used is cached per thread
+   * under the serial number of its graph, which unlike its address is never reused.
+   *
+   * Note: only accessible by using PerfGuard!
+   */
+  PerfEventRing & threadRing()
+  {
+    thread_local PerfEventRing * ring = nullptr;
+    thread_local unsigned long long ring_graph = 0;
+
+    if (ring_graph != _serial)
+    {
+      libMesh::Threads::spin_mutex::scoped_lock lock(_sampling_mutex);
+      auto & thread_ring = _sampling_rings[std::this_thread::get_id()];
+      if (!thread_ring)
+        thread_ring =
+            libmesh_make_unique<PerfEventRing>(_sampling_ring_capacity, _sampling_interval);
+      ring = thread_ring.get();
+      ring_graph = _serial;
+    }
+
+    return *ring;
+  }
+
   /**
    * Helper for printing out the graph
    *
@@ -281,6 +390,50 @@ protected:
   /// Whether or not timing is active
   bool _active;
 
+  /// Record one out of this many calls of each section in sampling mode (0: sampling disabled)
+  unsigned int _sampling_interval = 0;
+
+  /// Number of events in each thread's sampling ring
+  std::size_t _sampling_ring_capacity = 1 << 16;
+
+  /// The sampling rings of every thread that recorded sampled events
+  std::unordered_map<std::thread::id, std::unique_ptr<PerfEventRing>> _sampling_rings;
+
+  /// The serial number of this graph (from 1), see threadRing()
+  const unsigned long long _serial = nextSerial();
+
+  static unsigned long long nextSerial()
+  {
+    static std::atomic<unsigned long long> serial(0);
+    return ++serial;
+  }
+
+  /// Protects _sampling_rings
+  libMesh::Threads::spin_mutex _sampling_mutex;
+
+  /// Whether or not the threaded loops record their per-thread time
+  bool _thread_timing_enabled = false;
+
+  /// Per-thread time of the threaded loops
+  std::unique_ptr<ThreadTimingTable> _thread_timing;
+
+  /// Hardware counter totals of the counted sections, if enabled
+  std::unique_ptr<HardwareCounterTable> _hardware_counters;
+
+  /**
+   * The hardware counter table if the section is counted, nullptr otherwise
+   */
+  HardwareCounterTable * countedSection(const PerfID id)
+  {
+    if (!_hardware_counters)
+      return nullptr;
+
+    if (!_hardware_counters->resolved(id))
+      _hardware_counters->resolve(id, sectionName(id));
+
+    return _hardware_counters->counted(id) ? _hardware_counters.get() : nullptr;
+  }
+
   // Here so PerfGuard is the only thing that can call push/pop
   friend class PerfGuard;
 };
@@ -30,15 +30,49 @@ public:
    * @param graph The graph to add time into
    * @param id The unique id of the section
    */
-  PerfGuard(PerfGraph & graph, const PerfID id) : _graph(graph) { _graph.push(id); }
+  PerfGuard(PerfGraph & graph, const PerfID id)
+    : _graph(graph),
+      _ring(graph.active() && graph.sampling() ? &graph.threadRing() : nullptr),
+      _id(id),
+      _counters(graph.active() && !_ring ? graph.countedSection(id) : nullptr)
+  {
+    if (_ring)
+      _ring->enter(id);
+    else
+      _graph.push(id);
+
+    if (_counters)
+      _counter_start = _counters->counters().read();
+  }
 
   /**
    * Stop timing
    */
-  ~PerfGuard() { _graph.pop(); }
+  ~PerfGuard()
+  {
+    if (_counters)
+      _counters->add(_id, _counter_start);
+
+    if (_ring)
+      _ring->leave();
+    else
+      _graph.pop();
+  }
 
 protected:
   ///The graph we're working on
   PerfGraph & _graph;
+
+  /// The calling thread's event ring when the graph is in sampling mode
+  PerfEventRing * const _ring;
+
+  /// The section being timed
+  const PerfID _id;
+
+  /// Where to add the hardware counts of this call, if the section is counted
+  HardwareCounterTable * const _counters;
+
+  /// The hardware counter values when the section was entered
+  HardwareCounters::Counts _counter_start;
 };
 
@@ -41,6 +41,11 @@ public:
     _start_time = time;
   }
 
+  /**
+   * Get the current start time
+   */
+  std::chrono::time_point<std::chrono::steady_clock> startTime() const { return _start_time; }
+
   /**
    * Add some time into this Node by taking the difference with the time passed in
    */
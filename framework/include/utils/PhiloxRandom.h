@@ -0,0 +1,108 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * The Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel random
+ * numbers: as easy as 1, 2, 3", SC11): the numbers are a keyed bijection of a counter, with no
+ * state. Keying by the seed and the time step and counting by entity id and index, every rank
+ * and thread draws the same number for the same quadrature point, independently of the
+ * partitioning and of the order of the element loops, and a whole block of numbers is a loop of
+ * independent evaluations.
+ */
+namespace PhiloxRandom
+{
+typedef std::array<std::uint32_t, 4> Counter;
+typedef std::array<std::uint32_t, 2> Key;
+
+/// The four 32-bit random words of a counter under a key
+inline Counter
+generate(Counter counter, Key key)
+{
+  for (unsigned int round = 0; round < 10; ++round)
+  {
+    const std::uint64_t product0 = std::uint64_t(0xD2511F53u) * counter[0];
+    const std::uint64_t product1 = std::uint64_t(0xCD9E8D57u) * counter[2];
+    counter = {std::uint32_t(product1 >> 32) ^ counter[1] ^ key[0],
+               std::uint32_t(product1),
+               std::uint32_t(product0 >> 32) ^ counter[3] ^ key[1],
+               std::uint32_t(product0)};
+    key[0] += 0x9E3779B9u;
+    key[1] += 0xBB67AE85u;
+  }
+  return counter;
+}
+
+/// The key of a stream: a seed and a step (e.g. the time step)
+inline Key
+key(unsigned int seed, int step)
+{
+  return {std::uint32_t(seed), std::uint32_t(step)};
+}
+
+/// The counter of the block \p block of an entity
+inline Counter
+counter(dof_id_type id, unsigned int block)
+{
+  const std::uint64_t id64 = id;
+  return {std::uint32_t(id64), std::uint32_t(id64 >> 32), std::uint32_t(block), 0};
+}
+
+/// A uniform real in (0, 1) from a random word: never 0, so its log is finite
+inline Real
+toUniform(std::uint32_t word)
+{
+  return (Real(word) + 0.5) * (1.0 / 4294967296.0);
+}
+
+/**
+ * Fills \p n uniform reals in (0, 1) for an entity, four per counter
+ * @param key The key of the stream
+ * @param id The id of the entity
+ * @param n The number of values
+ * @param values The values, at least n of them
+ */
+inline void
+uniform(const Key & key, dof_id_type id, unsigned int n, Real * values)
+{
+  for (unsigned int block = 0; block * 4 < n; ++block)
+  {
+    const auto words = generate(counter(id, block), key);
+    for (unsigned int j = 0; j < 4 && block * 4 + j < n; ++j)
+      values[block * 4 + j] = toUniform(words[j]);
+  }
+}
+
+/// Fills \p n standard normal reals for an entity, by Box-Muller pairs (see uniform())
+inline void
+normal(const Key & key, dof_id_type id, unsigned int n, Real * values)
+{
+  for (unsigned int block = 0; block * 4 < n; ++block)
+  {
+    const auto words = generate(counter(id, block), key);
+    for (unsigned int pair = 0; pair < 2; ++pair)
+    {
+      const Real r = std::sqrt(-2.0 * std::log(toUniform(words[2 * pair])));
+      const Real theta = 2.0 * libMesh::pi * toUniform(words[2 * pair + 1]);
+      const unsigned int i = block * 4 + 2 * pair;
+      if (i < n)
+        values[i] = r * std::cos(theta);
+      if (i + 1 < n)
+        values[i + 1] = r * std::sin(theta);
+    }
+  }
+}
+}
@@ -0,0 +1,129 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+#include "libmesh/threads.h"
+
+#include <functional>
+#include <set>
+#include <unordered_map>
+
+namespace libMesh
+{
+class Elem;
+}
+
+/**
+ * The element of a source mesh containing each query point, remembered from the first lookup of
+ * the point. The quadrature points and nodes of a target mesh that does not move are queried at
+ * every evaluation with exactly the same coordinates, so the point locator (a tree search per
+ * query) only runs on the first one.
+ *
+ * The points are keyed by their exact coordinates and by the subdomains the search is restricted
+ * to, since the same point may be located in different elements for different subdomains. Lookups
+ * take a mutex, as the functions and aux kernels of all the threads share the object holding the
+ * cache.
+ */
+class PointLocationCache
+{
+public:
+  /**
+   * The element containing a point, located by locate() the first time the point is seen with
+   * the same subdomains (locate may return nullptr for a point outside the mesh, which is
+   * remembered as well)
+   * @param p The point
+   * @param subdomain_ids The subdomains the search is restricted to, or nullptr for any
+   * @param locate Called with \p p and \p subdomain_ids when the point is not cached
+   */
+  template <typename Locate>
+  const Elem *
+  find(const Point & p, const std::set<subdomain_id_type> * subdomain_ids, const Locate & locate)
+  {
+    Key key{p, subdomain_ids != nullptr, {}};
+    if (subdomain_ids)
+      key.subdomain_ids = *subdomain_ids;
+
+    {
+      Threads::spin_mutex::scoped_lock lock(_mutex);
+      const auto it = _elems.find(key);
+      if (it != _elems.end())
+      {
+        ++_hits;
+        return it->second;
+      }
+    }
+    const Elem * elem = locate(p, subdomain_ids);
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _elems.emplace(std::move(key), elem);
+    return elem;
+  }
+
+  /// Forgets all the points, when the source or the target mesh changes
+  void clear()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _elems.clear();
+  }
+
+  std::size_t size() const
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _elems.size();
+  }
+
+  /// The number of lookups answered from the cache
+  unsigned long hits() const
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _hits;
+  }
+
+private:
+  /// A query: the point and the subdomains of the search, if restricted
+  struct Key
+  {
+    Point point;
+    bool restricted;
+    std::set<subdomain_id_type> subdomain_ids;
+
+    bool operator==(const Key & other) const
+    {
+      return point(0) == other.point(0) && point(1) == other.point(1) &&
+             point(2) == other.point(2) && restricted == other.restricted &&
+             subdomain_ids == other.subdomain_ids;
+    }
+  };
+
+  struct Hash
+  {
+    std::size_t operator()(const Key & key) const
+    {
+      std::size_t seed = key.restricted;
+      const auto combine = [&seed](std::size_t h) {
+        seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      };
+      for (unsigned int d = 0; d < 3; ++d)
+      {
+        const Real x = key.point(d) == 0 ? 0 : key.point(d); // -0 and 0 are the same point
+        combine(std::hash<Real>()(x));
+      }
+      for (const auto id : key.subdomain_ids)
+        combine(std::hash<subdomain_id_type>()(id));
+      return seed;
+    }
+  };
+
+  std::unordered_map<Key, const Elem *, Hash> _elems;
+  unsigned long _hits = 0;
+  mutable Threads::spin_mutex _mutex;
+};
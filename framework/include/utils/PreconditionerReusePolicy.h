@@ -0,0 +1,109 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+/**
+ * Decides when the preconditioner (and, for AMG, its hierarchy) built for a previous solve can
+ * be kept for the next one, the Jacobian itself being assembled as usual. This pays off when the
+ * same system is solved many times with slowly changing Jacobians: the Picard (fixed point)
+ * iterations of a sub-app, or the samples of a sampler multiapp.
+ *
+ * The linear iteration count of the first solve after a rebuild is the reference. The
+ * preconditioner is kept as long as the solves converge within linear_growth times that count,
+ * and at most max_reuses solves in a row; a failed or degraded solve, or (unless
+ * keep_across_time_steps) the beginning of a new time step, makes the next solve rebuild it.
+ */
+class PreconditionerReusePolicy
+{
+public:
+  /**
+   * @param linear_growth The allowed growth of the linear iteration count
+   * @param max_reuses The largest number of solves in a row keeping the preconditioner
+   * @param keep_across_time_steps Whether the preconditioner survives the end of a time step
+   */
+  PreconditionerReusePolicy(Real linear_growth,
+                            unsigned int max_reuses,
+                            bool keep_across_time_steps = false)
+    : _linear_growth(linear_growth),
+      _max_reuses(max_reuses),
+      _keep_across_time_steps(keep_across_time_steps)
+  {
+  }
+
+  /// Whether the next solve may keep the existing preconditioner
+  bool reuse() const { return !_stale && _reuses < _max_reuses; }
+
+  /// Records that a solve starts, keeping the preconditioner if reuse() or rebuilding it
+  void solveBegin()
+  {
+    _fresh = !reuse();
+    if (_fresh)
+    {
+      _stale = false;
+      _reuses = 0;
+      ++_num_builds;
+    }
+    else
+    {
+      ++_reuses;
+      ++_num_reuses;
+    }
+  }
+
+  /**
+   * Records the outcome of a solve
+   * @param linear_its The number of linear iterations (over all the nonlinear iterations)
+   * @param converged Whether the solve converged
+   */
+  void solved(unsigned int linear_its, bool converged)
+  {
+    if (!converged)
+      _stale = true;
+    else if (_fresh)
+      _ref_linear_its = linear_its ? linear_its : 1;
+    else if (linear_its > _linear_growth * _ref_linear_its)
+      _stale = true;
+    _fresh = false;
+  }
+
+  /// Records the beginning of a time step
+  void timestepSetup()
+  {
+    if (!_keep_across_time_steps)
+      _stale = true;
+  }
+
+  /// Forces the next solve to rebuild the preconditioner, e.g. after a mesh change
+  void invalidate() { _stale = true; }
+
+  ///@{ Counters over the whole simulation
+  unsigned int numBuilds() const { return _num_builds; }
+  unsigned int numReuses() const { return _num_reuses; }
+  ///@}
+
+private:
+  const Real _linear_growth;
+  const unsigned int _max_reuses;
+  const bool _keep_across_time_steps;
+
+  /// Whether the preconditioner must be rebuilt at the next solve
+  bool _stale = true;
+  /// Whether the current solve rebuilt the preconditioner
+  bool _fresh = false;
+  /// The number of solves that kept the preconditioner since it was built
+  unsigned int _reuses = 0;
+  /// The linear iteration count of the solve after the last rebuild
+  unsigned int _ref_linear_its = 1;
+
+  unsigned int _num_builds = 0;
+  unsigned int _num_reuses = 0;
+};
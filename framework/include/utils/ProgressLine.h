@@ -0,0 +1,102 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+/**
+ * Builds a compact one-line summary of every time step: the step, time and time step size, the
+ * nonlinear and linear iterations, the wall time per step and an estimate of the remaining wall
+ * time, e.g.
+ *
+ *   Step    12  t = 1.200e-01  dt = 1.000e-02  NL   4  L   37  2.31 s/step  ETA 0:12:31
+ *
+ * The wall times are supplied by the caller (the elapsed time of the root node of the PerfGraph),
+ * so nothing is measured here. The wall time per step is an exponential moving average; the
+ * remaining wall time is the remaining simulation time at the average rate since start().
+ */
+class ProgressLine
+{
+public:
+  /**
+   * @param wall The current wall time
+   * @param time The current simulation time
+   * @param end_time The end time of the simulation (infinite when unknown: no ETA)
+   */
+  void start(Real wall, Real time, Real end_time)
+  {
+    _start_wall = _last_wall = wall;
+    _start_time = time;
+    _end_time = end_time;
+    _wall_per_step = -1;
+  }
+
+  /**
+   * The summary of a step that just finished
+   * @param t_step The time step number
+   * @param time The simulation time at the end of the step
+   * @param dt The size of the step
+   * @param nl_its The nonlinear iterations of the step
+   * @param l_its The linear iterations of the step
+   * @param wall The current wall time
+   */
+  std::string step(
+      int t_step, Real time, Real dt, unsigned int nl_its, unsigned int l_its, Real wall)
+  {
+    const Real step_wall = wall - _last_wall;
+    _last_wall = wall;
+    _wall_per_step =
+        _wall_per_step < 0 ? step_wall : _smoothing * step_wall + (1 - _smoothing) * _wall_per_step;
+
+    char line[160];
+    std::snprintf(line,
+                  sizeof(line),
+                  "Step %5d  t = %.3e  dt = %.3e  NL %3u  L %4u  %.3g s/step",
+                  t_step,
+                  time,
+                  dt,
+                  nl_its,
+                  l_its,
+                  _wall_per_step);
+    std::string result(line);
+
+    const Real elapsed_time = time - _start_time;
+    if (std::isfinite(_end_time) && elapsed_time > 0)
+    {
+      const Real remaining = std::max(Real(0), _end_time - time);
+      result += "  ETA " + formatDuration(remaining * (wall - _start_wall) / elapsed_time);
+    }
+    return result;
+  }
+
+  /// Formats a number of seconds as h:mm:ss
+  static std::string formatDuration(Real seconds)
+  {
+    const long s = std::lround(std::max(Real(0), seconds));
+    char text[32];
+    std::snprintf(text, sizeof(text), "%ld:%02ld:%02ld", s / 3600, (s / 60) % 60, s % 60);
+    return text;
+  }
+
+private:
+  /// The weight of the last step in the moving average of the wall time per step
+  const Real _smoothing = 0.2;
+
+  Real _start_wall = 0;
+  Real _last_wall = 0;
+  Real _start_time = 0;
+  Real _end_time = 0;
+  Real _wall_per_step = -1;
+};
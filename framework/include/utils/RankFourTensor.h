@@ -95,6 +95,23 @@ public:
     orthotropic
   };
 
+  /**
+   * Structure of the entries that the products exploit to skip redundant work:
+   *   general: none assumed
+   *   minor: C_ijkl = C_jikl = C_ijlk
+   *   isotropic: C_ijkl = lambda de_ij de_kl + G (de_ik de_jl + de_il de_jk)
+   *
+   * It is recorded by the fill methods (and propagated by the arithmetic operators) rather than
+   * detected, and any write through the non-const operator() resets it to general, so it never
+   * claims more structure than the tensor has.
+   */
+  enum class Symmetry : unsigned char
+  {
+    general,
+    minor,
+    isotropic
+  };
+
   template <template <typename> class Tensor, typename Scalar>
   struct TwoTensorMultTraits
   {
@@ -141,6 +158,7 @@ public:
   /// Gets the value for the index specified.  Takes index = 0,1,2
   inline T & operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l)
   {
+    _symmetry = Symmetry::general;
     return _vals[((i * LIBMESH_DIM + j) * LIBMESH_DIM + k) * LIBMESH_DIM + l];
   }
 
@@ -156,6 +174,9 @@ public:
   /// Zeros out the tensor.
   void zero();
 
+  /// The recorded structure of the entries
+  Symmetry symmetry() const { return _symmetry; }
+
   /// Print the rank four tensor
   void print(std::ostream & stm = Moose::out) const;
 
@@ -312,6 +333,12 @@ protected:
   /// index=(((i * LIBMESH_DIM + j) * LIBMESH_DIM + k) * LIBMESH_DIM + l)
   T _vals[N4];
 
+  /// The recorded structure of _vals
+  Symmetry _symmetry = Symmetry::general;
+
+  /// The weaker of two symmetries, i.e. the symmetry of a sum
+  static Symmetry weakerSymmetry(const Symmetry a, const Symmetry b) { return a < b ? a : b; }
+
   /**
    * fillSymmetric9FromInputVector takes 9 inputs to fill in
    * the Rank-4 tensor with the appropriate crystal symmetries maintained. I.e., C_ijkl = C_klij,
@@ -432,6 +459,8 @@ protected:
   friend class RankFourTensorTempl;
   template <typename T2>
   friend class RankThreeTensorTempl;
+  template <typename T2>
+  friend class SymmetricRankFourTensorTempl;
 };
 
 namespace MetaPhysicL
@@ -467,6 +496,7 @@ operator*(const T1 & a, const RankFourTensorTempl<T2> & b) ->
 template <typename T>
 template <typename T2>
 RankFourTensorTempl<T>::RankFourTensorTempl(const RankFourTensorTempl<T2> & copy)
+  : _symmetry(static_cast<Symmetry>(copy._symmetry))
 {
   for (unsigned int i = 0; i < N4; ++i)
     _vals[i] = copy._vals[i];
@@ -484,6 +514,7 @@ RankFourTensorTempl<T>::operator*(const T2 & b) const ->
 
   for (unsigned int i = 0; i < N4; ++i)
     result._vals[i] = _vals[i] * b;
+  result._symmetry = static_cast<typename RankFourTensorTempl<ValueType>::Symmetry>(_symmetry);
 
   return result;
 }
@@ -495,8 +526,10 @@ RankFourTensorTempl<T>::operator/(const T2 & b) const ->
     typename std::enable_if<ScalarTraits<T2>::value,
                             RankFourTensorTempl<decltype(T() / T2())>>::type
 {
-  RankFourTensorTempl<decltype(T() / T2())> result;
+  typedef decltype(T() / T2()) ValueType;
+  RankFourTensorTempl<ValueType> result;
   for (unsigned int i = 0; i < N4; ++i)
     result._vals[i] = _vals[i] / b;
+  result._symmetry = static_cast<typename RankFourTensorTempl<ValueType>::Symmetry>(_symmetry);
   return result;
 }
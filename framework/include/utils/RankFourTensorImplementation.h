@@ -81,6 +81,7 @@ RankFourTensorTempl<T>::RankFourTensorTempl(const InitMethod init)
           for (unsigned int k = 0; k < N; ++k)
             for (unsigned int l = 0; l < N; ++l)
               _vals[index++] = 0.5 * Real(i == k && j == l) + 0.5 * Real(i == l && j == k);
+      _symmetry = Symmetry::isotropic;
       break;
 
     default:
@@ -100,6 +101,7 @@ RankFourTensorTempl<T>::zero()
 {
   for (unsigned int i = 0; i < N4; ++i)
     _vals[i] = 0.0;
+  _symmetry = Symmetry::general;
 }
 
 template <typename T>
@@ -108,6 +110,7 @@ RankFourTensorTempl<T>::operator=(const RankFourTensorTempl<T> & a)
 {
   for (unsigned int i = 0; i < N4; ++i)
     _vals[i] = a._vals[i];
+  _symmetry = a._symmetry;
   return *this;
 }
 
@@ -121,6 +124,42 @@ RankFourTensorTempl<T>::operator*(const Tensor<T2> & b) const ->
   typedef decltype(T() * T2()) ValueType;
   RankTwoTensorTempl<ValueType> result;
 
+  if (_symmetry == Symmetry::isotropic)
+  {
+    // lambda tr(b) de_ij + G (b_ij + b_ji)
+    const T & lambda = (*this)(0, 0, 1, 1);
+    const T & G = (*this)(0, 1, 0, 1);
+    const ValueType lambda_trace = lambda * (b(0, 0) + b(1, 1) + b(2, 2));
+    for (unsigned int i = 0; i < N; ++i)
+      for (unsigned int j = i; j < N; ++j)
+      {
+        const ValueType c = G * (b(i, j) + b(j, i)) + (i == j ? lambda_trace : ValueType(0));
+        result(i, j) = c;
+        result(j, i) = c;
+      }
+    return result;
+  }
+
+  if (_symmetry == Symmetry::minor)
+  {
+    // The result is symmetric, and the kl and lk columns of each row are equal
+    for (unsigned int i = 0; i < N; ++i)
+      for (unsigned int j = i; j < N; ++j)
+      {
+        const unsigned int ij1 = (i * N + j) * N2;
+        ValueType c = 0;
+        for (unsigned int k = 0; k < N; ++k)
+        {
+          c += _vals[ij1 + k * N + k] * b(k, k);
+          for (unsigned int l = k + 1; l < N; ++l)
+            c += _vals[ij1 + k * N + l] * (b(k, l) + b(l, k));
+        }
+        result(i, j) = c;
+        result(j, i) = c;
+      }
+    return result;
+  }
+
   unsigned int index = 0;
   for (unsigned int ij = 0; ij < N2; ++ij)
   {
@@ -157,6 +196,7 @@ RankFourTensorTempl<T>::operator+=(const RankFourTensorTempl<T> & a)
 {
   for (unsigned int i = 0; i < N4; ++i)
     _vals[i] += a._vals[i];
+  _symmetry = weakerSymmetry(_symmetry, a._symmetry);
   return *this;
 }
 
@@ -166,9 +206,12 @@ auto
 RankFourTensorTempl<T>::operator+(const RankFourTensorTempl<T2> & b) const
     -> RankFourTensorTempl<decltype(T() + T2())>
 {
-  RankFourTensorTempl<decltype(T() + T2())> result;
+  typedef decltype(T() + T2()) ValueType;
+  RankFourTensorTempl<ValueType> result;
   for (unsigned int i = 0; i < N4; ++i)
     result._vals[i] = _vals[i] + b._vals[i];
+  result._symmetry = static_cast<typename RankFourTensorTempl<ValueType>::Symmetry>(
+      weakerSymmetry(_symmetry, static_cast<Symmetry>(b._symmetry)));
   return result;
 }
 
@@ -178,6 +221,7 @@ RankFourTensorTempl<T>::operator-=(const RankFourTensorTempl<T> & a)
 {
   for (unsigned int i = 0; i < N4; ++i)
     _vals[i] -= a._vals[i];
+  _symmetry = weakerSymmetry(_symmetry, a._symmetry);
   return *this;
 }
 
@@ -187,9 +231,12 @@ auto
 RankFourTensorTempl<T>::operator-(const RankFourTensorTempl<T2> & b) const
     -> RankFourTensorTempl<decltype(T() - T2())>
 {
-  RankFourTensorTempl<decltype(T() - T2())> result;
+  typedef decltype(T() - T2()) ValueType;
+  RankFourTensorTempl<ValueType> result;
   for (unsigned int i = 0; i < N4; ++i)
     result._vals[i] = _vals[i] - b._vals[i];
+  result._symmetry = static_cast<typename RankFourTensorTempl<ValueType>::Symmetry>(
+      weakerSymmetry(_symmetry, static_cast<Symmetry>(b._symmetry)));
   return result;
 }
 
@@ -200,6 +247,7 @@ RankFourTensorTempl<T>::operator-() const
   RankFourTensorTempl<T> result;
   for (unsigned int i = 0; i < N4; ++i)
     result._vals[i] = -_vals[i];
+  result._symmetry = _symmetry;
   return result;
 }
 
@@ -212,6 +260,50 @@ RankFourTensorTempl<T>::operator*(const RankFourTensorTempl<T2> & b) const
   typedef decltype(T() * T2()) ValueType;
   RankFourTensorTempl<ValueType> result;
 
+  const auto b_symmetry = static_cast<Symmetry>(b._symmetry);
+
+  if (_symmetry == Symmetry::isotropic && b_symmetry == Symmetry::isotropic)
+  {
+    // With J = de_ij de_kl and S = de_ik de_jl + de_il de_jk: J J = 3 J, J S = S J = 2 J and
+    // S S = 2 S
+    const T & lambda_a = (*this)(0, 0, 1, 1);
+    const T & G_a = (*this)(0, 1, 0, 1);
+    const T2 & lambda_b = b(0, 0, 1, 1);
+    const T2 & G_b = b(0, 1, 0, 1);
+    result.fillSymmetricIsotropic(3.0 * lambda_a * lambda_b + 2.0 * lambda_a * G_b +
+                                      2.0 * G_a * lambda_b,
+                                  2.0 * G_a * G_b);
+    return result;
+  }
+
+  if (_symmetry >= Symmetry::minor && b_symmetry >= Symmetry::minor)
+  {
+    // The result has minor symmetry too, so only i <= j and k <= l are computed. Since
+    // b_pqkl = b_qpkl the p != q terms of the contraction come in equal pairs.
+    for (unsigned int i = 0; i < N; ++i)
+      for (unsigned int j = i; j < N; ++j)
+      {
+        const unsigned int ij1 = (i * N + j) * N2;
+        for (unsigned int k = 0; k < N; ++k)
+          for (unsigned int l = k; l < N; ++l)
+          {
+            ValueType sum = 0;
+            for (unsigned int p = 0; p < N; ++p)
+            {
+              sum += _vals[ij1 + p * N + p] * b(p, p, k, l);
+              for (unsigned int q = p + 1; q < N; ++q)
+                sum += 2.0 * _vals[ij1 + p * N + q] * b(p, q, k, l);
+            }
+            result._vals[((i * N + j) * N + k) * N + l] = sum;
+            result._vals[((j * N + i) * N + k) * N + l] = sum;
+            result._vals[((i * N + j) * N + l) * N + k] = sum;
+            result._vals[((j * N + i) * N + l) * N + k] = sum;
+          }
+      }
+    result._symmetry = RankFourTensorTempl<ValueType>::Symmetry::minor;
+    return result;
+  }
+
   unsigned int index = 0;
   unsigned int ij1 = 0;
   for (unsigned int i = 0; i < N; ++i)
@@ -451,6 +543,7 @@ RankFourTensorTempl<T>::transposeMajor() const
       }
     i1 += N;
   }
+  result._symmetry = _symmetry;
 
   return result;
 }
@@ -582,6 +675,8 @@ RankFourTensorTempl<T>::fillSymmetric9FromInputVector(const std::vector<T> & inp
   (*this)(1, 0, 1, 0) = input[8];
   (*this)(1, 0, 0, 1) = input[8];
   (*this)(0, 1, 1, 0) = input[8];
+
+  _symmetry = Symmetry::minor;
 }
 template <typename T>
 void
@@ -689,6 +784,8 @@ RankFourTensorTempl<T>::fillSymmetric21FromInputVector(const std::vector<T> & in
   (*this)(0, 1, 2, 0) = input[19];
   (*this)(2, 0, 1, 0) = input[19];
   (*this)(1, 0, 2, 0) = input[19];
+
+  _symmetry = Symmetry::minor;
 }
 
 template <typename T>
@@ -800,6 +897,7 @@ RankFourTensorTempl<T>::fillSymmetricIsotropic(T lambda, T G)
 {
   fillSymmetric9FromInputVector(
       {lambda + 2.0 * G, lambda, lambda, lambda + 2.0 * G, lambda, lambda + 2.0 * G, G, G, G});
+  _symmetry = Symmetry::isotropic;
 }
 
 template <typename T>
@@ -856,6 +954,7 @@ RankFourTensorTempl<T>::fillGeneralFromInputVector(const std::vector<T> & input)
 
   for (unsigned int i = 0; i < N4; ++i)
     _vals[i] = input[i];
+  _symmetry = Symmetry::general;
 }
 
 template <typename T>
@@ -957,6 +1056,8 @@ RankFourTensorTempl<T>::fillGeneralOrthotropicFromInputVector(const std::vector<
                                           : mat[(nskip + i + j) * ntens + k + nskip + l] / 2.0;
           index++;
         }
+
+  _symmetry = Symmetry::minor;
 }
 
 template <typename T>
@@ -185,6 +185,31 @@ public:
    */
   void rotate(const RankTwoTensorTempl<T> & R);
 
+  ///@{
+  /**
+   * Fused versions of chained products that write into a preallocated result instead of creating
+   * a temporary per operator, which matters most for the AD instantiation where every temporary
+   * carries derivative arrays. The result must not be this tensor or an argument.
+   */
+  /// result = R * this * R^T
+  void rotated(const RankTwoTensorTempl<T> & R, RankTwoTensorTempl<T> & result) const;
+
+  /// result = R^T * this * R, i.e. the inverse of rotated()
+  void unrotated(const RankTwoTensorTempl<T> & R, RankTwoTensorTempl<T> & result) const;
+
+  /// result = this^T * this (e.g. the right Cauchy-Green tensor from the deformation gradient)
+  void transposeTimesSelf(RankTwoTensorTempl<T> & result) const;
+
+  /// result = this * this^T (e.g. the left Cauchy-Green tensor from the deformation gradient)
+  void selfTimesTranspose(RankTwoTensorTempl<T> & result) const;
+
+  /// result = this - de_ij*tr(this)/3
+  void deviatoric(RankTwoTensorTempl<T> & result) const;
+  ///@}
+
+  /// this += a * b
+  void addScaled(const T & a, const RankTwoTensorTempl<T> & b);
+
   /**
    * rotates the tensor data anticlockwise around the z-axis
    * @param a angle in radians
@@ -0,0 +1,144 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Reverse Cuthill-McKee ordering of a graph in compressed sparse row form (the neighbors of
+ * vertex v are neighbors[offsets[v]] to neighbors[offsets[v + 1]]): a breadth-first numbering
+ * from a pseudo-peripheral vertex, visiting the neighbors by increasing degree, then reversed.
+ * Numbering the elements (hence the dofs, which libMesh numbers in element order) of a mesh this
+ * way keeps the couplings close to the diagonal, so the Jacobian has a narrow bandwidth and the
+ * element loops touch nearby solution entries.
+ */
+namespace ReverseCuthillMcKee
+{
+/// The breadth-first levels from a vertex; returns the last vertex of the last level
+inline std::size_t
+levels(const std::vector<std::size_t> & offsets,
+       const std::vector<std::size_t> & neighbors,
+       std::size_t root,
+       std::vector<std::size_t> & level,
+       std::size_t & depth)
+{
+  const std::size_t n = offsets.size() - 1;
+  const std::size_t unvisited = static_cast<std::size_t>(-1);
+  level.assign(n, unvisited);
+  std::vector<std::size_t> queue(1, root);
+  level[root] = 0;
+  std::size_t last = root;
+  for (std::size_t q = 0; q < queue.size(); ++q)
+  {
+    const auto v = queue[q];
+    last = v;
+    for (auto k = offsets[v]; k < offsets[v + 1]; ++k)
+    {
+      const auto w = neighbors[k];
+      if (level[w] == unvisited)
+      {
+        level[w] = level[v] + 1;
+        queue.push_back(w);
+      }
+    }
+  }
+  depth = level[last];
+  return last;
+}
+
+/**
+ * The reverse Cuthill-McKee order of a graph, one breadth-first sweep per connected component
+ * @return The vertices in their new order
+ */
+inline std::vector<std::size_t>
+order(const std::vector<std::size_t> & offsets, const std::vector<std::size_t> & neighbors)
+{
+  mooseAssert(!offsets.empty(), "The offsets of a graph hold one more entry than its vertices");
+  const std::size_t n = offsets.size() - 1;
+  const auto degree = [&offsets](std::size_t v) { return offsets[v + 1] - offsets[v]; };
+
+  std::vector<std::size_t> ordered;
+  ordered.reserve(n);
+  std::vector<bool> numbered(n, false);
+  std::vector<std::size_t> level;
+  for (std::size_t start = 0; start < n; ++start)
+  {
+    if (numbered[start])
+      continue;
+
+    // A pseudo-peripheral vertex of the component: the farthest vertex from the farthest one,
+    // until the eccentricity stops growing
+    std::size_t root = start, depth = 0;
+    for (unsigned int sweep = 0; sweep < 8; ++sweep)
+    {
+      std::size_t new_depth;
+      const auto far = levels(offsets, neighbors, root, level, new_depth);
+      if (sweep && new_depth <= depth)
+        break;
+      depth = new_depth;
+      root = far;
+    }
+
+    const auto begin = ordered.size();
+    ordered.push_back(root);
+    numbered[root] = true;
+    for (auto q = begin; q < ordered.size(); ++q)
+    {
+      const auto v = ordered[q];
+      const auto first_new = ordered.size();
+      for (auto k = offsets[v]; k < offsets[v + 1]; ++k)
+        if (!numbered[neighbors[k]])
+        {
+          numbered[neighbors[k]] = true;
+          ordered.push_back(neighbors[k]);
+        }
+      std::stable_sort(ordered.begin() + first_new,
+                       ordered.end(),
+                       [&degree](std::size_t a, std::size_t b) { return degree(a) < degree(b); });
+    }
+  }
+
+  std::reverse(ordered.begin(), ordered.end());
+  return ordered;
+}
+
+/**
+ * The bandwidth of a graph numbered by \p new_index, the largest index difference of two
+ * neighbors: the half bandwidth of the matrix of its couplings
+ */
+inline std::size_t
+bandwidth(const std::vector<std::size_t> & offsets,
+          const std::vector<std::size_t> & neighbors,
+          const std::vector<std::size_t> & new_index)
+{
+  std::size_t result = 0;
+  for (std::size_t v = 0; v + 1 < offsets.size(); ++v)
+    for (auto k = offsets[v]; k < offsets[v + 1]; ++k)
+    {
+      const auto a = new_index[v], b = new_index[neighbors[k]];
+      result = std::max(result, a > b ? a - b : b - a);
+    }
+  return result;
+}
+
+/// The new index of each vertex from the vertices in their new order
+inline std::vector<std::size_t>
+inverse(const std::vector<std::size_t> & ordered)
+{
+  std::vector<std::size_t> new_index(ordered.size());
+  for (std::size_t i = 0; i < ordered.size(); ++i)
+    new_index[ordered[i]] = i;
+  return new_index;
+}
+}
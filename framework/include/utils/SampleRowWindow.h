@@ -0,0 +1,121 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * A window of consecutive rows of sample data, for random access to the samples of a Sampler
+ * without the matrix of all its rows: the rows [begin, begin + capacity) are generated together
+ * when a row outside the window is accessed, so the memory stays at capacity rows whatever the
+ * number of rows of the Sampler (see Sampler::getSample()).
+ *
+ * The rows are generated by a functor f(row, data) filling the row data, called for increasing
+ * rows; accesses that mostly increase (as when looping over the local rows) generate every row
+ * once.
+ */
+class SampleRowWindow
+{
+public:
+  /**
+   * @param n_cols The number of columns of a row
+   * @param capacity The number of rows kept
+   */
+  SampleRowWindow(dof_id_type n_cols = 0, dof_id_type capacity = 1) { resize(n_cols, capacity); }
+
+  /// Changes the size of the rows and of the window, emptying it
+  void resize(dof_id_type n_cols, dof_id_type capacity)
+  {
+    if (capacity == 0)
+      mooseError("A SampleRowWindow must keep at least one row");
+    _n_cols = n_cols;
+    _capacity = capacity;
+    clear();
+  }
+
+  /// Empties the window, e.g. when the Sampler generates new data
+  void clear()
+  {
+    _begin = _end = 0;
+    _data.clear();
+    _data.shrink_to_fit();
+  }
+
+  /// Whether a row is in the window
+  bool contains(dof_id_type row) const { return row >= _begin && row < _end; }
+
+  ///@{ The rows in the window, [begin, end)
+  dof_id_type begin() const { return _begin; }
+  dof_id_type end() const { return _end; }
+  ///@}
+
+  /**
+   * Makes the window start at a row, generating the rows not already in it
+   * @param row The first row of the window
+   * @param n_rows The number of rows of the data, the window stops there
+   * @param f The generator f(row, data) of the data of a row
+   */
+  template <typename Functor>
+  void fill(dof_id_type row, dof_id_type n_rows, Functor && f)
+  {
+    mooseAssert(row < n_rows, "Row " << row << " out of range");
+    const dof_id_type end = std::min(n_rows, row + _capacity);
+
+    // Keep the rows shared with the current window
+    std::vector<Real> data((end - row) * _n_cols);
+    const dof_id_type keep_begin = std::max(row, _begin), keep_end = std::min(end, _end);
+    if (keep_begin < keep_end)
+      std::copy(_data.begin() + (keep_begin - _begin) * _n_cols,
+                _data.begin() + (keep_end - _begin) * _n_cols,
+                data.begin() + (keep_begin - row) * _n_cols);
+
+    std::vector<Real> row_data(_n_cols);
+    for (dof_id_type r = row; r < end; ++r)
+      if (r < keep_begin || r >= keep_end)
+      {
+        f(r, row_data);
+        mooseAssert(row_data.size() == _n_cols, "Wrong number of columns");
+        std::copy(row_data.begin(), row_data.end(), data.begin() + (r - row) * _n_cols);
+      }
+
+    _data.swap(data);
+    _begin = row;
+    _end = end;
+  }
+
+  /// A sample of a row in the window
+  Real value(dof_id_type row, dof_id_type col) const
+  {
+    mooseAssert(contains(row), "Row " << row << " is not in the window");
+    mooseAssert(col < _n_cols, "Column " << col << " out of range");
+    return _data[(row - _begin) * _n_cols + col];
+  }
+
+  /// Copies a row of the window
+  void row(dof_id_type row, std::vector<Real> & data) const
+  {
+    mooseAssert(contains(row), "Row " << row << " is not in the window");
+    const auto first = _data.begin() + (row - _begin) * _n_cols;
+    data.assign(first, first + _n_cols);
+  }
+
+private:
+  dof_id_type _n_cols;
+  dof_id_type _capacity;
+  dof_id_type _begin;
+  dof_id_type _end;
+
+  /// The rows [_begin, _end), row major
+  std::vector<Real> _data;
+};
@@ -0,0 +1,290 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/**
+ * Accumulates the Jacobian border coupling the field variables to a few scalar variables:
+ *
+ *     [ A  B ]   A: field-field, assembled as usual
+ *     [ C  D ]   B: field-scalar columns, C: scalar-field rows, D: scalar-scalar block
+ *
+ * Every element contributes to B and C (e.g. GeneralizedPlaneStrain, global strain, point
+ * kinetics), which through the per-element scalar blocks of Assembly makes one small insertion
+ * per element into rows that are dense. Here the contributions are appended to contiguous arrays
+ * (one buffer per thread, merged with join()), reduced once by finalize(), and then inserted a
+ * whole row at a time: each row of C with all its columns, and each field row of B with the
+ * columns of all the scalars.
+ *
+ * libMesh numbers the SCALAR dofs after the field dofs, so B, C and D are the trailing block
+ * columns and rows of the matrix, which is the layout the fieldsplit Schur complement
+ * preconditioners expect when the scalar variables are put in their own split.
+ */
+class ScalarBorderBuffer
+{
+public:
+  /**
+   * Sets up the buffer for a Jacobian evaluation, with zero contributions
+   * @param scalar_dofs The dofs of the scalar variables
+   */
+  void reset(const std::vector<dof_id_type> & scalar_dofs)
+  {
+    _scalar_dofs = scalar_dofs;
+    _sorted_scalars.clear();
+    for (unsigned int s = 0; s < _scalar_dofs.size(); ++s)
+      _sorted_scalars.emplace_back(_scalar_dofs[s], s);
+    std::sort(_sorted_scalars.begin(), _sorted_scalars.end());
+
+    _b_entries.clear();
+    _c_entries.clear();
+    _d.assign(_scalar_dofs.size() * _scalar_dofs.size(), 0);
+    _b_rows.clear();
+    _b_values.clear();
+    _c_offsets.clear();
+    _c_cols.clear();
+    _c_values.clear();
+    _finalized = false;
+  }
+
+  /// The number of scalar dofs
+  unsigned int numScalars() const { return _scalar_dofs.size(); }
+
+  /// The dofs of the scalar variables, in index order
+  const std::vector<dof_id_type> & scalarDofs() const { return _scalar_dofs; }
+
+  /// Whether a dof is one of the scalar dofs
+  bool isScalar(dof_id_type dof) const { return findScalar(dof) != _sorted_scalars.end(); }
+
+  /// The index of a scalar dof
+  unsigned int scalarIndex(dof_id_type dof) const
+  {
+    const auto it = findScalar(dof);
+    if (it == _sorted_scalars.end())
+      mooseError("Dof ", dof, " is not a scalar dof of the ScalarBorderBuffer");
+    return it->second;
+  }
+
+  ///@{ Adds a contribution to the border blocks (scalars by index)
+  void addColumn(dof_id_type field_row, unsigned int scalar, Real value)
+  {
+    mooseAssert(!_finalized, "Contribution added to a finalized ScalarBorderBuffer");
+    _b_entries.push_back({field_row, scalar, value});
+  }
+  void addRow(unsigned int scalar, dof_id_type field_col, Real value)
+  {
+    mooseAssert(!_finalized, "Contribution added to a finalized ScalarBorderBuffer");
+    _c_entries.push_back({field_col, scalar, value});
+  }
+  void addScalar(unsigned int scalar_row, unsigned int scalar_col, Real value)
+  {
+    _d[scalar_row * numScalars() + scalar_col] += value;
+  }
+  ///@}
+
+  /**
+   * Adds an element block coupling field dofs to scalar dofs
+   * @param rows The row dofs of the block: field dofs for B, scalar dofs for C
+   * @param cols The column dofs of the block: scalar dofs for B, field dofs for C
+   * @param block The values, accessed as block(i, j) (e.g. a DenseMatrix)
+   */
+  template <typename Matrix>
+  void addBlock(const std::vector<dof_id_type> & rows,
+                const std::vector<dof_id_type> & cols,
+                const Matrix & block)
+  {
+    if (rows.empty() || cols.empty())
+      return;
+
+    const bool scalar_rows = isScalar(rows[0]);
+    const bool scalar_cols = isScalar(cols[0]);
+    std::vector<unsigned int> row_index(rows.size()), col_index(cols.size());
+    if (scalar_rows)
+      for (std::size_t i = 0; i < rows.size(); ++i)
+        row_index[i] = scalarIndex(rows[i]);
+    if (scalar_cols)
+      for (std::size_t j = 0; j < cols.size(); ++j)
+        col_index[j] = scalarIndex(cols[j]);
+
+    for (std::size_t i = 0; i < rows.size(); ++i)
+      for (std::size_t j = 0; j < cols.size(); ++j)
+      {
+        const Real value = block(i, j);
+        if (value == 0)
+          continue;
+        if (scalar_rows && scalar_cols)
+          addScalar(row_index[i], col_index[j], value);
+        else if (scalar_cols)
+          addColumn(rows[i], col_index[j], value);
+        else if (scalar_rows)
+          addRow(row_index[i], cols[j], value);
+        else
+          mooseError("ScalarBorderBuffer::addBlock() called for a field-field block");
+      }
+  }
+
+  /// Appends the contributions of another buffer set up with the same scalar dofs
+  void join(const ScalarBorderBuffer & other)
+  {
+    mooseAssert(other._scalar_dofs == _scalar_dofs, "Joining buffers of different scalars");
+    _b_entries.insert(_b_entries.end(), other._b_entries.begin(), other._b_entries.end());
+    _c_entries.insert(_c_entries.end(), other._c_entries.begin(), other._c_entries.end());
+    for (std::size_t k = 0; k < _d.size(); ++k)
+      _d[k] += other._d[k];
+  }
+
+  /**
+   * Sums the contributions to the same entries: B becomes dense rows over the scalars for the
+   * field rows touched, C a sorted sparse row per scalar
+   */
+  void finalize()
+  {
+    const unsigned int n_s = numScalars();
+
+    auto by_field = [](const Entry & a, const Entry & b)
+    { return a.field < b.field || (a.field == b.field && a.scalar < b.scalar); };
+
+    std::sort(_b_entries.begin(), _b_entries.end(), by_field);
+    _b_rows.clear();
+    _b_values.clear();
+    for (const auto & entry : _b_entries)
+    {
+      if (_b_rows.empty() || _b_rows.back() != entry.field)
+      {
+        _b_rows.push_back(entry.field);
+        _b_values.resize(_b_values.size() + n_s, 0);
+      }
+      _b_values[(_b_rows.size() - 1) * n_s + entry.scalar] += entry.value;
+    }
+
+    auto by_scalar = [](const Entry & a, const Entry & b)
+    { return a.scalar < b.scalar || (a.scalar == b.scalar && a.field < b.field); };
+
+    std::sort(_c_entries.begin(), _c_entries.end(), by_scalar);
+    _c_offsets.assign(n_s + 1, 0);
+    _c_cols.clear();
+    _c_values.clear();
+    std::size_t k = 0;
+    for (unsigned int s = 0; s < n_s; ++s)
+    {
+      _c_offsets[s] = _c_cols.size();
+      for (; k < _c_entries.size() && _c_entries[k].scalar == s; ++k)
+      {
+        const auto & entry = _c_entries[k];
+        if (_c_cols.size() > _c_offsets[s] && _c_cols.back() == entry.field)
+          _c_values.back() += entry.value;
+        else
+        {
+          _c_cols.push_back(entry.field);
+          _c_values.push_back(entry.value);
+        }
+      }
+    }
+    _c_offsets[n_s] = _c_cols.size();
+
+    std::vector<Entry>().swap(_b_entries);
+    std::vector<Entry>().swap(_c_entries);
+    _finalized = true;
+  }
+
+  bool finalized() const { return _finalized; }
+
+  /**
+   * Calls add(row, cols, values) once for every row of the reduced border, for e.g. a single
+   * MatSetValues() per row: the field rows of B, the rows of C and of D, with their columns
+   * @param add The callback, taking (dof_id_type, const std::vector<dof_id_type> &,
+   *            const std::vector<Real> &)
+   */
+  template <typename AddRow>
+  void forEachRow(AddRow && add) const
+  {
+    mooseAssert(_finalized, "ScalarBorderBuffer::finalize() must be called first");
+    const unsigned int n_s = numScalars();
+    std::vector<dof_id_type> cols;
+    std::vector<Real> values;
+
+    for (std::size_t r = 0; r < _b_rows.size(); ++r)
+    {
+      values.assign(_b_values.begin() + r * n_s, _b_values.begin() + (r + 1) * n_s);
+      add(_b_rows[r], _scalar_dofs, values);
+    }
+
+    for (unsigned int s = 0; s < n_s; ++s)
+    {
+      cols.assign(_c_cols.begin() + _c_offsets[s], _c_cols.begin() + _c_offsets[s + 1]);
+      values.assign(_c_values.begin() + _c_offsets[s], _c_values.begin() + _c_offsets[s + 1]);
+      cols.insert(cols.end(), _scalar_dofs.begin(), _scalar_dofs.end());
+      values.insert(values.end(), _d.begin() + s * n_s, _d.begin() + (s + 1) * n_s);
+      add(_scalar_dofs[s], cols, values);
+    }
+  }
+
+  ///@{ The reduced blocks
+  /// The field rows of B
+  const std::vector<dof_id_type> & columnBlockRows() const { return _b_rows; }
+  /// The values of the r-th field row of B, one per scalar
+  const Real * columnBlockRow(std::size_t r) const { return _b_values.data() + r * numScalars(); }
+  /// The number of (reduced) entries of the scalar row s of C
+  std::size_t rowBlockSize(unsigned int s) const { return _c_offsets[s + 1] - _c_offsets[s]; }
+  const dof_id_type * rowBlockCols(unsigned int s) const { return _c_cols.data() + _c_offsets[s]; }
+  const Real * rowBlockValues(unsigned int s) const { return _c_values.data() + _c_offsets[s]; }
+  /// D, row-major
+  const std::vector<Real> & scalarBlock() const { return _d; }
+  ///@}
+
+private:
+  /// A contribution to B (row field, column scalar) or to C (row scalar, column field)
+  struct Entry
+  {
+    dof_id_type field;
+    unsigned int scalar;
+    Real value;
+  };
+
+  std::vector<std::pair<dof_id_type, unsigned int>>::const_iterator
+  findScalar(dof_id_type dof) const
+  {
+    const auto it = std::lower_bound(_sorted_scalars.begin(),
+                                     _sorted_scalars.end(),
+                                     std::make_pair(dof, 0u));
+    return (it != _sorted_scalars.end() && it->first == dof) ? it : _sorted_scalars.end();
+  }
+
+  std::vector<dof_id_type> _scalar_dofs;
+
+  /// (dof, index) of the scalar dofs, sorted by dof
+  std::vector<std::pair<dof_id_type, unsigned int>> _sorted_scalars;
+
+  ///@{ The contributions to B and C, until finalize()
+  std::vector<Entry> _b_entries;
+  std::vector<Entry> _c_entries;
+  ///@}
+
+  /// D, row-major, accumulated directly
+  std::vector<Real> _d;
+
+  ///@{ The reduced B: the field rows and their dense values over the scalars
+  std::vector<dof_id_type> _b_rows;
+  std::vector<Real> _b_values;
+  ///@}
+
+  ///@{ The reduced C, in CSR form by scalar
+  std::vector<std::size_t> _c_offsets;
+  std::vector<dof_id_type> _c_cols;
+  std::vector<Real> _c_values;
+  ///@}
+
+  bool _finalized = false;
+};
@@ -0,0 +1,164 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+
+#include "libmesh/communicator.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * The ranks of a communicator that share memory, i.e. that run on the same node.
+ *
+ * Without MPI, every rank is alone on its node.
+ */
+class NodeCommunicator
+{
+public:
+  NodeCommunicator(const libMesh::Parallel::Communicator & comm)
+  {
+#ifdef LIBMESH_HAVE_MPI
+    if (MPI_Comm_split_type(comm.get(), MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &_comm) !=
+        MPI_SUCCESS)
+      mooseError("NodeCommunicator: MPI_Comm_split_type failed");
+    MPI_Comm_rank(_comm, &_rank);
+    MPI_Comm_size(_comm, &_size);
+#else
+    libmesh_ignore(comm);
+#endif
+  }
+
+  ~NodeCommunicator()
+  {
+#ifdef LIBMESH_HAVE_MPI
+    MPI_Comm_free(&_comm);
+#endif
+  }
+
+  NodeCommunicator(const NodeCommunicator &) = delete;
+  NodeCommunicator & operator=(const NodeCommunicator &) = delete;
+
+  /// Rank within the node
+  int rank() const { return _rank; }
+
+  /// Number of ranks on the node
+  int size() const { return _size; }
+
+  /// Whether this is the lowest rank of the node
+  bool leader() const { return _rank == 0; }
+
+#ifdef LIBMESH_HAVE_MPI
+  MPI_Comm get() const { return _comm; }
+#endif
+
+private:
+#ifdef LIBMESH_HAVE_MPI
+  MPI_Comm _comm;
+#endif
+  int _rank = 0;
+  int _size = 1;
+};
+
+/**
+ * An array with a single copy per node, shared by all the ranks of a communicator that run on
+ * that node through an MPI-3 shared memory window.
+ *
+ * Construction is collective. Only the size given on the leader of each node (see
+ * NodeCommunicator) is used. The leader fills the array through data(), then every rank of the
+ * node calls fence(), after which all of them may read it:
+ *
+ * @begincode
+ * SharedMemoryArray<Real> table(comm, n);
+ * if (table.leader())
+ *   fill(table.data(), table.size());
+ * table.fence();
+ * @endcode
+ *
+ * Without MPI, the array is an ordinary allocation.
+ */
+template <typename T>
+class SharedMemoryArray
+{
+public:
+  SharedMemoryArray(const libMesh::Parallel::Communicator & comm, std::size_t n) : _node(comm)
+  {
+#ifdef LIBMESH_HAVE_MPI
+    std::uint64_t size = n;
+    MPI_Bcast(&size, 1, MPI_UINT64_T, 0, _node.get());
+    _size = size;
+
+    void * base = nullptr;
+    const MPI_Aint bytes = _node.leader() ? _size * sizeof(T) : 0;
+    if (MPI_Win_allocate_shared(bytes, sizeof(T), MPI_INFO_NULL, _node.get(), &base, &_win) !=
+        MPI_SUCCESS)
+      mooseError("SharedMemoryArray: MPI_Win_allocate_shared failed");
+
+    if (!_node.leader())
+    {
+      MPI_Aint leader_bytes;
+      int disp_unit;
+      MPI_Win_shared_query(_win, 0, &leader_bytes, &disp_unit, &base);
+    }
+    _data = static_cast<T *>(base);
+
+    // Open the first epoch, closed by fence()
+    MPI_Win_fence(0, _win);
+#else
+    _storage.resize(n);
+    _size = n;
+    _data = _storage.data();
+#endif
+  }
+
+  ~SharedMemoryArray()
+  {
+#ifdef LIBMESH_HAVE_MPI
+    MPI_Win_free(&_win);
+#endif
+  }
+
+  SharedMemoryArray(const SharedMemoryArray &) = delete;
+  SharedMemoryArray & operator=(const SharedMemoryArray &) = delete;
+
+  /// Whether this rank fills the array for its node
+  bool leader() const { return _node.leader(); }
+
+  /// Makes what the leader wrote visible to the other ranks of the node (collective on the node)
+  void fence()
+  {
+#ifdef LIBMESH_HAVE_MPI
+    MPI_Win_fence(0, _win);
+#endif
+  }
+
+  /// The values, only to be written by the leader before fence()
+  T * data() { return _data; }
+  const T * data() const { return _data; }
+
+  std::size_t size() const { return _size; }
+
+  const T & operator[](std::size_t i) const
+  {
+    mooseAssert(i < _size, "Index out of range");
+    return _data[i];
+  }
+
+private:
+  NodeCommunicator _node;
+#ifdef LIBMESH_HAVE_MPI
+  MPI_Win _win;
+#else
+  std::vector<T> _storage;
+#endif
+  T * _data = nullptr;
+  std::size_t _size = 0;
+};
@@ -0,0 +1,130 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <array>
+#include <iomanip>
+#include <ostream>
+#include <set>
+#include <string>
+
+/**
+ * Records which objects need the old, older, previous Newton and time derivative vectors of a
+ * system, so that a system only allocates the vectors something uses (each one is a full copy of
+ * the solution) and can tell which objects a vector is kept for.
+ *
+ * Only the vectors MOOSE adds to the system (previous Newton and the time derivatives) are
+ * allocated on request: the old and older solutions belong to the libMesh TransientSystem, which
+ * always allocates them, so their requests are only recorded for report(). The requesters are
+ * the objects coupling to the vectors, the variables of the system and its time integrator (see
+ * TimeIntegrator::solutionStatesNeeded()).
+ *
+ * A vector also counts as requested when a vector depending on it is: the old time derivatives
+ * are copied from the current ones.
+ */
+class SolutionStateRequests
+{
+public:
+  enum Vector
+  {
+    OLD,
+    OLDER,
+    PREVIOUS_NEWTON,
+    U_DOT,
+    U_DOTDOT,
+    U_DOT_OLD,
+    U_DOTDOT_OLD,
+    NUM_VECTORS
+  };
+
+  /// The name of a vector in the report
+  static const char * name(Vector vector)
+  {
+    static const char * names[NUM_VECTORS] = {
+        "old", "older", "previous Newton", "u_dot", "u_dotdot", "u_dot_old", "u_dotdot_old"};
+    return names[vector];
+  }
+
+  /**
+   * Records that an object needs a vector
+   * @param requester The name of the object, or of what needs the vector (e.g. the time
+   * integrator)
+   */
+  void request(Vector vector, const std::string & requester)
+  {
+    _requesters[vector].insert(requester);
+  }
+
+  /// Whether a vector is allocated by libMesh whatever the requests
+  static bool allocatedByLibMesh(Vector vector) { return vector == OLD || vector == OLDER; }
+
+  /// Whether a vector is allocated: always for the libMesh vectors, on request for the others
+  bool allocated(Vector vector) const { return allocatedByLibMesh(vector) || requested(vector); }
+
+  /// Whether a vector is needed, directly or by a vector depending on it
+  bool requested(Vector vector) const
+  {
+    if (!_requesters[vector].empty())
+      return true;
+    switch (vector)
+    {
+      case U_DOT:
+        return requested(U_DOT_OLD);
+      case U_DOTDOT:
+        return requested(U_DOTDOT_OLD);
+      default:
+        return false;
+    }
+  }
+
+  /// The objects that requested a vector directly
+  const std::set<std::string> & requesters(Vector vector) const { return _requesters[vector]; }
+
+  void clear()
+  {
+    for (auto & requesters : _requesters)
+      requesters.clear();
+  }
+
+  /**
+   * Prints the vectors needed, their memory and the objects they are kept for
+   * @param n_local_dofs The number of local entries of a vector, for the memory estimate
+   */
+  void report(std::ostream & os, dof_id_type n_local_dofs) const
+  {
+    const Real mb = Real(n_local_dofs) * sizeof(Number) / (1024. * 1024.);
+    for (unsigned int v = 0; v < NUM_VECTORS; ++v)
+    {
+      const auto vector = static_cast<Vector>(v);
+      os << std::left << std::setw(17) << name(vector);
+      if (!allocated(vector))
+      {
+        os << "not allocated\n";
+        continue;
+      }
+      os << std::fixed << std::setprecision(1) << mb << " MB:";
+      if (allocatedByLibMesh(vector))
+        os << " (allocated by libMesh)";
+      else if (_requesters[vector].empty())
+        os << " (for the " << name(dependent(vector)) << " vector)";
+      for (const auto & requester : _requesters[vector])
+        os << ' ' << requester;
+      os << '\n';
+    }
+  }
+
+private:
+  /// The vector that needs another one, for the two vectors that have one
+  static Vector dependent(Vector vector) { return vector == U_DOT ? U_DOT_OLD : U_DOTDOT_OLD; }
+
+  std::array<std::set<std::string>, NUM_VECTORS> _requesters;
+};
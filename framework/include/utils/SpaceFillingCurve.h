@@ -0,0 +1,152 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+/**
+ * Keys of points along the Morton (Z-order) and Hilbert space-filling curves, for partitioning a
+ * mesh and ordering its elements and nodes so that those close along the curve are close in
+ * space. The Hilbert curve is continuous, so its ranges are more compact (smaller partition
+ * boundaries) than the Morton ones, at a somewhat higher cost per key.
+ */
+namespace SpaceFillingCurve
+{
+/// The bits of each coordinate in the keys
+constexpr unsigned int BITS = 21;
+
+/**
+ * The integer coordinates of a point within a box, with BITS bits each
+ * @param point The point
+ * @param lower The lowest corner of the box
+ * @param upper The highest corner of the box
+ * @param dim The number of coordinates
+ * @param x The integer coordinates
+ */
+inline void
+quantize(const Real * point,
+         const Real * lower,
+         const Real * upper,
+         unsigned int dim,
+         std::uint32_t * x)
+{
+  const std::uint32_t max = (1u << BITS) - 1;
+  for (unsigned int d = 0; d < dim; ++d)
+  {
+    const Real extent = upper[d] - lower[d];
+    const Real s = extent > 0 ? (point[d] - lower[d]) / extent : 0;
+    x[d] = s <= 0 ? 0 : s >= 1 ? max : static_cast<std::uint32_t>(s * max);
+  }
+}
+
+/// The Morton key of integer coordinates: their bits interleaved
+inline std::uint64_t
+morton(const std::uint32_t * x, unsigned int dim)
+{
+  std::uint64_t key = 0;
+  for (unsigned int b = 0; b < BITS; ++b)
+    for (unsigned int d = 0; d < dim; ++d)
+      key |= std::uint64_t((x[d] >> b) & 1) << (dim * b + d);
+  return key;
+}
+
+/**
+ * The Hilbert key of integer coordinates, from their transposed Hilbert index (J. Skilling,
+ * "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004)
+ */
+inline std::uint64_t
+hilbert(const std::uint32_t * coords, unsigned int dim)
+{
+  std::uint32_t x[3] = {0, 0, 0};
+  std::copy(coords, coords + dim, x);
+
+  // Inverse undo of the excess work
+  const std::uint32_t m = 1u << (BITS - 1);
+  for (std::uint32_t q = m; q > 1; q >>= 1)
+  {
+    const std::uint32_t p = q - 1;
+    for (unsigned int i = 0; i < dim; ++i)
+      if (x[i] & q)
+        x[0] ^= p;
+      else
+      {
+        const std::uint32_t t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+  }
+
+  // Gray encode
+  for (unsigned int i = 1; i < dim; ++i)
+    x[i] ^= x[i - 1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = m; q > 1; q >>= 1)
+    if (x[dim - 1] & q)
+      t ^= q - 1;
+  for (unsigned int i = 0; i < dim; ++i)
+    x[i] ^= t;
+
+  // The transposed index holds the key bits spread over the coordinates, most significant first
+  std::uint64_t key = 0;
+  for (int b = BITS - 1; b >= 0; --b)
+    for (unsigned int i = 0; i < dim; ++i)
+      key = (key << 1) | ((x[i] >> b) & 1);
+  return key;
+}
+
+/**
+ * The order of keys: the indices of the keys sorted along the curve, ties by index
+ */
+inline std::vector<std::size_t>
+order(const std::vector<std::uint64_t> & keys)
+{
+  std::vector<std::size_t> indices(keys.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  std::sort(indices.begin(), indices.end(), [&keys](std::size_t a, std::size_t b) {
+    return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+  });
+  return indices;
+}
+
+/**
+ * Splits items in curve order into contiguous parts of roughly equal weight
+ * @param sorted The items in curve order (see order())
+ * @param weights The weight of each item, or empty for unit weights
+ * @param n_parts The number of parts
+ * @return The part of each item
+ */
+inline std::vector<unsigned int>
+partition(const std::vector<std::size_t> & sorted,
+          const std::vector<Real> & weights,
+          unsigned int n_parts)
+{
+  const auto weight = [&weights](std::size_t i) { return weights.empty() ? Real(1) : weights[i]; };
+  Real total = 0;
+  for (const auto i : sorted)
+    total += weight(i);
+
+  std::vector<unsigned int> parts(sorted.size());
+  Real accumulated = 0;
+  for (const auto i : sorted)
+  {
+    // The part of the middle of the item, so that a heavy item goes where most of it lies
+    const Real w = weight(i);
+    const Real middle = total > 0 ? (accumulated + w / 2) / total : 0;
+    parts[i] = std::min(n_parts - 1, static_cast<unsigned int>(middle * n_parts));
+    accumulated += w;
+  }
+  return parts;
+}
+}
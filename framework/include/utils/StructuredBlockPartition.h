@@ -0,0 +1,225 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+/**
+ * A partition of a structured grid of nx x ny x nz elements into boxes, one per processor, that
+ * every processor computes on its own: a processor can then build only the elements of its box
+ * and of the few layers around it (its ghosts) without the mesh ever existing anywhere in full
+ * or a partitioner being run.
+ *
+ * The processors are arranged in a px x py x pz grid (px py pz = the number of processors) that
+ * minimizes the area of the faces between the boxes. The elements are numbered naturally (i, then
+ * j, then k), as when the whole grid is built, so the ids do not depend on the partition. A
+ * direction can be periodic (e.g. the azimuthal direction of an annulus), in which case the
+ * ghosts of the boxes at its ends wrap around.
+ */
+class StructuredBlockPartition
+{
+public:
+  typedef std::array<dof_id_type, 3> Index;
+
+  /// A box of elements [begin, end) in every direction
+  struct Box
+  {
+    Index begin;
+    Index end;
+
+    dof_id_type size() const
+    {
+      return (end[0] - begin[0]) * (end[1] - begin[1]) * (end[2] - begin[2]);
+    }
+
+    bool contains(const Index & ijk) const
+    {
+      for (unsigned int d = 0; d < 3; ++d)
+        if (ijk[d] < begin[d] || ijk[d] >= end[d])
+          return false;
+      return true;
+    }
+  };
+
+  /**
+   * @param n The number of elements in each direction (1 for the directions a mesh does not have)
+   * @param n_procs The number of processors
+   * @param periodic Whether each direction is periodic
+   */
+  StructuredBlockPartition(const Index & n,
+                           processor_id_type n_procs,
+                           const std::array<bool, 3> & periodic = {{false, false, false}})
+    : _n(n), _periodic(periodic)
+  {
+    if (n_procs == 0)
+      mooseError("A StructuredBlockPartition needs at least one processor");
+    for (unsigned int d = 0; d < 3; ++d)
+      if (n[d] == 0)
+        mooseError("A StructuredBlockPartition needs at least one element in every direction");
+
+    // Pick the processor grid with the smallest area between the boxes, avoiding empty boxes
+    Real best = std::numeric_limits<Real>::max();
+    for (processor_id_type px = 1; px <= n_procs; ++px)
+      if (n_procs % px == 0)
+        for (processor_id_type py = 1; py <= n_procs / px; ++py)
+          if ((n_procs / px) % py == 0)
+          {
+            const std::array<processor_id_type, 3> p = {
+                {px, py, processor_id_type(n_procs / px / py)}};
+            Real cost = 0;
+            for (unsigned int d = 0; d < 3; ++d)
+            {
+              const Real area = Real(n[0]) * n[1] * n[2] / n[d];
+              cost += (p[d] - 1) * area;
+              if (p[d] > n[d])
+                cost += Real(n[0]) * n[1] * n[2] * (p[d] - n[d]);
+            }
+            if (cost < best)
+            {
+              best = cost;
+              _p = p;
+            }
+          }
+  }
+
+  /// The number of boxes in each direction
+  const std::array<processor_id_type, 3> & procGrid() const { return _p; }
+
+  /// The number of elements in each direction
+  const Index & size() const { return _n; }
+
+  /// The box of a processor
+  Box box(processor_id_type pid) const
+  {
+    mooseAssert(pid < _p[0] * _p[1] * _p[2], "Processor " << pid << " out of range");
+    const std::array<processor_id_type, 3> q = {
+        {processor_id_type(pid % _p[0]),
+         processor_id_type(pid / _p[0] % _p[1]),
+         processor_id_type(pid / _p[0] / _p[1])}};
+    Box box;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      box.begin[d] = split(d, q[d]);
+      box.end[d] = split(d, q[d] + 1);
+    }
+    return box;
+  }
+
+  /// The processor owning an element
+  processor_id_type owner(const Index & ijk) const
+  {
+    processor_id_type pid = 0;
+    for (unsigned int d = 3; d-- > 0;)
+    {
+      mooseAssert(ijk[d] < _n[d], "Element index out of range");
+      // The box q with split(q) <= ijk < split(q + 1)
+      processor_id_type q = std::min<dof_id_type>(ijk[d] * _p[d] / _n[d], _p[d] - 1);
+      while (split(d, q) > ijk[d])
+        --q;
+      while (split(d, q + 1) <= ijk[d])
+        ++q;
+      pid = pid * _p[d] + q;
+    }
+    return pid;
+  }
+
+  /**
+   * The processor owning a node of the grid of (n + 1) nodes per direction: the lowest owner of
+   * its elements. In a periodic direction the last node is the first one.
+   */
+  processor_id_type nodeOwner(const Index & node) const
+  {
+    processor_id_type pid = std::numeric_limits<processor_id_type>::max();
+    for (unsigned int c = 0; c < 8; ++c)
+    {
+      Index ijk;
+      bool valid = true;
+      for (unsigned int d = 0; d < 3; ++d)
+      {
+        const bool lower = c & (1u << d);
+        if (lower && node[d] == 0)
+        {
+          if (!_periodic[d])
+            valid = false;
+          ijk[d] = _n[d] - 1;
+        }
+        else
+          ijk[d] = std::min(lower ? node[d] - 1 : node[d], _n[d] - 1);
+      }
+      if (valid)
+        pid = std::min(pid, owner(ijk));
+    }
+    return pid;
+  }
+
+  /// The id of an element in the natural numbering
+  dof_id_type elemId(const Index & ijk) const
+  {
+    return ijk[0] + _n[0] * (ijk[1] + _n[1] * ijk[2]);
+  }
+
+  /// The indices of an element from its id
+  Index elemIndices(dof_id_type id) const
+  {
+    return {{id % _n[0], id / _n[0] % _n[1], id / _n[0] / _n[1]}};
+  }
+
+  /**
+   * Calls f(ijk) for every element within \p layers elements of the box of a processor but not
+   * in it: the ghosts the processor builds along with its own elements
+   */
+  template <typename Functor>
+  void forEachGhost(processor_id_type pid, unsigned int layers, Functor && f) const
+  {
+    const Box own = box(pid);
+    if (own.size() == 0)
+      return;
+
+    // The indices of the expanded box in each direction, wrapped when periodic
+    std::array<std::vector<dof_id_type>, 3> range;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      const long long lo = (long long)own.begin[d] - layers, hi = (long long)own.end[d] + layers;
+      for (long long x = lo; x < hi; ++x)
+      {
+        if (_periodic[d])
+          range[d].push_back(((x % (long long)_n[d]) + _n[d]) % _n[d]);
+        else if (x >= 0 && x < (long long)_n[d])
+          range[d].push_back(x);
+      }
+      // A periodic direction shorter than the expanded range would repeat elements
+      std::sort(range[d].begin(), range[d].end());
+      range[d].erase(std::unique(range[d].begin(), range[d].end()), range[d].end());
+    }
+
+    for (const auto k : range[2])
+      for (const auto j : range[1])
+        for (const auto i : range[0])
+        {
+          const Index ijk = {{i, j, k}};
+          if (!own.contains(ijk))
+            f(ijk);
+        }
+  }
+
+private:
+  /// The first index of the q-th box in direction d
+  dof_id_type split(unsigned int d, dof_id_type q) const { return q * _n[d] / _p[d]; }
+
+  const Index _n;
+  const std::array<bool, 3> _periodic;
+  std::array<processor_id_type, 3> _p = {{1, 1, 1}};
+};
@@ -0,0 +1,525 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "SymmetricRankFourTensorForward.h"
+#include "SymmetricRankTwoTensor.h"
+#include "RankFourTensor.h"
+
+#include <utility>
+#include <vector>
+
+/**
+ * SymmetricRankFourTensorTempl holds a fourth order tensor with both minor symmetries
+ * (C_ijkl = C_jikl = C_ijlk, e.g. an elasticity tensor) as the 6x6 matrix of its Mandel
+ * components, 36 values instead of the 81 of RankFourTensorTempl.
+ *
+ * With Mandel components M_ab = w_a w_b C_ijkl, where (i, j) and (k, l) are the index pairs of
+ * the SymmetricRankTwoTensorTempl components a and b and w is the Mandel factor, contraction with
+ * a SymmetricRankTwoTensorTempl is a matrix vector product and the product of two tensors is a
+ * matrix product.
+ */
+template <typename T>
+class SymmetricRankFourTensorTempl
+{
+public:
+  /// Number of rows (and columns) of the Mandel matrix
+  static constexpr unsigned int N = SymmetricRankTwoTensorTempl<T>::N;
+  static constexpr unsigned int N2 = N * N;
+
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    /// The identity on symmetric tensors, 0.5 (de_ik de_jl + de_il de_jk)
+    initIdentitySymmetricFour
+  };
+
+  /// The subset of the RankFourTensorTempl fill methods that produce minor symmetric tensors
+  enum FillMethod
+  {
+    symmetric9,
+    symmetric21,
+    symmetric_isotropic,
+    symmetric_isotropic_E_nu
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensorTempl() { zero(); }
+
+  /// Select specific initialization pattern
+  SymmetricRankFourTensorTempl(const InitMethod init)
+  {
+    if (init == initIdentitySymmetricFour)
+    {
+      zero();
+      for (unsigned int a = 0; a < N; ++a)
+        (*this)(a, a) = 1.0;
+    }
+  }
+
+  /// Fill from vector
+  SymmetricRankFourTensorTempl(const std::vector<T> & input, FillMethod fill_method)
+  {
+    fillFromInputVector(input, fill_method);
+  }
+
+  /// Construct from a full tensor, which must have the minor symmetries
+  explicit SymmetricRankFourTensorTempl(const RankFourTensorTempl<T> & a)
+  {
+    for (unsigned int r = 0; r < N; ++r)
+      for (unsigned int c = 0; c < N; ++c)
+        (*this)(r, c) = factor(r, c) * a(row(r), column(r), row(c), column(c));
+  }
+
+  /// Construct from other template
+  template <typename T2>
+  SymmetricRankFourTensorTempl(const SymmetricRankFourTensorTempl<T2> & a)
+  {
+    for (unsigned int i = 0; i < N2; ++i)
+      _vals[i] = a._vals[i];
+  }
+
+  /// The full tensor
+  operator RankFourTensorTempl<T>() const
+  {
+    RankFourTensorTempl<T> result(RankFourTensorTempl<T>::initNone);
+    for (unsigned int i = 0; i < 3; ++i)
+      for (unsigned int j = 0; j < 3; ++j)
+        for (unsigned int k = 0; k < 3; ++k)
+          for (unsigned int l = 0; l < 3; ++l)
+            result(i, j, k, l) = (*this)(i, j, k, l);
+    result._symmetry = RankFourTensorTempl<T>::Symmetry::minor;
+    return result;
+  }
+
+  // Named constructors
+  static SymmetricRankFourTensorTempl IdentitySymmetricFour()
+  {
+    return SymmetricRankFourTensorTempl(initIdentitySymmetricFour);
+  }
+
+  /// Mandel component (r, c), r, c = 0, ..., 5
+  T & operator()(const unsigned int r, const unsigned int c) { return _vals[r * N + c]; }
+  const T & operator()(const unsigned int r, const unsigned int c) const
+  {
+    return _vals[r * N + c];
+  }
+
+  /// Tensor entry (i, j, k, l), i, j, k, l = 0, 1, 2
+  T operator()(const unsigned int i,
+               const unsigned int j,
+               const unsigned int k,
+               const unsigned int l) const
+  {
+    const auto r = SymmetricRankTwoTensorTempl<T>::mandelIndex(i, j);
+    const auto c = SymmetricRankTwoTensorTempl<T>::mandelIndex(k, l);
+    return (*this)(r, c) / factor(r, c);
+  }
+
+  /// Zeros out the tensor
+  void zero()
+  {
+    for (unsigned int i = 0; i < N2; ++i)
+      _vals[i] = 0.0;
+  }
+
+  /// Assignment-from-scalar operator, used only to zero out the tensor
+  template <typename Scalar>
+  typename boostcopy::enable_if_c<ScalarTraits<Scalar>::value,
+                                  SymmetricRankFourTensorTempl &>::type
+  operator=(const Scalar & libmesh_dbg_var(p))
+  {
+    libmesh_assert_equal_to(p, Scalar(0));
+    zero();
+    return *this;
+  }
+
+  /**
+   * Fill from the same inputs as RankFourTensorTempl::fillFromInputVector for the minor symmetric
+   * fill methods
+   */
+  void fillFromInputVector(const std::vector<T> & input, FillMethod fill_method)
+  {
+    switch (fill_method)
+    {
+      case symmetric9:
+      {
+        if (input.size() != 9)
+          mooseError("To use symmetric9, your input must have size 9. Yours has size ",
+                     input.size());
+
+        // C1111 C1122 C1133 C2222 C2233 C3333 C2323 C1313 C1212
+        zero();
+        setVoigt(0, 0, input[0]);
+        setVoigt(0, 1, input[1]);
+        setVoigt(0, 2, input[2]);
+        setVoigt(1, 1, input[3]);
+        setVoigt(1, 2, input[4]);
+        setVoigt(2, 2, input[5]);
+        setVoigt(3, 3, input[6]);
+        setVoigt(4, 4, input[7]);
+        setVoigt(5, 5, input[8]);
+        break;
+      }
+
+      case symmetric21:
+      {
+        if (input.size() != 21)
+          mooseError("To use symmetric21, your input must have size 21. Yours has size ",
+                     input.size());
+
+        // Upper triangle of the Voigt matrix, row by row
+        unsigned int index = 0;
+        for (unsigned int r = 0; r < N; ++r)
+          for (unsigned int c = r; c < N; ++c)
+            setVoigt(r, c, input[index++]);
+        break;
+      }
+
+      case symmetric_isotropic:
+        if (input.size() != 2)
+          mooseError("To use symmetric_isotropic, your input must have size 2. Yours has size ",
+                     input.size());
+        fillSymmetricIsotropic(input[0], input[1]);
+        break;
+
+      case symmetric_isotropic_E_nu:
+        if (input.size() != 2)
+          mooseError("To use symmetric_isotropic_E_nu, your input must have size 2. Yours has "
+                     "size ",
+                     input.size());
+        fillSymmetricIsotropicEandNu(input[0], input[1]);
+        break;
+
+      default:
+        mooseError("fillFromInputVector called with unknown fill_method of ", fill_method);
+    }
+  }
+
+  /// C_ijkl = lambda de_ij de_kl + G (de_ik de_jl + de_il de_jk)
+  void fillSymmetricIsotropic(const T & lambda, const T & G)
+  {
+    zero();
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+      for (unsigned int c = 0; c < 3; ++c)
+        (*this)(r, c) = lambda;
+      (*this)(r, r) += 2.0 * G;
+      (*this)(r + 3, r + 3) = 2.0 * G;
+    }
+  }
+
+  /// Isotropic fill from Young's modulus and Poisson's ratio
+  void fillSymmetricIsotropicEandNu(const T & E, const T & nu)
+  {
+    fillSymmetricIsotropic(E * nu / ((1.0 + nu) * (1.0 - 2.0 * nu)), E / (2.0 * (1.0 + nu)));
+  }
+
+  ///@{ Arithmetic
+  SymmetricRankFourTensorTempl<T> & operator+=(const SymmetricRankFourTensorTempl<T> & a)
+  {
+    for (unsigned int i = 0; i < N2; ++i)
+      _vals[i] += a._vals[i];
+    return *this;
+  }
+
+  SymmetricRankFourTensorTempl<T> & operator-=(const SymmetricRankFourTensorTempl<T> & a)
+  {
+    for (unsigned int i = 0; i < N2; ++i)
+      _vals[i] -= a._vals[i];
+    return *this;
+  }
+
+  SymmetricRankFourTensorTempl<T> & operator*=(const T & a)
+  {
+    for (unsigned int i = 0; i < N2; ++i)
+      _vals[i] *= a;
+    return *this;
+  }
+
+  SymmetricRankFourTensorTempl<T> & operator/=(const T & a)
+  {
+    for (unsigned int i = 0; i < N2; ++i)
+      _vals[i] /= a;
+    return *this;
+  }
+
+  template <typename T2>
+  auto operator+(const SymmetricRankFourTensorTempl<T2> & a) const
+      -> SymmetricRankFourTensorTempl<decltype(T() + T2())>
+  {
+    SymmetricRankFourTensorTempl<decltype(T() + T2())> result(
+        SymmetricRankFourTensorTempl<decltype(T() + T2())>::initNone);
+    for (unsigned int i = 0; i < N2; ++i)
+      result._vals[i] = _vals[i] + a._vals[i];
+    return result;
+  }
+
+  template <typename T2>
+  auto operator-(const SymmetricRankFourTensorTempl<T2> & a) const
+      -> SymmetricRankFourTensorTempl<decltype(T() - T2())>
+  {
+    SymmetricRankFourTensorTempl<decltype(T() - T2())> result(
+        SymmetricRankFourTensorTempl<decltype(T() - T2())>::initNone);
+    for (unsigned int i = 0; i < N2; ++i)
+      result._vals[i] = _vals[i] - a._vals[i];
+    return result;
+  }
+
+  SymmetricRankFourTensorTempl<T> operator-() const
+  {
+    SymmetricRankFourTensorTempl<T> result(initNone);
+    for (unsigned int i = 0; i < N2; ++i)
+      result._vals[i] = -_vals[i];
+    return result;
+  }
+
+  template <typename T2>
+  auto operator*(const T2 & a) const ->
+      typename std::enable_if<ScalarTraits<T2>::value,
+                              SymmetricRankFourTensorTempl<decltype(T() * T2())>>::type
+  {
+    SymmetricRankFourTensorTempl<decltype(T() * T2())> result(
+        SymmetricRankFourTensorTempl<decltype(T() * T2())>::initNone);
+    for (unsigned int i = 0; i < N2; ++i)
+      result._vals[i] = _vals[i] * a;
+    return result;
+  }
+
+  template <typename T2>
+  auto operator/(const T2 & a) const ->
+      typename std::enable_if<ScalarTraits<T2>::value,
+                              SymmetricRankFourTensorTempl<decltype(T() / T2())>>::type
+  {
+    SymmetricRankFourTensorTempl<decltype(T() / T2())> result(
+        SymmetricRankFourTensorTempl<decltype(T() / T2())>::initNone);
+    for (unsigned int i = 0; i < N2; ++i)
+      result._vals[i] = _vals[i] / a;
+    return result;
+  }
+
+  /// C_ijkl*a_kl
+  template <typename T2>
+  auto operator*(const SymmetricRankTwoTensorTempl<T2> & a) const
+      -> SymmetricRankTwoTensorTempl<decltype(T() * T2())>
+  {
+    typedef decltype(T() * T2()) ValueType;
+    SymmetricRankTwoTensorTempl<ValueType> result(SymmetricRankTwoTensorTempl<ValueType>::initNone);
+
+    unsigned int index = 0;
+    for (unsigned int r = 0; r < N; ++r)
+    {
+      ValueType tmp = 0;
+      for (unsigned int c = 0; c < N; ++c)
+        tmp += _vals[index++] * a(c);
+      result(r) = tmp;
+    }
+
+    return result;
+  }
+
+  /// C_ijpq*a_pqkl
+  template <typename T2>
+  auto operator*(const SymmetricRankFourTensorTempl<T2> & a) const
+      -> SymmetricRankFourTensorTempl<decltype(T() * T2())>
+  {
+    typedef decltype(T() * T2()) ValueType;
+    SymmetricRankFourTensorTempl<ValueType> result;
+
+    for (unsigned int r = 0; r < N; ++r)
+      for (unsigned int p = 0; p < N; ++p)
+      {
+        const T & c_rp = (*this)(r, p);
+        for (unsigned int c = 0; c < N; ++c)
+          result(r, c) += c_rp * a(p, c);
+      }
+
+    return result;
+  }
+  ///@}
+
+  /// Transpose the tensor by swapping the first pair with the second pair of indices
+  SymmetricRankFourTensorTempl<T> transposeMajor() const
+  {
+    SymmetricRankFourTensorTempl<T> result(initNone);
+    for (unsigned int r = 0; r < N; ++r)
+      for (unsigned int c = 0; c < N; ++c)
+        result(c, r) = (*this)(r, c);
+    return result;
+  }
+
+  /**
+   * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm), i.e. the inverse
+   * of the Mandel matrix
+   */
+  SymmetricRankFourTensorTempl<T> invSymm() const
+  {
+    using std::abs;
+
+    // Gauss-Jordan elimination with partial pivoting
+    SymmetricRankFourTensorTempl<T> a(*this);
+    SymmetricRankFourTensorTempl<T> result(initIdentitySymmetricFour);
+    for (unsigned int c = 0; c < N; ++c)
+    {
+      unsigned int pivot = c;
+      for (unsigned int r = c + 1; r < N; ++r)
+        if (abs(a(r, c)) > abs(a(pivot, c)))
+          pivot = r;
+
+      if (a(pivot, c) == 0)
+        mooseError("SymmetricRankFourTensor::invSymm(): the tensor is singular");
+
+      if (pivot != c)
+        for (unsigned int k = 0; k < N; ++k)
+        {
+          std::swap(a(c, k), a(pivot, k));
+          std::swap(result(c, k), result(pivot, k));
+        }
+
+      const T inv = 1.0 / a(c, c);
+      for (unsigned int k = 0; k < N; ++k)
+      {
+        a(c, k) *= inv;
+        result(c, k) *= inv;
+      }
+
+      for (unsigned int r = 0; r < N; ++r)
+        if (r != c)
+        {
+          const T f = a(r, c);
+          for (unsigned int k = 0; k < N; ++k)
+          {
+            a(r, k) -= f * a(c, k);
+            result(r, k) -= f * result(c, k);
+          }
+        }
+    }
+
+    return result;
+  }
+
+  /// sqrt(C_ijkl*C_ijkl)
+  T L2norm() const
+  {
+    using std::sqrt;
+    T norm_sq = 0;
+    for (unsigned int i = 0; i < N2; ++i)
+      norm_sq += _vals[i] * _vals[i];
+    return norm_sq == 0 ? T(0) : sqrt(norm_sq);
+  }
+
+  /// checks if the tensor has the major symmetry C_ijkl = C_klij
+  bool isSymmetric() const
+  {
+    for (unsigned int r = 1; r < N; ++r)
+      for (unsigned int c = 0; c < r; ++c)
+        if ((*this)(r, c) != (*this)(c, r))
+          return false;
+    return true;
+  }
+
+  /// Print the rank four tensor
+  void print(std::ostream & stm = Moose::out) const
+  {
+    static_cast<RankFourTensorTempl<T>>(*this).print(stm);
+  }
+
+protected:
+  /// The Mandel matrix, row major
+  T _vals[N2];
+
+  ///@{ See SymmetricRankTwoTensorTempl
+  static unsigned int row(const unsigned int a) { return SymmetricRankTwoTensorTempl<T>::row(a); }
+  static unsigned int column(const unsigned int a)
+  {
+    return SymmetricRankTwoTensorTempl<T>::column(a);
+  }
+  ///@}
+
+  /// The Mandel factor of component (r, c)
+  static Real factor(const unsigned int r, const unsigned int c)
+  {
+    return SymmetricRankTwoTensorTempl<T>::mandelFactor(r) *
+           SymmetricRankTwoTensorTempl<T>::mandelFactor(c);
+  }
+
+  /// Set the symmetric pair of Mandel components from a Voigt (i.e. tensor) entry
+  void setVoigt(const unsigned int r, const unsigned int c, const T & value)
+  {
+    (*this)(r, c) = factor(r, c) * value;
+    (*this)(c, r) = (*this)(r, c);
+  }
+
+  template <class T2>
+  friend void dataStore(std::ostream &, SymmetricRankFourTensorTempl<T2> &, void *);
+
+  template <class T2>
+  friend void dataLoad(std::istream &, SymmetricRankFourTensorTempl<T2> &, void *);
+
+  template <typename T2>
+  friend class SymmetricRankFourTensorTempl;
+};
+
+namespace MathUtils
+{
+template <typename T>
+void mooseSetToZero(T & v);
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+inline void
+mooseSetToZero<SymmetricRankFourTensor>(SymmetricRankFourTensor & v)
+{
+  v.zero();
+}
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+inline void
+mooseSetToZero<ADSymmetricRankFourTensor>(ADSymmetricRankFourTensor & v)
+{
+  v.zero();
+}
+}
+
+namespace MetaPhysicL
+{
+template <typename T>
+struct RawType<SymmetricRankFourTensorTempl<T>>
+{
+  typedef SymmetricRankFourTensorTempl<typename RawType<T>::value_type> value_type;
+
+  static value_type value(const SymmetricRankFourTensorTempl<T> & in)
+  {
+    value_type ret(value_type::initNone);
+    for (unsigned int r = 0; r < value_type::N; ++r)
+      for (unsigned int c = 0; c < value_type::N; ++c)
+        ret(r, c) = raw_value(in(r, c));
+
+    return ret;
+  }
+};
+}
+
+template <typename T1, typename T2>
+inline auto
+operator*(const T1 & a, const SymmetricRankFourTensorTempl<T2> & b) ->
+    typename std::enable_if<ScalarTraits<T1>::value,
+                            SymmetricRankFourTensorTempl<decltype(T1() * T2())>>::type
+{
+  return b * a;
+}
@@ -0,0 +1,18 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ADRealForward.h"
+
+template <typename>
+class SymmetricRankFourTensorTempl;
+
+typedef SymmetricRankFourTensorTempl<Real> SymmetricRankFourTensor;
+typedef SymmetricRankFourTensorTempl<ADReal> ADSymmetricRankFourTensor;
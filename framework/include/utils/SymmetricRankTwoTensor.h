@@ -0,0 +1,383 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "SymmetricRankTwoTensorForward.h"
+#include "Moose.h"
+#include "MooseError.h"
+#include "RankTwoTensor.h"
+
+#include "libmesh/libmesh.h"
+
+#include "metaphysicl/raw_type.h"
+
+#include <cmath>
+#include <ostream>
+
+/**
+ * SymmetricRankTwoTensorTempl holds a symmetric second order tensor (stress, strain) as its 6
+ * independent components instead of the 9 entries of RankTwoTensorTempl.
+ *
+ * The components are stored in Mandel notation
+ *   (S11, S22, S33, sqrt(2) S23, sqrt(2) S13, sqrt(2) S12)
+ * so that the double contraction of two tensors is the dot product of their component vectors
+ * and SymmetricRankFourTensorTempl products are plain 6x6 matrix products. operator()(i, j)
+ * returns the tensor entries without the Mandel factors.
+ */
+template <typename T>
+class SymmetricRankTwoTensorTempl
+{
+public:
+  /// Number of independent components
+  static constexpr unsigned int N = 6;
+
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentity
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankTwoTensorTempl() { zero(); }
+
+  /// Select specific initialization pattern
+  SymmetricRankTwoTensorTempl(const InitMethod init)
+  {
+    if (init == initIdentity)
+    {
+      zero();
+      _vals[0] = _vals[1] = _vals[2] = 1.0;
+    }
+  }
+
+  /// Construct from the tensor entries
+  SymmetricRankTwoTensorTempl(const T & S11,
+                              const T & S22,
+                              const T & S33,
+                              const T & S23,
+                              const T & S13,
+                              const T & S12)
+  {
+    _vals[0] = S11;
+    _vals[1] = S22;
+    _vals[2] = S33;
+    _vals[3] = mandelFactor(3) * S23;
+    _vals[4] = mandelFactor(4) * S13;
+    _vals[5] = mandelFactor(5) * S12;
+  }
+
+  /// Construct from the symmetric part of a full tensor
+  explicit SymmetricRankTwoTensorTempl(const RankTwoTensorTempl<T> & a)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _vals[i] = mandelFactor(i) * 0.5 * (a(row(i), column(i)) + a(column(i), row(i)));
+  }
+
+  /// Construct from other template
+  template <typename T2>
+  SymmetricRankTwoTensorTempl(const SymmetricRankTwoTensorTempl<T2> & a)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _vals[i] = a(i);
+  }
+
+  /// The full tensor
+  operator RankTwoTensorTempl<T>() const
+  {
+    return RankTwoTensorTempl<T>((*this)(0, 0),
+                                 (*this)(1, 1),
+                                 (*this)(2, 2),
+                                 (*this)(1, 2),
+                                 (*this)(0, 2),
+                                 (*this)(0, 1));
+  }
+
+  // Named constructors
+  static SymmetricRankTwoTensorTempl Identity()
+  {
+    return SymmetricRankTwoTensorTempl(initIdentity);
+  }
+
+  ///@{ Mandel index helpers: component i holds the (row(i), column(i)) entry times mandelFactor(i)
+  static unsigned int row(const unsigned int i)
+  {
+    static const unsigned int rows[N] = {0, 1, 2, 1, 0, 0};
+    return rows[i];
+  }
+  static unsigned int column(const unsigned int i)
+  {
+    static const unsigned int columns[N] = {0, 1, 2, 2, 2, 1};
+    return columns[i];
+  }
+  static unsigned int mandelIndex(const unsigned int i, const unsigned int j)
+  {
+    static const unsigned int index[3][3] = {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}};
+    return index[i][j];
+  }
+  static Real mandelFactor(const unsigned int i) { return i < 3 ? 1.0 : M_SQRT2; }
+  ///@}
+
+  /// Mandel component i = 0, ..., 5
+  T & operator()(const unsigned int i) { return _vals[i]; }
+  const T & operator()(const unsigned int i) const { return _vals[i]; }
+
+  /// Tensor entry (i, j), i, j = 0, 1, 2
+  T operator()(const unsigned int i, const unsigned int j) const
+  {
+    const auto a = mandelIndex(i, j);
+    return a < 3 ? _vals[a] : _vals[a] / M_SQRT2;
+  }
+
+  /// Set tensor entry (i, j) and its symmetric counterpart
+  void set(const unsigned int i, const unsigned int j, const T & value)
+  {
+    const auto a = mandelIndex(i, j);
+    _vals[a] = mandelFactor(a) * value;
+  }
+
+  /// Zeros out the tensor
+  void zero()
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _vals[i] = 0.0;
+  }
+
+  /// Assignment-from-scalar operator, used only to zero out the tensor
+  template <typename Scalar>
+  typename boostcopy::enable_if_c<ScalarTraits<Scalar>::value,
+                                  SymmetricRankTwoTensorTempl &>::type
+  operator=(const Scalar & libmesh_dbg_var(p))
+  {
+    libmesh_assert_equal_to(p, Scalar(0));
+    zero();
+    return *this;
+  }
+
+  ///@{ Arithmetic
+  SymmetricRankTwoTensorTempl<T> & operator+=(const SymmetricRankTwoTensorTempl<T> & a)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _vals[i] += a._vals[i];
+    return *this;
+  }
+
+  SymmetricRankTwoTensorTempl<T> & operator-=(const SymmetricRankTwoTensorTempl<T> & a)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _vals[i] -= a._vals[i];
+    return *this;
+  }
+
+  SymmetricRankTwoTensorTempl<T> & operator*=(const T & a)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _vals[i] *= a;
+    return *this;
+  }
+
+  SymmetricRankTwoTensorTempl<T> & operator/=(const T & a)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _vals[i] /= a;
+    return *this;
+  }
+
+  template <typename T2>
+  auto operator+(const SymmetricRankTwoTensorTempl<T2> & a) const
+      -> SymmetricRankTwoTensorTempl<decltype(T() + T2())>
+  {
+    SymmetricRankTwoTensorTempl<decltype(T() + T2())> result(
+        SymmetricRankTwoTensorTempl<decltype(T() + T2())>::initNone);
+    for (unsigned int i = 0; i < N; ++i)
+      result(i) = _vals[i] + a(i);
+    return result;
+  }
+
+  template <typename T2>
+  auto operator-(const SymmetricRankTwoTensorTempl<T2> & a) const
+      -> SymmetricRankTwoTensorTempl<decltype(T() - T2())>
+  {
+    SymmetricRankTwoTensorTempl<decltype(T() - T2())> result(
+        SymmetricRankTwoTensorTempl<decltype(T() - T2())>::initNone);
+    for (unsigned int i = 0; i < N; ++i)
+      result(i) = _vals[i] - a(i);
+    return result;
+  }
+
+  SymmetricRankTwoTensorTempl<T> operator-() const
+  {
+    SymmetricRankTwoTensorTempl<T> result(initNone);
+    for (unsigned int i = 0; i < N; ++i)
+      result._vals[i] = -_vals[i];
+    return result;
+  }
+
+  template <typename T2>
+  auto operator*(const T2 & a) const ->
+      typename std::enable_if<ScalarTraits<T2>::value,
+                              SymmetricRankTwoTensorTempl<decltype(T() * T2())>>::type
+  {
+    SymmetricRankTwoTensorTempl<decltype(T() * T2())> result(
+        SymmetricRankTwoTensorTempl<decltype(T() * T2())>::initNone);
+    for (unsigned int i = 0; i < N; ++i)
+      result(i) = _vals[i] * a;
+    return result;
+  }
+
+  template <typename T2>
+  auto operator/(const T2 & a) const ->
+      typename std::enable_if<ScalarTraits<T2>::value,
+                              SymmetricRankTwoTensorTempl<decltype(T() / T2())>>::type
+  {
+    SymmetricRankTwoTensorTempl<decltype(T() / T2())> result(
+        SymmetricRankTwoTensorTempl<decltype(T() / T2())>::initNone);
+    for (unsigned int i = 0; i < N; ++i)
+      result(i) = _vals[i] / a;
+    return result;
+  }
+  ///@}
+
+  /// Defines logical equality with another SymmetricRankTwoTensorTempl<T>
+  bool operator==(const SymmetricRankTwoTensorTempl<T> & a) const
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      if (_vals[i] != a._vals[i])
+        return false;
+    return true;
+  }
+
+  /// The tensor is symmetric
+  SymmetricRankTwoTensorTempl<T> transpose() const { return *this; }
+
+  /// returns A_ij * b_ij
+  T doubleContraction(const SymmetricRankTwoTensorTempl<T> & b) const
+  {
+    T result = 0;
+    for (unsigned int i = 0; i < N; ++i)
+      result += _vals[i] * b._vals[i];
+    return result;
+  }
+
+  /// returns the trace of the tensor, ie _vals[i][i] (sum i = 0, 1, 2)
+  T tr() const { return _vals[0] + _vals[1] + _vals[2]; }
+
+  /// returns A_ij - de_ij*tr(A)/3, ie the deviatoric part of the tensor
+  SymmetricRankTwoTensorTempl<T> deviatoric() const
+  {
+    SymmetricRankTwoTensorTempl<T> result(*this);
+    const T mean = tr() / 3.0;
+    for (unsigned int i = 0; i < 3; ++i)
+      result._vals[i] -= mean;
+    return result;
+  }
+
+  /// Denote the _vals[i][j] by A_ij, then S_ij = A_ij - de_ij*tr(A)/3; returns S_ij*S_ij/2
+  T secondInvariant() const
+  {
+    const auto s = deviatoric();
+    return 0.5 * s.doubleContraction(s);
+  }
+
+  /// Sqrt(A_ij*A_ij)
+  T L2norm() const
+  {
+    using std::sqrt;
+    const T norm_sq = doubleContraction(*this);
+    return norm_sq == 0 ? T(0) : sqrt(norm_sq);
+  }
+
+  /// Determinant of the tensor
+  T det() const
+  {
+    const auto & A = *this;
+    return A(0, 0) * (A(1, 1) * A(2, 2) - A(1, 2) * A(1, 2)) -
+           A(0, 1) * (A(0, 1) * A(2, 2) - A(1, 2) * A(0, 2)) +
+           A(0, 2) * (A(0, 1) * A(1, 2) - A(1, 1) * A(0, 2));
+  }
+
+  /// Returns R A R^T
+  SymmetricRankTwoTensorTempl<T> rotated(const RankTwoTensorTempl<T> & R) const
+  {
+    const RankTwoTensorTempl<T> full = *this;
+    return SymmetricRankTwoTensorTempl<T>(R * full * R.transpose());
+  }
+
+  /// Print the tensor
+  void print(std::ostream & stm = Moose::out) const
+  {
+    static_cast<RankTwoTensorTempl<T>>(*this).print(stm);
+  }
+
+protected:
+  /// The Mandel components
+  T _vals[N];
+
+  template <class T2>
+  friend void dataStore(std::ostream &, SymmetricRankTwoTensorTempl<T2> &, void *);
+
+  template <class T2>
+  friend void dataLoad(std::istream &, SymmetricRankTwoTensorTempl<T2> &, void *);
+};
+
+namespace MathUtils
+{
+template <typename T>
+void mooseSetToZero(T & v);
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+inline void
+mooseSetToZero<SymmetricRankTwoTensor>(SymmetricRankTwoTensor & v)
+{
+  v.zero();
+}
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+inline void
+mooseSetToZero<ADSymmetricRankTwoTensor>(ADSymmetricRankTwoTensor & v)
+{
+  v.zero();
+}
+}
+
+namespace MetaPhysicL
+{
+template <typename T>
+struct RawType<SymmetricRankTwoTensorTempl<T>>
+{
+  typedef SymmetricRankTwoTensorTempl<typename RawType<T>::value_type> value_type;
+
+  static value_type value(const SymmetricRankTwoTensorTempl<T> & in)
+  {
+    value_type ret(value_type::initNone);
+    for (unsigned int i = 0; i < value_type::N; ++i)
+      ret(i) = raw_value(in(i));
+
+    return ret;
+  }
+};
+}
+
+template <typename T1, typename T2>
+inline auto
+operator*(const T1 & a, const SymmetricRankTwoTensorTempl<T2> & b) ->
+    typename std::enable_if<ScalarTraits<T1>::value,
+                            SymmetricRankTwoTensorTempl<decltype(T1() * T2())>>::type
+{
+  return b * a;
+}
@@ -0,0 +1,155 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+#include "VariadicTable.h"
+
+#include "libmesh/parallel.h"
+#include "libmesh/threads.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Accumulated wall time of the threaded loops, per section and per thread.
+ *
+ * The PerfGraph only times the main thread. The threaded element loops additionally record the
+ * time each thread spends in its share of the loop here (see
+ * ThreadedElementLoopBase::setThreadTiming()), so that PerfGraphOutput can report how well the
+ * work is balanced across threads and ranks.
+ */
+class ThreadTimingTable
+{
+public:
+  /// Summary of the time of one section across threads (or ranks)
+  struct Stats
+  {
+    Real min = 0;
+    Real max = 0;
+    Real mean = 0;
+
+    /// max / mean, 1 for perfectly balanced work
+    Real imbalance() const { return mean > 0 ? max / mean : 1; }
+  };
+
+  ThreadTimingTable(unsigned int n_threads) : _n_threads(n_threads) {}
+
+  /**
+   * Add time spent by a thread in a section. Thread safe.
+   */
+  void add(const std::string & section, THREAD_ID tid, Real seconds)
+  {
+    mooseAssert(tid < _n_threads, "Thread id exceeds the thread count of the timing table");
+
+    // Sections are only created on first use, recording into existing ones does not need the lock
+    // since every thread only touches its own entry
+    std::vector<Real> * times;
+    {
+      libMesh::Threads::spin_mutex::scoped_lock lock(_mutex);
+      times = &_times.emplace(section, std::vector<Real>(_n_threads, 0.)).first->second;
+    }
+    (*times)[tid] += seconds;
+  }
+
+  /// Summary across the threads of this rank
+  Stats threadStats(const std::string & section) const
+  {
+    Stats stats;
+    const auto it = _times.find(section);
+    if (it == _times.end())
+      return stats;
+
+    const auto & times = it->second;
+    stats.min = *std::min_element(times.begin(), times.end());
+    stats.max = *std::max_element(times.begin(), times.end());
+    for (const auto time : times)
+      stats.mean += time;
+    stats.mean /= times.size();
+    return stats;
+  }
+
+  /**
+   * Summary across ranks of the per-rank maximum thread time (i.e. the time the rank took).
+   * Collective: every rank must call this for the same section.
+   */
+  Stats rankStats(const std::string & section, const Parallel::Communicator & comm) const
+  {
+    Stats stats;
+    stats.max = stats.min = stats.mean = threadStats(section).max;
+    comm.min(stats.min);
+    comm.max(stats.max);
+    comm.sum(stats.mean);
+    stats.mean /= comm.size();
+    return stats;
+  }
+
+  /// The recorded sections
+  std::vector<std::string> sections() const
+  {
+    std::vector<std::string> names;
+    for (const auto & pr : _times)
+      names.push_back(pr.first);
+    return names;
+  }
+
+  /// Forget all recorded times
+  void clear() { _times.clear(); }
+
+  /**
+   * Print the thread and rank summaries of every section. Collective; sections must have been
+   * recorded on every rank (which is the case for the threaded loops).
+   */
+  template <typename StreamType>
+  void print(StreamType & stream, const Parallel::Communicator & comm) const
+  {
+    VariadicTable<std::string, Real, Real, Real, Real, Real, Real, Real, Real> table(
+        {"Section",
+         "Thread Min (s)",
+         "Thread Max (s)",
+         "Thread Mean (s)",
+         "Thread Imbalance",
+         "Rank Min (s)",
+         "Rank Max (s)",
+         "Rank Mean (s)",
+         "Rank Imbalance"},
+        10);
+
+    for (const auto & pr : _times)
+    {
+      const auto threads = threadStats(pr.first);
+      const auto ranks = rankStats(pr.first, comm);
+      table.addRow(pr.first,
+                   threads.min,
+                   threads.max,
+                   threads.mean,
+                   threads.imbalance(),
+                   ranks.min,
+                   ranks.max,
+                   ranks.mean,
+                   ranks.imbalance());
+    }
+
+    table.print(stream);
+  }
+
+private:
+  /// The number of threads
+  const unsigned int _n_threads;
+
+  /// Accumulated time per section and thread
+  std::map<std::string, std::vector<Real>> _times;
+
+  /// Protects the creation of sections
+  libMesh::Threads::spin_mutex _mutex;
+};
@@ -18,6 +18,7 @@
 #include "libmesh/type_n_tensor.h"
 #include "libmesh/fe_type.h"
 #include "ADUtils.h"
+#include "SubdomainRequests.h"
 
 #include <functional>
 #include <vector>
@@ -105,6 +106,13 @@ public:
    */
   void setGeometry(Moose::GeometryType gm_type);
 
+  /**
+   * Selects the quantities requested by the objects of a subdomain: computeValues() then only
+   * fills the second derivatives, curls, old/older and time derivative values requested there
+   * (see SubdomainRequests); the other quantities keep their values of the previous element.
+   */
+  void subdomainSetup(SubdomainID block) { _subdomain_requests.subdomainSetup(block); }
+
   //////////////// Heavy lifting computational routines //////////////////////////////
 
   /**
@@ -604,6 +612,9 @@ private:
   mutable bool _need_curl_old;
   mutable bool _need_curl_older;
 
+  /// The subdomains on which the quantities flagged above were requested
+  mutable SubdomainRequests _subdomain_requests;
+
   /// AD flags
   mutable bool _need_ad;
   mutable bool _need_ad_u;
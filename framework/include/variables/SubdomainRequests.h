@@ -0,0 +1,114 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <set>
+#include <unordered_map>
+
+/**
+ * Sets the subdomains of the object under construction, to which the variable quantities it
+ * requests are attributed (see SubdomainRequests). FEProblemBase opens a scope around the creation
+ * of each block restricted object; requests made outside of any scope apply to every subdomain.
+ */
+class VariableRequestScope
+{
+public:
+  VariableRequestScope(const std::set<SubdomainID> & blocks) : _previous(current())
+  {
+    current() = &blocks;
+  }
+  ~VariableRequestScope() { current() = _previous; }
+
+  /// The subdomains of the current scope, nullptr for every subdomain
+  static const std::set<SubdomainID> *& current()
+  {
+    static const std::set<SubdomainID> * blocks = nullptr;
+    return blocks;
+  }
+
+private:
+  const std::set<SubdomainID> * const _previous;
+};
+
+/**
+ * The quantities of a variable requested on each subdomain, so that computing the values of the
+ * variable on an element only fills those requested by the objects of its subdomain: second
+ * derivatives requested by a kernel of one block are then not computed on the others.
+ */
+class SubdomainRequests
+{
+public:
+  /// The quantities tracked per subdomain, the expensive or rarely needed ones
+  enum Quantity
+  {
+    SECOND = 0,
+    SECOND_OLD,
+    SECOND_OLDER,
+    SECOND_PREVIOUS_NL,
+    CURL,
+    CURL_OLD,
+    CURL_OLDER,
+    U_OLD,
+    U_OLDER,
+    GRAD_OLD,
+    GRAD_OLDER,
+    U_DOT,
+    U_DOTDOT,
+    U_DOT_OLD,
+    U_DOTDOT_OLD,
+    GRAD_DOT,
+    GRAD_DOTDOT
+  };
+
+  /// Records a request for the subdomains of the current VariableRequestScope
+  void record(Quantity quantity)
+  {
+    const auto bit = mask(quantity);
+    const auto * blocks = VariableRequestScope::current();
+    if (!blocks || blocks->count(Moose::ANY_BLOCK_ID))
+      _all_blocks |= bit;
+    else
+      for (const auto block : *blocks)
+        _blocks[block] |= bit;
+
+    if (_block == Moose::INVALID_BLOCK_ID)
+      _active |= bit;
+    else
+      subdomainSetup(_block);
+  }
+
+  /**
+   * Selects the quantities requested on a subdomain; until it is first called every requested
+   * quantity is active, whatever its subdomains
+   */
+  void subdomainSetup(SubdomainID block)
+  {
+    _block = block;
+    const auto it = _blocks.find(block);
+    _active = _all_blocks | (it == _blocks.end() ? 0 : it->second);
+  }
+
+  /// Whether a quantity is requested on the current subdomain
+  bool active(Quantity quantity) const { return _active & mask(quantity); }
+
+private:
+  static unsigned int mask(Quantity quantity) { return 1u << quantity; }
+
+  /// The quantities requested on every subdomain
+  unsigned int _all_blocks = 0;
+  /// The quantities requested on each subdomain, besides _all_blocks
+  std::unordered_map<SubdomainID, unsigned int> _blocks;
+  /// The current subdomain, see subdomainSetup()
+  SubdomainID _block = Moose::INVALID_BLOCK_ID;
+  /// The quantities requested on the current subdomain
+  unsigned int _active = 0;
+};
@@ -109,7 +109,9 @@ public:
   ///@}
 
   /**
-   * Updates the active objects storage.
+   * Updates the active objects storage. Only the lists holding objects that were enabled or
+   * disabled since the last update are rebuilt, so that calling this after every execution of the
+   * controls costs little when they toggled nothing.
    */
   virtual void updateActive(THREAD_ID tid = 0);
 
@@ -194,6 +196,75 @@ protected:
   /// Active boundary restricted objects (THREAD_ID on outer vector)
   std::vector<std::map<BoundaryID, std::vector<std::shared_ptr<T>>>> _active_boundary_objects;
 
+  /**
+   * The entries of a map of active objects indexed directly by id - lowest id, so that the lookup
+   * of the objects of a subdomain (boundary), done by the loops at every subdomain change, is an
+   * index instead of a map search. The table is only built when the ids are dense; otherwise
+   * find() falls back to the map.
+   */
+  template <typename ID>
+  class IndexedObjects
+  {
+  public:
+    IndexedObjects() = default;
+
+    ///@{ The table points into the map of the copied warehouse: a copy starts without a table and
+    /// uses its own map until it is rebuilt
+    IndexedObjects(const IndexedObjects &) {}
+    IndexedObjects & operator=(const IndexedObjects &)
+    {
+      _entries.clear();
+      return *this;
+    }
+    ///@}
+
+    /// Rebuilds the table, must be called whenever an id is added to the map
+    void build(const std::map<ID, std::vector<std::shared_ptr<T>>> & objects)
+    {
+      _entries.clear();
+      if (objects.empty())
+        return;
+
+      const ID lowest = objects.begin()->first;
+      const std::size_t range = objects.rbegin()->first - lowest + 1;
+      if (range > 4 * objects.size() + 64)
+        return;
+
+      _lowest = lowest;
+      _entries.assign(range, nullptr);
+      for (const auto & object_pair : objects)
+        _entries[object_pair.first - lowest] = &object_pair.second;
+    }
+
+    /// The objects of the given id in the map, nullptr if it has none
+    const std::vector<std::shared_ptr<T>> *
+    find(const std::map<ID, std::vector<std::shared_ptr<T>>> & objects, ID id) const
+    {
+      if (_entries.empty())
+      {
+        const auto iter = objects.find(id);
+        return iter == objects.end() ? nullptr : &iter->second;
+      }
+      if (id < _lowest || static_cast<std::size_t>(id - _lowest) >= _entries.size())
+        return nullptr;
+      return _entries[id - _lowest];
+    }
+
+  private:
+    ID _lowest = 0;
+    std::vector<const std::vector<std::shared_ptr<T>> *> _entries;
+  };
+
+  ///@{ Direct lookups of _active_block_objects and _active_boundary_objects (THREAD_ID on outer
+  /// vector)
+  std::vector<IndexedObjects<SubdomainID>> _active_block_index;
+  std::vector<IndexedObjects<BoundaryID>> _active_boundary_index;
+  ///@}
+
+  /// The enabled state of each of _all_objects at the last updateActive() (THREAD_ID on outer
+  /// vector), emptied when objects are added or reordered to force a complete update
+  std::vector<std::vector<char>> _enabled_state;
+
   /**
    * Helper method for updating active vectors
    */
@@ -238,7 +309,10 @@ MooseObjectWarehouseBase<T>::MooseObjectWarehouseBase(bool threaded /*=true*/)
     _all_block_objects(_num_threads),
     _active_block_objects(_num_threads),
     _all_boundary_objects(_num_threads),
-    _active_boundary_objects(_num_threads)
+    _active_boundary_objects(_num_threads),
+    _active_block_index(_num_threads),
+    _active_boundary_index(_num_threads),
+    _enabled_state(_num_threads)
 {
 }
 
@@ -265,6 +339,7 @@ MooseObjectWarehouseBase<T>::addObject(std::shared_ptr<T> object,
 
   // Stores object in list of all objects
   _all_objects[tid].push_back(object);
+  _enabled_state[tid].clear();
 
   // If enabled, store object in a list of all active
   bool enabled = object->enabled();
@@ -286,6 +361,7 @@ MooseObjectWarehouseBase<T>::addObject(std::shared_ptr<T> object,
       if (enabled)
         _active_boundary_objects[tid][*it].push_back(object);
     }
+    _active_boundary_index[tid].build(_active_boundary_objects[tid]);
   }
 
   // Block Restricted
@@ -299,6 +375,7 @@ MooseObjectWarehouseBase<T>::addObject(std::shared_ptr<T> object,
       if (enabled)
         _active_block_objects[tid][*it].push_back(object);
     }
+    _active_block_index[tid].build(_active_block_objects[tid]);
 
     // Check variables
     std::shared_ptr<Coupleable> c_ptr = std::dynamic_pointer_cast<Coupleable>(object);
@@ -394,10 +471,9 @@ const std::vector<std::shared_ptr<T>> &
 MooseObjectWarehouseBase<T>::getActiveBoundaryObjects(BoundaryID id, THREAD_ID tid /* = 0*/) const
 {
   checkThreadID(tid);
-  const auto iter = _active_boundary_objects[tid].find(id);
-  mooseAssert(iter != _active_boundary_objects[tid].end(),
-              "Unable to located active boundary objects for the given id: " << id << ".");
-  return iter->second;
+  const auto objects = _active_boundary_index[tid].find(_active_boundary_objects[tid], id);
+  mooseAssert(objects, "Unable to located active boundary objects for the given id: " << id << ".");
+  return *objects;
 }
 
 template <typename T>
@@ -413,10 +489,9 @@ const std::vector<std::shared_ptr<T>> &
 MooseObjectWarehouseBase<T>::getActiveBlockObjects(SubdomainID id, THREAD_ID tid /* = 0*/) const
 {
   checkThreadID(tid);
-  const auto iter = _active_block_objects[tid].find(id);
-  mooseAssert(iter != _active_block_objects[tid].end(),
-              "Unable to located active block objects for the given id: " << id << ".");
-  return iter->second;
+  const auto objects = _active_block_index[tid].find(_active_block_objects[tid], id);
+  mooseAssert(objects, "Unable to located active block objects for the given id: " << id << ".");
+  return *objects;
 }
 
 template <typename T>
@@ -451,8 +526,7 @@ bool
 MooseObjectWarehouseBase<T>::hasActiveBlockObjects(SubdomainID id, THREAD_ID tid /* = 0*/) const
 {
   checkThreadID(tid);
-  const auto iter = _active_block_objects[tid].find(id);
-  return iter != _active_block_objects[tid].end();
+  return _active_block_index[tid].find(_active_block_objects[tid], id) != nullptr;
 }
 
 template <typename T>
@@ -471,8 +545,7 @@ bool
 MooseObjectWarehouseBase<T>::hasActiveBoundaryObjects(BoundaryID id, THREAD_ID tid /* = 0*/) const
 {
   checkThreadID(tid);
-  const auto iter = _active_boundary_objects[tid].find(id);
-  return iter != _active_boundary_objects[tid].end();
+  return _active_boundary_index[tid].find(_active_boundary_objects[tid], id) != nullptr;
 }
 
 template <typename T>
@@ -525,13 +598,63 @@ MooseObjectWarehouseBase<T>::updateActive(THREAD_ID tid /*= 0*/)
 {
   checkThreadID(tid);
 
-  updateActiveHelper(_active_objects[tid], _all_objects[tid]);
+  const auto & all = _all_objects[tid];
+  auto & state = _enabled_state[tid];
+
+  // Complete update: the first one or the first one after objects were added or reordered
+  if (state.size() != all.size())
+  {
+    updateActiveHelper(_active_objects[tid], all);
 
-  for (const auto & object_pair : _all_block_objects[tid])
-    updateActiveHelper(_active_block_objects[tid][object_pair.first], object_pair.second);
+    for (const auto & object_pair : _all_block_objects[tid])
+      updateActiveHelper(_active_block_objects[tid][object_pair.first], object_pair.second);
+
+    for (const auto & object_pair : _all_boundary_objects[tid])
+      updateActiveHelper(_active_boundary_objects[tid][object_pair.first], object_pair.second);
+
+    _active_block_index[tid].build(_active_block_objects[tid]);
+    _active_boundary_index[tid].build(_active_boundary_objects[tid]);
+
+    state.resize(all.size());
+    for (std::size_t i = 0; i < all.size(); ++i)
+      state[i] = all[i]->enabled();
+    return;
+  }
+
+  // Otherwise only rebuild the lists of the blocks and boundaries of the toggled objects; their
+  // entries all exist since the complete update, so the direct lookups remain valid
+  std::set<SubdomainID> block_ids;
+  std::set<BoundaryID> boundary_ids;
+  bool changed = false;
+  for (std::size_t i = 0; i < all.size(); ++i)
+  {
+    const char enabled = all[i]->enabled();
+    if (enabled == state[i])
+      continue;
+    state[i] = enabled;
+    changed = true;
+
+    std::shared_ptr<BoundaryRestrictable> bnd =
+        std::dynamic_pointer_cast<BoundaryRestrictable>(all[i]);
+    std::shared_ptr<BlockRestrictable> blk = std::dynamic_pointer_cast<BlockRestrictable>(all[i]);
+    if (bnd && bnd->boundaryRestricted())
+      boundary_ids.insert(bnd->boundaryIDs().begin(), bnd->boundaryIDs().end());
+    else if (blk)
+    {
+      const std::set<SubdomainID> & ids =
+          blk->blockRestricted() ? blk->blockIDs() : blk->meshBlockIDs();
+      block_ids.insert(ids.begin(), ids.end());
+    }
+  }
+
+  if (!changed)
+    return;
 
-  for (const auto & object_pair : _all_boundary_objects[tid])
-    updateActiveHelper(_active_boundary_objects[tid][object_pair.first], object_pair.second);
+  updateActiveHelper(_active_objects[tid], all);
+  for (const auto id : block_ids)
+    updateActiveHelper(_active_block_objects[tid][id], _all_block_objects[tid][id]);
+  for (const auto id : boundary_ids)
+    updateActiveHelper(_active_boundary_objects[tid][id], _all_boundary_objects[tid][id]);
 }
 
 template <typename T>
@@ -563,6 +686,7 @@ MooseObjectWarehouseBase<T>::sort(THREAD_ID tid /* = 0*/)
   sortHelper(_all_objects[tid]);
 
   // The active lists now must be update to reflect the order changes
+  _enabled_state[tid].clear();
   updateActive(tid);
 }
 
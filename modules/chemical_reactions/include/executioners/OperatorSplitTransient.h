@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Transient.h"
+
+// Forward Declarations
+class OperatorSplitReactionUserObject;
+
+/**
+ * Transient executioner of the sequential non-iterative operator split of reactive transport:
+ * each step solves the transport of the primary species, then runs the
+ * OperatorSplitReactionUserObject reaction step before the step ends (so the outputs and the next
+ * step see the reacted state). A reaction step failing at any node fails the time step, which is
+ * then cut like a failed solve.
+ */
+class OperatorSplitTransient : public Transient
+{
+public:
+  static InputParameters validParams();
+
+  OperatorSplitTransient(const InputParameters & parameters);
+
+  virtual void init() override;
+
+  /// Runs the reaction step after the transport solve
+  virtual void postStep() override;
+
+  virtual bool lastSolveConverged() const override;
+
+protected:
+  /// The reaction step
+  OperatorSplitReactionUserObject * _reaction;
+
+  /// Whether the reaction step of the last time step converged at every node
+  bool _reaction_converged;
+};
@@ -0,0 +1,74 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "NodalUserObject.h"
+#include "LocalReactionSolver.h"
+
+/**
+ * The reaction step of the sequential non-iterative operator split: after the transport of the
+ * total primary species concentrations (without the CoupledBEEquilibriumSub and CoupledBEKinetic
+ * coupling, so each species is solved on its own), this object solves the local reaction system
+ * of LocalReactionSolver at every node and writes back the free primary concentrations, the
+ * equilibrium secondary species and the kinetic minerals.
+ *
+ * The network is the one of the AddPrimarySpeciesAction, AddSecondarySpeciesAction and
+ * AddCoupledEqSpeciesAction / AddCoupledSolidKinSpeciesAction inputs, whose actions set the
+ * reaction parameters of this object. The nodal loop of NodalUserObject is threaded, each thread
+ * having its own solver.
+ */
+class OperatorSplitReactionUserObject : public NodalUserObject
+{
+public:
+  static InputParameters validParams();
+
+  OperatorSplitReactionUserObject(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & uo) override;
+  virtual void finalize() override;
+
+  /// The number of nodes whose reaction step did not converge in the last execution
+  unsigned int numFailures() const { return _num_failures; }
+
+protected:
+  /// Builds the network from the parameters set by the reaction actions
+  static ReactionNetwork buildNetwork(const InputParameters & parameters);
+
+  /// The reaction network
+  const ReactionNetwork _network;
+
+  /// The local solver of this thread
+  LocalReactionSolver _solver;
+
+  /// The primary species (total concentrations on entry, free concentrations on exit)
+  std::vector<MooseVariable *> _primary;
+
+  /// The equilibrium secondary species
+  std::vector<MooseVariable *> _secondary;
+
+  /// The kinetic minerals
+  std::vector<MooseVariable *> _minerals;
+
+  /// Newton tolerance and iteration limit of the local solves
+  const Real _tolerance;
+  const unsigned int _max_its;
+
+  ///@{ Local values of a node
+  std::vector<Real> _total;
+  std::vector<Real> _free;
+  std::vector<Real> _mineral_old;
+  std::vector<Real> _mineral;
+  ///@}
+
+  /// Nodes whose reaction step did not converge
+  unsigned int _num_failures;
+};
@@ -0,0 +1,245 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * The reaction network of the AddPrimarySpeciesAction / AddSecondarySpeciesAction inputs, for the
+ * pointwise reaction step of the operator-split mode: the equilibrium secondary species
+ *
+ *   c_i = 10^log10(K_i) prod_j u_j^sto_ij
+ *
+ * (as AqueousEquilibriumRxnAux, with unit activity coefficients) and the kinetic minerals
+ *
+ *   dm_k/dt = A_k kconst_k (Omega_k - 1),  Omega_k = prod_j u_j^sto_kj / 10^log10(K_k)
+ *
+ * (the rate of KineticDisPreRateAux, with the temperature dependence folded into kconst_k).
+ */
+struct ReactionNetwork
+{
+  struct Reaction
+  {
+    /// log10 of the equilibrium constant
+    Real log10_k;
+    /// Stoichiometric coefficient of each primary species
+    std::vector<Real> sto;
+    /// Weight of the secondary species in the total concentration of each primary species
+    std::vector<Real> weight;
+    /// Specific reactive surface area times the rate constant (kinetic reactions only)
+    Real rate = 0;
+  };
+
+  unsigned int n_primary = 0;
+  std::vector<Reaction> equilibrium;
+  std::vector<Reaction> kinetic;
+
+  /// Checks the sizes of the reactions
+  void check() const
+  {
+    for (const auto * reactions : {&equilibrium, &kinetic})
+      for (const auto & r : *reactions)
+        if (r.sto.size() != n_primary || r.weight.size() != n_primary)
+          mooseError("A reaction of the network does not have one stoichiometric coefficient and "
+                     "weight per primary species");
+  }
+};
+
+/**
+ * The local (pointwise) reaction step of the operator split: given the total concentrations T_j
+ * of the primary species after the transport step, finds the free primary concentrations u_j and
+ * the mineral concentrations m_k at the end of the step, backward Euler in time:
+ *
+ *   u_j + sum_i weight_ij c_i(u) + sum_k weight_kj (m_k - m_k^old) = T_j
+ *   m_k - m_k^old - dt A_k kconst_k (Omega_k(u) - 1) = 0
+ *
+ * Newton iterates on ln(u_j), which keeps the concentrations positive, and the m_k. The system has
+ * n_primary + n_kinetic unknowns (some tens), solved densely; the solver keeps its storage, so
+ * one solver per thread visits all its nodes without allocating.
+ */
+class LocalReactionSolver
+{
+public:
+  LocalReactionSolver(const ReactionNetwork & network) : _network(network) { _network.check(); }
+
+  /**
+   * @param dt The time step
+   * @param total The total concentrations T_j after transport
+   * @param u The free primary concentrations: the initial guess (positive), then the solution
+   * @param m_old The mineral concentrations at the beginning of the step
+   * @param m The mineral concentrations at the end of the step
+   * @return The number of iterations, or -1 if not converged
+   */
+  int solve(Real dt,
+            const std::vector<Real> & total,
+            std::vector<Real> & u,
+            const std::vector<Real> & m_old,
+            std::vector<Real> & m,
+            Real tolerance = 1e-12,
+            unsigned int max_its = 50)
+  {
+    const unsigned int np = _network.n_primary;
+    const unsigned int nk = _network.kinetic.size();
+    const unsigned int n = np + nk;
+    mooseAssert(total.size() == np && u.size() == np && m_old.size() == nk, "Wrong sizes");
+
+    _x.resize(n);
+    for (unsigned int j = 0; j < np; ++j)
+      _x[j] = std::log(std::max(u[j], std::numeric_limits<Real>::min()));
+    for (unsigned int k = 0; k < nk; ++k)
+      _x[np + k] = m.size() == nk ? m[k] : m_old[k];
+
+    Real scale = 0;
+    for (unsigned int j = 0; j < np; ++j)
+      scale = std::max(scale, std::abs(total[j]));
+    scale = std::max(scale, Real(1));
+
+    int its = -1;
+    for (unsigned int it = 0; it <= max_its; ++it)
+    {
+      residual(dt, total, m_old);
+      Real norm = 0;
+      for (unsigned int i = 0; i < n; ++i)
+        norm = std::max(norm, std::abs(_residual[i]));
+      if (norm <= tolerance * scale)
+      {
+        its = it;
+        break;
+      }
+      if (it == max_its || !solveLinear(n))
+        break;
+
+      // Limit the change of ln(u) so an iterate cannot overflow
+      for (unsigned int j = 0; j < np; ++j)
+        _x[j] -= std::max(Real(-5), std::min(Real(5), _residual[j]));
+      for (unsigned int k = 0; k < nk; ++k)
+        _x[np + k] -= _residual[np + k];
+    }
+
+    for (unsigned int j = 0; j < np; ++j)
+      u[j] = std::exp(_x[j]);
+    m.resize(nk);
+    for (unsigned int k = 0; k < nk; ++k)
+      m[k] = _x[np + k];
+    return its;
+  }
+
+  /// The concentrations of the equilibrium secondary species at the last solution
+  const std::vector<Real> & secondaryConcentrations() const { return _secondary; }
+
+private:
+  /// Fills _residual and _jacobian at _x
+  void residual(Real dt, const std::vector<Real> & total, const std::vector<Real> & m_old)
+  {
+    const unsigned int np = _network.n_primary;
+    const unsigned int nk = _network.kinetic.size();
+    const unsigned int n = np + nk;
+    _residual.assign(n, 0.0);
+    _jacobian.assign(n * n, 0.0);
+    const auto J = [this, n](unsigned int i, unsigned int j) -> Real &
+    { return _jacobian[i * n + j]; };
+
+    // u_j - T_j, then the secondary species, d/dln(u_l) of c_i being c_i sto_il
+    for (unsigned int j = 0; j < np; ++j)
+    {
+      const Real uj = std::exp(_x[j]);
+      _residual[j] = uj - total[j];
+      J(j, j) = uj;
+    }
+    _secondary.resize(_network.equilibrium.size());
+    for (std::size_t i = 0; i < _network.equilibrium.size(); ++i)
+    {
+      const auto & r = _network.equilibrium[i];
+      Real ln_c = r.log10_k * std::log(10.0);
+      for (unsigned int l = 0; l < np; ++l)
+        ln_c += r.sto[l] * _x[l];
+      const Real c = std::exp(ln_c);
+      _secondary[i] = c;
+      for (unsigned int j = 0; j < np; ++j)
+      {
+        if (r.weight[j] == 0)
+          continue;
+        _residual[j] += r.weight[j] * c;
+        for (unsigned int l = 0; l < np; ++l)
+          J(j, l) += r.weight[j] * c * r.sto[l];
+      }
+    }
+
+    for (unsigned int k = 0; k < nk; ++k)
+    {
+      const auto & r = _network.kinetic[k];
+      Real ln_omega = -r.log10_k * std::log(10.0);
+      for (unsigned int l = 0; l < np; ++l)
+        ln_omega += r.sto[l] * _x[l];
+      const Real omega = std::exp(ln_omega);
+      const Real dm = _x[np + k] - m_old[k];
+      _residual[np + k] = dm - dt * r.rate * (omega - 1);
+      J(np + k, np + k) = 1;
+      for (unsigned int l = 0; l < np; ++l)
+        J(np + k, l) = -dt * r.rate * omega * r.sto[l];
+      for (unsigned int j = 0; j < np; ++j)
+      {
+        _residual[j] += r.weight[j] * dm;
+        J(j, np + k) = r.weight[j];
+      }
+    }
+  }
+
+  /// Solves _jacobian dx = _residual in place by Gaussian elimination with partial pivoting
+  bool solveLinear(unsigned int n)
+  {
+    auto & A = _jacobian;
+    auto & b = _residual;
+    for (unsigned int k = 0; k < n; ++k)
+    {
+      unsigned int p = k;
+      for (unsigned int i = k + 1; i < n; ++i)
+        if (std::abs(A[i * n + k]) > std::abs(A[p * n + k]))
+          p = i;
+      if (!(std::abs(A[p * n + k]) > 0))
+        return false;
+      if (p != k)
+      {
+        for (unsigned int j = 0; j < n; ++j)
+          std::swap(A[k * n + j], A[p * n + j]);
+        std::swap(b[k], b[p]);
+      }
+      for (unsigned int i = k + 1; i < n; ++i)
+      {
+        const Real f = A[i * n + k] / A[k * n + k];
+        if (f == 0)
+          continue;
+        for (unsigned int j = k; j < n; ++j)
+          A[i * n + j] -= f * A[k * n + j];
+        b[i] -= f * b[k];
+      }
+    }
+    for (unsigned int i = n; i-- > 0;)
+    {
+      for (unsigned int j = i + 1; j < n; ++j)
+        b[i] -= A[i * n + j] * b[j];
+      b[i] /= A[i * n + i];
+    }
+    return true;
+  }
+
+  const ReactionNetwork & _network;
+
+  std::vector<Real> _x;
+  std::vector<Real> _residual;
+  std::vector<Real> _jacobian;
+  std::vector<Real> _secondary;
+};
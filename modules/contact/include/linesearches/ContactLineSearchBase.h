@@ -10,9 +10,17 @@
 #pragma once
 
 #include "LineSearch.h"
+#include "ContactRegionMerit.h"
 
 class FEProblem;
 
+namespace libMesh
+{
+class Elem;
+template <typename T>
+class NumericVector;
+}
+
 /**
  * This class implements a custom line search for use with
  * mechanical contact. The line search is not fancy. It takes two parameters, set in the MOOSE
@@ -30,6 +38,11 @@ class FEProblem;
  * beginning of the Newton solve, unnecessary computational expense is avoided. Then when the
  * contact set is resolved late in the Newton solve, the linear tolerance will return to the finer
  * tolerance set through the traditional `l_tol` parameter.
+ *
+ * With `contact_line_search_partial_residual`, the trials between the full Newton step and the
+ * accepted one only compute the residual near the contact interfaces and estimate the rest (see
+ * ContactRegionMerit); the accepted step, and a trial changing the contact set away from the
+ * interfaces, get a full residual.
  */
 class ContactLineSearchBase : public LineSearch
 {
@@ -54,6 +67,39 @@ public:
   virtual void reset();
 
 protected:
+  /**
+   * Collects the elements with a node in the current or old contact set (the region), the dofs
+   * of their nodes and the layer of elements around them needed to compute the residual of
+   * these dofs exactly
+   */
+  void buildContactRegion();
+
+  /**
+   * The merit ||R||^2 of a trial for the partial residual mode: the residual of the region dofs
+   * at the trial solution, computed on the region elements, plus the estimate of the others
+   * @param lambda The step of the trial
+   * @param soln The trial solution
+   * @param residual The vector the residual of the region is formed in
+   */
+  Real partialMerit(Real lambda,
+                    const NumericVector<Number> & soln,
+                    NumericVector<Number> & residual);
+
+  /// Whether the trials use a residual restricted to the contact region
+  const bool _partial_residual;
+
+  /// The estimate of the merit of the trials from the residual of the region
+  ContactRegionMerit _region_merit;
+
+  /// The elements next to the contact interfaces and the layer around them
+  std::vector<const Elem *> _region_elems;
+
+  /// The nodes of the elements next to the contact interfaces
+  std::set<dof_id_type> _region_nodes;
+
+  /// The local dofs of these nodes, whose residual the region elements give exactly
+  std::vector<dof_id_type> _region_dofs;
+
   /// The current contact set
   std::set<dof_id_type> _current_contact_state;
   /// The old contact set
@@ -0,0 +1,122 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <set>
+#include <vector>
+
+/**
+ * An estimate of the merit ||R(u + lambda du)||^2 of the trials of a contact line search from a
+ * residual computed only near the contact interfaces (see ContactLineSearchBase).
+ *
+ * The dofs are split into the region dofs (those of the elements next to the contact
+ * interfaces) and the others. The residual of the region dofs is computed exactly for every
+ * trial, on the region elements and one layer around them. Away from contact the residual is
+ * close to linear along the Newton direction, so the residual of the other dofs is interpolated
+ * between the full residuals at lambda = 0 and lambda = 1:
+ *
+ *   ||R_out(lambda)||^2 = (1 - lambda)^2 a.a + 2 lambda (1 - lambda) a.b + lambda^2 b.b
+ *
+ * with a = R_out(0) and b = R_out(1), so that a trial costs a residual of the region only. The
+ * accepted step still gets a full residual. The estimate does not hold once the contact set
+ * changes outside the region; see changedOutside().
+ */
+class ContactRegionMerit
+{
+public:
+  /**
+   * Sets the residuals at lambda = 0 and 1 from their inner products
+   * @param aa, ab, bb R(0).R(0), R(0).R(1) and R(1).R(1) over all the dofs
+   * @param region_aa, region_ab, region_bb The same over the region dofs only
+   */
+  void setEndpoints(Real aa, Real ab, Real bb, Real region_aa, Real region_ab, Real region_bb)
+  {
+    // Clip the round off of the differences of the sums
+    _aa = std::max(Real(0), aa - region_aa);
+    _bb = std::max(Real(0), bb - region_bb);
+    _ab = ab - region_ab;
+    _valid = true;
+  }
+
+  /// Whether setEndpoints() has been called since the last invalidate()
+  bool valid() const { return _valid; }
+
+  /// Forgets the endpoints, e.g. at a new Newton iteration
+  void invalidate() { _valid = false; }
+
+  /// The interpolated squared norm of the residual of the dofs outside the region
+  Real outsideNormSq(Real lambda) const
+  {
+    const Real value =
+        (1 - lambda) * (1 - lambda) * _aa + 2 * lambda * (1 - lambda) * _ab + lambda * lambda * _bb;
+    return std::max(Real(0), value);
+  }
+
+  /**
+   * The estimated merit of a trial
+   * @param lambda The step of the trial
+   * @param region_norm_sq The squared norm of its residual of the region dofs
+   */
+  Real merit(Real lambda, Real region_norm_sq) const
+  {
+    return region_norm_sq + outsideNormSq(lambda);
+  }
+
+  /**
+   * Sums the products of two vectors over some dofs (the local part of a region inner product;
+   * the caller sums over the processors)
+   * @param a, b Vectors with operator()(dof)
+   * @param dofs The local dofs of the region
+   */
+  template <typename Vector>
+  static Real regionDot(const Vector & a, const Vector & b, const std::vector<dof_id_type> & dofs)
+  {
+    Real sum = 0;
+    for (const auto dof : dofs)
+      sum += a(dof) * b(dof);
+    return sum;
+  }
+
+  /**
+   * Whether the contact set of a trial differs from the reference one at a node outside the
+   * region, where interpolating the residual is no longer justified (a full residual is needed)
+   * @param trial, reference The nodes in contact, sorted
+   * @param region_nodes The nodes of the region elements, sorted
+   */
+  static bool changedOutside(const std::set<dof_id_type> & trial,
+                             const std::set<dof_id_type> & reference,
+                             const std::set<dof_id_type> & region_nodes)
+  {
+    std::vector<dof_id_type> changed;
+    std::set_symmetric_difference(trial.begin(),
+                                  trial.end(),
+                                  reference.begin(),
+                                  reference.end(),
+                                  std::back_inserter(changed));
+    for (const auto node : changed)
+      if (!region_nodes.count(node))
+        return true;
+    return false;
+  }
+
+private:
+  ///@{ The inner products of R(0) and R(1) over the dofs outside the region
+  Real _aa = 0;
+  Real _ab = 0;
+  Real _bb = 0;
+  ///@}
+
+  bool _valid = false;
+};
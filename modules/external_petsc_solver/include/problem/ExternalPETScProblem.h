@@ -18,6 +18,10 @@
  * We also sync the PETSc solution to moose variables,
  * and then these variables can be coupled to other
  * moose applications
+ *
+ * With `use_scatter`, the sync is a single PETSc VecScatter from the external solution into the
+ * auxiliary solution vector, built once from the map between the DMDA ordering and the dofs of
+ * the variable, instead of a loop over the nodes of the mesh with a copy per node.
  */
 class ExternalPETScProblem : public ExternalProblem
 {
@@ -45,7 +49,17 @@ public:
 
   TS & getPetscTS() { return _ts; }
 
+  /// Forgets the sync scatter, which is rebuilt for the new dof numbering
+  virtual void meshChanged() override;
+
 private:
+  /**
+   * Builds _sync_scatter: the index sets of the DMDA global indices of the nodes and of the dofs
+   * of the variable at the same nodes, on the layout of the external and auxiliary vectors
+   */
+  void buildSyncScatter();
+
+
   /// The name of the variable to transfer to
   const VariableName & _sync_to_var_name;
   /// If PETSc solver converged
@@ -61,4 +75,8 @@ private:
   Vec & _petsc_udot;
   /// RHS vector
   Vec _petsc_rhs;
+  /// Whether to sync with _sync_scatter
+  const bool _use_scatter;
+  /// The scatter from the external solution to the auxiliary solution, nullptr until built
+  VecScatter _sync_scatter;
 };
@@ -24,6 +24,8 @@ public:
   virtual ~FluidPropertiesMaterialPT();
 
 protected:
+  /// Evaluates the properties at all the quadrature points of the element with batched calls
+  virtual void computeProperties() override;
   virtual void computeQpProperties();
 
   /// Pressure (Pa)
@@ -85,6 +85,86 @@ public:
   virtual void
   h_from_p_T(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  ///@{ Batched (p, T) methods, see SinglePhaseFluidProperties
+  virtual void rho_from_p_T(unsigned int n,
+                            const Real * pressure,
+                            const Real * temperature,
+                            Real * rho) const override
+  {
+    for (unsigned int i = 0; i < n; ++i)
+      rho[i] =
+          _density0 * std::exp(pressure[i] / _bulk_modulus - _thermal_expansion * temperature[i]);
+  }
+
+  virtual void rho_from_p_T(unsigned int n,
+                            const Real * pressure,
+                            const Real * temperature,
+                            Real * rho,
+                            Real * drho_dp,
+                            Real * drho_dT) const override
+  {
+    rho_from_p_T(n, pressure, temperature, rho);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      drho_dp[i] = rho[i] / _bulk_modulus;
+      drho_dT[i] = -_thermal_expansion * rho[i];
+    }
+  }
+
+  virtual void e_from_p_T(unsigned int n,
+                          const Real * pressure,
+                          const Real * temperature,
+                          Real * e,
+                          Real * de_dp,
+                          Real * de_dT) const override
+  {
+    libmesh_ignore(pressure);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      e[i] = _cv * temperature[i];
+      de_dp[i] = 0.0;
+      de_dT[i] = _cv;
+    }
+  }
+
+  virtual void h_from_p_T(unsigned int n,
+                          const Real * pressure,
+                          const Real * temperature,
+                          Real * h,
+                          Real * dh_dp,
+                          Real * dh_dT) const override
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      const Real rho =
+          _density0 * std::exp(pressure[i] / _bulk_modulus - _thermal_expansion * temperature[i]);
+      const Real p_rho = _pp_coeff * pressure[i] / rho;
+      h[i] = _cv * temperature[i] + p_rho;
+      dh_dp[i] = _pp_coeff / rho - p_rho / _bulk_modulus;
+      dh_dT[i] = _cv + p_rho * _thermal_expansion;
+    }
+  }
+
+  virtual void rho_mu_from_p_T(unsigned int n,
+                               const Real * pressure,
+                               const Real * temperature,
+                               Real * rho,
+                               Real * drho_dp,
+                               Real * drho_dT,
+                               Real * mu,
+                               Real * dmu_dp,
+                               Real * dmu_dT) const override
+  {
+    rho_from_p_T(n, pressure, temperature, rho, drho_dp, drho_dT);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      mu[i] = _viscosity;
+      dmu_dp[i] = 0.0;
+      dmu_dT[i] = 0.0;
+    }
+  }
+  ///@}
+
 protected:
   /// molar mass
   const Real _molar_mass;
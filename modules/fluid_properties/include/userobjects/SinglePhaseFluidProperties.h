@@ -78,6 +78,30 @@
                                                                                                    \
   propfuncAD(want, prop1, prop2)
 
+/**
+ * Adds batched versions of a fluid property that evaluate n states at once. The default
+ * implementations loop over the pointwise methods; fluids whose properties have a closed form
+ * override them with loops the compiler can vectorize.
+ */
+#define propfuncBatch(want, prop1, prop2)                                                          \
+  virtual void want##_from_##prop1##_##prop2(                                                      \
+      unsigned int n, const Real * prop1, const Real * prop2, Real * val) const                    \
+  {                                                                                                \
+    for (unsigned int i = 0; i < n; ++i)                                                           \
+      val[i] = want##_from_##prop1##_##prop2(prop1[i], prop2[i]);                                  \
+  }                                                                                                \
+                                                                                                   \
+  virtual void want##_from_##prop1##_##prop2(unsigned int n,                                       \
+                                             const Real * prop1,                                   \
+                                             const Real * prop2,                                   \
+                                             Real * val,                                           \
+                                             Real * d##want##d1,                                   \
+                                             Real * d##want##d2) const                             \
+  {                                                                                                \
+    for (unsigned int i = 0; i < n; ++i)                                                           \
+      want##_from_##prop1##_##prop2(prop1[i], prop2[i], val[i], d##want##d1[i], d##want##d2[i]);   \
+  }
+
 /**
  * Common class for single phase fluid properties
  */
@@ -318,6 +342,50 @@ public:
                               Real & de_dp,
                               Real & de_dT) const;
 
+  // clang-format off
+
+  /**
+   * Batched versions of the (p, T) methods, evaluating the n states p[i], T[i] with a single
+   * virtual call, e.g. for all the quadrature points of an element:
+   *
+   * @begincode
+   * // rho, drho_dp and drho_dT must have room for n values
+   * fp.rho_from_p_T(n, p, T, rho, drho_dp, drho_dT);
+   * @endcode
+   *
+   * Output arrays must not overlap the input arrays.
+   */
+  ///@{
+  propfuncBatch(rho, p, T)
+  propfuncBatch(e, p, T)
+  propfuncBatch(h, p, T)
+  propfuncBatch(mu, p, T)
+  propfuncBatch(k, p, T)
+  propfuncBatch(cp, p, T)
+  propfuncBatch(cv, p, T)
+  propfuncBatch(s, p, T)
+  propfuncBatch(c, p, T)
+  ///@}
+
+  // clang-format on
+
+#undef propfuncBatch
+
+  /// Batched version of the combined density and viscosity method
+  virtual void rho_mu_from_p_T(unsigned int n,
+                               const Real * p,
+                               const Real * T,
+                               Real * rho,
+                               Real * drho_dp,
+                               Real * drho_dT,
+                               Real * mu,
+                               Real * dmu_dp,
+                               Real * dmu_dT) const
+  {
+    for (unsigned int i = 0; i < n; ++i)
+      rho_mu_from_p_T(p[i], T[i], rho[i], drho_dp[i], drho_dT[i], mu[i], dmu_dp[i], dmu_dT[i]);
+  }
+
 private:
   template <typename... Args>
   void fluidPropError(Args... args) const
@@ -90,6 +90,77 @@ public:
 
   virtual Real pp_sat_from_p_T(Real /*p*/, Real /*T*/) const override;
 
+  ///@{ Batched (p, T) methods, see SinglePhaseFluidProperties
+  virtual void
+  rho_from_p_T(unsigned int n, const Real * p, const Real * T, Real * rho) const override
+  {
+    for (unsigned int i = 0; i < n; ++i)
+      rho[i] = (p[i] + _p_inf) / ((_gamma - 1.0) * _cv * T[i]);
+  }
+  virtual void rho_from_p_T(unsigned int n,
+                            const Real * p,
+                            const Real * T,
+                            Real * rho,
+                            Real * drho_dp,
+                            Real * drho_dT) const override
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      drho_dp[i] = 1.0 / ((_gamma - 1.0) * _cv * T[i]);
+      rho[i] = (p[i] + _p_inf) * drho_dp[i];
+      drho_dT[i] = -rho[i] / T[i];
+    }
+  }
+  virtual void e_from_p_T(unsigned int n,
+                          const Real * p,
+                          const Real * T,
+                          Real * e,
+                          Real * de_dp,
+                          Real * de_dT) const override
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      const Real p_eff = p[i] + _p_inf;
+      de_dT[i] = _cv * (p[i] + _gamma * _p_inf) / p_eff;
+      e[i] = de_dT[i] * T[i] + _q;
+      de_dp[i] = (1.0 - _gamma) * _p_inf * _cv * T[i] / (p_eff * p_eff);
+    }
+  }
+  virtual void h_from_p_T(unsigned int n,
+                          const Real * p,
+                          const Real * T,
+                          Real * h,
+                          Real * dh_dp,
+                          Real * dh_dT) const override
+  {
+    libmesh_ignore(p);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      h[i] = _cp * T[i] + _q;
+      dh_dp[i] = 0.0;
+      dh_dT[i] = _cp;
+    }
+  }
+  virtual void rho_mu_from_p_T(unsigned int n,
+                               const Real * p,
+                               const Real * T,
+                               Real * rho,
+                               Real * drho_dp,
+                               Real * drho_dT,
+                               Real * mu,
+                               Real * dmu_dp,
+                               Real * dmu_dT) const override
+  {
+    rho_from_p_T(n, p, T, rho, drho_dp, drho_dT);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      mu[i] = _mu;
+      dmu_dp[i] = 0.0;
+      dmu_dT[i] = 0.0;
+    }
+  }
+  ///@}
+
 protected:
   bool _allow_nonphysical_states;
 
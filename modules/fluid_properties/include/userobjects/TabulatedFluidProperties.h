@@ -11,6 +11,7 @@
 
 #include "SinglePhaseFluidProperties.h"
 #include "DelimitedFileReader.h"
+#include "AdaptiveBicubicTable.h"
 
 class SinglePhaseFluidPropertiesPT;
 class BicubicInterpolation;
@@ -84,6 +85,17 @@ class BicubicInterpolation;
  * Properties specified in the data file or listed in the input file (and their derivatives
  * wrt pressure and temperature) will be calculated using bicubic interpolation, while all
  * remaining fluid properties are calculated using the supplied FluidProperties UserObject.
+ *
+ * With "adaptive = true", the generated data is not tabulated on a uniform grid. Instead, each
+ * property is tabulated on a quadtree that is only refined where bicubic interpolation does
+ * not reproduce the FluidProperties UserObject to the "adaptive_tolerance" (e.g. near the
+ * critical point), see AdaptiveBicubicTable. These tables are saved to "binary_file_name",
+ * and read back in later runs if that file was generated from the same fluid, properties,
+ * ranges and tolerance, rather than regenerated.
+ *
+ * With "share_tables_on_node = true" as well, the adaptive tables are generated or read by the
+ * lowest rank of each node only and placed in MPI shared memory, so that a node holds a single
+ * copy of them however many ranks it runs.
  */
 class TabulatedFluidProperties : public SinglePhaseFluidProperties
 {
@@ -163,6 +175,27 @@ protected:
    */
   virtual void generateTabulatedData();
 
+  /**
+   * Generates adaptive tables of the interpolated properties using the FluidProperties
+   * UserObject _fp, refining each table until the interpolation error is below the tolerance.
+   */
+  virtual void generateAdaptiveTabulatedData();
+
+  /**
+   * Writes the adaptive tables to a binary file: a header identifying the fluid, the tabulated
+   * properties, the pressure and temperature ranges and the tolerance, followed by each table.
+   * @param file_name name of the file to be written
+   */
+  void writeBinaryTabulatedData(const std::string & file_name) const;
+
+  /**
+   * Reads the adaptive tables from a binary file written by writeBinaryTabulatedData().
+   * @param file_name name of the file to be read
+   * @return false if the file does not exist or its header does not match this object, in which
+   * case the tables must be regenerated
+   */
+  bool readBinaryTabulatedData(const std::string & file_name);
+
   /**
    * Forms a 2D matrix from a single std::vector.
    * @param nrow number of rows in the matrix
@@ -234,6 +267,20 @@ protected:
   unsigned int _cv_idx;
   unsigned int _entropy_idx;
 
+  /// Whether to generate adaptive tables instead of a uniform grid
+  const bool _adaptive;
+  /// Relative interpolation error that the adaptive tables are refined to
+  const Real _adaptive_tolerance;
+  /// Minimum and maximum number of refinements of the adaptive tables
+  const unsigned int _adaptive_min_level;
+  const unsigned int _adaptive_max_level;
+  /// File name of the binary cache of the adaptive tables
+  FileName _binary_file_name;
+  /// Whether the adaptive tables are held once per node in shared memory
+  const bool _share_tables_on_node;
+  /// Adaptive table of each interpolated property, indexed like _property_ipol
+  std::vector<std::unique_ptr<AdaptiveBicubicTable>> _property_adaptive;
+
   /// The MOOSE delimited file reader.
   MooseUtils::DelimitedFileReader _csv_reader;
 };
@@ -96,6 +96,28 @@ public:
                                Real & dmu_dp,
                                Real & dmu_dT) const override;
 
+  /**
+   * Batched density, see SinglePhaseFluidProperties. When all the states are in region 1, the
+   * Gibbs free energy series is summed for all of them at once; otherwise each state is
+   * evaluated with the pointwise method.
+   */
+  virtual void rho_from_p_T(unsigned int n,
+                            const Real * pressure,
+                            const Real * temperature,
+                            Real * rho,
+                            Real * drho_dp,
+                            Real * drho_dT) const override;
+
+  virtual void rho_mu_from_p_T(unsigned int n,
+                               const Real * pressure,
+                               const Real * temperature,
+                               Real * rho,
+                               Real * drho_dp,
+                               Real * drho_dT,
+                               Real * mu,
+                               Real * dmu_dp,
+                               Real * dmu_dT) const override;
+
   virtual Real k_from_p_T(Real pressure, Real temperature) const override;
 
   virtual void
@@ -1333,4 +1355,84 @@ protected:
   const std::array<Real, 5> _p_star{{16.53e6, 1.0e6, 1.0e6, 1.0e6, 1.0e6}};
 };
 
+inline void
+Water97FluidProperties::rho_from_p_T(unsigned int n,
+                                     const Real * pressure,
+                                     const Real * temperature,
+                                     Real * rho,
+                                     Real * drho_dp,
+                                     Real * drho_dT) const
+{
+  for (unsigned int i = 0; i < n; ++i)
+    if (inRegion(pressure[i], temperature[i]) != 1)
+    {
+      SinglePhaseFluidProperties::rho_from_p_T(n, pressure, temperature, rho, drho_dp, drho_dT);
+      return;
+    }
+
+  // The output arrays hold the derivatives of the Gibbs free energy while the series is summed
+  Real * dgamma_dpi = rho;
+  Real * d2gamma_dpi2 = drho_dp;
+  Real * d2gamma_dpitau = drho_dT;
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    dgamma_dpi[i] = 0.0;
+    d2gamma_dpi2[i] = 0.0;
+    d2gamma_dpitau[i] = 0.0;
+  }
+
+  // Terms outermost, so that the inner loop over the states can be vectorized
+  for (std::size_t j = 0; j < _n1.size(); ++j)
+  {
+    // The terms with I = 0 do not depend on pi
+    if (_I1[j] == 0)
+      continue;
+
+    const Real nI = _n1[j] * _I1[j];
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      const Real pi = 7.1 - pressure[i] / _p_star[0];
+      const Real tau = _T_star[0] / temperature[i] - 1.222;
+      const Real term = nI * std::pow(pi, _I1[j] - 2) * std::pow(tau, _J1[j] - 1);
+      dgamma_dpi[i] -= term * pi * tau;
+      d2gamma_dpi2[i] += term * (_I1[j] - 1) * tau;
+      d2gamma_dpitau[i] -= term * _J1[j] * pi;
+    }
+  }
+
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    const Real tau = _T_star[0] / temperature[i];
+    const Real RT = _Rw * temperature[i];
+    const Real g_pi = dgamma_dpi[i];
+    const Real g_pipi = d2gamma_dpi2[i];
+    const Real g_pitau = d2gamma_dpitau[i];
+
+    rho[i] = _p_star[0] / (RT * g_pi);
+    drho_dp[i] = -g_pipi / (RT * g_pi * g_pi);
+    drho_dT[i] = -rho[i] * (g_pi - tau * g_pitau) / (temperature[i] * g_pi);
+  }
+}
+
+inline void
+Water97FluidProperties::rho_mu_from_p_T(unsigned int n,
+                                        const Real * pressure,
+                                        const Real * temperature,
+                                        Real * rho,
+                                        Real * drho_dp,
+                                        Real * drho_dT,
+                                        Real * mu,
+                                        Real * dmu_dp,
+                                        Real * dmu_dT) const
+{
+  rho_from_p_T(n, pressure, temperature, rho, drho_dp, drho_dT);
+
+  Real dmu_drho;
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    mu_from_rho_T(rho[i], temperature[i], drho_dT[i], mu[i], dmu_drho, dmu_dT[i]);
+    dmu_dp[i] = dmu_drho * drho_dp[i];
+  }
+}
+
 #pragma GCC diagnostic pop
@@ -0,0 +1,461 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+#include "MooseError.h"
+#include "SharedMemoryArray.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Tabulation of a function f(x, y) on a quadtree that is refined only where a bicubic Hermite
+ * patch does not reproduce the function to the requested tolerance.
+ *
+ * Each leaf cell interpolates f with the values of f, df/dx, df/dy and d2f/dxdy at its four
+ * corners, which are shared with the neighbouring cells. Where a cell is next to a finer one the
+ * interpolant is only continuous to within the tolerance. The table can be written to and read
+ * from a binary stream so that it does not need to be regenerated, and can be moved to memory
+ * shared by all the ranks of a node so that only one copy exists per node.
+ */
+class AdaptiveBicubicTable
+{
+public:
+  /// The tabulated function: computes f, df/dx and df/dy at (x, y)
+  typedef std::function<void(Real x, Real y, Real & f, Real & df_dx, Real & df_dy)> Function;
+
+  AdaptiveBicubicTable() = default;
+
+  /**
+   * Builds the table of a function on [x_min, x_max] x [y_min, y_max]. A cell is split when the
+   * interpolation error at its centre or edge midpoints exceeds rtol * |f| + atol.
+   *
+   * @param function The function to tabulate
+   * @param rtol Relative tolerance
+   * @param atol Absolute tolerance
+   * @param min_level Cells are split at least this many times
+   * @param max_level Cells are split at most this many times (at most 30)
+   */
+  void build(const Function & function,
+             Real x_min,
+             Real x_max,
+             Real y_min,
+             Real y_max,
+             Real rtol,
+             Real atol,
+             unsigned int min_level,
+             unsigned int max_level);
+
+  /**
+   * Interpolates the function and its derivatives at (x, y), which must be inside the table
+   */
+  void sample(Real x, Real y, Real & f, Real & df_dx, Real & df_dy) const;
+  Real sample(Real x, Real y) const;
+
+  /// Number of distinct corners (each holding four values)
+  std::size_t numNodes() const { return _num_nodes; }
+
+  /// Number of cells, including the ones that have been split
+  std::size_t numCells() const { return _num_cells; }
+
+  ///@{ Bounds of the table
+  Real xMin() const { return _x_min; }
+  Real xMax() const { return _x_max; }
+  Real yMin() const { return _y_min; }
+  Real yMax() const { return _y_max; }
+  ///@}
+
+  ///@{ Binary (native endianness) serialization
+  void write(std::ostream & stream) const;
+  void read(std::istream & stream);
+  ///@}
+
+  /**
+   * Moves the table to memory shared by the ranks of comm on each node (collective). Only the
+   * leader of each node (see NodeCommunicator) needs to have built or read the table; on the
+   * other ranks it is replaced by the leader's.
+   */
+  void share(const libMesh::Parallel::Communicator & comm);
+
+protected:
+  /// f, df/dx, df/dy and d2f/dxdy at a corner
+  typedef std::array<Real, 4> Node;
+
+  struct Cell
+  {
+    /// Index of the first of the four children (-x-y, +x-y, -x+y, +x+y), -1 for a leaf
+    int first_child;
+    /// The corners, in the same order as the children
+    std::array<unsigned int, 4> corners;
+  };
+
+  /// Evaluates the function at a point of the finest lattice
+  Node evaluate(const Function & function, std::uint64_t i, std::uint64_t j) const;
+
+  /// Interpolates within a cell at local coordinates u, v in [0, 1]
+  void interpolate(const Cell & cell,
+                   Real u,
+                   Real v,
+                   Real hx,
+                   Real hy,
+                   Real & f,
+                   Real & df_dx,
+                   Real & df_dy) const;
+
+  Real _x_min = 0;
+  Real _x_max = 0;
+  Real _y_min = 0;
+  Real _y_max = 0;
+  /// Spacing of the finest lattice
+  Real _dx = 0;
+  Real _dy = 0;
+
+  std::vector<Node> _nodes;
+  /// The cells, the root first
+  std::vector<Cell> _cells;
+
+  ///@{ The table that is used, either _nodes and _cells or the shared arrays
+  const Node * _node_data = nullptr;
+  const Cell * _cell_data = nullptr;
+  std::size_t _num_nodes = 0;
+  std::size_t _num_cells = 0;
+  ///@}
+
+  ///@{ Node-shared storage, after share()
+  std::unique_ptr<SharedMemoryArray<Real>> _shared_bounds;
+  std::unique_ptr<SharedMemoryArray<Node>> _shared_nodes;
+  std::unique_ptr<SharedMemoryArray<Cell>> _shared_cells;
+  ///@}
+
+  /// Points the table at _nodes and _cells
+  void useLocalData()
+  {
+    _node_data = _nodes.data();
+    _cell_data = _cells.data();
+    _num_nodes = _nodes.size();
+    _num_cells = _cells.size();
+  }
+};
+
+inline AdaptiveBicubicTable::Node
+AdaptiveBicubicTable::evaluate(const Function & function, std::uint64_t i, std::uint64_t j) const
+{
+  const Real x = std::min(_x_min + i * _dx, _x_max);
+  const Real y = std::min(_y_min + j * _dy, _y_max);
+
+  Node node;
+  function(x, y, node[0], node[1], node[2]);
+
+  // Cross derivative from a finite difference of df/dx, one sided at the bounds
+  const Real h = 1.0e-6 * (_y_max - _y_min);
+  const Real y_lo = std::max(y - h, _y_min);
+  const Real y_hi = std::min(y + h, _y_max);
+  Real f, dfdx_lo, dfdx_hi, df_dy;
+  function(x, y_lo, f, dfdx_lo, df_dy);
+  function(x, y_hi, f, dfdx_hi, df_dy);
+  node[3] = (dfdx_hi - dfdx_lo) / (y_hi - y_lo);
+
+  return node;
+}
+
+inline void
+AdaptiveBicubicTable::interpolate(const Cell & cell,
+                                  Real u,
+                                  Real v,
+                                  Real hx,
+                                  Real hy,
+                                  Real & f,
+                                  Real & df_dx,
+                                  Real & df_dy) const
+{
+  // Cubic Hermite basis (value at 0, value at 1, slope at 0, slope at 1) and its derivative
+  const auto basis = [](Real t, std::array<Real, 4> & b, std::array<Real, 4> & db) {
+    const Real t2 = t * t;
+    const Real t3 = t2 * t;
+    b = {{2 * t3 - 3 * t2 + 1, -2 * t3 + 3 * t2, t3 - 2 * t2 + t, t3 - t2}};
+    db = {{6 * t2 - 6 * t, -6 * t2 + 6 * t, 3 * t2 - 4 * t + 1, 3 * t2 - 2 * t}};
+  };
+
+  std::array<Real, 4> bu, dbu, bv, dbv;
+  basis(u, bu, dbu);
+  basis(v, bv, dbv);
+
+  f = df_dx = df_dy = 0;
+  for (unsigned int c = 0; c < 4; ++c)
+  {
+    const unsigned int a = c % 2;
+    const unsigned int b = c / 2;
+    const Node & n = _node_data[cell.corners[c]];
+
+    f += bu[a] * bv[b] * n[0] + hx * bu[a + 2] * bv[b] * n[1] + hy * bu[a] * bv[b + 2] * n[2] +
+         hx * hy * bu[a + 2] * bv[b + 2] * n[3];
+    df_dx += dbu[a] * bv[b] * n[0] + hx * dbu[a + 2] * bv[b] * n[1] +
+             hy * dbu[a] * bv[b + 2] * n[2] + hx * hy * dbu[a + 2] * bv[b + 2] * n[3];
+    df_dy += bu[a] * dbv[b] * n[0] + hx * bu[a + 2] * dbv[b] * n[1] +
+             hy * bu[a] * dbv[b + 2] * n[2] + hx * hy * bu[a + 2] * dbv[b + 2] * n[3];
+  }
+
+  df_dx /= hx;
+  df_dy /= hy;
+}
+
+inline void
+AdaptiveBicubicTable::build(const Function & function,
+                            Real x_min,
+                            Real x_max,
+                            Real y_min,
+                            Real y_max,
+                            Real rtol,
+                            Real atol,
+                            unsigned int min_level,
+                            unsigned int max_level)
+{
+  if (!(x_max > x_min && y_max > y_min))
+    mooseError("AdaptiveBicubicTable: the bounds of the table are not increasing");
+  if (max_level > 30)
+    mooseError("AdaptiveBicubicTable: max_level must be at most 30");
+
+  _x_min = x_min;
+  _x_max = x_max;
+  _y_min = y_min;
+  _y_max = y_max;
+
+  const std::uint64_t n = std::uint64_t(1) << max_level;
+  _dx = (_x_max - _x_min) / n;
+  _dy = (_y_max - _y_min) / n;
+
+  _nodes.clear();
+  _cells.clear();
+
+  // Corners, and points that were evaluated to check a cell that was not split
+  std::unordered_map<std::uint64_t, unsigned int> node_ids;
+  std::unordered_map<std::uint64_t, Node> samples;
+
+  const auto key = [](std::uint64_t i, std::uint64_t j) { return (i << 32) | j; };
+
+  const auto sampled = [&](std::uint64_t i, std::uint64_t j) -> const Node & {
+    const auto k = key(i, j);
+    const auto it = node_ids.find(k);
+    if (it != node_ids.end())
+      return _nodes[it->second];
+
+    auto sit = samples.find(k);
+    if (sit == samples.end())
+      sit = samples.emplace(k, evaluate(function, i, j)).first;
+    return sit->second;
+  };
+
+  const auto corner = [&](std::uint64_t i, std::uint64_t j) -> unsigned int {
+    const auto k = key(i, j);
+    const auto it = node_ids.find(k);
+    if (it != node_ids.end())
+      return it->second;
+
+    const auto sit = samples.find(k);
+    _nodes.push_back(sit != samples.end() ? sit->second : evaluate(function, i, j));
+    if (sit != samples.end())
+      samples.erase(sit);
+    return node_ids[k] = _nodes.size() - 1;
+  };
+
+  _cells.push_back({-1, {{corner(0, 0), corner(n, 0), corner(0, n), corner(n, n)}}});
+
+  // Cells to check: index, level and lower left corner on the finest lattice
+  struct Pending
+  {
+    unsigned int cell;
+    unsigned int level;
+    std::uint64_t i;
+    std::uint64_t j;
+  };
+  std::vector<Pending> pending{{0, 0, 0, 0}};
+
+  while (!pending.empty())
+  {
+    const Pending p = pending.back();
+    pending.pop_back();
+
+    if (p.level == max_level)
+      continue;
+
+    const std::uint64_t half = n >> (p.level + 1);
+
+    bool split = p.level < min_level;
+    if (!split)
+    {
+      const Real hx = 2 * half * _dx;
+      const Real hy = 2 * half * _dy;
+      static const std::array<std::array<unsigned int, 2>, 5> midpoints = {
+          {{{1, 1}}, {{1, 0}}, {{0, 1}}, {{2, 1}}, {{1, 2}}}};
+
+      useLocalData();
+      for (const auto & m : midpoints)
+      {
+        const Node & exact = sampled(p.i + m[0] * half, p.j + m[1] * half);
+        Real f, df_dx, df_dy;
+        interpolate(_cells[p.cell], 0.5 * m[0], 0.5 * m[1], hx, hy, f, df_dx, df_dy);
+        if (std::abs(f - exact[0]) > rtol * std::abs(exact[0]) + atol)
+        {
+          split = true;
+          break;
+        }
+      }
+    }
+
+    if (!split)
+      continue;
+
+    const unsigned int first_child = _cells.size();
+    _cells[p.cell].first_child = first_child;
+    for (unsigned int c = 0; c < 4; ++c)
+    {
+      const std::uint64_t i = p.i + (c % 2) * half;
+      const std::uint64_t j = p.j + (c / 2) * half;
+      _cells.push_back({-1,
+                        {{corner(i, j),
+                          corner(i + half, j),
+                          corner(i, j + half),
+                          corner(i + half, j + half)}}});
+      pending.push_back({first_child + c, p.level + 1, i, j});
+    }
+  }
+
+  useLocalData();
+  _shared_bounds.reset();
+  _shared_nodes.reset();
+  _shared_cells.reset();
+}
+
+inline void
+AdaptiveBicubicTable::sample(Real x, Real y, Real & f, Real & df_dx, Real & df_dy) const
+{
+  mooseAssert(_num_cells, "The table has not been built");
+
+  Real x0 = _x_min, x1 = _x_max, y0 = _y_min, y1 = _y_max;
+  const Cell * cell = &_cell_data[0];
+  while (cell->first_child >= 0)
+  {
+    const Real xm = 0.5 * (x0 + x1);
+    const Real ym = 0.5 * (y0 + y1);
+    const unsigned int c = (x >= xm) + 2 * (y >= ym);
+    (x >= xm ? x0 : x1) = xm;
+    (y >= ym ? y0 : y1) = ym;
+    cell = &_cell_data[cell->first_child + c];
+  }
+
+  const Real hx = x1 - x0;
+  const Real hy = y1 - y0;
+  interpolate(*cell, (x - x0) / hx, (y - y0) / hy, hx, hy, f, df_dx, df_dy);
+}
+
+inline Real
+AdaptiveBicubicTable::sample(Real x, Real y) const
+{
+  Real f, df_dx, df_dy;
+  sample(x, y, f, df_dx, df_dy);
+  return f;
+}
+
+inline void
+AdaptiveBicubicTable::write(std::ostream & stream) const
+{
+  const std::array<Real, 6> bounds{{_x_min, _x_max, _y_min, _y_max, _dx, _dy}};
+  const std::uint64_t num_nodes = _num_nodes;
+  const std::uint64_t num_cells = _num_cells;
+
+  stream.write(reinterpret_cast<const char *>(bounds.data()), sizeof(bounds));
+  stream.write(reinterpret_cast<const char *>(&num_nodes), sizeof(num_nodes));
+  stream.write(reinterpret_cast<const char *>(&num_cells), sizeof(num_cells));
+  stream.write(reinterpret_cast<const char *>(_node_data), num_nodes * sizeof(Node));
+  stream.write(reinterpret_cast<const char *>(_cell_data), num_cells * sizeof(Cell));
+}
+
+inline void
+AdaptiveBicubicTable::read(std::istream & stream)
+{
+  std::array<Real, 6> bounds;
+  std::uint64_t num_nodes, num_cells;
+
+  stream.read(reinterpret_cast<char *>(bounds.data()), sizeof(bounds));
+  stream.read(reinterpret_cast<char *>(&num_nodes), sizeof(num_nodes));
+  stream.read(reinterpret_cast<char *>(&num_cells), sizeof(num_cells));
+  if (!stream)
+    mooseError("AdaptiveBicubicTable: failed to read the table header");
+
+  _x_min = bounds[0];
+  _x_max = bounds[1];
+  _y_min = bounds[2];
+  _y_max = bounds[3];
+  _dx = bounds[4];
+  _dy = bounds[5];
+
+  _nodes.resize(num_nodes);
+  _cells.resize(num_cells);
+  stream.read(reinterpret_cast<char *>(_nodes.data()), num_nodes * sizeof(Node));
+  stream.read(reinterpret_cast<char *>(_cells.data()), num_cells * sizeof(Cell));
+  if (!stream)
+    mooseError("AdaptiveBicubicTable: failed to read the table data");
+
+  for (const auto & cell : _cells)
+    for (const auto id : cell.corners)
+      if (id >= num_nodes || cell.first_child >= int(num_cells))
+        mooseError("AdaptiveBicubicTable: the table data is corrupt");
+
+  useLocalData();
+  _shared_bounds.reset();
+  _shared_nodes.reset();
+  _shared_cells.reset();
+}
+
+inline void
+AdaptiveBicubicTable::share(const libMesh::Parallel::Communicator & comm)
+{
+  _shared_bounds = libmesh_make_unique<SharedMemoryArray<Real>>(comm, 6);
+  _shared_nodes = libmesh_make_unique<SharedMemoryArray<Node>>(comm, _num_nodes);
+  _shared_cells = libmesh_make_unique<SharedMemoryArray<Cell>>(comm, _num_cells);
+
+  if (_shared_bounds->leader())
+  {
+    const std::array<Real, 6> bounds{{_x_min, _x_max, _y_min, _y_max, _dx, _dy}};
+    std::copy(bounds.begin(), bounds.end(), _shared_bounds->data());
+    std::copy(_node_data, _node_data + _num_nodes, _shared_nodes->data());
+    std::copy(_cell_data, _cell_data + _num_cells, _shared_cells->data());
+  }
+
+  _shared_bounds->fence();
+  _shared_nodes->fence();
+  _shared_cells->fence();
+
+  const auto & bounds = *_shared_bounds;
+  _x_min = bounds[0];
+  _x_max = bounds[1];
+  _y_min = bounds[2];
+  _y_max = bounds[3];
+  _dx = bounds[4];
+  _dy = bounds[5];
+
+  _node_data = _shared_nodes->data();
+  _cell_data = _shared_cells->data();
+  _num_nodes = _shared_nodes->size();
+  _num_cells = _shared_cells->size();
+
+  // The local copies are no longer needed
+  std::vector<Node>().swap(_nodes);
+  std::vector<Cell>().swap(_cells);
+}
@@ -34,6 +34,14 @@ public:
   // Override from MemoizedFunctionInterface
   virtual Real evaluateValue(Real t, const Point & p) override;
 
+  /**
+   * Expands the function series at a batch of points with the current coefficients: the basis
+   * values of all the points are computed at once by the recurrences of SeriesBatchEvaluation
+   * (for the Legendre and Zernike series), then contracted with the coefficients
+   * @param[out] values The value at each point
+   */
+  void evaluateValues(const std::vector<Point> & points, std::vector<Real> & values);
+
   /**
    * Expand the function series at the current location and with the current coefficients
    */
@@ -97,6 +105,12 @@ protected:
   /// Stores the name of the current functional series type
   const MooseEnum & _series_type_name;
 
+  ///@{ Scratch space of evaluateValues(): standardized locations and point-major basis values
+  std::vector<Real> _batch_locations;
+  std::vector<Real> _batch_basis;
+  std::vector<Real> _batch_scratch;
+  ///@}
+
   /*
    * Enumerations of the possible series types for the different spatial expansions. Not all of
    * these will be provided for any one series.
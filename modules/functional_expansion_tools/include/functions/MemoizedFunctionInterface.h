@@ -14,11 +14,15 @@
 #include "Function.h"
 
 #include "Hashing.h"
+#include "LRUMemoCache.h"
 
 /**
  * Implementation of Function that memoizes (caches) former evaluations in an unordered map using a
  * hash of the evaluation locations as the key. The purpose is to allow for quick evaluation of a
  * complex function that may be reevaluated multiple times without changing the actual outputs.
+ *
+ * The cache holds at most `cache_size` evaluations (the least recently used are evicted), so it
+ * does not grow without bound when the evaluation points move with the mesh.
  */
 class MemoizedFunctionInterface : public Function
 {
@@ -40,6 +44,12 @@ public:
   // evaluateValue().
   virtual Real value(Real time, const Point & point) const final;
 
+  ///@{ Statistics of the cache lookups
+  unsigned long cacheHits() const { return _cache.hits(); }
+  unsigned long cacheMisses() const { return _cache.misses(); }
+  double cacheHitRate() const { return _cache.hitRate(); }
+  ///@}
+
 protected:
   /**
    * Used in derived classes, equivalent to Function::value()
@@ -52,8 +62,8 @@ protected:
   void invalidateCache();
 
 private:
-  /// Cached evaluations for each point
-  mutable std::unordered_map<hashing::HashValue, Real> _cache;
+  /// Cached evaluations for each point, bounded by the `cache_size` parameter
+  mutable LRUMemoCache<hashing::HashValue, Real> _cache;
 
   /// Stores the time evaluation of the cache
   mutable Real _current_time;
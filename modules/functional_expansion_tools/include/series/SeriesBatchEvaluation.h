@@ -0,0 +1,128 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cmath>
+#include <vector>
+
+/**
+ * Evaluation of the standard form of the Legendre and Zernike bases at many points at once, by
+ * their three-term recurrences. The values are written point-major (all the terms of a point are
+ * contiguous), the layout FunctionSeries uses to expand the coefficients of a batch of points; the
+ * recurrences run over the points in the inner loops, so the compiler vectorizes across points.
+ *
+ * The normalizations of the series (orthonormal, sqrt_mu) are per-term factors, applied by the
+ * callers to these standard values.
+ */
+namespace SeriesBatchEvaluation
+{
+/**
+ * The Legendre polynomials P_0 ... P_order at each standardized location x in [-1, 1]
+ * @param values n_points * (order + 1) values, point-major
+ */
+inline void
+legendre(std::size_t order, std::size_t n_points, const Real * x, Real * values)
+{
+  const std::size_t n_terms = order + 1;
+  for (std::size_t p = 0; p < n_points; ++p)
+    values[p * n_terms] = 1;
+  if (order == 0)
+    return;
+  for (std::size_t p = 0; p < n_points; ++p)
+    values[p * n_terms + 1] = x[p];
+  // (k + 1) P_{k+1} = (2k + 1) x P_k - k P_{k-1}
+  for (std::size_t k = 1; k < order; ++k)
+  {
+    const Real a = Real(2 * k + 1) / (k + 1);
+    const Real b = Real(k) / (k + 1);
+    for (std::size_t p = 0; p < n_points; ++p)
+    {
+      Real * v = values + p * n_terms;
+      v[k + 1] = a * x[p] * v[k] - b * v[k - 1];
+    }
+  }
+}
+
+/// The index of the Zernike term of degree n and rank m (m = -n, -n + 2, ..., n), as in Zernike
+inline std::size_t
+zernikeIndex(std::size_t n, long m)
+{
+  return (n * (n + 2) + m) / 2;
+}
+
+/// The number of Zernike terms up to the degree order
+inline std::size_t
+zernikeNumberOfTerms(std::size_t order)
+{
+  return (order + 1) * (order + 2) / 2;
+}
+
+/**
+ * The Zernike polynomials R_n^|m|(r) cos(m theta) (m >= 0) and R_n^|m|(r) sin(|m| theta)
+ * (m < 0) up to the degree order, at each standardized location (r, theta) in the unit disc
+ * @param values n_points * zernikeNumberOfTerms(order) values, point-major, ordered by
+ * zernikeIndex()
+ * @param radial Scratch space, resized as needed
+ */
+inline void
+zernike(std::size_t order,
+        std::size_t n_points,
+        const Real * r,
+        const Real * theta,
+        Real * values,
+        std::vector<Real> & radial)
+{
+  // R_n^m for 0 <= m <= n, stored at (n (n + 1) / 2 + m) * n_points: R_0^0 = 1, and
+  // R_n^m = r (R_{n-1}^{|m-1|} + R_{n-1}^{m+1}) - R_{n-2}^m, the terms with n - m odd or m > n
+  // being zero
+  const auto tri = [](std::size_t n, std::size_t m) { return n * (n + 1) / 2 + m; };
+  radial.assign(zernikeNumberOfTerms(order) * n_points, 0.0);
+  for (std::size_t p = 0; p < n_points; ++p)
+    radial[p] = 1;
+  for (std::size_t n = 1; n <= order; ++n)
+    for (std::size_t m = n % 2; m <= n; m += 2)
+    {
+      Real * R = &radial[tri(n, m) * n_points];
+      const Real * low = &radial[tri(n - 1, m ? m - 1 : 1) * n_points];
+      const Real * high = m + 1 <= n - 1 ? &radial[tri(n - 1, m + 1) * n_points] : nullptr;
+      const Real * previous = m + 2 <= n ? &radial[tri(n - 2, m) * n_points] : nullptr;
+      for (std::size_t p = 0; p < n_points; ++p)
+        R[p] = r[p] * (low[p] + (high ? high[p] : 0.0)) - (previous ? previous[p] : 0.0);
+    }
+
+  // cos(m theta) and sin(m theta) by the Chebyshev recurrence, applied degree by degree
+  const std::size_t n_terms = zernikeNumberOfTerms(order);
+  for (std::size_t p = 0; p < n_points; ++p)
+  {
+    const Real c1 = std::cos(theta[p]);
+    const Real s1 = std::sin(theta[p]);
+    Real * v = values + p * n_terms;
+    Real cos_m = 1, sin_m = 0, cos_prev = c1, sin_prev = -s1;
+    for (std::size_t m = 0; m <= order; ++m)
+    {
+      for (std::size_t n = m; n <= order; n += 2)
+      {
+        const Real R = radial[tri(n, m) * n_points + p];
+        v[zernikeIndex(n, long(m))] = R * cos_m;
+        if (m)
+          v[zernikeIndex(n, -long(m))] = R * sin_m;
+      }
+      const Real cos_next = 2 * c1 * cos_m - cos_prev;
+      const Real sin_next = 2 * c1 * sin_m - sin_prev;
+      cos_prev = cos_m;
+      sin_prev = sin_m;
+      cos_m = cos_next;
+      sin_m = sin_next;
+    }
+  }
+}
+}
@@ -12,9 +12,14 @@
 #include "MultiAppTransfer.h"
 
 #include "MutableCoefficientsInterface.h"
+#include "FXCoefficientPack.h"
 
 /**
  * Transfers mutable coefficient arrays between supported object types
+ *
+ * With `packed = true`, the arrays of all the local sub-apps are packed into one FXCoefficientPack
+ * and exchanged with a single collective operation on the transfer communicator, instead of one
+ * transfer per sub-app (which dominates for thousands of small sub-apps).
  */
 class MultiAppFXTransfer : public MultiAppTransfer
 {
@@ -34,6 +39,12 @@ protected:
   /// Name of the MutableCoefficientsInterface-derived object in the MultiApp
   const std::string _multi_app_object_name;
 
+  /// Whether the arrays of all the sub-apps are exchanged at once
+  const bool _packed;
+
+  /// The packed arrays of the last packed transfer
+  FXCoefficientPack _pack;
+
 private:
   /**
    * Gets a MutableCoefficientsInterface-based Function, intented for use via function pointer
@@ -57,6 +68,13 @@ private:
       FEProblemBase & base, const std::string & object_name, THREAD_ID thread);
 
 protected:
+  /**
+   * The packed transfer: packs the arrays of the local sub-apps (from the MultiApp) or of this
+   * app (to the MultiApp), gathers the pack on all the processors and imports each array into
+   * its target objects
+   */
+  virtual void executePacked();
+
   /**
    * Searches an FEProblemBase for a MutableCoefficientsInterface-based object and returns a
    * function pointer to the matched function type.
@@ -0,0 +1,83 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+#include <vector>
+
+/**
+ * The coefficient arrays of many sub-apps packed into one buffer, so MultiAppFXTransfer exchanges
+ * the arrays of all the sub-apps with one collective operation instead of one transfer per
+ * sub-app.
+ *
+ * Each array is stored as its global app index, its size, then its coefficients, all as Real (the
+ * indices and sizes are exactly representable), so the buffers of the processors concatenate
+ * into a valid buffer and a single allgather shares every array with every processor.
+ */
+class FXCoefficientPack
+{
+public:
+  /// Appends the coefficients of a sub-app
+  void add(unsigned int app, const std::vector<Real> & coefficients)
+  {
+    _buffer.reserve(_buffer.size() + coefficients.size() + 2);
+    _buffer.push_back(app);
+    _buffer.push_back(coefficients.size());
+    _buffer.insert(_buffer.end(), coefficients.begin(), coefficients.end());
+    ++_n_arrays;
+  }
+
+  void clear()
+  {
+    _buffer.clear();
+    _n_arrays = 0;
+  }
+
+  /// Concatenates the packs of all the processors of comm, in rank order
+  void allgather(const libMesh::Parallel::Communicator & comm)
+  {
+    comm.allgather(_buffer);
+    _n_arrays = 0;
+    forEach([this](unsigned int, const Real *, std::size_t) { ++_n_arrays; });
+  }
+
+  /// The number of arrays in the pack
+  std::size_t size() const { return _n_arrays; }
+
+  /**
+   * Calls action(app, coefficients, size) for each array, in the order they were added
+   */
+  template <typename Action>
+  void forEach(const Action & action) const
+  {
+    std::size_t i = 0;
+    while (i < _buffer.size())
+    {
+      if (i + 2 > _buffer.size())
+        mooseError("Truncated FX coefficient pack");
+      const auto app = static_cast<unsigned int>(_buffer[i]);
+      const auto n = static_cast<std::size_t>(_buffer[i + 1]);
+      if (i + 2 + n > _buffer.size())
+        mooseError("Truncated FX coefficient pack for app ", app);
+      action(app, &_buffer[i + 2], n);
+      i += 2 + n;
+    }
+  }
+
+  const std::vector<Real> & buffer() const { return _buffer; }
+
+private:
+  std::vector<Real> _buffer;
+  std::size_t _n_arrays = 0;
+};
@@ -0,0 +1,126 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "libmesh/threads.h"
+
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * A memoization cache holding at most a given number of entries: when it is full, inserting
+ * evicts the least recently used entry. Evaluations at the quadrature points of a moving mesh
+ * never hit again, so an unbounded cache would only grow; with a bound, the entries of the
+ * current configuration stay while the old ones are dropped.
+ *
+ * All the operations take a mutex, as the function objects are shared by the threads. The hits
+ * and misses are counted, to judge from the hit rate whether memoizing is worthwhile.
+ */
+template <typename Key, typename Value>
+class LRUMemoCache
+{
+public:
+  /// @param capacity The maximum number of entries, 0 for no bound
+  explicit LRUMemoCache(std::size_t capacity = 0) : _capacity(capacity) {}
+
+  void setCapacity(std::size_t capacity)
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _capacity = capacity;
+    evict();
+  }
+
+  std::size_t capacity() const { return _capacity; }
+
+  /**
+   * Looks for an entry, which then becomes the most recently used
+   * @return true and its value in value if found
+   */
+  bool find(const Key & key, Value & value)
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    const auto it = _index.find(key);
+    if (it == _index.end())
+    {
+      ++_misses;
+      return false;
+    }
+    ++_hits;
+    _entries.splice(_entries.begin(), _entries, it->second);
+    value = it->second->second;
+    return true;
+  }
+
+  /// Inserts or replaces an entry, evicting the least recently used one if full
+  void insert(const Key & key, const Value & value)
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    const auto it = _index.find(key);
+    if (it != _index.end())
+    {
+      it->second->second = value;
+      _entries.splice(_entries.begin(), _entries, it->second);
+      return;
+    }
+    _entries.emplace_front(key, value);
+    _index.emplace(key, _entries.begin());
+    evict();
+  }
+
+  /// Drops all the entries (the statistics are kept)
+  void clear()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _entries.clear();
+    _index.clear();
+  }
+
+  std::size_t size() const { return _entries.size(); }
+
+  ///@{ Statistics of find()
+  unsigned long hits() const { return _hits; }
+  unsigned long misses() const { return _misses; }
+  double hitRate() const
+  {
+    const auto total = _hits + _misses;
+    return total ? double(_hits) / total : 0.0;
+  }
+  void resetStatistics()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _hits = _misses = 0;
+  }
+  ///@}
+
+private:
+  /// Drops the least recently used entries beyond the capacity, with the mutex held
+  void evict()
+  {
+    if (_capacity == 0)
+      return;
+    while (_entries.size() > _capacity)
+    {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+  }
+
+  std::size_t _capacity;
+
+  /// The entries, most recently used first
+  std::list<std::pair<Key, Value>> _entries;
+  std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator> _index;
+
+  unsigned long _hits = 0;
+  unsigned long _misses = 0;
+
+  Threads::spin_mutex _mutex;
+};
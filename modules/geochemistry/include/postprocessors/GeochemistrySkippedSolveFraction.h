@@ -0,0 +1,33 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+#include "GeochemistrySpatialReactor.h"
+
+/**
+ * Outputs the fraction of the nodal solves of a GeochemistrySpatialReactor skipped in its last
+ * execution because the inputs of the nodes had not changed
+ */
+class GeochemistrySkippedSolveFraction : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  GeochemistrySkippedSolveFraction(const InputParameters & parameters);
+
+  virtual void execute() override{};
+  virtual void initialize() override{};
+  virtual PostprocessorValue getValue() override { return _reactor.getSkippedFraction(); }
+
+private:
+  /// The reactor whose solves are counted
+  const GeochemistrySpatialReactor & _reactor;
+};
@@ -40,6 +40,13 @@ public:
   virtual const DenseVector<Real> & getMoleAdditions(dof_id_type node_id) const override;
   virtual Real getMolesDumped(dof_id_type node_id, const std::string & species) const override;
 
+  /// The fraction of the nodal solves of the last execution skipped as their inputs were unchanged
+  Real getSkippedFraction() const
+  {
+    const Real total = _num_solves_skipped + _num_solves_performed;
+    return total > 0 ? _num_solves_skipped / total : 0.0;
+  }
+
 protected:
   /// Initial equilibration temperature
   const Real _initial_temperature;
@@ -102,6 +109,82 @@ protected:
   /// number of threads used to execute this UserObject
   unsigned _nthreads;
 
+  /**
+   * A node need not be re-equilibrated if its bulk composition is not altered (the mole additions
+   * deferred since its last solve plus the current ones are all smaller than
+   * skip_unchanged_abs_tolerance, in moles), there are no kinetic species, and its temperature
+   * and controlled activities are within skip_unchanged_rel_tolerance (relative) of those of its
+   * last solve. Zero disables the skipping.
+   */
+  const Real _skip_abs_tolerance;
+  const Real _skip_rel_tolerance;
+  /// The temperature and controlled activities of the last solve at each node
+  std::vector<std::vector<Real>> _last_solved_inputs;
+  /// The mole additions of the skipped solves at each node since its last solve
+  std::vector<DenseVector<Real>> _deferred_additions;
+  ///@{ The number of nodal solves skipped and performed in the last execution, summed over the
+  /// threads in threadJoin() and over the processors in finalize()
+  unsigned long _num_solves_skipped;
+  unsigned long _num_solves_performed;
+  ///@}
+
   /// Build the _my_node_number map
   void buildMyNodeNumber();
+
+  /**
+   * Whether the solve at a node may be skipped (see _skip_abs_tolerance)
+   * @param my_node the node number used in this object
+   * @param inputs the current temperature followed by the controlled activities
+   * @param mole_additions the current mole additions
+   */
+  bool canSkipSolve(unsigned my_node,
+                    const std::vector<Real> & inputs,
+                    const DenseVector<Real> & mole_additions) const
+  {
+    if (_skip_abs_tolerance <= 0.0 || _num_kin > 0 || my_node >= _last_solved_inputs.size() ||
+        my_node >= _deferred_additions.size())
+      return false;
+    const DenseVector<Real> & deferred = _deferred_additions[my_node];
+    for (unsigned i = 0; i < mole_additions.size(); ++i)
+      if (std::abs(mole_additions(i) + (i < deferred.size() ? deferred(i) : 0.0)) >=
+          _skip_abs_tolerance)
+        return false;
+    const auto & last = _last_solved_inputs[my_node];
+    if (last.size() != inputs.size())
+      return false;
+    for (unsigned i = 0; i < inputs.size(); ++i)
+      if (std::abs(inputs[i] - last[i]) >= _skip_rel_tolerance * std::max(std::abs(last[i]), 1.0))
+        return false;
+    return true;
+  }
+
+  /**
+   * Keeps the mole additions of a skipped solve, to be added to the node by its next solve
+   * @param my_node the node number used in this object
+   * @param mole_additions the mole additions of the skipped solve
+   */
+  void deferAdditions(unsigned my_node, const DenseVector<Real> & mole_additions)
+  {
+    mooseAssert(my_node < _deferred_additions.size(), "No deferred additions for the node");
+    DenseVector<Real> & deferred = _deferred_additions[my_node];
+    if (deferred.size() != mole_additions.size())
+      deferred.resize(mole_additions.size());
+    deferred += mole_additions;
+  }
+
+  /**
+   * Adds the mole additions deferred at a node to those of the solve about to be performed, and
+   * forgets them
+   * @param my_node the node number used in this object
+   * @param[in,out] mole_additions the mole additions of the solve
+   */
+  void applyDeferredAdditions(unsigned my_node, DenseVector<Real> & mole_additions)
+  {
+    if (my_node >= _deferred_additions.size())
+      return;
+    DenseVector<Real> & deferred = _deferred_additions[my_node];
+    if (deferred.size() == mole_additions.size())
+      mole_additions += deferred;
+    deferred.zero();
+  }
 };
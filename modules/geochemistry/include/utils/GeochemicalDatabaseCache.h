@@ -0,0 +1,119 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "nlohmann/json.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Binary cache of parsed geochemical database files. Parsing the JSON text of a full database
+ * (eg, llnl) dominates the startup of a geochemistry simulation, while reading back its CBOR
+ * encoding (the binary JSON of nlohmann::json) is a copy. The cache file holds a magic number,
+ * the key of the database it was made from (a hash of the content of the database file, so an
+ * edited database is re-parsed) and the CBOR bytes of the parsed JSON.
+ */
+namespace GeochemicalDatabaseCache
+{
+/// Identifies cache files (and their format version)
+constexpr std::uint64_t magic = 0x47434442434f5231ull;
+
+/// FNV-1a hash of a sequence of bytes, continuing from \p hash
+inline std::uint64_t
+hashBytes(const char * bytes, std::size_t n, std::uint64_t hash = 1469598103934665603ull)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    hash ^= static_cast<unsigned char>(bytes[i]);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+/// Hash of the contents of a file (0 if it cannot be read)
+inline std::uint64_t
+hashFile(const std::string & filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  if (!file)
+    return 0;
+  std::uint64_t hash = 1469598103934665603ull;
+  std::vector<char> buffer(1 << 16);
+  while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+    hash = hashBytes(buffer.data(), file.gcount(), hash);
+  return hash;
+}
+
+/// The cache file of a key in a directory
+inline std::string
+cacheFile(const std::string & directory, std::uint64_t key)
+{
+  std::ostringstream name;
+  name << directory << "/geochemical_database_" << std::hex << key << ".cbor";
+  return name.str();
+}
+
+/**
+ * Reads a parsed database from a cache file
+ * @param filename The cache file
+ * @param key The key of the database expected
+ * @param root The parsed database, upon success
+ * @return whether the cache file exists, is valid and holds the key
+ */
+inline bool
+load(const std::string & filename, std::uint64_t key, nlohmann::json & root)
+{
+  std::ifstream file(filename, std::ios::binary);
+  if (!file)
+    return false;
+  std::uint64_t header[2];
+  if (!file.read(reinterpret_cast<char *>(header), sizeof(header)) || header[0] != magic ||
+      header[1] != key)
+    return false;
+
+  const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)),
+                                        std::istreambuf_iterator<char>());
+  root = nlohmann::json::from_cbor(bytes, true, false);
+  return !root.is_discarded();
+}
+
+/**
+ * Writes a parsed database to a cache file. The bytes are written to a temporary file renamed
+ * into place, so that the processors sharing a cache directory never read a partial file.
+ * @param writer A number unique to the writer (eg, the processor id) naming its temporary file
+ * @return whether the file could be written
+ */
+inline bool
+save(const std::string & filename,
+     std::uint64_t key,
+     const nlohmann::json & root,
+     unsigned int writer)
+{
+  const std::string temporary = filename + ".tmp" + std::to_string(writer);
+  {
+    std::ofstream file(temporary, std::ios::binary);
+    if (!file)
+      return false;
+    const std::uint64_t header[2] = {magic, key};
+    file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    const auto bytes = nlohmann::json::to_cbor(root);
+    file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    if (!file)
+      return false;
+  }
+  return std::rename(temporary.c_str(), filename.c_str()) == 0;
+}
+}
@@ -11,6 +11,7 @@
 
 #include "nlohmann/json.h"
 #include "MooseTypes.h"
+#include "GeochemicalDatabaseCache.h"
 
 /**
  * Data structure for basis (primary) species.
@@ -224,17 +225,24 @@ public:
    * regardless of the value found in the filename.  This is designed to make testing easy (because
    * logK and Debye-Huckel parameters will be exactly as set in the filename instead of from a 4-th
    * order least-squares fit) but should rarely be used for real geochemical simulations
+   * @param cache_directory If not empty, the parsed database is read from (or, the first time,
+   * written to) a binary cache in this directory, keyed by the contents of filename
    */
   GeochemicalDatabaseReader(const FileName filename,
                             const bool reexpress_free_electron = true,
                             const bool use_piecewise_interpolation = false,
-                            const bool remove_all_extrapolated_secondary_species = false);
+                            const bool remove_all_extrapolated_secondary_species = false,
+                            const std::string & cache_directory = "");
 
   /**
-   * Parse the thermodynamic database
+   * Parse the thermodynamic database, or read it from the binary cache of _cache_directory (see
+   * GeochemicalDatabaseCache) when one exists for the current contents of the file
    */
   void read(FileName filename);
 
+  /// The hash of the contents of the database file, which keys its binary cache
+  std::uint64_t getDatabaseHash() const { return _database_hash; }
+
   /**
    * Sometimes the free electron's equilibrium reaction is defined in terms of O2(g) which is not a
    * basis species.  If this is the case, re-express it in terms of O2(aq), if O2(g) is a gas and
@@ -482,6 +490,10 @@ protected:
 
   /// Database filename
   const FileName _filename;
+  /// Directory of the binary cache of the parsed database (no cache if empty)
+  const std::string _cache_directory;
+  /// Hash of the contents of the database file
+  std::uint64_t _database_hash = 0;
   /// JSON data
   nlohmann::json _root;
   /// List of basis (primary) species names read from database
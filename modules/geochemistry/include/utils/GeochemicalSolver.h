@@ -11,6 +11,7 @@
 
 #include "GeochemicalSystem.h"
 #include "GeochemistryIonicStrength.h"
+#include "GeochemistryBatchedLU.h"
 
 /**
  * This class contains methods to solve the algebraic system in GeochemicalSystem
@@ -115,6 +116,12 @@ private:
   Real _abs_residual;
   /// jacobian of the algebraic system
   DenseMatrix<Real> _jacobian;
+  /**
+   * Contiguous LU workspace of the Newton systems, sized once per algebraic system size, so that
+   * the many nodal solves performed by one solver (one per thread of GeochemistrySpatialReactor)
+   * do not allocate in solveAndUnderrelax
+   */
+  mutable GeochemistryBatchedLU _lu;
   /// the new molality after finding the solution of _jacobian * neg_change_mol = _residual
   DenseVector<Real> _new_mol;
   /// If the residual of the algebraic system falls below this value, the Newton process has converged
@@ -0,0 +1,110 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/**
+ * LU factorisations with partial pivoting of a batch of dense n x n systems, stored contiguously
+ * (row-major, one system after the other) with their pivots. The memory is kept between
+ * resize() calls of the same or smaller size, so the Newton iterations of the nodal solves of a
+ * thread factorise their Jacobians without allocating, unlike DenseMatrix::lu_solve.
+ */
+class GeochemistryBatchedLU
+{
+public:
+  /// Sizes the batch for num_systems systems of size n, reusing the memory
+  void resize(unsigned num_systems, unsigned n)
+  {
+    _num_systems = num_systems;
+    _n = n;
+    _a.resize(std::size_t(num_systems) * n * n);
+    _pivots.resize(std::size_t(num_systems) * n);
+  }
+
+  unsigned numSystems() const { return _num_systems; }
+  unsigned size() const { return _n; }
+
+  /// The matrix of system s: matrix(s)[i * size() + j] is entry (i, j), to fill before factor()
+  Real * matrix(unsigned s) { return &_a[std::size_t(s) * _n * _n]; }
+
+  /**
+   * Factorises system s in place
+   * @return false if the matrix is singular (a zero pivot), in which case solve() must not be used
+   */
+  bool factor(unsigned s)
+  {
+    Real * a = matrix(s);
+    unsigned * pivots = &_pivots[std::size_t(s) * _n];
+    for (unsigned k = 0; k < _n; ++k)
+    {
+      unsigned p = k;
+      for (unsigned i = k + 1; i < _n; ++i)
+        if (std::abs(a[i * _n + k]) > std::abs(a[p * _n + k]))
+          p = i;
+      pivots[k] = p;
+      if (a[p * _n + k] == 0.0)
+        return false;
+      if (p != k)
+        for (unsigned j = 0; j < _n; ++j)
+          std::swap(a[k * _n + j], a[p * _n + j]);
+
+      const Real inv_pivot = 1.0 / a[k * _n + k];
+      for (unsigned i = k + 1; i < _n; ++i)
+      {
+        Real * row = a + i * _n;
+        const Real l = row[k] * inv_pivot;
+        row[k] = l;
+        const Real * pivot_row = a + k * _n;
+        for (unsigned j = k + 1; j < _n; ++j)
+          row[j] -= l * pivot_row[j];
+      }
+    }
+    return true;
+  }
+
+  /// Factorises every system, returning false if any is singular
+  bool factorAll()
+  {
+    bool ok = true;
+    for (unsigned s = 0; s < _num_systems; ++s)
+      ok = factor(s) && ok;
+    return ok;
+  }
+
+  /// Overwrites b (size() entries) with the solution of system s, which must be factorised
+  void solve(unsigned s, Real * b) const
+  {
+    const Real * a = &_a[std::size_t(s) * _n * _n];
+    const unsigned * pivots = &_pivots[std::size_t(s) * _n];
+    for (unsigned k = 0; k < _n; ++k)
+      if (pivots[k] != k)
+        std::swap(b[k], b[pivots[k]]);
+    for (unsigned i = 1; i < _n; ++i)
+      for (unsigned j = 0; j < i; ++j)
+        b[i] -= a[i * _n + j] * b[j];
+    for (unsigned i = _n; i-- > 0;)
+    {
+      for (unsigned j = i + 1; j < _n; ++j)
+        b[i] -= a[i * _n + j] * b[j];
+      b[i] /= a[i * _n + i];
+    }
+  }
+
+private:
+  unsigned _num_systems = 0;
+  unsigned _n = 0;
+  std::vector<Real> _a;
+  std::vector<unsigned> _pivots;
+};
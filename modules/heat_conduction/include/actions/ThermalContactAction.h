@@ -29,12 +29,19 @@ protected:
   virtual void addMaterials();
   virtual void addSecondaryFluxVector();
 
+  /// Adds the GapPairCacheUserObject shared by the material and the BC of the pair
+  virtual void addGapPairCache();
+
   const bool _quadrature;
   const MooseEnum _order;
   const AuxVariableName _penetration_var_name;
   const AuxVariableName _gap_value_name;
   const AuxVariableName _gap_conductivity_name;
 
+  /// Whether the material and the BC share the gap data of the sides (quadrature only)
+  const bool _cache_gap_pairs;
+  const UserObjectName _gap_pair_cache_name;
+
   BoundaryName _primary_name;
   BoundaryName _secondary_name;
 };
@@ -13,6 +13,8 @@
 #include "GapConductance.h"
 
 class PenetrationInfo;
+struct GapPairData;
+class GapPairCache;
 
 /**
  * Generic gap heat transfer model, with h_gap =  h_conduction + h_contact + h_radiation
@@ -85,6 +87,15 @@ protected:
   PenetrationLocator * _penetration_locator;
   const bool _warnings;
 
+  /**
+   * Gap data of the sides, shared with the GapConductance material of the pair: the penetration
+   * locator is queried once per side and nonlinear iteration, by whichever of them runs first
+   */
+  GapPairCache * const _gap_pair_cache;
+
+  /// The data of the current side, from the cache
+  const GapPairData * _gap_pair_data;
+
   Point & _p1;
   Point & _p2;
 
@@ -59,6 +59,44 @@ protected:
    */
   virtual ADReal computeQpResidual(Moose::MortarType mortar_type) override;
 
+  /**
+   * The gap conductance of GapConductance for a plate gap, h = k / max(l, l_min) plus the gray
+   * body radiation between the faces, evaluated at each mortar segment quadrature point so the
+   * constraint needs no gap material. The evaluation only reads the members below, so the
+   * threaded mortar segment loop (see ComputeMortarFunctor::setThreadConstraints) can run it
+   * on all the threads.
+   */
+  ADReal
+  gapConductance(const ADReal & gap, const ADReal & T_secondary, const ADReal & T_primary) const
+  {
+    const ADReal l = std::max(std::min(gap, ADReal(_max_gap)), ADReal(_min_gap));
+    ADReal h = _k / l;
+    if (_radiation)
+    {
+      // sigma (T1^2 + T2^2) (T1 + T2) / (1/eps1 + 1/eps2 - 1)
+      const ADReal T1 = T_secondary + _absolute_temperature_offset;
+      const ADReal T2 = T_primary + _absolute_temperature_offset;
+      h += _stefan_boltzmann * (T1 * T1 + T2 * T2) * (T1 + T2) * _emissivity;
+    }
+    return h;
+  }
+
   /// Thermal conductivity of the gap medium (e.g. air).
   const Real _k;
+
+  ///@{ Gap lengths the conductance is limited to, as GapConductance's min_gap and max_gap
+  const Real _min_gap;
+  const Real _max_gap;
+  ///@}
+
+  /// Whether radiation across the gap is added to the conduction
+  const bool _radiation;
+
+  /// The effective emissivity 1 / (1/eps_secondary + 1/eps_primary - 1)
+  const Real _emissivity;
+
+  const Real _stefan_boltzmann;
+
+  /// Added to the temperature for the radiation, when it is not absolute
+  const Real _absolute_temperature_offset;
 };
@@ -11,6 +11,9 @@
 
 #include "Material.h"
 
+struct GapPairData;
+class GapPairCache;
+
 /**
  * Generic gap heat transfer model, with h_gap =  h_conduction + h_contact + h_radiation
  */
@@ -44,6 +47,20 @@ public:
                                        Point & p1,
                                        Point & p2);
 
+  /**
+   * Fills the gap data of the quadrature points of a secondary side from the penetration locator
+   * (through the quadrature nodes of the side), for the GapPairCache shared by the material and the
+   * BC of a contact pair
+   */
+  static void computeGapPairData(MooseMesh & mesh,
+                                 const PenetrationLocator & penetration_locator,
+                                 const Elem * elem,
+                                 unsigned int side,
+                                 const GAP_GEOMETRY gap_geometry_type,
+                                 const Point & p1,
+                                 const Point & p2,
+                                 GapPairData & data);
+
   static void computeGapRadii(const GAP_GEOMETRY gap_geometry_type,
                               const Point & current_point,
                               const Point & p1,
@@ -118,6 +135,12 @@ protected:
   DofMap * _dof_map;
   const bool _warnings;
 
+  /// Gap data of the sides shared with GapHeatTransfer for a nonlinear iteration, if given
+  GapPairCache * const _gap_pair_cache;
+
+  /// The data of the current side, from the cache, while computing its properties
+  const GapPairData * _gap_pair_data;
+
   Point & _p1;
   Point & _p2;
 };
@@ -0,0 +1,40 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "GapPairCache.h"
+
+/**
+ * Owns the GapPairCache of a thermal contact pair, shared by the GapConductance material and the
+ * GapHeatTransfer BC that ThermalContactAction adds for the pair. The cache is invalidated on each
+ * execution and cleared when the mesh changes. The object executes on LINEAR as well as NONLINEAR:
+ * on a displaced mesh the geometry, hence the penetration locator, follows the displacements of
+ * every residual evaluation, so the gap data of a side only holds for the linear iteration it was
+ * computed in.
+ */
+class GapPairCacheUserObject : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  GapPairCacheUserObject(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override { _cache.invalidate(); }
+  virtual void finalize() override {}
+  virtual void meshChanged() override { _cache.clear(); }
+
+  /// The cache, modified by the objects evaluating the gap (hence not const)
+  GapPairCache & cache() const { return _cache; }
+
+protected:
+  mutable GapPairCache _cache;
+};
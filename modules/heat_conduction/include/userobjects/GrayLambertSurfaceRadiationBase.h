@@ -10,6 +10,7 @@
 #pragma once
 
 #include "SideUserObject.h"
+#include "RadiositySolver.h"
 
 // Forward Declarations
 class Function;
@@ -100,4 +101,24 @@ protected:
 
   /// the view factors which are set by setViewFactors by derived classes
   std::vector<std::vector<Real>> _view_factors;
+
+  /// how the radiosity system is solved: dense LU, Gauss-Seidel or GMRES
+  const MooseEnum _radiosity_solve_type;
+
+  /// view factors below this value are not stored by the iterative solvers
+  const Real _view_factor_threshold;
+
+  ///@{ convergence controls of the iterative solvers
+  const Real _radiosity_tolerance;
+  const unsigned int _radiosity_max_its;
+  ///@}
+
+  /**
+   * sparse view factors and iterative solvers, set up the first time the system is solved; they
+   * start from _radiosity, so each execution warm starts from the radiosities of the previous one
+   */
+  RadiositySolver _radiosity_solver;
+
+  /// whether _radiosity_solver holds the current view factors
+  bool _radiosity_solver_initialized;
 };
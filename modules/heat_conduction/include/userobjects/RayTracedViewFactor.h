@@ -0,0 +1,48 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ViewFactorBase.h"
+#include "ViewFactorRayTracer.h"
+
+/**
+ * Computes the view factors between sidesets by Monte Carlo ray tracing (see
+ * ViewFactorRayTracer), which, unlike UnobstructedPlanarViewFactor, accounts for the faces that
+ * obstruct the view and scales as O(N log N) in the number of faces. The faces of the boundaries
+ * are gathered on every processor, each processor traces the rays of its share of the faces with
+ * Threads::parallel_for, and the hit counts are summed. With a cache file, a later run with the
+ * same faces and parameters reads the view factors instead.
+ */
+class RayTracedViewFactor : public ViewFactorBase
+{
+public:
+  static InputParameters validParams();
+
+  RayTracedViewFactor(const InputParameters & parameters);
+
+  virtual void execute() override;
+  virtual void initialize() override;
+
+protected:
+  virtual void threadJoinViewFactor(const UserObject & y) override;
+  virtual void finalizeViewFactor() override;
+
+  /// Number of rays leaving each face
+  const unsigned int _rays_per_face;
+
+  /// Seed of the ray generators
+  const unsigned int _seed;
+
+  /// File the view factors are read from and written to (empty for no cache)
+  const FileName _cache_file;
+
+  /// The faces of the local sides, quadrilaterals split into two triangles
+  std::vector<ViewFactorRayTracer::Face> _faces;
+};
@@ -0,0 +1,186 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/point.h"
+#include "libmesh/threads.h"
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The geometric data of the gap at the quadrature points of a secondary side: what GapConductance
+ * and GapHeatTransfer get from the PenetrationLocator at each quadrature point, and what the
+ * gap geometry derives from it (the radii for cylinders and spheres)
+ */
+struct GapPairData
+{
+  /// Whether the penetration locator found a primary face for the point
+  std::vector<char> has_info;
+  std::vector<Real> distance;
+  std::vector<Point> normal;
+  std::vector<Real> r1;
+  std::vector<Real> r2;
+  std::vector<Real> radius;
+  /// The taper of the conductance for points off the primary face (see GapHeatTransfer)
+  std::vector<Real> edge_multiplier;
+  /// The primary element and side, for the primary temperature and the secondary Jacobian
+  std::vector<dof_id_type> primary_elem;
+  std::vector<unsigned short> primary_side;
+  /// The reference coordinates of the contact point on the primary side
+  std::vector<Point> primary_ref_point;
+
+  void resize(std::size_t n_qp)
+  {
+    has_info.assign(n_qp, 0);
+    distance.assign(n_qp, 0);
+    normal.assign(n_qp, Point());
+    r1.assign(n_qp, 0);
+    r2.assign(n_qp, 0);
+    radius.assign(n_qp, 0);
+    edge_multiplier.assign(n_qp, 1);
+    primary_elem.assign(n_qp, 0);
+    primary_side.assign(n_qp, 0);
+    primary_ref_point.assign(n_qp, Point());
+  }
+
+  std::size_t size() const { return distance.size(); }
+
+  void swap(GapPairData & other)
+  {
+    has_info.swap(other.has_info);
+    distance.swap(other.distance);
+    normal.swap(other.normal);
+    r1.swap(other.r1);
+    r2.swap(other.r2);
+    radius.swap(other.radius);
+    edge_multiplier.swap(other.edge_multiplier);
+    primary_elem.swap(other.primary_elem);
+    primary_side.swap(other.primary_side);
+    primary_ref_point.swap(other.primary_ref_point);
+  }
+};
+
+/**
+ * Cache of the GapPairData of the secondary sides of a contact pair, valid until the next
+ * invalidate() (see GapPairCacheUserObject): the first object evaluating a side (GapConductance or
+ * GapHeatTransfer, whichever runs first) fills it through the penetration locator, the others and
+ * the later residual and Jacobian evaluations read it.
+ *
+ * The sides may be requested by several threads: the data of a side is computed into a local
+ * GapPairData without holding the lock, then moved into the cache under the lock unless another
+ * thread stored it meanwhile. The stored data of a side is never written again until the next
+ * invalidate(), which must not be called while the sides are being evaluated.
+ */
+class GapPairCache
+{
+public:
+  /**
+   * The data of a side, filled by compute(data) if it is not current
+   * @param n_qp The number of quadrature points of the side
+   * @param compute compute(GapPairData &) fills the data, already sized to n_qp
+   */
+  template <typename Compute>
+  const GapPairData &
+  get(dof_id_type elem_id, unsigned int side, unsigned int n_qp, const Compute & compute)
+  {
+    Entry * entry;
+    {
+      Threads::spin_mutex::scoped_lock lock(_mutex);
+      const auto it = _index.find(key(elem_id, side));
+      if (it == _index.end())
+      {
+        _entries.emplace_back();
+        entry = &_entries.back();
+        _index.emplace(key(elem_id, side), entry);
+      }
+      else
+        entry = it->second;
+      if (entry->generation == _generation && entry->data.size() == n_qp)
+      {
+        ++_hits;
+        return entry->data;
+      }
+      ++_misses;
+    }
+
+    GapPairData data;
+    data.resize(n_qp);
+    compute(data);
+
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    if (entry->generation != _generation || entry->data.size() != n_qp)
+    {
+      entry->data.swap(data);
+      entry->generation = _generation;
+    }
+    return entry->data;
+  }
+
+  /// Marks every side out of date, for a new nonlinear iteration
+  void invalidate()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    ++_generation;
+  }
+
+  /// Drops all the sides, when the mesh changes
+  void clear()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _index.clear();
+    _entries.clear();
+    ++_generation;
+  }
+
+  ///@{ Number of requests served from the cache and computed since the last resetCounters()
+  unsigned long hits() const
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _hits;
+  }
+  unsigned long misses() const
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _misses;
+  }
+  void resetCounters()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _hits = _misses = 0;
+  }
+  ///@}
+
+private:
+  struct Entry
+  {
+    GapPairData data;
+    /// The iteration the data was computed for (0 before the first)
+    unsigned long generation = 0;
+  };
+
+  static std::uint64_t key(dof_id_type elem_id, unsigned int side)
+  {
+    return (std::uint64_t(elem_id) << 8) | side;
+  }
+
+  /// The entries, in a deque so they do not move as others are added
+  std::deque<Entry> _entries;
+  std::unordered_map<std::uint64_t, Entry *> _index;
+  unsigned long _generation = 1;
+  unsigned long _hits = 0;
+  unsigned long _misses = 0;
+  mutable Threads::spin_mutex _mutex;
+};
@@ -0,0 +1,262 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * Iterative solve of the radiosity system of GrayLambertSurfaceRadiationBase,
+ *
+ *   J_i - rho_i sum_j F_ij J_j = beta_i,
+ *
+ * with rho_i = 1 - eps_i and beta_i = eps_i sigma T_i^4 on the surfaces of given temperature,
+ * rho_i = 1 and beta_i = 0 on the adiabatic ones. The view factors are stored in compressed
+ * sparse rows without the entries below a threshold, so a surface only sees the faces it
+ * exchanges with noticeably, and the solve starts from the radiosities given (those of the
+ * previous execution), which the temperatures of one time step change little.
+ */
+class RadiositySolver
+{
+public:
+  /**
+   * Stores the view factors, dropping the entries below threshold
+   * @param view_factors The dense view factors, F[i][j] from surface i to surface j
+   */
+  void setViewFactors(const std::vector<std::vector<Real>> & view_factors, Real threshold = 0)
+  {
+    const auto n = view_factors.size();
+    _offsets.assign(1, 0);
+    _columns.clear();
+    _values.clear();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (view_factors[i].size() != n)
+        mooseError("The view factor matrix is not square");
+      for (std::size_t j = 0; j < n; ++j)
+        if (std::abs(view_factors[i][j]) > threshold)
+        {
+          _columns.push_back(j);
+          _values.push_back(view_factors[i][j]);
+        }
+      _offsets.push_back(_columns.size());
+    }
+  }
+
+  /**
+   * Stores view factors given as (row, column, value) entries, each row's entries in any order
+   * (for instance from a ray tracer, without forming the dense matrix)
+   */
+  void setViewFactors(std::size_t n,
+                      const std::vector<std::size_t> & rows,
+                      const std::vector<std::size_t> & columns,
+                      const std::vector<Real> & values,
+                      Real threshold = 0)
+  {
+    mooseAssert(rows.size() == columns.size() && rows.size() == values.size(),
+                "The view factor entries have different sizes");
+    _offsets.assign(n + 1, 0);
+    for (std::size_t k = 0; k < rows.size(); ++k)
+      if (std::abs(values[k]) > threshold)
+        ++_offsets[rows[k] + 1];
+    for (std::size_t i = 0; i < n; ++i)
+      _offsets[i + 1] += _offsets[i];
+    _columns.resize(_offsets[n]);
+    _values.resize(_offsets[n]);
+    std::vector<std::size_t> position(_offsets.begin(), _offsets.end() - 1);
+    for (std::size_t k = 0; k < rows.size(); ++k)
+      if (std::abs(values[k]) > threshold)
+      {
+        const auto p = position[rows[k]]++;
+        _columns[p] = columns[k];
+        _values[p] = values[k];
+      }
+  }
+
+  std::size_t size() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+  std::size_t numNonzeros() const { return _values.size(); }
+
+  /**
+   * Gauss-Seidel iterations, with over-relaxation if omega > 1
+   * @param radiosity The initial guess on entry, the solution on return
+   * @return The number of iterations, or -1 if the relative change did not fall below tolerance
+   */
+  int solveGaussSeidel(const std::vector<Real> & rho,
+                       const std::vector<Real> & beta,
+                       std::vector<Real> & radiosity,
+                       Real tolerance,
+                       unsigned int max_its,
+                       Real omega = 1.0) const
+  {
+    const auto n = size();
+    checkSizes(rho, beta, radiosity);
+    for (unsigned int it = 1; it <= max_its; ++it)
+    {
+      Real change = 0;
+      Real norm = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        // The self view factor F_ii of a concave surface is moved to the left-hand side
+        Real sum = 0;
+        Real diagonal = 1;
+        for (auto p = _offsets[i]; p < _offsets[i + 1]; ++p)
+          if (_columns[p] == i)
+            diagonal -= rho[i] * _values[p];
+          else
+            sum += _values[p] * radiosity[_columns[p]];
+        const Real updated = (beta[i] + rho[i] * sum) / diagonal;
+        const Real value = radiosity[i] + omega * (updated - radiosity[i]);
+        change = std::max(change, std::abs(value - radiosity[i]));
+        norm = std::max(norm, std::abs(value));
+        radiosity[i] = value;
+      }
+      if (change <= tolerance * norm)
+        return it;
+    }
+    return -1;
+  }
+
+  /**
+   * Restarted GMRES, for enclosures with mostly reflective or adiabatic surfaces, where
+   * Gauss-Seidel converges slowly
+   * @param radiosity The initial guess on entry, the solution on return
+   * @return The number of iterations, or -1 if the relative residual did not fall below tolerance
+   */
+  int solveGMRES(const std::vector<Real> & rho,
+                 const std::vector<Real> & beta,
+                 std::vector<Real> & radiosity,
+                 Real tolerance,
+                 unsigned int max_its,
+                 unsigned int restart = 30) const
+  {
+    const auto n = size();
+    checkSizes(rho, beta, radiosity);
+    const Real beta_norm = norm2(beta);
+    if (beta_norm == 0)
+    {
+      std::fill(radiosity.begin(), radiosity.end(), 0.0);
+      return 0;
+    }
+
+    std::vector<std::vector<Real>> basis(restart + 1, std::vector<Real>(n));
+    std::vector<std::vector<Real>> hessenberg(restart + 1, std::vector<Real>(restart, 0.0));
+    std::vector<Real> cs(restart), sn(restart), g(restart + 1), w(n);
+    unsigned int its = 0;
+    while (its < max_its)
+    {
+      // r = beta - A x
+      apply(rho, radiosity, w);
+      for (std::size_t i = 0; i < n; ++i)
+        basis[0][i] = beta[i] - w[i];
+      Real residual = norm2(basis[0]);
+      if (residual <= tolerance * beta_norm)
+        return its;
+      for (auto & v : basis[0])
+        v /= residual;
+      std::fill(g.begin(), g.end(), 0.0);
+      g[0] = residual;
+
+      unsigned int k = 0;
+      for (; k < restart && its < max_its; ++k, ++its)
+      {
+        // Arnoldi step with modified Gram-Schmidt
+        apply(rho, basis[k], basis[k + 1]);
+        for (unsigned int j = 0; j <= k; ++j)
+        {
+          hessenberg[j][k] = dot(basis[j], basis[k + 1]);
+          for (std::size_t i = 0; i < n; ++i)
+            basis[k + 1][i] -= hessenberg[j][k] * basis[j][i];
+        }
+        hessenberg[k + 1][k] = norm2(basis[k + 1]);
+        if (hessenberg[k + 1][k] > 0)
+          for (auto & v : basis[k + 1])
+            v /= hessenberg[k + 1][k];
+
+        // Givens rotations keep the Hessenberg matrix triangular
+        for (unsigned int j = 0; j < k; ++j)
+        {
+          const Real t = cs[j] * hessenberg[j][k] + sn[j] * hessenberg[j + 1][k];
+          hessenberg[j + 1][k] = -sn[j] * hessenberg[j][k] + cs[j] * hessenberg[j + 1][k];
+          hessenberg[j][k] = t;
+        }
+        const Real r = std::hypot(hessenberg[k][k], hessenberg[k + 1][k]);
+        cs[k] = hessenberg[k][k] / r;
+        sn[k] = hessenberg[k + 1][k] / r;
+        hessenberg[k][k] = r;
+        hessenberg[k + 1][k] = 0;
+        g[k + 1] = -sn[k] * g[k];
+        g[k] *= cs[k];
+        residual = std::abs(g[k + 1]);
+        if (residual <= tolerance * beta_norm)
+        {
+          ++k;
+          ++its;
+          break;
+        }
+      }
+
+      // x += V y with H y = g
+      std::vector<Real> y(k);
+      for (unsigned int j = k; j-- > 0;)
+      {
+        Real sum = g[j];
+        for (unsigned int l = j + 1; l < k; ++l)
+          sum -= hessenberg[j][l] * y[l];
+        y[j] = sum / hessenberg[j][j];
+      }
+      for (unsigned int j = 0; j < k; ++j)
+        for (std::size_t i = 0; i < n; ++i)
+          radiosity[i] += y[j] * basis[j][i];
+      if (residual <= tolerance * beta_norm)
+        return its;
+    }
+    return -1;
+  }
+
+private:
+  /// out = (I - diag(rho) F) x
+  void
+  apply(const std::vector<Real> & rho, const std::vector<Real> & x, std::vector<Real> & out) const
+  {
+    for (std::size_t i = 0; i < size(); ++i)
+    {
+      Real sum = 0;
+      for (auto p = _offsets[i]; p < _offsets[i + 1]; ++p)
+        sum += _values[p] * x[_columns[p]];
+      out[i] = x[i] - rho[i] * sum;
+    }
+  }
+
+  void checkSizes(const std::vector<Real> & rho,
+                  const std::vector<Real> & beta,
+                  const std::vector<Real> & radiosity) const
+  {
+    if (rho.size() != size() || beta.size() != size() || radiosity.size() != size())
+      mooseError("The radiosity system and the view factors have different sizes");
+  }
+
+  static Real dot(const std::vector<Real> & a, const std::vector<Real> & b)
+  {
+    Real sum = 0;
+    for (std::size_t i = 0; i < a.size(); ++i)
+      sum += a[i] * b[i];
+    return sum;
+  }
+
+  static Real norm2(const std::vector<Real> & a) { return std::sqrt(dot(a, a)); }
+
+  std::vector<std::size_t> _offsets;
+  std::vector<std::size_t> _columns;
+  std::vector<Real> _values;
+};
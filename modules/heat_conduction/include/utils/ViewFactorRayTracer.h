@@ -0,0 +1,438 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/point.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+/**
+ * Monte Carlo view factors between the boundaries of an enclosure, obstructed or not: rays leave
+ * each radiating face from uniformly sampled points in cosine-weighted directions, and the
+ * fraction of them whose first hit is on boundary j is the view factor of the face to j. The first
+ * hit is found through a bounding volume hierarchy over the faces, so a ray costs O(log N) rather
+ * than a test against each of the N faces, and the obstruction by any face comes for free.
+ *
+ * In 3D the faces are triangles (quadrilaterals are split by the caller), in 2D segments in the
+ * x-y plane. The face normals must point into the enclosure. Each face draws its rays from its own
+ * generator seeded by the face index, so the counts do not depend on how the faces are split
+ * among threads or processors.
+ */
+class ViewFactorRayTracer
+{
+public:
+  /// A radiating face
+  struct Face
+  {
+    /// The vertices (the first two in 2D)
+    std::array<Point, 3> vertices;
+    Point normal;
+    /// The index of the boundary of the face in the view factor matrix
+    unsigned int boundary;
+  };
+
+  /**
+   * @param dim The dimension, 2 (segments) or 3 (triangles)
+   * @param faces The faces of all the boundaries
+   * @param n_boundaries The number of boundaries
+   */
+  ViewFactorRayTracer(unsigned int dim, std::vector<Face> faces, unsigned int n_boundaries)
+    : _dim(dim), _faces(std::move(faces)), _n_boundaries(n_boundaries)
+  {
+    if (_dim != 2 && _dim != 3)
+      mooseError("Ray-traced view factors require a 2D or 3D enclosure");
+    for (const auto & face : _faces)
+      if (face.boundary >= _n_boundaries)
+        mooseError("A face of the view factor ray tracer has an invalid boundary index");
+
+    _index.resize(_faces.size());
+    for (std::size_t i = 0; i < _faces.size(); ++i)
+      _index[i] = i;
+    if (!_faces.empty())
+    {
+      _nodes.resize(1);
+      build(0, 0, _faces.size());
+    }
+  }
+
+  std::size_t numFaces() const { return _faces.size(); }
+  unsigned int numBoundaries() const { return _n_boundaries; }
+  const Face & face(std::size_t i) const { return _faces[i]; }
+
+  /// The area (length in 2D) of a face
+  Real area(std::size_t i) const
+  {
+    const auto & v = _faces[i].vertices;
+    if (_dim == 2)
+      return (v[1] - v[0]).norm();
+    return 0.5 * (v[1] - v[0]).cross(v[2] - v[0]).norm();
+  }
+
+  /**
+   * Traces the rays of the faces [begin, end)
+   * @param rays_per_face The number of rays of each face
+   * @param seed The seed, combined with the index of each face
+   * @param hits The number of rays of each face hitting each boundary, n_boundaries entries per
+   * face of the range (the rays escaping an open enclosure hit none)
+   */
+  void trace(std::size_t begin,
+             std::size_t end,
+             unsigned int rays_per_face,
+             std::uint64_t seed,
+             std::vector<unsigned int> & hits) const
+  {
+    hits.assign((end - begin) * _n_boundaries, 0);
+    std::uniform_real_distribution<Real> uniform(0.0, 1.0);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      std::mt19937_64 generator(seed ^ (0x9e3779b97f4a7c15ull * (i + 1)));
+      const Face & face = _faces[i];
+      // A frame of the face, with the normal last
+      const Point t1 = (face.vertices[1] - face.vertices[0]).unit();
+      const Point t2 = face.normal.cross(t1);
+      for (unsigned int r = 0; r < rays_per_face; ++r)
+      {
+        const Real u1 = uniform(generator);
+        const Real u2 = uniform(generator);
+        const Real u3 = uniform(generator);
+        const Real u4 = uniform(generator);
+
+        Point origin, direction;
+        if (_dim == 2)
+        {
+          origin = face.vertices[0] + u1 * (face.vertices[1] - face.vertices[0]);
+          // Cosine-weighted in 2D: sin(theta) uniform in [-1, 1]
+          const Real s = 2.0 * u3 - 1.0;
+          direction = s * t1 + std::sqrt(std::max(1.0 - s * s, 0.0)) * face.normal;
+        }
+        else
+        {
+          const Real a = u1 + u2 > 1.0 ? 1.0 - u1 : u1;
+          const Real b = u1 + u2 > 1.0 ? 1.0 - u2 : u2;
+          origin = face.vertices[0] + a * (face.vertices[1] - face.vertices[0]) +
+                   b * (face.vertices[2] - face.vertices[0]);
+          // Cosine-weighted in 3D: uniform in the unit disk, projected on the hemisphere
+          const Real radius = std::sqrt(u3);
+          const Real phi = 2.0 * M_PI * u4;
+          direction = radius * std::cos(phi) * t1 + radius * std::sin(phi) * t2 +
+                      std::sqrt(std::max(1.0 - u3, 0.0)) * face.normal;
+        }
+
+        const auto hit = firstHit(origin, direction, i);
+        if (hit != invalid)
+          ++hits[(i - begin) * _n_boundaries + _faces[hit].boundary];
+      }
+    }
+  }
+
+  /**
+   * The view factors between the boundaries from the hits of all the faces (summed over the
+   * processors): the area-weighted average over the faces of each boundary of their fractions of
+   * rays hitting each boundary
+   */
+  std::vector<std::vector<Real>> viewFactors(const std::vector<unsigned int> & hits,
+                                             unsigned int rays_per_face) const
+  {
+    mooseAssert(hits.size() == _faces.size() * _n_boundaries, "Wrong number of hit counts");
+    std::vector<std::vector<Real>> vf(_n_boundaries, std::vector<Real>(_n_boundaries, 0.0));
+    std::vector<Real> areas(_n_boundaries, 0.0);
+    for (std::size_t i = 0; i < _faces.size(); ++i)
+    {
+      const auto from = _faces[i].boundary;
+      const Real a = area(i);
+      areas[from] += a;
+      for (unsigned int to = 0; to < _n_boundaries; ++to)
+        vf[from][to] += a * hits[i * _n_boundaries + to] / rays_per_face;
+    }
+    for (unsigned int from = 0; from < _n_boundaries; ++from)
+      if (areas[from] > 0)
+        for (auto & value : vf[from])
+          value /= areas[from];
+    return vf;
+  }
+
+  /// The index of the face first hit by the ray, excluding the face it leaves (invalid if none)
+  std::size_t firstHit(const Point & origin, const Point & direction, std::size_t exclude) const
+  {
+    std::size_t best = invalid;
+    Real best_t = std::numeric_limits<Real>::max();
+    if (_nodes.empty())
+      return best;
+
+    Point inverse;
+    for (unsigned int d = 0; d < 3; ++d)
+      inverse(d) = direction(d) != 0 ? 1.0 / direction(d) : 0.0;
+
+    std::vector<std::size_t> stack(1, 0);
+    while (!stack.empty())
+    {
+      const auto & node = _nodes[stack.back()];
+      stack.pop_back();
+      if (!intersectsBox(node, origin, inverse, best_t))
+        continue;
+      if (node.count > 0)
+      {
+        for (std::size_t k = node.first; k < node.first + node.count; ++k)
+        {
+          const auto f = _index[k];
+          if (f == exclude)
+            continue;
+          const Real t = intersect(_faces[f], origin, direction);
+          if (t > 0 && t < best_t)
+          {
+            best_t = t;
+            best = f;
+          }
+        }
+      }
+      else
+      {
+        stack.push_back(node.first);
+        stack.push_back(node.first + 1);
+      }
+    }
+    return best;
+  }
+
+  ///@{
+  /**
+   * Cache of the view factors in a file, keyed by a hash of the faces and of the parameters of the
+   * tracing (see key()), so that a run with the same enclosure reuses the result of an earlier one
+   */
+  std::uint64_t key(unsigned int rays_per_face, std::uint64_t seed) const
+  {
+    std::uint64_t hash = 1469598103934665603ull;
+    const auto mix = [&hash](const void * data, std::size_t n)
+    {
+      const auto bytes = static_cast<const unsigned char *>(data);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+      }
+    };
+    mix(&_dim, sizeof(_dim));
+    mix(&_n_boundaries, sizeof(_n_boundaries));
+    mix(&rays_per_face, sizeof(rays_per_face));
+    mix(&seed, sizeof(seed));
+    for (const auto & face : _faces)
+    {
+      for (unsigned int v = 0; v < _dim; ++v)
+        for (unsigned int d = 0; d < 3; ++d)
+        {
+          const Real x = face.vertices[v](d);
+          mix(&x, sizeof(x));
+        }
+      mix(&face.boundary, sizeof(face.boundary));
+    }
+    return hash;
+  }
+
+  static bool
+  loadCache(const std::string & filename, std::uint64_t key, std::vector<std::vector<Real>> & vf)
+  {
+    std::ifstream file(filename, std::ios::binary);
+    std::uint64_t header[2];
+    if (!file || !file.read(reinterpret_cast<char *>(header), sizeof(header)) ||
+        header[0] != key)
+      return false;
+    vf.assign(header[1], std::vector<Real>(header[1]));
+    for (auto & row : vf)
+      if (!file.read(reinterpret_cast<char *>(row.data()), row.size() * sizeof(Real)))
+        return false;
+    return true;
+  }
+
+  /**
+   * Written to a temporary file of this process, renamed into place, so concurrent runs (or
+   * processors) never read a partial file nor write to the same temporary file
+   */
+  static bool saveCache(const std::string & filename,
+                        std::uint64_t key,
+                        const std::vector<std::vector<Real>> & vf)
+  {
+    char host[256] = {};
+    gethostname(host, sizeof(host) - 1);
+    const std::string temporary =
+        filename + ".tmp-" + host + "-" + std::to_string(getpid()) + "-" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    {
+      std::ofstream file(temporary, std::ios::binary);
+      const std::uint64_t header[2] = {key, vf.size()};
+      file.write(reinterpret_cast<const char *>(header), sizeof(header));
+      for (const auto & row : vf)
+        file.write(reinterpret_cast<const char *>(row.data()), row.size() * sizeof(Real));
+      if (!file)
+      {
+        file.close();
+        std::remove(temporary.c_str());
+        return false;
+      }
+    }
+    if (std::rename(temporary.c_str(), filename.c_str()) != 0)
+    {
+      std::remove(temporary.c_str());
+      return false;
+    }
+    return true;
+  }
+  ///@}
+
+  static constexpr std::size_t invalid = std::numeric_limits<std::size_t>::max();
+
+private:
+  /// A node of the hierarchy: its box, and either its faces (count > 0) or its first child
+  struct Node
+  {
+    Point min;
+    Point max;
+    std::size_t first;
+    std::size_t count;
+  };
+
+  /// Fills node n with the faces _index[begin, end) and, recursively, its children
+  void build(std::size_t n, std::size_t begin, std::size_t end)
+  {
+    Point min(std::numeric_limits<Real>::max(),
+              std::numeric_limits<Real>::max(),
+              std::numeric_limits<Real>::max());
+    Point max = -1.0 * min;
+    for (std::size_t k = begin; k < end; ++k)
+      for (unsigned int v = 0; v < _dim; ++v)
+        for (unsigned int d = 0; d < 3; ++d)
+        {
+          min(d) = std::min(min(d), _faces[_index[k]].vertices[v](d));
+          max(d) = std::max(max(d), _faces[_index[k]].vertices[v](d));
+        }
+    _nodes[n].min = min;
+    _nodes[n].max = max;
+
+    if (end - begin <= _leaf_size)
+    {
+      _nodes[n].first = begin;
+      _nodes[n].count = end - begin;
+      return;
+    }
+
+    // Split at the median centroid along the longest side of the box
+    unsigned int axis = 0;
+    for (unsigned int d = 1; d < 3; ++d)
+      if (max(d) - min(d) > max(axis) - min(axis))
+        axis = d;
+    const auto centroid = [this, axis](std::size_t f)
+    {
+      Real c = 0;
+      for (unsigned int v = 0; v < _dim; ++v)
+        c += _faces[f].vertices[v](axis);
+      return c;
+    };
+    const std::size_t mid = begin + (end - begin) / 2;
+    std::nth_element(_index.begin() + begin,
+                     _index.begin() + mid,
+                     _index.begin() + end,
+                     [&centroid](std::size_t a, std::size_t b)
+                     { return centroid(a) < centroid(b); });
+
+    // The two children are consecutive
+    const auto left = _nodes.size();
+    _nodes.resize(left + 2);
+    _nodes[n].first = left;
+    _nodes[n].count = 0;
+    build(left, begin, mid);
+    build(left + 1, mid, end);
+  }
+
+  /// Slab test of the ray against the box of a node, for hits closer than max_t
+  static bool
+  intersectsBox(const Node & node, const Point & origin, const Point & inverse, Real max_t)
+  {
+    Real t_min = 0;
+    Real t_max = max_t;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      // A ray parallel to the slab (inverse 0) only needs to start within it
+      if (inverse(d) == 0)
+      {
+        if (origin(d) < node.min(d) || origin(d) > node.max(d))
+          return false;
+        continue;
+      }
+      Real t0 = (node.min(d) - origin(d)) * inverse(d);
+      Real t1 = (node.max(d) - origin(d)) * inverse(d);
+      if (t0 > t1)
+        std::swap(t0, t1);
+      t_min = std::max(t_min, t0);
+      t_max = std::min(t_max, t1);
+      if (t_min > t_max)
+        return false;
+    }
+    return true;
+  }
+
+  /// The distance along the ray to the face (a negative value if it misses)
+  Real intersect(const Face & face, const Point & origin, const Point & direction) const
+  {
+    const auto & v = face.vertices;
+    if (_dim == 2)
+    {
+      // Solve origin + t direction = v0 + s (v1 - v0) in the x-y plane
+      const Point e = v[1] - v[0];
+      const Real det = direction(1) * e(0) - direction(0) * e(1);
+      if (std::abs(det) < 1e-14)
+        return -1;
+      const Point w = v[0] - origin;
+      const Real t = (w(1) * e(0) - w(0) * e(1)) / det;
+      const Real s = (direction(0) * w(1) - direction(1) * w(0)) / det;
+      return s >= 0 && s <= 1 ? t : -1;
+    }
+
+    // Moller-Trumbore
+    const Point e1 = v[1] - v[0];
+    const Point e2 = v[2] - v[0];
+    const Point p = direction.cross(e2);
+    const Real det = e1 * p;
+    if (std::abs(det) < 1e-14)
+      return -1;
+    const Point s = origin - v[0];
+    const Real a = (s * p) / det;
+    if (a < 0 || a > 1)
+      return -1;
+    const Point q = s.cross(e1);
+    const Real b = (direction * q) / det;
+    if (b < 0 || a + b > 1)
+      return -1;
+    return (e2 * q) / det;
+  }
+
+  const unsigned int _dim;
+  const std::vector<Face> _faces;
+  const unsigned int _n_boundaries;
+  /// The faces, in the order of the leaves of the hierarchy
+  std::vector<std::size_t> _index;
+  /// The hierarchy, the root first
+  std::vector<Node> _nodes;
+  /// Maximum number of faces of a leaf
+  const std::size_t _leaf_size = 4;
+};
@@ -11,6 +11,9 @@
 
 #include "ADKernelValue.h"
 
+// Forward Declarations
+class LevelSetNarrowBand;
+
 /**
  * Advection Kernel for the levelset equation.
  *
@@ -25,9 +28,17 @@ public:
 
   LevelSetAdvection(const InputParameters & parameters);
 
+  /// Skips the elements out of the narrow band, if one is given
+  virtual void computeResidual() override;
+
 protected:
+  void computeResidualsForJacobian() override;
+
   virtual ADReal precomputeQpResidual() override;
 
   /// Velocity vector variable
   const ADVectorVariableValue & _velocity;
+
+  /// The narrow band the kernel is restricted to, nullptr to evaluate everywhere
+  const LevelSetNarrowBand * const _narrow_band;
 };
@@ -11,6 +11,9 @@
 
 #include "ADKernelGrad.h"
 
+// Forward Declarations
+class LevelSetNarrowBand;
+
 /**
  * SUPG stabilization for the advection portion of the level set equation.
  */
@@ -21,9 +24,17 @@ public:
 
   LevelSetAdvectionSUPG(const InputParameters & parameters);
 
+  /// Skips the elements out of the narrow band, if one is given
+  virtual void computeResidual() override;
+
 protected:
+  void computeResidualsForJacobian() override;
+
   virtual ADRealVectorValue precomputeQpResidual() override;
 
   /// Velocity vector variable
   const ADVectorVariableValue & _velocity;
+
+  /// The narrow band the kernel is restricted to, nullptr to evaluate everywhere
+  const LevelSetNarrowBand * const _narrow_band;
 };
@@ -11,6 +11,9 @@
 
 #include "ADTimeKernelGrad.h"
 
+// Forward Declarations
+class LevelSetNarrowBand;
+
 /**
  * Applies SUPG stabilization to the time derivative.
  */
@@ -21,9 +24,17 @@ public:
 
   LevelSetTimeDerivativeSUPG(const InputParameters & parameters);
 
+  /// Skips the elements out of the narrow band, if one is given
+  virtual void computeResidual() override;
+
 protected:
+  void computeResidualsForJacobian() override;
+
   virtual ADRealVectorValue precomputeQpResidual() override;
 
   /// Velocity vector variable
   const ADVectorVariableValue & _velocity;
+
+  /// The narrow band the kernel is restricted to, nullptr to evaluate everywhere
+  const LevelSetNarrowBand * const _narrow_band;
 };
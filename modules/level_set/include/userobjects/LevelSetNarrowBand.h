@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+#include <unordered_set>
+
+/**
+ * The narrow band of a level set: the elements where the level set (a signed distance, e.g. after
+ * LevelSetReinitializationUserObject) comes within `band_width` of zero at a node, plus
+ * `band_layers` layers of face neighbors so the interface cannot leave the band within a step.
+ *
+ * The level set kernels given this object only evaluate on the elements of the band: outside it,
+ * only the time derivative remains, which freezes the level set at its old value, and the cost of
+ * the advection scales with the interface area instead of the domain volume. The band is rebuilt
+ * on `execute_on` (typically timestep_begin), from the element loop of this object.
+ */
+class LevelSetNarrowBand : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  LevelSetNarrowBand(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & uo) override;
+
+  /// Gathers the band of the ghosted elements and adds the neighbor layers
+  virtual void finalize() override;
+
+  /// Whether an element is in the band (all the elements before the first execution)
+  bool contains(const Elem * elem) const
+  {
+    return !_built || _band.count(elem->id());
+  }
+
+  /// The number of elements of the band on this processor
+  std::size_t size() const { return _band.size(); }
+
+protected:
+  /// The level set variable
+  const VariableValue & _level_set;
+
+  /// The distance to the interface within which the elements are in the band
+  const Real _band_width;
+
+  /// The number of face neighbor layers added to the band
+  const unsigned int _band_layers;
+
+  /// The elements of the band
+  std::unordered_set<dof_id_type> _band;
+
+  /// Whether the band was built at least once
+  bool _built;
+};
@@ -0,0 +1,70 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "LevelSetClosestPointDistance.h"
+
+#include <unordered_map>
+
+// Forward Declarations
+class MooseVariable;
+
+/**
+ * Reinitializes a nodal level set variable to the signed distance from its zero contour directly,
+ * by the closest point marching of LevelSetClosestPointDistance, in place of the
+ * LevelSetReinitializationMultiApp and LevelSetOlssonReinitialization sub-app.
+ *
+ * The fronts of the processors are joined by exchanging the closest points of the ghosted nodes
+ * until no processor improves a node.
+ */
+class LevelSetReinitializationUserObject : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  LevelSetReinitializationUserObject(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  virtual void meshChanged() override;
+
+protected:
+  /// Builds the node graph of the local and ghosted elements, after a mesh change
+  void buildGraph();
+
+  /**
+   * Sends the closest points of the nodes improved by the last march to the processors that
+   * share them, and seeds the received points
+   * @return true if a node of any processor was improved
+   */
+  bool exchangeGhostClosestPoints();
+
+  /// The level set variable
+  MooseVariable & _level_set;
+
+  /// The maximum number of exchanges between the processors
+  const unsigned int _max_exchanges;
+
+  /// The closest point marching on the local and ghosted nodes
+  LevelSetClosestPointDistance _distance;
+
+  /// The ids of the nodes of the graph, and their local index
+  std::vector<dof_id_type> _node_ids;
+  std::unordered_map<dof_id_type, std::size_t> _node_index;
+
+  /// The local index of the nodes shared with each other processor
+  std::map<processor_id_type, std::vector<std::size_t>> _shared_nodes;
+
+  /// Whether the graph matches the mesh
+  bool _graph_built;
+};
@@ -0,0 +1,171 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+/**
+ * Geometric reinitialization of a nodal level set to the signed distance from its zero contour,
+ * in one pass instead of the pseudo-time solve of LevelSetOlssonReinitialization.
+ *
+ * The zero contour is sampled at the crossings of the mesh edges whose end values change sign
+ * (linear interpolation of the level set along the edge). Each node then gets the closest of these
+ * points by a fast marching (Dijkstra) front over the edge graph that propagates closest points
+ * rather than path lengths: a node takes the closest point of a neighbor if it is nearer than its
+ * own. The distance is the Euclidean distance to that point, with the sign of the original level
+ * set, so it does not accumulate the error of edge paths.
+ *
+ * On a distributed mesh, each processor marches on its local and ghosted nodes; the closest points
+ * of the ghosted nodes are then exchanged, given back to seed(), and march() is repeated until no
+ * processor changes (see LevelSetReinitializationUserObject).
+ */
+class LevelSetClosestPointDistance
+{
+public:
+  /**
+   * @param points The node coordinates
+   * @param edges The pairs of node indices of the mesh edges
+   */
+  void build(const std::vector<Point> & points,
+             const std::vector<std::pair<unsigned int, unsigned int>> & edges)
+  {
+    _points = points;
+    _edges = edges;
+    const auto n = _points.size();
+
+    // Compressed adjacency of the edge graph
+    _offsets.assign(n + 1, 0);
+    for (const auto & edge : _edges)
+    {
+      if (edge.first >= n || edge.second >= n)
+        mooseError("Level set reinitialization edge (",
+                   edge.first,
+                   ", ",
+                   edge.second,
+                   ") refers to a missing node");
+      ++_offsets[edge.first + 1];
+      ++_offsets[edge.second + 1];
+    }
+    for (std::size_t i = 0; i < n; ++i)
+      _offsets[i + 1] += _offsets[i];
+    _neighbors.resize(_offsets[n]);
+    std::vector<std::size_t> fill(_offsets.begin(), _offsets.end() - 1);
+    for (const auto & edge : _edges)
+    {
+      _neighbors[fill[edge.first]++] = edge.second;
+      _neighbors[fill[edge.second]++] = edge.first;
+    }
+  }
+
+  /**
+   * Seeds the nodes of the crossed edges with the contour points
+   * @param phi The level set at the nodes
+   */
+  void initialize(const std::vector<Real> & phi)
+  {
+    if (phi.size() != _points.size())
+      mooseError("The level set has ", phi.size(), " values for ", _points.size(), " nodes");
+    const auto n = _points.size();
+    _distance.assign(n, std::numeric_limits<Real>::max());
+    _closest.assign(n, Point());
+    _queue = Queue();
+
+    for (std::size_t i = 0; i < n; ++i)
+      if (phi[i] == 0)
+        seed(i, _points[i]);
+    for (const auto & edge : _edges)
+    {
+      const Real a = phi[edge.first], b = phi[edge.second];
+      if ((a < 0 && b > 0) || (a > 0 && b < 0))
+      {
+        const Real t = a / (a - b);
+        const Point & pa = _points[edge.first];
+        const Point crossing = pa + t * (_points[edge.second] - pa);
+        seed(edge.first, crossing);
+        seed(edge.second, crossing);
+      }
+    }
+  }
+
+  /**
+   * Offers a contour point to a node (from the crossings or from another processor)
+   * @return true if it is nearer than the current closest point of the node
+   */
+  bool seed(std::size_t node, const Point & point)
+  {
+    const Real d = (_points[node] - point).norm();
+    if (!(d < _distance[node]))
+      return false;
+    _distance[node] = d;
+    _closest[node] = point;
+    _queue.emplace(d, node);
+    return true;
+  }
+
+  /// Propagates the closest points from the seeded nodes to all the nodes connected to them
+  void march()
+  {
+    while (!_queue.empty())
+    {
+      const auto [d, i] = _queue.top();
+      _queue.pop();
+      if (d > _distance[i])
+        continue;
+      for (auto k = _offsets[i]; k < _offsets[i + 1]; ++k)
+        seed(_neighbors[k], _closest[i]);
+    }
+  }
+
+  /**
+   * The signed distance of each node
+   * @param phi The original level set, for the sign
+   * @param distance The signed distance (the largest Real for nodes not reached by the contour)
+   */
+  void signedDistance(const std::vector<Real> & phi, std::vector<Real> & distance) const
+  {
+    distance.resize(_points.size());
+    for (std::size_t i = 0; i < _points.size(); ++i)
+      distance[i] = phi[i] < 0 ? -_distance[i] : _distance[i];
+  }
+
+  ///@{ The distance and closest contour point of a node, for the ghost exchange
+  Real distance(std::size_t node) const { return _distance[node]; }
+  const Point & closestPoint(std::size_t node) const { return _closest[node]; }
+  ///@}
+
+  std::size_t size() const { return _points.size(); }
+
+private:
+  using Queue = std::priority_queue<std::pair<Real, std::size_t>,
+                                    std::vector<std::pair<Real, std::size_t>>,
+                                    std::greater<std::pair<Real, std::size_t>>>;
+
+  std::vector<Point> _points;
+  std::vector<std::pair<unsigned int, unsigned int>> _edges;
+
+  ///@{ The neighbors of node i are _neighbors[_offsets[i]] ... _neighbors[_offsets[i + 1] - 1]
+  std::vector<std::size_t> _offsets;
+  std::vector<std::size_t> _neighbors;
+  ///@}
+
+  std::vector<Real> _distance;
+  std::vector<Point> _closest;
+  Queue _queue;
+};
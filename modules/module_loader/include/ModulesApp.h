@@ -19,6 +19,10 @@ public:
 
   static void registerApps();
   static void registerAll(Factory & f, ActionFactory & af, Syntax & s);
+  /// Same as registerAll(), but the objects of the modules are only registered to the factory
+  /// when an input uses them (see Factory::registerLazily()); the syntax is still associated up
+  /// front since the parser needs it to read the input
+  static void registerAllLazily(Factory & f, ActionFactory & af, Syntax & s);
   static void registerObjects(Factory & factory);
   static void associateSyntax(Syntax & syntax, ActionFactory & action_factory);
   static void registerExecFlags(Factory & factory);
@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxKernel.h"
+
+// Forward Declarations
+class INSFVSegregatedSolver;
+
+/**
+ * Copies a velocity component or the pressure of an INSFVSegregatedSolver into an elemental
+ * variable.
+ */
+class INSFVSegregatedAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  INSFVSegregatedAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  const INSFVSegregatedSolver & _solver;
+
+  /// The quantity copied: VEL_X, VEL_Y, VEL_Z or PRESSURE
+  const MooseEnum _quantity;
+};
@@ -18,6 +18,7 @@
 
 #include "libmesh/elem.h"
 
+#include <unordered_map>
 #include <vector>
 
 class INSADMaterial;
@@ -30,6 +31,8 @@ public:
 
   INSADTauMaterialTempl(const InputParameters & parameters);
 
+  virtual void meshChanged() override;
+
 protected:
   virtual void computeProperties() override;
   virtual void computeQpProperties() override;
@@ -38,6 +41,24 @@ protected:
   const Real _alpha;
   ADMaterialProperty<Real> & _tau;
 
+  /**
+   * Whether tau is computed from the values of its arguments only, without their derivatives:
+   * the stabilization is unchanged in the residual, while the Jacobian lags the (small)
+   * dependence of tau on the solution, which removes the AD cost of tau from the SUPG and PSPG
+   * kernels
+   */
+  const bool _freeze_tau;
+
+  /// Whether the material is computed on the displaced mesh, whose element sizes change
+  const bool _use_displaced_mesh;
+
+  /**
+   * The hmax of the elements of an undisplaced mesh, which does not change between
+   * residual evaluations; cleared when the mesh changes. Not used on the displaced mesh, nor
+   * with displacements coupled.
+   */
+  std::unordered_map<dof_id_type, Real> _hmax_cache;
+
   /// The strong residual of the momentum equation
   ADMaterialProperty<RealVectorValue> & _momentum_strong_residual;
 
@@ -76,6 +97,10 @@ INSADTauMaterialTempl<T>::validParams()
   params.addClassDescription(
       "This is the material class used to compute the stabilization parameter tau.");
   params.addParam<Real>("alpha", 1., "Multiplicative factor on the stabilization parameter tau.");
+  params.addParam<bool>("freeze_tau",
+                        false,
+                        "Whether to compute tau without derivatives, so that the Jacobian "
+                        "neglects the dependence of tau on the solution.");
   return params;
 }
 
@@ -84,6 +109,8 @@ INSADTauMaterialTempl<T>::INSADTauMaterialTempl(const InputParameters & paramete
   : T(parameters),
     _alpha(this->template getParam<Real>("alpha")),
     _tau(this->template declareADProperty<Real>("tau")),
+    _freeze_tau(this->template getParam<bool>("freeze_tau")),
+    _use_displaced_mesh(this->template getParam<bool>("use_displaced_mesh")),
     _momentum_strong_residual(
         this->template declareADProperty<RealVectorValue>("momentum_strong_residual"))
 {
@@ -95,7 +122,16 @@ INSADTauMaterialTempl<T>::computeHMax()
 {
   if (!_displacements.size())
   {
-    _hmax = _current_elem->hmax();
+    if (_use_displaced_mesh)
+    {
+      _hmax = _current_elem->hmax();
+      return;
+    }
+
+    auto it = _hmax_cache.find(_current_elem->id());
+    if (it == _hmax_cache.end())
+      it = _hmax_cache.emplace(_current_elem->id(), _current_elem->hmax()).first;
+    _hmax = it->second;
     return;
   }
 
@@ -122,6 +158,14 @@ INSADTauMaterialTempl<T>::computeHMax()
   _hmax = std::sqrt(_hmax);
 }
 
+template <typename T>
+void
+INSADTauMaterialTempl<T>::meshChanged()
+{
+  T::meshChanged();
+  _hmax_cache.clear();
+}
+
 template <typename T>
 void
 INSADTauMaterialTempl<T>::computeProperties()
@@ -137,12 +181,29 @@ INSADTauMaterialTempl<T>::computeQpProperties()
 {
   T::computeQpProperties();
 
-  auto && nu = _mu[_qp] / _rho[_qp];
   auto && transient_part = _has_transient ? 4. / (_dt * _dt) : 0.;
-  _tau[_qp] = _alpha / std::sqrt(transient_part +
-                                 (2. * _velocity[_qp].norm() / _hmax) *
-                                     (2. * _velocity[_qp].norm() / _hmax) +
-                                 9. * (4. * nu / (_hmax * _hmax)) * (4. * nu / (_hmax * _hmax)));
+  if (_freeze_tau)
+  {
+    const Real nu = MetaPhysicL::raw_value(_mu[_qp]) / MetaPhysicL::raw_value(_rho[_qp]);
+    Real speed = 0;
+    for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+    {
+      const Real v = MetaPhysicL::raw_value(_velocity[_qp](d));
+      speed += v * v;
+    }
+    speed = std::sqrt(speed);
+    const Real hmax = MetaPhysicL::raw_value(_hmax);
+    _tau[_qp] = _alpha / std::sqrt(transient_part + (2. * speed / hmax) * (2. * speed / hmax) +
+                                   9. * (4. * nu / (hmax * hmax)) * (4. * nu / (hmax * hmax)));
+  }
+  else
+  {
+    auto && nu = _mu[_qp] / _rho[_qp];
+    _tau[_qp] = _alpha / std::sqrt(transient_part +
+                                   (2. * _velocity[_qp].norm() / _hmax) *
+                                       (2. * _velocity[_qp].norm() / _hmax) +
+                                   9. * (4. * nu / (_hmax * _hmax)) * (4. * nu / (_hmax * _hmax)));
+  }
 
   _momentum_strong_residual[_qp] = _advective_strong_residual[_qp] + _grad_p[_qp];
 
@@ -0,0 +1,90 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "SIMPLESolver.h"
+
+/**
+ * Segregated finite volume incompressible flow on the elements of the mesh: the cells and faces
+ * of a SIMPLESolver are built from the FaceInfo objects of the mesh (once, and again when the
+ * mesh changes), with the velocity_boundaries (walls and inlets, with their velocities) and the
+ * pressure_boundaries (outlets, with their pressures). Every execution advances one time step of
+ * the transient (with SIMPLE outer iterations per step, PIMPLE style) or converges the steady
+ * problem. INSFVSegregatedAux copies the velocity components and the pressure into CONSTANT
+ * MONOMIAL variables for output.
+ *
+ * The solver works on the whole mesh, replicated on every rank.
+ */
+class INSFVSegregatedSolver : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  INSFVSegregatedSolver(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  ///@{ The solution in the cell of an element
+  Real velocity(const Elem & elem, unsigned int component) const
+  {
+    return _solver.velocity(cell(elem))[component];
+  }
+  Real pressure(const Elem & elem) const { return _solver.pressure(cell(elem)); }
+  ///@}
+
+  /// The number of SIMPLE iterations of the last execution
+  unsigned int iterations() const { return _iterations; }
+
+protected:
+  /// Builds the cells and faces of the solver from the mesh
+  void buildSolver();
+
+  /// The cell of an element
+  unsigned int cell(const Elem & elem) const
+  {
+    const auto it = _cell_of_elem.find(elem.id());
+    mooseAssert(it != _cell_of_elem.end(), "Element " << elem.id() << " is not a cell");
+    return it->second;
+  }
+
+  ///@{ The fluid
+  const Real _rho;
+  const Real _mu;
+  ///@}
+
+  /// Whether the time derivative is included (otherwise every execution solves the steady state)
+  const bool _transient;
+
+  ///@{ The boundaries and their values
+  const std::vector<BoundaryName> & _velocity_boundaries;
+  const std::vector<RealVectorValue> _boundary_velocities;
+  const std::vector<BoundaryName> & _pressure_boundaries;
+  const std::vector<Real> _boundary_pressures;
+  ///@}
+
+  ///@{ The SIMPLE iterations
+  const unsigned int _max_its;
+  const Real _tol;
+  ///@}
+
+  /// The solver
+  SIMPLESolver _solver;
+
+  /// The cell of each element
+  std::unordered_map<dof_id_type, unsigned int> _cell_of_elem;
+
+  /// The number of SIMPLE iterations of the last execution
+  unsigned int _iterations;
+};
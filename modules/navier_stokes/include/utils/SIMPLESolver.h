@@ -0,0 +1,526 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+/**
+ * Segregated finite volume solver of the incompressible Navier-Stokes equations with the SIMPLE
+ * pressure-velocity coupling, on a cell-centered mesh given as a list of faces (as MooseMesh's
+ * FaceInfo objects provide them):
+ *  - each outer iteration assembles the momentum equations (upwind convection with the face mass
+ *    fluxes of the previous iteration, central diffusion, implicit Euler in time if the time step
+ *    is positive), under-relaxes them and solves them by Gauss-Seidel sweeps, one component at a
+ *    time with the same matrix;
+ *  - the face mass fluxes are interpolated with the Rhie-Chow correction, which couples the cell
+ *    pressures without checkerboarding;
+ *  - the pressure correction equation, a symmetric positive definite Laplacian weighted by the
+ *    inverse momentum diagonal, is solved by Jacobi-preconditioned conjugate gradients, and
+ *    corrects the pressure, the velocities and the fluxes.
+ * Only the momentum diagonal and one scalar field per equation are stored, so the memory is a
+ * few vectors per cell and per face instead of a monolithic coupled Jacobian.
+ *
+ * The geometry is assumed orthogonal (the face normals are aligned with the centroid-to-centroid
+ * vectors); non-orthogonal corrections are not applied.
+ */
+class SIMPLESolver
+{
+public:
+  typedef std::array<Real, 3> Vector;
+
+  /// The boundary conditions of a boundary face
+  enum BoundaryType
+  {
+    /// Given velocity (a wall, moving or not, or an inlet); zero pressure gradient
+    VELOCITY,
+    /// Given pressure (an outlet); zero velocity gradient
+    PRESSURE
+  };
+
+  /**
+   * Adds a cell, returning its index
+   * @param volume The volume of the cell
+   * @param centroid The centroid of the cell
+   */
+  unsigned int addCell(Real volume, const Vector & centroid)
+  {
+    _volume.push_back(volume);
+    _centroid.push_back(centroid);
+    return _volume.size() - 1;
+  }
+
+  /**
+   * Adds an interior face between two cells
+   * @param owner The cell the normal points out of
+   * @param neighbor The other cell
+   * @param area The area of the face
+   * @param normal The unit normal of the face
+   * @param centroid The centroid of the face
+   */
+  void addInteriorFace(unsigned int owner,
+                       unsigned int neighbor,
+                       Real area,
+                       const Vector & normal,
+                       const Vector & centroid)
+  {
+    _owner.push_back(owner);
+    _neighbor.push_back(neighbor);
+    _area.push_back(area);
+    _normal.push_back(normal);
+    _face_centroid.push_back(centroid);
+  }
+
+  /**
+   * Adds a boundary face
+   * @param owner The cell of the face (the normal points out of the domain)
+   * @param area The area of the face
+   * @param normal The unit normal of the face
+   * @param centroid The centroid of the face
+   * @param type The boundary condition
+   * @param velocity The velocity of a VELOCITY face
+   * @param pressure The pressure of a PRESSURE face
+   */
+  void addBoundaryFace(unsigned int owner,
+                       Real area,
+                       const Vector & normal,
+                       const Vector & centroid,
+                       BoundaryType type,
+                       const Vector & velocity = {{0, 0, 0}},
+                       Real pressure = 0)
+  {
+    _b_owner.push_back(owner);
+    _b_area.push_back(area);
+    _b_normal.push_back(normal);
+    _b_centroid.push_back(centroid);
+    _b_type.push_back(type);
+    _b_velocity.push_back(velocity);
+    _b_pressure.push_back(pressure);
+  }
+
+  /**
+   * Completes the mesh and sets the fluid
+   * @param dim The dimension of the velocity
+   * @param rho The density
+   * @param mu The dynamic viscosity
+   */
+  void setup(unsigned int dim, Real rho, Real mu)
+  {
+    if (dim < 1 || dim > 3)
+      mooseError("SIMPLESolver: the dimension must be 1, 2 or 3");
+    _dim = dim;
+    _rho = rho;
+    _mu = mu;
+    const auto n = numCells();
+
+    _gc.resize(numFaces());
+    _dist.resize(numFaces());
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      const Real d_owner = distance(_centroid[_owner[f]], _face_centroid[f]);
+      const Real d_neighbor = distance(_centroid[_neighbor[f]], _face_centroid[f]);
+      _gc[f] = d_neighbor / (d_owner + d_neighbor);
+      _dist[f] = distance(_centroid[_owner[f]], _centroid[_neighbor[f]]);
+    }
+    _b_dist.resize(numBoundaryFaces());
+    for (std::size_t f = 0; f < numBoundaryFaces(); ++f)
+      _b_dist[f] = std::abs(dot(sub(_b_centroid[f], _centroid[_b_owner[f]]), _b_normal[f]));
+
+    // The faces of each cell, for the Gauss-Seidel sweeps
+    _cell_face_offsets.assign(n + 1, 0);
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      ++_cell_face_offsets[_owner[f] + 1];
+      ++_cell_face_offsets[_neighbor[f] + 1];
+    }
+    for (unsigned int c = 0; c < n; ++c)
+      _cell_face_offsets[c + 1] += _cell_face_offsets[c];
+    _cell_faces.resize(_cell_face_offsets[n]);
+    std::vector<std::size_t> fill(_cell_face_offsets.begin(), _cell_face_offsets.end() - 1);
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      _cell_faces[fill[_owner[f]]++] = f;
+      _cell_faces[fill[_neighbor[f]]++] = f;
+    }
+
+    _has_pressure_boundary =
+        std::find(_b_type.begin(), _b_type.end(), PRESSURE) != _b_type.end();
+
+    _u.assign(n, Vector{{0, 0, 0}});
+    _u_old = _u;
+    _p.assign(n, 0);
+    _d.assign(n, 0);
+    _flux.assign(numFaces(), 0);
+    _b_flux.assign(numBoundaryFaces(), 0);
+    for (std::size_t f = 0; f < numBoundaryFaces(); ++f)
+      if (_b_type[f] == VELOCITY)
+        _b_flux[f] = _rho * _b_area[f] * dot(_b_velocity[f], _b_normal[f]);
+  }
+
+  ///@{ Relaxation and inner solves
+  void setRelaxation(Real velocity, Real pressure)
+  {
+    _alpha_u = velocity;
+    _alpha_p = pressure;
+  }
+  void setMomentumSweeps(unsigned int sweeps) { _momentum_sweeps = sweeps; }
+  void setPressureSolve(unsigned int max_its, Real rel_tol)
+  {
+    _pressure_max_its = max_its;
+    _pressure_rel_tol = rel_tol;
+  }
+  ///@}
+
+  std::size_t numCells() const { return _volume.size(); }
+  std::size_t numFaces() const { return _owner.size(); }
+  std::size_t numBoundaryFaces() const { return _b_owner.size(); }
+
+  ///@{ The solution
+  const Vector & velocity(unsigned int cell) const { return _u[cell]; }
+  Vector & velocity(unsigned int cell) { return _u[cell]; }
+  Real pressure(unsigned int cell) const { return _p[cell]; }
+  Real & pressure(unsigned int cell) { return _p[cell]; }
+  ///@}
+
+  /**
+   * Performs one SIMPLE iteration
+   * @param dt The time step (the equations are steady if dt <= 0)
+   * @return The sum of the absolute mass imbalances of the cells before the correction
+   */
+  Real iterate(Real dt = 0)
+  {
+    const auto n = numCells();
+    std::vector<Vector> grad_p;
+    gradient(_p, true, grad_p);
+
+    // Momentum: the diagonal, the face coefficients and the sources
+    std::vector<Real> a_p(n, 0);
+    _a_owner.resize(numFaces());
+    _a_neighbor.resize(numFaces());
+    std::vector<Vector> b(n, Vector{{0, 0, 0}});
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      const Real diffusion = _mu * _area[f] / _dist[f];
+      _a_owner[f] = diffusion + std::max(-_flux[f], 0.0);
+      _a_neighbor[f] = diffusion + std::max(_flux[f], 0.0);
+      a_p[_owner[f]] += _a_owner[f];
+      a_p[_neighbor[f]] += _a_neighbor[f];
+    }
+    for (std::size_t f = 0; f < numBoundaryFaces(); ++f)
+    {
+      const auto c = _b_owner[f];
+      if (_b_type[f] == VELOCITY)
+      {
+        const Real diffusion = _mu * _b_area[f] / _b_dist[f];
+        a_p[c] += diffusion + std::max(_b_flux[f], 0.0);
+        for (unsigned int i = 0; i < _dim; ++i)
+          b[c][i] += (diffusion + std::max(-_b_flux[f], 0.0)) * _b_velocity[f][i];
+      }
+      else
+        a_p[c] += std::max(_b_flux[f], 0.0);
+    }
+    for (unsigned int c = 0; c < n; ++c)
+    {
+      if (dt > 0)
+      {
+        const Real inertia = _rho * _volume[c] / dt;
+        a_p[c] += inertia;
+        for (unsigned int i = 0; i < _dim; ++i)
+          b[c][i] += inertia * _u_old[c][i];
+      }
+      for (unsigned int i = 0; i < _dim; ++i)
+        b[c][i] -= grad_p[c][i] * _volume[c];
+
+      // Under-relaxation
+      const Real relaxed = a_p[c] / _alpha_u;
+      for (unsigned int i = 0; i < _dim; ++i)
+        b[c][i] += (relaxed - a_p[c]) * _u[c][i];
+      a_p[c] = relaxed;
+      _d[c] = _volume[c] / a_p[c];
+    }
+
+    for (unsigned int sweep = 0; sweep < _momentum_sweeps; ++sweep)
+      for (unsigned int c = 0; c < n; ++c)
+      {
+        Vector sum = b[c];
+        for (auto k = _cell_face_offsets[c]; k < _cell_face_offsets[c + 1]; ++k)
+        {
+          const auto f = _cell_faces[k];
+          const bool owner = _owner[f] == c;
+          const auto other = owner ? _neighbor[f] : _owner[f];
+          const Real a = owner ? _a_owner[f] : _a_neighbor[f];
+          for (unsigned int i = 0; i < _dim; ++i)
+            sum[i] += a * _u[other][i];
+        }
+        for (unsigned int i = 0; i < _dim; ++i)
+          _u[c][i] = sum[i] / a_p[c];
+      }
+
+    // Rhie-Chow face fluxes and the pressure correction coefficients
+    std::vector<Real> a_pc(numFaces());
+    std::vector<Real> diag(n, 0);
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      const auto o = _owner[f], nb = _neighbor[f];
+      const Real gc = _gc[f];
+      Real un = 0, grad_pn = 0;
+      for (unsigned int i = 0; i < _dim; ++i)
+      {
+        un += (gc * _u[o][i] + (1 - gc) * _u[nb][i]) * _normal[f][i];
+        grad_pn += (gc * grad_p[o][i] + (1 - gc) * grad_p[nb][i]) * _normal[f][i];
+      }
+      const Real d = gc * _d[o] + (1 - gc) * _d[nb];
+      _flux[f] = _rho * _area[f] * (un - d * ((_p[nb] - _p[o]) / _dist[f] - grad_pn));
+      a_pc[f] = _rho * d * _area[f] / _dist[f];
+      diag[o] += a_pc[f];
+      diag[nb] += a_pc[f];
+    }
+    std::vector<Real> b_pc(numBoundaryFaces(), 0);
+    for (std::size_t f = 0; f < numBoundaryFaces(); ++f)
+    {
+      const auto c = _b_owner[f];
+      if (_b_type[f] == VELOCITY)
+        continue;
+      Real un = 0, grad_pn = 0;
+      for (unsigned int i = 0; i < _dim; ++i)
+      {
+        un += _u[c][i] * _b_normal[f][i];
+        grad_pn += grad_p[c][i] * _b_normal[f][i];
+      }
+      _b_flux[f] = _rho * _b_area[f] *
+                   (un - _d[c] * ((_b_pressure[f] - _p[c]) / _b_dist[f] - grad_pn));
+      b_pc[f] = _rho * _d[c] * _b_area[f] / _b_dist[f];
+      diag[c] += b_pc[f];
+    }
+
+    // The mass imbalance of each cell is the right hand side of the pressure correction
+    std::vector<Real> imbalance(n, 0);
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      imbalance[_owner[f]] += _flux[f];
+      imbalance[_neighbor[f]] -= _flux[f];
+    }
+    for (std::size_t f = 0; f < numBoundaryFaces(); ++f)
+      imbalance[_b_owner[f]] += _b_flux[f];
+    Real total_imbalance = 0;
+    std::vector<Real> rhs(n);
+    for (unsigned int c = 0; c < n; ++c)
+    {
+      total_imbalance += std::abs(imbalance[c]);
+      rhs[c] = -imbalance[c];
+    }
+    // Without a pressure boundary the correction is defined up to a constant: pin the first cell
+    if (!_has_pressure_boundary && n > 0)
+      diag[0] += diag[0];
+
+    std::vector<Real> pc;
+    solvePressureCorrection(a_pc, diag, rhs, pc);
+
+    // Corrections
+    for (std::size_t f = 0; f < numFaces(); ++f)
+      _flux[f] -= a_pc[f] * (pc[_neighbor[f]] - pc[_owner[f]]);
+    for (std::size_t f = 0; f < numBoundaryFaces(); ++f)
+      if (_b_type[f] == PRESSURE)
+        _b_flux[f] += b_pc[f] * pc[_b_owner[f]];
+    std::vector<Vector> grad_pc;
+    gradient(pc, false, grad_pc);
+    for (unsigned int c = 0; c < n; ++c)
+    {
+      for (unsigned int i = 0; i < _dim; ++i)
+        _u[c][i] -= _d[c] * grad_pc[c][i];
+      _p[c] += _alpha_p * pc[c];
+    }
+    return total_imbalance;
+  }
+
+  /**
+   * Advances one time step (or converges the steady problem if dt <= 0) by SIMPLE iterations
+   * @param dt The time step
+   * @param max_its The maximum number of iterations
+   * @param tol The iterations stop when the mass imbalance is below tol
+   * @return The number of iterations performed
+   */
+  unsigned int solve(Real dt, unsigned int max_its, Real tol)
+  {
+    _u_old = _u;
+    for (unsigned int it = 1; it <= max_its; ++it)
+      if (iterate(dt) < tol)
+        return it;
+    return max_its;
+  }
+
+private:
+  static Vector sub(const Vector & a, const Vector & b)
+  {
+    return {{a[0] - b[0], a[1] - b[1], a[2] - b[2]}};
+  }
+  static Real dot(const Vector & a, const Vector & b)
+  {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+  }
+  static Real distance(const Vector & a, const Vector & b)
+  {
+    const auto d = sub(a, b);
+    return std::sqrt(dot(d, d));
+  }
+
+  /**
+   * Green-Gauss gradient of a cell field
+   * @param pressure_values Whether the PRESSURE faces hold the given pressures (for the
+   * pressure) or zero (for its correction); the VELOCITY faces take the value of their cell
+   */
+  void gradient(const std::vector<Real> & phi, bool pressure_values, std::vector<Vector> & grad)
+  {
+    grad.assign(numCells(), Vector{{0, 0, 0}});
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      const Real phi_f = _gc[f] * phi[_owner[f]] + (1 - _gc[f]) * phi[_neighbor[f]];
+      for (unsigned int i = 0; i < _dim; ++i)
+      {
+        grad[_owner[f]][i] += phi_f * _area[f] * _normal[f][i];
+        grad[_neighbor[f]][i] -= phi_f * _area[f] * _normal[f][i];
+      }
+    }
+    for (std::size_t f = 0; f < numBoundaryFaces(); ++f)
+    {
+      const auto c = _b_owner[f];
+      const Real phi_f =
+          _b_type[f] == VELOCITY ? phi[c] : (pressure_values ? _b_pressure[f] : 0.0);
+      for (unsigned int i = 0; i < _dim; ++i)
+        grad[c][i] += phi_f * _b_area[f] * _b_normal[f][i];
+    }
+    for (unsigned int c = 0; c < numCells(); ++c)
+      for (unsigned int i = 0; i < _dim; ++i)
+        grad[c][i] /= _volume[c];
+  }
+
+  /// y = A x for the pressure correction matrix
+  void pressureMatVec(const std::vector<Real> & a_pc,
+                      const std::vector<Real> & diag,
+                      const std::vector<Real> & x,
+                      std::vector<Real> & y) const
+  {
+    for (unsigned int c = 0; c < numCells(); ++c)
+      y[c] = diag[c] * x[c];
+    for (std::size_t f = 0; f < numFaces(); ++f)
+    {
+      y[_owner[f]] -= a_pc[f] * x[_neighbor[f]];
+      y[_neighbor[f]] -= a_pc[f] * x[_owner[f]];
+    }
+  }
+
+  /// Jacobi-preconditioned conjugate gradients on the pressure correction
+  void solvePressureCorrection(const std::vector<Real> & a_pc,
+                               const std::vector<Real> & diag,
+                               const std::vector<Real> & rhs,
+                               std::vector<Real> & x) const
+  {
+    const auto n = numCells();
+    x.assign(n, 0);
+    std::vector<Real> r = rhs, z(n), p(n), q(n);
+    const auto norm = [](const std::vector<Real> & v) {
+      Real sum = 0;
+      for (const auto e : v)
+        sum += e * e;
+      return std::sqrt(sum);
+    };
+    const Real r0 = norm(r);
+    if (r0 == 0)
+      return;
+    Real rz = 0;
+    for (unsigned int c = 0; c < n; ++c)
+    {
+      z[c] = r[c] / diag[c];
+      p[c] = z[c];
+      rz += r[c] * z[c];
+    }
+    for (unsigned int it = 0; it < _pressure_max_its && norm(r) > _pressure_rel_tol * r0; ++it)
+    {
+      pressureMatVec(a_pc, diag, p, q);
+      Real pq = 0;
+      for (unsigned int c = 0; c < n; ++c)
+        pq += p[c] * q[c];
+      const Real alpha = rz / pq;
+      Real rz_new = 0;
+      for (unsigned int c = 0; c < n; ++c)
+      {
+        x[c] += alpha * p[c];
+        r[c] -= alpha * q[c];
+        z[c] = r[c] / diag[c];
+        rz_new += r[c] * z[c];
+      }
+      const Real beta = rz_new / rz;
+      rz = rz_new;
+      for (unsigned int c = 0; c < n; ++c)
+        p[c] = z[c] + beta * p[c];
+    }
+  }
+
+  unsigned int _dim = 0;
+  Real _rho = 1;
+  Real _mu = 1;
+  Real _alpha_u = 0.7;
+  Real _alpha_p = 0.3;
+  unsigned int _momentum_sweeps = 4;
+  unsigned int _pressure_max_its = 200;
+  Real _pressure_rel_tol = 1e-6;
+
+  ///@{ Cells
+  std::vector<Real> _volume;
+  std::vector<Vector> _centroid;
+  ///@}
+
+  ///@{ Interior faces: the geometry, the interpolation weight of the owner and the distance
+  /// between the centroids of the cells
+  std::vector<unsigned int> _owner;
+  std::vector<unsigned int> _neighbor;
+  std::vector<Real> _area;
+  std::vector<Vector> _normal;
+  std::vector<Vector> _face_centroid;
+  std::vector<Real> _gc;
+  std::vector<Real> _dist;
+  ///@}
+
+  ///@{ Boundary faces
+  std::vector<unsigned int> _b_owner;
+  std::vector<Real> _b_area;
+  std::vector<Vector> _b_normal;
+  std::vector<Vector> _b_centroid;
+  std::vector<BoundaryType> _b_type;
+  std::vector<Vector> _b_velocity;
+  std::vector<Real> _b_pressure;
+  std::vector<Real> _b_dist;
+  bool _has_pressure_boundary = false;
+  ///@}
+
+  ///@{ The faces of each cell
+  std::vector<std::size_t> _cell_face_offsets;
+  std::vector<std::size_t> _cell_faces;
+  ///@}
+
+  ///@{ The state: velocity, pressure, V / (momentum diagonal) and face mass fluxes
+  std::vector<Vector> _u;
+  std::vector<Vector> _u_old;
+  std::vector<Real> _p;
+  std::vector<Real> _d;
+  std::vector<Real> _flux;
+  std::vector<Real> _b_flux;
+  ///@}
+
+  ///@{ The momentum coefficients of the neighbor in the owner equation and conversely
+  std::vector<Real> _a_owner;
+  std::vector<Real> _a_neighbor;
+  ///@}
+};
@@ -11,6 +11,7 @@
 
 #include "MooseMesh.h"
 #include "MooseApp.h"
+#include "PeridynamicsNeighborCSR.h"
 
 #include "libmesh/point.h"
 
@@ -158,6 +159,21 @@ public:
    */
   Real getBoundaryOffset(dof_id_type node_id);
 
+  /**
+   * Function to return the compressed connectivity (neighbors, bonds and bond-associated
+   * deformation gradient data) of all PD nodes, for the kernels to iterate without copies
+   * @return The CSR connectivity, built when csr_connectivity = true
+   */
+  const PeridynamicsNeighborCSR & getNeighborCSR() const
+  {
+    if (!_csr_connectivity)
+      mooseError("The CSR connectivity of the peridynamics mesh requires csr_connectivity = true");
+    return _neighbor_csr;
+  }
+
+  /// Whether the connectivity is stored in CSR form rather than in the nested vectors
+  bool hasNeighborCSR() const { return _csr_connectivity; }
+
 protected:
   ///@{ Horizon size control parameters
   const Real _horiz_rad;
@@ -207,6 +223,12 @@ protected:
   /// Offset of each boundary node to its original FE element boundary edge or face
   std::map<dof_id_type, Real> & _boundary_node_offset;
 
+  /// Whether the connectivity is built in _neighbor_csr instead of the nested vectors above
+  const bool _csr_connectivity;
+
+  /// CSR neighbors, bonds and deformation gradient data of the PD nodes
+  PeridynamicsNeighborCSR _neighbor_csr;
+
   /**
    * Function to create neighbors and other data for each material point with given horizon
    * @param connect_block_id_pairs   ID pairs of blocks to be connected via interfacial bonds
@@ -215,6 +237,17 @@ protected:
   void createNodeHorizBasedData(std::multimap<SubdomainID, SubdomainID> connect_block_id_pairs,
                                 std::multimap<SubdomainID, SubdomainID> non_connect_block_id_pairs);
 
+  /**
+   * Function to create the CSR connectivity with a KDTree radius search over the PD node
+   * coordinates, threaded over chunks of nodes, applying the same block interface and crack
+   * rules as createNodeHorizBasedData
+   * @param connect_block_id_pairs   ID pairs of blocks to be connected via interfacial bonds
+   * @param non_connect_block_id_pairs   ID pairs of blocks not to be connected
+   */
+  void createNodeHorizBasedCSR(
+      const std::multimap<SubdomainID, SubdomainID> & connect_block_id_pairs,
+      const std::multimap<SubdomainID, SubdomainID> & non_connect_block_id_pairs);
+
   /**
    * Function to check existence of interface between two blocks
    * @param blockID_i & blockID_j   IDs of two querying blocks
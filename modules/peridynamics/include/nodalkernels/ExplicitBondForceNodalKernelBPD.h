@@ -0,0 +1,36 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "NodalKernel.h"
+
+class ExplicitBondForceUserObjectBPD;
+
+/**
+ * Adds the bond forces computed by an ExplicitBondForceUserObjectBPD at each PD node to the
+ * residual of one displacement component
+ */
+class ExplicitBondForceNodalKernelBPD : public NodalKernel
+{
+public:
+  static InputParameters validParams();
+
+  ExplicitBondForceNodalKernelBPD(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+
+private:
+  /// The UserObject holding the forces
+  const ExplicitBondForceUserObjectBPD & _bond_forces;
+
+  /// The displacement component of the variable
+  const unsigned int _component;
+};
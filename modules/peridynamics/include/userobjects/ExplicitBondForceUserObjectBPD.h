@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObjectBasePD.h"
+#include "BondForceEngineBPD.h"
+
+/**
+ * UserObject computing the bond-based peridynamic forces of all the PD nodes in one threaded pass
+ * of a BondForceEngineBPD over the CSR connectivity of the PeridynamicsMesh (which requires
+ * csr_connectivity = true), for explicit time integration. The forces are read by
+ * ExplicitBondForceNodalKernelBPD, so no edge element is reinitialized per bond.
+ */
+class ExplicitBondForceUserObjectBPD : public GeneralUserObjectBasePD
+{
+public:
+  static InputParameters validParams();
+
+  ExplicitBondForceUserObjectBPD(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /**
+   * Function to return the bond force on a PD node
+   * @param node_id   The querying node index
+   * @param component   The displacement component
+   * @return The force component
+   */
+  Real getNodeForce(dof_id_type node_id, unsigned int component) const
+  {
+    return _forces[node_id * _dim + component];
+  }
+
+protected:
+  /// The displacement variables
+  std::vector<MooseVariable *> _disp_var;
+
+  /// The micro-modulus
+  const Real _micro_modulus;
+
+  /// Bonds stretched beyond this are broken after each force evaluation (never if negative)
+  const Real _critical_stretch;
+
+  /// The bond loop
+  BondForceEngineBPD _engine;
+
+  /// The displacements gathered from the solution, dim per node
+  std::vector<Real> _disp;
+
+  /// The nodal forces, dim per node
+  std::vector<Real> _forces;
+};
@@ -0,0 +1,167 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "PeridynamicsNeighborCSR.h"
+
+#include <cmath>
+#include <vector>
+
+/**
+ * Bond loop of the explicit bond-based peridynamic model over the CSR connectivity: the nodal
+ * forces f_i = sum_j c * s_ij * e_ij * V_i * V_j of all the intact bonds, with the stretch
+ * s_ij = (|xi + eta| - |xi|) / |xi| and e_ij the unit vector of the current bond, computed node
+ * by node from flat coordinate and displacement arrays instead of through an FE assembly of one
+ * edge element per bond.
+ *
+ * Each node gathers the forces of its own bonds (so every bond is evaluated from both ends), which
+ * makes any range of nodes independent of the others: the threads write to disjoint entries and
+ * need no reduction. The arrays are node-major, with dim components per node.
+ */
+class BondForceEngineBPD
+{
+public:
+  /**
+   * Computes the reference bond lengths and marks every bond intact
+   * @param csr The connectivity
+   * @param dim The number of components of the coordinates and displacements
+   * @param coords The reference coordinates of the nodes
+   * @param volumes The volumes of the nodes
+   */
+  void setup(const PeridynamicsNeighborCSR & csr,
+             unsigned int dim,
+             const std::vector<Real> & coords,
+             const std::vector<Real> & volumes)
+  {
+    if (coords.size() != std::size_t(csr.numNodes()) * dim || volumes.size() != csr.numNodes())
+      mooseError("The peridynamic coordinates and volumes do not match the connectivity");
+    _csr = &csr;
+    _dim = dim;
+    _coords = coords;
+    _volumes = volumes;
+
+    _ref_length.clear();
+    for (dof_id_type i = 0; i < csr.numNodes(); ++i)
+      for (const auto j : csr.neighbors(i))
+      {
+        Real length2 = 0;
+        for (unsigned int d = 0; d < dim; ++d)
+        {
+          const Real xi = _coords[j * dim + d] - _coords[i * dim + d];
+          length2 += xi * xi;
+        }
+        _ref_length.push_back(std::sqrt(length2));
+      }
+    _intact.assign(csr.numBonds(), 1);
+  }
+
+  /// Whether the bond is intact
+  bool intact(dof_id_type bond) const { return _intact[bond]; }
+
+  /// The number of intact bonds
+  dof_id_type numIntact() const
+  {
+    dof_id_type n = 0;
+    for (const auto b : _intact)
+      n += b;
+    return n;
+  }
+
+  /**
+   * Computes the forces of the nodes [begin, end)
+   * @param micro_modulus The micro-modulus c
+   * @param disp The displacements of all the nodes
+   * @param forces The forces, dim entries per node, overwritten for the nodes of the range
+   */
+  void computeForces(dof_id_type begin,
+                     dof_id_type end,
+                     Real micro_modulus,
+                     const std::vector<Real> & disp,
+                     std::vector<Real> & forces) const
+  {
+    for (dof_id_type i = begin; i < end; ++i)
+    {
+      Real force[3] = {0, 0, 0};
+      const auto neighbors = _csr->neighbors(i);
+      const auto bonds = _csr->bonds(i);
+      for (std::size_t k = 0; k < neighbors.size(); ++k)
+      {
+        if (!_intact[bonds[k]])
+          continue;
+        const auto j = neighbors[k];
+        Real current[3] = {0, 0, 0};
+        Real length2 = 0;
+        for (unsigned int d = 0; d < _dim; ++d)
+        {
+          current[d] = _coords[j * _dim + d] + disp[j * _dim + d] - _coords[i * _dim + d] -
+                       disp[i * _dim + d];
+          length2 += current[d] * current[d];
+        }
+        const Real length = std::sqrt(length2);
+        const Real ref_length = _ref_length[_csr->pair(i, k)];
+        const Real scale =
+            micro_modulus * (length - ref_length) / ref_length * _volumes[j] / length;
+        for (unsigned int d = 0; d < _dim; ++d)
+          force[d] += scale * current[d];
+      }
+      for (unsigned int d = 0; d < _dim; ++d)
+        forces[i * _dim + d] = force[d] * _volumes[i];
+    }
+  }
+
+  /**
+   * Breaks the bonds of the nodes [begin, end) whose stretch exceeds critical_stretch. Only the
+   * bonds to neighbors of larger ID are visited, so that concurrent ranges never write the same
+   * bond.
+   * @return The number of bonds broken
+   */
+  dof_id_type breakBonds(dof_id_type begin,
+                         dof_id_type end,
+                         Real critical_stretch,
+                         const std::vector<Real> & disp)
+  {
+    dof_id_type broken = 0;
+    for (dof_id_type i = begin; i < end; ++i)
+    {
+      const auto neighbors = _csr->neighbors(i);
+      const auto bonds = _csr->bonds(i);
+      for (std::size_t k = 0; k < neighbors.size(); ++k)
+      {
+        const auto j = neighbors[k];
+        if (j < i || !_intact[bonds[k]])
+          continue;
+        Real length2 = 0;
+        for (unsigned int d = 0; d < _dim; ++d)
+        {
+          const Real c = _coords[j * _dim + d] + disp[j * _dim + d] - _coords[i * _dim + d] -
+                         disp[i * _dim + d];
+          length2 += c * c;
+        }
+        const Real ref_length = _ref_length[_csr->pair(i, k)];
+        if ((std::sqrt(length2) - ref_length) / ref_length > critical_stretch)
+        {
+          _intact[bonds[k]] = 0;
+          ++broken;
+        }
+      }
+    }
+    return broken;
+  }
+
+private:
+  const PeridynamicsNeighborCSR * _csr = nullptr;
+  unsigned int _dim = 0;
+  std::vector<Real> _coords;
+  std::vector<Real> _volumes;
+  /// The reference length of each (node, neighbor) pair of the CSR
+  std::vector<Real> _ref_length;
+  /// Whether each bond is intact (char rather than bool, so they are separate memory locations)
+  std::vector<char> _intact;
+};
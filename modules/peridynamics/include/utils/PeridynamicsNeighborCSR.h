@@ -0,0 +1,187 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Compressed sparse row storage of the peridynamic connectivity of PeridynamicsMesh:
+ *  - the horizon neighbors of each node (sorted by ID) with the ID of the bond to each of them,
+ *    in place of _pdnode_neighbors and _pdnode_bonds
+ *  - for each bond of a node, the local indices of the neighbors entering its bond-associated
+ *    deformation gradient and its volume fraction, in place of _dg_neighbors and _dg_vol_frac
+ *
+ * The horizon search is split into chunks of consecutive nodes: searchChunk() fills a Chunk
+ * independently of the others (so the chunks may be searched by different threads, typically with
+ * a KDTree radius search), then assemble() concatenates them and numbers the bonds.
+ */
+class PeridynamicsNeighborCSR
+{
+public:
+  /// A contiguous range of IDs
+  struct Range
+  {
+    const dof_id_type * first;
+    const dof_id_type * last;
+
+    const dof_id_type * begin() const { return first; }
+    const dof_id_type * end() const { return last; }
+    std::size_t size() const { return last - first; }
+    dof_id_type operator[](std::size_t i) const { return first[i]; }
+  };
+
+  /// The neighbors of the nodes [begin, end), found by one searchChunk()
+  struct Chunk
+  {
+    dof_id_type begin;
+    dof_id_type end;
+    std::vector<dof_id_type> counts;
+    std::vector<dof_id_type> neighbors;
+  };
+
+  /**
+   * Searches the neighbors of the nodes of a chunk
+   * @param chunk The chunk, with begin and end set
+   * @param search search(i, neighbors) appends the neighbors of node i (excluding i) to neighbors
+   */
+  template <typename Search>
+  static void searchChunk(Chunk & chunk, const Search & search)
+  {
+    chunk.counts.clear();
+    chunk.neighbors.clear();
+    for (dof_id_type i = chunk.begin; i < chunk.end; ++i)
+    {
+      const auto first = chunk.neighbors.size();
+      search(i, chunk.neighbors);
+      std::sort(chunk.neighbors.begin() + first, chunk.neighbors.end());
+      chunk.counts.push_back(chunk.neighbors.size() - first);
+    }
+  }
+
+  /**
+   * Concatenates the chunks, which must cover the nodes [0, num_nodes) in order, and numbers
+   * the bonds: each pair of neighbors i < j gets one bond ID, in the order of i then j. The search
+   * must be symmetric (j is a neighbor of i if and only if i is a neighbor of j).
+   */
+  void assemble(dof_id_type num_nodes, const std::vector<Chunk> & chunks)
+  {
+    _offsets.assign(1, 0);
+    _offsets.reserve(num_nodes + 1);
+    _neighbors.clear();
+    for (const auto & chunk : chunks)
+    {
+      if (chunk.begin != _offsets.size() - 1)
+        mooseError("The peridynamic neighbor chunks do not cover the nodes in order");
+      for (const auto count : chunk.counts)
+        _offsets.push_back(_offsets.back() + count);
+      _neighbors.insert(_neighbors.end(), chunk.neighbors.begin(), chunk.neighbors.end());
+    }
+    if (_offsets.size() != std::size_t(num_nodes) + 1)
+      mooseError("The peridynamic neighbor chunks do not cover all the nodes");
+
+    _bonds.resize(_neighbors.size());
+    _num_bonds = 0;
+    for (dof_id_type i = 0; i < num_nodes; ++i)
+      for (auto p = _offsets[i]; p < _offsets[i + 1]; ++p)
+      {
+        const auto j = _neighbors[p];
+        if (j > i)
+          _bonds[p] = _num_bonds++;
+        else
+          _bonds[p] = _bonds[pair(j, neighborIndex(j, i))];
+      }
+
+    _dg_offsets.clear();
+    _dg_neighbors.clear();
+    _dg_vol_frac.clear();
+  }
+
+  dof_id_type numNodes() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+  dof_id_type numBonds() const { return _num_bonds; }
+
+  ///@{ The neighbors of node i and the bonds to them, in the same order
+  Range neighbors(dof_id_type i) const
+  {
+    return {_neighbors.data() + _offsets[i], _neighbors.data() + _offsets[i + 1]};
+  }
+  Range bonds(dof_id_type i) const
+  {
+    return {_bonds.data() + _offsets[i], _bonds.data() + _offsets[i + 1]};
+  }
+  ///@}
+
+  /// The flat index of the k^th neighbor of node i
+  std::size_t pair(dof_id_type i, std::size_t k) const
+  {
+    mooseAssert(k < _offsets[i + 1] - _offsets[i], "Node " << i << " has no neighbor " << k);
+    return _offsets[i] + k;
+  }
+
+  /// The local index of node j among the neighbors of node i
+  std::size_t neighborIndex(dof_id_type i, dof_id_type j) const
+  {
+    const auto range = neighbors(i);
+    const auto it = std::lower_bound(range.begin(), range.end(), j);
+    if (it == range.end() || *it != j)
+      mooseError("Node ", j, " is not a neighbor of node ", i);
+    return it - range.begin();
+  }
+
+  /**
+   * Builds the bond-associated deformation gradient data, after assemble()
+   * @param dg dg(i, k, neighbors) appends the local indices of the neighbors of the k^th bond of
+   * node i to neighbors and returns its volume fraction
+   */
+  template <typename DefGrad>
+  void buildDefGrad(const DefGrad & dg)
+  {
+    _dg_offsets.assign(1, 0);
+    _dg_offsets.reserve(_neighbors.size() + 1);
+    _dg_neighbors.clear();
+    _dg_vol_frac.resize(_neighbors.size());
+    for (dof_id_type i = 0; i < numNodes(); ++i)
+      for (std::size_t k = 0; k < _offsets[i + 1] - _offsets[i]; ++k)
+      {
+        _dg_vol_frac[pair(i, k)] = dg(i, k, _dg_neighbors);
+        _dg_offsets.push_back(_dg_neighbors.size());
+      }
+  }
+
+  ///@{ The bond-associated deformation gradient data of the k^th bond of node i
+  Range defGradNeighbors(dof_id_type i, std::size_t k) const
+  {
+    const auto p = pair(i, k);
+    return {_dg_neighbors.data() + _dg_offsets[p], _dg_neighbors.data() + _dg_offsets[p + 1]};
+  }
+  Real defGradVolFraction(dof_id_type i, std::size_t k) const { return _dg_vol_frac[pair(i, k)]; }
+  ///@}
+
+  /// The memory of the storage, in bytes
+  std::size_t bytes() const
+  {
+    return (_offsets.size() + _dg_offsets.size()) * sizeof(std::size_t) +
+           (_neighbors.size() + _bonds.size() + _dg_neighbors.size()) * sizeof(dof_id_type) +
+           _dg_vol_frac.size() * sizeof(Real);
+  }
+
+private:
+  std::vector<std::size_t> _offsets;
+  std::vector<dof_id_type> _neighbors;
+  std::vector<dof_id_type> _bonds;
+  dof_id_type _num_bonds = 0;
+
+  std::vector<std::size_t> _dg_offsets;
+  std::vector<dof_id_type> _dg_neighbors;
+  std::vector<Real> _dg_vol_frac;
+};
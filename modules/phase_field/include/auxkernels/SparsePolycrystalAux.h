@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxKernel.h"
+
+// Forward Declarations
+class SparsePolycrystal;
+
+/**
+ * Displays a nodal field of a SparsePolycrystal: the id of the dominant grain, the bnds, the
+ * number of active grains, or the value of one grain.
+ */
+class SparsePolycrystalAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  SparsePolycrystalAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  const SparsePolycrystal & _sparse_polycrystal;
+
+  /// The field displayed: GRAIN_ID, BNDS, NUM_ACTIVE or GRAIN_VALUE
+  const MooseEnum _field;
+
+  /// The grain displayed by GRAIN_VALUE
+  const unsigned int _grain_id;
+};
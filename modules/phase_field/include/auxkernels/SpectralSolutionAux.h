@@ -0,0 +1,31 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxKernel.h"
+
+// Forward Declarations
+class SpectralPhaseFieldSolver;
+
+/**
+ * Copies the field of a SpectralPhaseFieldSolver into an elemental variable.
+ */
+class SpectralSolutionAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  SpectralSolutionAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  const SpectralPhaseFieldSolver & _solver;
+};
@@ -0,0 +1,78 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+#include "MultiPhaseSwitching.h"
+
+// Forward Declarations
+
+/**
+ * MultiPhaseSwitchingMaterial replaces one SwitchingFunctionMultiPhaseMaterial per phase and the
+ * MultiBarrierFunctionMaterial of a multi-phase KKS model: it evaluates the switching functions
+ * of every phase, the barrier function, and all their first and second derivatives in a single
+ * pass per qp (see MultiPhaseSwitching). The properties have the names the separate materials
+ * declare ("h_names", "g"), so the KKSMulti* kernels and DerivativeMultiPhaseMaterial consume
+ * them unchanged. Optionally, given the free energies of the phases, it also declares the total
+ * free energy and its derivatives in the order parameters.
+ */
+class MultiPhaseSwitchingMaterial : public DerivativeMaterialInterface<Material>
+{
+public:
+  static InputParameters validParams();
+
+  MultiPhaseSwitchingMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+  /// The order parameters of all phases
+  const unsigned int _num_eta;
+  const std::vector<const VariableValue *> _eta;
+  const std::vector<VariableName> _eta_names;
+
+  /// The phase of each order parameter (the index of its phase in "h_names")
+  const std::vector<unsigned int> _phase_of_eta;
+
+  /// The shared evaluation
+  MultiPhaseSwitching _switching;
+
+  /// The order parameter values at the current qp
+  std::vector<Real> _eta_qp;
+
+  ///@{ The switching functions and their derivatives
+  std::vector<MaterialProperty<Real> *> _prop_h;
+  std::vector<std::vector<MaterialProperty<Real> *>> _prop_dh;
+  std::vector<std::vector<std::vector<MaterialProperty<Real> *>>> _prop_d2h;
+  ///@}
+
+  ///@{ The barrier function and its derivatives
+  MaterialProperty<Real> & _prop_g;
+  std::vector<MaterialProperty<Real> *> _prop_dg;
+  std::vector<MaterialProperty<Real> *> _prop_d2g;
+  ///@}
+
+  /// Whether the total free energy is declared ("Fj_names" given)
+  const bool _compute_free_energy;
+
+  /// The barrier height of the total free energy
+  const Real _W;
+
+  ///@{ The free energies of the phases, and their values at the current qp
+  std::vector<const MaterialProperty<Real> *> _prop_Fj;
+  std::vector<Real> _Fj_qp;
+  ///@}
+
+  ///@{ The total free energy and its derivatives in the order parameters
+  MaterialProperty<Real> * _prop_F;
+  std::vector<MaterialProperty<Real> *> _prop_dF;
+  ///@}
+};
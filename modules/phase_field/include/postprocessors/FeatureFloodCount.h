@@ -14,6 +14,7 @@
 #include "InfixIterator.h"
 #include "MooseVariableDependencyInterface.h"
 #include "BoundaryRestrictable.h"
+#include "FeatureMerging.h"
 
 #include <iterator>
 #include <list>
@@ -465,6 +466,21 @@ protected:
    */
   virtual void mergeSets();
 
+  /**
+   * Merges the mergeable partial features of a map: every mergeable pair is united once in a
+   * FeatureMerging::DisjointSets, then each set is merged into a single feature, instead of
+   * merging pairs and restarting the pairwise search after every merge
+   */
+  void mergeWithUnionFind(std::list<FeatureData> & features);
+
+  /**
+   * The parallel merge along the binomial tree of FeatureMerging::mergePartner(): at each round
+   * half of the remaining ranks send their (merged) partial features to a partner, which merges
+   * them, so that rank 0 ends with the merged features after log2(n_procs) rounds instead of
+   * receiving and merging the partial features of every rank
+   */
+  void treeMerge();
+
   /**
    * Method for determining whether two features are mergeable. This routine exists because
    * derived classes may need to override this function rather than use the mergeable method
@@ -767,6 +783,9 @@ private:
   /// Keeps track of whether we are distributing the merge work
   const bool _distribute_merge_work;
 
+  /// Whether the partial features are merged along a tree of ranks ("tree_merge"), see treeMerge()
+  const bool _tree_merge;
+
   /// Timers
   const PerfID _execute_timer;
   const PerfID _merge_timer;
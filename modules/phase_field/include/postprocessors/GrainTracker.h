@@ -11,6 +11,7 @@
 
 #include "FeatureFloodCount.h"
 #include "GrainTrackerInterface.h"
+#include "IncrementalFlood.h"
 
 #include "libmesh/bounding_box.h"
 
@@ -164,6 +165,28 @@ protected:
   Real centroidRegionDistance(std::vector<BoundingBox> & bboxes1,
                               std::vector<BoundingBox> & bboxes2) const;
 
+  /**
+   * The incremental replacement of the flood of execute(): the partial features of the previous
+   * step that hold or border an entity that crossed the threshold since then are flooded again,
+   * seeded from their previous entities and the entities that crossed; the others are kept as
+   * they were. Returns false, having done nothing, when a full flood is needed instead: on the
+   * first step, after a remap or a mesh change, or when the dirty fraction exceeds
+   * "incremental_max_dirty_fraction" (see IncrementalFlood::fullFloodIsCheaper()).
+   */
+  bool incrementalFlood();
+
+  /**
+   * Collects the sorted entities of each variable above the threshold, into
+   * _above_threshold_current; incrementalFlood() compares them with those of the previous step.
+   */
+  void collectAboveThreshold();
+
+  /**
+   * Saves the state the next incremental flood starts from, at the end of finalize(): the
+   * partial features and the entities above the threshold.
+   */
+  void saveIncrementalState();
+
   /**
    * Retrieve the next unique grain number if a new grain is detected during trackGrains. This
    * method handles reserve order parameter indices properly. Direct access to the next index
@@ -246,12 +269,30 @@ private:
   /// Data structure to hold element ID ranges when using Distributed Mesh (populated on rank 0 only)
   std::vector<std::pair<dof_id_type, dof_id_type>> _all_ranges;
 
+  /// Whether the features are found by incrementalFlood() when possible ("incremental_tracking")
+  const bool _incremental_tracking;
+
+  /// The largest fraction of dirty entities flooded incrementally
+  const Real _incremental_max_dirty_fraction;
+
+  /// Set by remaps and mesh changes, which invalidate the previous features: the next flood is full
+  bool _full_flood_required;
+
+  ///@{ The sorted entities above the threshold of each variable, at the previous step and now
+  std::vector<std::vector<dof_id_type>> _above_threshold_old;
+  std::vector<std::vector<dof_id_type>> _above_threshold_current;
+  ///@}
+
+  /// The local partial features of the previous step, before merging
+  std::vector<std::list<FeatureData>> _partial_feature_sets_old;
+
   /// Timers
   const PerfID _finalize_timer;
   const PerfID _remap_timer;
   const PerfID _track_grains;
   const PerfID _broadcast_update;
   const PerfID _update_field_info;
+  const PerfID _incremental_flood_timer;
 };
 
 /**
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ElementUserObject.h"
+#include "PhiloxRandom.h"
 
 // Forward Declarations
 
@@ -33,9 +34,36 @@ public:
 protected:
   virtual Real getQpRandom() = 0;
 
+  /**
+   * Fills the random numbers of all the quadrature points of an element. With "counter_based"
+   * the veneers draw the whole block from PhiloxRandom, keyed by the seed and the time step and
+   * counted by the element id, so the noise does not depend on the number of ranks and threads;
+   * otherwise this draws getQpRandom() per qp.
+   */
+  virtual void getElementRandoms(dof_id_type element_id, unsigned int n_qp, Real * values) = 0;
+
+  /**
+   * Sums the integral and the volume over the ranks in one reduction, instead of one each, and
+   * sets the offset that makes the integral of the noise vanish
+   */
+  void computeOffset()
+  {
+    std::vector<Real> sums = {_integral, _volume};
+    gatherSum(sums);
+    _integral = sums[0];
+    _volume = sums[1];
+    _offset = _volume > 0 ? _integral / _volume : 0;
+  }
+
   Real _integral;
   Real _volume;
   Real _offset;
 
   unsigned int _qp;
+
+  /// Whether the numbers are drawn from the counter-based generator ("counter_based")
+  const bool _counter_based;
+
+  /// The seed of the counter-based generator
+  const unsigned int _counter_seed;
 };
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "PhiloxRandom.h"
+
 /**
  * Veneer to build userobjects that generate a normaly distributed random
  * number once per timestep for every quadrature point
@@ -25,6 +27,7 @@ public:
 
 protected:
   Real getQpRandom();
+  void getElementRandoms(dof_id_type element_id, unsigned int n_qp, Real * values);
 
 private:
   unsigned int _phase;
@@ -61,3 +64,20 @@ ConservedNormalNoiseVeneer<T>::getQpRandom()
     return _Z2;
   }
 }
+
+template <class T>
+void
+ConservedNormalNoiseVeneer<T>::getElementRandoms(dof_id_type element_id,
+                                                unsigned int n_qp,
+                                                Real * values)
+{
+  if (!this->_counter_based)
+  {
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+      values[qp] = getQpRandom();
+    return;
+  }
+
+  PhiloxRandom::normal(
+      PhiloxRandom::key(this->_counter_seed, this->_t_step), element_id, n_qp, values);
+}
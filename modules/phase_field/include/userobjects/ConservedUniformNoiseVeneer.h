@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "PhiloxRandom.h"
+
 /**
  * Veneer to build userobjects that generate a uniformly distributed random
  * number in the interval [-1:1] once per timestep for every quadrature point
@@ -25,6 +27,7 @@ public:
 
 protected:
   Real getQpRandom();
+  void getElementRandoms(dof_id_type element_id, unsigned int n_qp, Real * values);
 };
 
 template <class T>
@@ -39,3 +42,22 @@ ConservedUniformNoiseVeneer<T>::getQpRandom()
 {
   return 2.0 * this->getRandomReal() - 1.0;
 }
+
+template <class T>
+void
+ConservedUniformNoiseVeneer<T>::getElementRandoms(dof_id_type element_id,
+                                                 unsigned int n_qp,
+                                                 Real * values)
+{
+  if (!this->_counter_based)
+  {
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+      values[qp] = getQpRandom();
+    return;
+  }
+
+  PhiloxRandom::uniform(
+      PhiloxRandom::key(this->_counter_seed, this->_t_step), element_id, n_qp, values);
+  for (unsigned int qp = 0; qp < n_qp; ++qp)
+    values[qp] = 2.0 * values[qp] - 1.0;
+}
@@ -11,6 +11,7 @@
 
 #include "EulerAngleProvider.h"
 #include "EBSDAccessFunctors.h"
+#include "EBSDLocalGrid.h"
 
 /**
  * A GeneralUserObject that reads an EBSD file and stores the centroid
@@ -27,6 +28,12 @@
  * Phases are referred to using the numbers in the EBSD data file. In case the phase number in the
  * data file
  * starts at 1 the phase 0 will simply contain no grains.
+ *
+ * With "distributed = true" the file is read by the first processor only. It accumulates the grain
+ * averages while reading and sends every other processor the points of the box of cells overlapping
+ * its local elements (see EBSDLocalGrid). The grain averages stay replicated, but the point data of
+ * each processor is limited to its box, so getData() may only be called for points near the local
+ * elements.
  */
 class EBSDReader : public EulerAngleProvider, public EBSDAccessFunctors
 {
@@ -38,6 +45,9 @@ public:
 
   virtual void readFile();
 
+  /// Whether each processor only holds the data points near its local elements
+  bool isDistributed() const { return _distributed; }
+
   virtual void initialize() {}
   virtual void execute() {}
   virtual void finalize() {}
@@ -179,9 +189,24 @@ protected:
   /// Maximum grid extent
   Real _maxx, _maxy, _maxz;
 
-  /// Computes a global index in the _data array given an input *centroid* point
+  /// Computes the index in the _data array (global, or local to the box) given a *centroid* point
   unsigned indexFromPoint(const Point & p) const;
 
+  /**
+   * Distributed reading: the first processor parses the file, accumulates the grain averages and
+   * sends each processor the points of its box; the averages are then broadcast
+   */
+  void readFileDistributed();
+
+  /// The box of cells needed by the local and ghosted elements, bounding their nodal bounding box
+  EBSDLocalGrid::Box localBox();
+
+  /// Whether the point data is distributed
+  const bool _distributed;
+
+  /// The EBSD grid and the box of it held in _data when distributed
+  EBSDLocalGrid _grid;
+
   /// Transfer the index into the _avg_data array from given index
   unsigned indexFromIndex(unsigned int var) const;
 
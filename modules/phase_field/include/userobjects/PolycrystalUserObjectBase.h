@@ -11,6 +11,7 @@
 
 #include "DenseMatrix.h"
 #include "FeatureFloodCount.h"
+#include "CompressedAdjacency.h"
 
 // Forward Declarations
 
@@ -112,11 +113,31 @@ protected:
    */
   void buildGrainAdjacencyMatrix();
 
+  /**
+   * Builds the sparse grain adjacency graph (the neighbors of each grain, from the same halo
+   * overlaps as the dense matrix) used by the "parallel_greedy" coloring, which never forms the
+   * dense matrix: its size is quadratic in the number of grains.
+   */
+  void buildGrainAdjacencyGraph();
+
   /**
    * Method that runs a coloring algorithm to assign OPs to grains.
    */
   void assignOpsToGrains();
 
+  /**
+   * Assigns OPs to grains with GrainGraphColoring::color on the sparse graph, in parallel rounds
+   * over the thread pool; errors if more colors than OPs are needed.
+   */
+  void assignOpsToGrainsParallelGreedy();
+
+  /**
+   * Fills the entity to grain cache of the local elements (and nodes, for nodal variables) with
+   * the thread pool before the flood, as getGrainsBasedOnElem / getGrainsBasedOnPoint dominate the
+   * setup of large polycrystals; the derived classes implement them as thread-safe const lookups.
+   */
+  void precomputeEntityGrains();
+
   /**
    * Built-in simple "back-tracking" algorithm to assign colors to a graph.
    */
@@ -138,6 +159,9 @@ protected:
   /// The dense adjacency matrix
   std::unique_ptr<DenseMatrix<Real>> _adjacency_matrix;
 
+  /// The sparse adjacency graph, for the "parallel_greedy" coloring
+  CompressedAdjacency<unsigned int> _grain_adjacency;
+
   /// mesh dimension
   const unsigned int _dim;
 
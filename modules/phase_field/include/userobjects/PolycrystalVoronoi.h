@@ -10,6 +10,7 @@
 #pragma once
 
 #include "PolycrystalUserObjectBase.h"
+#include "KDTree.h"
 
 // Forward Declarations
 
@@ -43,9 +44,25 @@ protected:
 
   std::vector<Point> _centerpoints;
 
+  /// The grain centers searched by the KDTree (projected on z = 0 for columnar 3D structures)
+  std::vector<Point> _kd_centerpoints;
+
+  /**
+   * Nearest-center search over _kd_centerpoints, built by precomputeGrainStructure(): the grains of
+   * a point are found among the closest centers instead of a scan of all of them. The searches are
+   * read-only, so the threads evaluating the IC share the tree.
+   */
+  std::unique_ptr<KDTree> _kd_tree;
+
   const FileName _file_name;
 
 private:
+  /// The indices of the n grain centers closest to point, nearest first
+  void nearestCenters(const Point & point,
+                      unsigned int n,
+                      std::vector<std::size_t> & indices,
+                      std::vector<Real> & distances_sqr) const;
+
   Real computeDiffuseInterface(const Point & point,
                                const unsigned int & gr_index,
                                const std::vector<unsigned int> & grain_ids) const;
@@ -0,0 +1,101 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "ActiveGrainSet.h"
+
+#include <unordered_map>
+
+// Forward Declarations
+class PolycrystalUserObjectBase;
+
+/**
+ * A sparse polycrystal undergoing grain growth: each node stores only the few grains active
+ * there (see ActiveGrainSet), with their global ids, instead of one order parameter variable
+ * per grain (or per reduced op) holding zeros almost everywhere. Each element interpolates, with
+ * its own local indexing (ActiveGrainSet::elementSlots()), the grains active at its nodes, so no
+ * global assignment of grains to variables, and no remapping, is needed.
+ *
+ * The order parameters evolve by the explicit Allen-Cahn update of the ACGrGrPoly free energy
+ * with a lumped mass: execute() accumulates the nodal rates of the grains of each element,
+ * finalize() advances the nodes and deactivates the grains that fell below "active_threshold".
+ * Memory and assembly therefore scale with the number of grains per node, at most "capacity",
+ * rather than with op_num.
+ */
+class SparsePolycrystal : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  SparsePolycrystal(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual void meshChanged() override;
+
+  /// The grains active at a node
+  const ActiveGrainSet & nodeGrains(dof_id_type node_id) const;
+
+  /// The sum of the squared order parameters at a node (the bnds of the dense formulation)
+  Real bnds(dof_id_type node_id) const;
+
+  /// The largest number of grains active at a local node
+  unsigned int maxLocalGrains() const;
+
+protected:
+  /// Fills the nodal sets from the initial polycrystal
+  void initializeFromPolycrystal();
+
+  /**
+   * Accumulates the lumped Allen-Cahn rates of the grains of the current element into _rates,
+   * at the nodes of the element, over the slots of its local indexing
+   */
+  void accumulateElementRates(const std::vector<unsigned int> & slots);
+
+  /// Sends the rates and masses of the ghosted nodes to their owners, which advance them
+  void communicateRates();
+
+  /// Sends the advanced sets of the local nodes to the ranks that ghost them
+  void communicateNodeGrains();
+
+  /// The largest number of grains a node stores
+  const unsigned int _capacity;
+
+  /// The value below which a grain is deactivated at a node
+  const Real _active_threshold;
+
+  /// The Allen-Cahn mobility
+  const Real _L;
+
+  ///@{ The coefficients of the ACGrGrPoly free energy and of the gradient energy
+  const Real _mu;
+  const Real _gamma;
+  const Real _kappa;
+  ///@}
+
+  /// The initial polycrystal
+  const PolycrystalUserObjectBase & _poly_ic_uo;
+
+  /// The grains active at each (local or ghosted) node
+  std::unordered_map<dof_id_type, ActiveGrainSet> _grains;
+
+  /// The rate of each grain at each node, accumulated over the elements
+  std::unordered_map<dof_id_type, std::vector<std::pair<unsigned int, Real>>> _rates;
+
+  /// The lumped mass of each node
+  std::unordered_map<dof_id_type, Real> _lumped_mass;
+
+  /// The set returned for the nodes holding no grain
+  const ActiveGrainSet _empty_set;
+};
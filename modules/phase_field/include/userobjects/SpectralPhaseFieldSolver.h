@@ -0,0 +1,86 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "DerivativeMaterialInterface.h"
+#include "SpectralGrid.h"
+
+// Forward Declarations
+
+/**
+ * Semi-implicit Fourier spectral time stepping of a periodic Allen-Cahn or Cahn-Hilliard
+ * equation on the elements of a GeneratedMesh, one grid cell per element (see SpectralGrid).
+ *
+ * The bulk driving force is the derivative of a phase_field free energy material with respect
+ * to the field, averaged over each element: execute() samples it into the grid, finalize()
+ * gathers the grid, transforms it, takes the step and transforms back. The field itself lives in
+ * the grid; SpectralSolutionAux copies it into the (CONSTANT MONOMIAL) variable the free energy
+ * is coupled to, for output and for the free energy evaluation of the next step.
+ */
+class SpectralPhaseFieldSolver : public DerivativeMaterialInterface<ElementUserObject>
+{
+public:
+  static InputParameters validParams();
+
+  SpectralPhaseFieldSolver(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  /// The value of the field at the cell of an element
+  Real value(const Elem & elem) const;
+
+protected:
+  /// The grid cell of an element, from its centroid
+  std::size_t cell(const Elem & elem) const;
+
+  /// Sets the grid from the current values of the variable (on the first execution)
+  void initializeField();
+
+  /// The equation stepped: ALLEN_CAHN or CAHN_HILLIARD
+  const MooseEnum _equation;
+
+  /// The field, coupled as the argument of the free energy derivative
+  const VariableValue & _u;
+  const VariableName _u_name;
+
+  /// The derivative of the free energy with respect to the field
+  const MaterialProperty<Real> & _dFdu;
+
+  ///@{ The mobility (L or M) and the gradient energy coefficient
+  const Real _mobility;
+  const Real _kappa;
+  ///@}
+
+  /// The lowest corner of the mesh and the cell sizes
+  Point _lower;
+  std::vector<Real> _cell_size;
+
+  /// The periodic grid
+  std::unique_ptr<SpectralGrid> _grid;
+
+  /// The field on the grid (replicated on every rank)
+  std::vector<Real> _field;
+
+  /// The element averages of the driving force sampled by this rank (zero elsewhere)
+  std::vector<Real> _driving_force;
+
+  /// Whether the field was set from the variable yet
+  bool _initialized;
+
+  ///@{ The transform buffers
+  std::vector<SpectralGrid::Complex> _field_hat;
+  std::vector<SpectralGrid::Complex> _driving_force_hat;
+  ///@}
+};
@@ -0,0 +1,156 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * The few grains active at a node of a sparse polycrystal: (grain id, order parameter value)
+ * pairs, at most capacity() of them, instead of one value per grain of the whole polycrystal.
+ * When a new grain arrives at a full node, the grain with the smallest value gives its place.
+ */
+class ActiveGrainSet
+{
+public:
+  /// The id of a slot holding no grain
+  static constexpr unsigned int invalid_id = std::numeric_limits<unsigned int>::max();
+
+  explicit ActiveGrainSet(unsigned int capacity = 0) : _capacity(capacity) {}
+
+  unsigned int capacity() const { return _capacity; }
+  std::size_t size() const { return _grains.size(); }
+  bool empty() const { return _grains.empty(); }
+
+  /// The value of a grain, zero when it is not active here
+  Real value(unsigned int id) const
+  {
+    for (const auto & grain : _grains)
+      if (grain.first == id)
+        return grain.second;
+    return 0;
+  }
+
+  /**
+   * Sets the value of a grain, activating it if needed
+   * @return The id of the grain evicted to make room, or invalid_id
+   */
+  unsigned int set(unsigned int id, Real value)
+  {
+    for (auto & grain : _grains)
+      if (grain.first == id)
+      {
+        grain.second = value;
+        return invalid_id;
+      }
+
+    if (_grains.size() < _capacity)
+    {
+      _grains.emplace_back(id, value);
+      return invalid_id;
+    }
+
+    mooseAssert(_capacity, "An ActiveGrainSet without capacity holds no grain");
+    auto smallest = std::min_element(_grains.begin(), _grains.end(), byValue);
+    if (smallest->second >= value)
+      return id;
+    const unsigned int evicted = smallest->first;
+    *smallest = {id, value};
+    return evicted;
+  }
+
+  /// Deactivates the grains whose value is at most \p threshold
+  void prune(Real threshold)
+  {
+    _grains.erase(std::remove_if(_grains.begin(),
+                                 _grains.end(),
+                                 [threshold](const std::pair<unsigned int, Real> & grain) {
+                                   return grain.second <= threshold;
+                                 }),
+                  _grains.end());
+  }
+
+  /// The sum of the squared values of the grains other than \p id, as in the grain growth terms
+  Real sumSquaresExcept(unsigned int id) const
+  {
+    Real sum = 0;
+    for (const auto & grain : _grains)
+      if (grain.first != id)
+        sum += grain.second * grain.second;
+    return sum;
+  }
+
+  /// The grain of largest value, or invalid_id
+  unsigned int dominant() const
+  {
+    auto largest = std::max_element(_grains.begin(), _grains.end(), byValue);
+    return largest == _grains.end() ? invalid_id : largest->first;
+  }
+
+  std::vector<std::pair<unsigned int, Real>>::const_iterator begin() const
+  {
+    return _grains.begin();
+  }
+  std::vector<std::pair<unsigned int, Real>>::const_iterator end() const { return _grains.end(); }
+
+  /**
+   * The element-local indexing of the grains of the nodes of an element: the grains active at
+   * any of its nodes, by decreasing largest value, at most \p n_slots of them. Slot k of every
+   * node of the element then interpolates the same grain.
+   * @param nodes The sets of the nodes of the element
+   * @param n_slots The number of slots
+   * @return The grain of each slot, invalid_id for the unused ones
+   */
+  static std::vector<unsigned int> elementSlots(const std::vector<const ActiveGrainSet *> & nodes,
+                                                unsigned int n_slots)
+  {
+    std::vector<std::pair<unsigned int, Real>> grains;
+    for (const auto * node : nodes)
+      for (const auto & grain : *node)
+      {
+        auto it = std::find_if(grains.begin(),
+                               grains.end(),
+                               [&grain](const std::pair<unsigned int, Real> & other) {
+                                 return other.first == grain.first;
+                               });
+        if (it == grains.end())
+          grains.push_back(grain);
+        else
+          it->second = std::max(it->second, grain.second);
+      }
+
+    // Ties by id, so that every element sharing the grains slots them alike
+    std::sort(grains.begin(),
+              grains.end(),
+              [](const std::pair<unsigned int, Real> & a, const std::pair<unsigned int, Real> & b) {
+                return a.second > b.second || (a.second == b.second && a.first < b.first);
+              });
+
+    std::vector<unsigned int> slots(n_slots, invalid_id);
+    for (std::size_t k = 0; k < std::min<std::size_t>(n_slots, grains.size()); ++k)
+      slots[k] = grains[k].first;
+    return slots;
+  }
+
+private:
+  static bool byValue(const std::pair<unsigned int, Real> & a,
+                      const std::pair<unsigned int, Real> & b)
+  {
+    return a.second < b.second;
+  }
+
+  unsigned int _capacity;
+  std::vector<std::pair<unsigned int, Real>> _grains;
+};
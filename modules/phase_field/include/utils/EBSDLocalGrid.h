@@ -0,0 +1,138 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseError.h"
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ * The regular grid of an EBSD data file and a box of its cells, the cells held by one processor
+ * when the EBSDReader distributes the data points: the cells covering the bounding box of the
+ * local (and ghosted) elements, plus a layer of padding cells.
+ *
+ * Cells are numbered x fastest both globally (the order of the data file) and within the box.
+ */
+class EBSDLocalGrid
+{
+public:
+  /// A box of cells, [begin, end) in each direction
+  struct Box
+  {
+    std::array<unsigned int, 3> begin = {{0, 0, 0}};
+    std::array<unsigned int, 3> end = {{0, 0, 0}};
+
+    bool contains(const std::array<unsigned int, 3> & ijk) const
+    {
+      for (unsigned int d = 0; d < 3; ++d)
+        if (ijk[d] < begin[d] || ijk[d] >= end[d])
+          return false;
+      return true;
+    }
+
+    std::size_t size() const
+    {
+      return std::size_t(end[0] - begin[0]) * (end[1] - begin[1]) * (end[2] - begin[2]);
+    }
+  };
+
+  /**
+   * @param n The number of cells in each direction
+   * @param min The lower corner of the grid
+   * @param spacing The cell size in each direction
+   */
+  void setGrid(const std::array<unsigned int, 3> & n,
+               const std::array<Real, 3> & min,
+               const std::array<Real, 3> & spacing)
+  {
+    _n = n;
+    _min = min;
+    _spacing = spacing;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      // A direction of a single cell (the z direction of 2D data) may have no spacing
+      if (_n[d] == 1 && !(_spacing[d] > 0))
+        _spacing[d] = 1;
+      if (_n[d] == 0 || !(_spacing[d] > 0))
+        mooseError("Invalid EBSD grid in direction ", d);
+    }
+    setFullBox();
+  }
+
+  /// Makes the box the whole grid
+  void setFullBox()
+  {
+    _box.begin = {{0, 0, 0}};
+    _box.end = _n;
+  }
+
+  /// Makes the box the cells overlapping [lower, upper], extended by padding cells
+  void setBox(const Point & lower, const Point & upper, unsigned int padding = 1)
+  {
+    const auto lo = cell(lower);
+    const auto hi = cell(upper);
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      _box.begin[d] = lo[d] > padding ? lo[d] - padding : 0;
+      _box.end[d] = std::min(hi[d] + padding + 1, _n[d]);
+    }
+  }
+
+  const Box & box() const { return _box; }
+
+  /// The cell containing p (points outside the grid are clamped to it)
+  std::array<unsigned int, 3> cell(const Point & p) const
+  {
+    std::array<unsigned int, 3> ijk;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      const Real s = std::floor((p(d) - _min[d]) / _spacing[d]);
+      ijk[d] = s <= 0 ? 0 : std::min<unsigned int>(s, _n[d] - 1);
+    }
+    return ijk;
+  }
+
+  /// The cell of a global index
+  std::array<unsigned int, 3> cell(std::size_t global_index) const
+  {
+    return {{static_cast<unsigned int>(global_index % _n[0]),
+             static_cast<unsigned int>(global_index / _n[0] % _n[1]),
+             static_cast<unsigned int>(global_index / (std::size_t(_n[0]) * _n[1]))}};
+  }
+
+  std::size_t globalIndex(const std::array<unsigned int, 3> & ijk) const
+  {
+    return (std::size_t(ijk[2]) * _n[1] + ijk[1]) * _n[0] + ijk[0];
+  }
+
+  /// The index within the box of a cell of the box
+  std::size_t localIndex(const std::array<unsigned int, 3> & ijk) const
+  {
+    mooseAssert(_box.contains(ijk), "The EBSD cell is not in the local box");
+    const unsigned int nx = _box.end[0] - _box.begin[0];
+    const unsigned int ny = _box.end[1] - _box.begin[1];
+    return (std::size_t(ijk[2] - _box.begin[2]) * ny + (ijk[1] - _box.begin[1])) * nx +
+           (ijk[0] - _box.begin[0]);
+  }
+
+  /// The number of cells of the whole grid
+  std::size_t globalSize() const { return std::size_t(_n[0]) * _n[1] * _n[2]; }
+
+private:
+  std::array<unsigned int, 3> _n = {{1, 1, 1}};
+  std::array<Real, 3> _min = {{0, 0, 0}};
+  std::array<Real, 3> _spacing = {{1, 1, 1}};
+  Box _box;
+};
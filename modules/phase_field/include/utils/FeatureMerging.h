@@ -0,0 +1,110 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/dof_object.h"
+
+#include <numeric>
+#include <vector>
+
+/**
+ * The building blocks of the distributed merge of the partial features of FeatureFloodCount.
+ */
+namespace FeatureMerging
+{
+/**
+ * Union-find over the partial features of a map, with path halving and union by size: the
+ * mergeable pairs are united once each, and the merged features are the sets, instead of merging
+ * feature pairs repeatedly until no pair is mergeable.
+ */
+class DisjointSets
+{
+public:
+  explicit DisjointSets(std::size_t n = 0) { reset(n); }
+
+  /// Makes \p n singletons
+  void reset(std::size_t n)
+  {
+    _parent.resize(n);
+    std::iota(_parent.begin(), _parent.end(), 0);
+    _size.assign(n, 1);
+  }
+
+  /// The representative of the set of \p i
+  std::size_t find(std::size_t i)
+  {
+    while (_parent[i] != i)
+    {
+      _parent[i] = _parent[_parent[i]];
+      i = _parent[i];
+    }
+    return i;
+  }
+
+  /// Unites the sets of \p a and \p b; returns whether they were distinct
+  bool unite(std::size_t a, std::size_t b)
+  {
+    a = find(a);
+    b = find(b);
+    if (a == b)
+      return false;
+    if (_size[a] < _size[b])
+      std::swap(a, b);
+    _parent[b] = a;
+    _size[a] += _size[b];
+    return true;
+  }
+
+  std::size_t size() const { return _parent.size(); }
+
+private:
+  std::vector<std::size_t> _parent;
+  std::vector<std::size_t> _size;
+};
+
+/**
+ * The binomial tree of the parallel merge: at round r, the ranks with bit r set (and lower bits
+ * clear) send their merged features to rank - 2^r, which merges them with its own, so that after
+ * ceil(log2(n_procs)) rounds rank 0 holds all the features; each rank merges at most log2 times
+ * instead of the root merging the features of every rank.
+ */
+inline unsigned int
+numRounds(processor_id_type n_procs)
+{
+  unsigned int rounds = 0;
+  while ((processor_id_type(1) << rounds) < n_procs)
+    ++rounds;
+  return rounds;
+}
+
+/**
+ * The partner of a rank at a round of the merge tree
+ * @param rank The rank
+ * @param round The round, from 0
+ * @param n_procs The number of ranks
+ * @param sends Whether the rank sends to its partner (true) or receives from it (false)
+ * @return The partner, or DofObject::invalid_processor_id when the rank is idle at the round
+ */
+inline processor_id_type
+mergePartner(processor_id_type rank, unsigned int round, processor_id_type n_procs, bool & sends)
+{
+  const processor_id_type step = processor_id_type(1) << round;
+  // Ranks that sent at an earlier round are done
+  if (rank % step)
+    return DofObject::invalid_processor_id;
+
+  sends = rank & step;
+  if (sends)
+    return rank - step;
+  return rank + step < n_procs ? rank + step : DofObject::invalid_processor_id;
+}
+}
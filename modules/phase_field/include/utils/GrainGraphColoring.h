@@ -0,0 +1,114 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "CompressedAdjacency.h"
+
+#include "libmesh/threads.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace GrainGraphColoring
+{
+/// Color of the grains that are not colored yet
+static const unsigned int UNCOLORED = std::numeric_limits<unsigned int>::max();
+
+/**
+ * Greedy coloring of the grain adjacency graph in parallel rounds (Jones-Plassmann): every grain
+ * gets a pseudo-random priority, and in each round the uncolored grains whose priority beats that
+ * of all their uncolored neighbors take the smallest color none of their neighbors has. These
+ * grains are never adjacent, so a round colors all of them at once with the thread pool, and the
+ * result does not depend on the number of threads.
+ *
+ * Unlike the back-tracking coloring, the number of colors is not bounded beforehand: it is at most
+ * the maximum number of neighbors plus one, and the caller checks it against the number of order
+ * parameters.
+ *
+ * @param adjacency The neighbors of each grain (symmetric, without self-adjacency)
+ * @param seed The seed of the priorities
+ * @return The color of each grain
+ */
+inline std::vector<unsigned int>
+color(const CompressedAdjacency<unsigned int> & adjacency, unsigned int seed = 0)
+{
+  const unsigned int n = adjacency.numIds();
+  std::vector<unsigned int> colors(n, UNCOLORED);
+
+  // splitmix64, with the grain id breaking ties so the order is strict
+  const auto priority = [seed](unsigned int v)
+  {
+    std::uint64_t z = (std::uint64_t(v) << 32 | seed) + 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return std::make_pair(z ^ (z >> 31), v);
+  };
+
+  std::vector<unsigned int> remaining(n);
+  for (unsigned int v = 0; v < n; ++v)
+    remaining[v] = v;
+  std::vector<char> wins(n, 0);
+
+  while (!remaining.empty())
+  {
+    const Threads::BlockedRange<std::size_t> range(0, remaining.size());
+
+    // The winners of the round, from the colors of the previous rounds only
+    Threads::parallel_for(range,
+                          [&](const Threads::BlockedRange<std::size_t> & r)
+                          {
+                            for (auto i = r.begin(); i != r.end(); ++i)
+                            {
+                              const auto v = remaining[i];
+                              const auto pv = priority(v);
+                              bool win = true;
+                              for (const auto u : adjacency.row(v))
+                                if (colors[u] == UNCOLORED && priority(u) > pv)
+                                {
+                                  win = false;
+                                  break;
+                                }
+                              wins[v] = win;
+                            }
+                          });
+
+    // The smallest color free among the neighbors of each winner, none of them being a winner
+    Threads::parallel_for(range,
+                          [&](const Threads::BlockedRange<std::size_t> & r)
+                          {
+                            std::vector<char> used;
+                            for (auto i = r.begin(); i != r.end(); ++i)
+                            {
+                              const auto v = remaining[i];
+                              if (!wins[v])
+                                continue;
+                              const auto row = adjacency.row(v);
+                              used.assign(row.size() + 1, 0);
+                              for (const auto u : row)
+                                if (colors[u] < used.size())
+                                  used[colors[u]] = 1;
+                              unsigned int c = 0;
+                              while (used[c])
+                                ++c;
+                              colors[v] = c;
+                            }
+                          });
+
+    std::size_t k = 0;
+    for (const auto v : remaining)
+      if (!wins[v])
+        remaining[k++] = v;
+    remaining.resize(k);
+  }
+
+  return colors;
+}
+}
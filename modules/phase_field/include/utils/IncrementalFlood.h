@@ -0,0 +1,94 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+/**
+ * The bookkeeping of the incremental flood of GrainTracker: grains move by a few elements per
+ * step, so only the entities whose order parameter crossed the threshold since the previous step
+ * (the "dirty" entities) can change the features. The previous features that contain or border a
+ * dirty entity are flooded again, seeded from their previous entities; every other feature is
+ * kept as it was.
+ *
+ * All the id ranges are sorted, as the FeatureData containers are.
+ */
+namespace IncrementalFlood
+{
+/**
+ * The entities whose state changed between two steps
+ * @param old_above The entities above the threshold at the previous step
+ * @param new_above The entities above the threshold now
+ * @return The entities in exactly one of the two
+ */
+template <typename Container>
+std::vector<dof_id_type>
+crossings(const Container & old_above, const Container & new_above)
+{
+  std::vector<dof_id_type> dirty;
+  std::set_symmetric_difference(old_above.begin(),
+                                old_above.end(),
+                                new_above.begin(),
+                                new_above.end(),
+                                std::back_inserter(dirty));
+  return dirty;
+}
+
+/// Whether two sorted ranges share an id
+template <typename Container>
+bool
+intersects(const Container & ids, const std::vector<dof_id_type> & dirty)
+{
+  auto a = ids.begin();
+  auto b = dirty.begin();
+  while (a != ids.end() && b != dirty.end())
+  {
+    if (*a < *b)
+      ++a;
+    else if (*b < *a)
+      ++b;
+    else
+      return true;
+  }
+  return false;
+}
+
+/**
+ * Whether a previous feature must be flooded again: it holds or borders a dirty entity
+ * @param local_ids The entities of the feature
+ * @param halo_ids The halo of the feature, the entities bordering it
+ * @param dirty The dirty entities of the variable of the feature
+ */
+template <typename Container>
+bool
+isAffected(const Container & local_ids,
+           const Container & halo_ids,
+           const std::vector<dof_id_type> & dirty)
+{
+  return intersects(local_ids, dirty) || intersects(halo_ids, dirty);
+}
+
+/**
+ * Whether flooding everything is cheaper than the incremental flood: past some fraction of
+ * dirty entities, most features are affected anyway and the bookkeeping is wasted
+ * @param n_dirty The number of dirty entities, over all the variables
+ * @param n_entities The number of entities, over all the variables
+ * @param max_fraction The largest dirty fraction flooded incrementally
+ */
+inline bool
+fullFloodIsCheaper(std::size_t n_dirty, std::size_t n_entities, Real max_fraction)
+{
+  return n_entities == 0 || n_dirty > max_fraction * n_entities;
+}
+}
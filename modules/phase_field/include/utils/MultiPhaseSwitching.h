@@ -0,0 +1,147 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * The switching functions of every phase of a multi-phase, multi-order parameter system
+ * (Moelans, Acta Mat., v 59, p.1077-1086 (2011))
+ * \f$ h_\alpha = (\sum_{i \in \alpha} \eta_i^2) / (\sum_i \eta_i^2) \f$,
+ * the barrier \f$ g = \sum_i \eta_i^2(1-\eta_i)^2 \f$ and their first and second derivatives,
+ * evaluated in one pass at a point: the sums, their inverse and the h of every phase are computed
+ * once and shared by all the derivatives, where one SwitchingFunctionMultiPhaseMaterial per phase
+ * recomputes them for each phase.
+ *
+ * With \f$ S = \sum_i \eta_i^2 \f$,
+ * \f$ \partial h_\alpha / \partial \eta_k = 2 \eta_k (\delta_{k\alpha} - h_\alpha) / S \f$ and
+ * \f$ \partial^2 h_\alpha / \partial \eta_k \partial \eta_l = (2 \delta_{kl} (\delta_{k\alpha} -
+ * h_\alpha) - 2 \eta_k \partial_l h_\alpha - 2 \eta_l \partial_k h_\alpha) / S \f$,
+ * where \f$ \delta_{k\alpha} \f$ is one when \f$ \eta_k \f$ belongs to phase \f$ \alpha \f$.
+ */
+class MultiPhaseSwitching
+{
+public:
+  /**
+   * @param phase_of_eta The phase of each order parameter
+   * @param num_phases The number of phases
+   * @param well_only Whether the barrier is zero for the order parameters within [0:1]
+   */
+  MultiPhaseSwitching(const std::vector<unsigned int> & phase_of_eta,
+                      unsigned int num_phases,
+                      bool well_only = false)
+    : _phase_of_eta(phase_of_eta),
+      _num_eta(phase_of_eta.size()),
+      _num_phases(num_phases),
+      _well_only(well_only),
+      _h(num_phases),
+      _dh(num_phases * _num_eta),
+      _d2h(num_phases * _num_eta * _num_eta),
+      _dg(_num_eta),
+      _d2g(_num_eta)
+  {
+  }
+
+  /// Evaluates everything at the values \p eta of the order parameters
+  void compute(const std::vector<Real> & eta)
+  {
+    Real sum = 0;
+    for (unsigned int i = 0; i < _num_eta; ++i)
+      sum += eta[i] * eta[i];
+    // The switching functions are undefined where every order parameter vanishes
+    const Real inv_sum = sum > 0 ? 1 / sum : 0;
+
+    std::fill(_h.begin(), _h.end(), 0);
+    for (unsigned int i = 0; i < _num_eta; ++i)
+      _h[_phase_of_eta[i]] += eta[i] * eta[i] * inv_sum;
+
+    for (unsigned int a = 0; a < _num_phases; ++a)
+      for (unsigned int k = 0; k < _num_eta; ++k)
+        _dh[a * _num_eta + k] = 2 * eta[k] * (delta(k, a) - _h[a]) * inv_sum;
+
+    for (unsigned int a = 0; a < _num_phases; ++a)
+      for (unsigned int k = 0; k < _num_eta; ++k)
+        for (unsigned int l = k; l < _num_eta; ++l)
+        {
+          Real d2 = -2 * eta[k] * dh(a, l) - 2 * eta[l] * dh(a, k);
+          if (k == l)
+            d2 += 2 * (delta(k, a) - _h[a]);
+          _d2h[(a * _num_eta + k) * _num_eta + l] = _d2h[(a * _num_eta + l) * _num_eta + k] =
+              d2 * inv_sum;
+        }
+
+    _g = 0;
+    for (unsigned int i = 0; i < _num_eta; ++i)
+    {
+      const Real e = eta[i];
+      if (_well_only && e >= 0 && e <= 1)
+      {
+        _dg[i] = _d2g[i] = 0;
+        continue;
+      }
+      _g += e * e * (1 - e) * (1 - e);
+      _dg[i] = 2 * e * (1 - e) * (1 - 2 * e);
+      _d2g[i] = 2 * (1 - 6 * e + 6 * e * e);
+    }
+  }
+
+  ///@{ The values of the last compute()
+  Real h(unsigned int phase) const { return _h[phase]; }
+  Real dh(unsigned int phase, unsigned int k) const { return _dh[phase * _num_eta + k]; }
+  Real d2h(unsigned int phase, unsigned int k, unsigned int l) const
+  {
+    return _d2h[(phase * _num_eta + k) * _num_eta + l];
+  }
+  Real g() const { return _g; }
+  Real dg(unsigned int k) const { return _dg[k]; }
+  /// The barrier is a sum of one-variable terms: its mixed derivatives vanish
+  Real d2g(unsigned int k, unsigned int l) const { return k == l ? _d2g[k] : 0; }
+  ///@}
+
+  /**
+   * The total free energy \f$ \sum_\alpha h_\alpha F_\alpha + W g \f$ from the free energies of
+   * the phases, and its derivative with respect to an order parameter
+   */
+  Real freeEnergy(const std::vector<Real> & F, Real W) const
+  {
+    Real f = W * _g;
+    for (unsigned int a = 0; a < _num_phases; ++a)
+      f += _h[a] * F[a];
+    return f;
+  }
+  Real dFreeEnergy(const std::vector<Real> & F, Real W, unsigned int k) const
+  {
+    Real df = W * _dg[k];
+    for (unsigned int a = 0; a < _num_phases; ++a)
+      df += _dh[a * _num_eta + k] * F[a];
+    return df;
+  }
+
+  unsigned int numEta() const { return _num_eta; }
+  unsigned int numPhases() const { return _num_phases; }
+
+private:
+  Real delta(unsigned int k, unsigned int phase) const { return _phase_of_eta[k] == phase; }
+
+  const std::vector<unsigned int> _phase_of_eta;
+  const unsigned int _num_eta;
+  const unsigned int _num_phases;
+  const bool _well_only;
+
+  std::vector<Real> _h;
+  std::vector<Real> _dh;
+  std::vector<Real> _d2h;
+  Real _g = 0;
+  std::vector<Real> _dg;
+  std::vector<Real> _d2g;
+};
@@ -60,7 +60,11 @@ protected:
   /// 0.5*(length of polyline segments between points)
   std::vector<Real> _half_seg_len;
 
-  /// Add Dirac Points to the line sink
+  /**
+   * Add Dirac Points to the line sink, each with its index as id: DiracKernel then reuses the
+   * element cached for the id (see DiracKernel::addPoint(Point, unsigned)) while the element
+   * still contains the point, so a borehole that does not move is not located again every step
+   */
   virtual void addPoints() override;
 
   /// regenerate points in each cell if using line_base
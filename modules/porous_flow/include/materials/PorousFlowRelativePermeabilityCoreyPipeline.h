@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowPropertyBuffer.h"
+
+/**
+ * Fused property pipeline for the Corey relative permeabilities of all phases: replaces one
+ * PorousFlowRelativePermeabilityCorey per phase and the PorousFlowJoiner of
+ * "PorousFlow_relative_permeability". computeProperties() evaluates the effective saturation,
+ * the relative permeability and its derivatives with respect to the PorousFlow variables for
+ * every phase and point of the element in one pass into a PorousFlowPropertyBuffer, then writes
+ * the joined properties, which the PorousFlow kernels consume unchanged.
+ *
+ * As PorousFlowJoiner, the properties are nodal unless at_nodes = false.
+ */
+class PorousFlowRelativePermeabilityCoreyPipeline : public PorousFlowMaterialVectorBase
+{
+public:
+  static InputParameters validParams();
+
+  PorousFlowRelativePermeabilityCoreyPipeline(const InputParameters & parameters);
+
+protected:
+  virtual void computeProperties() override;
+  virtual void computeQpProperties() override;
+
+  /// The Corey exponent of each phase
+  const std::vector<Real> _n;
+
+  /// The residual saturation of each phase
+  const std::vector<Real> _s_res;
+
+  /// The sum of the residual saturations
+  const Real _sum_s_res;
+
+  /// The relative permeabilities are multiplied by this quantity
+  const Real _scaling;
+
+  /// Saturation of each phase at the nodes or qps
+  const MaterialProperty<std::vector<Real>> & _saturation;
+
+  /// Derivatives of the saturations wrt the PorousFlow variables
+  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+
+  /// The joined relative permeabilities
+  MaterialProperty<std::vector<Real>> & _relative_permeability;
+
+  /// d(relative permeability)/d(PorousFlow variable)
+  MaterialProperty<std::vector<std::vector<Real>>> & _drelative_permeability_dvar;
+
+  /// The element buffer
+  PorousFlowPropertyBuffer _buffer;
+};
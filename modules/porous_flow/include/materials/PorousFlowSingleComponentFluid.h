@@ -28,6 +28,12 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
+  /**
+   * Evaluates the fluid properties at all the quadpoints or nodes of the element with batched
+   * fluid property calls instead of once per point
+   */
+  virtual void computeProperties() override;
+
   /// Unit used for porepressure
   const enum class PressureUnitEnum { Pa, MPa } _p_unit;
 
@@ -87,4 +93,9 @@ protected:
 
   /// Fluid properties UserObject
   const SinglePhaseFluidProperties & _fp;
+
+  ///@{ Pressure (Pa) and temperature (K) of every point of the element, for the batched calls
+  std::vector<Real> _batch_p;
+  std::vector<Real> _batch_T;
+  ///@}
 };
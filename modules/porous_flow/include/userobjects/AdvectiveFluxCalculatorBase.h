@@ -11,6 +11,7 @@
 
 #include "ElementUserObject.h"
 #include "PorousFlowConnectedNodes.h"
+#include "PorousFlowConnectionsCSR.h"
 
 /**
  * Base class to compute Advective fluxes.  Specifically,
@@ -90,6 +91,26 @@ public:
    */
   unsigned getValence(dof_id_type node_i) const;
 
+  /// Whether the Kuzmin-Turek quantities are stored in the flat arrays ("flat_storage")
+  bool flatStorage() const { return _flat_storage; }
+
+  /// The CSR indexing of the flat arrays
+  const PorousFlowConnectionsCSR & connectionsCSR() const { return _csr; }
+
+  /**
+   * The flat version of getdFluxOutdu(): r[k] = d(flux out of global node i)/du(sequential node
+   * connectionsCSR().ringNodes(node_i)[k]), connectionsCSR().ringSize(node_i) of them
+   * @param node_i global id of node
+   */
+  const Real * getdFluxOutduFlat(dof_id_type node_i) const;
+
+  /**
+   * The flat version of getdFluxOutdKjk(): r[connectionsCSR().triple(sequential_i, j, k) -
+   * connectionsCSR().triple(sequential_i, 0, 0)] = d(flux out of global node i)/dK[j][k]
+   * @param node_i global id of node
+   */
+  const Real * getdFluxOutdKjkFlat(dof_id_type node_i) const;
+
 protected:
   /**
    * When using multiple processors, other processors will compute:
@@ -101,6 +122,12 @@ protected:
    */
   virtual void buildCommLists();
 
+  /**
+   * Builds _csr from _connections and sizes the flat arrays; called with the resizing of the
+   * nested ones when flat storage is used
+   */
+  void buildFlatStorage();
+
   /**
    * Sends and receives multi-processor information regarding u_nodal and k_ij.
    * See buildCommLists for some more explanation.
@@ -175,6 +202,27 @@ protected:
   /// _flux_out[i] = flux of "heat" from sequential node i
   std::vector<Real> _flux_out;
 
+  /// Whether the flat arrays below are used instead of the nested containers
+  const bool _flat_storage;
+
+  /// The offsets of the pairs, triples and rings of the flat arrays, built from _connections
+  PorousFlowConnectionsCSR _csr;
+
+  /// _kij_flat[_csr.pair(i, j)] = _kij[i][j]; threadJoin() sums these contiguously
+  std::vector<Real> _kij_flat;
+
+  /// _dflux_out_du_flat[_csr.ring(i, k)] = d(flux_out[i])/d(u[sequential k])
+  std::vector<Real> _dflux_out_du_flat;
+
+  /// _dflux_out_dKjk_flat[_csr.triple(i, j, k)] = _dflux_out_dKjk[i][j][k]
+  std::vector<Real> _dflux_out_dKjk_flat;
+
+  ///@{ The pair-indexed quantities of finalize(), flat: _lij_flat[_csr.pair(i, j)] = _lij[i][j]
+  std::vector<Real> _dij_flat;
+  std::vector<Real> _lij_flat;
+  std::vector<Real> _fa_flat;
+  ///@}
+
   /// _dflux_out_du[i][j] = d(flux_out[i])/d(u[j]).
   /// Here i is a sequential node number according to the _connections object, and j (global ID) must be connected to i, or to a node that is connected to i.
   std::vector<std::map<dof_id_type, Real>> _dflux_out_du;
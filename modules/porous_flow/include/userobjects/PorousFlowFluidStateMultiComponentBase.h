@@ -10,6 +10,7 @@
 #pragma once
 
 #include "PorousFlowFluidStateFlash.h"
+#include "PorousFlowEquilibriumCache.h"
 
 /**
  * Compositional flash routines for miscible multiphase flow classes with multiple
@@ -69,7 +70,46 @@ public:
   unsigned int getZIndex() const { return _Zidx; };
   unsigned int getXIndex() const { return _Xidx; };
 
+  /// The reuse of the equilibrium mass fractions ("equilibrium_reuse": none, cache or table)
+  const PorousFlowEquilibriumCache & equilibriumCache() const { return _equilibrium_cache; }
+
 protected:
+  /**
+   * The equilibrium mass fractions through _equilibrium_cache: the values and their derivatives
+   * wrt the pressure, temperature and salt mass fraction, chained with the derivatives of the
+   * DualReal inputs
+   * @param pressure gas pressure (Pa)
+   * @param temperature temperature (K)
+   * @param Xnacl NaCl mass fraction (kg/kg), zero for the models without salt
+   * @param compute computes the values and derivatives at a point, for the misses
+   * @param[out] X mass fraction of the gas component in the liquid (kg/kg)
+   * @param[out] Y mass fraction of H2O in the gas (kg/kg)
+   */
+  template <typename Compute>
+  void reusedEquilibriumMassFractions(const DualReal & pressure,
+                                      const DualReal & temperature,
+                                      const DualReal & Xnacl,
+                                      const Compute & compute,
+                                      DualReal & X,
+                                      DualReal & Y) const
+  {
+    PorousFlowEquilibriumCache::Sample sample;
+    _equilibrium_cache.evaluate(
+        {{pressure.value(), temperature.value(), Xnacl.value()}}, compute, sample);
+
+    DualReal * const outputs[2] = {&X, &Y};
+    for (unsigned int v = 0; v < 2; ++v)
+    {
+      *outputs[v] = sample.value[v];
+      outputs[v]->derivatives() = pressure.derivatives() * sample.deriv[v][0] +
+                                  temperature.derivatives() * sample.deriv[v][1] +
+                                  Xnacl.derivatives() * sample.deriv[v][2];
+    }
+  }
+
+  /// Sets up _equilibrium_cache from the parameters; called by the derived constructors
+  void setupEquilibriumReuse();
+
   /// Index of derivative wrt pressure
   const unsigned int _pidx;
   /// Index of derivative wrt total mass fraction Z
@@ -78,4 +118,10 @@ protected:
   const unsigned int _Tidx;
   /// Index of derivative wrt salt mass fraction X
   const unsigned int _Xidx;
+
+  /// Whether and how the equilibrium mass fractions are reused
+  const MooseEnum _equilibrium_reuse;
+
+  /// The reused equilibrium mass fractions
+  PorousFlowEquilibriumCache _equilibrium_cache;
 };
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "GeneralUserObject.h"
+#include "MooseTypes.h"
 
 /**
  * Sums into _total
@@ -17,6 +18,9 @@
  * flowing into a borehole.
  * This is a suboptimal setup because it requires a const_cast
  * of a PorousFlowSumQuantity object in order to do the summing
+ *
+ * The contributions are accumulated into one slot per thread, so the threads of a Dirac loop
+ * evaluating a borehole never write to the same location; the slots are summed by finalize()
  */
 class PorousFlowSumQuantity : public GeneralUserObject
 {
@@ -26,7 +30,7 @@ public:
   PorousFlowSumQuantity(const InputParameters & parameters);
   virtual ~PorousFlowSumQuantity();
 
-  /// Sets _total = 0
+  /// Sets _total and the per-thread totals to 0
   void zero();
 
   /**
@@ -35,13 +39,24 @@ public:
    */
   void add(Real contrib);
 
+  /**
+   * Adds contrib to the total of thread tid
+   * @param contrib the amount to add
+   * @param tid the thread adding it
+   */
+  void add(Real contrib, THREAD_ID tid)
+  {
+    mooseAssert(tid < _thread_totals.size(), "No accumulation slot for thread " << tid);
+    _thread_totals[tid] += contrib;
+  }
+
   /// Does nothing
   virtual void initialize() override;
 
   /// Does nothing
   virtual void execute() override;
 
-  /// Does MPI gather on _total
+  /// Adds the per-thread totals into _total, then does MPI gather on _total
   virtual void finalize() override;
 
   /// Returns _total
@@ -50,4 +65,7 @@ public:
 protected:
   /// This holds the sum
   Real _total;
+
+  /// The contributions of each thread not yet added to _total (sized libMesh::n_threads())
+  std::vector<Real> _thread_totals;
 };
@@ -0,0 +1,128 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Compressed sparse row indexing of the nodal connectivity of a PorousFlowConnectedNodes object
+ * (sequential node IDs), so that the Kuzmin-Turek quantities of AdvectiveFluxCalculatorBase are
+ * stored in flat std::vector<Real> rather than nested vectors and maps:
+ *  - pair(i, j): the j^th connection of node i, as in _kij[i][j]
+ *  - triple(i, j, k): the k^th connection of the j^th connection of node i, as in
+ *    _dflux_out_dKjk[i][j][k]
+ *  - ring(i, k): node k among the nodes connected to i or to a node connected to i (sorted), as
+ *    the keys of _dflux_out_du[i]
+ * All the offsets are computed once in build(), when the connectivity changes.
+ */
+class PorousFlowConnectionsCSR
+{
+public:
+  /**
+   * Builds the offsets
+   * @param num_nodes The number of sequential nodes
+   * @param connections connections(i) is the vector of sequential nodes connected to node i
+   */
+  template <typename Connections>
+  void build(std::size_t num_nodes, const Connections & connections)
+  {
+    _pair_offsets.assign(num_nodes + 1, 0);
+    for (std::size_t i = 0; i < num_nodes; ++i)
+      _pair_offsets[i + 1] = _pair_offsets[i] + connections(i).size();
+
+    _neighbors.resize(_pair_offsets[num_nodes]);
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+      const auto & neighbors = connections(i);
+      std::copy(neighbors.begin(), neighbors.end(), _neighbors.begin() + _pair_offsets[i]);
+    }
+
+    _triple_offsets.assign(numPairs() + 1, 0);
+    for (std::size_t p = 0; p < numPairs(); ++p)
+      _triple_offsets[p + 1] = _triple_offsets[p] + numConnections(_neighbors[p]);
+
+    _ring_offsets.assign(num_nodes + 1, 0);
+    _ring.clear();
+    std::vector<dof_id_type> ring;
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+      ring.assign(_neighbors.begin() + _pair_offsets[i], _neighbors.begin() + _pair_offsets[i + 1]);
+      for (auto p = _pair_offsets[i]; p < _pair_offsets[i + 1]; ++p)
+      {
+        const auto j = _neighbors[p];
+        ring.insert(ring.end(),
+                    _neighbors.begin() + _pair_offsets[j],
+                    _neighbors.begin() + _pair_offsets[j + 1]);
+      }
+      std::sort(ring.begin(), ring.end());
+      ring.erase(std::unique(ring.begin(), ring.end()), ring.end());
+      _ring.insert(_ring.end(), ring.begin(), ring.end());
+      _ring_offsets[i + 1] = _ring.size();
+    }
+  }
+
+  std::size_t numNodes() const { return _pair_offsets.empty() ? 0 : _pair_offsets.size() - 1; }
+
+  ///@{ The connections of node i
+  std::size_t numConnections(dof_id_type i) const
+  {
+    return _pair_offsets[i + 1] - _pair_offsets[i];
+  }
+  dof_id_type connection(dof_id_type i, unsigned int j) const { return _neighbors[pair(i, j)]; }
+  ///@}
+
+  ///@{ The flat indices and sizes
+  std::size_t pair(dof_id_type i, unsigned int j) const
+  {
+    mooseAssert(j < numConnections(i), "Node " << i << " has no connection " << j);
+    return _pair_offsets[i] + j;
+  }
+  std::size_t numPairs() const { return _neighbors.size(); }
+
+  std::size_t triple(dof_id_type i, unsigned int j, unsigned int k) const
+  {
+    return _triple_offsets[pair(i, j)] + k;
+  }
+  std::size_t numTriples() const { return _triple_offsets.empty() ? 0 : _triple_offsets.back(); }
+
+  /// The start of the ring of node i: ring(i, k) is ringBegin(i) + the position of k in it
+  std::size_t ringBegin(dof_id_type i) const { return _ring_offsets[i]; }
+  std::size_t ringSize(dof_id_type i) const { return _ring_offsets[i + 1] - _ring_offsets[i]; }
+  std::size_t ring(dof_id_type i, dof_id_type k) const
+  {
+    const auto begin = _ring.begin() + _ring_offsets[i], end = _ring.begin() + _ring_offsets[i + 1];
+    const auto it = std::lower_bound(begin, end, k);
+    mooseAssert(it != end && *it == k, "Node " << k << " is not in the ring of node " << i);
+    return it - _ring.begin();
+  }
+  /// The nodes of the ring of node i, ringSize(i) of them
+  const dof_id_type * ringNodes(dof_id_type i) const { return _ring.data() + _ring_offsets[i]; }
+  std::size_t numRing() const { return _ring.size(); }
+  ///@}
+
+  /// The memory of the offsets and indices, in bytes
+  std::size_t bytes() const
+  {
+    return (_pair_offsets.size() + _triple_offsets.size() + _ring_offsets.size()) *
+               sizeof(std::size_t) +
+           (_neighbors.size() + _ring.size()) * sizeof(dof_id_type);
+  }
+
+private:
+  std::vector<std::size_t> _pair_offsets;
+  std::vector<dof_id_type> _neighbors;
+  std::vector<std::size_t> _triple_offsets;
+  std::vector<std::size_t> _ring_offsets;
+  std::vector<dof_id_type> _ring;
+};
@@ -0,0 +1,294 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/threads.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Reuse of the equilibrium mass fractions of a fluid state (the two mutual solubilities, which
+ * only depend on the pressure, temperature and salt mass fraction, not on the total mass
+ * fraction Z) between the qps, nodes and residual evaluations of a simulation. Their evaluation
+ * (fugacity coefficients, iterative at high temperature) dominates the flash, and in large runs
+ * most points revisit states already evaluated.
+ *
+ * Two modes:
+ *  - CACHE: the inputs are quantized onto cells of the given sizes; the evaluation at the centre
+ *    of a cell is stored with its derivatives the first time the cell is visited, and the points
+ *    of the cell get its first order Taylor expansion, so the error is second order in the cell
+ *    size and the results do not depend on the order in which the points are visited. The cells
+ *    are spread over shards with a lock each, and a shard holding more than its share of the
+ *    maximum number of cells is emptied before growing further.
+ *  - TABLE: the values are tabulated once on a regular grid over a range and interpolated
+ *    trilinearly, and the derivatives are those of the interpolant, so that they are consistent
+ *    with the values; the points outside the range are evaluated directly.
+ *
+ * The evaluation is a functor compute(x, sample) filling the values and their derivatives with
+ * respect to the three inputs at x.
+ */
+class PorousFlowEquilibriumCache
+{
+public:
+  /// The inputs: pressure, temperature and salt mass fraction
+  typedef std::array<Real, 3> Inputs;
+
+  /// The two equilibrium mass fractions and their derivatives wrt the inputs
+  struct Sample
+  {
+    std::array<Real, 2> value;
+    std::array<Inputs, 2> deriv;
+  };
+
+  enum Mode
+  {
+    NONE,
+    CACHE,
+    TABLE
+  };
+
+  Mode mode() const { return _mode; }
+
+  /**
+   * Reuses evaluations within cells of the given sizes
+   * @param cell_size The sizes of the cells in each input
+   * @param max_cells The maximum number of cells stored
+   */
+  void useCache(const Inputs & cell_size, std::size_t max_cells = 1 << 20)
+  {
+    for (const auto h : cell_size)
+      if (h <= 0)
+        mooseError("The cells of the equilibrium cache must have positive sizes");
+    _mode = CACHE;
+    _cell_size = cell_size;
+    _max_cells_per_shard = std::max(max_cells / NUM_SHARDS, std::size_t(1));
+    for (auto & shard : _shards)
+    {
+      libMesh::Threads::spin_mutex::scoped_lock lock(shard.mutex);
+      shard.cells.clear();
+    }
+  }
+
+  /**
+   * Tabulates the evaluations on a grid
+   * @param lower The lowest inputs of the table
+   * @param upper The highest inputs of the table
+   * @param n The number of intervals in each input (at least 1)
+   * @param compute The evaluation
+   */
+  template <typename Compute>
+  void useTable(const Inputs & lower,
+                const Inputs & upper,
+                const std::array<unsigned int, 3> & n,
+                const Compute & compute)
+  {
+    for (unsigned int d = 0; d < 3; ++d)
+      if (n[d] == 0 || !(upper[d] >= lower[d]))
+        mooseError("Invalid range of the equilibrium table in input ", d);
+    _mode = TABLE;
+    _lower = lower;
+    _upper = upper;
+    _n = n;
+
+    _table.resize(std::size_t(n[0] + 1) * (n[1] + 1) * (n[2] + 1));
+    Inputs x;
+    for (unsigned int k = 0; k <= n[2]; ++k)
+      for (unsigned int j = 0; j <= n[1]; ++j)
+        for (unsigned int i = 0; i <= n[0]; ++i)
+        {
+          const unsigned int index[3] = {i, j, k};
+          for (unsigned int d = 0; d < 3; ++d)
+            x[d] = lower[d] + (upper[d] - lower[d]) * index[d] / n[d];
+          compute(x, _table[tableIndex(i, j, k)]);
+        }
+  }
+
+  /// Evaluates at \p x, reusing the stored evaluations when the mode allows
+  template <typename Compute>
+  void evaluate(const Inputs & x, const Compute & compute, Sample & sample) const
+  {
+    if (_mode == CACHE)
+      evaluateCached(x, compute, sample);
+    else if (_mode == TABLE && inTable(x))
+      interpolate(x, sample);
+    else
+      compute(x, sample);
+  }
+
+  ///@{ The number of evaluations reused and computed by the cache
+  std::size_t hits() const { return count(&Shard::hits); }
+  std::size_t misses() const { return count(&Shard::misses); }
+  ///@}
+
+private:
+  /// The number of independently locked parts of the cache
+  static constexpr unsigned int NUM_SHARDS = 16;
+
+  /// The cell of a point
+  typedef std::array<std::int64_t, 3> CellKey;
+
+  struct CellKeyHash
+  {
+    std::size_t operator()(const CellKey & key) const
+    {
+      std::uint64_t hash = 1469598103934665603ull;
+      for (const auto k : key)
+      {
+        hash ^= std::uint64_t(k);
+        hash *= 1099511628211ull;
+      }
+      return hash;
+    }
+  };
+
+  struct Shard
+  {
+    std::unordered_map<CellKey, Sample, CellKeyHash> cells;
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    libMesh::Threads::spin_mutex mutex;
+  };
+
+  template <typename Compute>
+  void evaluateCached(const Inputs & x, const Compute & compute, Sample & sample) const
+  {
+    CellKey key;
+    Inputs centre;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      key[d] = std::int64_t(std::floor(x[d] / _cell_size[d]));
+      centre[d] = (key[d] + 0.5) * _cell_size[d];
+    }
+
+    Shard & shard = _shards[CellKeyHash()(key) % NUM_SHARDS];
+    Sample cell;
+    bool found = false;
+    {
+      libMesh::Threads::spin_mutex::scoped_lock lock(shard.mutex);
+      auto it = shard.cells.find(key);
+      if (it != shard.cells.end())
+      {
+        ++shard.hits;
+        cell = it->second;
+        found = true;
+      }
+    }
+
+    if (!found)
+    {
+      // Evaluated outside the lock: two threads may compute the same cell, with the same result
+      compute(centre, cell);
+      libMesh::Threads::spin_mutex::scoped_lock lock(shard.mutex);
+      ++shard.misses;
+      if (shard.cells.size() >= _max_cells_per_shard)
+        shard.cells.clear();
+      shard.cells.emplace(key, cell);
+    }
+
+    for (unsigned int v = 0; v < 2; ++v)
+    {
+      sample.value[v] = cell.value[v];
+      for (unsigned int d = 0; d < 3; ++d)
+        sample.value[v] += cell.deriv[v][d] * (x[d] - centre[d]);
+      sample.deriv[v] = cell.deriv[v];
+    }
+  }
+
+  /// The sum of a counter over the shards
+  std::size_t count(std::size_t Shard::*counter) const
+  {
+    std::size_t total = 0;
+    for (auto & shard : _shards)
+    {
+      libMesh::Threads::spin_mutex::scoped_lock lock(shard.mutex);
+      total += shard.*counter;
+    }
+    return total;
+  }
+
+  bool inTable(const Inputs & x) const
+  {
+    for (unsigned int d = 0; d < 3; ++d)
+      if (x[d] < _lower[d] || x[d] > _upper[d])
+        return false;
+    return true;
+  }
+
+  std::size_t tableIndex(unsigned int i, unsigned int j, unsigned int k) const
+  {
+    return (std::size_t(k) * (_n[1] + 1) + j) * (_n[0] + 1) + i;
+  }
+
+  /**
+   * The trilinear interpolant of the table and its derivatives. In an input of zero extent the
+   * interpolant is constant, so the derivative is the interpolated tabulated one.
+   */
+  void interpolate(const Inputs & x, Sample & sample) const
+  {
+    unsigned int cell[3];
+    Real t[3];
+    Real dt_dx[3];
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      const Real extent = _upper[d] - _lower[d];
+      const Real s = extent > 0 ? (x[d] - _lower[d]) / extent * _n[d] : 0;
+      cell[d] = std::min(static_cast<unsigned int>(s), _n[d] - 1);
+      t[d] = s - cell[d];
+      dt_dx[d] = extent > 0 ? _n[d] / extent : 0;
+    }
+
+    sample = Sample();
+    for (unsigned int corner = 0; corner < 8; ++corner)
+    {
+      Real factor[3];
+      Real dfactor[3];
+      unsigned int index[3];
+      for (unsigned int d = 0; d < 3; ++d)
+      {
+        const bool upper = corner & (1u << d);
+        index[d] = cell[d] + upper;
+        factor[d] = upper ? t[d] : 1 - t[d];
+        dfactor[d] = (upper ? 1 : -1) * dt_dx[d];
+      }
+      const Real weight = factor[0] * factor[1] * factor[2];
+      const Real dweight[3] = {dfactor[0] * factor[1] * factor[2],
+                               factor[0] * dfactor[1] * factor[2],
+                               factor[0] * factor[1] * dfactor[2]};
+
+      const Sample & node = _table[tableIndex(index[0], index[1], index[2])];
+      for (unsigned int v = 0; v < 2; ++v)
+      {
+        sample.value[v] += weight * node.value[v];
+        for (unsigned int d = 0; d < 3; ++d)
+          sample.deriv[v][d] +=
+              dt_dx[d] > 0 ? dweight[d] * node.value[v] : weight * node.deriv[v][d];
+      }
+    }
+  }
+
+  Mode _mode = NONE;
+
+  Inputs _cell_size;
+  std::size_t _max_cells_per_shard = 1;
+  mutable std::array<Shard, NUM_SHARDS> _shards;
+
+  Inputs _lower;
+  Inputs _upper;
+  std::array<unsigned int, 3> _n;
+  std::vector<Sample> _table;
+};
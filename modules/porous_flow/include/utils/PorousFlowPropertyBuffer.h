@@ -0,0 +1,102 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * The values of a phase-dependent property at the points (nodes or quadpoints) of an element,
+ * and their derivatives with respect to the PorousFlow variables, in two contiguous arrays:
+ * value(point, phase) and deriv(point, phase, var), var fastest. A fused material fills the
+ * buffer for the whole element in simple loops over contiguous memory, where a chain of
+ * per-phase materials and a PorousFlowJoiner fill one std::vector<std::vector<Real>> per point.
+ *
+ * copyTo() writes a point in the layout of the joined material properties, for the consumers of
+ * those properties.
+ */
+class PorousFlowPropertyBuffer
+{
+public:
+  /// Sizes the buffer for an element (reusing the memory of the previous one) and zeroes it
+  void resize(unsigned int num_points, unsigned int num_phases, unsigned int num_var)
+  {
+    _num_points = num_points;
+    _num_phases = num_phases;
+    _num_var = num_var;
+    _values.assign(std::size_t(num_points) * num_phases, 0);
+    _derivs.assign(std::size_t(num_points) * num_phases * num_var, 0);
+  }
+
+  unsigned int numPoints() const { return _num_points; }
+  unsigned int numPhases() const { return _num_phases; }
+  unsigned int numVar() const { return _num_var; }
+
+  ///@{ The value of the property of a phase at a point
+  Real & value(unsigned int point, unsigned int phase)
+  {
+    return _values[std::size_t(point) * _num_phases + phase];
+  }
+  Real value(unsigned int point, unsigned int phase) const
+  {
+    return _values[std::size_t(point) * _num_phases + phase];
+  }
+  ///@}
+
+  ///@{ The derivatives of the property of a phase at a point, num_var of them
+  Real * derivs(unsigned int point, unsigned int phase)
+  {
+    return &_derivs[(std::size_t(point) * _num_phases + phase) * _num_var];
+  }
+  const Real * derivs(unsigned int point, unsigned int phase) const
+  {
+    return &_derivs[(std::size_t(point) * _num_phases + phase) * _num_var];
+  }
+  ///@}
+
+  /**
+   * Adds the chain rule of an intermediate quantity to the derivatives of a phase at a point:
+   * deriv += dproperty_dx * dx_dvar
+   * @param dproperty_dx The derivative of the property with respect to the quantity
+   * @param dx_dvar The derivatives of the quantity with respect to the variables
+   */
+  void addChainRule(unsigned int point,
+                    unsigned int phase,
+                    Real dproperty_dx,
+                    const std::vector<Real> & dx_dvar)
+  {
+    Real * d = derivs(point, phase);
+    for (unsigned int v = 0; v < _num_var; ++v)
+      d[v] += dproperty_dx * dx_dvar[v];
+  }
+
+  /// Writes a point in the layout of the joined properties: value[phase], deriv[phase][var]
+  void copyTo(unsigned int point,
+              std::vector<Real> & value,
+              std::vector<std::vector<Real>> & deriv) const
+  {
+    value.resize(_num_phases);
+    deriv.resize(_num_phases);
+    for (unsigned int ph = 0; ph < _num_phases; ++ph)
+    {
+      value[ph] = this->value(point, ph);
+      const Real * d = derivs(point, ph);
+      deriv[ph].assign(d, d + _num_var);
+    }
+  }
+
+private:
+  unsigned int _num_points = 0;
+  unsigned int _num_phases = 0;
+  unsigned int _num_var = 0;
+  std::vector<Real> _values;
+  std::vector<Real> _derivs;
+};
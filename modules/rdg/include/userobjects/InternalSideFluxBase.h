@@ -10,6 +10,9 @@
 #pragma once
 
 #include "ThreadedGeneralUserObject.h"
+#include "RDGFlatData.h"
+#include "FEProblemBase.h"
+#include "MooseMesh.h"
 
 /**
  * A base class for computing and caching internal side flux
@@ -23,6 +26,10 @@
  *
  *   2. Derived classes need to provide computing of the fluxes and their jacobians,
  *      i.e., they need to implement `calcFlux` and `calcJacobian`.
+ *
+ *   3. With `face_based`, computeFaceFluxes() computes the fluxes of all the internal faces of
+ *      the framework FaceInfoTable in one threaded loop, stored by face row, and getFlux()
+ *      returns the stored flux of the side instead of solving the Riemann problem per call.
  */
 class InternalSideFluxBase : public ThreadedGeneralUserObject
 {
@@ -107,7 +114,24 @@ public:
                             DenseMatrix<Real> & jac1,
                             DenseMatrix<Real> & jac2) const = 0;
 
+  /**
+   * Computes the flux of every internal face of the FaceInfoTable in a threaded loop
+   * @param[in]   uvec      uvec(face, uvec1, uvec2) fills the "left" and "right" variables of the
+   *                        face of a table row, from the reconstructed and limited slopes
+   */
+  template <typename Values>
+  void computeFaceFluxes(const Values & uvec);
+
+  /// The stored flux of the face of a FaceInfoTable row, after computeFaceFluxes()
+  const Real * getFaceFlux(std::size_t face) const { return _face_fluxes[face]; }
+
 protected:
+  /// Option to compute all the face fluxes at once
+  const bool _face_based;
+
+  /// The flux of each internal face, one row per FaceInfoTable row
+  RDGFlatArray<Real> _face_fluxes;
+
   /// element ID of the cached flux values
   mutable unsigned int _cached_flux_elem_id;
   /// neighbor element ID of the cached flux values
@@ -125,3 +149,54 @@ protected:
   /// Jacobian matrix contribution to the "right" cell
   mutable DenseMatrix<Real> _jac2;
 };
+
+template <typename Values>
+void
+InternalSideFluxBase::computeFaceFluxes(const Values & uvec)
+{
+  const auto & table = _fe_problem.mesh().faceInfoTable();
+  const auto & elem_ids = table.elemID();
+  const auto & neighbor_ids = table.neighborID();
+  const auto & normals = table.normal();
+
+  // The number of components is that of the first internal face's flux
+  std::vector<Real> uvec1, uvec2, flux;
+  std::size_t first = 0;
+  while (first < table.size() && neighbor_ids[first] == DofObject::invalid_id)
+    ++first;
+  if (first == table.size())
+  {
+    _face_fluxes.resize(0, 0);
+    return;
+  }
+  uvec(first, uvec1, uvec2);
+  calcFlux(table.face(first).elemSideID(),
+           elem_ids[first],
+           neighbor_ids[first],
+           uvec1,
+           uvec2,
+           normals[first],
+           flux);
+  _face_fluxes.resize(table.size(), flux.size());
+
+  // Each face writes its own row only, so the faces are independent
+  RDG::parallelLoop(table.size(),
+                    [&](std::size_t begin, std::size_t end)
+                    {
+                      std::vector<Real> u1, u2, f;
+                      for (auto i = begin; i < end; ++i)
+                      {
+                        if (neighbor_ids[i] == DofObject::invalid_id)
+                          continue;
+                        uvec(i, u1, u2);
+                        calcFlux(table.face(i).elemSideID(),
+                                 elem_ids[i],
+                                 neighbor_ids[i],
+                                 u1,
+                                 u2,
+                                 normals[i],
+                                 f);
+                        std::copy(f.begin(), f.end(), _face_fluxes[i]);
+                      }
+                    });
+}
@@ -10,8 +10,10 @@
 #pragma once
 
 #include "ElementLoopUserObject.h"
+#include "RDGFlatData.h"
 
 // Forward Declarations
+class SlopeReconstructionBase;
 
 /**
  * Base class for slope limiting to limit
@@ -35,6 +37,15 @@ public:
   /// compute the slope of the cell
   virtual std::vector<RealGradient> limitElementSlope() const = 0;
 
+  /**
+   * The limited slopes of an element by local index of the reconstruction's element index, in
+   * the face-based path
+   */
+  const RealGradient * getElementSlopeByIndex(std::size_t index) const
+  {
+    return _flat_lslopes[index];
+  }
+
 protected:
   virtual void serialize(std::string & serialized_buffer);
   virtual void deserialize(std::vector<std::string> & serialized_buffers);
@@ -60,6 +71,24 @@ protected:
   /// the neighboring element
   const Elem * const & _neighbor_elem;
 
+  /**
+   * The face-based path, used when the reconstruction is face based: all the elements are
+   * limited in a threaded loop over the local indices of the reconstruction
+   */
+  virtual void executeFaceBased();
+
+  /**
+   * Limits the slopes of the element of a local index into its row of _flat_lslopes (defaults to
+   * limitElementSlope() on the element)
+   */
+  virtual void limitElementSlopeFlat(std::size_t index);
+
+  /// The slope reconstruction of the face-based path, nullptr for the map path
+  const SlopeReconstructionBase * _reconstruction;
+
+  /// The limited slopes of each element, indexed like the slopes of the reconstruction
+  RDGFlatArray<RealGradient> _flat_lslopes;
+
 private:
   static Threads::spin_mutex _mutex;
 };
@@ -11,6 +11,7 @@
 
 #include "BCUserObject.h"
 #include "ElementLoopUserObject.h"
+#include "RDGFlatData.h"
 
 // Forward Declarations
 
@@ -63,6 +64,24 @@ public:
 
   virtual void meshChanged();
 
+  /// Whether the slopes are kept in the flat arrays of the face-based path
+  bool faceBased() const { return _face_based; }
+
+  /// The local indices of the elements of the flat arrays
+  const RDGElementIndex & elementIndex() const { return _elem_index; }
+
+  /// The reconstructed slopes of an element by local index, in the face-based path
+  const RealGradient * getElementSlopeByIndex(std::size_t index) const
+  {
+    return _flat_slopes[index];
+  }
+
+  /// The average variable values of an element by local index, in the face-based path
+  const Real * getElementAverageValueByIndex(std::size_t index) const
+  {
+    return _flat_avars[index];
+  }
+
 protected:
   virtual void serialize(std::string & serialized_buffer);
   virtual void deserialize(std::vector<std::string> & serialized_buffers);
@@ -112,6 +131,34 @@ protected:
   /// flag to indicated if side geometry info is cached
   bool _side_geoinfo_cached;
 
+  /**
+   * The face-based path: the element averages, then the slopes of all the elements, are computed
+   * in threaded loops over the local element indices, with the side geometry of the framework
+   * FaceInfoTable instead of the cached side maps above
+   */
+  virtual void executeFaceBased();
+
+  /**
+   * Reconstructs the slopes of the element of a local index into its row of _flat_slopes, from
+   * the averages of _flat_avars (the derived classes that do not override it use the map path)
+   */
+  virtual void reconstructElementSlopeFlat(std::size_t index);
+
+  /// Rebuilds the element indices and resizes the flat arrays, after a mesh change
+  void buildFlatData();
+
+  /// Option to use the face-based path
+  const bool _face_based;
+
+  /// Local indices of the local and ghosted face neighbor elements
+  RDGElementIndex _elem_index;
+
+  /// The slopes of each element, one row per local index and a component per variable
+  RDGFlatArray<RealGradient> _flat_slopes;
+
+  /// The average variable values of each element, one row per local index
+  RDGFlatArray<Real> _flat_avars;
+
 private:
   static Threads::spin_mutex _mutex;
 };
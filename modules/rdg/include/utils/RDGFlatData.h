@@ -0,0 +1,114 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/threads.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Local indexing of the elements the rDG user objects work on (the local elements and their
+ * ghosted face neighbors), so their slopes, averages and fluxes live in flat arrays instead of
+ * std::maps keyed by element id.
+ *
+ * The map is built once per mesh change; index() is then a read-only hash lookup, safe from
+ * threads, and the loops over the elements or the faces (the rows of the framework's
+ * FaceInfoTable) address the arrays directly by local index.
+ */
+class RDGElementIndex
+{
+public:
+  /// Builds the local indices, in the order of the ids given
+  void build(const std::vector<dof_id_type> & elem_ids)
+  {
+    _ids = elem_ids;
+    _index.clear();
+    _index.reserve(_ids.size());
+    for (std::size_t i = 0; i < _ids.size(); ++i)
+      if (!_index.emplace(_ids[i], i).second)
+        mooseError("Element ", _ids[i], " is given twice to the rDG element index");
+  }
+
+  std::size_t size() const { return _ids.size(); }
+
+  /// The local index of an element
+  std::size_t index(dof_id_type elem_id) const
+  {
+    const auto it = _index.find(elem_id);
+    if (it == _index.end())
+      mooseError("Element ", elem_id, " is not in the rDG element index");
+    return it->second;
+  }
+
+  bool contains(dof_id_type elem_id) const { return _index.count(elem_id); }
+
+  /// The element id of a local index
+  dof_id_type id(std::size_t index) const { return _ids[index]; }
+
+private:
+  std::vector<dof_id_type> _ids;
+  std::unordered_map<dof_id_type, std::size_t> _index;
+};
+
+/**
+ * n_components values per row (element or face) in one contiguous array
+ */
+template <typename T>
+class RDGFlatArray
+{
+public:
+  void resize(std::size_t n_rows, unsigned int n_components, const T & value = T())
+  {
+    _n_components = n_components;
+    _data.assign(n_rows * n_components, value);
+  }
+
+  std::size_t rows() const { return _n_components ? _data.size() / _n_components : 0; }
+  unsigned int components() const { return _n_components; }
+
+  T * operator[](std::size_t row) { return &_data[row * _n_components]; }
+  const T * operator[](std::size_t row) const { return &_data[row * _n_components]; }
+
+  /// The values of a row, copied (for the accessors returning std::vector)
+  void get(std::size_t row, std::vector<T> & values) const
+  {
+    values.assign(_data.begin() + row * _n_components,
+                  _data.begin() + (row + 1) * _n_components);
+  }
+
+  /// The whole array, for the parallel exchange of the ghosted rows
+  std::vector<T> & data() { return _data; }
+  const std::vector<T> & data() const { return _data; }
+
+private:
+  unsigned int _n_components = 0;
+  std::vector<T> _data;
+};
+
+namespace RDG
+{
+/**
+ * Runs body(begin, end) over [0, n) with the thread pool. The rows of the bodies must be
+ * independent: each element or face writes only its own row of the flat arrays and reads the
+ * others, which the previous loop filled.
+ */
+template <typename Body>
+void
+parallelLoop(std::size_t n, const Body & body)
+{
+  Threads::parallel_for(Threads::BlockedRange<std::size_t>(0, n),
+                        [&body](const Threads::BlockedRange<std::size_t> & range)
+                        { body(range.begin(), range.end()); });
+}
+}
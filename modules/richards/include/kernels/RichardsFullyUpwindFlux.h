@@ -14,6 +14,7 @@
 #include "RichardsDensity.h"
 #include "RichardsRelPerm.h"
 #include "RichardsSeff.h"
+#include "RichardsPhaseData.h"
 #include "Material.h"
 
 // Forward Declarations
@@ -76,6 +77,14 @@ protected:
   /// calculates the nodal values of mobility, and derivatives thereof
   void prepareNodalValues();
 
+  /**
+   * prepareNodalValues with the batched user object calls: the nodal porepressures and
+   * effective saturations of this phase are gathered into _nodal_data, whose storage is kept
+   * between elements, then the densities and relative permeabilities of all the nodes are
+   * computed at once
+   */
+  void prepareNodalValuesBatched();
+
   /**
    * holds info regarding the names of the Richards variables
    * and methods for extracting values of these variables
@@ -137,4 +146,10 @@ protected:
    * So: (*_ps_at_nodes[_pvar])[i] = _var.dofValues()[i] = value of porepressure at node i
    */
   std::vector<const VariableValue *> _ps_at_nodes;
+
+  /// the density, relperm and mobility at the nodes, for prepareNodalValuesBatched
+  RichardsPhaseData _nodal_data;
+
+  /// the effective saturation derivatives at a node, kept to avoid allocating per node
+  std::vector<Real> _dseff;
 };
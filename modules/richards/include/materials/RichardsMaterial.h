@@ -17,6 +17,7 @@
 #include "RichardsSeff.h"
 #include "RichardsSat.h"
 #include "RichardsSUPG.h"
+#include "RichardsPhaseData.h"
 
 // Forward Declarations
 
@@ -95,6 +96,19 @@ protected:
   /// Computes the tauvel_SUPG and its derivatives
   void computeSUPG();
 
+  /**
+   * The fused form of computeDerivedQuantities: the densities and relative permeabilities
+   * of each phase are evaluated for all the quadpoints at once into _phase_data, then the
+   * material properties are filled from these arrays
+   */
+  void computeDerivedQuantitiesFused();
+
+  /// whether to use computeDerivedQuantitiesFused
+  const bool _fused_evaluation;
+
+  /// the per-phase values at the quadpoints of the current element
+  RichardsPhaseData _phase_data;
+
 private:
   /// trace of permeability tensor
   Real _trace_perm;
@@ -47,4 +47,25 @@ public:
    * @param p porepressure
    */
   virtual Real d2density(Real p) const = 0;
+
+  /**
+   * fluid density and its derivatives at n porepressures at once, for the fused evaluation of
+   * RichardsMaterial and the nodal values of RichardsFullyUpwindFlux.  Derived classes may
+   * override it to share work between the value and the derivatives
+   * @param n the number of porepressures
+   * @param p the porepressures
+   * @param dens the densities
+   * @param ddens the derivatives of density wrt porepressure
+   * @param d2dens the second derivatives of density wrt porepressure
+   */
+  virtual void
+  densities(unsigned int n, const Real * p, Real * dens, Real * ddens, Real * d2dens) const
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      dens[i] = density(p[i]);
+      ddens[i] = ddensity(p[i]);
+      d2dens[i] = d2density(p[i]);
+    }
+  }
 };
@@ -11,6 +11,8 @@
 
 #include "RichardsDensity.h"
 
+#include <cmath>
+
 /**
  * Fluid density assuming constant bulk modulus
  */
@@ -39,6 +41,18 @@ public:
    */
   Real d2density(Real p) const;
 
+  /// the densities and derivatives at n porepressures, with one exponential per porepressure
+  virtual void densities(
+      unsigned int n, const Real * p, Real * dens, Real * ddens, Real * d2dens) const override
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      dens[i] = _dens0 * std::exp(p[i] / _bulk);
+      ddens[i] = dens[i] / _bulk;
+      d2dens[i] = ddens[i] / _bulk;
+    }
+  }
+
 protected:
   /// density = _dens0*exp(p/_bulk)
   Real _dens0;
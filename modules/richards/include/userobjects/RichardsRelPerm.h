@@ -49,4 +49,23 @@ public:
    * @param seff effective saturation
    */
   virtual Real d2relperm(Real seff) const = 0;
+
+  /**
+   * relative permeability and its derivatives at n effective saturations at once, for the fused
+   * evaluation of RichardsMaterial and the nodal values of RichardsFullyUpwindFlux
+   * @param n the number of effective saturations
+   * @param seff the effective saturations
+   * @param rp the relative permeabilities
+   * @param drp the derivatives of relative permeability wrt effective saturation
+   * @param d2rp the second derivatives of relative permeability wrt effective saturation
+   */
+  virtual void relperms(unsigned int n, const Real * seff, Real * rp, Real * drp, Real * d2rp) const
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      rp[i] = relperm(seff[i]);
+      drp[i] = drelperm(seff[i]);
+      d2rp[i] = d2relperm(seff[i]);
+    }
+  }
 };
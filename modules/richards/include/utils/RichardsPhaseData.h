@@ -0,0 +1,75 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * The per-phase fluid quantities of the points of an element (quadpoints or nodes), each stored
+ * contiguously over the points of a phase: quantity(phase)[point].  These are filled by the
+ * batched user object calls (RichardsDensity::densities, RichardsRelPerm::relperms) and kept
+ * between elements, so the storage is only reallocated when the number of phases or points
+ * changes.
+ */
+class RichardsPhaseData
+{
+public:
+  void resize(unsigned int num_phases, unsigned int num_points)
+  {
+    if (num_phases == _num_phases && num_points == _num_points)
+      return;
+    _num_phases = num_phases;
+    _num_points = num_points;
+    for (auto * v : {&_p,
+                     &_seff,
+                     &_density,
+                     &_ddensity,
+                     &_d2density,
+                     &_relperm,
+                     &_drelperm,
+                     &_d2relperm,
+                     &_mobility})
+      v->assign(std::size_t(num_phases) * num_points, 0.0);
+  }
+
+  unsigned int numPhases() const { return _num_phases; }
+  unsigned int numPoints() const { return _num_points; }
+
+  ///@{ The values of a phase at all the points
+  Real * p(unsigned int ph) { return &_p[offset(ph)]; }
+  Real * seff(unsigned int ph) { return &_seff[offset(ph)]; }
+  Real * density(unsigned int ph) { return &_density[offset(ph)]; }
+  Real * ddensity(unsigned int ph) { return &_ddensity[offset(ph)]; }
+  Real * d2density(unsigned int ph) { return &_d2density[offset(ph)]; }
+  Real * relperm(unsigned int ph) { return &_relperm[offset(ph)]; }
+  Real * drelperm(unsigned int ph) { return &_drelperm[offset(ph)]; }
+  Real * d2relperm(unsigned int ph) { return &_d2relperm[offset(ph)]; }
+  /// density * relperm / viscosity
+  Real * mobility(unsigned int ph) { return &_mobility[offset(ph)]; }
+  ///@}
+
+private:
+  std::size_t offset(unsigned int ph) const { return std::size_t(ph) * _num_points; }
+
+  unsigned int _num_phases = 0;
+  unsigned int _num_points = 0;
+
+  std::vector<Real> _p;
+  std::vector<Real> _seff;
+  std::vector<Real> _density;
+  std::vector<Real> _ddensity;
+  std::vector<Real> _d2density;
+  std::vector<Real> _relperm;
+  std::vector<Real> _drelperm;
+  std::vector<Real> _d2relperm;
+  std::vector<Real> _mobility;
+};
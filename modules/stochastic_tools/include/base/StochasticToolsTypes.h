@@ -16,6 +16,9 @@ enum class MultiAppMode
 {
   NORMAL = 0,
   BATCH_RESET = 1,
-  BATCH_RESTORE = 2
+  BATCH_RESTORE = 2,
+  /// One sub-app per processor kept alive across the samples, set back to its initial state
+  /// before each sample from an in-memory snapshot (MooseApp::restoreInMemory())
+  BATCH_REUSE = 3
 };
 }
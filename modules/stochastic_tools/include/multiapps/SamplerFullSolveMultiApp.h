@@ -14,6 +14,7 @@
 #include "SamplerInterface.h"
 
 #include "StochasticToolsTypes.h"
+#include "DynamicSampleQueue.h"
 
 class Sampler;
 class StochasticToolsTransfer;
@@ -37,7 +38,19 @@ protected:
   /// Counter for extracting command line arguments in batch mode
   dof_id_type _local_batch_app_index;
 
-  /// Override to allow for batch mode to get correct cli_args
+  /// Whether the rows are taken from a queue as the processor groups become idle (batch modes)
+  const bool _dynamic_scheduling;
+
+  /// The queue of the rows when scheduling dynamically, created at the first solve
+  std::unique_ptr<StochasticTools::DynamicSampleQueue> _sample_queue;
+
+  /// The rows solved by this processor during the last solve when scheduling dynamically
+  std::vector<dof_id_type> _dynamic_rows;
+
+  /**
+   * Override to allow for batch mode to get correct cli_args; the values of the row of the app
+   * are read with Sampler::getSample, so no matrix of the local rows is built
+   */
   virtual std::string getCommandLineArgsParamHelper(unsigned int local_app) override;
 
   /**
@@ -52,6 +65,25 @@ private:
    * */
   bool solveStepBatch(Real dt, Real target_time, bool auto_advance = true);
 
+  /**
+   * The loop of solveStepBatch over the rows taken from _sample_queue rather than over the local
+   * rows: each row is sent by the SamplerParameterTransfer from Sampler::getRow, and its results
+   * are tagged with the row so that StochasticResults can put them in order.
+   */
+  bool solveStepBatchDynamic(Real dt, Real target_time, bool auto_advance);
+
+  /**
+   * Sets the sub-app back to its state before the first sample in mode='batch-reuse': the first
+   * call snapshots the freshly set up app in memory (MooseApp::backupInMemory()), the later ones
+   * restore the solution vectors, stateful material properties and restartable data from it.
+   * The mesh, the DofMap and the sparsity of the app are kept, and the controllable parameters
+   * are set for the next sample by the SamplerParameterTransfer that follows.
+   */
+  void resetBatchReuseApp();
+
+  /// Whether the in-memory snapshot of the initial state has been taken in mode='batch-reuse'
+  bool _batch_reuse_snapshot_taken = false;
+
   ///@{
   /// PrefGraph timers
   const PerfID _perf_solve_step;
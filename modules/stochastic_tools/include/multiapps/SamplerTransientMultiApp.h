@@ -14,6 +14,7 @@
 #include "SamplerInterface.h"
 
 #include "StochasticToolsTypes.h"
+#include "DynamicSampleQueue.h"
 
 class Sampler;
 class StochasticToolsTransfer;
@@ -42,6 +43,19 @@ protected:
   /// The Sup-application solve mode
   const StochasticTools::MultiAppMode _mode;
 
+  /**
+   * Whether the rows are taken from a queue as the processor groups become idle (batch modes).
+   * The rows are assigned during the first time step and kept by the processor that took them
+   * for the later ones, because the backups of batch-restore mode live on that processor.
+   */
+  const bool _dynamic_scheduling;
+
+  /// The queue of the rows when scheduling dynamically, used by the first time step
+  std::unique_ptr<StochasticTools::DynamicSampleQueue> _sample_queue;
+
+  /// The rows taken by this processor when scheduling dynamically, in the order of _batch_backup
+  std::vector<dof_id_type> _dynamic_rows;
+
 private:
   /**
    * Helper method for running in mode='batch'
@@ -23,6 +23,13 @@ public:
   virtual Real evaluate(const std::vector<Real> & x) const override;
   virtual Real evaluate(const std::vector<Real> & x, Real & std) const;
 
+  /**
+   * Builds the covariance between the whole batch and the training points with one
+   * computeCovarianceMatrix call, so the means are a single matrix-vector product with
+   * _K_results_solve
+   */
+  virtual void evaluateBatch(const DenseMatrix<Real> & x, std::vector<Real> & y) const override;
+
   /**
    * This function is called by LoadCovarianceDataAction when the surrogate is
    * loading training data from a file. The action must recreate the covariance
@@ -58,6 +65,17 @@ private:
   /// Cholesky decomposition Eigen object
   const Eigen::LLT<RealEigenMatrix> & _K_cho_decomp;
 
+  ///@{
+  /// Data of the inducing-point approximation, empty when trained with the full covariance
+  const RealEigenMatrix & _inducing_params;
+  const RealEigenMatrix & _sparse_cholesky_inducing;
+  const RealEigenMatrix & _sparse_cholesky_system;
+  const RealEigenMatrix & _sparse_weights;
+  ///@}
+
+  /// The evaluate() of a surrogate trained with inducing points, from the covariance with them
+  Real evaluateSparse(const RealEigenMatrix & test_points, Real & std) const;
+
   /// Type of covariance function used for this surrogate
   const std::string & _covar_type;
 
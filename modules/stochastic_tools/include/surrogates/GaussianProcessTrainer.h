@@ -11,6 +11,7 @@
 
 #include "SurrogateTrainer.h"
 #include "Standardizer.h"
+#include "SparseGaussianProcess.h"
 #include <Eigen/Dense>
 
 #include "Distribution.h"
@@ -28,6 +29,9 @@ public:
   virtual void execute() override;
   virtual void finalize() override;
 
+  /// Whether the surrogate is trained with the inducing-point approximation
+  bool isSparse() const { return _num_inducing_points > 0; }
+
   CovarianceFunctionBase * getCovarPtr() const { return _covariance_function; }
 
 #ifdef LIBMESH_HAVE_PETSC
@@ -87,6 +91,27 @@ private:
   /// Cholesky decomposition Eigen object
   Eigen::LLT<RealEigenMatrix> & _K_cho_decomp;
 
+  /**
+   * Number of inducing points of the sparse approximation (0 for the full covariance). The
+   * points are selected among the training points by pivoted Cholesky, and the training data of
+   * each processor enters through its own rows of K_nm only (see SparseGaussianProcess), so _K
+   * is never formed.
+   */
+  const unsigned int _num_inducing_points;
+
+  /// Paramaters (x) of the inducing points, standardized as the training params
+  RealEigenMatrix & _inducing_params;
+
+  ///@{
+  /// The factors and weights of the sparse approximation needed by the surrogate
+  RealEigenMatrix & _sparse_cholesky_inducing;
+  RealEigenMatrix & _sparse_cholesky_system;
+  RealEigenMatrix & _sparse_weights;
+  ///@}
+
+  /// The sparse approximation, when _num_inducing_points > 0
+  StochasticTools::SparseGaussianProcess _sparse_gp;
+
   /// Switch for training param (x) standardization
   bool _standardize_params;
 
@@ -99,6 +124,12 @@ private:
   /// Covariance function object
   CovarianceFunctionBase * _covariance_function = nullptr;
 
+  /**
+   * Selects the inducing points, then adds the covariance of the local training points with
+   * them to _sparse_gp and gathers it over the processors
+   */
+  void trainSparse();
+
 #ifdef LIBMESH_HAVE_PETSC
   /// Flag to toggle hyperparameter tuning/optimization
   bool _do_tuning;
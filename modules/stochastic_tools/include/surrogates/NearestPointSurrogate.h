@@ -10,6 +10,9 @@
 #pragma once
 
 #include "SurrogateModel.h"
+#include "NearestPointTree.h"
+
+#include "libmesh/threads.h"
 
 class NearestPointSurrogate : public SurrogateModel
 {
@@ -17,8 +20,20 @@ public:
   static InputParameters validParams();
   NearestPointSurrogate(const InputParameters & parameters);
   virtual Real evaluate(const std::vector<Real> & x) const override;
+  virtual void evaluateBatch(const DenseMatrix<Real> & x, std::vector<Real> & y) const override;
 
 protected:
   /// Array containing sample points and the results
   const std::vector<std::vector<Real>> & _sample_points;
+
+  /**
+   * Search tree over the sample points, replacing the scan of all of them by evaluate(). It is
+   * built on first use, as the model data may be loaded after construction, and rebuilt if the
+   * number of points changes (the trainer re-executed).
+   */
+  const StochasticTools::NearestPointTree & tree(unsigned int n_dims) const;
+  mutable std::unique_ptr<StochasticTools::NearestPointTree> _tree;
+
+  /// Guards the construction of _tree by threaded evaluations
+  mutable Threads::spin_mutex _tree_mutex;
 };
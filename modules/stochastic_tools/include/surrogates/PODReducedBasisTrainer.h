@@ -15,6 +15,7 @@
 #include "MooseTypes.h"
 #include "libmesh/parallel.h"
 #include "DistributedData.h"
+#include "IncrementalSVD.h"
 
 // Forward declarations
 namespace libMesh
@@ -91,6 +92,13 @@ protected:
   /// Prints the eigenvalues of the correlation matrix for each variable.
   void printEigenvalues();
 
+  /**
+   * Merges the incremental decompositions of the processors (StochasticTools::treeReduce) and
+   * takes the basis vectors and eigenvalues from them, in place of computeCorrelationMatrix(),
+   * computeEigenDecomposition() and computeBasisVectors() when _incremental_svd is set.
+   */
+  void computeBasisVectorsIncremental();
+
   /// Vector containing the names of the variables we want to use for constructing
   /// the surrogates.
   std::vector<std::string> & _var_names;
@@ -107,6 +115,20 @@ protected:
   /// Distributed container for snapshots per variable.
   std::vector<DistributedSnapshots> _snapshots;
 
+  /**
+   * Whether the snapshots are folded into an incremental SVD per variable by addSnapshot() as
+   * they arrive, instead of being stored for the correlation matrix: the local decompositions
+   * are merged over the processors once all the snapshots are in, so no processor needs the
+   * snapshots of the others and the correlation matrix of all of them is never formed.
+   */
+  const bool _incremental_svd;
+
+  /// Maximum number of modes of the incremental decompositions (0 for no limit)
+  const unsigned int _max_svd_rank;
+
+  /// The incremental decomposition of the local snapshots of each variable
+  std::vector<StochasticTools::IncrementalSVD> _snapshot_svd;
+
   /// The correlation matrices for the variables.
   std::vector<DenseMatrix<Real>> _corr_mx;
 
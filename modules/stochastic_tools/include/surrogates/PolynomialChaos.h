@@ -22,6 +22,12 @@ public:
   PolynomialChaos(const InputParameters & parameters);
   virtual Real evaluate(const std::vector<Real> & x) const override;
 
+  /**
+   * Evaluates the 1D polynomials of each dimension for all the points of the batch up to _order
+   * first, then accumulates the products of each term of _tuple over the batch
+   */
+  virtual void evaluateBatch(const DenseMatrix<Real> & x, std::vector<Real> & y) const override;
+
   /// Access number of dimensions/parameters
   std::size_t getNumberOfParameters() const { return _poly.size(); }
 
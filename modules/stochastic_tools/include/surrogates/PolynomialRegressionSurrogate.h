@@ -20,6 +20,12 @@ public:
 
   virtual Real evaluate(const std::vector<Real> & x) const override;
 
+  /**
+   * Tabulates the powers of each parameter up to _max_degree for the whole batch, so the terms of
+   * _power_matrix are products of table entries instead of calls to pow
+   */
+  virtual void evaluateBatch(const DenseMatrix<Real> & x, std::vector<Real> & y) const override;
+
 protected:
   /// Coefficients of regression model
   const std::vector<Real> & _coeff;
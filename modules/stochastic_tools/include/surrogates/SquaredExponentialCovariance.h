@@ -10,6 +10,7 @@
 #pragma once
 
 #include "CovarianceFunctionBase.h"
+#include "CovarianceAssembly.h"
 
 class SquaredExponentialCovariance : public CovarianceFunctionBase
 {
@@ -23,6 +24,7 @@ public:
                                const RealEigenMatrix & xp,
                                const bool is_self_covariance) const override;
 
+  /// Fills K through StochasticTools::CovarianceAssembly::assemble, threaded over its rows
   static void SquaredExponentialFunction(RealEigenMatrix & K,
                                          const RealEigenMatrix & x,
                                          const RealEigenMatrix & xp,
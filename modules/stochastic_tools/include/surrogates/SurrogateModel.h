@@ -14,6 +14,8 @@
 #include "SamplerInterface.h"
 #include "SurrogateModelInterface.h"
 
+#include "libmesh/dense_matrix.h"
+
 class SurrogateModel : public MooseObject, public SamplerInterface, public SurrogateModelInterface
 {
 public:
@@ -25,6 +27,23 @@ public:
    */
   virtual Real evaluate(const std::vector<Real> & x) const = 0;
 
+  /**
+   * Evaluate surrogate model for a batch of points, one per row of x, into y (resized to the
+   * number of rows). The default evaluates the rows one by one; the surrogates override it to
+   * share the work that does not depend on the point across the batch.
+   */
+  virtual void evaluateBatch(const DenseMatrix<Real> & x, std::vector<Real> & y) const
+  {
+    y.resize(x.m());
+    std::vector<Real> row(x.n());
+    for (unsigned int i = 0; i < x.m(); ++i)
+    {
+      for (unsigned int j = 0; j < x.n(); ++j)
+        row[j] = x(i, j);
+      y[i] = evaluate(row);
+    }
+  }
+
   /**
    * The name for training data stored within the MooseApp
    */
@@ -65,5 +65,8 @@ protected:
   /// Temporary storage for batch mode execution
   std::vector<VectorPostprocessorValue> _current_data;
 
+  /// The global rows of the entries of _current_data, when the rows are scheduled dynamically
+  std::vector<dof_id_type> _current_rows;
+
   const bool _keep_diverge;
 };
@@ -11,6 +11,7 @@
 
 #include "MooseTypes.h"
 #include "MooseObject.h"
+#include "StreamingCalculators.h"
 #include <vector>
 
 class MooseEnum;
@@ -64,6 +65,16 @@ public:
                                     const Calculator & calc,
                                     const bool is_distributed) const = 0;
 
+  /**
+   * Compute the bootstrap confidence level intervals from replicates accumulated in a single pass
+   * over the data (see StreamingBootstrap). The methods that need the data itself (the jackknife
+   * of BiasCorrectedAccelerated) do not support it.
+   * @param replicates The replicates, merged over the processors
+   * @param calc Calculator object defining the statistic to be computed
+   */
+  virtual std::vector<Real> computeStreaming(const StreamingBootstrap & replicates,
+                                             const Calculator & calc) const;
+
 protected:
   // Compute Bootstrap estimates of a statistic
   std::vector<Real>
@@ -95,6 +106,9 @@ public:
 
   virtual std::vector<Real>
   compute(const std::vector<Real> &, const Calculator &, const bool) const override;
+
+  virtual std::vector<Real> computeStreaming(const StreamingBootstrap &,
+                                             const Calculator &) const override;
 };
 
 /*
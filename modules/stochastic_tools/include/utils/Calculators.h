@@ -11,6 +11,7 @@
 
 #include "MooseTypes.h"
 #include "MultiMooseEnum.h"
+#include "StreamingCalculators.h"
 #include <vector>
 
 class MooseEnumItem;
@@ -49,6 +50,12 @@ public:
   Calculator(const libMesh::ParallelObject &);
   virtual ~Calculator() = default;
   virtual Real compute(const std::vector<Real> &, bool) const = 0;
+
+  /**
+   * The same statistic from moments accumulated in a single pass over the samples and merged
+   * over the processors (see StreamingMoments), for data too large to be gathered
+   */
+  virtual Real computeStreaming(const StreamingMoments &) const = 0;
 };
 
 class Mean : public Calculator
@@ -56,6 +63,7 @@ class Mean : public Calculator
 public:
   Mean(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 
 class Min : public Calculator
@@ -63,6 +71,7 @@ class Min : public Calculator
 public:
   Min(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 
 class Max : public Calculator
@@ -70,6 +79,7 @@ class Max : public Calculator
 public:
   Max(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 
 class Sum : public Calculator
@@ -77,6 +87,7 @@ class Sum : public Calculator
 public:
   Sum(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 
 class StdDev : public Calculator
@@ -84,6 +95,7 @@ class StdDev : public Calculator
 public:
   StdDev(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 
 class StdErr : public StdDev
@@ -91,6 +103,7 @@ class StdErr : public StdDev
 public:
   StdErr(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 
 class Ratio : public Calculator
@@ -98,6 +111,7 @@ class Ratio : public Calculator
 public:
   Ratio(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 
 class L2Norm : public Calculator
@@ -105,5 +119,6 @@ class L2Norm : public Calculator
 public:
   L2Norm(const libMesh::ParallelObject &);
   virtual Real compute(const std::vector<Real> &, bool) const override;
+  virtual Real computeStreaming(const StreamingMoments &) const override;
 };
 } // namespace
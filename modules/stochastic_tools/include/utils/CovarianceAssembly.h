@@ -0,0 +1,119 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/threads.h"
+
+#include <cmath>
+#include <vector>
+
+namespace StochasticTools
+{
+/**
+ * Threaded assembly of the covariance matrices of the stationary kernels of the Gaussian process
+ * surrogates, used by SquaredExponentialCovariance and MaternHalfIntCovariance. The kernels are
+ * functions of the squared distance between two points scaled by the length factors, and the
+ * rows of the matrix are split among the threads.
+ */
+namespace CovarianceAssembly
+{
+/// Squared distance between row i of x and row j of xp, each dimension scaled by its length factor
+inline Real
+scaledDistance2(const RealEigenMatrix & x,
+                unsigned int i,
+                const RealEigenMatrix & xp,
+                unsigned int j,
+                const std::vector<Real> & length_factor)
+{
+  Real r2 = 0;
+  for (unsigned int d = 0; d < x.cols(); ++d)
+  {
+    const Real dx = (x(i, d) - xp(j, d)) / length_factor[d];
+    r2 += dx * dx;
+  }
+  return r2;
+}
+
+/**
+ * Fills K(i, j) = kernel(r2) for every row i of x and j of xp, r2 being their scaled squared
+ * distance. For a self covariance (x and xp the same points) only the upper triangle is
+ * evaluated before being mirrored, and sigma_n_squared is added to the diagonal.
+ */
+template <typename Kernel>
+void
+assemble(RealEigenMatrix & K,
+         const RealEigenMatrix & x,
+         const RealEigenMatrix & xp,
+         const std::vector<Real> & length_factor,
+         Real sigma_n_squared,
+         bool is_self_covariance,
+         const Kernel & kernel)
+{
+  if (x.cols() != xp.cols() || length_factor.size() != std::size_t(x.cols()))
+    mooseError("The number of dimensions of the points does not match the length factors");
+  if (is_self_covariance && x.rows() != xp.rows())
+    mooseError("A self covariance requires the same number of points in both sets");
+
+  const unsigned int n = x.rows();
+  K.resize(n, xp.rows());
+  Threads::parallel_for(Threads::BlockedRange<unsigned int>(0, n),
+                        [&](const Threads::BlockedRange<unsigned int> & range)
+                        {
+                          for (auto i = range.begin(); i != range.end(); ++i)
+                            for (unsigned int j = is_self_covariance ? i : 0; j < xp.rows(); ++j)
+                              K(i, j) = kernel(scaledDistance2(x, i, xp, j, length_factor));
+                        });
+
+  if (is_self_covariance)
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      for (unsigned int j = 0; j < i; ++j)
+        K(i, j) = K(j, i);
+      K(i, i) += sigma_n_squared;
+    }
+}
+
+/// The squared exponential kernel sigma_f^2 exp(-r^2 / 2)
+inline Real
+squaredExponential(Real r2, Real sigma_f_squared)
+{
+  return sigma_f_squared * std::exp(-r2 / 2.0);
+}
+
+/**
+ * The Matern kernel of half-integer order nu = p + 1/2, as the product of an exponential and a
+ * polynomial of degree p
+ */
+inline Real
+maternHalfInt(Real r2, Real sigma_f_squared, unsigned int p)
+{
+  const Real scale = std::sqrt(2.0 * p + 1.0) * std::sqrt(r2);
+  // p! / (2p)!
+  Real factor = 1;
+  for (unsigned int k = p + 1; k <= 2 * p; ++k)
+    factor /= k;
+  // Sum over i of (p + i)! / (i! (p - i)!) (2 scale)^(p - i)
+  Real sum = 0;
+  for (unsigned int i = 0; i <= p; ++i)
+  {
+    Real coefficient = 1;
+    for (unsigned int k = p - i + 1; k <= p + i; ++k)
+      coefficient *= k;
+    for (unsigned int k = 2; k <= i; ++k)
+      coefficient /= k;
+    sum += coefficient * std::pow(2.0 * scale, Real(p - i));
+  }
+  return sigma_f_squared * std::exp(-scale) * factor * sum;
+}
+}
+}
@@ -0,0 +1,150 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/communicator.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace StochasticTools
+{
+
+/**
+ * Queue of the rows of a Sampler handed out to the processor groups of a MultiApp as they become
+ * idle, instead of the static partition of Sampler::getLocalRowBegin/End. A group that finishes
+ * its rows early takes the next chunk, so the rows with long solves do not leave the other
+ * groups waiting at the end of the step.
+ *
+ * The next row is a counter on the first rank of the communicator, exposed through an MPI window
+ * and incremented with MPI_Fetch_and_op, so taking a chunk needs no help from the other ranks
+ * (none of them acts as a dispatcher). Only the first rank of each group reads the counter, the
+ * other ranks of the group get the chunk by broadcast:
+ *
+ * @begincode
+ * DynamicSampleQueue queue(comm, group_comm, sampler.getNumberOfRows(), chunk);
+ * dof_id_type begin, end;
+ * while (queue.next(begin, end))
+ *   for (dof_id_type row = begin; row < end; ++row)
+ *     solve(row);
+ * @endcode
+ *
+ * The rows given to a group increase, so a Sampler can generate them by advancing its
+ * generators (see Sampler::getRow). Without MPI, all the rows go to the single group.
+ */
+class DynamicSampleQueue
+{
+public:
+  /**
+   * Creates the queue of the rows [0, n_rows), collective on comm
+   * @param comm The communicator of all the groups
+   * @param group The communicator of the group of this rank, a subset of comm
+   * @param n_rows The number of rows
+   * @param chunk The number of consecutive rows handed out at once
+   */
+  DynamicSampleQueue(const libMesh::Parallel::Communicator & comm,
+                     const libMesh::Parallel::Communicator & group,
+                     dof_id_type n_rows,
+                     dof_id_type chunk)
+    : _group(group), _n_rows(n_rows), _chunk(std::max(chunk, dof_id_type(1)))
+  {
+#ifdef LIBMESH_HAVE_MPI
+    _comm = comm.get();
+    _counter = nullptr;
+    const MPI_Aint bytes = comm.rank() == 0 ? sizeof(std::uint64_t) : 0;
+    if (MPI_Win_allocate(
+            bytes, sizeof(std::uint64_t), MPI_INFO_NULL, _comm, &_counter, &_win) != MPI_SUCCESS)
+      mooseError("DynamicSampleQueue: MPI_Win_allocate failed");
+    MPI_Win_lock_all(0, _win);
+    reset();
+#else
+    libmesh_ignore(comm);
+#endif
+  }
+
+  ~DynamicSampleQueue()
+  {
+#ifdef LIBMESH_HAVE_MPI
+    MPI_Win_unlock_all(_win);
+    MPI_Win_free(&_win);
+#endif
+  }
+
+  DynamicSampleQueue(const DynamicSampleQueue &) = delete;
+  DynamicSampleQueue & operator=(const DynamicSampleQueue &) = delete;
+
+  /**
+   * Puts all the rows back in the queue, for the next execution of the MultiApp (collective on
+   * the communicator of all the groups)
+   */
+  void reset()
+  {
+#ifdef LIBMESH_HAVE_MPI
+    MPI_Barrier(_comm);
+    int rank;
+    MPI_Comm_rank(_comm, &rank);
+    if (rank == 0)
+    {
+      const std::uint64_t zero = 0;
+      MPI_Put(&zero, 1, MPI_UINT64_T, 0, 0, 1, MPI_UINT64_T, _win);
+      MPI_Win_flush(0, _win);
+    }
+    MPI_Barrier(_comm);
+#else
+    _next = 0;
+#endif
+  }
+
+  /**
+   * Takes the next chunk of rows, collective on the group
+   * @param begin The first row of the chunk
+   * @param end One past the last row of the chunk
+   * @return false once the queue is empty, with begin == end
+   */
+  bool next(dof_id_type & begin, dof_id_type & end)
+  {
+    std::uint64_t first = _n_rows;
+#ifdef LIBMESH_HAVE_MPI
+    if (_group.rank() == 0)
+    {
+      const std::uint64_t increment = _chunk;
+      MPI_Fetch_and_op(&increment, &first, MPI_UINT64_T, 0, 0, MPI_SUM, _win);
+      MPI_Win_flush(0, _win);
+    }
+    _group.broadcast(first);
+#else
+    first = _next;
+    _next += _chunk;
+#endif
+    begin = std::min<std::uint64_t>(first, _n_rows);
+    end = std::min<std::uint64_t>(first + _chunk, _n_rows);
+    return begin < end;
+  }
+
+  dof_id_type numRows() const { return _n_rows; }
+  dof_id_type chunkSize() const { return _chunk; }
+
+private:
+  const libMesh::Parallel::Communicator & _group;
+  const dof_id_type _n_rows;
+  const dof_id_type _chunk;
+#ifdef LIBMESH_HAVE_MPI
+  MPI_Comm _comm;
+  MPI_Win _win;
+  /// The next row to hand out, allocated on the first rank only
+  std::uint64_t * _counter;
+#else
+  std::uint64_t _next = 0;
+#endif
+};
+}
@@ -0,0 +1,146 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace StochasticTools
+{
+/**
+ * Truncated singular value decomposition X = U S V^T of a matrix whose columns (the snapshots of
+ * PODReducedBasisTrainer) arrive one at a time, updated with the incremental method of Brand
+ * (2002): a column x adds the component r = x - U U^T x orthogonal to the current basis, and the
+ * (k + 1) x (k + 1) core matrix [S, U^T x; 0, |r|] is re-decomposed. V is not kept, as the POD only
+ * needs the left singular vectors and the singular values, so each update costs O(N k^2) and the
+ * memory is O(N k) for N entries per snapshot and rank k, against O(N M) to keep M snapshots.
+ *
+ * The decompositions of the snapshots of different processors merge by adding the columns of
+ * U_2 S_2 to the first one: they span the same space and have the same Gram matrix as the
+ * snapshots they replace. With pack()/unpack(), the decompositions of all the processors merge
+ * with StochasticTools::treeReduce, the snapshots never leaving the processor that received them.
+ */
+class IncrementalSVD
+{
+public:
+  /**
+   * @param max_rank The maximum number of singular values kept
+   * @param tolerance Singular values below tolerance times the largest are dropped, and the
+   * components of new columns relatively smaller than it do not extend the basis
+   */
+  IncrementalSVD(unsigned int max_rank = 0, Real tolerance = 1e-12)
+    : _max_rank(max_rank), _tolerance(tolerance)
+  {
+  }
+
+  /// Adds a column, of the same size as the ones before
+  void add(const Eigen::Ref<const Eigen::VectorXd> & x)
+  {
+    if (_basis.cols() == 0)
+    {
+      const Real norm = x.norm();
+      if (norm == 0)
+        return;
+      _basis = x / norm;
+      _values = Eigen::VectorXd::Constant(1, norm);
+      return;
+    }
+    if (x.size() != _basis.rows())
+      mooseError("The snapshot has ", x.size(), " entries instead of ", _basis.rows());
+
+    // Component orthogonal to the basis, orthogonalized twice against round-off
+    Eigen::VectorXd p = _basis.transpose() * x;
+    Eigen::VectorXd r = x - _basis * p;
+    const Eigen::VectorXd correction = _basis.transpose() * r;
+    p += correction;
+    r -= _basis * correction;
+    Real rho = r.norm();
+    const bool extend = rho > _tolerance * std::max(x.norm(), _values(0));
+    if (!extend)
+      rho = 0;
+
+    const auto k = _values.size();
+    Eigen::MatrixXd core = Eigen::MatrixXd::Zero(k + 1, k + 1);
+    core.topLeftCorner(k, k) = _values.asDiagonal();
+    core.topRightCorner(k, 1) = p;
+    core(k, k) = rho;
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(core, Eigen::ComputeFullU);
+
+    // The new basis is [U, r / rho] times the left singular vectors of the core
+    Eigen::MatrixXd basis = _basis * svd.matrixU().topRows(k);
+    if (extend)
+      basis += (r / rho) * svd.matrixU().row(k);
+    _basis = std::move(basis);
+    _values = svd.singularValues();
+    truncate();
+  }
+
+  /// Merges the decomposition of other columns
+  void merge(const IncrementalSVD & other)
+  {
+    for (unsigned int j = 0; j < other._values.size(); ++j)
+      add(other._basis.col(j) * other._values(j));
+  }
+
+  /// The buffer holds the number of rows and columns, the singular values and the basis
+  void pack(std::vector<Real> & buffer) const
+  {
+    buffer = {Real(_max_rank), _tolerance, Real(_basis.rows()), Real(_values.size())};
+    buffer.insert(buffer.end(), _values.data(), _values.data() + _values.size());
+    buffer.insert(buffer.end(), _basis.data(), _basis.data() + _basis.size());
+  }
+
+  void unpack(const std::vector<Real> & buffer)
+  {
+    _max_rank = buffer[0];
+    _tolerance = buffer[1];
+    const std::size_t rows = buffer[2];
+    const std::size_t cols = buffer[3];
+    _values = Eigen::Map<const Eigen::VectorXd>(buffer.data() + 4, cols);
+    _basis = Eigen::Map<const Eigen::MatrixXd>(buffer.data() + 4 + cols, rows, cols);
+  }
+
+  /// The number of singular values kept
+  unsigned int rank() const { return _values.size(); }
+
+  /// The singular values, in decreasing order (their squares are the eigenvalues of X X^T)
+  const Eigen::VectorXd & singularValues() const { return _values; }
+
+  /// The left singular vectors, one per column
+  const Eigen::MatrixXd & basis() const { return _basis; }
+
+private:
+  /// Drops the columns beyond the maximum rank or with negligible singular values
+  void truncate()
+  {
+    Eigen::Index keep = _values.size();
+    if (_max_rank > 0)
+      keep = std::min<Eigen::Index>(keep, _max_rank);
+    while (keep > 1 && _values(keep - 1) <= _tolerance * _values(0))
+      --keep;
+    if (keep < _values.size())
+    {
+      _values.conservativeResize(keep);
+      _basis.conservativeResize(Eigen::NoChange, keep);
+    }
+  }
+
+  unsigned int _max_rank;
+  Real _tolerance;
+  Eigen::VectorXd _values;
+  Eigen::MatrixXd _basis;
+};
+}
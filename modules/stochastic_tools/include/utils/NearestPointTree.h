@@ -0,0 +1,146 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace StochasticTools
+{
+/**
+ * KD-tree over points of a parameter space of any dimension, for the nearest point queries of
+ * NearestPointSurrogate (the KDTree of the framework is built on libMesh Points, so is limited to
+ * LIBMESH_DIM dimensions). The points are given dimension-major, as the sample points of
+ * NearestPointTrainer: points[d][p] is coordinate d of point p.
+ */
+class NearestPointTree
+{
+public:
+  /**
+   * Builds the tree
+   * @param points The coordinates of the points, dimension-major
+   * @param n_dims The number of dimensions used (the first n_dims rows of points)
+   */
+  NearestPointTree(const std::vector<std::vector<Real>> & points, unsigned int n_dims)
+    : _n_dims(n_dims), _n_points(points.empty() ? 0 : points[0].size())
+  {
+    if (n_dims == 0)
+      mooseError("The nearest point tree needs at least one dimension");
+    if (points.size() < n_dims)
+      mooseError("The nearest point tree needs ", n_dims, " coordinates per point");
+    _coords.resize(std::size_t(_n_points) * _n_dims);
+    for (unsigned int d = 0; d < _n_dims; ++d)
+    {
+      if (points[d].size() != _n_points)
+        mooseError("The coordinates of the nearest point tree have different sizes");
+      for (std::size_t p = 0; p < _n_points; ++p)
+        _coords[p * _n_dims + d] = points[d][p];
+    }
+
+    _index.resize(_n_points);
+    std::iota(_index.begin(), _index.end(), 0);
+    build(0, _n_points, 0);
+  }
+
+  std::size_t size() const { return _n_points; }
+
+  /// The index of the point nearest to x (the first of them on ties)
+  std::size_t nearest(const Real * x) const
+  {
+    if (_n_points == 0)
+      mooseError("The nearest point tree is empty");
+    std::size_t best = 0;
+    Real best_dist = std::numeric_limits<Real>::max();
+    search(0, _n_points, 0, x, best, best_dist);
+    return best;
+  }
+
+  std::size_t nearest(const std::vector<Real> & x) const
+  {
+    mooseAssert(x.size() >= _n_dims, "The query point has too few coordinates");
+    return nearest(x.data());
+  }
+
+private:
+  /// Sorts _index[begin, end) around its median along the dimension of the depth, recursively
+  void build(std::size_t begin, std::size_t end, unsigned int depth)
+  {
+    if (end - begin <= 1)
+      return;
+    const unsigned int d = depth % _n_dims;
+    const std::size_t mid = begin + (end - begin) / 2;
+    std::nth_element(_index.begin() + begin,
+                     _index.begin() + mid,
+                     _index.begin() + end,
+                     [this, d](std::size_t a, std::size_t b)
+                     { return _coords[a * _n_dims + d] < _coords[b * _n_dims + d]; });
+    build(begin, mid, depth + 1);
+    build(mid + 1, end, depth + 1);
+  }
+
+  Real distance2(std::size_t p, const Real * x) const
+  {
+    Real dist = 0;
+    for (unsigned int d = 0; d < _n_dims; ++d)
+    {
+      const Real dx = _coords[p * _n_dims + d] - x[d];
+      dist += dx * dx;
+    }
+    return dist;
+  }
+
+  void search(std::size_t begin,
+              std::size_t end,
+              unsigned int depth,
+              const Real * x,
+              std::size_t & best,
+              Real & best_dist) const
+  {
+    if (begin >= end)
+      return;
+    const std::size_t mid = begin + (end - begin) / 2;
+    const std::size_t p = _index[mid];
+    const Real dist = distance2(p, x);
+    if (dist < best_dist || (dist == best_dist && p < best))
+    {
+      best = p;
+      best_dist = dist;
+    }
+
+    const unsigned int d = depth % _n_dims;
+    const Real offset = x[d] - _coords[p * _n_dims + d];
+    // Near side first, then the far side if the splitting plane is within the best distance
+    if (offset < 0)
+    {
+      search(begin, mid, depth + 1, x, best, best_dist);
+      if (offset * offset <= best_dist)
+        search(mid + 1, end, depth + 1, x, best, best_dist);
+    }
+    else
+    {
+      search(mid + 1, end, depth + 1, x, best, best_dist);
+      if (offset * offset <= best_dist)
+        search(begin, mid, depth + 1, x, best, best_dist);
+    }
+  }
+
+  const unsigned int _n_dims;
+  const std::size_t _n_points;
+  /// The coordinates, point-major
+  std::vector<Real> _coords;
+  /// The points in tree order: the median of each range splits it along dimension depth % n_dims
+  std::vector<std::size_t> _index;
+};
+}
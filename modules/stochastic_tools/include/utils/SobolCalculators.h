@@ -10,6 +10,7 @@
 #include <vector>
 #include "MooseTypes.h"
 #include "libmesh/dense_matrix.h"
+#include "StreamingCalculators.h"
 
 namespace StochasticTools
 {
@@ -28,6 +29,9 @@ public:
   virtual ~SobolCalculator() = default;
   virtual std::vector<Real> compute(const std::vector<Real> &, bool) const;
 
+  /// The indices, in the order of compute(), from an accumulator merged over the processors
+  virtual std::vector<Real> computeStreaming(const StreamingSobol &) const;
+
 private:
   /// Number of rows per sample matrix (n), see Saltelli (2002)
   const std::size_t _num_rows_per_matrix;
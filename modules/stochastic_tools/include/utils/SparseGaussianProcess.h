@@ -0,0 +1,202 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/communicator.h"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace StochasticTools
+{
+/**
+ * Inducing-point approximation of a Gaussian process (the deterministic training conditional,
+ * DTC): the covariance of the n training points is replaced by the low-rank
+ * Q = K_nm K_mm^-1 K_mn through m << n inducing points, so training costs O(n m^2) in place of
+ * the O(n^3) Cholesky factorization of the full covariance, and the memory O(n m).
+ *
+ * The training points enter only through K_mn K_nm, K_mn y and y^T y, which are sums over the
+ * points: each processor adds the blocks of its own points (addTrainingBlock), gather() sums them
+ * over the processors, and the m x m systems left are solved on every processor. With
+ * L L^T = K_mm and A = I + L^-1 K_mn K_nm L^-T / sigma_n^2,
+ *  - mean(x*) = k_*m L^-T A^-1 L^-1 K_mn y / sigma_n^2
+ *  - variance(x*) = k_** - |L^-1 k_m*|^2 + |L_A^-1 L^-1 k_m*|^2
+ *  - log p(y) = -(y^T y - |L_A^-1 L^-1 K_mn y|^2 / sigma_n^2) / (2 sigma_n^2)
+ *               - sum log diag(L_A) - n log(2 pi sigma_n^2) / 2
+ */
+class SparseGaussianProcess
+{
+public:
+  /**
+   * Selects m inducing points among n candidates by a pivoted Cholesky factorization of their
+   * covariance: each step takes the point whose variance, conditioned on the points already
+   * taken, is the largest. Only the diagonal and m columns of the covariance are evaluated.
+   * @param kernel kernel(i, j) is the covariance (without noise) between candidates i and j
+   * @return The indices of the points taken, in order
+   */
+  template <typename Kernel>
+  static std::vector<unsigned int>
+  selectInducingPoints(unsigned int n, unsigned int m, const Kernel & kernel)
+  {
+    m = std::min(m, n);
+    std::vector<unsigned int> selected;
+    std::vector<Real> residual(n);
+    for (unsigned int i = 0; i < n; ++i)
+      residual[i] = kernel(i, i);
+    // Columns of the partial Cholesky factor
+    std::vector<std::vector<Real>> columns;
+    while (selected.size() < m)
+    {
+      const unsigned int pivot = std::max_element(residual.begin(), residual.end()) -
+                                 residual.begin();
+      if (residual[pivot] <= 0)
+        break;
+      const Real scale = 1.0 / std::sqrt(residual[pivot]);
+      std::vector<Real> column(n);
+      for (unsigned int i = 0; i < n; ++i)
+      {
+        Real value = kernel(i, pivot);
+        for (const auto & previous : columns)
+          value -= previous[i] * previous[pivot];
+        column[i] = value * scale;
+        residual[i] -= column[i] * column[i];
+      }
+      residual[pivot] = 0;
+      columns.push_back(std::move(column));
+      selected.push_back(pivot);
+    }
+    return selected;
+  }
+
+  /**
+   * Starts a training from the covariance of the inducing points
+   * @param K_mm The m x m covariance of the inducing points (without noise)
+   * @param jitter Added to the diagonal of K_mm so that its Cholesky factorization exists
+   */
+  void initialize(const RealEigenMatrix & K_mm, Real jitter = 1e-10)
+  {
+    const unsigned int m = K_mm.rows();
+    Eigen::LLT<RealEigenMatrix> llt(K_mm + jitter * RealEigenMatrix::Identity(m, m));
+    if (llt.info() != Eigen::Success)
+      mooseError("The covariance of the inducing points is not positive definite");
+    _L_mm = llt.matrixL();
+    _S = RealEigenMatrix::Zero(m, m);
+    _b = RealEigenMatrix::Zero(m, 1);
+    _yy = 0;
+    _n = 0;
+  }
+
+  /**
+   * Adds a block of training points
+   * @param K_nm The covariance between the points of the block (rows) and the inducing points
+   * @param y The training data of the points of the block
+   */
+  void addTrainingBlock(const RealEigenMatrix & K_nm, const RealEigenMatrix & y)
+  {
+    mooseAssert(K_nm.cols() == _L_mm.rows(), "The block does not match the inducing points");
+    mooseAssert(K_nm.rows() == y.rows(), "The block does not match the training data");
+    _S.noalias() += K_nm.transpose() * K_nm;
+    _b.noalias() += K_nm.transpose() * y;
+    _yy += y.squaredNorm();
+    _n += K_nm.rows();
+  }
+
+  /// Sums the blocks added on all the processors of comm
+  void gather(const libMesh::Parallel::Communicator & comm)
+  {
+    std::vector<Real> sums(_S.data(), _S.data() + _S.size());
+    sums.insert(sums.end(), _b.data(), _b.data() + _b.size());
+    sums.push_back(_yy);
+    sums.push_back(_n);
+    comm.sum(sums);
+    std::copy(sums.begin(), sums.begin() + _S.size(), _S.data());
+    std::copy(sums.begin() + _S.size(), sums.begin() + _S.size() + _b.size(), _b.data());
+    _yy = sums[sums.size() - 2];
+    _n = sums.back();
+  }
+
+  /// Solves for the weights of the inducing points, after all the blocks are added and gathered
+  void factor(Real sigma_n_squared)
+  {
+    _sigma_n_squared = sigma_n_squared;
+    const auto L = _L_mm.triangularView<Eigen::Lower>();
+
+    // A = I + L^-1 S L^-T / sigma_n^2
+    RealEigenMatrix A = L.solve(L.solve(_S).transpose());
+    A /= sigma_n_squared;
+    A.diagonal().array() += 1.0;
+    Eigen::LLT<RealEigenMatrix> llt(A);
+    if (llt.info() != Eigen::Success)
+      mooseError("The inducing-point system of the sparse Gaussian process is singular");
+    _L_A = llt.matrixL();
+
+    // c = L_A^-1 L^-1 b, weights = L^-T L_A^-T c / sigma_n^2
+    _c = _L_A.triangularView<Eigen::Lower>().solve(L.solve(_b));
+    _weights = _L_mm.transpose().triangularView<Eigen::Upper>().solve(
+        _L_A.transpose().triangularView<Eigen::Upper>().solve(_c));
+    _weights /= sigma_n_squared;
+  }
+
+  /// The log marginal likelihood of the training data, after factor()
+  Real logMarginalLikelihood() const
+  {
+    const Real s2 = _sigma_n_squared;
+    return -0.5 * (_yy - _c.squaredNorm() / s2) / s2 - _L_A.diagonal().array().log().sum() -
+           0.5 * _n * std::log(2.0 * M_PI * s2);
+  }
+
+  /// The mean at a point, from its covariance with the inducing points (1 x m)
+  Real mean(const RealEigenMatrix & k_sm) const { return (k_sm * _weights)(0, 0); }
+
+  /**
+   * The variance at a point
+   * @param k_ss The prior variance of the point
+   * @param k_sm Its covariance with the inducing points (1 x m)
+   */
+  Real variance(Real k_ss, const RealEigenMatrix & k_sm) const
+  {
+    const RealEigenMatrix v = _L_mm.triangularView<Eigen::Lower>().solve(k_sm.transpose());
+    const RealEigenMatrix w = _L_A.triangularView<Eigen::Lower>().solve(v);
+    return std::max(k_ss - v.squaredNorm() + w.squaredNorm(), 0.0);
+  }
+
+  unsigned int numInducingPoints() const { return _L_mm.rows(); }
+  unsigned int numTrainingPoints() const { return _n; }
+
+  ///@{ The data needed by mean() and variance(), stored by the trainer for the surrogate
+  RealEigenMatrix & choleskyInducing() { return _L_mm; }
+  RealEigenMatrix & choleskySystem() { return _L_A; }
+  RealEigenMatrix & weights() { return _weights; }
+  ///@}
+
+private:
+  /// Cholesky factor of the covariance of the inducing points
+  RealEigenMatrix _L_mm;
+  /// Cholesky factor of A
+  RealEigenMatrix _L_A;
+  /// K_mn K_nm, K_mn y and y^T y accumulated over the training points
+  RealEigenMatrix _S;
+  RealEigenMatrix _b;
+  Real _yy = 0;
+  /// The number of training points
+  Real _n = 0;
+  /// L_A^-1 L^-1 K_mn y
+  RealEigenMatrix _c;
+  /// The weights of the covariance with the inducing points in the mean
+  RealEigenMatrix _weights;
+  Real _sigma_n_squared = 1;
+};
+}
@@ -0,0 +1,416 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include "libmesh/communicator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace StochasticTools
+{
+/**
+ * Single-pass accumulators of the statistics of the Statistics and SobolStatistics objects. Each
+ * processor adds its own samples as they arrive, then the accumulators of the processors are
+ * merged (see treeReduce), so no processor ever holds all the samples. Every accumulator has the
+ * same interface:
+ *  - add() one sample
+ *  - merge() another accumulator of the same kind and parameters
+ *  - pack()/unpack() to and from a buffer of Reals, for the communication of treeReduce
+ */
+
+/**
+ * Count, mean, variance (Welford's update, merged with the pairwise formula of Chan et al.),
+ * minimum, maximum, sum and sum of squares: the quantities of the Mean, Min, Max, Sum, StdDev,
+ * StdErr, Ratio and L2Norm calculators.
+ */
+class StreamingMoments
+{
+public:
+  void add(Real x)
+  {
+    _count += 1;
+    const Real delta = x - _mean;
+    _mean += delta / _count;
+    _m2 += delta * (x - _mean);
+    _min = std::min(_min, x);
+    _max = std::max(_max, x);
+    _sum += x;
+    _sum2 += x * x;
+  }
+
+  void merge(const StreamingMoments & other)
+  {
+    if (other._count == 0)
+      return;
+    const Real count = _count + other._count;
+    const Real delta = other._mean - _mean;
+    _mean += delta * other._count / count;
+    _m2 += other._m2 + delta * delta * _count * other._count / count;
+    _count = count;
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+    _sum += other._sum;
+    _sum2 += other._sum2;
+  }
+
+  void pack(std::vector<Real> & buffer) const
+  {
+    buffer = {_count, _mean, _m2, _min, _max, _sum, _sum2};
+  }
+
+  void unpack(const std::vector<Real> & buffer)
+  {
+    mooseAssert(buffer.size() == 7, "Wrong buffer size for StreamingMoments");
+    _count = buffer[0];
+    _mean = buffer[1];
+    _m2 = buffer[2];
+    _min = buffer[3];
+    _max = buffer[4];
+    _sum = buffer[5];
+    _sum2 = buffer[6];
+  }
+
+  Real count() const { return _count; }
+  Real mean() const { return _mean; }
+  Real min() const { return _min; }
+  Real max() const { return _max; }
+  Real sum() const { return _sum; }
+  Real l2norm() const { return std::sqrt(_sum2); }
+  Real ratio() const { return _max / _min; }
+
+  /// The sample variance (divided by count - 1)
+  Real variance() const { return _count > 1 ? _m2 / (_count - 1) : 0.0; }
+  Real stdDev() const { return std::sqrt(variance()); }
+  Real stdErr() const { return _count > 0 ? stdDev() / std::sqrt(_count) : 0.0; }
+
+private:
+  Real _count = 0;
+  Real _mean = 0;
+  /// Sum of the squared deviations from the mean
+  Real _m2 = 0;
+  Real _min = std::numeric_limits<Real>::max();
+  Real _max = std::numeric_limits<Real>::lowest();
+  Real _sum = 0;
+  Real _sum2 = 0;
+};
+
+/**
+ * Mergeable quantile sketch ("merge and reduce" compactors, as in the KLL sketch without the
+ * randomization): level h holds samples of weight 2^h. When a level has capacity samples, it is
+ * sorted and every other one of them (starting alternately with the first and the second) moves
+ * to the level above with twice the weight. The memory is O(capacity log(n / capacity)) for n
+ * samples and the rank error of a quantile is of the order of log(n / capacity) / capacity.
+ */
+class StreamingQuantiles
+{
+public:
+  StreamingQuantiles(unsigned int capacity = 256) : _capacity(std::max(capacity, 2u)) {}
+
+  void add(Real x)
+  {
+    if (_levels.empty())
+      _levels.resize(1);
+    _levels[0].push_back(x);
+    compact();
+  }
+
+  void merge(const StreamingQuantiles & other)
+  {
+    mooseAssert(other._capacity == _capacity, "Merging quantile sketches of different capacity");
+    if (_levels.size() < other._levels.size())
+      _levels.resize(other._levels.size());
+    for (std::size_t h = 0; h < other._levels.size(); ++h)
+      _levels[h].insert(_levels[h].end(), other._levels[h].begin(), other._levels[h].end());
+    compact();
+  }
+
+  /// The buffer holds the capacity, the number of levels, then the size and samples of each level
+  void pack(std::vector<Real> & buffer) const
+  {
+    buffer = {Real(_capacity), Real(_levels.size())};
+    for (const auto & level : _levels)
+    {
+      buffer.push_back(level.size());
+      buffer.insert(buffer.end(), level.begin(), level.end());
+    }
+  }
+
+  void unpack(const std::vector<Real> & buffer)
+  {
+    _capacity = buffer[0];
+    _levels.resize(std::size_t(buffer[1]));
+    std::size_t pos = 2;
+    for (auto & level : _levels)
+    {
+      const std::size_t size = buffer[pos++];
+      level.assign(buffer.begin() + pos, buffer.begin() + pos + size);
+      pos += size;
+    }
+  }
+
+  /// The total weight of the samples, the number of samples added
+  Real count() const
+  {
+    Real count = 0;
+    for (std::size_t h = 0; h < _levels.size(); ++h)
+      count += std::ldexp(Real(_levels[h].size()), h);
+    return count;
+  }
+
+  /// The quantile of probability p in [0, 1] (the smallest sample of weighted rank >= p count)
+  Real quantile(Real p) const
+  {
+    std::vector<std::pair<Real, Real>> weighted;
+    for (std::size_t h = 0; h < _levels.size(); ++h)
+      for (const auto x : _levels[h])
+        weighted.emplace_back(x, std::ldexp(1.0, h));
+    if (weighted.empty())
+      mooseError("Quantile requested from an empty sketch");
+    std::sort(weighted.begin(), weighted.end());
+
+    const Real target = std::max(p, 0.0) * count();
+    Real rank = 0;
+    for (const auto & entry : weighted)
+    {
+      rank += entry.second;
+      if (rank >= target)
+        return entry.first;
+    }
+    return weighted.back().first;
+  }
+
+private:
+  void compact()
+  {
+    for (std::size_t h = 0; h < _levels.size(); ++h)
+    {
+      if (_levels[h].size() < _capacity)
+        continue;
+      std::sort(_levels[h].begin(), _levels[h].end());
+      if (h + 1 == _levels.size())
+        _levels.emplace_back();
+      auto & current = _levels[h];
+      auto & above = _levels[h + 1];
+      // An odd sample out stays at this level
+      const bool odd = current.size() % 2;
+      const Real leftover = current.back();
+      const std::size_t n = current.size() - odd;
+      const std::size_t offset = _offset ? 1 : 0;
+      _offset = !_offset;
+      for (std::size_t i = offset; i < n; i += 2)
+        above.push_back(current[i]);
+      current.clear();
+      if (odd)
+        current.push_back(leftover);
+    }
+  }
+
+  unsigned int _capacity;
+  /// The samples of each level, level h holding samples of weight 2^h
+  std::vector<std::vector<Real>> _levels;
+  /// Whether the next compaction keeps the odd rather than the even samples
+  bool _offset = false;
+};
+
+/**
+ * Streaming bootstrap replicates of StreamingMoments (the Poisson bootstrap): each sample enters
+ * each replicate with a weight drawn from a Poisson distribution of mean one, which resamples the
+ * data with replacement, as the Percentile and BiasCorrectedAccelerated calculators do, without
+ * keeping the data. The processors must use different seeds.
+ */
+class StreamingBootstrap
+{
+public:
+  StreamingBootstrap(unsigned int replicates = 0, unsigned int seed = 0)
+    : _replicates(replicates), _generator(seed)
+  {
+  }
+
+  void add(Real x)
+  {
+    std::poisson_distribution<unsigned int> weight(1.0);
+    for (auto & replicate : _replicates)
+      for (unsigned int w = weight(_generator); w > 0; --w)
+        replicate.add(x);
+  }
+
+  void merge(const StreamingBootstrap & other)
+  {
+    mooseAssert(other._replicates.size() == _replicates.size(),
+                "Merging bootstrap accumulators with different numbers of replicates");
+    for (std::size_t r = 0; r < _replicates.size(); ++r)
+      _replicates[r].merge(other._replicates[r]);
+  }
+
+  void pack(std::vector<Real> & buffer) const
+  {
+    buffer.clear();
+    std::vector<Real> moments;
+    for (const auto & replicate : _replicates)
+    {
+      replicate.pack(moments);
+      buffer.insert(buffer.end(), moments.begin(), moments.end());
+    }
+  }
+
+  void unpack(const std::vector<Real> & buffer)
+  {
+    const std::size_t size = buffer.size() / std::max(_replicates.size(), std::size_t(1));
+    for (std::size_t r = 0; r < _replicates.size(); ++r)
+      _replicates[r].unpack(
+          std::vector<Real>(buffer.begin() + r * size, buffer.begin() + (r + 1) * size));
+  }
+
+  const std::vector<StreamingMoments> & replicates() const { return _replicates; }
+
+private:
+  std::vector<StreamingMoments> _replicates;
+  std::mt19937 _generator;
+};
+
+/**
+ * Accumulator of the Sobol sensitivity indices of Saltelli (2002), from the rows of the matrices
+ * stacked by SobolSampler ([M2, N_1, ..., N_n, (N_-1, ..., N_-n,) M1]). All the estimators are
+ * sums over the rows of products of two matrix results, so only the Gram matrix of the results
+ * of a row and its size are kept, O((2n + 2)^2) memory for any number of rows.
+ */
+class StreamingSobol
+{
+public:
+  /**
+   * @param n_params The number of parameters n
+   * @param resample Whether the N_-j matrices of the second-order indices are present
+   */
+  StreamingSobol(unsigned int n_params = 0, bool resample = false)
+    : _n_params(n_params),
+      _width(resample ? 2 * n_params + 2 : n_params + 2),
+      _resample(resample),
+      _gram(_width * _width, 0.0)
+  {
+  }
+
+  /// Adds the results of one row of each matrix, in the order of SobolSampler
+  void add(const std::vector<Real> & results)
+  {
+    mooseAssert(results.size() == _width, "Wrong number of Sobol matrix results");
+    for (std::size_t a = 0; a < _width; ++a)
+      for (std::size_t b = a; b < _width; ++b)
+        _gram[a * _width + b] += results[a] * results[b];
+    _count += 1;
+  }
+
+  void merge(const StreamingSobol & other)
+  {
+    mooseAssert(other._width == _width, "Merging Sobol accumulators of different sizes");
+    for (std::size_t i = 0; i < _gram.size(); ++i)
+      _gram[i] += other._gram[i];
+    _count += other._count;
+  }
+
+  void pack(std::vector<Real> & buffer) const
+  {
+    buffer = _gram;
+    buffer.push_back(_count);
+  }
+
+  void unpack(const std::vector<Real> & buffer)
+  {
+    mooseAssert(buffer.size() == _gram.size() + 1, "Wrong buffer size for StreamingSobol");
+    std::copy(buffer.begin(), buffer.end() - 1, _gram.begin());
+    _count = buffer.back();
+  }
+
+  Real count() const { return _count; }
+
+  /// First-order index S_j = (U_j - E^2) / V
+  Real firstOrder(unsigned int j) const { return (dot(m1(), nj(j)) / dof() - e2()) / v(); }
+
+  /// Total-effect index S_Tj = 1 - (U_-j - E^2) / V
+  Real total(unsigned int j) const { return 1.0 - (dot(m2(), nj(j)) / dof() - e2()) / v(); }
+
+  /// Second-order (interaction) index S_jk, from the closed index of {j, k} minus S_j and S_k
+  Real secondOrder(unsigned int j, unsigned int k) const
+  {
+    if (!_resample)
+      mooseError("The second-order Sobol indices require the re-sampling matrices");
+    const Real closed = (dot(nmj(j), nj(k)) / dof() - e2()) / v();
+    return closed - firstOrder(j) - firstOrder(k);
+  }
+
+private:
+  ///@{ Column of each matrix in the rows given to add()
+  std::size_t m2() const { return 0; }
+  std::size_t nj(unsigned int j) const { return 1 + j; }
+  std::size_t nmj(unsigned int j) const { return 1 + _n_params + j; }
+  std::size_t m1() const { return _width - 1; }
+  ///@}
+
+  /// The sum over the rows of the product of the results of matrices a and b
+  Real dot(std::size_t a, std::size_t b) const
+  {
+    return a <= b ? _gram[a * _width + b] : _gram[b * _width + a];
+  }
+
+  Real dof() const { return _count - 1; }
+  /// The estimate of the squared mean, E^2 = sum(M1 M2) / count
+  Real e2() const { return dot(m1(), m2()) / _count; }
+  /// The estimate of the variance, V = sum(M1 M1) / (count - 1) - E^2
+  Real v() const { return dot(m1(), m1()) / dof() - e2(); }
+
+  unsigned int _n_params;
+  std::size_t _width;
+  bool _resample;
+  /// Upper triangle of the sum over the rows of the products of the results of two matrices
+  std::vector<Real> _gram;
+  Real _count = 0;
+};
+
+/**
+ * Merges the accumulators of all the processors of comm into the one of processor 0 along a
+ * binary tree (log2 of the number of processors rounds of one message), then broadcasts the
+ * result so every processor holds the merged accumulator
+ */
+template <typename T>
+void
+treeReduce(const libMesh::Parallel::Communicator & comm, T & accumulator)
+{
+  const processor_id_type rank = comm.rank();
+  const processor_id_type size = comm.size();
+  std::vector<Real> buffer;
+  for (processor_id_type step = 1; step < size; step *= 2)
+  {
+    if (rank % (2 * step) == step)
+    {
+      accumulator.pack(buffer);
+      comm.send(rank - step, buffer);
+      break;
+    }
+    if (rank % (2 * step) == 0 && rank + step < size)
+    {
+      comm.receive(rank + step, buffer);
+      T other = accumulator;
+      other.unpack(buffer);
+      accumulator.merge(other);
+    }
+  }
+
+  accumulator.pack(buffer);
+  comm.broadcast(buffer);
+  accumulator.unpack(buffer);
+}
+}
@@ -35,6 +35,9 @@ protected:
   /// Result vectors from StocasticResults object
   std::vector<std::pair<const VectorPostprocessorValue *, bool>> _result_vectors;
 
+  /// Whether the indices are accumulated over the local rows and merged (see StreamingSobol)
+  const bool _streaming;
+
   /// Vectors computed by this object
   std::vector<VectorPostprocessorValue *> _sobol_stat_vectors;
 
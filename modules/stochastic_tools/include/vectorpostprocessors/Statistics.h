@@ -45,6 +45,13 @@ protected:
   /// The VPP vector that will hold the statistics identifiers
   VectorPostprocessorValue & _stat_type_vector;
 
+  /**
+   * Whether the statistics are accumulated in a single pass over the local entries of each
+   * vector and merged over the processors (see StreamingCalculators), rather than computed by the
+   * Calculators from the full vectors
+   */
+  const bool _streaming;
+
   /// Confidence level calculator
   std::unique_ptr<const StochasticTools::BootstrapCalculator> _ci_calculator = nullptr;
 
@@ -12,6 +12,7 @@
 // MOOSE includes
 #include "GeneralVectorPostprocessor.h"
 #include "StochasticResultsAction.h"
+#include "DistributedData.h"
 
 /**
  * Storage helper for managing data being assigned to this VPP by a Transfer object.
@@ -22,6 +23,9 @@ struct StochasticResultsData
   VectorPostprocessorName name;
   VectorPostprocessorValue * vector;
   VectorPostprocessorValue current;
+
+  /// The entries of rows scheduled dynamically keyed by their global row, created on first use
+  std::unique_ptr<StochasticTools::DistributedData<Real>> dynamic;
 };
 
 /**
@@ -55,6 +59,17 @@ public:
   void setCurrentLocalVectorPostprocessorValue(const std::string & vector_name,
                                                const VectorPostprocessorValue && current);
 
+  /**
+   * The same, for data of rows handed out at run time (see StochasticTools::DynamicSampleQueue)
+   * rather than the local rows of the Sampler: the entries are stored in a DistributedData keyed
+   * by their row and gathered in row order by finalize().
+   *
+   * @param rows: the global row of each entry of current
+   */
+  void setCurrentLocalVectorPostprocessorValue(const std::string & vector_name,
+                                               const VectorPostprocessorValue && current,
+                                               const std::vector<dof_id_type> & rows);
+
 protected:
   /// Storage for declared vectors
   std::vector<StochasticResultsData> _sample_vectors;
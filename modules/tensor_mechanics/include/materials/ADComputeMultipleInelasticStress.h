@@ -44,6 +44,9 @@ protected:
 
   virtual void computeQpStress() override;
 
+  /// Resets the element elastic flag before the qp loop
+  virtual void computeProperties() override;
+
   /**
     Compute the stress for the current QP, but do not rotate tensors from the
     intermediate configuration to the new configuration
@@ -135,6 +138,28 @@ protected:
    */
   std::vector<ADStressUpdateBase *> _models;
 
+  /**
+   * Whether each model is asked (isInelasticActive) if the trial stress needs its correction
+   * before updateState, the inactive models being skipped at the qp
+   */
+  const bool _elastic_predictor_check;
+
+  /// The models active at the current qp, from the elastic predictor check
+  std::vector<bool> _model_active;
+
+  /**
+   * Whether no model has been active at the qps of the current element so far: the stress is
+   * then the trial stress and the Jacobian the elasticity tensor, without the inelastic
+   * iterations or the tangent operators of the models
+   */
+  bool _elem_elastic;
+
+  /**
+   * Runs the elastic predictor check of the models at the current qp, filling _model_active
+   * @return Whether any model is active
+   */
+  bool checkElasticPredictor();
+
   /// is the elasticity tensor guaranteed to be isotropic?
   bool _is_elasticity_tensor_guaranteed_isotropic;
 };
@@ -39,6 +39,9 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void propagateQpStatefulProperties() override;
 
+  /// The yield stress at the old hardening variable
+  virtual Real elasticThreshold() override;
+
   virtual void computeStressInitialize(const ADReal & effective_trial_stress,
                                        const ADRankFourTensor & elasticity_tensor) override;
   virtual ADReal computeResidual(const ADReal & effective_trial_stress,
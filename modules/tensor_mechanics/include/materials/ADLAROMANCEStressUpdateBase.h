@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ADRadialReturnCreepStressUpdateBase.h"
+#include "LAROMANCEPolynomial.h"
 
 enum class ROMInputTransform
 {
@@ -71,6 +72,26 @@ protected:
   ADReal
   computeROM(const unsigned int tile, const unsigned out_index, const bool derivative = false);
 
+  /**
+   * Fills the collapsed expansions (see LAROMANCEPolynomial) of every tile and output at all the
+   * qps of the element, from the raw values of the inputs other than stress, before the radial
+   * return iterations, which then only evaluate polynomials of the stress. The expansions of a qp
+   * are only rebuilt if its normalized inputs changed: the old dislocation densities and strain
+   * are fixed within a time step, so only a changing temperature or environmental factor makes
+   * the later residual and Jacobian evaluations of the step rebuild them.
+   */
+  void precomputeROMBatch();
+
+  /**
+   * computeROM with the collapsed expansion of the current qp: the value and derivative with
+   * respect to the trial stress in Real arithmetic, assembled into an ADReal by the chain rule
+   * through the AD stress and temperature only at the end
+   */
+  ADReal computeROMBatch(const unsigned int tile,
+                         const unsigned out_index,
+                         const ADReal & effective_trial_stress,
+                         const bool derivative = false);
+
   /**
    * Method to check input values against applicability windows set by ROM data set.
    * @param input Input value
@@ -496,4 +517,22 @@ protected:
 
   /// Container for tiling orientations
   std::vector<unsigned int> _tiling;
+
+  /// Whether the ROM is evaluated through the collapsed Real expansions of the element's qps
+  const bool _batched_rom;
+
+  /// The collapsed polynomial of each output (built in initialSetup)
+  std::vector<std::unique_ptr<LAROMANCEPolynomial>> _rom_polynomials;
+
+  /**
+   * The collapsed expansions, [qp][tile][output] blocks of collapsedSize() values, and the
+   * normalized input values they were built from, [qp][tile][output][input]
+   */
+  std::vector<Real> _collapsed_rom;
+  std::vector<Real> _normalized_inputs;
+
+  ///@{ The element and time step the cache was built for (a new step rebuilds it)
+  dof_id_type _collapsed_rom_elem;
+  int _collapsed_rom_step;
+  ///@}
 };
@@ -42,6 +42,12 @@ protected:
   virtual ADReal computeDerivative(const ADReal & effective_trial_stress,
                                    const ADReal & scalar) override;
 
+  /**
+   * The effective stress at which the creep strain of the step, computed with the trial stress,
+   * reaches elastic_creep_strain_tolerance
+   */
+  virtual Real elasticThreshold() override;
+
   /// Temperature variable value
   const ADVariableValue * const _temperature;
 
@@ -68,4 +74,7 @@ protected:
 
   /// Exponential calculated from current time
   Real _exp_time;
+
+  /// Creep strain increment below which the step is treated as elastic (0 never skips the model)
+  const Real _elastic_creep_strain_tolerance;
 };
@@ -59,6 +59,18 @@ public:
                                   const ADRankFourTensor & elasticity_tensor,
                                   const RankTwoTensor & elastic_strain_old) override;
 
+  /**
+   * Active if the effective trial stress exceeds elasticThreshold()
+   */
+  virtual bool isInelasticActive(const ADRankTwoTensor & trial_stress,
+                                 const ADRankFourTensor & /*elasticity_tensor*/) override
+  {
+    const ADRankTwoTensor deviatoric_trial_stress = trial_stress.deviatoric();
+    const ADReal effective_trial_stress =
+        std::sqrt(1.5 * deviatoric_trial_stress.doubleContraction(deviatoric_trial_stress));
+    return MetaPhysicL::raw_value(effective_trial_stress) > elasticThreshold();
+  }
+
   virtual Real computeReferenceResidual(const ADReal & effective_trial_stress,
                                         const ADReal & scalar_effective_inelastic_strain) override;
 
@@ -92,6 +104,12 @@ public:
 protected:
   virtual void initQpStatefulProperties() override;
 
+  /**
+   * The effective stress below which the model produces no inelastic strain at the current qp,
+   * for isInelasticActive(). Negative, so never skipped, by default.
+   */
+  virtual Real elasticThreshold() { return -1.0; }
+
   /**
    * Propagate the properties pertaining to this intermediate class.  This
    * is intended to be called from propagateQpStatefulProperties() in
@@ -86,6 +86,16 @@ public:
    */
   virtual bool requiresIsotropicTensor() = 0;
 
+  /**
+   * Cheap admissibility check of the trial stress, as StressUpdateBase::isInelasticActive: false
+   * means updateState would leave the trial stress (and its derivatives) unchanged
+   */
+  virtual bool isInelasticActive(const ADRankTwoTensor & /*trial_stress*/,
+                                 const ADRankFourTensor & /*elasticity_tensor*/)
+  {
+    return true;
+  }
+
   virtual Real computeTimeStepLimit();
 
   ///@{ Retained as empty methods to avoid a warning from Material.C in framework. These methods are unused in all inheriting classes and should not be overwritten.
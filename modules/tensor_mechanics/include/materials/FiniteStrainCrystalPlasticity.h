@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ComputeStressBase.h"
+#include "CrystalPlasticityGSSKernel.h"
 
 /**
  * FiniteStrainCrystalPlasticity uses the multiplicative decomposition of deformation gradient
@@ -219,6 +220,13 @@ protected:
    */
   void internalVariableUpdateNRiteration();
 
+  /**
+   * getSlipIncrements() and update_slip_system_resistance() through the fused kernel,
+   * when fused_update is set
+   */
+  bool getSlipIncrementsFused();
+  void updateSlipSystemResistanceFused();
+
   /// Number of slip system resistance
   const unsigned int _nss;
 
@@ -349,6 +357,21 @@ protected:
   RankTwoTensor _delta_dfgrd, _dfgrd_tmp_old;
   ///Scales the substepping increment to obtain deformation gradient at a substep iteration
   Real _dfgrd_scale_factor;
+
+  /// Whether the slip systems are updated together by _gss_kernel
+  const bool _fused_update;
+
+  /**
+   * The fixed-size update of the slip systems (built for _nss systems in initialSetup), which
+   * keeps its per slip system data while a quadrature point is solved
+   */
+  std::unique_ptr<CrystalPlasticity::GSSKernelBase> _gss_kernel;
+
+  ///@{ Buffers of the fused update, sized once
+  std::array<Real, 9> _pk2_components;
+  std::array<Real, 9> _flow_increment;
+  std::array<Real, 81> _flow_derivative;
+  ///@}
   ///Flags to reset variables and reinitialize variables
   bool _first_step_iter, _last_step_iter, _first_substep;
 };
@@ -15,6 +15,7 @@
 #include "CrystalPlasticitySlipResistance.h"
 #include "CrystalPlasticityStateVariable.h"
 #include "CrystalPlasticityStateVarRateComponent.h"
+#include "CrystalPlasticityGSSKernel.h"
 
 /**
  * FiniteStrainUObasedCP uses the multiplicative decomposition of deformation gradient
@@ -149,6 +150,16 @@ protected:
    */
   virtual bool isStateVariablesConverged();
 
+  /**
+   * Whether the user objects are the single slip rate, resistance, state variable and rate
+   * component of the GSS model, which the fused kernel can replace
+   */
+  bool canUseFusedUpdate() const;
+
+  /// Slip rates and state variable update of the GSS user objects through _gss_kernel
+  bool getSlipRatesFused();
+  void updateStateVariableFused();
+
   /// User objects that define the slip rate
   std::vector<const CrystalPlasticitySlipRate *> _uo_slip_rates;
 
@@ -197,6 +208,16 @@ protected:
   /// Local old state variable
   std::vector<std::vector<Real>> _state_vars_prev;
 
+  /// Whether the GSS slip systems are updated together by _gss_kernel
+  const bool _fused_update;
+
+  /**
+   * The fused update of the slip systems, built from the parameters of the GSS user objects if
+   * fused_update is set and canUseFusedUpdate(): the user objects are then only called to
+   * initialize the state variables and to fill the output properties after the solve
+   */
+  std::unique_ptr<CrystalPlasticity::GSSKernelBase> _gss_kernel;
+
   /// Stress residual equation relative tolerance
   Real _rtol;
   /// Stress residual equation absolute tolerance
@@ -40,6 +40,12 @@ protected:
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
 
+  /**
+   * The effective stress at which the creep strain of the step, computed with the trial stress,
+   * reaches elastic_creep_strain_tolerance
+   */
+  virtual Real elasticThreshold() override;
+
   /// Flag to determine if temperature is supplied by the user
   const bool _has_temp;
 
@@ -69,4 +75,7 @@ protected:
 
   /// Exponential calculated from current time
   Real _exp_time;
+
+  /// Creep strain increment below which the step is treated as elastic (0 never skips the model)
+  const Real _elastic_creep_strain_tolerance;
 };
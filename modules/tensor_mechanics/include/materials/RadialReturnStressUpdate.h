@@ -67,6 +67,18 @@ public:
                                   bool compute_full_tangent_operator,
                                   RankFourTensor & tangent_operator) override;
 
+  /**
+   * Active if the effective trial stress exceeds elasticThreshold()
+   */
+  virtual bool isInelasticActive(const RankTwoTensor & trial_stress,
+                                 const RankFourTensor & /*elasticity_tensor*/) override
+  {
+    const RankTwoTensor deviatoric_trial_stress = trial_stress.deviatoric();
+    const Real effective_trial_stress =
+        std::sqrt(1.5 * deviatoric_trial_stress.doubleContraction(deviatoric_trial_stress));
+    return effective_trial_stress > elasticThreshold();
+  }
+
   virtual Real computeReferenceResidual(const Real effective_trial_stress,
                                         const Real scalar_effective_inelastic_strain) override;
 
@@ -115,6 +127,12 @@ protected:
    */
   void propagateQpStatefulPropertiesRadialReturn();
 
+  /**
+   * The effective stress below which the model produces no inelastic strain at the current qp
+   * (from the old state), for isInelasticActive(). Negative, so never skipped, by default.
+   */
+  virtual Real elasticThreshold() { return -1.0; }
+
   /**
    * Perform any necessary initialization before return mapping iterations
    * @param effective_trial_stress Effective trial stress
@@ -120,6 +120,20 @@ public:
    */
   virtual bool isIsotropic() { return false; };
 
+  /**
+   * Cheap admissibility check of the trial stress, made by ComputeMultipleInelasticStress before
+   * updateState when elastic_predictor_check is set. Returning false promises that updateState
+   * would return the trial stress unchanged with a negligible inelastic strain (for instance a
+   * trial effective stress below the yield stress), so the model is skipped at this qp and
+   * propagateQpStatefulProperties() is called instead. The default is always true: a model is
+   * only skipped if it implements the check.
+   */
+  virtual bool isInelasticActive(const RankTwoTensor & /*trial_stress*/,
+                                 const RankFourTensor & /*elasticity_tensor*/)
+  {
+    return true;
+  }
+
   virtual Real computeTimeStepLimit();
 
   virtual TangentCalculationMethod getTangentCalculationMethod()
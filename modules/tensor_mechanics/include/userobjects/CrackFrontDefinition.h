@@ -12,6 +12,7 @@
 #include "GeneralUserObject.h"
 #include "CrackFrontPointsProvider.h"
 #include "BoundaryRestrictable.h"
+#include "DomainIntegralQCache.h"
 #include <set>
 #include "ADRankTwoTensorForward.h"
 
@@ -235,6 +236,19 @@ public:
                                           std::size_t ring_index,
                                           const Node * const current_node) const;
 
+  /**
+   * The nonzero q functions of all the crack front points and rings at the nodes of an element,
+   * from the cache (built for the element on first use after the front moved)
+   * @param elem The element
+   * @param num_rings The number of rings of the integrals
+   * @param topological Whether the topological q function is used
+   */
+  const DomainIntegralQCache::Entry &
+  getQFunctionValues(const Elem * elem, std::size_t num_rings, bool topological) const;
+
+  /// Incremented each time the crack front geometry is updated
+  unsigned long frontGeneration() const { return _q_cache.generation(); }
+
 protected:
   /// Enum used to define the method for computing the crack extension direction
   const enum class DIRECTION_METHOD {
@@ -354,6 +368,18 @@ protected:
   /// Number of points coming from the CrackFrontPointsProvider
   std::size_t _num_points_from_provider;
 
+  /// Nonzero q function values per element, invalidated when the crack front geometry changes
+  mutable DomainIntegralQCache _q_cache;
+
+  /**
+   * The crack front points within the largest outer ring radius of the bounding box of an
+   * element, the only ones whose geometric q functions may be nonzero on it (all the points for
+   * the topological q functions)
+   */
+  void candidateFrontPoints(const Elem * elem,
+                            bool topological,
+                            std::vector<std::size_t> & points) const;
+
   /**
    * Get the set of all crack front nodes
    * @param nodes Set of nodes -- populated by this method
@@ -0,0 +1,58 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "ElementStableDTInterface.h"
+#include "GuaranteeConsumer.h"
+
+/**
+ * Computes the critical time step of each element for an explicit integration scheme, the time
+ * the fastest (dilatational) wave takes to cross the element: h_min / sqrt(effective_stiffness /
+ * density), with the effective stiffness of the elasticity tensor (see CriticalTimeStep for the
+ * smallest value only).
+ */
+class ElementCriticalTimeStep : public ElementUserObject,
+                                public ElementStableDTInterface,
+                                public GuaranteeConsumer
+{
+public:
+  static InputParameters validParams();
+
+  ElementCriticalTimeStep(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  virtual const std::vector<dof_id_type> & elementIds() const override { return _elem_ids; }
+  virtual const std::vector<Real> & elementStableDT() const override { return _elem_dt; }
+  virtual Real minimumStableDT() const override { return _minimum_dt; }
+
+protected:
+  /// Density of the material
+  const MaterialProperty<Real> & _material_density;
+
+  /// Effective stiffness of element: function of material properties and element size
+  const MaterialProperty<Real> & _effective_stiffness;
+
+  /// User defined factor to be multiplied to the critical time step
+  const Real & _factor;
+
+  ///@{ The local elements and their critical time step
+  std::vector<dof_id_type> _elem_ids;
+  std::vector<Real> _elem_dt;
+  ///@}
+
+  /// The smallest critical time step over all the elements
+  Real _minimum_dt;
+};
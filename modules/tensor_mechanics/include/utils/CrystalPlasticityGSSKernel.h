@@ -0,0 +1,259 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace CrystalPlasticity
+{
+/**
+ * The slip system part of the phenomenological (GSS) model of FiniteStrainCrystalPlasticity and
+ * of the CrystalPlasticitySlipRateGSS / StateVarRateComponentGSS user objects, evaluated for all
+ * the slip systems at once:
+ *
+ *   tau_a = S_a : pk2,
+ *   dgamma_a = a0_a |tau_a / g_a|^(1 / xm_a) sign(tau_a) dt,
+ *   g_a = g_a^old + sum_b q_ab h0 |1 - g_b / tau_sat|^r sign(1 - g_b / tau_sat) |dgamma_b|,
+ *
+ * with q_ab = 1 on the systems of a plane (3 consecutive systems, as in the slip system files) and
+ * q_latent on the others. The number of slip systems is a template parameter, so all the per
+ * system data are fixed-size arrays of the object (no allocation in the local Newton loops) and
+ * every loop runs over contiguous arrays of known length without branches, which the compiler
+ * unrolls and vectorizes across the slip systems. The Schmid tensors are stored component-major
+ * for the same reason.
+ *
+ * GSSKernelBase is the interface the materials hold, instantiated by buildGSSKernel() for the
+ * usual crystal structures (FCC 12, BCC 12/24/48, HCP 18/24/30 systems): one virtual call per
+ * Newton iteration replaces one per slip system and user object.
+ */
+class GSSKernelBase
+{
+public:
+  virtual ~GSSKernelBase() = default;
+
+  /// The number of slip systems
+  virtual unsigned int size() const = 0;
+
+  /**
+   * Sets the flow parameters and the Schmid tensors
+   * @param schmid The 9 components (row-major) of the Schmid tensor of each slip system
+   */
+  virtual void setSlipSystems(const std::vector<std::array<Real, 9>> & schmid,
+                              const std::vector<Real> & a0,
+                              const std::vector<Real> & xm) = 0;
+
+  /// Sets the hardening parameters
+  virtual void setHardening(Real h0, Real tau_sat, Real exponent, Real q_latent) = 0;
+
+  ///@{ The slip resistances of the beginning of the step and of the current iteration
+  virtual void setResistance(const std::vector<Real> & g_old, const std::vector<Real> & g) = 0;
+  virtual void getResistance(std::vector<Real> & g) const = 0;
+  ///@}
+
+  /**
+   * The resolved shear stresses, slip increments and their derivatives with respect to the
+   * resolved shear stresses
+   * @param pk2 The components (row-major) of the second Piola-Kirchhoff stress
+   * @return false if a slip increment exceeds slip_incr_tol (the step should be cut)
+   */
+  virtual bool slipIncrements(const std::array<Real, 9> & pk2, Real dt, Real slip_incr_tol) = 0;
+
+  /**
+   * Updates the resistances from the slip increments
+   * @return The largest change of resistance
+   */
+  virtual Real updateResistance() = 0;
+
+  /// sum_a dgamma_a S_a, the plastic velocity gradient times dt
+  virtual void flowIncrement(std::array<Real, 9> & dflow) const = 0;
+
+  /// sum_a (d dgamma_a / d tau_a) S_a (x) S_a, for the Jacobian of the stress residual
+  virtual void flowDerivative(std::array<Real, 81> & dflow_dpk2) const = 0;
+
+  /// The slip increments, for the accumulated slip and the output properties
+  virtual void getSlipIncrements(std::vector<Real> & slip_incr) const = 0;
+};
+
+template <unsigned int N>
+class GSSKernel : public GSSKernelBase
+{
+public:
+  virtual unsigned int size() const override { return N; }
+
+  virtual void setSlipSystems(const std::vector<std::array<Real, 9>> & schmid,
+                              const std::vector<Real> & a0,
+                              const std::vector<Real> & xm) override
+  {
+    if (schmid.size() != N || a0.size() != N || xm.size() != N)
+      mooseError("The fused crystal plasticity update was built for ", N, " slip systems");
+    for (unsigned int a = 0; a < N; ++a)
+    {
+      for (unsigned int c = 0; c < 9; ++c)
+        _schmid[c][a] = schmid[a][c];
+      _a0[a] = a0[a];
+      _xm_inv[a] = 1.0 / xm[a];
+    }
+  }
+
+  virtual void setHardening(Real h0, Real tau_sat, Real exponent, Real q_latent) override
+  {
+    _h0 = h0;
+    _tau_sat = tau_sat;
+    _exponent = exponent;
+    _q_latent = q_latent;
+  }
+
+  virtual void setResistance(const std::vector<Real> & g_old, const std::vector<Real> & g) override
+  {
+    mooseAssert(g_old.size() == N && g.size() == N, "The slip resistances have the wrong size");
+    for (unsigned int a = 0; a < N; ++a)
+    {
+      _g_old[a] = g_old[a];
+      _g[a] = g[a];
+    }
+  }
+
+  virtual void getResistance(std::vector<Real> & g) const override
+  {
+    g.assign(_g.begin(), _g.end());
+  }
+
+  virtual bool
+  slipIncrements(const std::array<Real, 9> & pk2, Real dt, Real slip_incr_tol) override
+  {
+    _tau.fill(0.0);
+    for (unsigned int c = 0; c < 9; ++c)
+      for (unsigned int a = 0; a < N; ++a)
+        _tau[a] += _schmid[c][a] * pk2[c];
+
+    Real max_incr = 0;
+    for (unsigned int a = 0; a < N; ++a)
+    {
+      const Real ratio = std::abs(_tau[a] / _g[a]);
+      const Real power = std::pow(ratio, _xm_inv[a]);
+      _slip_incr[a] = std::copysign(_a0[a] * power * dt, _tau[a]);
+      // a0 / xm |tau / g|^(1 / xm - 1) / g dt, written without dividing by a zero ratio
+      _dslipdtau[a] = ratio > 0 ? _a0[a] * _xm_inv[a] * power / (ratio * _g[a]) * dt : 0.0;
+      max_incr = std::max(max_incr, std::abs(_slip_incr[a]));
+    }
+    return max_incr <= slip_incr_tol;
+  }
+
+  virtual Real updateResistance() override
+  {
+    // h_b |dgamma_b|, then the self (same plane) and latent sums
+    std::array<Real, N> hardening;
+    for (unsigned int b = 0; b < N; ++b)
+    {
+      const Real ratio = 1.0 - _g[b] / _tau_sat;
+      hardening[b] = std::copysign(_h0 * std::pow(std::abs(ratio), _exponent), ratio) *
+                     std::abs(_slip_incr[b]);
+    }
+
+    Real total = 0;
+    for (unsigned int b = 0; b < N; ++b)
+      total += hardening[b];
+
+    Real max_change = 0;
+    for (unsigned int a = 0; a < N; ++a)
+    {
+      const unsigned int plane = a - a % 3;
+      Real self = 0;
+      for (unsigned int b = plane; b < plane + 3 && b < N; ++b)
+        self += hardening[b];
+      const Real g = _g_old[a] + self + _q_latent * (total - self);
+      max_change = std::max(max_change, std::abs(g - _g[a]));
+      _g[a] = g;
+    }
+    return max_change;
+  }
+
+  virtual void flowIncrement(std::array<Real, 9> & dflow) const override
+  {
+    for (unsigned int c = 0; c < 9; ++c)
+    {
+      Real sum = 0;
+      for (unsigned int a = 0; a < N; ++a)
+        sum += _slip_incr[a] * _schmid[c][a];
+      dflow[c] = sum;
+    }
+  }
+
+  virtual void flowDerivative(std::array<Real, 81> & dflow_dpk2) const override
+  {
+    // Upper triangle, then mirrored: the tensor is symmetric in its two index pairs
+    for (unsigned int c = 0; c < 9; ++c)
+      for (unsigned int d = c; d < 9; ++d)
+      {
+        Real sum = 0;
+        for (unsigned int a = 0; a < N; ++a)
+          sum += _dslipdtau[a] * _schmid[c][a] * _schmid[d][a];
+        dflow_dpk2[c * 9 + d] = dflow_dpk2[d * 9 + c] = sum;
+      }
+  }
+
+  virtual void getSlipIncrements(std::vector<Real> & slip_incr) const override
+  {
+    slip_incr.assign(_slip_incr.begin(), _slip_incr.end());
+  }
+
+  ///@{ Direct access for the templated callers
+  const std::array<Real, N> & resolvedShearStress() const { return _tau; }
+  const std::array<Real, N> & slipIncrement() const { return _slip_incr; }
+  const std::array<Real, N> & slipIncrementDerivative() const { return _dslipdtau; }
+  const std::array<Real, N> & resistance() const { return _g; }
+  ///@}
+
+private:
+  /// The Schmid tensors, component-major: _schmid[c][a] is component c of system a
+  std::array<std::array<Real, N>, 9> _schmid;
+  std::array<Real, N> _a0;
+  std::array<Real, N> _xm_inv;
+
+  std::array<Real, N> _g_old;
+  std::array<Real, N> _g;
+  std::array<Real, N> _tau;
+  std::array<Real, N> _slip_incr;
+  std::array<Real, N> _dslipdtau;
+
+  Real _h0 = 0;
+  Real _tau_sat = 1;
+  Real _exponent = 1;
+  Real _q_latent = 1;
+};
+
+/// The kernel for the number of slip systems, or nullptr if there is no instantiation for it
+inline std::unique_ptr<GSSKernelBase>
+buildGSSKernel(unsigned int nss)
+{
+  switch (nss)
+  {
+    case 12:
+      return std::make_unique<GSSKernel<12>>();
+    case 18:
+      return std::make_unique<GSSKernel<18>>();
+    case 24:
+      return std::make_unique<GSSKernel<24>>();
+    case 30:
+      return std::make_unique<GSSKernel<30>>();
+    case 48:
+      return std::make_unique<GSSKernel<48>>();
+    default:
+      return nullptr;
+  }
+}
+}
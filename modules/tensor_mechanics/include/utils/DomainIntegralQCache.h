@@ -0,0 +1,148 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/threads.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The nonzero q functions of the domain integrals on each element, for all the crack front points
+ * and rings at once, as computed by CrackFrontDefinition::DomainIntegralQFunction (or the
+ * topological variant) at the element nodes. An element only lies in the domains of a few
+ * front points, so JIntegral and InteractionIntegral then visit each element once for all the
+ * points and rings with a nonzero q there, instead of evaluating q at every node for every
+ * point and ring in every execution.
+ *
+ * The entries are keyed by the element, the number of rings and the kind of q function, as
+ * integrals with different rings or q functions may share the CrackFrontDefinition. They stay
+ * valid until invalidate(), which CrackFrontDefinition calls when the crack front moves. Entries
+ * are built on first use under a mutex, so the threaded element loops of the integrals share one
+ * cache; an entry is not modified once built.
+ */
+class DomainIntegralQCache
+{
+public:
+  /// The q function of one front point and ring at the nodes of an element
+  struct Block
+  {
+    std::size_t point;
+    std::size_t ring;
+    /// Offset of the nodal values in Entry::q
+    std::size_t offset;
+  };
+
+  struct Entry
+  {
+    unsigned int n_nodes = 0;
+    std::vector<Block> blocks;
+    std::vector<Real> q;
+
+    const Real * values(const Block & block) const { return &q[block.offset]; }
+  };
+
+  /**
+   * The nonzero q functions of an element
+   * @param n_rings The number of rings of the integral
+   * @param topological Whether q is the topological q function
+   * @param candidate_points candidate_points(points) fills the front points whose domains may
+   * contain the element (for instance from the outer radius of the last ring)
+   * @param q q(point, ring, node) is the q function at node node of the element
+   */
+  template <typename Candidates, typename QFunction>
+  const Entry & get(dof_id_type elem_id,
+                    unsigned int n_nodes,
+                    std::size_t n_rings,
+                    bool topological,
+                    const Candidates & candidate_points,
+                    const QFunction & q)
+  {
+    const Key key{elem_id, n_rings, topological};
+    {
+      Threads::spin_mutex::scoped_lock lock(_mutex);
+      const auto it = _entries.find(key);
+      if (it != _entries.end())
+        return *it->second;
+    }
+
+    // Built outside the lock; another thread may build the same element meanwhile, and the first
+    // one inserted is kept
+    auto entry = std::make_unique<Entry>();
+    entry->n_nodes = n_nodes;
+    std::vector<std::size_t> points;
+    candidate_points(points);
+    std::vector<Real> values(n_nodes);
+    for (const auto point : points)
+      for (std::size_t ring = 0; ring < n_rings; ++ring)
+      {
+        bool nonzero = false;
+        for (unsigned int n = 0; n < n_nodes; ++n)
+        {
+          values[n] = q(point, ring, n);
+          nonzero = nonzero || values[n] != 0;
+        }
+        if (!nonzero)
+          continue;
+        entry->blocks.push_back({point, ring, entry->q.size()});
+        entry->q.insert(entry->q.end(), values.begin(), values.end());
+      }
+
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    const auto inserted = _entries.emplace(key, std::move(entry));
+    return *inserted.first->second;
+  }
+
+  /// Drops all the entries, when the crack front or the mesh changes
+  void invalidate()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    _entries.clear();
+    ++_generation;
+  }
+
+  /// Incremented by invalidate(), so the users can tell the front changed
+  unsigned long generation() const { return _generation; }
+
+  std::size_t size() const
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+    return _entries.size();
+  }
+
+private:
+  struct Key
+  {
+    dof_id_type elem_id;
+    std::size_t n_rings;
+    bool topological;
+
+    bool operator==(const Key & other) const
+    {
+      return elem_id == other.elem_id && n_rings == other.n_rings &&
+             topological == other.topological;
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key & key) const
+    {
+      return (std::size_t(key.elem_id) * 31 + key.n_rings) * 2 + key.topological;
+    }
+  };
+
+  std::unordered_map<Key, std::unique_ptr<Entry>, KeyHash> _entries;
+  unsigned long _generation = 0;
+  mutable Threads::spin_mutex _mutex;
+};
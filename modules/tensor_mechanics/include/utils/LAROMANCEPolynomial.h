@@ -0,0 +1,194 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <vector>
+
+/**
+ * Plain Real evaluation of the Legendre polynomial expansion of a LAROMANCE tile output,
+ *
+ *   y(x) = sum_p c_p prod_i P_{m(p, i)}(x_i),
+ *
+ * where m(p, i) (the makeframe helper of ADLAROMANCEStressUpdateBase, m[p + num_coefs * i]) is the
+ * degree of input i in coefficient p. Within a time step only the stress input changes during the
+ * radial return iterations, so collapse() sums the expansion over the other inputs once, leaving
+ * the (degree) coefficients of a polynomial of the normalized stress,
+ *
+ *   y(s) = sum_d A_d P_d(s),
+ *
+ * and each Newton iteration only evaluates it and its derivative. The derivatives of A_d with
+ * respect to the other normalized inputs are kept too, so the AD derivatives of the output (for
+ * instance with respect to the temperature) can be rebuilt by the chain rule without AD
+ * arithmetic in the expansion.
+ *
+ * The collapsed coefficients of the quadrature points of an element are stored qp-major, and
+ * evaluate() runs over all of them at once.
+ */
+class LAROMANCEPolynomial
+{
+public:
+  /**
+   * @param num_inputs The number of ROM inputs
+   * @param degree The Legendre polynomial degree (the highest degree of an input is degree - 1)
+   * @param stress_index The index of the stress input
+   * @param makeframe_helper The degrees of the inputs in each coefficient, input-major
+   */
+  LAROMANCEPolynomial(unsigned int num_inputs,
+                      unsigned int degree,
+                      unsigned int stress_index,
+                      const std::vector<unsigned int> & makeframe_helper)
+    : _num_inputs(num_inputs),
+      _degree(degree),
+      _stress_index(stress_index),
+      _num_coefs(num_inputs ? makeframe_helper.size() / num_inputs : 0),
+      _makeframe_helper(makeframe_helper)
+  {
+    if (_num_inputs == 0 || _degree == 0)
+      mooseError("The LAROMANCE polynomial needs at least one input and degree");
+    if (_stress_index >= _num_inputs)
+      mooseError("The LAROMANCE stress input index is out of range");
+    if (_makeframe_helper.size() != _num_coefs * _num_inputs)
+      mooseError("The LAROMANCE makeframe helper is not a multiple of the number of inputs");
+    for (const auto m : _makeframe_helper)
+      if (m >= _degree)
+        mooseError("The LAROMANCE makeframe helper has a degree of ", m, " for degree ", _degree);
+  }
+
+  unsigned int numCoefs() const { return _num_coefs; }
+
+  /// The number of values collapse() stores per qp: A_d, then dA_d/dx_i for each input i
+  unsigned int collapsedSize() const { return _degree * (_num_inputs + 1); }
+
+  /// The Legendre polynomials P_0 ... P_{n-1} at x and their derivatives
+  static void legendre(Real x, unsigned int n, Real * values, Real * derivatives)
+  {
+    values[0] = 1;
+    derivatives[0] = 0;
+    if (n > 1)
+    {
+      values[1] = x;
+      derivatives[1] = 1;
+    }
+    // (k + 1) P_{k+1} = (2k + 1) x P_k - k P_{k-1}, differentiated term by term
+    for (unsigned int k = 1; k + 1 < n; ++k)
+    {
+      values[k + 1] = ((2 * k + 1) * x * values[k] - k * values[k - 1]) / (k + 1);
+      derivatives[k + 1] =
+          ((2 * k + 1) * (values[k] + x * derivatives[k]) - k * derivatives[k - 1]) / (k + 1);
+    }
+  }
+
+  /**
+   * Collapses the expansion over the inputs other than stress
+   * @param coefs The ROM coefficients c_p of the tile and output
+   * @param inputs The normalized inputs (the stress entry is not used)
+   * @param collapsed collapsedSize() values: A_d, then dA_d/dx_i input-major (zero for stress)
+   */
+  void collapse(const std::vector<Real> & coefs, const Real * inputs, Real * collapsed) const
+  {
+    mooseAssert(coefs.size() == _num_coefs, "Wrong number of LAROMANCE coefficients");
+    _values.resize(_num_inputs * _degree);
+    _derivatives.resize(_num_inputs * _degree);
+    for (unsigned int i = 0; i < _num_inputs; ++i)
+      legendre(inputs[i], _degree, &_values[i * _degree], &_derivatives[i * _degree]);
+
+    for (unsigned int k = 0; k < collapsedSize(); ++k)
+      collapsed[k] = 0;
+    for (unsigned int p = 0; p < _num_coefs; ++p)
+    {
+      // Product over the inputs except stress, and its partial derivatives
+      Real product = coefs[p];
+      for (unsigned int i = 0; i < _num_inputs; ++i)
+        if (i != _stress_index)
+          product *= _values[i * _degree + degree(p, i)];
+      const unsigned int d = degree(p, _stress_index);
+      collapsed[d] += product;
+
+      for (unsigned int j = 0; j < _num_inputs; ++j)
+      {
+        if (j == _stress_index)
+          continue;
+        Real partial = coefs[p] * _derivatives[j * _degree + degree(p, j)];
+        for (unsigned int i = 0; i < _num_inputs; ++i)
+          if (i != _stress_index && i != j)
+            partial *= _values[i * _degree + degree(p, i)];
+        collapsed[_degree * (j + 1) + d] += partial;
+      }
+    }
+  }
+
+  /**
+   * Evaluates the collapsed expansions of n points
+   * @param collapsed The collapsed coefficients of the points, collapsedSize() per point
+   * @param stress The normalized stress of each point
+   * @param values y(s) of each point
+   * @param stress_derivatives dy/ds of each point
+   */
+  void evaluate(unsigned int n,
+                const Real * collapsed,
+                const Real * stress,
+                Real * values,
+                Real * stress_derivatives) const
+  {
+    for (unsigned int q = 0; q < n; ++q)
+      clenshaw(collapsed + q * collapsedSize(), stress[q], values[q], stress_derivatives[q]);
+  }
+
+  /// dy/dx_i of a point at the normalized stress s, for an input i other than stress
+  Real inputDerivative(const Real * collapsed, unsigned int input, Real s) const
+  {
+    mooseAssert(input < _num_inputs && input != _stress_index, "Not a non-stress input");
+    Real value, derivative;
+    clenshaw(collapsed + _degree * (input + 1), s, value, derivative);
+    return value;
+  }
+
+private:
+  unsigned int degree(unsigned int p, unsigned int i) const
+  {
+    return _makeframe_helper[p + _num_coefs * i];
+  }
+
+  /**
+   * sum_d A_d P_d(s) and its derivative by the Clenshaw recurrence of the Legendre polynomials,
+   * P_{k+1} = (2k + 1) / (k + 1) s P_k - k / (k + 1) P_{k-1}
+   */
+  void clenshaw(const Real * A, Real s, Real & value, Real & derivative) const
+  {
+    Real b1 = 0, b2 = 0, db1 = 0, db2 = 0;
+    for (unsigned int k = _degree; k-- > 0;)
+    {
+      const Real alpha = Real(2 * k + 1) / (k + 1);
+      const Real beta = Real(k + 1) / (k + 2);
+      const Real b = A[k] + alpha * s * b1 - beta * b2;
+      const Real db = alpha * (b1 + s * db1) - beta * db2;
+      b2 = b1;
+      b1 = b;
+      db2 = db1;
+      db1 = db;
+    }
+    value = b1;
+    derivative = db1;
+  }
+
+  const unsigned int _num_inputs;
+  const unsigned int _degree;
+  const unsigned int _stress_index;
+  const unsigned int _num_coefs;
+  const std::vector<unsigned int> _makeframe_helper;
+
+  ///@{ Scratch space of collapse(), kept to avoid allocating per qp (materials are per thread)
+  mutable std::vector<Real> _values;
+  mutable std::vector<Real> _derivatives;
+  ///@}
+};
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "MultiPlasticityRawComponentAssembler.h"
+#include "SmallMatrixSolver.h"
 
 /**
  * MultiPlasticityLinearSystem computes the linear system
@@ -231,6 +232,35 @@ protected:
                       const std::vector<bool> & active,
                       std::vector<bool> & deactivated_due_to_ld);
 
+  /// The largest Newton system nrStep solves on the stack (6 stress + multipliers + internal)
+  static constexpr unsigned int _max_small_system = 24;
+
+  /**
+   * Solves jac x = rhs for nrStep with the fixed-size LU of SmallMatrix, rhs being replaced by
+   * x, instead of LAPACK on the std::vector storage, when the system has at most
+   * _max_small_system unknowns
+   * @return false if the system is larger or jac is numerically singular
+   */
+  bool solveSmallSystem(const std::vector<std::vector<Real>> & jac, std::vector<Real> & rhs) const
+  {
+    const unsigned int n = rhs.size();
+    if (n > _max_small_system || jac.size() != n)
+      return false;
+    SmallMatrix::Matrix<_max_small_system> A;
+    SmallMatrix::Vector<_max_small_system> b;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      for (unsigned int j = 0; j < n; ++j)
+        A[i][j] = jac[i][j];
+      b[i] = rhs[i];
+    }
+    if (!SmallMatrix::solve<_max_small_system>(A, b, n))
+      return false;
+    for (unsigned int i = 0; i < n; ++i)
+      rhs[i] = b[i];
+    return true;
+  }
+
 private:
   /**
    * Performs a singular-value decomposition of r and returns the singular values
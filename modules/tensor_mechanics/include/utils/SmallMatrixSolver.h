@@ -0,0 +1,154 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ * Dense linear solves and Newton iterations for the small local systems of the return-mapping
+ * algorithms (the stress, plastic multipliers and internal variables of a quadrature point),
+ * with the storage on the stack: the capacity N is a template parameter, while the size n of a
+ * system may be smaller (for the active constraints of multi-surface plasticity). Nothing is
+ * allocated and everything is inlined, where the DenseMatrix / std::vector and LAPACK path costs
+ * allocations and a library call per iteration for systems of a few tens of unknowns.
+ */
+namespace SmallMatrix
+{
+template <unsigned int N>
+using Vector = std::array<Real, N>;
+
+/// Row-major storage: A[i][j] is row i, column j
+template <unsigned int N>
+using Matrix = std::array<std::array<Real, N>, N>;
+
+/**
+ * LU decomposition of the leading n x n block with partial pivoting, in place
+ * @param pivots The row exchanged with each row
+ * @return false if a pivot is zero (or not finite) and the matrix is numerically singular
+ */
+template <unsigned int N>
+inline bool
+luFactor(Matrix<N> & A, std::array<unsigned int, N> & pivots, unsigned int n = N)
+{
+  for (unsigned int k = 0; k < n; ++k)
+  {
+    unsigned int p = k;
+    Real max = std::abs(A[k][k]);
+    for (unsigned int i = k + 1; i < n; ++i)
+      if (std::abs(A[i][k]) > max)
+      {
+        max = std::abs(A[i][k]);
+        p = i;
+      }
+    pivots[k] = p;
+    if (!(max > 0) || !std::isfinite(max))
+      return false;
+    if (p != k)
+      std::swap(A[p], A[k]);
+
+    const Real inv_pivot = 1.0 / A[k][k];
+    for (unsigned int i = k + 1; i < n; ++i)
+    {
+      const Real factor = A[i][k] * inv_pivot;
+      A[i][k] = factor;
+      for (unsigned int j = k + 1; j < n; ++j)
+        A[i][j] -= factor * A[k][j];
+    }
+  }
+  return true;
+}
+
+/// Solves A x = b with the factors of luFactor, b being replaced by x
+template <unsigned int N>
+inline void
+luSolve(const Matrix<N> & LU,
+        const std::array<unsigned int, N> & pivots,
+        Vector<N> & b,
+        unsigned int n = N)
+{
+  for (unsigned int k = 0; k < n; ++k)
+    if (pivots[k] != k)
+      std::swap(b[k], b[pivots[k]]);
+  for (unsigned int i = 1; i < n; ++i)
+    for (unsigned int j = 0; j < i; ++j)
+      b[i] -= LU[i][j] * b[j];
+  for (unsigned int i = n; i-- > 0;)
+  {
+    for (unsigned int j = i + 1; j < n; ++j)
+      b[i] -= LU[i][j] * b[j];
+    b[i] /= LU[i][i];
+  }
+}
+
+/**
+ * Solves A x = b, b being replaced by x (A is copied, so it is left unchanged)
+ * @return false if A is numerically singular
+ */
+template <unsigned int N>
+inline bool
+solve(Matrix<N> A, Vector<N> & b, unsigned int n = N)
+{
+  std::array<unsigned int, N> pivots;
+  if (!luFactor<N>(A, pivots, n))
+    return false;
+  luSolve<N>(A, pivots, b, n);
+  return true;
+}
+
+/// The Euclidean norm of the first n entries
+template <unsigned int N>
+inline Real
+norm(const Vector<N> & v, unsigned int n = N)
+{
+  Real sum = 0;
+  for (unsigned int i = 0; i < n; ++i)
+    sum += v[i] * v[i];
+  return std::sqrt(sum);
+}
+
+/**
+ * Newton iterations for R(x) = 0
+ * @param x The initial guess on entry, the solution on return
+ * @param residual residual(x, R, J) fills the residual R and the Jacobian J = dR/dx at x
+ * @param abs_tol, rel_tol Convergence when |R| <= max(abs_tol, rel_tol |R_0|)
+ * @return The number of iterations, -1 if not converged in max_its, -2 for a singular Jacobian
+ */
+template <unsigned int N, typename Residual>
+inline int
+newton(Vector<N> & x,
+       Residual && residual,
+       Real abs_tol,
+       Real rel_tol,
+       unsigned int max_its,
+       unsigned int n = N)
+{
+  Vector<N> R;
+  Matrix<N> J;
+  residual(x, R, J);
+  const Real tolerance = std::max(abs_tol, rel_tol * norm<N>(R, n));
+  for (unsigned int it = 0; it < max_its; ++it)
+  {
+    if (norm<N>(R, n) <= tolerance)
+      return it;
+    std::array<unsigned int, N> pivots;
+    if (!luFactor<N>(J, pivots, n))
+      return -2;
+    luSolve<N>(J, pivots, R, n);
+    for (unsigned int i = 0; i < n; ++i)
+      x[i] -= R[i];
+    residual(x, R, J);
+  }
+  return norm<N>(R, n) <= tolerance ? int(max_its) : -1;
+}
+}
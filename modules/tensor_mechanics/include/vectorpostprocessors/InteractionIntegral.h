@@ -45,6 +45,9 @@ public:
   static MooseEnum sifModeType();
 
 protected:
+  /// execute() for all the rings at once, over the cached nonzero q functions of the element
+  void executeAllRings();
+
   /**
    * Compute the contribution of a specific quadrature point to a fracture integral
    * for a point on the crack front.
@@ -105,6 +108,16 @@ protected:
   Real _youngs_modulus;
   /// Index of the ring for the integral computed by this object
   std::size_t _ring_index;
+
+  /**
+   * Whether all the rings are computed in one sweep over the elements, with the q functions
+   * of CrackFrontDefinition::getQFunctionValues, each ring to its own vector
+   */
+  const bool _all_rings;
+  /// The number of rings computed in one sweep
+  std::size_t _num_rings;
+  /// The integral of each ring, when all the rings are computed in one sweep
+  std::vector<VectorPostprocessorValue *> _ring_integrals;
   /// Derivative of the total eigenstrain with respect to temperature
   const MaterialProperty<RankTwoTensor> * const _total_deigenstrain_dT;
   /// Vector of q function values for the nodes in the current element
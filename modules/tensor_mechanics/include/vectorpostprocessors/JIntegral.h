@@ -33,6 +33,9 @@ public:
   virtual void threadJoin(const UserObject & y) override;
 
 protected:
+  /// execute() for all the rings at once, over the cached nonzero q functions of the element
+  void executeAllRings();
+
   /**
    * Compute the contribution of a specific quadrature point to the J integral
    * for a point on the crack front.
@@ -71,6 +74,16 @@ protected:
   Real _youngs_modulus;
   /// Index of the ring for the integral computed by this object
   std::size_t _ring_index;
+
+  /**
+   * Whether all the rings are computed in one sweep over the elements, with the q functions
+   * of CrackFrontDefinition::getQFunctionValues, each ring to its own vector
+   */
+  const bool _all_rings;
+  /// The number of rings computed in one sweep
+  std::size_t _num_rings;
+  /// The integral of each ring, when all the rings are computed in one sweep
+  std::vector<VectorPostprocessorValue *> _ring_integrals;
   /// Enum used to select the method used to compute the q function used
   /// in the fracture integrals
   const enum class QMethod { Geometry, Topology } _q_function_type;
@@ -28,6 +28,7 @@ protected:
   std::string _family;
   bool _xfem_cut_plane;
   bool _xfem_use_crack_growth_increment;
+  bool _xfem_incremental_update;
   Real _xfem_crack_growth_increment;
   bool _use_crack_tip_enrichment;
   UserObjectName _crack_front_definition;
@@ -12,6 +12,7 @@
 #include "ElementPairLocator.h"
 #include "ElementFragmentAlgorithm.h"
 #include "XFEMInterface.h"
+#include "PerfGraphInterface.h"
 #include "XFEMCrackGrowthIncrement2DCut.h"
 
 #include "libmesh/vector_value.h"
@@ -58,7 +59,7 @@ class EFAElement3D;
 
 // ------------------------------------------------------------
 // XFEM class definition
-class XFEM : public XFEMInterface
+class XFEM : public XFEMInterface, public PerfGraphInterface
 {
 public:
   explicit XFEM(const InputParameters & params);
@@ -121,6 +122,16 @@ public:
   bool healMesh();
 
   virtual bool updateHeal() override;
+
+  virtual const std::set<dof_id_type> & getChangedElems() const override { return _changed_elems; }
+  virtual bool supportsIncrementalUpdate() const override { return _incremental_update; }
+
+  /**
+   * Enable or disable the incremental mesh-change updates after cutting and healing (see
+   * FEProblemBase::meshChangedIncrementally())
+   */
+  void setIncrementalUpdate(bool incremental_update) { _incremental_update = incremental_update; }
+
   Point getEFANodeCoords(EFANode * CEMnode,
                          EFAElement * CEMElem,
                          const Elem * elem,
@@ -267,6 +278,14 @@ private:
   std::vector<const GeometricCutUserObject *> _geometric_cuts;
 
   std::map<unique_id_type, XFEMCutElem *> _cut_elem_map;
+
+  /**
+   * Hands the cached weights and volume fractions of the cut elements of the previous update to
+   * the elements of _cut_elem_map with the same cut geometry (see XFEMCutElem::cutGeometryHash()),
+   * so only the elements whose cut changed recompute their moment fitting weights
+   * @param old_cut_elems The cut elements before the update, deleted by the caller afterwards
+   */
+  void adoptCachedCutElemWeights(const std::map<unique_id_type, XFEMCutElem *> & old_cut_elems);
   std::set<const Elem *> _crack_tip_elems;
   std::set<const Elem *> _crack_tip_elems_to_be_healed;
   std::map<unsigned int, ElementPairLocator::ElementPairList> _sibling_elems;
@@ -301,6 +320,28 @@ private:
   /// 3: Full dump of element fragment algorithm mesh
   unsigned int _debug_output_level;
 
+  /**
+   * Whether the EFA mesh holds only the local and ghosted elements of this processor, rather
+   * than a replica of the whole mesh: the cuts of a DistributedMesh are then processed by the
+   * processors owning them (the ghost layer provides the neighbors of the cut elements)
+   */
+  bool _local_efa_mesh;
+
+  /// Whether the problem updates only the changed elements after cutting and healing
+  bool _incremental_update;
+
+  /// The IDs of the elements cut, added, deleted or healed by the last update or heal
+  std::set<dof_id_type> _changed_elems;
+
+  ///@{ Timers of the phases of the XFEM update
+  const PerfID _update_timer;
+  const PerfID _heal_timer;
+  const PerfID _build_efa_mesh_timer;
+  const PerfID _mark_cuts_timer;
+  const PerfID _cut_mesh_timer;
+  const PerfID _init_solution_timer;
+  ///@}
+
   /**
    * Data structure to store the nonlinear solution for nodes/elements affected by XFEM
    * For each node/element, this is stored as a vector that contains all components
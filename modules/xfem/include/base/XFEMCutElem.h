@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <map>
 #include <vector>
 
 #include "MooseTypes.h"
@@ -55,6 +58,14 @@ protected:
   std::vector<Real> _new_weights;
   /// face quadrature weights from surface area fraction
   std::vector<std::vector<Real>> _new_face_weights;
+  /// whether _physical_volfrac holds the volume fraction of the current cut
+  bool _have_volfrac;
+  /**
+   * Volume weights already computed, by quadrature rule (integration scheme and number of
+   * points), so that the residual evaluations with several rules on the element (or with
+   * different variable orders) do not recompute them
+   */
+  std::map<std::pair<int, unsigned int>, std::vector<Real>> _cached_weights;
   virtual Point getNodeCoordinates(EFANode * node, MeshBase * displaced_mesh = NULL) const = 0;
 
 public:
@@ -127,6 +138,50 @@ public:
                               const MooseArray<Point> & q_points,
                               unsigned int side);
   bool isPointPhysical(const Point & p) const;
+
+  /**
+   * A hash of the cut geometry of the element (the origin and normal of each cut plane), which
+   * identifies the cached weights and volume fraction: an element re-created by XFEM::update with
+   * the same cut can take over the cache of its predecessor
+   */
+  std::size_t cutGeometryHash() const
+  {
+    std::size_t hash = 1469598103934665603ull;
+    const auto combine = [&hash](const Point & p) {
+      for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+      {
+        std::uint64_t bits;
+        const Real value = p(d);
+        std::memcpy(&bits, &value, sizeof(bits));
+        hash ^= bits;
+        hash *= 1099511628211ull;
+      }
+    };
+    for (unsigned int plane = 0; plane < numCutPlanes(); ++plane)
+    {
+      combine(getCutPlaneOrigin(plane));
+      combine(getCutPlaneNormal(plane));
+    }
+    return hash;
+  }
+
+  /**
+   * Takes over the weights and volume fraction computed by an element with the same cut
+   * geometry (see cutGeometryHash())
+   * @return whether the cache was taken over
+   */
+  bool adoptCachedWeights(const XFEMCutElem & other)
+  {
+    if (other._n_qpoints != _n_qpoints || other.cutGeometryHash() != cutGeometryHash())
+      return false;
+    _cached_weights = other._cached_weights;
+    if (other._have_volfrac)
+    {
+      _physical_volfrac = other._physical_volfrac;
+      _have_volfrac = true;
+    }
+    return true;
+  }
   virtual void getIntersectionInfo(unsigned int plane_id,
                                    Point & normal,
                                    std::vector<Point> & intersectionPoints,
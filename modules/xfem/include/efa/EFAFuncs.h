@@ -13,6 +13,7 @@
 #include <set>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 namespace Efa
 {
@@ -74,6 +75,43 @@ getCommonElems(std::set<T> & v1, std::set<T> & v2)
   return common_elems;
 }
 
+/**
+ * Splits items into groups in which no two items share a node (greedy coloring of the graph of
+ * items sharing nodes), so that the items of a group can be processed concurrently without
+ * touching the same node.
+ * @param items The items, eg the cut elements
+ * @param nodes_of nodes_of(item) returns the nodes of an item
+ * @return The groups, each a list of items
+ */
+template <class T, class NodesOf>
+std::vector<std::vector<T>>
+independentGroups(const std::vector<T> & items, const NodesOf & nodes_of)
+{
+  typedef typename std::decay<decltype(*nodes_of(items[0]).begin())>::type Node;
+  std::vector<std::vector<T>> groups;
+  // The groups already holding an item on each node
+  std::map<Node, std::set<unsigned int>> node_groups;
+  for (const auto & item : items)
+  {
+    std::set<unsigned int> taken;
+    for (const auto & node : nodes_of(item))
+    {
+      const auto it = node_groups.find(node);
+      if (it != node_groups.end())
+        taken.insert(it->second.begin(), it->second.end());
+    }
+    unsigned int group = 0;
+    while (taken.count(group))
+      ++group;
+    if (group == groups.size())
+      groups.emplace_back();
+    groups[group].push_back(item);
+    for (const auto & node : nodes_of(item))
+      node_groups[node].insert(group);
+  }
+  return groups;
+}
+
 double linearQuadShape2D(unsigned int node_id, std::vector<double> & xi_2d);
 
 double linearTriShape2D(unsigned int node_id, std::vector<double> & xi_2d);
@@ -41,6 +41,8 @@ private:
   std::vector<EFAElement *> _child_elements;
   std::vector<EFAElement *> _parent_elements;
   std::map<EFANode *, std::set<EFAElement *>> _inverse_connectivity;
+  /// Number of threads updating the fragments of independent cut elements
+  unsigned int _num_threads;
 
 public:
   unsigned int add2DElements(std::vector<std::vector<unsigned int>> & quads);
@@ -63,6 +65,19 @@ public:
 
   void updatePhysicalLinksAndFragments();
 
+  /**
+   * Set the number of threads of updatePhysicalLinksAndFragments(): the elements with cuts are
+   * split by cutElementGroups() and the fragments of the elements of a group are updated
+   * concurrently, the groups one after the other
+   */
+  void setNumThreads(unsigned int num_threads) { _num_threads = num_threads ? num_threads : 1; }
+
+  /**
+   * The elements with new intersections, in groups in which no two elements share a node (see
+   * Efa::independentGroups)
+   */
+  std::vector<std::vector<EFAElement *>> cutElementGroups() const;
+
   void updateTopology(bool mergeUncutVirtualEdges = true);
   void reset();
   void clearAncestry();
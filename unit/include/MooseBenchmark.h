@@ -0,0 +1,129 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "gtest_include.h"
+
+#include "nlohmann/json.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/**
+ * Micro-benchmarks that live next to the unit tests and run in the same executable.
+ *
+ * A benchmark is a gtest test declared with MOOSE_BENCHMARK(Suite, Name) whose body passes the
+ * operation to time to Moose::Benchmark::run(). Benchmarks are skipped by a normal unit test run;
+ * `make benchmark` runs only them, with MOOSE_RUN_BENCHMARKS set, and collects the results of all
+ * of them into the JSON file named by MOOSE_BENCHMARK_JSON (benchmark.json by default):
+ *
+ * {"benchmarks": [{"name": "RankFourTensor.contractRankTwo", "iterations": ..., "ns_per_iteration":
+ * ...}, ...]}
+ */
+namespace Moose
+{
+namespace Benchmark
+{
+
+/// Whether or not benchmarks were requested
+inline bool
+enabled()
+{
+  return std::getenv("MOOSE_RUN_BENCHMARKS") != nullptr;
+}
+
+/// Keep the compiler from optimizing away a value computed by a benchmark
+template <typename T>
+inline void
+doNotOptimize(T const & value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// The results of every benchmark run by this process, written out at exit
+inline nlohmann::json &
+results()
+{
+  struct Results
+  {
+    ~Results()
+    {
+      if (json.empty())
+        return;
+
+      const char * file = std::getenv("MOOSE_BENCHMARK_JSON");
+      std::ofstream out(file ? file : "benchmark.json");
+      out << json.dump(2) << std::endl;
+    }
+
+    nlohmann::json json;
+  };
+
+  static Results results;
+  return results.json;
+}
+
+/**
+ * Time an operation: it is called in batches of doubling size until a batch takes at least
+ * min_time seconds, and the time per call of that batch is reported.
+ *
+ * @param name The name of the benchmark in the output
+ * @param operation The operation to time, called without arguments
+ * @param min_time The minimum time of the measured batch, in seconds
+ * @return The time per call, in nanoseconds
+ */
+template <typename Operation>
+double
+run(const std::string & name, Operation && operation, const double min_time = 0.2)
+{
+  // Warm up caches and lazily initialized data
+  operation();
+
+  unsigned long long iterations = 1;
+  double elapsed = 0;
+  while (true)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < iterations; ++i)
+      operation();
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (elapsed >= min_time || iterations >= (1ull << 40))
+      break;
+
+    iterations *= 2;
+  }
+
+  const double ns_per_iteration = 1e9 * elapsed / iterations;
+  results()["benchmarks"].push_back(
+      {{"name", name}, {"iterations", iterations}, {"ns_per_iteration", ns_per_iteration}});
+
+  std::cout << name << ": " << ns_per_iteration << " ns/iteration (" << iterations
+            << " iterations)" << std::endl;
+
+  return ns_per_iteration;
+}
+}
+}
+
+/**
+ * Declare a benchmark. The body is only executed when benchmarks were requested.
+ */
+#define MOOSE_BENCHMARK(suite, name)                                                               \
+  void suite##_##name##_benchmark();                                                               \
+  TEST(suite##Benchmark, name)                                                                     \
+  {                                                                                                \
+    if (Moose::Benchmark::enabled())                                                               \
+      suite##_##name##_benchmark();                                                                \
+  }                                                                                                \
+  void suite##_##name##_benchmark()